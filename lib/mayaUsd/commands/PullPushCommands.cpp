@@ -171,7 +171,13 @@ void* EditAsMayaCommand::creator()
 }
 
 // MPxCommand API to register the command syntax.
-MSyntax EditAsMayaCommand::createSyntax() { return createSyntaxWithUfeArgs(1); }
+MSyntax EditAsMayaCommand::createSyntax()
+{
+    // One or more UFE paths, all edited as Maya by the same command.
+    MSyntax syntax = createSyntaxWithUfeArgs(0);
+    syntax.setObjectType(MSyntax::kStringObjects, 1);
+    return syntax;
+}
 
 // MPxCommand API to execute the command.
 MStatus EditAsMayaCommand::doIt(const MArgList& argList)
@@ -185,19 +191,32 @@ MStatus EditAsMayaCommand::doIt(const MArgList& argList)
     if (status != MS::kSuccess)
         return status;
 
-    status = parseUfePathArg(argParser, 0, fPath);
+    MStringArray pathStrings;
+    status = argParser.getObjects(pathStrings);
     if (status != MS::kSuccess)
         return reportError(status);
 
-    if (!isPrimPath(fPath))
-        return reportError(MS::kInvalidParameter);
+    for (unsigned int i = 0; i < pathStrings.length(); ++i) {
+        Ufe::Path path;
+        status = parseArgAsUfePath(pathStrings[i], path);
+        if (status != MS::kSuccess)
+            return reportError(status);
 
-    // Scope the undo item recording so we can undo on failure.
+        if (!isPrimPath(path))
+            return reportError(MS::kInvalidParameter);
+
+        fPaths.push_back(path);
+    }
+
+    // Scope the undo item recording so we can undo on failure.  All the
+    // edited prims are undone together.
     {
         OpUndoItemRecorder undoRecorder(fUndoItemList);
 
-        auto& manager = PXR_NS::PrimUpdaterManager::getInstance();
-        status = manager.editAsMaya(fPath) ? MS::kSuccess : MS::kFailure;
+        auto&      manager = PXR_NS::PrimUpdaterManager::getInstance();
+        const bool edited
+            = (fPaths.size() == 1) ? manager.editAsMaya(fPaths[0]) : manager.editAsMaya(fPaths);
+        status = edited ? MS::kSuccess : MS::kFailure;
     }
 
     // Undo potentially partially-made edit-as-Maya on failure.
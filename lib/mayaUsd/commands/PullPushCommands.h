@@ -26,6 +26,8 @@
 #include <ufe/path.h>
 #include <ufe/undoableCommand.h>
 
+#include <vector>
+
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
@@ -83,7 +85,7 @@ private:
     // Make sure callers need to call creator().
     EditAsMayaCommand();
 
-    Ufe::Path fPath;
+    std::vector<Ufe::Path> fPaths;
 };
 
 //------------------------------------------------------------------------------
@@ -50,6 +50,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kExportInstancesFlag,
         UsdMayaJobExportArgsTokens->exportInstances.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kInstanceDuplicateMeshesFlag,
+        UsdMayaJobExportArgsTokens->instanceDuplicateMeshes.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kExportRefsAsInstanceableFlag,
         UsdMayaJobExportArgsTokens->exportRefsAsInstanceable.GetText(),
@@ -131,6 +135,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kIgnoreWarningsFlag,
         UsdMayaJobExportArgsTokens->ignoreWarnings.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kIncrementalExportFlag,
+        UsdMayaJobExportArgsTokens->incrementalExport.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kReferenceObjectModeFlag,
         UsdMayaJobExportArgsTokens->referenceObjectMode.GetText(),
@@ -207,6 +215,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         MSyntax::kBoolean);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
+    syntax.addFlag(
+        kValueClipFramesFlag,
+        UsdMayaJobExportArgsTokens->valueClipFrames.GetText(),
+        MSyntax::kDouble);
 
     // These are additional flags under our control.
     syntax.addFlag(kFrameRangeFlag, kFrameRangeFlagLong, MSyntax::kDouble, MSyntax::kDouble);
@@ -216,6 +228,8 @@ MSyntax MayaUSDExportCommand::createSyntax()
 
     syntax.addFlag(kAppendFlag, kAppendFlagLong, MSyntax::kBoolean);
     syntax.addFlag(kFileFlag, kFileFlagLong, MSyntax::kString);
+    syntax.addFlag(kExportTargetFlag, kExportTargetFlagLong, MSyntax::kString, MSyntax::kString);
+    syntax.makeFlagMultiUse(kExportTargetFlag);
     syntax.addFlag(kSelectionFlag, kSelectionFlagLong, MSyntax::kNoArg);
 
     syntax.addFlag(kFilterTypesFlag, kFilterTypesFlagLong, MSyntax::kString);
@@ -273,31 +287,35 @@ MStatus MayaUSDExportCommand::doIt(const MArgList& args)
         bool        append = false;
         std::string fileName;
 
+        const auto resolveFileName = [](const MString& rawFileName) {
+            // resolve the path into an absolute path
+            MFileObject absoluteFile;
+            absoluteFile.setRawFullName(rawFileName);
+            absoluteFile.setRawFullName(
+                absoluteFile.resolvedFullName()); // Make sure an absolute path
+            const std::string resolvedFileName = absoluteFile.resolvedFullName().asChar();
+            return resolvedFileName.empty() ? std::string(rawFileName.asChar())
+                                            : resolvedFileName;
+        };
+
         if (argData.isFlagSet(kAppendFlag)) {
             argData.getFlagArgument(kAppendFlag, 0, append);
         }
 
+        // Each export target writes one export root to its own file.
+        const unsigned int numTargets = argData.numberOfFlagUses(kExportTargetFlag);
+
         if (argData.isFlagSet(kFileFlag)) {
             // Get the value
             MString tmpVal;
             argData.getFlagArgument(kFileFlag, 0, tmpVal);
-
-            // resolve the path into an absolute path
-            MFileObject absoluteFile;
-            absoluteFile.setRawFullName(tmpVal);
-            absoluteFile.setRawFullName(
-                absoluteFile.resolvedFullName()); // Make sure an absolute path
-            fileName = absoluteFile.resolvedFullName().asChar();
-
-            if (fileName.empty()) {
-                fileName = tmpVal.asChar();
-            }
-        } else {
+            fileName = resolveFileName(tmpVal);
+        } else if (numTargets == 0) {
             TF_RUNTIME_ERROR("-file not specified.");
             return MS::kFailure;
         }
 
-        if (fileName.empty()) {
+        if (fileName.empty() && numTargets == 0) {
             return MS::kFailure;
         }
 
@@ -386,6 +404,50 @@ MStatus MayaUSDExportCommand::doIt(const MArgList& args)
 
         const std::vector<double> timeSamples
             = UsdMayaWriteUtil::GetTimeSamples(timeInterval, frameSamples, frameStride);
+
+        if (numTargets > 0) {
+            if (append || !fileName.empty()) {
+                TF_WARN("-file and -append are ignored when exporting to -exportTarget files.");
+            }
+
+            std::vector<std::unique_ptr<UsdMaya_WriteJob>> writeJobs;
+            std::vector<UsdMaya_WriteJob*>                 targetJobs;
+            std::vector<std::string>                       targetFileNames;
+            for (unsigned int i = 0; i < numTargets; ++i) {
+                MArgList tmpArgList;
+                argData.getFlagArgumentList(kExportTargetFlag, i, tmpArgList);
+                const MString rootPath = tmpArgList.asString(0);
+                MDagPath      rootDagPath = UsdMayaUtil::nameToDagPath(rootPath.asChar());
+                if (!rootDagPath.isValid()) {
+                    MGlobal::displayError(
+                        MString("Invalid dag path provided for exportTarget: ") + rootPath);
+                    return MS::kFailure;
+                }
+
+                VtDictionary targetUserArgs = userArgs;
+                targetUserArgs[UsdMayaJobExportArgsTokens->exportRoots]
+                    = std::vector<VtValue> { VtValue(std::string(rootPath.asChar())) };
+
+                MSelectionList           targetSelList;
+                UsdMayaUtil::MDagPathSet targetDagPaths;
+                targetSelList.add(rootDagPath);
+                UsdMayaUtil::GetFilteredSelectionToExport(false, targetSelList, targetDagPaths);
+
+                writeJobs.push_back(initializeWriteJob(UsdMayaJobExportArgs::CreateFromDictionary(
+                    targetUserArgs, targetDagPaths, timeSamples)));
+                if (!writeJobs.back()) {
+                    return MS::kFailure;
+                }
+                targetJobs.push_back(writeJobs.back().get());
+                targetFileNames.push_back(resolveFileName(tmpArgList.asString(1)));
+            }
+
+            if (!UsdMaya_WriteJob::WriteTargets(targetJobs, targetFileNames)) {
+                return MS::kFailure;
+            }
+            return MS::kSuccess;
+        }
+
         UsdMayaJobExportArgs jobArgs
             = UsdMayaJobExportArgs::CreateFromDictionary(userArgs, dagPaths, timeSamples);
 
@@ -50,7 +50,9 @@ public:
     static constexpr auto kExportVisibilityFlag = "vis";
     static constexpr auto kExportComponentTagsFlag = "tag";
     static constexpr auto kIgnoreWarningsFlag = "ign";
+    static constexpr auto kIncrementalExportFlag = "iex";
     static constexpr auto kExportInstancesFlag = "ein";
+    static constexpr auto kInstanceDuplicateMeshesFlag = "idm";
     static constexpr auto kMergeTransformAndShapeFlag = "mt";
     static constexpr auto kStripNamespacesFlag = "sn";
     static constexpr auto kExportRefsAsInstanceableFlag = "eri";
@@ -86,6 +88,7 @@ public:
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
     static constexpr auto kGeomSidednessFlag = "gs";
+    static constexpr auto kValueClipFramesFlag = "vcf";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
     static constexpr auto kWorldspaceFlag = "wsp";
@@ -97,6 +100,8 @@ public:
     static constexpr auto kFilterTypesFlagLong = "filterTypes";
     static constexpr auto kFileFlag = "f";
     static constexpr auto kFileFlagLong = "file";
+    static constexpr auto kExportTargetFlag = "etg";
+    static constexpr auto kExportTargetFlagLong = "exportTarget";
     static constexpr auto kSelectionFlag = "sl";
     static constexpr auto kSelectionFlagLong = "selection";
     static constexpr auto kFrameSampleFlag = "fs";
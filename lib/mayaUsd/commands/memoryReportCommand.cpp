@@ -0,0 +1,125 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "memoryReportCommand.h"
+
+#include <mayaUsd/utils/memoryReport.h>
+
+#include <maya/MArgDatabase.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MGlobal.h>
+#include <maya/MStringArray.h>
+#include <maya/MSyntax.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+const char kListFlag[] = "l";
+const char kListFlagL[] = "list";
+const char kTopPrimsFlag[] = "tp";
+const char kTopPrimsFlagL[] = "topPrims";
+const char kTopPrimBytesFlag[] = "tpb";
+const char kTopPrimBytesFlagL[] = "topPrimBytes";
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+const char MemoryReportCommand::commandName[] = "mayaUsdMemoryReport";
+
+// plug-in callback to create the command object
+void* MemoryReportCommand::creator() { return static_cast<MPxCommand*>(new MemoryReportCommand()); }
+
+// plug-in callback to register the command syntax
+MSyntax MemoryReportCommand::createSyntax()
+{
+    MSyntax syntax;
+
+    syntax.enableQuery(false);
+    syntax.enableEdit(false);
+
+    // proxy shape name
+    syntax.setObjectType(MSyntax::kStringObjects, 0, 1);
+
+    syntax.addFlag(kListFlag, kListFlagL, MSyntax::kNoArg);
+    syntax.addFlag(kTopPrimsFlag, kTopPrimsFlagL, MSyntax::kUnsigned);
+    syntax.addFlag(kTopPrimBytesFlag, kTopPrimBytesFlagL, MSyntax::kUnsigned);
+
+    return syntax;
+}
+
+MStatus MemoryReportCommand::doIt(const MArgList& argList)
+{
+    MStatus      status;
+    MArgDatabase argData(syntax(), argList, &status);
+    if (status != MS::kSuccess) {
+        return MS::kInvalidParameter;
+    }
+
+    if (argData.isFlagSet(kListFlag)) {
+        MStringArray names;
+        for (const auto& total : UsdMayaMemoryReport().GetTotals()) {
+            names.append(total.first.c_str());
+        }
+        setResult(names);
+        return MS::kSuccess;
+    }
+
+    unsigned int maxPrims = 0;
+    for (const char* flag : { kTopPrimsFlag, kTopPrimBytesFlag }) {
+        if (argData.isFlagSet(flag)) {
+            status = argData.getFlagArgument(flag, 0, maxPrims);
+            if (status != MS::kSuccess) {
+                return status;
+            }
+        }
+    }
+
+    MStringArray objects;
+    argData.getObjects(objects);
+    if (objects.length() != 1) {
+        MGlobal::displayError("A proxy shape is required");
+        return MS::kInvalidParameter;
+    }
+
+    UsdMayaMemoryReport report;
+    if (!UsdMayaMemoryReport::Compute(objects[0].asChar(), maxPrims, &report)) {
+        MGlobal::displayError(MString("Invalid proxy shape \"") + objects[0] + "\"");
+        return MS::kInvalidParameter;
+    }
+
+    if (argData.isFlagSet(kTopPrimsFlag)) {
+        MStringArray paths;
+        for (const HdVP2PrimMemoryUsage& prim : report.renderUsage._prims) {
+            paths.append(prim._usdPath.GetText());
+        }
+        setResult(paths);
+    } else if (argData.isFlagSet(kTopPrimBytesFlag)) {
+        MDoubleArray bytes;
+        for (const HdVP2PrimMemoryUsage& prim : report.renderUsage._prims) {
+            bytes.append(static_cast<double>(prim.GetTotalBytes()));
+        }
+        setResult(bytes);
+    } else {
+        MDoubleArray values;
+        for (const auto& total : report.GetTotals()) {
+            values.append(total.second);
+        }
+        setResult(values);
+    }
+
+    return MS::kSuccess;
+}
+
+} // namespace MAYAUSD_NS_DEF
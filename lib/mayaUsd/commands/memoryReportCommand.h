@@ -0,0 +1,57 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef MAYAUSD_COMMANDS_MEMORY_REPORT_COMMAND_H
+#define MAYAUSD_COMMANDS_MEMORY_REPORT_COMMAND_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/mayaUsd.h>
+
+#include <maya/MPxCommand.h>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief  Report the memory used by a proxy shape, its stage and its VP2 resources.
+
+    mayaUsdMemoryReport -list;                          // Return the names of the totals
+    mayaUsdMemoryReport "stageShape";                   // Return the totals, in list order
+    mayaUsdMemoryReport -topPrims 10 "stageShape";      // Return the paths of the largest prims
+    mayaUsdMemoryReport -topPrimBytes 10 "stageShape";  // Return the bytes of the largest prims
+*/
+class MemoryReportCommand : public MPxCommand
+{
+public:
+    // plugin registration requirements
+    MAYAUSD_CORE_PUBLIC
+    static const char commandName[];
+
+    MAYAUSD_CORE_PUBLIC
+    static void* creator();
+
+    MAYAUSD_CORE_PUBLIC
+    static MSyntax createSyntax();
+
+    // MPxCommand callbacks
+    MAYAUSD_CORE_PUBLIC
+    MStatus doIt(const MArgList& argList) override;
+
+    MAYAUSD_CORE_PUBLIC
+    bool isUndoable() const override { return false; }
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif // MAYAUSD_COMMANDS_MEMORY_REPORT_COMMAND_H
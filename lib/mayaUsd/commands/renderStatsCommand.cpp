@@ -0,0 +1,122 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "renderStatsCommand.h"
+
+#include <mayaUsd/render/vp2RenderDelegate/renderStats.h>
+
+#include <maya/MArgDatabase.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MGlobal.h>
+#include <maya/MStringArray.h>
+#include <maya/MSyntax.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+const char kEnableFlag[] = "e";
+const char kEnableFlagL[] = "enable";
+const char kListFlag[] = "l";
+const char kListFlagL[] = "list";
+const char kCounterFlag[] = "c";
+const char kCounterFlagL[] = "counter";
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+const char RenderStatsCommand::commandName[] = "mayaUsdRenderStats";
+
+// plug-in callback to create the command object
+void* RenderStatsCommand::creator() { return static_cast<MPxCommand*>(new RenderStatsCommand()); }
+
+// plug-in callback to register the command syntax
+MSyntax RenderStatsCommand::createSyntax()
+{
+    MSyntax syntax;
+
+    syntax.enableQuery(true);
+    syntax.enableEdit(false);
+
+    syntax.addFlag(kEnableFlag, kEnableFlagL, MSyntax::kBoolean);
+    syntax.addFlag(kListFlag, kListFlagL, MSyntax::kNoArg);
+    syntax.addFlag(kCounterFlag, kCounterFlagL, MSyntax::kString);
+
+    return syntax;
+}
+
+MStatus RenderStatsCommand::doIt(const MArgList& argList)
+{
+    MStatus      status;
+    MArgDatabase argData(syntax(), argList, &status);
+    if (status != MS::kSuccess) {
+        return MS::kInvalidParameter;
+    }
+
+    if (argData.isFlagSet(kEnableFlag)) {
+        if (argData.isQuery()) {
+            setResult(HdVP2RenderStats::IsEnabled());
+            return MS::kSuccess;
+        }
+
+        bool enable = false;
+        status = argData.getFlagArgument(kEnableFlag, 0, enable);
+        if (status != MS::kSuccess) {
+            return status;
+        }
+
+        if (enable) {
+            HdVP2RenderStats::Enable();
+        } else {
+            HdVP2RenderStats::Disable();
+        }
+        return MS::kSuccess;
+    }
+
+    const HdVP2RenderStats::Counters counters = HdVP2RenderStats::GetCounters();
+
+    if (argData.isFlagSet(kListFlag)) {
+        MStringArray names;
+        for (const auto& counter : counters) {
+            names.append(counter.first.GetText());
+        }
+        setResult(names);
+    } else if (argData.isFlagSet(kCounterFlag)) {
+        MString name;
+        status = argData.getFlagArgument(kCounterFlag, 0, name);
+        if (status != MS::kSuccess) {
+            return status;
+        }
+
+        for (const auto& counter : counters) {
+            if (counter.first.GetString() == name.asChar()) {
+                setResult(counter.second);
+                return MS::kSuccess;
+            }
+        }
+
+        MGlobal::displayError(MString("Invalid render statistics counter \"") + name + "\"");
+        return MS::kInvalidParameter;
+    } else {
+        MDoubleArray values;
+        for (const auto& counter : counters) {
+            values.append(counter.second);
+        }
+        setResult(values);
+    }
+
+    return MS::kSuccess;
+}
+
+} // namespace MAYAUSD_NS_DEF
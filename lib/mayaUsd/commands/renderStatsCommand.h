@@ -0,0 +1,58 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef MAYAUSD_COMMANDS_RENDER_STATS_COMMAND_H
+#define MAYAUSD_COMMANDS_RENDER_STATS_COMMAND_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/mayaUsd.h>
+
+#include <maya/MPxCommand.h>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief  Query the runtime statistics of the VP2 render delegate.
+
+    mayaUsdRenderStats -enable true;     // Start recording the statistics
+    mayaUsdRenderStats -q -enable;       // Return true when the statistics are recorded
+    mayaUsdRenderStats -list;            // Return the names of the counters
+    mayaUsdRenderStats -counter "name";  // Return the value of a counter
+    mayaUsdRenderStats;                  // Return the values of all counters, in list order
+*/
+class RenderStatsCommand : public MPxCommand
+{
+public:
+    // plugin registration requirements
+    MAYAUSD_CORE_PUBLIC
+    static const char commandName[];
+
+    MAYAUSD_CORE_PUBLIC
+    static void* creator();
+
+    MAYAUSD_CORE_PUBLIC
+    static MSyntax createSyntax();
+
+    // MPxCommand callbacks
+    MAYAUSD_CORE_PUBLIC
+    MStatus doIt(const MArgList& argList) override;
+
+    MAYAUSD_CORE_PUBLIC
+    bool isUndoable() const override { return false; }
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif // MAYAUSD_COMMANDS_RENDER_STATS_COMMAND_H
@@ -0,0 +1,101 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "traceCommand.h"
+
+#include <pxr/base/trace/collector.h>
+#include <pxr/base/trace/reporter.h>
+
+#include <maya/MArgDatabase.h>
+#include <maya/MGlobal.h>
+#include <maya/MSyntax.h>
+
+#include <fstream>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+const char kStartFlag[] = "st";
+const char kStartFlagL[] = "start";
+const char kStopFlag[] = "sp";
+const char kStopFlagL[] = "stop";
+const char kChromeTraceFlag[] = "ct";
+const char kChromeTraceFlagL[] = "chromeTrace";
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+const char TraceCommand::commandName[] = "mayaUsdTrace";
+
+// plug-in callback to create the command object
+void* TraceCommand::creator() { return static_cast<MPxCommand*>(new TraceCommand()); }
+
+// plug-in callback to register the command syntax
+MSyntax TraceCommand::createSyntax()
+{
+    MSyntax syntax;
+
+    syntax.enableQuery(false);
+    syntax.enableEdit(false);
+
+    syntax.addFlag(kStartFlag, kStartFlagL, MSyntax::kNoArg);
+    syntax.addFlag(kStopFlag, kStopFlagL, MSyntax::kNoArg);
+    syntax.addFlag(kChromeTraceFlag, kChromeTraceFlagL, MSyntax::kString);
+
+    return syntax;
+}
+
+MStatus TraceCommand::doIt(const MArgList& argList)
+{
+    MStatus      status;
+    MArgDatabase argData(syntax(), argList, &status);
+    if (status != MS::kSuccess) {
+        return MS::kInvalidParameter;
+    }
+
+    TraceCollector&  collector = TraceCollector::GetInstance();
+    TraceReporterPtr reporter = TraceReporter::GetGlobalReporter();
+
+    if (argData.isFlagSet(kStartFlag)) {
+        collector.SetEnabled(false);
+        collector.Clear();
+        reporter->ClearTree();
+        collector.SetEnabled(true);
+    }
+
+    if (argData.isFlagSet(kStopFlag)) {
+        collector.SetEnabled(false);
+    }
+
+    if (argData.isFlagSet(kChromeTraceFlag)) {
+        MString fileName;
+        status = argData.getFlagArgument(kChromeTraceFlag, 0, fileName);
+        if (status != MS::kSuccess) {
+            return status;
+        }
+
+        std::ofstream out(fileName.asChar());
+        if (!out) {
+            MGlobal::displayError(MString("Cannot write the trace to \"") + fileName + "\"");
+            return MS::kFailure;
+        }
+        reporter->ReportChromeTracing(out);
+    }
+
+    setResult(TraceCollector::IsEnabled());
+    return MS::kSuccess;
+}
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,350 @@
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from __future__ import division
+
+"""
+Benchmark mayaUSDExport and mayaUSDImport on synthetic production-sized scenes.
+
+Each configuration generates a Maya scene of meshes nested in a hierarchy,
+with materials, skinned characters and animation, exports it with
+mayaUSDExport and imports the exported file back with mayaUSDImport into an
+empty scene. It runs in an interactive session or in a batch session under
+mayapy.
+
+Usage from mayapy:
+
+    mayapy benchmarkMayaUsdImportExport.py --output results.json
+    mayapy benchmarkMayaUsdImportExport.py --config big=5000,400,8,100,10 --frames 24
+
+The results of each configuration are:
+
+    "generate_time"   : time taken to generate the Maya scene, in seconds
+    "export_time"     : time taken by mayaUSDExport, in seconds
+    "import_time"     : time taken by mayaUSDImport, in seconds
+    "file_size"       : size of the exported file, in bytes
+    "imported_nodes"  : number of DAG nodes created by the import
+    "memory"          : [physical, virtual] memory in MB after generating the
+                        scene, after the export and after the import
+    "peak_memory"     : peak physical memory of the process in MB after the
+                        export and after the import, or null where the
+                        platform does not report it
+"""
+
+import argparse
+import json
+import os
+import shutil
+import sys
+import tempfile
+from timeit import default_timer
+
+import maya.cmds as cmds
+
+from pxr import Usd
+
+# Configurations run when none is given, as name: (meshes, faces, depth, materials, characters)
+DEFAULT_CONFIGURATIONS = {
+    'meshes'     : (2000, 100, 1, 1, 0),
+    'dense'      : (20, 100000, 1, 1, 0),
+    'hierarchy'  : (2000, 16, 20, 1, 0),
+    'materials'  : (1000, 100, 1, 500, 0),
+    'characters' : (0, 0, 1, 1, 20),
+}
+
+DEFAULT_FRAMES = 10
+
+# Distance between two neighbouring meshes
+GRID_SPACING = 3.0
+
+# Joints of each skinned character, along its height
+CHARACTER_JOINTS = 8
+
+# Options shared by all the exports
+EXPORT_OPTIONS = {
+    'shadingMode'      : 'useRegistry',
+    'exportSkels'      : 'auto',
+    'exportSkin'       : 'auto',
+    'defaultUSDFormat' : 'usdc',
+}
+
+
+def get_memory():
+    '''
+    :return: A 2 member list with current physical and virtual memory in use by Maya
+    '''
+    return [ cmds.memory(asFloat=True, megaByte=True, physicalMemory=True)
+           , cmds.memory(asFloat=True, megaByte=True, adjustedVirtualMemory=True) ]
+
+
+def get_peak_memory():
+    '''
+    :return: The peak physical memory of the process in MB, or None if unknown
+    '''
+    if sys.platform == 'win32':
+        import ctypes
+        from ctypes import wintypes
+
+        class PROCESS_MEMORY_COUNTERS(ctypes.Structure):
+            _fields_ = [('cb', wintypes.DWORD),
+                        ('PageFaultCount', wintypes.DWORD),
+                        ('PeakWorkingSetSize', ctypes.c_size_t),
+                        ('WorkingSetSize', ctypes.c_size_t),
+                        ('QuotaPeakPagedPoolUsage', ctypes.c_size_t),
+                        ('QuotaPagedPoolUsage', ctypes.c_size_t),
+                        ('QuotaPeakNonPagedPoolUsage', ctypes.c_size_t),
+                        ('QuotaNonPagedPoolUsage', ctypes.c_size_t),
+                        ('PagefileUsage', ctypes.c_size_t),
+                        ('PeakPagefileUsage', ctypes.c_size_t)]
+
+        counters = PROCESS_MEMORY_COUNTERS()
+        counters.cb = ctypes.sizeof(counters)
+        process = ctypes.windll.kernel32.GetCurrentProcess()
+        if not ctypes.windll.psapi.GetProcessMemoryInfo(
+                process, ctypes.byref(counters), counters.cb):
+            return None
+        return counters.PeakWorkingSetSize / (1024.0 * 1024.0)
+
+    try:
+        import resource
+    except ImportError:
+        return None
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # ru_maxrss is in bytes on macOS and in kilobytes on Linux.
+    return peak / (1024.0 * 1024.0) if sys.platform == 'darwin' else peak / 1024.0
+
+
+def grid_position(index, count):
+    '''
+    :return: The position of the index-th element of a square grid of count elements
+    '''
+    side = max(1, int(count ** 0.5 + 0.999))
+    return ((index % side) * GRID_SPACING, 0.0, (index // side) * GRID_SPACING)
+
+
+def create_materials(numMaterials):
+    '''
+    Create numMaterials standardSurface shading groups.
+
+    :return: The names of the shading groups
+    '''
+    shadingGroups = []
+    for i in range(numMaterials):
+        shader = cmds.shadingNode('standardSurface', asShader=True, name='material%d' % i)
+        hue = i / max(1, numMaterials)
+        cmds.setAttr(shader + '.baseColor', hue, 1.0 - hue, 0.5, type='double3')
+        shadingGroup = cmds.sets(renderable=True, noSurfaceShader=True, empty=True,
+                                 name='material%dSG' % i)
+        cmds.connectAttr(shader + '.outColor', shadingGroup + '.surfaceShader')
+        shadingGroups.append(shadingGroup)
+    return shadingGroups
+
+
+def create_hierarchy(depth):
+    '''
+    Create a chain of depth nested transforms.
+
+    :return: The name of the deepest transform
+    '''
+    parent = cmds.createNode('transform', name='root', skipSelect=True)
+    for level in range(1, depth):
+        parent = cmds.createNode('transform', name='level%d' % level, parent=parent,
+                                 skipSelect=True)
+    return parent
+
+
+def create_meshes(numMeshes, numFaces, parent, shadingGroups, numFrames):
+    '''
+    Create numMeshes planes of about numFaces faces under parent, animated over
+    numFrames frames and bound round-robin to the shading groups.
+    '''
+    subdivisions = max(1, int(numFaces ** 0.5 + 0.5))
+    for i in range(numMeshes):
+        mesh = cmds.polyPlane(width=2, height=2, subdivisionsX=subdivisions,
+                              subdivisionsY=subdivisions, constructionHistory=False,
+                              name='mesh%d' % i)[0]
+        mesh = cmds.parent(mesh, parent)[0]
+        position = grid_position(i, numMeshes)
+        cmds.xform(mesh, translation=position)
+        if numFrames > 1:
+            cmds.setKeyframe(mesh, attribute='translateY', time=1, value=0.0)
+            cmds.setKeyframe(mesh, attribute='translateY', time=numFrames, value=GRID_SPACING)
+        if shadingGroups:
+            cmds.sets(mesh, edit=True, forceElement=shadingGroups[i % len(shadingGroups)])
+
+
+def create_characters(numCharacters, shadingGroups, numFrames):
+    '''
+    Create numCharacters cylinders skinned to a chain of joints that bends over
+    numFrames frames.
+    '''
+    height = 2.0 * CHARACTER_JOINTS
+    for i in range(numCharacters):
+        x, _, z = grid_position(i, numCharacters)
+        x -= GRID_SPACING * 4
+
+        cmds.select(clear=True)
+        joints = []
+        for j in range(CHARACTER_JOINTS):
+            joints.append(cmds.joint(position=(x, j * 2.0, z),
+                                     name='character%d_joint%d' % (i, j)))
+        cmds.select(clear=True)
+
+        body = cmds.polyCylinder(radius=0.5, height=height, subdivisionsAxis=16,
+                                 subdivisionsHeight=CHARACTER_JOINTS * 4,
+                                 constructionHistory=False, name='character%d' % i)[0]
+        cmds.xform(body, translation=(x, height * 0.5, z))
+        cmds.skinCluster(joints, body, toSelectedBones=True, name='character%d_skin' % i)
+        if shadingGroups:
+            cmds.sets(body, edit=True, forceElement=shadingGroups[i % len(shadingGroups)])
+
+        if numFrames > 1:
+            for joint in joints[1:]:
+                cmds.setKeyframe(joint, attribute='rotateZ', time=1, value=-20.0)
+                cmds.setKeyframe(joint, attribute='rotateZ', time=numFrames, value=20.0)
+
+
+def generate_scene(numMeshes, numFaces, depth, numMaterials, numCharacters, numFrames):
+    '''
+    Replace the current Maya scene by a synthetic one, see the module docs.
+    '''
+    cmds.file(new=True, force=True)
+    cmds.playbackOptions(minTime=1, maxTime=numFrames)
+    shadingGroups = create_materials(numMaterials)
+    if numMeshes > 0:
+        create_meshes(numMeshes, numFaces, create_hierarchy(max(1, depth)), shadingGroups,
+                      numFrames)
+    create_characters(numCharacters, shadingGroups, numFrames)
+    cmds.select(clear=True)
+
+
+def run_configuration(name, numMeshes, numFaces, depth, numMaterials, numCharacters, numFrames,
+                      directory):
+    '''
+    Generate a scene, export it and import the exported file back.
+
+    :return: A dictionary with the results, see the module docs.
+    '''
+    results = {
+        'meshes'     : numMeshes,
+        'faces'      : numFaces,
+        'depth'      : depth,
+        'materials'  : numMaterials,
+        'characters' : numCharacters,
+        'frames'     : numFrames,
+    }
+
+    start = default_timer()
+    generate_scene(numMeshes, numFaces, depth, numMaterials, numCharacters, numFrames)
+    results['generate_time'] = default_timer() - start
+    results['memory'] = [get_memory()]
+
+    usdFile = os.path.join(directory, name + '.usd')
+    exportOptions = dict(EXPORT_OPTIONS)
+    if numFrames > 1:
+        exportOptions['frameRange'] = (1, numFrames)
+
+    start = default_timer()
+    cmds.mayaUSDExport(file=usdFile, **exportOptions)
+    results['export_time'] = default_timer() - start
+    results['file_size'] = os.path.getsize(usdFile)
+    results['memory'].append(get_memory())
+    results['peak_memory'] = [get_peak_memory()]
+
+    cmds.file(new=True, force=True)
+    numNodes = len(cmds.ls(dag=True))
+
+    start = default_timer()
+    cmds.mayaUSDImport(file=usdFile, readAnimData=numFrames > 1,
+                       shadingMode=[['useRegistry', 'UsdPreviewSurface'], ])
+    results['import_time'] = default_timer() - start
+    results['imported_nodes'] = len(cmds.ls(dag=True)) - numNodes
+    results['memory'].append(get_memory())
+    results['peak_memory'].append(get_peak_memory())
+
+    cmds.file(new=True, force=True)
+    return results
+
+
+def parse_configuration(text):
+    '''
+    Parse a NAME=MESHES,FACES,DEPTH,MATERIALS,CHARACTERS configuration argument.
+    '''
+    try:
+        name, counts = text.split('=', 1)
+        values = tuple(int(value) for value in counts.split(','))
+        if len(values) != 5:
+            raise ValueError()
+    except ValueError:
+        raise argparse.ArgumentTypeError(
+            'expected NAME=MESHES,FACES,DEPTH,MATERIALS,CHARACTERS, got "%s"' % text)
+    return name, values
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description='Benchmark mayaUSDImport and mayaUSDExport.')
+    parser.add_argument('--config', action='append', type=parse_configuration, default=[],
+                        metavar='NAME=MESHES,FACES,DEPTH,MATERIALS,CHARACTERS',
+                        help='scene to benchmark, may be repeated (default: %s)'
+                        % ', '.join(sorted(DEFAULT_CONFIGURATIONS)))
+    parser.add_argument('--frames', type=int, default=DEFAULT_FRAMES,
+                        help='number of animated frames, 1 for a static scene')
+    parser.add_argument('--keep', metavar='DIRECTORY',
+                        help='directory where the exported files are kept, '
+                        'a temporary directory removed at the end by default')
+    parser.add_argument('--output', help='JSON file to write, standard output by default')
+    args = parser.parse_args(argv)
+
+    configurations = dict(args.config) if args.config else DEFAULT_CONFIGURATIONS
+
+    cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+    report = {
+        'maya_version'    : cmds.about(version=True),
+        'mayausd_version' : cmds.pluginInfo('mayaUsdPlugin', query=True, version=True),
+        'usd_version'     : '.'.join(str(value) for value in Usd.GetVersion()),
+        'configurations'  : {},
+    }
+
+    directory = args.keep or tempfile.mkdtemp(prefix='benchmarkMayaUsdImportExport')
+    if not os.path.isdir(directory):
+        os.makedirs(directory)
+    try:
+        for name in sorted(configurations):
+            report['configurations'][name] = run_configuration(
+                name, *(configurations[name] + (args.frames, directory)))
+    finally:
+        if not args.keep:
+            shutil.rmtree(directory, ignore_errors=True)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=4, sort_keys=True)
+    else:
+        json.dump(report, sys.stdout, indent=4, sort_keys=True)
+        sys.stdout.write('\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    import maya.standalone
+    maya.standalone.initialize(name='python')
+    try:
+        status = main()
+    finally:
+        maya.standalone.uninitialize()
+    sys.exit(status)
@@ -35,4 +35,6 @@ bool UsdMayaExportChaser::PostExport()
     return true;
 }
 
+bool UsdMayaExportChaser::CanRunConcurrently() const { return false; }
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -69,6 +69,22 @@ public:
     /// Returning false will terminate the whole export.
     MAYAUSD_CORE_PUBLIC
     virtual bool PostExport();
+
+    /// Whether this chaser is independent of the other chasers and
+    /// thread-safe. The export runs the consecutive chasers returning \c true
+    /// concurrently, on worker threads, at the default time, at each frame and
+    /// after the export.
+    ///
+    /// The Maya API must not be called from these chasers: it is not
+    /// thread-safe. They may only read the stage. Authoring USD is not allowed
+    /// either, since the change notices are sent to listeners on the worker
+    /// thread. They must not depend on the other chasers.
+    ///
+    /// Base implementation returns \c false, the chaser runs on the main
+    /// thread. Chasers written in Python can't override it, they always run
+    /// on the main thread.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool CanRunConcurrently() const;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
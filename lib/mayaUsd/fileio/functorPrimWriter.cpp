@@ -48,6 +48,13 @@ UsdMaya_FunctorPrimWriter::UsdMaya_FunctorPrimWriter(
 /* virtual */
 UsdMaya_FunctorPrimWriter::~UsdMaya_FunctorPrimWriter() { }
 
+/* virtual */
+bool UsdMaya_FunctorPrimWriter::IsAnimated() const
+{
+    // The functor is called at every time sample.
+    return true;
+}
+
 /* virtual */
 void UsdMaya_FunctorPrimWriter::Write(const UsdTimeCode& usdTime)
 {
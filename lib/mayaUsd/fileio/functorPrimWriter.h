@@ -49,6 +49,7 @@ public:
     ~UsdMaya_FunctorPrimWriter() override;
 
     void                 Write(const UsdTimeCode& usdTime) override;
+    bool                 IsAnimated() const override;
     bool                 ExportsGprims() const override;
     bool                 ShouldPruneChildren() const override;
     const SdfPathVector& GetModelPaths() const override;
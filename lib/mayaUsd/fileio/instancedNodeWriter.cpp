@@ -25,7 +25,6 @@
 #include <pxr/usd/usd/timeCode.h>
 
 #include <maya/MDagPath.h>
-#include <maya/MDagPathArray.h>
 #include <maya/MFnDependencyNode.h>
 
 #include <string>
@@ -35,6 +34,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 /// Assuming that \p instance1 and \p instance2 are instances of one another,
 /// replaces the prefix \p instance1 in \p dagPath with \p instance2.
+/// Duplicated meshes are different nodes, but only map their own path.
 static MDagPath _ReplaceInstancePrefix(
     const MDagPath& dagPath,
     const MDagPath& instance1,
@@ -45,6 +45,10 @@ static MDagPath _ReplaceInstancePrefix(
         return dagPath;
     }
 
+    if (dagPath == instance1) {
+        return instance2;
+    }
+
     if (instance1.node() != instance2.node()) {
         TF_CODING_ERROR(
             "'%s' and '%s' are not instances of one another",
@@ -137,15 +141,14 @@ UsdMaya_InstancedNodeWriter::UsdMaya_InstancedNodeWriter(
     _usdPrim.SetInstanceable(true);
 
     // Get the Maya DAG path corresponding to our "instance master" root.
-    // We used the 0th instance to write out the USD instance master.
-    MDagPathArray allInstances;
-    MDagPath::getAllPathsTo(mayaInstancePath.node(), allInstances);
-    if (allInstances.length() == 0) {
+    // We used the 0th instance, or the first of the duplicated meshes, to
+    // write out the USD instance master.
+    const MDagPath dagMasterRootPath = ctx._GetInstanceMasterDagPath(mayaInstancePath);
+    if (!dagMasterRootPath.isValid()) {
         TF_CODING_ERROR(
             "'%s' should have at least one path", mayaInstancePath.fullPathName().asChar());
         return;
     }
-    const MDagPath dagMasterRootPath = allInstances[0];
 
     // Loop through our prim writers and compute cached data.
     std::vector<UsdMayaPrimWriterSharedPtr>::const_iterator begin;
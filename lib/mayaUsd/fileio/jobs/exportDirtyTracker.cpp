@@ -0,0 +1,194 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "exportDirtyTracker.h"
+
+#include <pxr/base/tf/pathUtils.h>
+
+#include <maya/MCallbackIdArray.h>
+#include <maya/MDagMessage.h>
+#include <maya/MMessage.h>
+#include <maya/MNodeMessage.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
+#include <maya/MSceneMessage.h>
+
+#include <map>
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+struct _MObjectHandleComp
+{
+    bool operator()(const MObjectHandle& lhs, const MObjectHandle& rhs) const
+    {
+        return lhs.hashCode() < rhs.hashCode();
+    }
+};
+
+// Record of the last incremental export of a file.
+struct _TrackedFile
+{
+    ~_TrackedFile() { MMessage::removeCallbacks(callbackIds); }
+
+    std::string                       argsDescription;
+    UsdMayaUtil::MDagPathMap<SdfPath> dagPathToUsdPathMap;
+
+    // Dirty flag of each exported node. The node callbacks point to the values,
+    // which don't move when other nodes are inserted.
+    std::map<MObjectHandle, bool, _MObjectHandleComp> dirtyNodes;
+
+    // Set when the DAG changed in a way which can change the exported paths.
+    bool structureChanged = false;
+
+    MCallbackIdArray callbackIds;
+};
+
+std::map<std::string, std::unique_ptr<_TrackedFile>> _trackedFiles;
+
+MCallbackIdArray _sceneCallbackIds;
+
+std::string _GetFileKey(const std::string& fileName) { return TfAbsPath(fileName); }
+
+void _SetNodeDirty(MObject&, void* clientData) { *static_cast<bool*>(clientData) = true; }
+
+void _SetAttributeDirty(MNodeMessage::AttributeMessage, MPlug&, MPlug&, void* clientData)
+{
+    *static_cast<bool*>(clientData) = true;
+}
+
+void _SetNodeRenamed(MObject&, const MString&, void* clientData)
+{
+    static_cast<_TrackedFile*>(clientData)->structureChanged = true;
+}
+
+void _SetDagChanged(MDagPath&, MDagPath&, void* clientData)
+{
+    static_cast<_TrackedFile*>(clientData)->structureChanged = true;
+}
+
+void _ForgetTrackedFiles(void*) { _trackedFiles.clear(); }
+
+void _RegisterSceneCallbacks()
+{
+    if (_sceneCallbackIds.length() > 0) {
+        return;
+    }
+
+    // The recorded nodes are gone once another scene is loaded.
+    _sceneCallbackIds.append(
+        MSceneMessage::addCallback(MSceneMessage::kBeforeNew, _ForgetTrackedFiles));
+    _sceneCallbackIds.append(
+        MSceneMessage::addCallback(MSceneMessage::kBeforeOpen, _ForgetTrackedFiles));
+}
+
+} // namespace
+
+/* static */
+bool UsdMaya_ExportDirtyTracker::GetChanges(
+    const std::string& fileName,
+    const std::string& argsDescription,
+    Changes*           changes)
+{
+    const auto it = _trackedFiles.find(_GetFileKey(fileName));
+    if (it == _trackedFiles.end() || !changes) {
+        return false;
+    }
+
+    const _TrackedFile& trackedFile = *it->second;
+    if (trackedFile.structureChanged || trackedFile.argsDescription != argsDescription) {
+        return false;
+    }
+
+    changes->dirtyPrimPaths.clear();
+    changes->cleanDagPaths.clear();
+
+    for (const auto& entry : trackedFile.dagPathToUsdPathMap) {
+        // Deleted nodes are normally reported as DAG changes, this also
+        // catches the ones deleted while the callbacks were not called.
+        if (!entry.first.isValid()) {
+            return false;
+        }
+
+        const auto nodeIt = trackedFile.dirtyNodes.find(MObjectHandle(entry.first.node()));
+        if (nodeIt == trackedFile.dirtyNodes.end() || nodeIt->second) {
+            changes->dirtyPrimPaths.insert(entry.second);
+        }
+    }
+
+    // A prim can be written from several nodes, e.g. a transform merged with
+    // its shape, it is clean only when all of them are.
+    for (const auto& entry : trackedFile.dagPathToUsdPathMap) {
+        if (changes->dirtyPrimPaths.count(entry.second) == 0) {
+            changes->cleanDagPaths.insert(entry.first);
+        }
+    }
+
+    return true;
+}
+
+/* static */
+void UsdMaya_ExportDirtyTracker::Track(
+    const std::string&                       fileName,
+    const std::string&                       argsDescription,
+    const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdPathMap)
+{
+    _RegisterSceneCallbacks();
+
+    std::unique_ptr<_TrackedFile> trackedFile(new _TrackedFile);
+    trackedFile->argsDescription = argsDescription;
+    trackedFile->dagPathToUsdPathMap = dagPathToUsdPathMap;
+
+    // Added, deleted and reparented DAG nodes are all reported as DAG changes.
+    trackedFile->callbackIds.append(
+        MDagMessage::addAllDagChangesCallback(_SetDagChanged, trackedFile.get()));
+
+    for (const auto& entry : dagPathToUsdPathMap) {
+        MObject    node = entry.first.node();
+        const auto inserted = trackedFile->dirtyNodes.emplace(MObjectHandle(node), false);
+        if (!inserted.second) {
+            continue;
+        }
+
+        // Attribute edits without dependents don't dirty the node.
+        bool* dirtyFlag = &inserted.first->second;
+        trackedFile->callbackIds.append(
+            MNodeMessage::addNodeDirtyCallback(node, _SetNodeDirty, dirtyFlag));
+        trackedFile->callbackIds.append(
+            MNodeMessage::addAttributeChangedCallback(node, _SetAttributeDirty, dirtyFlag));
+        trackedFile->callbackIds.append(
+            MNodeMessage::addNameChangedCallback(node, _SetNodeRenamed, trackedFile.get()));
+    }
+
+    _trackedFiles[_GetFileKey(fileName)] = std::move(trackedFile);
+}
+
+/* static */
+void UsdMaya_ExportDirtyTracker::Forget(const std::string& fileName)
+{
+    _trackedFiles.erase(_GetFileKey(fileName));
+}
+
+/* static */
+void UsdMaya_ExportDirtyTracker::ForgetAll()
+{
+    _trackedFiles.clear();
+    MMessage::removeCallbacks(_sceneCallbackIds);
+    _sceneCallbackIds.clear();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
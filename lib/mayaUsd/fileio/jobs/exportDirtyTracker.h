@@ -0,0 +1,78 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_EXPORT_DIRTY_TRACKER_H
+#define PXRUSDMAYA_EXPORT_DIRTY_TRACKER_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// This class records, for each file written by an incremental export, the
+/// DAG-to-USD path mapping of that export and which of the exported Maya
+/// nodes were dirtied since, through Maya node messages. The next incremental
+/// export of the same file with the same arguments then only re-authors the
+/// prims of the changed nodes into the existing layer.
+///
+/// Structural changes of the DAG (added, removed, renamed or reparented DAG
+/// nodes) can change the USD paths of unchanged nodes, so they invalidate the
+/// record and the next export is a full one.
+class UsdMaya_ExportDirtyTracker
+{
+public:
+    /// Changes of the Maya nodes exported to a file since its last export.
+    struct Changes
+    {
+        /// USD paths of the prims written from dirtied Maya nodes.
+        SdfPathSet dirtyPrimPaths;
+
+        /// DAG paths whose prims don't need to be written again.
+        UsdMayaUtil::MDagPathSet cleanDagPaths;
+    };
+
+    /// Returns true and fills \p changes if \p fileName was last written by
+    /// an incremental export with the same \p argsDescription, and the DAG
+    /// did not change structurally since.
+    MAYAUSD_CORE_PUBLIC
+    static bool
+    GetChanges(const std::string& fileName, const std::string& argsDescription, Changes* changes);
+
+    /// Records the paths written by the export of \p fileName and starts
+    /// tracking the changes of their Maya nodes.
+    MAYAUSD_CORE_PUBLIC
+    static void Track(
+        const std::string&                       fileName,
+        const std::string&                       argsDescription,
+        const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdPathMap);
+
+    /// Stops tracking \p fileName, its next export is a full one.
+    MAYAUSD_CORE_PUBLIC
+    static void Forget(const std::string& fileName);
+
+    /// Stops tracking all the files and removes the Maya callbacks. Must be
+    /// called before the plugin is unloaded.
+    MAYAUSD_CORE_PUBLIC
+    static void ForgetAll();
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
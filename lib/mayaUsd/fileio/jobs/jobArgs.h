@@ -72,6 +72,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (exportDisplayColor) \
     (exportDistanceUnit) \
     (exportInstances) \
+    (instanceDuplicateMeshes) \
     (exportMaterialCollections) \
     (referenceObjectMode) \
     (exportRefsAsInstanceable) \
@@ -85,6 +86,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (file) \
     (filterTypes) \
     (ignoreWarnings) \
+    (incrementalExport) \
     (kind) \
     (disableModelKindProcessor) \
     (materialCollectionsPath) \
@@ -105,6 +107,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (stripNamespaces) \
     (verbose) \
     (staticSingleSample) \
+    (valueClipFrames) \
     (geomSidedness)   \
     (worldspace) \
     /* Special "none" token */ \
@@ -181,6 +184,9 @@ struct UsdMayaJobExportArgs
     const bool        exportDisplayColor;
     const bool        exportDistanceUnit;
     const bool        exportInstances;
+    /// Whether the static meshes with identical data are exported as
+    /// instances of a single mesh.
+    const bool        instanceDuplicateMeshes;
     const bool        exportMaterialCollections;
     const bool        exportMeshUVs;
     const bool        exportNurbsExplicitUV;
@@ -193,6 +199,9 @@ struct UsdMayaJobExportArgs
     const bool        exportComponentTags;
     const std::string file;
     const bool        ignoreWarnings;
+    /// Whether the export only re-authors, in the layer of the previous
+    /// export of the same file, the prims of the Maya nodes changed since.
+    const bool        incrementalExport;
 
     /// If this is not empty, then a set of collections are exported on the
     /// prim pointed to by the path, each representing the collection of
@@ -224,6 +233,9 @@ struct UsdMayaJobExportArgs
     const bool         verbose;
     const bool         staticSingleSample;
     const TfToken      geomSidedness;
+    /// Number of frames of animated data written to each value clip layer.
+    /// Zero writes the animated data to the exported layer itself.
+    const double       valueClipFrames;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
 
@@ -18,16 +18,20 @@
 #include <mayaUsd/fileio/chaser/importChaserRegistry.h>
 #include <mayaUsd/fileio/primReaderRegistry.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
+#include <mayaUsd/fileio/translators/translatorMayaReference.h>
 #include <mayaUsd/fileio/translators/translatorXformable.h>
 #include <mayaUsd/fileio/utils/readUtil.h>
+#include <mayaUsd/fileio/utils/shadingUtil.h>
 #include <mayaUsd/nodes/stageNode.h>
 #include <mayaUsd/undo/OpUndoItemMuting.h>
+#include <mayaUsd/utils/profilingScope.h>
 #include <mayaUsd/utils/progressBarScope.h>
 #include <mayaUsd/utils/stageCache.h>
 #include <mayaUsd/utils/util.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 
 #include <pxr/base/tf/debug.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/fileFormat.h>
 #include <pxr/usd/sdf/layer.h>
@@ -62,6 +66,7 @@
 #include <ghc/filesystem.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -71,6 +76,30 @@ using namespace MAYAUSD_NS_DEF;
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_IMPORT_PARALLEL_PREFETCH,
+    false,
+    "Resolve the points, topology and xform ops of the imported prims from worker threads before "
+    "creating the Maya nodes serially.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_IMPORT_SHARED_DAG_MODIFIER,
+    false,
+    "Create the Maya nodes of the import through a single DAG modifier instead of one modifier per "
+    "node.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_IMPORT_PROFILE_READERS,
+    false,
+    "Record the time spent in each type of prim reader, shader reader and import chaser, and "
+    "report it as status messages at the end of the import.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_IMPORT_PROFILE_FILE,
+    "",
+    "JSON file the import profile is also written to when MAYAUSD_IMPORT_PROFILE_READERS is "
+    "enabled.");
+
 namespace {
 // Simple RAII class to ensure tracking does not extend past the scope.
 struct TempNodeTrackerScope
@@ -197,6 +226,9 @@ UsdMaya_ReadJob::~UsdMaya_ReadJob() { }
 
 bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::fileIOCategory, MProfiler::kColorE_L1, "Read USD file");
+
     // When we are called from PrimUpdaterManager we should already have
     // a computation scope. If we are called from elsewhere don't show any
     // progress bar here.
@@ -212,6 +244,12 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
         return false;
     }
 
+    mProfiler.Clear();
+    mProfileReaders = TfGetEnvSetting(MAYAUSD_IMPORT_PROFILE_READERS);
+
+    // In case a previous import failed before clearing them.
+    UsdMayaShadingUtil::ClearImportCaches();
+
     SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(mImportData.filename());
     if (!rootLayer) {
         return false;
@@ -460,6 +498,8 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
     progressBar.advance();
 
     for (const UsdMayaImportChaserRefPtr& chaser : this->mImportChasers) {
+        UsdMayaPrimReaderProfiler::Scope profilerScope(
+            _GetProfiler(), UsdMayaPrimReaderProfiler::Category::ImportChaser, typeid(*chaser));
         bool bStat
             = chaser->PostImport(predicate, stage, currentAddedDagPaths, fromSdfPaths, this->mArgs);
         if (!bStat) {
@@ -470,6 +510,11 @@ bool UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
     progressBar.advance();
 
     UsdMayaReadUtil::mapFileHashes.clear();
+    UsdMayaShadingUtil::ClearImportCaches();
+
+    if (mProfileReaders) {
+        mProfiler.Report(TfGetEnvSetting(MAYAUSD_IMPORT_PROFILE_FILE));
+    }
 
     return (status == MS::kSuccess);
 }
@@ -496,6 +541,7 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
     _PrimReaderMap&           primReaderMap)
 {
     const UsdPrim& prim = *primIt;
+    readCtx.SetProfiler(_GetProfiler());
     // The iterator will hit each prim twice. IsPostVisit tells us if
     // this is the pre-visit (Read) step or post-visit (PostReadSubtree)
     // step.
@@ -504,6 +550,10 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
         // specified one.
         auto primReaderIt = primReaderMap.find(prim.GetPath());
         if (primReaderIt != primReaderMap.end()) {
+            UsdMayaPrimReaderProfiler::Scope profilerScope(
+                _GetProfiler(),
+                UsdMayaPrimReaderProfiler::Category::PrimReader,
+                typeid(*primReaderIt->second));
             primReaderIt->second->PostReadSubtree(readCtx);
         }
     } else {
@@ -519,7 +569,13 @@ void UsdMaya_ReadJob::_DoImportPrimIt(
             UsdMayaPrimReaderSharedPtr primReader = factoryFn(args);
             if (primReader) {
                 TempNodeTrackerScope scope(readCtx);
-                primReader->Read(readCtx);
+                {
+                    UsdMayaPrimReaderProfiler::Scope profilerScope(
+                        _GetProfiler(),
+                        UsdMayaPrimReaderProfiler::Category::PrimReader,
+                        typeid(*primReader));
+                    primReader->Read(readCtx);
+                }
                 if (primReader->HasPostReadSubtree()) {
                     primReaderMap[prim.GetPath()] = primReader;
                 }
@@ -612,10 +668,24 @@ void UsdMaya_ReadJob::_ImportPrototype(
 
 bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootPrim)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::fileIOCategory, MProfiler::kColorE_L2, "Import prims");
+
     const bool buildInstances = mArgs.importInstances;
+    const bool prefetchValues = TfGetEnvSetting(MAYAUSD_IMPORT_PARALLEL_PREFETCH);
+
+    // The nodes are deleted and re-created by Undo() and Redo() from the
+    // registry, the shared modifier is only used to create them.
+    std::unique_ptr<MDagModifier> dagModifier;
+    if (TfGetEnvSetting(MAYAUSD_IMPORT_SHARED_DAG_MODIFIER)) {
+        dagModifier.reset(new MDagModifier);
+    }
 
     MayaUsd::ProgressBarScope progressBar(0);
 
+    // The Maya references are loaded together once all the prims are read.
+    UsdMayaTranslatorMayaReference::BatchLoadScope mayaReferenceBatch;
+
     // We want both pre- and post- visit iterations over the prims in this
     // method. To do so, iterate over all the root prims of the input range,
     // and create new PrimRanges to iterate over their subtrees.
@@ -629,12 +699,21 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             : UsdPrimRange::PreAndPostVisit(
                 rootPrim, UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate));
 
+        // The readers then only read the stage for the values not prefetched.
+        if (prefetchValues) {
+            mValueCache.Prefetch(range);
+        }
+
         const int                     loopSize = std::distance(range.begin(), range.end());
         MayaUsd::ProgressBarLoopScope instanceLoop(loopSize);
         for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
             const UsdPrim&           prim = *primIt;
             UsdMayaPrimReaderContext readCtx(&mNewNodeRegistry);
             readCtx.SetTimeSampleMultiplier(mTimeSampleMultiplier);
+            if (prefetchValues) {
+                readCtx.SetValueCache(&mValueCache);
+            }
+            readCtx.SetDagModifier(dagModifier.get());
 
             if (buildInstances && prim.IsInstance()) {
                 _DoImportInstanceIt(primIt, usdRootPrim, readCtx, primReaderMap);
@@ -643,6 +722,8 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             }
             instanceLoop.loopAdvance();
         }
+
+        mValueCache.Clear();
     }
 
     if (buildInstances) {
@@ -773,6 +854,11 @@ const UsdMayaPrimReaderContext::ObjectRegistry& UsdMaya_ReadJob::GetNewNodeRegis
     return mNewNodeRegistry;
 }
 
+UsdMayaPrimReaderProfiler* UsdMaya_ReadJob::_GetProfiler()
+{
+    return mProfileReaders ? &mProfiler : nullptr;
+}
+
 double UsdMaya_ReadJob::_setTimeSampleMultiplierFrom(const double layerFPS)
 {
     double sceneFPS = UsdMayaUtil::GetSceneMTimeUnitAsDouble();
@@ -21,6 +21,8 @@
 #include <mayaUsd/fileio/jobs/jobArgs.h>
 #include <mayaUsd/fileio/primReader.h>
 #include <mayaUsd/fileio/primReaderContext.h>
+#include <mayaUsd/fileio/primReaderProfiler.h>
+#include <mayaUsd/fileio/primReaderValueCache.h>
 
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/prim.h>
@@ -131,11 +133,23 @@ private:
 
     double _setTimeSampleMultiplierFrom(const double layerFPS);
 
+    // Returns the profiler of the readers, or nullptr if the import is not profiled.
+    UsdMayaPrimReaderProfiler* _GetProfiler();
+
     // Data
     MDagModifier mDagModifierUndo;
     bool         mDagModifierSeeded;
     double       mTimeSampleMultiplier;
 
+    /// Values of the prims being imported, prefetched when
+    /// MAYAUSD_IMPORT_PARALLEL_PREFETCH is enabled.
+    UsdMayaPrimReaderValueCache mValueCache;
+
+    /// Timings of the readers and chasers, only recorded when
+    /// MAYAUSD_IMPORT_PROFILE_READERS is enabled.
+    bool                      mProfileReaders = false;
+    UsdMayaPrimReaderProfiler mProfiler;
+
     /// Cache of import chasers that were run. Currently used to aid in redo/undo operations
     /// This cache is cleared for every new Read() operation.
     UsdMayaImportChaserRefPtrVector mImportChasers;
@@ -15,20 +15,28 @@
 //
 #include "writeJob.h"
 
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/hashset.h>
 #include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stl.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/kind/registry.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/propertySpec.h>
 
 #include <maya/MAnimControl.h>
 #include <maya/MComputation.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDistance.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnRenderLayer.h>
@@ -37,16 +45,23 @@
 #include <maya/MObjectArray.h>
 #include <maya/MPxNode.h>
 #include <maya/MStatus.h>
+#include <maya/MTime.h>
 #include <maya/MUuid.h>
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <set>
+#include <sstream>
 #include <unordered_set>
 // Needed for directly removing a UsdVariant via Sdf
 //   Remove when UsdVariantSet::RemoveVariant() is exposed
 //   XXX [bug 75864]
 #include <mayaUsd/fileio/chaser/exportChaser.h>
 #include <mayaUsd/fileio/chaser/exportChaserRegistry.h>
+#include <mayaUsd/fileio/jobs/exportDirtyTracker.h>
 #include <mayaUsd/fileio/jobs/jobArgs.h>
 #include <mayaUsd/fileio/jobs/modelKindProcessor.h>
 #include <mayaUsd/fileio/primWriter.h>
@@ -54,14 +69,18 @@
 #include <mayaUsd/fileio/shading/shadingModeExporterContext.h>
 #include <mayaUsd/fileio/transformWriter.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
+#include <mayaUsd/utils/profilingScope.h>
 #include <mayaUsd/utils/progressBarScope.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/variantSetSpec.h>
 #include <pxr/usd/sdf/variantSpec.h>
+#include <pxr/usd/usd/clipsAPI.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/usdFileFormat.h>
 #include <pxr/usd/usd/usdcFileFormat.h>
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/metrics.h>
@@ -71,6 +90,41 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_EXPORT_PARALLEL_FRAME_READS,
+    false,
+    "Read the Maya data of the animated prims from worker threads once each frame is evaluated, "
+    "before authoring the time samples serially.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_EXPORT_CONTEXT_SAMPLING,
+    false,
+    "Evaluate the time samples of the export in a DG context instead of changing the current time "
+    "of the scene, so only the exported nodes are evaluated.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_EXPORT_FLUSH_INTERVAL,
+    0,
+    "Number of time samples after which the exported crate file is saved during animated exports, "
+    "so the written time samples are no longer held in memory. Zero disables the flushes.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_EXPORT_PROFILE_WRITERS,
+    false,
+    "Record the time spent in each type of prim writer and export chaser, at the default time and "
+    "at the time samples, and report it in the custom layer data of the exported layer.");
+
+// clang-format off
+TF_DEFINE_PRIVATE_TOKENS(
+    _writerTimingTokens,
+    (mayaUsdExportWriterTimings)
+    (defaultTimeSeconds)
+    (defaultTimeCalls)
+    (timeSamplesSeconds)
+    (timeSamplesCalls)
+);
+// clang-format on
+
 UsdMaya_WriteJob::UsdMaya_WriteJob(const UsdMayaJobExportArgs& iArgs)
     : mJobCtx(iArgs)
     , _modelKindProcessor(new UsdMaya_ModelKindProcessor(iArgs))
@@ -79,6 +133,77 @@ UsdMaya_WriteJob::UsdMaya_WriteJob(const UsdMayaJobExportArgs& iArgs)
 
 UsdMaya_WriteJob::~UsdMaya_WriteJob() { }
 
+UsdMaya_WriteJob::_WriterTimingScope::_WriterTimingScope(
+    UsdMaya_WriteJob&     job,
+    const std::type_info& writerType,
+    bool                  isDefault)
+    : _timing(nullptr)
+{
+    if (job._profileWriters) {
+        auto& timings = job._writerTimings[std::type_index(writerType)];
+        _timing = isDefault ? &timings.first : &timings.second;
+        _stopwatch.Start();
+    }
+}
+
+UsdMaya_WriteJob::_WriterTimingScope::~_WriterTimingScope()
+{
+    if (_timing) {
+        _stopwatch.Stop();
+        _timing->seconds += _stopwatch.GetSeconds();
+        ++_timing->calls;
+    }
+}
+
+void UsdMaya_WriteJob::_ReportWriterTimings()
+{
+    if (!_profileWriters || _writerTimings.empty()) {
+        return;
+    }
+
+    // The slowest writer types are reported first.
+    using _TypeTimings = std::pair<std::string, std::pair<_WriterTiming, _WriterTiming>>;
+    std::vector<_TypeTimings> typeTimings;
+    for (const auto& entry : _writerTimings) {
+        // Strip the namespaces, the USD one makes the report hard to read.
+        const std::string typeName = TfStringGetSuffix(ArchGetDemangled(entry.first.name()), ':');
+        typeTimings.emplace_back(typeName, entry.second);
+    }
+    std::sort(
+        typeTimings.begin(),
+        typeTimings.end(),
+        [](const _TypeTimings& lhs, const _TypeTimings& rhs) {
+            return lhs.second.first.seconds + lhs.second.second.seconds
+                > rhs.second.first.seconds + rhs.second.second.seconds;
+        });
+
+    VtDictionary timingsDict;
+    for (const _TypeTimings& entry : typeTimings) {
+        const _WriterTiming& defaultTiming = entry.second.first;
+        const _WriterTiming& samplesTiming = entry.second.second;
+
+        VtDictionary typeDict;
+        typeDict[_writerTimingTokens->defaultTimeSeconds] = VtValue(defaultTiming.seconds);
+        typeDict[_writerTimingTokens->defaultTimeCalls] = VtValue(int(defaultTiming.calls));
+        typeDict[_writerTimingTokens->timeSamplesSeconds] = VtValue(samplesTiming.seconds);
+        typeDict[_writerTimingTokens->timeSamplesCalls] = VtValue(int(samplesTiming.calls));
+        timingsDict[entry.first] = VtValue(typeDict);
+
+        TF_STATUS(
+            "%s: %.3f s at the default time (%zu calls), %.3f s at the time samples (%zu calls)",
+            entry.first.c_str(),
+            defaultTiming.seconds,
+            defaultTiming.calls,
+            samplesTiming.seconds,
+            samplesTiming.calls);
+    }
+
+    const SdfLayerHandle rootLayer = mJobCtx.mStage->GetRootLayer();
+    VtDictionary         customLayerData = rootLayer->GetCustomLayerData();
+    customLayerData[_writerTimingTokens->mayaUsdExportWriterTimings] = VtValue(timingsDict);
+    rootLayer->SetCustomLayerData(customLayerData);
+}
+
 SdfPath UsdMaya_WriteJob::MapDagPathToSdfPath(const MDagPath& dagPath) const
 {
     SdfPath usdPrimPath;
@@ -87,6 +212,33 @@ SdfPath UsdMaya_WriteJob::MapDagPathToSdfPath(const MDagPath& dagPath) const
     return usdPrimPath;
 }
 
+/// Returns the description of the export arguments compared by the
+/// incremental exports. Unlike the arguments output, it lists the time samples.
+static std::string _GetArgsDescription(const UsdMayaJobExportArgs& args)
+{
+    std::ostringstream description;
+    description << args;
+    for (double t : args.timeSamples) {
+        description << ' ' << t;
+    }
+    return description.str();
+}
+
+/// Removes the properties authored on the prim at \p path in \p layer.
+static void _ClearPrimProperties(const SdfLayerHandle& layer, const SdfPath& path)
+{
+    const SdfPrimSpecHandle primSpec = layer->GetPrimAtPath(path);
+    if (!primSpec) {
+        return;
+    }
+
+    const SdfPrimSpec::PropertySpecView      properties = primSpec->GetProperties();
+    const std::vector<SdfPropertySpecHandle> propertySpecs(properties.begin(), properties.end());
+    for (const SdfPropertySpecHandle& propertySpec : propertySpecs) {
+        primSpec->RemoveProperty(propertySpec);
+    }
+}
+
 /// Generates a name for a temporary usdc file in \p dir.
 /// Unless you are very, very unlucky, the stage name is unique because it's
 /// generated from a UUID.
@@ -112,8 +264,57 @@ static TfToken _GetFallbackExtension(const TfToken& compatibilityMode)
     return UsdMayaTranslatorTokens->UsdFileExtensionDefault;
 }
 
+/// Returns true if the layer is saved as a crate file. Once saved, the time
+/// samples of crate layers are read back from the file on demand instead of
+/// being held in memory.
+static bool _IsCrateLayer(const SdfLayerHandle& layer)
+{
+    const TfToken& formatId = layer->GetFileFormat()->GetFormatId();
+    if (formatId == UsdUsdFileFormatTokens->Id) {
+        return UsdUsdFileFormat::GetUnderlyingFormatForLayer(*layer)
+            == UsdUsdcFileFormatTokens->Id;
+    }
+    return formatId == UsdUsdcFileFormatTokens->Id;
+}
+
+/// Evaluates the Maya scene at the time sample \p t and calls \p writeFn.
+/// With \p contextSampling, only the plugs read by the prim writers are
+/// evaluated, in a DG context, instead of changing the current time.
+template <typename WriteFn>
+static bool _WriteAtTimeSample(double t, bool contextSampling, const WriteFn& writeFn)
+{
+    if (contextSampling) {
+        MDGContext      context(MTime(t, MTime::uiUnit()));
+        MDGContextGuard contextGuard(context);
+        return writeFn();
+    }
+
+    MGlobal::viewFrame(t);
+    return writeFn();
+}
+
+/// Reads the Maya data of the frame at \p usdTime for all \p primWriters
+/// from worker threads. The DG can't be evaluated from worker threads, so the
+/// data they read is evaluated serially first.
+template <typename PrimWriters>
+static void _PrefetchFrame(const PrimWriters& primWriters, const UsdTimeCode& usdTime)
+{
+    for (const auto& primWriter : primWriters) {
+        primWriter->EvaluateFrame(usdTime);
+    }
+
+    WorkParallelForN(primWriters.size(), [&primWriters, &usdTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            primWriters[i]->PrefetchFrame(usdTime);
+        }
+    });
+}
+
 bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::fileIOCategory, MProfiler::kColorE_L1, "Write USD file");
+
     const std::vector<double>& timeSamples = mJobCtx.mArgs.timeSamples;
 
     // Non-animated export doesn't show progress.
@@ -131,16 +332,16 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
     // Time-sampled export.
     if (!timeSamples.empty()) {
         const MTime oldCurTime = MAnimControl::currentTime();
+        const bool  contextSampling = TfGetEnvSetting(MAYAUSD_EXPORT_CONTEXT_SAMPLING);
+
+        _BeginTimeSamples();
 
         for (double t : timeSamples) {
-            if (mJobCtx.mArgs.verbose) {
-                TF_STATUS("%f", t);
-            }
-            MGlobal::viewFrame(t);
             progressBar.advance();
 
-            // Process per frame data.
-            if (!_WriteFrame(t)) {
+            const bool frameWritten = _WriteAtTimeSample(
+                t, contextSampling, [this, t]() { return _WriteTimeSample(t, true); });
+            if (!frameWritten) {
                 MGlobal::viewFrame(oldCurTime);
                 return false;
             }
@@ -153,6 +354,10 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 
         // Set the time back.
         MGlobal::viewFrame(oldCurTime);
+
+        if (!_EndTimeSamples()) {
+            return false;
+        }
     }
 
     // Finalize the export, close the stage.
@@ -163,10 +368,210 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
     return true;
 }
 
+/* static */
+bool UsdMaya_WriteJob::WriteTargets(
+    const std::vector<UsdMaya_WriteJob*>& jobs,
+    const std::vector<std::string>&       fileNames)
+{
+    if (!TF_VERIFY(jobs.size() == fileNames.size())) {
+        return false;
+    }
+
+    // Each time sample of any of the targets is evaluated once.
+    std::set<double> timeSamples;
+    for (const UsdMaya_WriteJob* job : jobs) {
+        const std::vector<double>& jobTimeSamples = job->mJobCtx.mArgs.timeSamples;
+        timeSamples.insert(jobTimeSamples.begin(), jobTimeSamples.end());
+    }
+
+    const bool                showProgress = !timeSamples.empty();
+    const int                 nbSteps = 2 * jobs.size() + timeSamples.size();
+    MayaUsd::ProgressBarScope progressBar(showProgress, true /*interruptible */, nbSteps, "");
+
+    // Default-time export of each target, with its own stage and prim writers.
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        if (!jobs[i]->_BeginWriting(fileNames[i], false)) {
+            return false;
+        }
+        progressBar.advance();
+    }
+
+    // Time-sampled export.
+    if (!timeSamples.empty()) {
+        const MTime oldCurTime = MAnimControl::currentTime();
+        const bool  contextSampling = TfGetEnvSetting(MAYAUSD_EXPORT_CONTEXT_SAMPLING);
+
+        std::vector<UsdMaya_WriteJob*> animatedJobs;
+        for (UsdMaya_WriteJob* job : jobs) {
+            if (!job->mJobCtx.mArgs.timeSamples.empty()) {
+                job->_BeginTimeSamples();
+                animatedJobs.push_back(job);
+            }
+        }
+
+        std::vector<UsdMaya_WriteJob*>  frameJobs;
+        std::vector<UsdMayaPrimWriter*> framePrimWriters;
+
+        const auto writeTargetsFrame = [&frameJobs, &framePrimWriters](double t) {
+            // The Maya data of the animated prims of all the targets is read
+            // in a single parallel loop, before authoring each target.
+            const UsdTimeCode usdTime(t);
+            if (TfGetEnvSetting(MAYAUSD_EXPORT_PARALLEL_FRAME_READS)
+                && MDGContext::current().isNormal()) {
+                framePrimWriters.clear();
+                for (const UsdMaya_WriteJob* job : frameJobs) {
+                    for (const UsdMayaPrimWriterSharedPtr& primWriter :
+                         job->mAnimatedPrimWriterList) {
+                        framePrimWriters.push_back(primWriter.get());
+                    }
+                }
+                _PrefetchFrame(framePrimWriters, usdTime);
+            }
+
+            for (UsdMaya_WriteJob* job : frameJobs) {
+                if (!job->_WriteTimeSample(t, false)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        for (double t : timeSamples) {
+            progressBar.advance();
+
+            // The targets can be exported over different frame ranges.
+            frameJobs.clear();
+            for (UsdMaya_WriteJob* job : animatedJobs) {
+                const std::vector<double>& jobTimeSamples = job->mJobCtx.mArgs.timeSamples;
+                if (std::binary_search(jobTimeSamples.begin(), jobTimeSamples.end(), t)) {
+                    frameJobs.push_back(job);
+                }
+            }
+
+            const bool frameWritten = _WriteAtTimeSample(
+                t, contextSampling, [&writeTargetsFrame, t]() { return writeTargetsFrame(t); });
+            if (!frameWritten) {
+                MGlobal::viewFrame(oldCurTime);
+                return false;
+            }
+
+            // Allow user cancellation.
+            if (progressBar.isInterruptRequested()) {
+                break;
+            }
+        }
+
+        // Set the time back.
+        MGlobal::viewFrame(oldCurTime);
+
+        for (UsdMaya_WriteJob* job : animatedJobs) {
+            if (!job->_EndTimeSamples()) {
+                return false;
+            }
+        }
+    }
+
+    // Finalize each target, close its stage.
+    for (UsdMaya_WriteJob* job : jobs) {
+        if (!job->_FinishWriting()) {
+            return false;
+        }
+        progressBar.advance();
+    }
+    return true;
+}
+
+void UsdMaya_WriteJob::_BeginTimeSamples()
+{
+    // The prim writers of static prims are not called at the time samples.
+    mAnimatedPrimWriterList.clear();
+    mBatchedPrimWriterList.clear();
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+        if (!primWriter->GetUsdPrim()
+            || !(primWriter->IsAnimated() || primWriter->IsVisibilityAnimated())
+            || _IsCleanForIncrementalExport(*primWriter)) {
+            continue;
+        }
+
+        UsdMayaPrimWriterBatchSharedPtr batch = primWriter->GetFrameBatch();
+        if (!batch) {
+            mAnimatedPrimWriterList.push_back(primWriter);
+            continue;
+        }
+
+        // There are only a few batches, one per Python prim writer class at most.
+        auto batchIt = std::find_if(
+            mBatchedPrimWriterList.begin(),
+            mBatchedPrimWriterList.end(),
+            [&batch](const auto& batched) { return batched.first == batch; });
+        if (batchIt == mBatchedPrimWriterList.end()) {
+            mBatchedPrimWriterList.emplace_back(batch, std::vector<UsdMayaPrimWriter*>());
+            batchIt = std::prev(mBatchedPrimWriterList.end());
+        }
+        batchIt->second.push_back(primWriter.get());
+    }
+
+    // The flushes only bound the memory of the crate layers saved to disk.
+    const SdfLayerHandle rootLayer = mJobCtx.mStage->GetRootLayer();
+    _flushInterval = TfGetEnvSetting(MAYAUSD_EXPORT_FLUSH_INTERVAL);
+    _flushSamples = _flushInterval > 0 && !rootLayer->IsAnonymous() && _IsCrateLayer(rootLayer)
+        && rootLayer->PermissionToSave();
+    _framesSinceFlush = 0;
+
+    // Value clips need the layers to be written next to the exported file.
+    const double clipFrames = mJobCtx.mArgs.valueClipFrames;
+    _valueClips = clipFrames > 0.0 && !rootLayer->IsAnonymous() && _packageName.empty();
+    if (clipFrames > 0.0 && !_valueClips) {
+        TF_WARN("Value clips can't be written for '%s', the animated data is written to the "
+                "exported layer.",
+                rootLayer->GetIdentifier().c_str());
+    }
+}
+
+bool UsdMaya_WriteJob::_WriteTimeSample(double t, bool prefetch)
+{
+    if (mJobCtx.mArgs.verbose) {
+        TF_STATUS("%f", t);
+    }
+
+    const double clipFrames = mJobCtx.mArgs.valueClipFrames;
+    if (_valueClips && (!_clipLayer || t >= _clipStartTimes.back() + clipFrames)) {
+        if (!_BeginValueClip(t)) {
+            return false;
+        }
+    }
+
+    // Process per frame data.
+    if (!_WriteFrame(t, prefetch)) {
+        return false;
+    }
+
+    if (_flushSamples && ++_framesSinceFlush >= _flushInterval) {
+        mJobCtx.mStage->GetRootLayer()->Save();
+        _framesSinceFlush = 0;
+    }
+    return true;
+}
+
+bool UsdMaya_WriteJob::_EndTimeSamples()
+{
+    if (!_EndValueClip()) {
+        return false;
+    }
+    _WriteValueClips();
+    return true;
+}
+
 bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::fileIOCategory, MProfiler::kColorE_L2, "Begin writing");
+
     MayaUsd::ProgressBarScope progressBar(8);
 
+    _profileWriters = TfGetEnvSetting(MAYAUSD_EXPORT_PROFILE_WRITERS);
+    _writerTimings.clear();
+
     // Check for DAG nodes that are a child of an already specified DAG node to export
     // if that's the case, report the issue and skip the export
     UsdMayaUtil::MDagPathSet::const_iterator m, n;
@@ -247,11 +652,37 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         }
     }
 
-    if (!mJobCtx._OpenFile(_fileName, append)) {
+    // Incremental exports write the changed prims over the layer of the
+    // previous export of the file. The record of that export is dropped until
+    // this one succeeds.
+    _argsDescription = _GetArgsDescription(mJobCtx.mArgs);
+    _incremental = mJobCtx.mArgs.incrementalExport && !append && _packageName.empty()
+        && mJobCtx.mArgs.valueClipFrames <= 0.0 && mRenderLayerObjs.length() <= 1
+        && TfIsFile(_fileName)
+        && UsdMaya_ExportDirtyTracker::GetChanges(
+            _fileName, _argsDescription, &_incrementalChanges);
+    UsdMaya_ExportDirtyTracker::Forget(_fileName);
+    if (_incremental) {
+        TF_STATUS(
+            "Re-authoring %zu changed prim(s) of '%s'",
+            _incrementalChanges.dirtyPrimPaths.size(),
+            _fileName.c_str());
+    }
+
+    if (!mJobCtx._OpenFile(_fileName, append || _incremental)) {
         return false;
     }
     progressBar.advance();
 
+    // The properties of the changed prims are written again from scratch, so
+    // the ones their writers no longer author don't linger.
+    if (_incremental) {
+        const SdfLayerHandle rootLayer = mJobCtx.mStage->GetRootLayer();
+        for (const SdfPath& primPath : _incrementalChanges.dirtyPrimPaths) {
+            _ClearPrimProperties(rootLayer, primPath);
+        }
+    }
+
     // Set time range for the USD file if we're exporting animation.
     if (!mJobCtx.mArgs.timeSamples.empty()) {
         mJobCtx.mStage->SetStartTimeCode(mJobCtx.mArgs.timeSamples.front());
@@ -339,6 +770,10 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     }
     progressBar.advance();
 
+    // Find the static meshes with identical data before creating the prim
+    // writers, so they are all written as instances of the first one.
+    mJobCtx._FindDuplicateMeshes();
+
     // We are entering a loop here, so count the number of dag objects
     // so we can have a better progress bar status.
     // Note: Maya does the same thing during its write.
@@ -389,7 +824,10 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
                         return false;
                     }
 
-                    primWriter->Write(UsdTimeCode::Default());
+                    if (!_IsCleanForIncrementalExport(*primWriter)) {
+                        const _WriterTimingScope timingScope(*this, typeid(*primWriter), true);
+                        primWriter->Write(UsdTimeCode::Default());
+                    }
 
                     const UsdMayaUtil::MDagPathMap<SdfPath>& mapping
                         = primWriter->GetDagToUsdPathMapping();
@@ -449,40 +887,240 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
     }
 
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
-    for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
-        if (!chaser->ExportDefault()) {
-            return false;
-        }
-        chasersLoop.loopAdvance();
+    return _RunChasers(
+        [this](UsdMayaExportChaser& chaser) {
+            const _WriterTimingScope timingScope(*this, typeid(chaser), true);
+            return chaser.ExportDefault();
+        },
+        [&chasersLoop]() { chasersLoop.loopAdvance(); });
+}
+
+bool UsdMaya_WriteJob::_IsCleanForIncrementalExport(const UsdMayaPrimWriter& primWriter) const
+{
+    return _incremental && _incrementalChanges.cleanDagPaths.count(primWriter.GetDagPath()) > 0;
+}
+
+bool UsdMaya_WriteJob::_WriteFrame(double iFrame, bool prefetch)
+{
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::fileIOCategory, MProfiler::kColorE_L2, "Write frame");
+
+    const UsdTimeCode usdTime(iFrame);
+
+    // The evaluation context of the context sampling is the one of the main thread, so the Maya
+    // data is not read from worker threads then.
+    if (prefetch && TfGetEnvSetting(MAYAUSD_EXPORT_PARALLEL_FRAME_READS)
+        && MDGContext::current().isNormal()) {
+        _PrefetchFrame(mAnimatedPrimWriterList, usdTime);
+    }
+
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mAnimatedPrimWriterList) {
+        const _WriterTimingScope timingScope(*this, typeid(*primWriter), false);
+        primWriter->Write(usdTime);
+    }
+
+    for (const auto& batched : mBatchedPrimWriterList) {
+        const _WriterTimingScope timingScope(*this, typeid(*batched.first), false);
+        batched.first->Write(batched.second, usdTime);
+    }
+
+    const bool chasersSucceeded = _RunChasers([this, iFrame](UsdMayaExportChaser& chaser) {
+        const _WriterTimingScope timingScope(*this, typeid(chaser), false);
+        return chaser.ExportFrame(iFrame);
+    });
+    if (!chasersSucceeded) {
+        return false;
     }
 
+    _PerFrameCallback(iFrame);
+
     return true;
 }
 
-bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
+bool UsdMaya_WriteJob::_RunChasers(
+    const std::function<bool(UsdMayaExportChaser&)>& fn,
+    const std::function<void()>&                      advance)
 {
-    const UsdTimeCode usdTime(iFrame);
+    const size_t chaserCount = mChasers.size();
+    for (size_t begin = 0; begin < chaserCount;) {
+        // The writer timings are not thread-safe, so the chasers run serially when profiled.
+        size_t end = begin + 1;
+        if (!_profileWriters && mChasers[begin]->CanRunConcurrently()) {
+            while (end < chaserCount && mChasers[end]->CanRunConcurrently()) {
+                ++end;
+            }
+        }
 
-    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
-        const UsdPrim& usdPrim = primWriter->GetUsdPrim();
-        if (usdPrim) {
-            primWriter->Write(usdTime);
+        if (end - begin == 1) {
+            if (!fn(*mChasers[begin])) {
+                return false;
+            }
+        } else {
+            std::atomic<bool> succeeded(true);
+            WorkParallelForN(
+                end - begin,
+                [this, &fn, &succeeded, begin](size_t first, size_t last) {
+                    for (size_t i = first; i < last; ++i) {
+                        if (!fn(*mChasers[begin + i])) {
+                            succeeded = false;
+                        }
+                    }
+                },
+                1);
+            if (!succeeded) {
+                return false;
+            }
         }
+
+        if (advance) {
+            for (size_t i = begin; i < end; ++i) {
+                advance();
+            }
+        }
+        begin = end;
     }
+    return true;
+}
 
-    for (UsdMayaExportChaserRefPtr& chaser : mChasers) {
-        if (!chaser->ExportFrame(iFrame)) {
+bool UsdMaya_WriteJob::_BeginValueClip(double startTime)
+{
+    if (!_EndValueClip()) {
+        return false;
+    }
+
+    const std::string clipFileName = TfStringPrintf(
+        "%s.clip%04zu.%s",
+        TfStringGetBeforeSuffix(_fileName).c_str(),
+        _clipFileNames.size(),
+        TfGetExtension(_fileName).c_str());
+
+    // Same format as the exported layer.
+    SdfLayerRefPtr clipLayer = SdfLayer::Find(clipFileName);
+    if (clipLayer) {
+        clipLayer->Clear();
+    } else {
+        SdfLayer::FileFormatArguments args;
+        args[UsdUsdFileFormatTokens->FormatArg] = mJobCtx.mArgs.defaultUSDFormat.GetString();
+        clipLayer = SdfLayer::CreateNew(clipFileName, args);
+        if (!clipLayer) {
+            TF_RUNTIME_ERROR("Failed to create value clip layer '%s'", clipFileName.c_str());
             return false;
         }
     }
 
-    _PerFrameCallback(iFrame);
+    // The clip layer is inserted under the session layer for the time of the clip, the edit
+    // target must be in the layer stack of the stage.
+    mJobCtx.mStage->GetSessionLayer()->InsertSubLayerPath(clipLayer->GetIdentifier());
+    mJobCtx.mStage->SetEditTarget(UsdEditTarget(clipLayer));
+
+    // Values identical to the ones of the previous clip must still be written to this one.
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+        primWriter->ResetSparseValueWriter();
+    }
 
+    _clipLayer = clipLayer;
+    _clipFileNames.push_back(clipFileName);
+    _clipStartTimes.push_back(startTime);
     return true;
 }
 
+bool UsdMaya_WriteJob::_EndValueClip()
+{
+    if (!_clipLayer) {
+        return true;
+    }
+
+    mJobCtx.mStage->SetEditTarget(UsdEditTarget(mJobCtx.mStage->GetRootLayer()));
+
+    const SdfLayerHandle sessionLayer = mJobCtx.mStage->GetSessionLayer();
+    const size_t subLayerIndex = sessionLayer->GetSubLayerPaths().Find(_clipLayer->GetIdentifier());
+    if (subLayerIndex != size_t(-1)) {
+        sessionLayer->RemoveSubLayerPath(static_cast<int>(subLayerIndex));
+    }
+
+    // Releasing the layer once saved keeps only one clip in memory.
+    const bool saved = _clipLayer->Save();
+    if (!saved) {
+        TF_RUNTIME_ERROR(
+            "Failed to save value clip layer '%s'", _clipLayer->GetIdentifier().c_str());
+    }
+    _clipLayer = SdfLayerRefPtr();
+    return saved;
+}
+
+void UsdMaya_WriteJob::_WriteValueClips()
+{
+    if (_clipFileNames.empty()) {
+        return;
+    }
+
+    // The clips are written next to the exported layer, which holds the static data of the
+    // export and serves as the topology of the clips.
+    VtArray<SdfAssetPath> assetPaths;
+    VtVec2dArray          active;
+    for (size_t i = 0; i < _clipFileNames.size(); ++i) {
+        assetPaths.push_back(SdfAssetPath("./" + TfGetBaseName(_clipFileNames[i])));
+        active.push_back(GfVec2d(_clipStartTimes[i], static_cast<double>(i)));
+    }
+
+    const double       firstTime = mJobCtx.mArgs.timeSamples.front();
+    const double       lastTime = mJobCtx.mArgs.timeSamples.back();
+    const VtVec2dArray times { GfVec2d(firstTime, firstTime), GfVec2d(lastTime, lastTime) };
+
+#if PXR_VERSION >= 2102
+    SdfLayerRefPtrVector clipLayers;
+    SdfLayerHandleVector clipLayerHandles;
+    for (const std::string& clipFileName : _clipFileNames) {
+        if (SdfLayerRefPtr clipLayer = SdfLayer::FindOrOpen(clipFileName)) {
+            clipLayers.push_back(clipLayer);
+            clipLayerHandles.push_back(clipLayer);
+        }
+    }
+
+    const std::string manifestFileName = TfStringPrintf(
+        "%s.manifest.%s",
+        TfStringGetBeforeSuffix(_fileName).c_str(),
+        TfGetExtension(_fileName).c_str());
+    SdfLayer::FileFormatArguments args;
+    args[UsdUsdFileFormatTokens->FormatArg] = mJobCtx.mArgs.defaultUSDFormat.GetString();
+    SdfLayerRefPtr manifest = SdfLayer::FindOrOpen(manifestFileName);
+    if (manifest) {
+        manifest->Clear();
+    } else {
+        manifest = SdfLayer::CreateNew(manifestFileName, args);
+    }
+#endif
+
+    for (const UsdPrim& rootPrim : mJobCtx.mStage->GetPseudoRoot().GetChildren()) {
+        UsdClipsAPI clips(rootPrim);
+        clips.SetClipAssetPaths(assetPaths);
+        clips.SetClipPrimPath(rootPrim.GetPath().GetString());
+        clips.SetClipActive(active);
+        clips.SetClipTimes(times);
+
+#if PXR_VERSION >= 2102
+        // One manifest for all the root prims, their namespaces don't overlap.
+        const SdfLayerRefPtr primManifest
+            = UsdClipsAPI::GenerateClipManifestFromLayers(clipLayerHandles, rootPrim.GetPath());
+        if (manifest && primManifest && primManifest->GetPrimAtPath(rootPrim.GetPath())) {
+            SdfCopySpec(primManifest, rootPrim.GetPath(), manifest, rootPrim.GetPath());
+            clips.SetClipManifestAssetPath(SdfAssetPath("./" + TfGetBaseName(manifestFileName)));
+        }
+#endif
+    }
+
+#if PXR_VERSION >= 2102
+    if (manifest && !manifest->Save()) {
+        TF_RUNTIME_ERROR("Failed to save value clip manifest '%s'", manifestFileName.c_str());
+    }
+#endif
+}
+
 bool UsdMaya_WriteJob::_FinishWriting()
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::fileIOCategory, MProfiler::kColorE_L2, "Finish writing");
+
     MayaUsd::ProgressBarScope progressBar(6);
 
     UsdPrimSiblingRange usdRootPrims = mJobCtx.mStage->GetPseudoRoot().GetChildren();
@@ -563,16 +1201,18 @@ bool UsdMaya_WriteJob::_FinishWriting()
 
     // Run post export function on the chasers.
     MayaUsd::ProgressBarLoopScope chasersLoop(mChasers.size());
-    for (const UsdMayaExportChaserRefPtr& chaser : mChasers) {
-        if (!chaser->PostExport()) {
-            return false;
-        }
-        chasersLoop.loopAdvance();
+    const bool                    chasersSucceeded = _RunChasers(
+        [](UsdMayaExportChaser& chaser) { return chaser.PostExport(); },
+        [&chasersLoop]() { chasersLoop.loopAdvance(); });
+    if (!chasersSucceeded) {
+        return false;
     }
 
     _PostCallback();
     progressBar.advance();
 
+    _ReportWriterTimings();
+
     TF_STATUS("Saving stage");
     if (mJobCtx.mStage->GetRootLayer()->PermissionToSave()) {
         mJobCtx.mStage->GetRootLayer()->Save();
@@ -588,6 +1228,8 @@ bool UsdMaya_WriteJob::_FinishWriting()
 
     mJobCtx.mStage = UsdStageRefPtr();
     mJobCtx.mMayaPrimWriterList.clear(); // clear this so that no stage references are left around
+    mAnimatedPrimWriterList.clear();
+    mBatchedPrimWriterList.clear();
 
     // In the usdz case, the layer at _fileName was just a temp file, so
     // clean it up now. Do this after mJobCtx.mStage is reset to ensure
@@ -598,6 +1240,12 @@ bool UsdMaya_WriteJob::_FinishWriting()
     }
     progressBar.advance();
 
+    // The next incremental export of the file only re-authors the prims of the
+    // nodes changed from now on.
+    if (mJobCtx.mArgs.incrementalExport && _packageName.empty()) {
+        UsdMaya_ExportDirtyTracker::Track(_fileName, _argsDescription, mDagPathToUsdPathMap);
+    }
+
     return true;
 }
 
@@ -18,15 +18,25 @@
 
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/chaser/exportChaser.h>
+#include <mayaUsd/fileio/jobs/exportDirtyTracker.h>
+#include <mayaUsd/fileio/primWriter.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/stopwatch.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
 
 #include <maya/MObjectHandle.h>
 
+#include <functional>
+#include <map>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -49,6 +59,18 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool Write(const std::string& fileName, bool append);
 
+    /// Writes the Maya stage with each of the \p jobs to the file name of the
+    /// same index in \p fileNames, replacing any existing file. Each job has
+    /// its own stage and prim writers, but the Maya scene is evaluated once
+    /// for each time sample of any of the jobs, and their prim writers then
+    /// read it in a single parallel loop when the parallel frame reads are
+    /// enabled.
+    /// Returns \c true if all the files were successfully written.
+    MAYAUSD_CORE_PUBLIC
+    static bool WriteTargets(
+        const std::vector<UsdMaya_WriteJob*>& jobs,
+        const std::vector<std::string>&       fileNames);
+
     MAYAUSD_CORE_PUBLIC
     SdfPath MapDagPathToSdfPath(const MDagPath& dagPath) const;
 
@@ -56,15 +78,64 @@ public:
     const UsdMayaUtil::MDagPathMap<SdfPath>& GetDagPathToUsdPathMap() const;
 
 private:
+    // Cumulative time and number of calls of the prim writers or chasers of one type
+    struct _WriterTiming
+    {
+        double seconds = 0.0;
+        size_t calls = 0;
+    };
+
+    // Adds the time spent in its scope to the timing of a prim writer or chaser type, when the
+    // export is profiled
+    class _WriterTimingScope
+    {
+    public:
+        _WriterTimingScope(UsdMaya_WriteJob& job, const std::type_info& writerType, bool isDefault);
+        ~_WriterTimingScope();
+
+    private:
+        _WriterTiming* _timing;
+        TfStopwatch    _stopwatch;
+    };
+
+    /// Authors the writer timings in the custom layer data of the root layer
+    /// and reports them.
+    void _ReportWriterTimings();
+
     /// Begins constructing the USD stage, writing out the values at the default
     /// time. Returns \c true if the stage can be created successfully.
     bool _BeginWriting(const std::string& fileName, bool append);
 
-    /// Writes the stage values at the given frame.
+    /// Collects the animated prim writers and prepares the flushes and value
+    /// clips of the time samples, once the default time is written.
+    void _BeginTimeSamples();
+
+    /// Writes the time sample \p t, once the Maya scene is evaluated at it,
+    /// to the current value clip layer or the root layer.
+    bool _WriteTimeSample(double t, bool prefetch);
+
+    /// Saves the last value clip layer and writes the value clips metadata.
+    bool _EndTimeSamples();
+
+    /// Writes the stage values at the given frame. The Maya data of the
+    /// animated prims is first read in parallel if \p prefetch is true and
+    /// the parallel frame reads are enabled.
     /// Warning: this function must be called with non-decreasing frame numbers.
     /// If you call WriteFrame() with a frame number lower than a previous
     /// WriteFrame() call, internal code may generate errors.
-    bool _WriteFrame(double iFrame);
+    bool _WriteFrame(double iFrame, bool prefetch);
+
+    /// Saves the current value clip layer, if any, and starts writing the
+    /// time samples to a new one from \p startTime.
+    bool _BeginValueClip(double startTime);
+
+    /// Saves the current value clip layer, if any, and writes the next time
+    /// samples to the root layer again.
+    bool _EndValueClip();
+
+    /// Authors the value clips metadata on the root prims and writes their
+    /// manifest.
+    void _WriteValueClips();
 
     /// Runs any post-export processes, closes the USD stage, and writes it out
     /// to disk.
@@ -76,17 +147,43 @@ private:
     /// Creates a usdz package from the write job's current USD stage.
     void _CreatePackage() const;
 
+    /// Calls \p fn on all the chasers in order, and \p advance after each of
+    /// them. The consecutive chasers which can run concurrently are called in
+    /// parallel. Returns \c false as soon as \p fn fails for a chaser.
+    bool _RunChasers(
+        const std::function<bool(UsdMayaExportChaser&)>& fn,
+        const std::function<void()>&                      advance = {});
+
     void _PerFrameCallback(double iFrame);
     void _PostCallback();
 
     bool _CheckNameClashes(const SdfPath& path, const MDagPath& dagPath);
 
+    /// Returns true if the prim of \p primWriter is up to date in the layer
+    /// re-authored by an incremental export.
+    bool _IsCleanForIncrementalExport(const UsdMayaPrimWriter& primWriter) const;
+
     // Name of the created/appended USD file
     std::string _fileName;
 
     // Name of destination packaged archive.
     std::string _packageName;
 
+    // Periodic saves of the root layer while writing the time samples
+    bool _flushSamples = false;
+    int  _flushInterval = 0;
+    int  _framesSinceFlush = 0;
+
+    // Whether the time samples are written to value clip layers
+    bool _valueClips = false;
+
+    // Value clip layer receiving the time samples, null when not writing value clips
+    SdfLayerRefPtr _clipLayer;
+
+    // Names and start times of the value clip layers written so far
+    std::vector<std::string> _clipFileNames;
+    std::vector<double>      _clipStartTimes;
+
     // Name of current layer since it should be restored after looping over them
     MString mCurrentRenderLayerName;
 
@@ -100,6 +197,25 @@ private:
 
     UsdMayaExportChaserRefPtrVector mChasers;
 
+    // Description of the export arguments, an incremental export must have the same as the
+    // previous export of the file
+    std::string _argsDescription;
+
+    // Changes since the previous export of the file, only used by the incremental exports
+    bool                                _incremental = false;
+    UsdMaya_ExportDirtyTracker::Changes _incrementalChanges;
+
+    // Timings at the default time and at the time samples of the prim writers and chasers, by
+    // type, only filled when the export is profiled
+    bool                                                               _profileWriters = false;
+    std::map<std::type_index, std::pair<_WriterTiming, _WriterTiming>> _writerTimings;
+
+    // Prim writers called at the time samples, the ones of the prims which can vary over time
+    std::vector<UsdMayaPrimWriterSharedPtr> mAnimatedPrimWriterList;
+    // Animated prim writers written by batches at the time samples, grouped by batch
+    std::vector<std::pair<UsdMayaPrimWriterBatchSharedPtr, std::vector<UsdMayaPrimWriter*>>>
+        mBatchedPrimWriterList;
+
     UsdMayaWriteJobContext mJobCtx;
 
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
@@ -173,11 +173,19 @@ void OrphanedNodesManager::add(const Ufe::Path& pulledPath, const MDagPath& edit
     pulledPrims().add(pulledPath, PullVariantInfo(editedAsMayaRoot, vsd));
 }
 
-OrphanedNodesManager::Memento OrphanedNodesManager::remove(const Ufe::Path& pulledPath)
+OrphanedNodesManager::PullVariantInfo OrphanedNodesManager::remove(const Ufe::Path& pulledPath)
 {
-    Memento oldPulledPrims(preserve());
-    TF_AXIOM(pulledPrims().remove(pulledPath) != nullptr);
-    return oldPulledPrims;
+    auto removedNode = pulledPrims().remove(pulledPath);
+    TF_AXIOM(removedNode != nullptr);
+    return removedNode->hasData() ? removedNode->data() : PullVariantInfo();
+}
+
+void OrphanedNodesManager::restore(const Ufe::Path& pulledPath, const PullVariantInfo& removed)
+{
+    // The variant set selections are the ones recorded when the path was
+    // pulled, not the current ones.
+    TF_AXIOM(!pulledPrims().containsDescendantInclusive(pulledPath));
+    pulledPrims().add(pulledPath, removed);
 }
 
 void OrphanedNodesManager::operator()(const Ufe::Notification& n)
@@ -214,9 +222,9 @@ void OrphanedNodesManager::operator()(const Ufe::Notification& n)
             handleOp(Ufe::SceneCompositeNotification::Op(
                 Ufe::SceneCompositeNotification::OpType::SubtreeInvalidate, subtrInv->root()));
         } else if (auto objRename = dynamic_cast<const Ufe::ObjectRename*>(&sceneNotification)) {
-            handlePathChange(objRename->previousPath(), objRename->item(), _pulledPrims);
+            handlePathChange(objRename->previousPath(), objRename->item(), pulledPrims());
         } else if (auto objRep = dynamic_cast<const Ufe::ObjectReparent*>(&sceneNotification)) {
-            handlePathChange(objRep->previousPath(), objRep->item(), _pulledPrims);
+            handlePathChange(objRep->previousPath(), objRep->item(), pulledPrims());
         }
 #endif
     }
@@ -331,7 +339,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
     case Ufe::SceneCompositeNotification::OpType::ObjectPathChange: {
         if (op.subOpType == Ufe::ObjectPathChange::ObjectRename
             || op.subOpType == Ufe::ObjectPathChange::ObjectReparent) {
-            handlePathChange(op.path, op.item, _pulledPrims);
+            handlePathChange(op.path, op.item, pulledPrims());
         }
     } break;
 #endif
@@ -341,11 +349,33 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
     }
 }
 
-Ufe::Trie<PullVariantInfo>& OrphanedNodesManager::pulledPrims() { return _pulledPrims; }
+Ufe::Trie<PullVariantInfo>& OrphanedNodesManager::pulledPrims()
+{
+    loadPendingJson();
+    return _pulledPrims;
+}
+
+const Ufe::Trie<PullVariantInfo>& OrphanedNodesManager::pulledPrims() const
+{
+    loadPendingJson();
+    return _pulledPrims;
+}
+
+void OrphanedNodesManager::loadPendingJson() const
+{
+    if (_pendingJson.empty())
+        return;
 
-const Ufe::Trie<PullVariantInfo>& OrphanedNodesManager::pulledPrims() const { return _pulledPrims; }
+    std::string json;
+    json.swap(_pendingJson);
+    _pulledPrims = Memento::convertFromJson(json).release();
+}
 
-void OrphanedNodesManager::clear() { pulledPrims().clear(); }
+void OrphanedNodesManager::clear()
+{
+    _pendingJson.clear();
+    _pulledPrims.clear();
+}
 
 bool OrphanedNodesManager::empty() const { return pulledPrims().root()->empty(); }
 
@@ -354,7 +384,17 @@ OrphanedNodesManager::Memento OrphanedNodesManager::preserve() const
     return Memento(deepCopy(pulledPrims()));
 }
 
-void OrphanedNodesManager::restore(Memento&& previous) { _pulledPrims = previous.release(); }
+void OrphanedNodesManager::restore(Memento&& previous)
+{
+    _pendingJson.clear();
+    _pulledPrims = previous.release();
+}
+
+void OrphanedNodesManager::restoreFromJson(std::string json)
+{
+    _pulledPrims.clear();
+    _pendingJson = std::move(json);
+}
 
 bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath) const
 {
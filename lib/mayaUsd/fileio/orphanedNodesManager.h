@@ -136,9 +136,13 @@ public:
     void add(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot);
 
     // Remove the pulled path from the trie of pulled prims.  Asserts that the
-    // path is in the trie.  Returns a memento (see Memento Pattern) for undo
-    // purposes, to be used as argument to restore().
-    Memento remove(const Ufe::Path& pulledPath);
+    // path is in the trie.  Returns the removed pull information for undo
+    // purposes, to be used as argument to restore().  Only the branch of the
+    // pulled path is modified, the rest of the trie is not copied.
+    PullVariantInfo remove(const Ufe::Path& pulledPath);
+
+    // Add back the pulled path removed by remove(), with its pull information.
+    void restore(const Ufe::Path& pulledPath, const PullVariantInfo& removed);
 
     // Preserve the trie of pulled prims into a memento.
     Memento preserve() const;
@@ -146,6 +150,14 @@ public:
     // Restore the trie of pulled prims to the content of the argument memento.
     void restore(Memento&& previous);
 
+    // Restore the trie of pulled prims from JSON text.  The text is only
+    // parsed when the trie is first used.
+    void restoreFromJson(std::string json);
+
+    // Return the trie of pulled prims as JSON text.  JSON text restored by
+    // restoreFromJson() is returned as-is if the trie was not used since.
+    std::string toJson() const;
+
     // Clear all pulled paths from the trie of pulled prims.
     void clear();
 
@@ -159,6 +171,9 @@ public:
 private:
     void handleOp(const Ufe::SceneCompositeNotification::Op& op);
 
+    // Parse the JSON text given to restoreFromJson(), if not done yet.
+    void loadPendingJson() const;
+
     Ufe::Trie<PullVariantInfo>&       pulledPrims();
     const Ufe::Trie<PullVariantInfo>& pulledPrims() const;
 
@@ -179,8 +194,12 @@ private:
 
     // Trie for fast lookup of descendant pulled prims.  The Trie key is the
     // UFE pulled path, and the Trie value is the corresponding Dag pull parent
-    // and all ancestor variant set selections.
-    Ufe::Trie<PullVariantInfo> _pulledPrims;
+    // and all ancestor variant set selections.  Loaded lazily from
+    // _pendingJson, hence mutable.
+    mutable Ufe::Trie<PullVariantInfo> _pulledPrims;
+
+    // JSON text of the pulled prims not parsed yet.
+    mutable std::string _pendingJson;
 };
 
 } // namespace MAYAUSD_NS_DEF
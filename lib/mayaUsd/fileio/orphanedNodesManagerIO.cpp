@@ -20,12 +20,15 @@
 
 #include <pxr/base/js/json.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/pxr.h>
 
 #include <maya/MDagPath.h>
 #include <maya/MString.h>
 #include <ufe/pathString.h>
 #include <ufe/trie.imp.h>
 
+#include <sstream>
+
 namespace MAYAUSD_NS_DEF {
 
 namespace {
@@ -91,7 +94,9 @@ PXR_NS::JsObject convertToObject(const VariantSetDesc& variantDesc);
 PXR_NS::JsArray  convertToArray(const std::list<VariantSetDesc>& allVariantDesc);
 PXR_NS::JsObject convertToObject(const PullVariantInfo& pullInfo);
 PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNode);
+#if PXR_VERSION < 2011
 PXR_NS::JsObject convertToObject(const PullInfoTrie& allPulledInfo);
+#endif
 
 VariantSelection   convertToVariantSelection(const PXR_NS::JsArray& variantSelJson);
 VariantSetDesc     convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDescJson);
@@ -146,7 +151,7 @@ VariantSetDesc convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDesc
 
     variantDesc.path = convertToUfePath(convertJsonKeyToValue(variantDescJson, pathJsonKey));
 
-    PXR_NS::JsArray variantSelectionsJson
+    const PXR_NS::JsArray& variantSelectionsJson
         = convertToArray(convertJsonKeyToValue(variantDescJson, variantSelKey));
 
     for (const PXR_NS::JsValue& value : variantSelectionsJson)
@@ -242,10 +247,12 @@ void convertToPullInfoTrieNodePtr(
     }
 }
 
+#if PXR_VERSION < 2011
 PXR_NS::JsObject convertToObject(const PullInfoTrie& allPullInfo)
 {
     return convertToObject(allPullInfo.root());
 }
+#endif
 
 PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
 {
@@ -256,6 +263,98 @@ PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
     return allPullInfo;
 }
 
+#if PXR_VERSION >= 2011
+
+////////////////////////////////////////////////////////////////////////////
+//
+// Streaming conversion to JSON text, with the same structure as above, but
+// without building the intermediate JsValue tree.
+
+void writeJson(PXR_NS::JsWriter& writer, const VariantSetDesc& variantDesc)
+{
+    writer.BeginObject();
+    writer.WriteKeyValue(pathJsonKey, Ufe::PathString::string(variantDesc.path));
+    writer.WriteKey(variantSelKey);
+    writer.BeginArray();
+    for (const auto& variantSel : variantDesc.variantSelections) {
+        writer.BeginArray();
+        writer.WriteValue(variantSel.variantSetName);
+        writer.WriteValue(variantSel.variantSelection);
+        writer.EndArray();
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
+void writeJson(PXR_NS::JsWriter& writer, const PullVariantInfo& pullInfo)
+{
+    writer.BeginObject();
+    writer.WriteKeyValue(
+        editedAsMayaRootJsonKey, std::string(pullInfo.editedAsMayaRoot.fullPathName().asChar()));
+    writer.WriteKey(variantSetDescriptorsJsonKey);
+    writer.BeginArray();
+    for (const auto& variantDesc : pullInfo.variantSetDescriptors) {
+        writeJson(writer, variantDesc);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
+// Empty sub-tries are not written, to match the JsValue conversion.
+bool hasPullInfo(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
+{
+    if (!pullInfoNodePtr)
+        return false;
+
+    if (pullInfoNodePtr->hasData())
+        return true;
+
+    for (const auto& child : pullInfoNodePtr->childrenComponents()) {
+        if (hasPullInfo((*pullInfoNodePtr)[child]))
+            return true;
+    }
+
+    return false;
+}
+
+void writeJson(PXR_NS::JsWriter& writer, const PullInfoTrieNode::Ptr& pullInfoNodePtr)
+{
+    writer.BeginObject();
+
+    if (pullInfoNodePtr) {
+        const PullInfoTrieNode& pullInfoNode = *pullInfoNodePtr;
+
+        if (pullInfoNode.hasData()) {
+            writer.WriteKey(pullInfoJsonKey);
+            writeJson(writer, pullInfoNode.data());
+        }
+
+        for (const auto& child : pullInfoNode.childrenComponents()) {
+            PullInfoTrieNode::Ptr childNode = pullInfoNode[child];
+            if (!hasPullInfo(childNode))
+                continue;
+            writer.WriteKey(ufeComponentPrefix + child.string());
+            writeJson(writer, childNode);
+        }
+    }
+
+    writer.EndObject();
+}
+
+#endif
+
+std::string convertPullInfoTrieToJson(const PullInfoTrie& allPullInfo)
+{
+#if PXR_VERSION >= 2011
+    std::ostringstream json;
+    PXR_NS::JsWriter   writer(json);
+    writeJson(writer, allPullInfo.root());
+    return json.str();
+#else
+    return PXR_NS::JsWriteToString(convertToObject(allPullInfo));
+#endif
+}
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////
@@ -265,7 +364,7 @@ PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
 std::string Memento::convertToJson(const Memento& memento)
 {
     try {
-        return PXR_NS::JsWriteToString(convertToObject(memento._pulledPrims));
+        return convertPullInfoTrieToJson(memento._pulledPrims);
     } catch (const std::exception& e) {
         // Note: the TF_RUNTIME_ERROR macro needs to be used within the PXR_NS.
         using namespace PXR_NS;
@@ -292,4 +391,23 @@ Memento Memento::convertFromJson(const std::string& json)
     return memento;
 }
 
+std::string OrphanedNodesManager::toJson() const
+{
+    // Pull information that was never used since it was restored does not
+    // need to be parsed to be saved again.
+    if (!_pendingJson.empty())
+        return _pendingJson;
+
+    try {
+        return convertPullInfoTrieToJson(_pulledPrims);
+    } catch (const std::exception& e) {
+        // Note: the TF_RUNTIME_ERROR macro needs to be used within the PXR_NS.
+        using namespace PXR_NS;
+        TF_RUNTIME_ERROR(
+            "Unable to convert the orphaned nodes manager state to JSON: %s", e.what());
+    }
+
+    return {};
+}
+
 } // namespace MAYAUSD_NS_DEF
@@ -23,6 +23,9 @@ UsdMayaPrimReaderContext::UsdMayaPrimReaderContext(ObjectRegistry* pathNodeMap)
     : _prune(false)
     , _timeSampleMultiplier(1.0)
     , _pathNodeMap(pathNodeMap)
+    , _valueCache(nullptr)
+    , _dagModifier(nullptr)
+    , _profiler(nullptr)
 {
 }
 
@@ -95,4 +98,28 @@ void UsdMayaPrimReaderContext::SetTimeSampleMultiplier(double multiplier)
     _timeSampleMultiplier = multiplier;
 };
 
+const UsdMayaPrimReaderValueCache* UsdMayaPrimReaderContext::GetValueCache() const
+{
+    return _valueCache;
+}
+
+void UsdMayaPrimReaderContext::SetValueCache(const UsdMayaPrimReaderValueCache* valueCache)
+{
+    _valueCache = valueCache;
+}
+
+MDagModifier* UsdMayaPrimReaderContext::GetDagModifier() const { return _dagModifier; }
+
+void UsdMayaPrimReaderContext::SetDagModifier(MDagModifier* dagModifier)
+{
+    _dagModifier = dagModifier;
+}
+
+UsdMayaPrimReaderProfiler* UsdMayaPrimReaderContext::GetProfiler() const { return _profiler; }
+
+void UsdMayaPrimReaderContext::SetProfiler(UsdMayaPrimReaderProfiler* profiler)
+{
+    _profiler = profiler;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -21,10 +21,14 @@
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/prim.h>
 
+#include <maya/MDagModifier.h>
 #include <maya/MObject.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class UsdMayaPrimReaderProfiler;
+class UsdMayaPrimReaderValueCache;
+
 /// \class UsdMayaPrimReaderContext
 /// \brief This class provides an interface for reader plugins to communicate
 /// state back to the core usd maya logic as well as retrieve information set by
@@ -94,6 +98,37 @@ public:
     MAYAUSD_CORE_PUBLIC
     void SetTimeSampleMultiplier(double multiplier);
 
+    /// \brief Return the values prefetched by the import, or nullptr. Reads
+    /// through UsdMayaPrimReaderValueCache::Get() fall back to the stage.
+    MAYAUSD_CORE_PUBLIC
+    const UsdMayaPrimReaderValueCache* GetValueCache() const;
+
+    /// \brief Set the values prefetched by the import, which must outlive the
+    /// context.
+    MAYAUSD_CORE_PUBLIC
+    void SetValueCache(const UsdMayaPrimReaderValueCache* valueCache);
+
+    /// \brief Return the DAG modifier shared by the node creations of the
+    /// import, or nullptr if each creation uses its own modifier.
+    MAYAUSD_CORE_PUBLIC
+    MDagModifier* GetDagModifier() const;
+
+    /// \brief Set the DAG modifier shared by the node creations of the
+    /// import, which must outlive the context. The owner of the modifier is
+    /// responsible for its undo and redo.
+    MAYAUSD_CORE_PUBLIC
+    void SetDagModifier(MDagModifier* dagModifier);
+
+    /// \brief Return the profiler timing the readers of the import, or nullptr
+    /// if the import is not profiled.
+    MAYAUSD_CORE_PUBLIC
+    UsdMayaPrimReaderProfiler* GetProfiler() const;
+
+    /// \brief Set the profiler timing the readers of the import, which must
+    /// outlive the context.
+    MAYAUSD_CORE_PUBLIC
+    void SetProfiler(UsdMayaPrimReaderProfiler* profiler);
+
     ~UsdMayaPrimReaderContext() { }
 
 private:
@@ -104,6 +139,10 @@ private:
     // for undo/redo
     ObjectRegistry* _pathNodeMap;
 
+    const UsdMayaPrimReaderValueCache* _valueCache;
+    MDagModifier*                      _dagModifier;
+    UsdMayaPrimReaderProfiler*         _profiler;
+
     // Tracks new nodes. It is possible that a code branch will decide to work on a copy of the
     // context, so wrap the tracker in a shared pointer.
     std::shared_ptr<MayaObjectList> _trackedNewMayaNodes;
@@ -0,0 +1,128 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "primReaderProfiler.h"
+
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+const char* _GetCategoryName(UsdMayaPrimReaderProfiler::Category category)
+{
+    switch (category) {
+    case UsdMayaPrimReaderProfiler::Category::PrimReader: return "primReaders";
+    case UsdMayaPrimReaderProfiler::Category::ShaderReader: return "shaderReaders";
+    case UsdMayaPrimReaderProfiler::Category::ImportChaser: return "importChasers";
+    }
+    return "";
+}
+
+} // namespace
+
+UsdMayaPrimReaderProfiler::Scope::Scope(
+    UsdMayaPrimReaderProfiler* profiler,
+    Category                   category,
+    const std::type_info&      type)
+    : _timing(nullptr)
+{
+    if (profiler) {
+        _timing = &profiler->_timings[std::make_pair(category, std::type_index(type))];
+        _stopwatch.Start();
+    }
+}
+
+UsdMayaPrimReaderProfiler::Scope::~Scope()
+{
+    if (_timing) {
+        _stopwatch.Stop();
+        _timing->seconds += _stopwatch.GetSeconds();
+        ++_timing->calls;
+    }
+}
+
+void UsdMayaPrimReaderProfiler::Report(const std::string& jsonFileName) const
+{
+    if (_timings.empty()) {
+        return;
+    }
+
+    // The slowest types are reported first.
+    struct _TypeTiming
+    {
+        Category    category;
+        std::string typeName;
+        Timing      timing;
+    };
+    std::vector<_TypeTiming> typeTimings;
+    for (const auto& entry : _timings) {
+        // Strip the namespaces, the USD one makes the report hard to read.
+        const std::string typeName
+            = TfStringGetSuffix(ArchGetDemangled(entry.first.second.name()), ':');
+        typeTimings.push_back({ entry.first.first, typeName, entry.second });
+    }
+    std::stable_sort(
+        typeTimings.begin(),
+        typeTimings.end(),
+        [](const _TypeTiming& lhs, const _TypeTiming& rhs) {
+            return lhs.timing.seconds > rhs.timing.seconds;
+        });
+
+    std::map<std::string, JsObject> categoryTimings;
+    for (const _TypeTiming& entry : typeTimings) {
+        const char* categoryName = _GetCategoryName(entry.category);
+        TF_STATUS(
+            "%s %s: %.3f s (%zu calls)",
+            categoryName,
+            entry.typeName.c_str(),
+            entry.timing.seconds,
+            entry.timing.calls);
+
+        JsObject typeTiming;
+        typeTiming["seconds"] = JsValue(entry.timing.seconds);
+        typeTiming["calls"] = JsValue(static_cast<int64_t>(entry.timing.calls));
+
+        categoryTimings[categoryName][entry.typeName] = JsValue(typeTiming);
+    }
+
+    if (jsonFileName.empty()) {
+        return;
+    }
+
+    JsObject report;
+    for (const auto& entry : categoryTimings) {
+        report[entry.first] = JsValue(entry.second);
+    }
+
+    std::ofstream jsonFile(jsonFileName);
+    if (!jsonFile) {
+        TF_RUNTIME_ERROR("Unable to write the import profile to '%s'", jsonFileName.c_str());
+        return;
+    }
+    JsWriteToStream(JsValue(report), jsonFile);
+}
+
+void UsdMayaPrimReaderProfiler::Clear() { _timings.clear(); }
+
+PXR_NAMESPACE_CLOSE_SCOPE
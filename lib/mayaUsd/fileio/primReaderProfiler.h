@@ -0,0 +1,91 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_PRIMREADERPROFILER_H
+#define PXRUSDMAYA_PRIMREADERPROFILER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/pxr.h>
+
+#include <map>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdMayaPrimReaderProfiler
+/// \brief This class records the time spent in the prim readers, shader readers
+/// and import chasers of an import, by type.
+///
+/// The time of a shader reader is also counted in the prim reader which
+/// imported the material, since the materials are read while their bound
+/// prims are.
+class UsdMayaPrimReaderProfiler
+{
+public:
+    /// Kind of the profiled import extension.
+    enum class Category
+    {
+        PrimReader,
+        ShaderReader,
+        ImportChaser
+    };
+
+    /// Cumulative time and number of calls of the extensions of one type.
+    struct Timing
+    {
+        double seconds = 0.0;
+        size_t calls = 0;
+    };
+
+    /// \brief Adds the time spent in its scope to the timing of \p type.
+    /// Does nothing if \p profiler is null.
+    class Scope
+    {
+    public:
+        MAYAUSD_CORE_PUBLIC
+        Scope(UsdMayaPrimReaderProfiler* profiler, Category category, const std::type_info& type);
+
+        MAYAUSD_CORE_PUBLIC
+        ~Scope();
+
+    private:
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        Timing*     _timing;
+        TfStopwatch _stopwatch;
+    };
+
+    /// \brief Reports the timings through TF_STATUS, slowest types first, and
+    /// writes them as JSON to \p jsonFileName if it is not empty.
+    MAYAUSD_CORE_PUBLIC
+    void Report(const std::string& jsonFileName) const;
+
+    /// \brief Removes all the recorded timings.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+private:
+    std::map<std::pair<Category, std::type_index>, Timing> _timings;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
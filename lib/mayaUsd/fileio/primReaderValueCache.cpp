@@ -0,0 +1,122 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "primReaderValueCache.h"
+
+#include <mayaUsd/fileio/primReaderContext.h>
+
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+#include <pxr/usd/usdGeom/xformable.h>
+
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+using _AttributeValues = std::vector<std::pair<SdfPath, VtValue>>;
+
+void _AppendValue(const UsdAttribute& attr, _AttributeValues* values)
+{
+    VtValue value;
+    if (attr && attr.Get(&value, UsdTimeCode::EarliestTime())) {
+        values->emplace_back(attr.GetPath(), std::move(value));
+    }
+}
+
+// Resolves the values the built-in readers get for the prim.
+void _ResolvePrimValues(const UsdPrim& prim, _AttributeValues* values)
+{
+    if (UsdGeomMesh mesh = UsdGeomMesh(prim)) {
+        _AppendValue(mesh.GetFaceVertexCountsAttr(), values);
+        _AppendValue(mesh.GetFaceVertexIndicesAttr(), values);
+    }
+
+    if (UsdGeomPointBased pointBased = UsdGeomPointBased(prim)) {
+        _AppendValue(pointBased.GetPointsAttr(), values);
+        _AppendValue(pointBased.GetNormalsAttr(), values);
+    }
+
+    if (UsdGeomXformable xformable = UsdGeomXformable(prim)) {
+        bool resetsXformStack = false;
+        for (const UsdGeomXformOp& xformOp : xformable.GetOrderedXformOps(&resetsXformStack)) {
+            _AppendValue(xformOp.GetAttr(), values);
+        }
+    }
+}
+
+} // namespace
+
+void UsdMayaPrimReaderValueCache::Prefetch(const UsdPrimRange& range)
+{
+    std::vector<UsdPrim> prims;
+    for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
+        if (!primIt.IsPostVisit()) {
+            prims.push_back(*primIt);
+        }
+    }
+
+    // The workers only read the stage, each one into the values of its prims.
+    std::vector<_AttributeValues> primValues(prims.size());
+    WorkParallelForN(prims.size(), [&prims, &primValues](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            _ResolvePrimValues(prims[i], &primValues[i]);
+        }
+    });
+
+    for (_AttributeValues& values : primValues) {
+        for (auto& value : values) {
+            _values[value.first] = std::move(value.second);
+        }
+    }
+}
+
+void UsdMayaPrimReaderValueCache::Clear() { _values.clear(); }
+
+/* static */
+bool UsdMayaPrimReaderValueCache::Get(
+    const UsdMayaPrimReaderContext* context,
+    const UsdAttribute&             attr,
+    VtValue*                        value,
+    UsdTimeCode                     time)
+{
+    return _Find(context, attr, time, value) || attr.Get(value, time);
+}
+
+/* static */
+bool UsdMayaPrimReaderValueCache::_Find(
+    const UsdMayaPrimReaderContext* context,
+    const UsdAttribute&             attr,
+    UsdTimeCode                     time,
+    VtValue*                        value)
+{
+    const UsdMayaPrimReaderValueCache* cache = context ? context->GetValueCache() : nullptr;
+    if (!cache || time != UsdTimeCode::EarliestTime()) {
+        return false;
+    }
+
+    const auto it = cache->_values.find(attr.GetPath());
+    if (it == cache->_values.end()) {
+        return false;
+    }
+
+    *value = it->second;
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
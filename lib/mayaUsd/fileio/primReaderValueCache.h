@@ -0,0 +1,95 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_PRIMREADERVALUECACHE_H
+#define PXRUSDMAYA_PRIMREADERVALUECACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/value.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class UsdMayaPrimReaderContext;
+
+/// \class UsdMayaPrimReaderValueCache
+/// \brief This class holds the values of the USD attributes read by the
+/// prim readers of an import, resolved ahead of the creation of the Maya nodes.
+///
+/// The values are resolved from worker threads by Prefetch(), which only reads
+/// the stage, so the prim readers running serially on the main thread don't
+/// wait on the value resolution of the largest attributes: the points and
+/// topology of the point based prims, and the xform ops.
+///
+/// Only the values at UsdTimeCode::EarliestTime() are cached, which is the
+/// time the readers use for the attributes without samples in the imported
+/// frame range. The other reads go to the stage.
+class UsdMayaPrimReaderValueCache
+{
+public:
+    /// \brief Resolves in parallel the cached values of the prims of \p range.
+    MAYAUSD_CORE_PUBLIC
+    void Prefetch(const UsdPrimRange& range);
+
+    /// \brief Removes all the cached values.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+    /// \brief Gets the value of \p attr at \p time through the cache of
+    /// \p context, or from the stage if the context has no cache.
+    MAYAUSD_CORE_PUBLIC
+    static bool Get(
+        const UsdMayaPrimReaderContext* context,
+        const UsdAttribute&             attr,
+        VtValue*                        value,
+        UsdTimeCode                     time);
+
+    /// \brief Typed version of the above, the cached value must hold a \p T.
+    template <typename T>
+    static bool Get(
+        const UsdMayaPrimReaderContext* context,
+        const UsdAttribute&             attr,
+        T*                              value,
+        UsdTimeCode                     time)
+    {
+        VtValue cachedValue;
+        if (_Find(context, attr, time, &cachedValue) && cachedValue.IsHolding<T>()) {
+            *value = cachedValue.UncheckedGet<T>();
+            return true;
+        }
+        return attr.Get(value, time);
+    }
+
+private:
+    MAYAUSD_CORE_PUBLIC
+    static bool _Find(
+        const UsdMayaPrimReaderContext* context,
+        const UsdAttribute&             attr,
+        UsdTimeCode                     time,
+        VtValue*                        value);
+
+    std::unordered_map<SdfPath, VtValue, SdfPath::Hash> _values;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -24,6 +24,7 @@
 #include <mayaUsd/fileio/orphanedNodesManager.h>
 #endif
 #include <mayaUsd/fileio/primUpdaterRegistry.h>
+#include <mayaUsd/fileio/pullDirtyTracker.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/Global.h>
@@ -33,10 +34,12 @@
 #include <mayaUsd/undo/OpUndoItems.h>
 #include <mayaUsd/undo/UsdUndoBlock.h>
 #include <mayaUsd/utils/dynamicAttribute.h>
+#include <mayaUsd/utils/profilingScope.h>
 #include <mayaUsd/utils/progressBarScope.h>
 #include <mayaUsd/utils/traverseLayer.h>
 
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/instantiateSingleton.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/usd/prim.h>
@@ -50,6 +53,7 @@
 #include <maya/MGlobal.h>
 #include <maya/MItDag.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MSceneMessage.h>
 #include <ufe/globalSelection.h>
 #include <ufe/hierarchy.h>
@@ -57,9 +61,11 @@
 #include <ufe/path.h>
 #include <ufe/pathString.h>
 #include <ufe/sceneNotification.h>
+#include <ufe/selection.h>
 
 #include <functional>
 #include <tuple>
+#include <unordered_map>
 
 using UpdaterFactoryFn = UsdMayaPrimUpdaterRegistry::UpdaterFactoryFn;
 using namespace MayaUsd;
@@ -118,19 +124,22 @@ SdfPath makeDstPath(const SdfPath& dstRootParentPath, const SdfPath& srcPath)
 
 //------------------------------------------------------------------------------
 //
-// Verify if the given prim under the given UFE path is an ancestor of an already edited prim.
-bool hasEditedDescendant(const Ufe::Path& ufeQueryPath)
+// Get the UFE paths of the already edited prims.
+std::vector<Ufe::Path> getEditedPaths()
 {
+    std::vector<Ufe::Path> editedPaths;
+
     MObject pullSetObj;
     auto    status = UsdMayaUtil::GetMObjectByName(kPullSetName, pullSetObj);
     if (status != MStatus::kSuccess)
-        return false;
+        return editedPaths;
 
     MFnSet         fnPullSet(pullSetObj);
     MSelectionList members;
     const bool     flatten = true;
     fnPullSet.getMembers(members, flatten);
 
+    editedPaths.reserve(members.length());
     for (unsigned int i = 0; i < members.length(); ++i) {
         MDagPath pulledDagPath;
         members.getDagPath(i, pulledDagPath);
@@ -138,13 +147,123 @@ bool hasEditedDescendant(const Ufe::Path& ufeQueryPath)
         if (!readPullInformation(pulledDagPath, pulledUfePath))
             continue;
 
-        if (pulledUfePath.startsWith(ufeQueryPath))
+        editedPaths.push_back(pulledUfePath);
+    }
+
+    return editedPaths;
+}
+
+//------------------------------------------------------------------------------
+//
+// Map between the pulled Maya root nodes and the USD paths they were pulled
+// from.  It is loaded from the pull information of the pull set members on
+// first use after a scene is opened, and then kept up to date on pull, push and
+// discard, so that mapping Maya paths to USD paths does not read the pull
+// information from the Maya nodes.
+class PulledPathsTracker
+{
+public:
+    static PulledPathsTracker& instance()
+    {
+        static PulledPathsTracker tracker;
+        return tracker;
+    }
+
+    bool find(const MDagPath& dagPath, Ufe::Path& pulledPath)
+    {
+        load();
+
+        auto found = _pulledPaths.find(MObjectHandle(dagPath.node()));
+        if (found == _pulledPaths.end() || !found->first.isValid())
+            return false;
+
+        pulledPath = found->second;
+        return true;
+    }
+
+    void add(const MDagPath& editedAsMayaRoot, const Ufe::Path& pulledPath)
+    {
+        remove(pulledPath);
+
+        MObjectHandle node(editedAsMayaRoot.node());
+        _pulledPaths[node] = pulledPath;
+        _pulledNodes[pulledPath] = node;
+    }
+
+    void remove(const Ufe::Path& pulledPath)
+    {
+        auto found = _pulledNodes.find(pulledPath);
+        if (found == _pulledNodes.end())
+            return;
+
+        _pulledPaths.erase(found->second);
+        _pulledNodes.erase(found);
+    }
+
+    void reset()
+    {
+        _pulledPaths.clear();
+        _pulledNodes.clear();
+        _loaded = false;
+    }
+
+private:
+    void load()
+    {
+        if (_loaded)
+            return;
+        _loaded = true;
+
+        MObject pullSetObj;
+        auto    status = UsdMayaUtil::GetMObjectByName(kPullSetName, pullSetObj);
+        if (status != MStatus::kSuccess)
+            return;
+
+        MFnSet         fnPullSet(pullSetObj);
+        MSelectionList members;
+        const bool     flatten = true;
+        fnPullSet.getMembers(members, flatten);
+
+        for (unsigned int i = 0; i < members.length(); ++i) {
+            MDagPath pulledDagPath;
+            members.getDagPath(i, pulledDagPath);
+            Ufe::Path pulledUfePath;
+            if (!readPullInformation(pulledDagPath, pulledUfePath))
+                continue;
+
+            add(pulledDagPath, pulledUfePath);
+        }
+    }
+
+    std::unordered_map<MObjectHandle, Ufe::Path> _pulledPaths;
+    std::unordered_map<Ufe::Path, MObjectHandle> _pulledNodes;
+    bool                                         _loaded { false };
+};
+
+void resetPulledPathsCallback(void*) { PulledPathsTracker::instance().reset(); }
+
+//------------------------------------------------------------------------------
+//
+// Verify if the given prim under the given UFE path is an ancestor of one of
+// the edited prims.
+bool hasEditedDescendant(const Ufe::Path& ufeQueryPath, const std::vector<Ufe::Path>& editedPaths)
+{
+    for (const Ufe::Path& editedPath : editedPaths) {
+        if (editedPath.startsWith(ufeQueryPath))
             return true;
     }
 
     return false;
 }
 
+//------------------------------------------------------------------------------
+//
+// Verify if the given prim under the given UFE path is an ancestor of an already edited prim.
+bool hasEditedDescendant(const Ufe::Path& ufeQueryPath)
+{
+    return hasEditedDescendant(ufeQueryPath, getEditedPaths());
+}
+
 //------------------------------------------------------------------------------
 //
 // The UFE path is to the pulled prim, and the Dag path is the corresponding
@@ -185,6 +304,7 @@ bool writeAllPullInformation(const Ufe::Path& ufePulledPath, const MDagPath& edi
 
     // Store medata on DG node
     writePullInformation(ufePulledPath, editedAsMayaRoot);
+    PulledPathsTracker::instance().add(editedAsMayaRoot, ufePulledPath);
     progressBar.advance();
 
     return true;
@@ -194,6 +314,8 @@ bool writeAllPullInformation(const Ufe::Path& ufePulledPath, const MDagPath& edi
 //
 void removeAllPullInformation(const Ufe::Path& ufePulledPath)
 {
+    PulledPathsTracker::instance().remove(ufePulledPath);
+
     UsdPrim     pulledPrim = MayaUsd::ufe::ufePathToPrim(ufePulledPath);
     UsdStagePtr stage = pulledPrim.GetStage();
     if (!stage)
@@ -499,10 +621,15 @@ using UsdPathToDagPathMapPtr = std::shared_ptr<UsdPathToDagPathMap>;
 using PushCustomizeSrc
     = std::tuple<SdfPath, UsdStageRefPtr, SdfLayerRefPtr, UsdPathToDagPathMapPtr>;
 
+//
+// If cleanDagPaths is given, cleanSrcPaths is filled with the source paths of
+// the prims exported only from these Dag paths.
 PushCustomizeSrc pushExport(
     const Ufe::Path&                 ufePulledPath,
     const MObject&                   mayaObject,
-    const UsdMayaPrimUpdaterContext& context)
+    const UsdMayaPrimUpdaterContext& context,
+    const UsdMayaUtil::MDagPathSet*  cleanDagPaths = nullptr,
+    SdfPathSet*                      cleanSrcPaths = nullptr)
 {
     MayaUsd::ProgressBarScope progressBar(3);
 
@@ -550,6 +677,22 @@ PushCustomizeSrc pushExport(
         context._pushExtras.processItem(v.first, v.second);
     }
 
+    if (cleanDagPaths && cleanSrcPaths) {
+        // A prim can be exported from several nodes, e.g. a transform merged
+        // with its shape, it is clean only when all of them are.
+        SdfPathSet dirtySrcPaths;
+        for (const auto& v : writeJob.GetDagPathToUsdPathMap()) {
+            if (cleanDagPaths->count(v.first) == 0) {
+                dirtySrcPaths.insert(v.second);
+            }
+        }
+        for (const auto& v : *usdPathToDagPathMap) {
+            if (dirtySrcPaths.count(v.first) == 0) {
+                cleanSrcPaths->insert(v.first);
+            }
+        }
+    }
+
     std::get<UsdPathToDagPathMapPtr>(pushCustomizeSrc) = usdPathToDagPathMap;
     progressBar.advance();
 
@@ -632,11 +775,12 @@ UsdMayaPrimUpdaterSharedPtr createUpdater(
 //
 // Perform the customization step of the merge to USD (second step).  Traverse
 // the in-memory layer, creating a prim updater for each prim, and call Push
-// for each updater.
+// for each updater.  The specs of the prims in cleanSrcPaths are not copied.
 bool pushCustomize(
     const Ufe::Path&                 ufePulledPath,
     const PushCustomizeSrc&          src,
-    const UsdMayaPrimUpdaterContext& context)
+    const UsdMayaPrimUpdaterContext& context,
+    const SdfPathSet&                cleanSrcPaths = SdfPathSet())
 
 {
     const auto& srcRootPath = std::get<SdfPath>(src);
@@ -657,7 +801,8 @@ bool pushCustomize(
     // Traverse the layer, creating a prim updater for each primSpec
     // along the way, and call PushCopySpec on the prim.
     auto pushCopySpecsFn
-        = [&context, srcStage, srcLayer, dstLayer, dstRootParentPath](const SdfPath& srcPath) {
+        = [&context, &cleanSrcPaths, &progressBar, srcStage, srcLayer, dstLayer, dstRootParentPath](
+              const SdfPath& srcPath) {
               // We can be called with a primSpec path that is not a prim path
               // (e.g. a property path like "/A.xformOp:translate").  This is not an
               // error, just prune the traversal.  FIXME Is this still true?  We
@@ -666,6 +811,17 @@ bool pushCustomize(
                   return false;
               }
 
+              // Stop the copy when the user cancels the merge.
+              if (progressBar.isInterruptRequested()) {
+                  throw MayaUsd::TraversalFailure(std::string("Merge cancelled."), srcPath);
+              }
+
+              // The prims of the Maya nodes unchanged since the edit as Maya
+              // already hold their values, but their children may have changed.
+              if (cleanSrcPaths.count(srcPath) > 0) {
+                  return true;
+              }
+
               auto dstPath = makeDstPath(dstRootParentPath, srcPath);
               auto updater = createUpdater(srcLayer, srcPath, dstPath, context);
               // If we cannot find an updater for the srcPath, prune the traversal.
@@ -854,13 +1010,13 @@ public:
 
     bool undo() override
     {
-        _orphanedNodesManager->restore(std::move(_memento));
+        _orphanedNodesManager->restore(_pulledPath, _removed);
         return true;
     }
 
     bool redo() override
     {
-        _memento = _orphanedNodesManager->remove(_pulledPath);
+        _removed = _orphanedNodesManager->remove(_pulledPath);
         return true;
     }
 
@@ -869,7 +1025,7 @@ private:
     const Ufe::Path                             _pulledPath;
 
     // Created by redo().
-    OrphanedNodesManager::Memento _memento;
+    OrphanedNodesManager::PullVariantInfo _removed;
 };
 #endif
 
@@ -879,6 +1035,12 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_INSTANTIATE_SINGLETON(PrimUpdaterManager);
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_INCREMENTAL_MERGE_TO_USD,
+    false,
+    "Track the Maya nodes of the prims edited as Maya, so that merging them back to USD only "
+    "merges the prims of the nodes that changed since the edit.");
+
 PrimUpdaterManager::PrimUpdaterManager()
 #ifdef HAS_ORPHANED_NODES_MANAGER
     : _orphanedNodesManager(std::make_shared<OrphanedNodesManager>())
@@ -890,6 +1052,16 @@ PrimUpdaterManager::PrimUpdaterManager()
     TfWeakPtr<PrimUpdaterManager> me(this);
     TfNotice::Register(me, &PrimUpdaterManager::onProxyContentChanged);
 
+    // The pulled paths are reloaded from the pull information of the new scene.
+    MStatus                status;
+    MSceneMessage::Message msgs[]
+        = { MSceneMessage::kAfterNew, MSceneMessage::kAfterOpen, MSceneMessage::kAfterImport };
+    for (auto msg : msgs) {
+        _pulledPathsCbs.append(
+            MSceneMessage::addCallback(msg, resetPulledPathsCallback, nullptr, &status));
+        CHECK_MSTATUS(status);
+    }
+
 #ifdef HAS_ORPHANED_NODES_MANAGER
     beginLoadSaveCallbacks();
 #endif
@@ -897,6 +1069,8 @@ PrimUpdaterManager::PrimUpdaterManager()
 
 PrimUpdaterManager::~PrimUpdaterManager()
 {
+    MMessage::removeCallbacks(_pulledPathsCbs);
+
 #ifdef HAS_ORPHANED_NODES_MANAGER
     endLoadSaveCallbacks();
     endManagePulledPrims();
@@ -908,6 +1082,9 @@ bool PrimUpdaterManager::mergeToUsd(
     const Ufe::Path&         pulledPath,
     const VtDictionary&      userArgs)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::primUpdaterCategory, MProfiler::kColorE_L1, "Merge to USD");
+
     MayaUsdProxyShapeBase* proxyShape = MayaUsd::ufe::getProxyShape(pulledPath);
     if (!proxyShape) {
         return false;
@@ -919,10 +1096,12 @@ bool PrimUpdaterManager::mergeToUsd(
     }
 
     // Are we doing a merge or cache?
-    MString progStr(
-        VtDictionaryIsHolding<std::string>(userArgs, "rn_primName") ? "Caching to USD"
-                                                                    : "Merging to USD");
-    MayaUsd::ProgressBarScope progressBar(10, progStr);
+    const bool isCache = VtDictionaryIsHolding<std::string>(userArgs, "rn_primName");
+    MString    progStr(isCache ? "Caching to USD" : "Merging to USD");
+
+    // The merge can be cancelled: it then fails and the merge command undoes
+    // the partial edits.
+    MayaUsd::ProgressBarScope progressBar(true, true /* interruptible */, 10, progStr);
     PushPullScope             scopeIt(_inPushPull);
 
     auto ctxArgs = VtDictionaryOver(userArgs, UsdMayaJobExportArgs::GetDefaultDictionary());
@@ -932,6 +1111,15 @@ bool PrimUpdaterManager::mergeToUsd(
     auto       mayaDagPath = MayaUsd::ufe::ufeToDagPath(mayaPath);
     MDagPath   pullParentPath;
     const bool isCopy = updaterArgs._copyOperation;
+
+    // Get the pulled nodes unchanged since the edit as Maya before unlocking
+    // them.  A cache writes all the prims to a new destination, so it can't
+    // skip any.
+    UsdMayaUtil::MDagPathSet cleanDagPaths;
+    const bool               isIncremental = !isCopy && !isCache
+        && UsdMaya_PullDirtyTracker::GetCleanDagPaths(pulledPath, &cleanDagPaths);
+    UsdMaya_PullDirtyTracker::Forget(pulledPath);
+
     if (!isCopy) {
         // The pull parent is simply the parent of the pulled path.
         pullParentPath = MayaUsd::ufe::ufeToDagPath(mayaPath.pop());
@@ -990,9 +1178,21 @@ bool PrimUpdaterManager::mergeToUsd(
     //    per-prim customization.
 
     // 1) Perform the export to the temporary layer.
-    auto pushCustomizeSrc = pushExport(pulledPath, depNodeFn.object(), context);
+    SdfPathSet cleanSrcPaths;
+    auto       pushCustomizeSrc = pushExport(
+        pulledPath,
+        depNodeFn.object(),
+        context,
+        isIncremental ? &cleanDagPaths : nullptr,
+        &cleanSrcPaths);
     progressBar.advance();
 
+    // An interrupted export stops at the current frame, don't merge it.
+    if (progressBar.isInterruptRequested()) {
+        TF_WARN("%s cancelled.", progStr.asChar());
+        return false;
+    }
+
     // 2) Traverse the in-memory layer, creating a prim updater for each prim,
     // and call Push for each updater.  Build a new context with the USD path
     // to Maya path mapping information.
@@ -1016,7 +1216,7 @@ bool PrimUpdaterManager::mergeToUsd(
     }
     progressBar.advance();
 
-    if (!pushCustomize(pulledPath, pushCustomizeSrc, customizeContext)) {
+    if (!pushCustomize(pulledPath, pushCustomizeSrc, customizeContext, cleanSrcPaths)) {
         return false;
     }
     progressBar.advance();
@@ -1083,6 +1283,58 @@ bool PrimUpdaterManager::editAsMaya(const Ufe::Path& path, const VtDictionary& u
         return false;
     }
 
+    return editPrimAsMaya(path, userArgs);
+}
+
+bool PrimUpdaterManager::editAsMaya(
+    const std::vector<Ufe::Path>& paths,
+    const VtDictionary&           userArgs)
+{
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::primUpdaterCategory, MProfiler::kColorE_L1, "Edit as Maya");
+
+    // Read the pull information once for the whole batch.  Each prim edited
+    // as Maya joins the edited prims, so the prims of the batch are checked
+    // against each other as well.
+    const std::vector<Ufe::Path> editedPaths = getEditedPaths();
+    for (size_t i = 0; i < paths.size(); ++i) {
+        bool hasEditedBatchDescendant = false;
+        for (size_t j = 0; j < paths.size() && !hasEditedBatchDescendant; ++j) {
+            hasEditedBatchDescendant = (i != j) && paths[j].startsWith(paths[i]);
+        }
+        if (hasEditedBatchDescendant || hasEditedDescendant(paths[i], editedPaths)) {
+            TF_WARN("Cannot edit an ancestor of an already edited node.");
+            return false;
+        }
+    }
+
+    MayaUsd::ProgressBarScope progressBar(paths.size() + 1, "Converting to Maya Data");
+
+    Ufe::Selection pulledItems;
+    for (const Ufe::Path& path : paths) {
+        if (!editPrimAsMaya(path, userArgs)) {
+            return false;
+        }
+
+        auto ufeItem = Ufe::Hierarchy::createItem(usdToMaya(path));
+        if (ufeItem) {
+            pulledItems.append(ufeItem);
+        }
+        progressBar.advance();
+    }
+
+    // Each edit selects its pulled node, select them all instead.
+    if (!UfeSelectionUndoItem::select("Edit as Maya batch selection", pulledItems)) {
+        TF_WARN("Cannot select the pulled nodes.");
+        return false;
+    }
+    progressBar.advance();
+
+    return true;
+}
+
+bool PrimUpdaterManager::editPrimAsMaya(const Ufe::Path& path, const VtDictionary& userArgs)
+{
     MayaUsdProxyShapeBase* proxyShape = MayaUsd::ufe::getProxyShape(path);
     if (!proxyShape) {
         return false;
@@ -1149,6 +1401,12 @@ bool PrimUpdaterManager::editAsMaya(const Ufe::Path& path, const VtDictionary& u
         // Allow editing topology, which gets turned of by locking.
         if (!allowTopologyModifications(pullParentPath))
             return false;
+
+        // Start tracking once the nodes are set up, so that only the user
+        // edits dirty them.
+        if (TfGetEnvSetting(MAYAUSD_INCREMENTAL_MERGE_TO_USD)) {
+            UsdMaya_PullDirtyTracker::Track(path, MayaUsd::ufe::ufeToDagPath(usdToMaya(path)));
+        }
     }
     progressBar.advance();
 
@@ -1187,6 +1445,9 @@ bool PrimUpdaterManager::canEditAsMaya(const Ufe::Path& path) const
 
 bool PrimUpdaterManager::discardEdits(const MDagPath& dagPath)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::primUpdaterCategory, MProfiler::kColorE_L1, "Discard edits");
+
     Ufe::Path pulledPath;
     if (!readPullInformation(dagPath, pulledPath))
         return false;
@@ -1221,6 +1482,8 @@ bool PrimUpdaterManager::discardPrimEdits(const Ufe::Path& pulledPath)
     MayaUsd::ProgressBarScope progressBar(5);
     PushPullScope             scopeIt(_inPushPull);
 
+    UsdMaya_PullDirtyTracker::Forget(pulledPath);
+
     // Record all USD modifications in an undo block and item.
     UsdUndoBlock undoBlock(
         &UsdUndoableItemUndoItem::create("Discard edits USD data modifications"));
@@ -1318,6 +1581,8 @@ bool PrimUpdaterManager::discardOrphanedEdits(const MDagPath& dagPath, const Ufe
     MayaUsd::ProgressBarScope progressBar(2);
     PushPullScope             scopeIt(_inPushPull);
 
+    UsdMaya_PullDirtyTracker::Forget(pulledPath);
+
     // Unlock the pulled hierarchy, clear the pull information, and remove the
     // pull parent, which is simply the parent of the pulled path.
     auto pullParent = dagPath;
@@ -1389,6 +1654,9 @@ bool PrimUpdaterManager::duplicate(
     const Ufe::Path&    dstPath,
     const VtDictionary& userArgs)
 {
+    MayaUsd::ProfilingScope profilingScope(
+        MayaUsd::ProfilingScope::primUpdaterCategory, MProfiler::kColorE_L1, "Duplicate");
+
     MayaUsdProxyShapeBase* srcProxyShape = MayaUsd::ufe::getProxyShape(srcPath);
     MayaUsdProxyShapeBase* dstProxyShape = MayaUsd::ufe::getProxyShape(dstPath);
 
@@ -1547,7 +1815,17 @@ void PrimUpdaterManager::onProxyContentChanged(
     VtDictionary              userArgs;
     UsdMayaPrimUpdaterContext context(UsdTimeCode::Default(), stage, userArgs);
 
-    for (const auto& changedPath : notice.GetResyncedPaths()) {
+    // The changed paths are sorted, so the descendants of a path follow it.
+    const UsdMayaChangedPathIndex& changedPaths = proxyNotice.GetChangedPathIndex();
+
+    SdfPath visitedPath;
+    for (const auto& changedPath : changedPaths.GetResyncedPaths()) {
+        // The subtree of the previous resynced path contains this one.
+        if (!visitedPath.IsEmpty() && changedPath.HasPrefix(visitedPath)) {
+            continue;
+        }
+        visitedPath = changedPath;
+
         UsdPrim resyncPrim = (changedPath != SdfPath::AbsoluteRootPath())
             ? stage->GetPrimAtPath(changedPath)
             : stage->GetPseudoRoot();
@@ -1562,12 +1840,12 @@ void PrimUpdaterManager::onProxyContentChanged(
         }
     }
 
-    auto changedInfoOnlyPaths = notice.GetChangedInfoOnlyPaths();
-    for (auto it = changedInfoOnlyPaths.begin(), end = changedInfoOnlyPaths.end(); it != end;
-         ++it) {
-        const auto& changedPath = *it;
-        if (changedPath.IsPrimPropertyPath()) {
-            UsdPrim valueChangedPrim = stage->GetPrimAtPath(changedPath.GetPrimPath());
+    SdfPath valueChangedPrimPath;
+    for (const auto& changedPath : changedPaths.GetChangedInfoOnlyPaths()) {
+        // Visit each prim once, for its first changed property.
+        if (changedPath.IsPrimPropertyPath() && changedPath.GetPrimPath() != valueChangedPrimPath) {
+            valueChangedPrimPath = changedPath.GetPrimPath();
+            UsdPrim valueChangedPrim = stage->GetPrimAtPath(valueChangedPrimPath);
             if (valueChangedPrim) {
                 autoEditFn(context, valueChangedPrim);
             }
@@ -1741,6 +2019,11 @@ MDagPath PrimUpdaterManager::setupPullParent(const Ufe::Path& pulledPath, VtDict
     return pullParentPath;
 }
 
+bool PrimUpdaterManager::findPulledPath(const MDagPath& dagPath, Ufe::Path& pulledPath) const
+{
+    return PulledPathsTracker::instance().find(dagPath, pulledPath);
+}
+
 bool PrimUpdaterManager::hasPulledPrims() const
 {
     MObject pullRoot = findPullRoot();
@@ -1831,7 +2114,8 @@ void PrimUpdaterManager::loadOrphanedNodesManagerData()
     if (!getDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName, json))
         return;
 
-    _orphanedNodesManager->restore(OrphanedNodesManager::Memento::convertFromJson(json.asChar()));
+    // The pull information is only parsed when first needed.
+    _orphanedNodesManager->restoreFromJson(json.asChar());
 }
 
 void PrimUpdaterManager::saveOrphanedNodesManagerData()
@@ -1840,8 +2124,7 @@ void PrimUpdaterManager::saveOrphanedNodesManagerData()
     if (pullRoot.isNull())
         return;
 
-    OrphanedNodesManager::Memento memento = _orphanedNodesManager->preserve();
-    const std::string             json = OrphanedNodesManager::Memento::convertToJson(memento);
+    const std::string json = _orphanedNodesManager->toJson();
 
     MFnDependencyNode pullRootDepNode(pullRoot);
     MStatus           status
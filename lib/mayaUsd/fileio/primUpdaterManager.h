@@ -28,6 +28,8 @@
 
 #include <maya/MCallbackIdArray.h>
 
+#include <vector>
+
 UFE_NS_DEF { class Path; }
 
 #ifdef HAS_ORPHANED_NODES_MANAGER
@@ -53,6 +55,15 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool editAsMaya(const Ufe::Path& path, const VtDictionary& userArgs = VtDictionary());
 
+    // Edit all the prims at the argument paths as Maya.  The pull information
+    // of the already edited prims is read once for the whole batch, and the
+    // pulled Maya nodes are selected together.  Undo items are recorded in
+    // the current undo item list, like for a single prim.
+    MAYAUSD_CORE_PUBLIC
+    bool editAsMaya(
+        const std::vector<Ufe::Path>& paths,
+        const VtDictionary&           userArgs = VtDictionary());
+
     // Can the prim at the argument path be edited as Maya.
     MAYAUSD_CORE_PUBLIC
     bool canEditAsMaya(const Ufe::Path& path) const;
@@ -72,12 +83,19 @@ public:
 
     bool hasPulledPrims() const;
 
+    // Get the USD path pulled into the Maya node.  Unlike readPullInformation(),
+    // this does not read the node attributes: the pulled paths are tracked on
+    // pull, push and discard.
+    MAYAUSD_CORE_PUBLIC
+    bool findPulledPath(const MDagPath& dagPath, Ufe::Path& pulledPath) const;
+
 private:
     PrimUpdaterManager();
 
     PrimUpdaterManager(PrimUpdaterManager&) = delete;
     PrimUpdaterManager(PrimUpdaterManager&&) = delete;
 
+    bool editPrimAsMaya(const Ufe::Path& path, const VtDictionary& userArgs);
     bool discardPrimEdits(const Ufe::Path& pulledPath);
     bool discardOrphanedEdits(const MDagPath& dagPath, const Ufe::Path& pulledPath);
     void discardPullSetIfEmpty();
@@ -126,6 +144,9 @@ private:
 
     bool _inPushPull { false };
 
+    // Scene callbacks to reload the pulled paths.
+    MCallbackIdArray _pulledPathsCbs;
+
     // Orphaned nodes manager that observes the scene, to determine when to hide
     // pulled prims that have become orphaned, or to show them again, because
     // of structural changes to their USD or Maya ancestors.
@@ -40,6 +40,7 @@
 #include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MObject.h>
+#include <maya/MPlug.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 
@@ -82,6 +83,9 @@ UsdMayaPrimWriter::UsdMayaPrimWriter(
 {
 }
 
+/* virtual */
+UsdMayaPrimWriterBatch::~UsdMayaPrimWriterBatch() { }
+
 /* virtual */
 UsdMayaPrimWriter::~UsdMayaPrimWriter() { }
 
@@ -218,6 +222,45 @@ bool UsdMayaPrimWriter::ExportsGprims() const { return false; }
 /* virtual */
 bool UsdMayaPrimWriter::ShouldPruneChildren() const { return false; }
 
+/* virtual */
+bool UsdMayaPrimWriter::IsAnimated() const { return true; }
+
+bool UsdMayaPrimWriter::IsVisibilityAnimated() const
+{
+    // Same conditions as the visibility written by Write().
+    if (!_exportVisibility || _IsMergedTransform() || !UsdGeomImageable(_usdPrim)) {
+        return false;
+    }
+
+    const MFnDependencyNode depNodeFn(GetMayaObject());
+    MPlug                   visibilityPlug = depNodeFn.findPlug("visibility", true);
+    if (!visibilityPlug.isNull() && UsdMayaUtil::isPlugAnimated(visibilityPlug)) {
+        return true;
+    }
+
+    if (_IsMergedShape()) {
+        MDagPath parentDagPath = GetDagPath();
+        parentDagPath.pop();
+        const MFnDependencyNode parentDepNodeFn(parentDagPath.node());
+
+        MPlug parentVisibilityPlug = parentDepNodeFn.findPlug("visibility", true);
+        if (!parentVisibilityPlug.isNull() && UsdMayaUtil::isPlugAnimated(parentVisibilityPlug)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* virtual */
+UsdMayaPrimWriterBatchSharedPtr UsdMayaPrimWriter::GetFrameBatch() const { return nullptr; }
+
+/* virtual */
+void UsdMayaPrimWriter::EvaluateFrame(const UsdTimeCode& /* usdTime */) { }
+
+/* virtual */
+void UsdMayaPrimWriter::PrefetchFrame(const UsdTimeCode& /* usdTime */) { }
+
 /* virtual */
 void UsdMayaPrimWriter::PostExport() { MakeSingleSamplesStatic(); }
 
@@ -257,6 +300,8 @@ const UsdMayaJobExportArgs& UsdMayaPrimWriter::_GetExportArgs() const
 
 UsdUtilsSparseValueWriter* UsdMayaPrimWriter::_GetSparseValueWriter() { return &_valueWriter; }
 
+void UsdMayaPrimWriter::ResetSparseValueWriter() { _valueWriter = UsdUtilsSparseValueWriter(); }
+
 void UsdMayaPrimWriter::MakeSingleSamplesStatic()
 {
     auto exportArgs = _GetExportArgs();
@@ -35,11 +35,31 @@
 #include <maya/MObject.h>
 
 #include <memory>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class UsdMayaPrimWriter;
 class UsdMayaWriteJobContext;
 
+/// Writes the time samples of several prim writers in a single call, for prim
+/// writers which are expensive to call one at a time, such as the ones
+/// implemented in Python.
+class UsdMayaPrimWriterBatch
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    virtual ~UsdMayaPrimWriterBatch();
+
+    /// Writes the prims of all the \p primWriters at the animated time
+    /// \p usdTime, in place of calling their Write() one by one.
+    virtual void
+    Write(const std::vector<UsdMayaPrimWriter*>& primWriters, const UsdTimeCode& usdTime)
+        = 0;
+};
+
+typedef std::shared_ptr<UsdMayaPrimWriterBatch> UsdMayaPrimWriterBatchSharedPtr;
+
 /// Base class for all built-in and user-defined prim writers. Translates Maya
 /// node data into USD prim(s).
 ///
@@ -75,6 +95,62 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual void Write(const UsdTimeCode& usdTime);
 
+    /// Whether the prim written by this prim writer can vary over time.
+    /// The write job only calls Write() at the animated time samples for the
+    /// prim writers returning \c true. It is called once Write() was called
+    /// at the default time.
+    ///
+    /// Base implementation returns \c true; prim writers which only author
+    /// time samples when their Maya nodes are animated should override.
+    /// Overrides don't need to account for the visibility written by the base
+    /// Write(), see IsVisibilityAnimated().
+    MAYAUSD_CORE_PUBLIC
+    virtual bool IsAnimated() const;
+
+    /// Whether the visibility written by the base Write() is animated. For
+    /// the shape of a merged shape and transform, this includes the
+    /// visibility of the parent transform. The write job calls Write() at the
+    /// animated time samples when either this or IsAnimated() is \c true.
+    MAYAUSD_CORE_PUBLIC
+    bool IsVisibilityAnimated() const;
+
+    /// The batch writing the animated time samples of this prim writer
+    /// together with the other prim writers of the same batch. The write job
+    /// calls the batch once per time sample instead of calling Write() on
+    /// each of them. Write() is still called at the default time.
+    ///
+    /// Base implementation returns null, Write() is called at each time
+    /// sample.
+    MAYAUSD_CORE_PUBLIC
+    virtual UsdMayaPrimWriterBatchSharedPtr GetFrameBatch() const;
+
+    /// Evaluates the Maya data read by PrefetchFrame() for the frame at
+    /// \p usdTime. When parallel frame reads are enabled, it is called on the
+    /// main thread for all the prim writers, before PrefetchFrame().
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void EvaluateFrame(const UsdTimeCode& usdTime);
+
+    /// Optional gather phase of Write(), reading the Maya data of the frame
+    /// at \p usdTime ahead of the Write() call for that time.
+    /// When parallel frame reads are enabled, it is called from worker
+    /// threads for all the prim writers once the frame is evaluated, so it
+    /// must only read Maya data and build values, without touching the USD
+    /// stage. Write() then authors the gathered values serially.
+    /// The dependency graph can't be evaluated from worker threads: the data
+    /// read must have been evaluated by EvaluateFrame().
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void PrefetchFrame(const UsdTimeCode& usdTime);
+
+    /// Forgets the values written so far, so the next values are written
+    /// even if they are the same as the previous ones. Used when the time
+    /// samples start being written to another layer.
+    MAYAUSD_CORE_PUBLIC
+    void ResetSparseValueWriter();
+
     /// Post export function that runs before saving the stage.
     ///
     /// Base implementation handles optional optimization of data.
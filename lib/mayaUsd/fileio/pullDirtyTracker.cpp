@@ -0,0 +1,194 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "pullDirtyTracker.h"
+
+#include <maya/MCallbackIdArray.h>
+#include <maya/MDagMessage.h>
+#include <maya/MItDag.h>
+#include <maya/MMessage.h>
+#include <maya/MNodeMessage.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
+#include <maya/MSceneMessage.h>
+#include <ufe/pathString.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+struct _MObjectHandleComp
+{
+    bool operator()(const MObjectHandle& lhs, const MObjectHandle& rhs) const
+    {
+        return lhs.hashCode() < rhs.hashCode();
+    }
+};
+
+// Record of the Maya nodes pulled by an edit as Maya.
+struct _TrackedPull
+{
+    ~_TrackedPull() { MMessage::removeCallbacks(callbackIds); }
+
+    std::vector<MDagPath> dagPaths;
+
+    // Dirty flag of each pulled node. The node callbacks point to the values,
+    // which don't move when other nodes are inserted.
+    std::map<MObjectHandle, bool, _MObjectHandleComp> dirtyNodes;
+
+    // Set when the pulled hierarchy changed in a way which changes the
+    // exported prims.
+    bool structureChanged = false;
+
+    MCallbackIdArray callbackIds;
+};
+
+std::map<std::string, std::unique_ptr<_TrackedPull>> _trackedPulls;
+
+MCallbackIdArray _sceneCallbackIds;
+
+std::string _GetPullKey(const Ufe::Path& pulledPath) { return Ufe::PathString::string(pulledPath); }
+
+void _SetNodeDirty(MObject&, void* clientData) { *static_cast<bool*>(clientData) = true; }
+
+void _SetAttributeDirty(MNodeMessage::AttributeMessage, MPlug&, MPlug&, void* clientData)
+{
+    *static_cast<bool*>(clientData) = true;
+}
+
+void _SetNodeRenamed(MObject&, const MString&, void* clientData)
+{
+    static_cast<_TrackedPull*>(clientData)->structureChanged = true;
+}
+
+void _SetDagChanged(MDagPath&, MDagPath& parent, void* clientData)
+{
+    // Only the children added to or removed from the pulled nodes matter.
+    auto* trackedPull = static_cast<_TrackedPull*>(clientData);
+    if (parent.isValid() && trackedPull->dirtyNodes.count(MObjectHandle(parent.node())) > 0) {
+        trackedPull->structureChanged = true;
+    }
+}
+
+void _ForgetTrackedPulls(void*) { _trackedPulls.clear(); }
+
+void _RegisterSceneCallbacks()
+{
+    if (_sceneCallbackIds.length() > 0) {
+        return;
+    }
+
+    // The recorded nodes are gone once another scene is loaded.
+    _sceneCallbackIds.append(
+        MSceneMessage::addCallback(MSceneMessage::kBeforeNew, _ForgetTrackedPulls));
+    _sceneCallbackIds.append(
+        MSceneMessage::addCallback(MSceneMessage::kBeforeOpen, _ForgetTrackedPulls));
+}
+
+} // namespace
+
+/* static */
+bool UsdMaya_PullDirtyTracker::GetCleanDagPaths(
+    const Ufe::Path&          pulledPath,
+    UsdMayaUtil::MDagPathSet* cleanDagPaths)
+{
+    const auto it = _trackedPulls.find(_GetPullKey(pulledPath));
+    if (it == _trackedPulls.end() || !cleanDagPaths) {
+        return false;
+    }
+
+    const _TrackedPull& trackedPull = *it->second;
+    if (trackedPull.structureChanged) {
+        return false;
+    }
+
+    cleanDagPaths->clear();
+
+    for (const MDagPath& dagPath : trackedPull.dagPaths) {
+        // Deleted nodes are normally reported as DAG changes, this also
+        // catches the ones deleted while the callbacks were not called.
+        if (!dagPath.isValid()) {
+            return false;
+        }
+
+        const auto nodeIt = trackedPull.dirtyNodes.find(MObjectHandle(dagPath.node()));
+        if (nodeIt != trackedPull.dirtyNodes.end() && !nodeIt->second) {
+            cleanDagPaths->insert(dagPath);
+        }
+    }
+
+    return true;
+}
+
+/* static */
+void UsdMaya_PullDirtyTracker::Track(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot)
+{
+    if (!editedAsMayaRoot.isValid()) {
+        return;
+    }
+
+    _RegisterSceneCallbacks();
+
+    std::unique_ptr<_TrackedPull> trackedPull(new _TrackedPull);
+
+    // Added, deleted and reparented DAG nodes are all reported as DAG changes.
+    trackedPull->callbackIds.append(
+        MDagMessage::addAllDagChangesCallback(_SetDagChanged, trackedPull.get()));
+
+    MItDag dagIt(MItDag::kDepthFirst);
+    dagIt.reset(editedAsMayaRoot);
+    for (; !dagIt.isDone(); dagIt.next()) {
+        MDagPath dagPath;
+        dagIt.getPath(dagPath);
+        trackedPull->dagPaths.push_back(dagPath);
+
+        MObject    node = dagPath.node();
+        const auto inserted = trackedPull->dirtyNodes.emplace(MObjectHandle(node), false);
+        if (!inserted.second) {
+            continue;
+        }
+
+        // Attribute edits without dependents don't dirty the node.
+        bool* dirtyFlag = &inserted.first->second;
+        trackedPull->callbackIds.append(
+            MNodeMessage::addNodeDirtyCallback(node, _SetNodeDirty, dirtyFlag));
+        trackedPull->callbackIds.append(
+            MNodeMessage::addAttributeChangedCallback(node, _SetAttributeDirty, dirtyFlag));
+        trackedPull->callbackIds.append(
+            MNodeMessage::addNameChangedCallback(node, _SetNodeRenamed, trackedPull.get()));
+    }
+
+    _trackedPulls[_GetPullKey(pulledPath)] = std::move(trackedPull);
+}
+
+/* static */
+void UsdMaya_PullDirtyTracker::Forget(const Ufe::Path& pulledPath)
+{
+    _trackedPulls.erase(_GetPullKey(pulledPath));
+}
+
+/* static */
+void UsdMaya_PullDirtyTracker::ForgetAll()
+{
+    _trackedPulls.clear();
+    MMessage::removeCallbacks(_sceneCallbackIds);
+    _sceneCallbackIds.clear();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,64 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_PULL_DIRTY_TRACKER_H
+#define PXRUSDMAYA_PULL_DIRTY_TRACKER_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/pxr.h>
+
+#include <maya/MDagPath.h>
+#include <ufe/path.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// This class records, for each prim edited as Maya, which of the pulled Maya
+/// nodes were dirtied since the edit, through Maya node messages. The merge
+/// to USD of the prim then only merges the prims of the changed nodes back
+/// into the stage.
+///
+/// Structural changes of the pulled hierarchy (added, removed, renamed or
+/// reparented DAG nodes) change the exported prims, so they invalidate the
+/// record and the next merge is a full one.
+class UsdMaya_PullDirtyTracker
+{
+public:
+    /// Returns true and fills \p cleanDagPaths with the pulled nodes which
+    /// did not change since \p pulledPath was edited as Maya, if it is tracked
+    /// and its hierarchy did not change structurally since.
+    MAYAUSD_CORE_PUBLIC
+    static bool
+    GetCleanDagPaths(const Ufe::Path& pulledPath, UsdMayaUtil::MDagPathSet* cleanDagPaths);
+
+    /// Starts tracking the changes of the Maya nodes of the hierarchy rooted
+    /// at \p editedAsMayaRoot, pulled from \p pulledPath.
+    MAYAUSD_CORE_PUBLIC
+    static void Track(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot);
+
+    /// Stops tracking \p pulledPath, its next merge is a full one.
+    MAYAUSD_CORE_PUBLIC
+    static void Forget(const Ufe::Path& pulledPath);
+
+    /// Stops tracking all the pulled prims and removes the Maya callbacks.
+    /// Must be called before the plugin is unloaded.
+    MAYAUSD_CORE_PUBLIC
+    static void ForgetAll();
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -21,6 +21,7 @@
 #include <mayaUsd/fileio/translators/translatorUtil.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
+#include <mayaUsd/utils/converter.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/base/tf/diagnostic.h>
@@ -43,10 +44,9 @@
 #include <maya/MCommandResult.h>
 #include <maya/MDGContext.h>
 #include <maya/MDagPath.h>
-#include <maya/MDagPathArray.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
-#include <maya/MFnSet.h>
+#include <maya/MFnSingleIndexedComponent.h>
 #include <maya/MGlobal.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MNamespace.h>
@@ -221,84 +221,121 @@ MObject UsdMayaShadingModeExportContext::GetDisplacementShader() const
     return _GetShaderFromShadingEngine(_shadingEngine, _displacementShaderPlugName);
 }
 
-UsdMayaShadingModeExportContext::AssignmentVector
-UsdMayaShadingModeExportContext::GetAssignments() const
+std::string UsdMayaShadingModeExportContext::_GetShadersKey() const
 {
-    AssignmentVector ret;
+    std::string key;
+    for (const MPlug& shaderPlug :
+         { GetSurfaceShaderPlug(), GetVolumeShaderPlug(), GetDisplacementShaderPlug() }) {
+        const MPlug sourcePlug
+            = shaderPlug.isNull() ? MPlug() : UsdMayaUtil::GetConnected(shaderPlug);
+        if (!sourcePlug.isNull()) {
+            key += sourcePlug.name().asChar();
+        }
+        // Separates the plugs, so a surface shader doesn't match the same
+        // node used as a volume shader.
+        key += ';';
+    }
+    return key.size() > 3 ? key : std::string();
+}
 
-    MStatus           status;
-    MFnDependencyNode seDepNode(_shadingEngine, &status);
-    if (!status) {
-        return ret;
+SdfPath UsdMayaShadingModeExportContext::GetMaterialExportedForSameShaders() const
+{
+    const std::string key = _GetShadersKey();
+    if (key.empty()) {
+        return SdfPath();
     }
 
-#if MAYA_HAS_GET_MEMBER_PATHS
-    MFnSet fnSet(_shadingEngine, &status);
-    if (!status) {
-        return ret;
+    const auto it = _shadersMaterials.find(key);
+    return it != _shadersMaterials.end() ? it->second : SdfPath();
+}
+
+void UsdMayaShadingModeExportContext::SetMaterialExportedForShaders(
+    const SdfPath& materialPath) const
+{
+    const std::string key = _GetShadersKey();
+    if (!key.empty()) {
+        _shadersMaterials.emplace(key, materialPath);
     }
+}
 
-    // Get all the dagPaths using this shadingEngine...
-    MDagPathArray dagPaths;
-    fnSet.getMemberPaths(dagPaths, true); // get all the dagPath related to shading
-    SdfPathSet seenBoundPrimPaths;
+namespace {
 
-    for (auto& dagPath : dagPaths) {
-        unsigned int instanceNumber = dagPath.instanceNumber();
-#else
-    // Maya 2022 and older use this version
-    MPlug dsmPlug = seDepNode.findPlug("dagSetMembers", true, &status);
-    if (!status) {
-        return ret;
+VtIntArray getFaceIndices(const MDagPath& dagPath, const MObject& component)
+{
+    VtIntArray faceIndices;
+    if (component.isNull()) {
+        return faceIndices;
     }
 
-    SdfPathSet seenBoundPrimPaths;
-    for (unsigned int i = 0; i < dsmPlug.numConnectedElements(); i++) {
-        MPlug dsmElemPlug(dsmPlug.connectionByPhysicalIndex(i));
-        MPlug connectedPlug = UsdMayaUtil::GetConnected(dsmElemPlug);
-
-        // Maya connects shader bindings for instances based on element indices
-        // of the instObjGroups[x] or instObjGroups[x].objectGroups[y] plugs.
-        // The instance number is the index of instObjGroups[x]; the face set
-        // (if any) is the index of objectGroups[y].
-        if (connectedPlug.isElement() && connectedPlug.array().isChild()) {
-            // connectedPlug is instObjGroups[x].objectGroups[y] (or its
-            // equivalent), so go up two levels to get to instObjGroups[x].
-            MPlug objectGroups = connectedPlug.array();
-            MPlug instObjGroupsElem = objectGroups.parent();
-            connectedPlug = instObjGroupsElem;
-        }
-        // connectedPlug should be instObjGroups[x] here. Get the index.
-        unsigned int instanceNumber = connectedPlug.logicalIndex();
-
-        // Get the correct DAG path for this instance number.
-        MDagPathArray allDagPaths;
-        MDagPath::getAllPathsTo(connectedPlug.node(), allDagPaths);
-        if (instanceNumber >= allDagPaths.length()) {
-            TF_RUNTIME_ERROR(
-                "Instance number is %d (from plug '%s') but node only has "
-                "%d paths",
-                instanceNumber,
-                connectedPlug.name().asChar(),
-                allDagPaths.length());
+    if (component.hasFn(MFn::kMeshPolygonComponent)) {
+        MFnSingleIndexedComponent faceComponent(component);
+        MIntArray                 faces;
+        faceComponent.getElements(faces);
+        MayaUsd::TypedConverter<MIntArray, VtIntArray>::convert(faces, faceIndices);
+        return faceIndices;
+    }
+
+    MItMeshPolygon faceIt(dagPath, component);
+    faceIndices.reserve(faceIt.count());
+    for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
+        faceIndices.push_back(faceIt.index());
+    }
+    return faceIndices;
+}
+
+} // namespace
+
+void UsdMayaShadingModeExportContext::_BuildShadingEngineMembers() const
+{
+    _shadingEngineMembersBuilt = true;
+
+    for (const auto& dagPathAndUsdPath : _dagPathToUsdMap) {
+        const MDagPath& dagPath = dagPathAndUsdPath.first;
+
+        // Shading engines are assigned to shapes.
+        if (!dagPath.node().hasFn(MFn::kShape)) {
             continue;
         }
 
-        MDagPath dagPath = allDagPaths[instanceNumber];
-        TF_VERIFY(dagPath.instanceNumber() == instanceNumber);
-#endif
-
+        MStatus    status;
         MFnDagNode dagNode(dagPath, &status);
         if (!status) {
             continue;
         }
 
-        auto iter = _dagPathToUsdMap.find(dagPath);
-        if (iter == _dagPathToUsdMap.end()) {
-            // Geometry w/ this material bound doesn't seem to exist in USD.
+        MObjectArray sgObjs;
+        MObjectArray compObjs;
+        status
+            = dagNode.getConnectedSetsAndMembers(dagPath.instanceNumber(), sgObjs, compObjs, true);
+        if (status != MS::kSuccess) {
             continue;
         }
-        SdfPath usdPath = iter->second;
+
+        const TfToken shapeName(dagNode.name().asChar());
+        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+            _shadingEngineMembers[MObjectHandle(sgObjs[j])].push_back(_ShadingEngineMember {
+                dagPathAndUsdPath.second, getFaceIndices(dagPath, compObjs[j]), shapeName });
+        }
+    }
+}
+
+UsdMayaShadingModeExportContext::AssignmentVector
+UsdMayaShadingModeExportContext::GetAssignments() const
+{
+    AssignmentVector ret;
+
+    if (!_shadingEngineMembersBuilt) {
+        _BuildShadingEngineMembers();
+    }
+
+    const auto membersIt = _shadingEngineMembers.find(MObjectHandle(_shadingEngine));
+    if (membersIt == _shadingEngineMembers.end()) {
+        return ret;
+    }
+
+    SdfPathSet seenBoundPrimPaths;
+    for (const _ShadingEngineMember& member : membersIt->second) {
+        SdfPath usdPath = member.usdPath;
 
         // If usdModelRootOverridePath is not empty, replace the
         // root namespace with it.
@@ -317,28 +354,7 @@ UsdMayaShadingModeExportContext::GetAssignments() const
             continue;
         }
 
-        MObjectArray sgObjs, compObjs;
-        status = dagNode.getConnectedSetsAndMembers(instanceNumber, sgObjs, compObjs, true);
-        if (status != MS::kSuccess) {
-            continue;
-        }
-
-        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
-            // If the shading group isn't the one we're interested in, skip it.
-            if (sgObjs[j] != _shadingEngine) {
-                continue;
-            }
-
-            VtIntArray faceIndices;
-            if (!compObjs[j].isNull()) {
-                MItMeshPolygon faceIt(dagPath, compObjs[j]);
-                faceIndices.reserve(faceIt.count());
-                for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
-                    faceIndices.push_back(faceIt.index());
-                }
-            }
-            ret.push_back(Assignment { usdPath, faceIndices, TfToken(dagNode.name().asChar()) });
-        }
+        ret.push_back(Assignment { usdPath, member.faceIndices, member.shapeName });
     }
     return ret;
 }
@@ -771,19 +787,26 @@ void UsdMayaShadingModeExportContext::BindStandardMaterialPrim(
                 = UsdMayaTranslatorUtil::GetAPISchemaForAuthoring<UsdShadeMaterialBindingAPI>(
                     boundPrim);
 
-            UsdGeomSubset faceSubset;
-
-            // Try to re-use existing subset if any:
-            for (auto subset : bindingAPI.GetMaterialBindSubsets()) {
-                TfToken elementType;
-                if (subset.GetPrim().GetName() == materialNameToken
-                    && subset.GetElementTypeAttr().Get(&elementType)
-                    && elementType == UsdGeomTokens->face) {
-                    faceSubset = subset;
-                    break;
+            // Try to re-use existing subset if any. The subsets of a prim are
+            // gathered once, not for each of the materials bound to its faces.
+            auto subsetsIt = _faceSubsets.find(boundPrimPath);
+            if (subsetsIt == _faceSubsets.end()) {
+                subsetsIt = _faceSubsets.emplace(boundPrimPath, _FaceSubsets()).first;
+                for (auto subset : bindingAPI.GetMaterialBindSubsets()) {
+                    TfToken elementType;
+                    if (subset.GetElementTypeAttr().Get(&elementType)
+                        && elementType == UsdGeomTokens->face) {
+                        subsetsIt->second.emplace(subset.GetPrim().GetName(), subset);
+                    }
                 }
             }
 
+            UsdGeomSubset faceSubset;
+            const auto    subsetIt = subsetsIt->second.find(materialNameToken);
+            if (subsetIt != subsetsIt->second.end()) {
+                faceSubset = subsetIt->second;
+            }
+
             if (faceSubset) {
                 // Update and continue:
                 VtIntArray   mergedIndices;
@@ -800,6 +823,7 @@ void UsdMayaShadingModeExportContext::BindStandardMaterialPrim(
                 /* subsetName */ materialNameToken,
                 faceIndices,
                 /* elementType */ UsdGeomTokens->face);
+            subsetsIt->second.emplace(materialNameToken, faceSubset);
 
             if (!GetExportArgs().exportCollectionBasedBindings) {
                 UsdShadeMaterialBindingAPI subsetBindingAPI
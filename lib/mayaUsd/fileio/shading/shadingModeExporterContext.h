@@ -27,11 +27,14 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/subset.h>
 
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -112,6 +115,18 @@ public:
         const AssignmentVector& assignmentsToBind,
         SdfPathSet* const       boundPrimPaths = nullptr) const;
 
+    /// Returns the path of the material exported for an earlier shading
+    /// engine connected to the same surface, volume and displacement shaders
+    /// as the current one, or an empty path if there is none. The materials
+    /// are cached for all the shading engines exported by the job.
+    MAYAUSD_CORE_PUBLIC
+    SdfPath GetMaterialExportedForSameShaders() const;
+
+    /// Records \p materialPath as the material exported for the shaders of
+    /// the current shading engine.
+    MAYAUSD_CORE_PUBLIC
+    void SetMaterialExportedForShaders(const SdfPath& materialPath) const;
+
     MAYAUSD_CORE_PUBLIC
     UsdMayaShadingModeExportContext(
         const MObject&                           shadingEngine,
@@ -130,6 +145,36 @@ private:
     /// Shaders that are bound to prims under \p _bindableRoot paths will get
     /// exported. If \p bindableRoots is empty, it will export all.
     SdfPathSet _bindableRoots;
+
+    /// Returns the names of the plugs connected to the shader plugs of the
+    /// current shading engine, empty if none is connected.
+    std::string _GetShadersKey() const;
+
+    /// Materials exported for the shaders of the shading engines, by the key
+    /// of their shaders.
+    mutable std::unordered_map<std::string, SdfPath> _shadersMaterials;
+
+    /// A shape assigned to a shading engine, with the assigned faces. The
+    /// faces are empty when the whole shape is assigned.
+    struct _ShadingEngineMember
+    {
+        SdfPath    usdPath;
+        VtIntArray faceIndices;
+        TfToken    shapeName;
+    };
+
+    /// Builds the members of all the shading engines at once, from the sets of
+    /// each exported shape, so that the shapes and their face components are
+    /// queried once for the whole job.
+    void _BuildShadingEngineMembers() const;
+
+    mutable UsdMayaUtil::MObjectHandleUnorderedMap<std::vector<_ShadingEngineMember>>
+                 _shadingEngineMembers;
+    mutable bool _shadingEngineMembersBuilt { false };
+
+    /// Face subsets bound to materials, by bound prim and subset name.
+    using _FaceSubsets = std::unordered_map<TfToken, UsdGeomSubset, TfToken::HashFunctor>;
+    mutable std::unordered_map<SdfPath, _FaceSubsets, SdfPath::Hash> _faceSubsets;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
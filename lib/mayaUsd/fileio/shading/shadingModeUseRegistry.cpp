@@ -13,6 +13,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <mayaUsd/fileio/primReaderContext.h>
+#include <mayaUsd/fileio/primReaderProfiler.h>
 #include <mayaUsd/fileio/primWriter.h>
 #include <mayaUsd/fileio/shaderReader.h>
 #include <mayaUsd/fileio/shaderReaderRegistry.h>
@@ -32,6 +34,7 @@
 #include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/references.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdShade/connectableAPI.h>
 #include <pxr/usd/usdShade/input.h>
@@ -161,16 +164,16 @@ private:
     /// to be the primary shader for the connection represented by
     /// \p rootPlug. That shader prim will be returned so that it can be
     /// connected to the Material prim.
+    ///
+    /// The \p shaderWriterMap is shared by the traversals of the surface,
+    /// volume and displacement networks of the material, so a node used by
+    /// several of them is only authored once.
     UsdShadeShader _ExportShadingDepGraph(
         const SdfPath&                         materialExportPath,
         const MPlug&                           rootPlug,
-        const UsdMayaShadingModeExportContext& context)
+        const UsdMayaShadingModeExportContext& context,
+        _NodeHandleToShaderWriterMap&          shaderWriterMap)
     {
-        // Maintain a mapping of Maya shading node handles to shader
-        // writers so that we only author each shader once, but can still
-        // look them up again to create connections.
-        _NodeHandleToShaderWriterMap shaderWriterMap;
-
         // MItDependencyGraph takes a non-const MPlug as a constructor
         // parameter, so we have to make a copy of rootPlug here.
         MPlug rootPlugCopy(rootPlug);
@@ -298,10 +301,6 @@ private:
             }
         }
 
-        for (auto&& writerEntry : shaderWriterMap) {
-            writerEntry.second->PostExport();
-        }
-
         return topLevelShader;
     }
 
@@ -341,6 +340,16 @@ private:
             *mat = material;
         }
 
+        // A shading engine connected to the same shaders as an already
+        // exported one references its material, its networks would only be
+        // authored the same way again.
+        const SdfPath sharedMaterialPath = context.GetMaterialExportedForSameShaders();
+        if (!sharedMaterialPath.IsEmpty() && sharedMaterialPath != materialPrim.GetPath()) {
+            materialPrim.GetReferences().AddInternalReference(sharedMaterialPath);
+            context.BindStandardMaterialPrim(materialPrim, assignments, boundPrimPaths);
+            return;
+        }
+
         for (const TfToken& currentMaterialConversion :
              context.GetExportArgs().allMaterialConversions) {
 
@@ -361,21 +370,30 @@ private:
                 UsdShadeNodeGraph::Define(context.GetUsdStage(), materialExportPath);
             }
 
+            // Maintain a mapping of Maya shading node handles to shader
+            // writers so that we only author each shader once, but can still
+            // look them up again to create connections.
+            _NodeHandleToShaderWriterMap shaderWriterMap;
+
             UsdShadeShader surfaceShaderSchema = _ExportShadingDepGraph(
-                materialExportPath, context.GetSurfaceShaderPlug(), context);
+                materialExportPath, context.GetSurfaceShaderPlug(), context, shaderWriterMap);
             UsdMayaShadingUtil::CreateShaderOutputAndConnectMaterial(
                 surfaceShaderSchema, material, UsdShadeTokens->surface, renderContext);
 
             UsdShadeShader volumeShaderSchema = _ExportShadingDepGraph(
-                materialExportPath, context.GetVolumeShaderPlug(), context);
+                materialExportPath, context.GetVolumeShaderPlug(), context, shaderWriterMap);
             UsdMayaShadingUtil::CreateShaderOutputAndConnectMaterial(
                 volumeShaderSchema, material, UsdShadeTokens->volume, renderContext);
 
             UsdShadeShader displacementShaderSchema = _ExportShadingDepGraph(
-                materialExportPath, context.GetDisplacementShaderPlug(), context);
+                materialExportPath, context.GetDisplacementShaderPlug(), context, shaderWriterMap);
             UsdMayaShadingUtil::CreateShaderOutputAndConnectMaterial(
                 displacementShaderSchema, material, UsdShadeTokens->displacement, renderContext);
 
+            for (auto&& writerEntry : shaderWriterMap) {
+                writerEntry.second->PostExport();
+            }
+
             // Clean-up nodegraph if nothing was exported:
             if (context.GetExportArgs().allMaterialConversions.size() > 1) {
                 UsdPrim nodeGraphPrim(context.GetUsdStage()->GetPrimAtPath(materialExportPath));
@@ -385,6 +403,7 @@ private:
                 }
             }
         }
+        context.SetMaterialExportedForShaders(materialPrim.GetPath());
         context.BindStandardMaterialPrim(materialPrim, assignments, boundPrimPaths);
     }
 };
@@ -637,10 +656,20 @@ private:
         // UsdMayaPrimReader::Read is a function that works by indirect effect. It will return
         // "true" on success, and the resulting changes will be found in the _context object.
         UsdMayaPrimReaderContext* context = _context->GetPrimReaderContext();
-        if (context == nullptr || !shaderReader.Read(*context)) {
+        if (context == nullptr) {
             return MObject();
         }
 
+        {
+            UsdMayaPrimReaderProfiler::Scope profilerScope(
+                context->GetProfiler(),
+                UsdMayaPrimReaderProfiler::Category::ShaderReader,
+                typeid(shaderReader));
+            if (!shaderReader.Read(*context)) {
+                return MObject();
+            }
+        }
+
         MObject shaderObj = shaderReader.GetCreatedObject(*_context, shaderSchema.GetPrim());
         if (shaderObj.isNull()) {
             return MObject();
@@ -42,6 +42,7 @@
 #include <maya/MFnTransform.h>
 #include <maya/MString.h>
 
+#include <algorithm>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -69,9 +70,7 @@ void UsdMayaTransformWriter::_AnimChannel::setXformOp(
         shearXForm[2][0] = value[1]; // xzVal
         shearXForm[2][1] = value[2]; // yzVal
         vtValue = shearXForm;
-    } else if (
-        UsdGeomXformOp::GetPrecisionFromValueTypeName(op.GetAttr().GetTypeName())
-        == UsdGeomXformOp::PrecisionDouble) {
+    } else if (isDoublePrecision) {
         vtValue = VtValue(value);
     } else { // float precision
         vtValue = VtValue(GfVec3f(value));
@@ -82,6 +81,7 @@ void UsdMayaTransformWriter::_AnimChannel::setXformOp(
 /* static */
 void UsdMayaTransformWriter::_ComputeXformOps(
     const std::vector<_AnimChannel>&           animChanList,
+    const std::vector<size_t>&                 animatedChannels,
     const UsdTimeCode&                         usdTime,
     const bool                                 eulerFilter,
     UsdMayaTransformWriter::_TokenRotationMap* previousRotates,
@@ -91,9 +91,16 @@ void UsdMayaTransformWriter::_ComputeXformOps(
         return;
     }
 
+    // The static channels are only set at the default time, the time samples
+    // only read the plugs of the animated channels.
+    const bool   isDefaultTime = usdTime == UsdTimeCode::Default();
+    const size_t channelCount = isDefaultTime ? animChanList.size() : animatedChannels.size();
+
     // Iterate over each _AnimChannel, retrieve the default value and pull the
     // Maya data if needed. Then store it on the USD Ops
-    for (const auto& animChannel : animChanList) {
+    for (size_t channelIndex = 0; channelIndex < channelCount; ++channelIndex) {
+        const _AnimChannel& animChannel
+            = animChanList[isDefaultTime ? channelIndex : animatedChannels[channelIndex]];
 
         if (animChannel.isInverse) {
             continue;
@@ -109,7 +116,7 @@ void UsdMayaTransformWriter::_ComputeXformOps(
                 if (animChannel.isMatrix) {
                     matrix = animChannel.GetSourceData(i).Get<GfMatrix4d>();
                 } else {
-                    value[i] = animChannel.GetSourceData(i).Get<double>();
+                    value[i] = animChannel.plug[i].asDouble();
                 }
                 hasAnimated = true;
             } else if (animChannel.sampleType[i] == _SampleType::Static) {
@@ -125,8 +132,7 @@ void UsdMayaTransformWriter::_ComputeXformOps(
         //
         // This to make sure static channels are setting their default while
         // animating ones are actually animating
-        if ((usdTime == UsdTimeCode::Default() && hasStatic && !hasAnimated)
-            || (usdTime != UsdTimeCode::Default() && hasAnimated)) {
+        if ((isDefaultTime && hasStatic && !hasAnimated) || (!isDefaultTime && hasAnimated)) {
 
             if (animChannel.opType == _XformType::Rotate) {
                 if (hasAnimated && eulerFilter) {
@@ -570,12 +576,28 @@ void UsdMayaTransformWriter::_WriteChannelsXformOps(const UsdGeomXformable& usdX
 
     // Loop over anim channel vector and create corresponding XFormOps
     // including the inverse ones if needed
-    for (_AnimChannel& animChan : _animChannels) {
+    _animatedChannels.clear();
+    for (size_t i = 0; i < _animChannels.size(); ++i) {
+        _AnimChannel& animChan = _animChannels[i];
         animChan.op = usdXformable.AddXformOp(
             animChan.usdOpType, animChan.precision, animChan.suffix, animChan.isInverse);
         if (!animChan.op) {
             TF_CODING_ERROR("Could not add xform op");
             animChan.op = UsdGeomXformOp();
+            continue;
+        }
+
+        animChan.isDoublePrecision
+            = UsdGeomXformOp::GetPrecisionFromValueTypeName(animChan.op.GetAttr().GetTypeName())
+            == UsdGeomXformOp::PrecisionDouble;
+
+        if (!animChan.isInverse
+            && std::find(
+                   std::begin(animChan.sampleType),
+                   std::end(animChan.sampleType),
+                   _SampleType::Animated)
+                != std::end(animChan.sampleType)) {
+            _animatedChannels.push_back(i);
         }
     }
 }
@@ -615,6 +637,22 @@ UsdMayaTransformWriter::UsdMayaTransformWriter(
     }
 }
 
+/* virtual */
+bool UsdMayaTransformWriter::IsAnimated() const
+{
+    if (_HasAnimCurves()) {
+        return true;
+    }
+    for (const _AnimChannel& animChannel : _animChannels) {
+        for (const _SampleType sampleType : animChannel.sampleType) {
+            if (sampleType == _SampleType::Animated) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 /* virtual */
 void UsdMayaTransformWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -629,6 +667,7 @@ void UsdMayaTransformWriter::Write(const UsdTimeCode& usdTime)
         if (UsdGeomXformable xformSchema = UsdGeomXformable(_usdPrim)) {
             _ComputeXformOps(
                 _animChannels,
+                _animatedChannels,
                 usdTime,
                 _GetExportArgs().eulerFilter,
                 &_previousRotates,
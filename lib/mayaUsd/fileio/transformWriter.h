@@ -57,6 +57,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     void Write(const UsdTimeCode& usdTime) override;
 
+    /// Returns true if the Maya node or one of its xformOps is animated.
+    /// Subclasses writing more than the xformOps at the animated time
+    /// samples should override.
+    MAYAUSD_CORE_PUBLIC
+    bool IsAnimated() const override;
+
 private:
     // Cache of previous rotations.
     using _TokenRotationMap
@@ -100,6 +106,10 @@ private:
         bool                      isMatrix = false;
         UsdGeomXformOp            op;
 
+        // Precision of the attribute of the op, resolved once the op is
+        // created so the time samples don't query its type.
+        bool isDoublePrecision = false;
+
         // Retrieve the value from the Maya attribute based on if it is a matrix.
         VtValue GetSourceData(unsigned int i) const;
 
@@ -112,9 +122,11 @@ private:
     };
 
     // For a given array of _AnimChannels and time, compute the xformOp data if
-    // needed and set the xformOps' values.
+    // needed and set the xformOps' values. Only the channels at the
+    // \p animatedChannels indices are read at the time samples.
     static void _ComputeXformOps(
         const std::vector<_AnimChannel>&           animChanList,
+        const std::vector<size_t>&                 animatedChannels,
         const UsdTimeCode&                         usdTime,
         const bool                                 eulerFilter,
         UsdMayaTransformWriter::_TokenRotationMap* previousRotates,
@@ -155,6 +167,10 @@ private:
 
     std::vector<_AnimChannel> _animChannels;
     _TokenRotationMap         _previousRotates;
+
+    // Indices of the channels with animated plugs, the op layout and the
+    // sample types are resolved once when the writer is created.
+    std::vector<size_t> _animatedChannels;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
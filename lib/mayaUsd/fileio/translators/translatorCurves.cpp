@@ -15,6 +15,7 @@
 //
 #include "translatorCurves.h"
 
+#include <mayaUsd/fileio/primReaderValueCache.h>
 #include <mayaUsd/fileio/translators/translatorUtil.h>
 #include <mayaUsd/undo/OpUndoItems.h>
 
@@ -32,10 +33,30 @@
 #include <maya/MTime.h>
 #include <maya/MTimeArray.h>
 
+#include <vector>
+
 using namespace MAYAUSD_NS_DEF;
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+namespace {
+
+// Copies the \p count points of \p points starting at \p offset into \p mayaPoints.
+void _CopyPoints(
+    const VtArray<GfVec3f>& points,
+    size_t                  offset,
+    size_t                  count,
+    MPointArray&            mayaPoints)
+{
+    mayaPoints.setLength(count);
+    const GfVec3f* src = points.cdata() + offset;
+    for (size_t i = 0; i < count; ++i) {
+        mayaPoints.set(i, src[i][0], src[i][1], src[i][2]);
+    }
+}
+
+} // namespace
+
 /* static */
 bool convertToBezier(MFnNurbsCurve& nurbsCurveFn, MObject& mayaNodeTransformObj, MStatus& status)
 {
@@ -101,10 +122,8 @@ bool UsdMayaTranslatorCurves::Create(
     VtArray<GfVec3f> points;
     VtArray<int>     curveOrder;
     VtArray<int>     curveVertexCounts;
-    VtArray<float>   curveWidths;
     VtArray<GfVec2d> curveRanges;
     VtArray<double>  curveKnots;
-    VtArray<double>  _curveKnots; // subset of curveKnots
 
     // LIMITATION:  xxx REVISIT xxx
     //   Non-animated Attrs
@@ -134,7 +153,7 @@ bool UsdMayaTranslatorCurves::Create(
         }
     }
 
-    curves.GetPointsAttr().Get(&points, pointsTimeSample);
+    UsdMayaPrimReaderValueCache::Get(context, curves.GetPointsAttr(), &points, pointsTimeSample);
 
     if (points.empty()) {
         TF_RUNTIME_ERROR(
@@ -142,82 +161,107 @@ bool UsdMayaTranslatorCurves::Create(
         return false; // invalid nurbscurves, so exit
     }
 
-    curves.GetWidthsAttr().Get(&curveWidths); // not animatable
+    size_t totalNumVertices = 0;
+    for (int vertexCount : curveVertexCounts) {
+        totalNumVertices += vertexCount;
+    }
+    if (points.size() < totalNumVertices) {
+        TF_RUNTIME_ERROR(
+            "points array is too small for the vertex counts on NurbsCurves <%s>. Skipping...",
+            prim.GetPath().GetText());
+        return false;
+    }
 
-    int     indexOffset = 0;
-    int     coffset = 0;
-    int     mayaDegree = 0;
-    auto    curveType = MFn::kNurbsCurve;
-    TfToken typeToken = UsdGeomTokens->linear;
+    // The animated points are read once for all the curves, each curve then takes its slice of
+    // every sample.
+    std::vector<VtArray<GfVec3f>> pointsSamples(numTimeSamples);
+    for (size_t ti = 0; ti < numTimeSamples; ++ti) {
+        curves.GetPointsAttr().Get(&pointsSamples[ti], pointsTimeSamples[ti]);
+    }
 
-    UsdGeomBasisCurves basisSchema;
+    // The curve type is the same for all the curves of the prim, so the schemas and their
+    // attributes are only read once.
+    const UsdGeomNurbsCurves nurbsSchema(prim);
+    auto                     curveType = MFn::kNurbsCurve;
+    TfToken                  typeToken = UsdGeomTokens->linear;
+    if (nurbsSchema) {
+        nurbsSchema.GetOrderAttr().Get(&curveOrder);   // not animatable
+        nurbsSchema.GetKnotsAttr().Get(&curveKnots);   // not animatable
+        nurbsSchema.GetRangesAttr().Get(&curveRanges); // not animatable or actually used....
+        if (curveOrder.size() < curveVertexCounts.size()) {
+            TF_RUNTIME_ERROR(
+                "order array is too small for the vertex counts on NurbsCurves <%s>. Skipping...",
+                prim.GetPath().GetText());
+            return false;
+        }
+    } else {
+        // Handle basis curves originally modeled in Maya as nurbs.
+        curveType = MFn::kBezierCurve;
+        UsdGeomBasisCurves(prim).GetTypeAttr().Get(&typeToken);
+    }
 
-    for (size_t curveIndex = 0; curveIndex < curveVertexCounts.size(); ++curveIndex) {
+    int          indexOffset = 0;
+    int          coffset = 0;
+    int          mayaDegree = 0;
+    MDoubleArray mayaKnots;
+    int          mayaKnotsVertexCount = -1; // vertex count of the basis curve knots in mayaKnots
+    MPointArray  mayaPoints;
 
-        if (UsdGeomNurbsCurves nurbsSchema = UsdGeomNurbsCurves(prim)) {
-            if (curveKnots.empty()) {
-                nurbsSchema.GetOrderAttr().Get(&curveOrder); // not animatable
-                nurbsSchema.GetKnotsAttr().Get(&curveKnots); // not animatable
-                nurbsSchema.GetRangesAttr().Get(
-                    &curveRanges); // not animatable or actually used....
-            }
+    for (size_t curveIndex = 0; curveIndex < curveVertexCounts.size(); ++curveIndex) {
+        const int vertexCount = curveVertexCounts[curveIndex];
 
+        if (nurbsSchema) {
             // Remove front and back knots to match Maya representation. See
             // "Managing different knot representations in external applications"
             // section in MFnNurbsCurve documentation.
             // make knot subset consisting of the current curve, trim ends
-            _curveKnots = { curveKnots.begin() + coffset + 1,
-                            curveKnots.begin() + coffset + curveVertexCounts[curveIndex] + 3 };
+            if (curveKnots.size() < size_t(coffset + vertexCount + 4)) {
+                TF_RUNTIME_ERROR(
+                    "knots array is too small for the vertex counts on NurbsCurves <%s>. "
+                    "Skipping...",
+                    prim.GetPath().GetText());
+                return false;
+            }
+            mayaKnots = MDoubleArray(curveKnots.cdata() + coffset + 1, vertexCount + 2);
             // set offset to the beginning of next curve
-            coffset += curveVertexCounts[curveIndex] + 4;
+            coffset += vertexCount + 4;
             mayaDegree = curveOrder[curveIndex] - 1;
 
         } else {
-            // Handle basis curves originally modeled in Maya as nurbs.
-            curveType = MFn::kBezierCurve;
-
-            curveOrder.resize(1);
-            basisSchema = UsdGeomBasisCurves(prim);
-            basisSchema.GetTypeAttr().Get(&typeToken);
-
-            if (typeToken == UsdGeomTokens->linear) {
-                curveOrder[0] = 2;
-                _curveKnots.resize(curveVertexCounts[curveIndex]);
-                for (size_t i = 0; i < _curveKnots.size(); ++i) {
-                    _curveKnots[i] = i;
-                }
+            // The knots of basis curves only depend on the vertex count, which is usually the
+            // same for all the curves of a groom or curve cache.
+            if (vertexCount != mayaKnotsVertexCount) {
+                mayaKnotsVertexCount = vertexCount;
+
+                if (typeToken == UsdGeomTokens->linear) {
+                    mayaKnots.setLength(vertexCount);
+                    for (unsigned int i = 0; i < mayaKnots.length(); ++i) {
+                        mayaKnots[i] = i;
+                    }
 
-            } else {
-                curveOrder[0] = 4;
-
-                _curveKnots.resize(curveVertexCounts[curveIndex] - 3 + 5);
-                int knotIdx = 0;
-                for (size_t i = 0; i < _curveKnots.size(); ++i) {
-                    if (i < 3) {
-                        _curveKnots[i] = 0.0;
-                    } else {
-                        if (i % 3 == 0) {
-                            ++knotIdx;
-                        } else if (i == _curveKnots.size() - 3) {
-                            ++knotIdx;
+                } else {
+                    mayaKnots.setLength(vertexCount - 3 + 5);
+                    int knotIdx = 0;
+                    for (unsigned int i = 0; i < mayaKnots.length(); ++i) {
+                        if (i < 3) {
+                            mayaKnots[i] = 0.0;
+                        } else {
+                            if (i % 3 == 0) {
+                                ++knotIdx;
+                            } else if (i == mayaKnots.length() - 3) {
+                                ++knotIdx;
+                            }
+                            mayaKnots[i] = double(knotIdx);
                         }
-                        _curveKnots[i] = double(knotIdx);
                     }
                 }
             }
-            mayaDegree = curveOrder[0] - 1;
+            mayaDegree = (typeToken == UsdGeomTokens->linear) ? 1 : 3;
         }
 
         // == Convert data
-        size_t      mayaNumVertices = curveVertexCounts[curveIndex];
-        MPointArray mayaPoints(mayaNumVertices);
-        for (size_t i = 0; i < mayaNumVertices; i++) {
-            size_t ipos = i + indexOffset;
-            mayaPoints.set(i, points[ipos][0], points[ipos][1], points[ipos][2]);
-        }
-
-        double*      knots = _curveKnots.data();
-        MDoubleArray mayaKnots(knots, _curveKnots.size());
+        const size_t mayaNumVertices = vertexCount;
+        _CopyPoints(points, indexOffset, mayaNumVertices, mayaPoints);
 
         MFnNurbsCurve::Form mayaCurveForm = MFnNurbsCurve::kOpen; // HARDCODED
         bool                mayaCurveCreate2D = false;
@@ -260,8 +304,7 @@ bool UsdMayaTranslatorCurves::Create(
         //   node Almost identical code as used with MayaMeshReader.cpp
         //
         if (numTimeSamples > 0) {
-            MPointArray mayaPoints(mayaNumVertices);
-            MObject     curveAnimObj;
+            MObject curveAnimObj;
 
             MFnBlendShapeDeformer blendFn;
             MObject               blendObj = blendFn.create(curveObj);
@@ -271,12 +314,10 @@ bool UsdMayaTranslatorCurves::Create(
             }
 
             for (unsigned int ti = 0; ti < numTimeSamples; ++ti) {
-                curves.GetPointsAttr().Get(&points, pointsTimeSamples[ti]);
-
-                for (unsigned int i = 0; i < mayaNumVertices; i++) {
-                    unsigned int ipos = i + indexOffset;
-                    mayaPoints.set(i, points[ipos][0], points[ipos][1], points[ipos][2]);
+                if (pointsSamples[ti].size() < indexOffset + mayaNumVertices) {
+                    continue;
                 }
+                _CopyPoints(pointsSamples[ti], indexOffset, mayaNumVertices, mayaPoints);
 
                 // == Create NurbsCurve Shape Node
                 MFnNurbsCurve curveFn;
@@ -342,7 +383,7 @@ bool UsdMayaTranslatorCurves::Create(
                 }
             }
         }
-        indexOffset += curveVertexCounts[curveIndex];
+        indexOffset += vertexCount;
     }
     return true;
 }
@@ -35,7 +35,10 @@
 #include <mayaUsd/undo/OpUndoItems.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/arch/systemInfo.h>
 #include <pxr/base/tf/getenv.h>
+#include <pxr/base/work/loops.h>
 
 #include <maya/MDGModifier.h>
 #include <maya/MFileIO.h>
@@ -46,11 +49,16 @@
 #include <maya/MGlobal.h>
 #include <maya/MItDependencyNodes.h>
 #include <maya/MNodeClass.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 #include <maya/MSelectionList.h>
 
 #include <ghc/filesystem.hpp>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -216,8 +224,82 @@ MStatus UnloadMayaReferenceWithUndo(const MObject& referenceObject)
     return LoadOrUnloadMayaReferenceWithUndo(referenceObject, false);
 }
 
+// The reference loads deferred by the active BatchLoadScope. Import and pull run on the main
+// thread.
+struct PendingLoad
+{
+    MObjectHandle referenceObject;
+    std::string   filePath;
+};
+
+int                      batchLoadDepth = 0;
+std::vector<PendingLoad> pendingLoads;
+
+// Reads the files ahead in parallel, so that the serial loads of the references that follow
+// find them in the file system cache. Many references usually share the same few files.
+void prefetchFiles(std::vector<std::string> filePaths)
+{
+    std::sort(filePaths.begin(), filePaths.end());
+    filePaths.erase(std::unique(filePaths.begin(), filePaths.end()), filePaths.end());
+
+    WorkParallelForN(
+        filePaths.size(),
+        [&filePaths](size_t begin, size_t end) {
+            const size_t pageSize = ArchGetPageSize();
+            for (size_t i = begin; i < end; ++i) {
+                ArchConstFileMapping mapping = ArchMapFileReadOnly(filePaths[i]);
+                if (!mapping) {
+                    continue;
+                }
+
+                const char*  data = mapping.get();
+                const size_t length = ArchGetFileMappingLength(mapping);
+                ArchMemAdvise(data, length, ArchMemAdviceWillNeed);
+
+                volatile char sink = 0;
+                for (size_t offset = 0; offset < length; offset += pageSize) {
+                    sink = data[offset];
+                }
+                (void)sink;
+            }
+        },
+        1);
+}
+
 } // namespace
 
+UsdMayaTranslatorMayaReference::BatchLoadScope::BatchLoadScope() { ++batchLoadDepth; }
+
+UsdMayaTranslatorMayaReference::BatchLoadScope::~BatchLoadScope()
+{
+    if (--batchLoadDepth > 0 || pendingLoads.empty()) {
+        return;
+    }
+
+    std::vector<PendingLoad> loads;
+    loads.swap(pendingLoads);
+
+    std::vector<std::string> filePaths;
+    filePaths.reserve(loads.size());
+    for (const PendingLoad& load : loads) {
+        filePaths.push_back(load.filePath);
+    }
+    prefetchFiles(std::move(filePaths));
+
+    TF_DEBUG(PXRUSDMAYA_TRANSLATORS)
+        .Msg("MayaReferenceLogic::BatchLoadScope loading %zu references\n", loads.size());
+    for (const PendingLoad& load : loads) {
+        // The reference node may have been deleted since it was created.
+        if (!load.referenceObject.isValid()) {
+            continue;
+        }
+
+        // Load the reference to properly trigger the kAfterReferenceLoad callback
+        MStatus status = LoadMayaReferenceWithUndo(load.referenceObject.object());
+        CHECK_MSTATUS(status);
+    }
+}
+
 const TfToken UsdMayaTranslatorMayaReference::m_namespaceName = TfToken("mayaNamespace");
 const TfToken UsdMayaTranslatorMayaReference::m_referenceName = TfToken("mayaReference");
 const TfToken UsdMayaTranslatorMayaReference::m_mergeNamespacesOnClash
@@ -366,6 +448,11 @@ MStatus UsdMayaTranslatorMayaReference::LoadMayaReference(
     status = setMayaRefCustomAttribute(prim, refDependNode);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
+    if (batchLoadDepth > 0) {
+        pendingLoads.push_back({ MObjectHandle(referenceObject), mayaReferencePath.asChar() });
+        return MS::kSuccess;
+    }
+
     // Now load the reference to properly trigger the kAfterReferenceLoad callback
     status = LoadMayaReferenceWithUndo(referenceObject);
     CHECK_MSTATUS_AND_RETURN_IT(status);
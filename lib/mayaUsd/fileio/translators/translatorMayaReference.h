@@ -47,6 +47,24 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// \brief Provides helper functions for reading UsdGeomGprim.
 struct UsdMayaTranslatorMayaReference
 {
+    /// \brief Defers the loading of the references created by LoadMayaReference() to the end
+    /// of the outermost scope.
+    ///
+    /// The referenced files are then read ahead in parallel before the references are loaded
+    /// one after the other, so that reference-heavy imports and pulls do not wait on the file
+    /// system for each reference in turn.
+    class BatchLoadScope
+    {
+    public:
+        MAYAUSD_CORE_PUBLIC
+        BatchLoadScope();
+        MAYAUSD_CORE_PUBLIC
+        ~BatchLoadScope();
+
+        BatchLoadScope(const BatchLoadScope&) = delete;
+        BatchLoadScope& operator=(const BatchLoadScope&) = delete;
+    };
+
     MAYAUSD_CORE_PUBLIC
     static MStatus LoadMayaReference(
         const UsdPrim& prim,
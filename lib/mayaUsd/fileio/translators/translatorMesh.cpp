@@ -15,6 +15,7 @@
 //
 #include "translatorMesh.h"
 
+#include <mayaUsd/fileio/primReaderValueCache.h>
 #include <mayaUsd/fileio/utils/meshReadUtils.h>
 #include <mayaUsd/fileio/utils/meshWriteUtils.h>
 #include <mayaUsd/fileio/utils/readUtil.h>
@@ -30,6 +31,7 @@
 #include <maya/MDGModifier.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFloatArray.h>
+#include <maya/MFloatPointArray.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnBlendShapeDeformer.h>
 #include <maya/MFnDagNode.h>
@@ -42,14 +44,47 @@
 #include <maya/MItMeshFaceVertex.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
-#include <maya/MPointArray.h>
 #include <maya/MString.h>
+#include <maya/MVectorArray.h>
 
 #include <string>
 #include <vector>
 
 namespace MAYAUSD_NS_DEF {
 
+namespace {
+
+// Copies the USD points into the storage of the Maya points in a single pass,
+// Maya meshes hold float points so no precision conversion is needed.
+void copyPointsToMaya(const VtVec3fArray& points, MFloatPointArray& mayaPoints)
+{
+    const size_t numPoints = points.size();
+    mayaPoints.setLength(numPoints);
+    if (numPoints == 0u) {
+        return;
+    }
+
+    const float* src = points.cdata()->data();
+    float*       dst = &mayaPoints[0].x;
+    for (size_t i = 0u; i < numPoints; ++i, src += 3, dst += 4) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = 1.0f;
+    }
+}
+
+// Builds the Maya normals from the USD face-varying normals without going
+// through an MVector per element.
+MVectorArray toMayaNormals(const VtVec3fArray& normals)
+{
+    return MVectorArray(
+        reinterpret_cast<const float(*)[3]>(normals.cdata()),
+        static_cast<unsigned int>(normals.size()));
+}
+
+} // namespace
+
 TranslatorMeshRead::TranslatorMeshRead(
     const UsdGeomMesh&        mesh,
     const UsdPrim&            prim,
@@ -80,7 +115,8 @@ TranslatorMeshRead::TranslatorMeshRead(
             "Skipping...",
             prim.GetPath().GetText());
     } else {
-        fvc.Get(&faceVertexCounts, UsdTimeCode::EarliestTime());
+        UsdMayaPrimReaderValueCache::Get(
+            context, fvc, &faceVertexCounts, UsdTimeCode::EarliestTime());
     }
 
     const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
@@ -93,7 +129,8 @@ TranslatorMeshRead::TranslatorMeshRead(
             "Skipping...",
             prim.GetPath().GetText());
     } else {
-        fvi.Get(&faceVertexIndices, UsdTimeCode::EarliestTime());
+        UsdMayaPrimReaderValueCache::Get(
+            context, fvi, &faceVertexIndices, UsdTimeCode::EarliestTime());
     }
 
     // Sanity Checks. If the vertex arrays are empty, skip this mesh
@@ -142,7 +179,7 @@ TranslatorMeshRead::TranslatorMeshRead(
         }
     }
 
-    mesh.GetPointsAttr().Get(&points, pointsTimeSample);
+    UsdMayaPrimReaderValueCache::Get(context, mesh.GetPointsAttr(), &points, pointsTimeSample);
 
     /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
     UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
@@ -151,7 +188,8 @@ TranslatorMeshRead::TranslatorMeshRead(
         primvar.ComputeFlattened(&normals, normalsTimeSample);
         normalsInterpolation = primvar.GetInterpolation();
     } else {
-        mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
+        UsdMayaPrimReaderValueCache::Get(
+            context, mesh.GetNormalsAttr(), &normals, normalsTimeSample);
         normalsInterpolation = mesh.GetNormalsInterpolation();
     }
 
@@ -172,11 +210,9 @@ TranslatorMeshRead::TranslatorMeshRead(
     }
 
     // == Convert data to Maya ( vertices, faces, indices )
-    const size_t mayaNumVertices = points.size();
-    MPointArray  mayaPoints(mayaNumVertices);
-    for (size_t i = 0u; i < mayaNumVertices; ++i) {
-        mayaPoints.set(i, points[i][0], points[i][1], points[i][2]);
-    }
+    const size_t     mayaNumVertices = points.size();
+    MFloatPointArray mayaPoints;
+    copyPointsToMaya(points, mayaPoints);
 
     MIntArray polygonCounts(faceVertexCounts.cdata(), faceVertexCounts.size());
     MIntArray polygonConnects(faceVertexIndices.cdata(), faceVertexIndices.size());
@@ -222,17 +258,16 @@ TranslatorMeshRead::TranslatorMeshRead(
     // Set normals if supplied
     MIntArray normalsFaceIds;
     if (normals.size() == static_cast<size_t>(meshFn.numFaceVertices())) {
-        for (size_t i = 0u; i < polygonCounts.length(); ++i) {
+        normalsFaceIds.setLength(polygonConnects.length());
+        unsigned int faceVertex = 0u;
+        for (unsigned int i = 0u; i < polygonCounts.length(); ++i) {
             for (int j = 0; j < polygonCounts[i]; ++j) {
-                normalsFaceIds.append(i);
+                normalsFaceIds[faceVertex++] = i;
             }
         }
 
         if (normalsFaceIds.length() == static_cast<size_t>(meshFn.numFaceVertices())) {
-            MVectorArray mayaNormals(normals.size());
-            for (size_t i = 0u; i < normals.size(); ++i) {
-                mayaNormals.set(MVector(normals[i][0u], normals[i][1u], normals[i][2u]), i);
-            }
+            const MVectorArray mayaNormals = toMayaNormals(normals);
 
             meshFn.setFaceVertexNormals(mayaNormals, normalsFaceIds, polygonConnects);
         }
@@ -274,18 +309,18 @@ TranslatorMeshRead::TranslatorMeshRead(
     }
 
     // Use blendShapeDeformer so that all the points for a frame are contained in a single node.
-    MPointArray mayaAnimPoints(mayaNumVertices);
-    MObject     meshAnimObj;
+    MFloatPointArray mayaAnimPoints;
+    MObject          meshAnimObj;
 
     MFnBlendShapeDeformer blendFn;
     m_meshBlendObj = blendFn.create(m_meshObj);
 
     for (unsigned int ti = 0u; ti < m_pointsNumTimeSamples; ++ti) {
         mesh.GetPointsAttr().Get(&points, pointsTimeSamples[ti]);
-
-        for (unsigned int i = 0u; i < mayaNumVertices; ++i) {
-            mayaAnimPoints.set(i, points[i][0], points[i][1], points[i][2]);
+        if (points.size() != mayaNumVertices) {
+            points.resize(mayaNumVertices);
         }
+        copyPointsToMaya(points, mayaAnimPoints);
 
         // == Create Mesh Shape Node
         MFnMesh meshFn;
@@ -316,11 +351,7 @@ TranslatorMeshRead::TranslatorMeshRead(
         mesh.GetNormalsAttr().Get(&normals, pointsTimeSamples[ti]);
         if (normals.size() == static_cast<size_t>(meshFn.numFaceVertices())
             && normalsFaceIds.length() == static_cast<size_t>(meshFn.numFaceVertices())) {
-            MVectorArray mayaNormals(normals.size());
-            for (size_t i = 0; i < normals.size(); ++i) {
-                mayaNormals.set(MVector(normals[i][0u], normals[i][1u], normals[i][2u]), i);
-            }
-
+            const MVectorArray mayaNormals = toMayaNormals(normals);
             meshFn.setFaceVertexNormals(mayaNormals, normalsFaceIds, polygonConnects);
         }
 
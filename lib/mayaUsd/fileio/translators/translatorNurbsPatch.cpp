@@ -17,6 +17,7 @@
 
 #include <mayaUsd/fileio/primReaderArgs.h>
 #include <mayaUsd/fileio/primReaderContext.h>
+#include <mayaUsd/fileio/primReaderValueCache.h>
 #include <mayaUsd/fileio/translators/translatorGprim.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
 #include <mayaUsd/fileio/translators/translatorUtil.h>
@@ -104,7 +105,8 @@ bool UsdMayaTranslatorNurbsPatch::Read(
             pointsTimeSample = pointsTimeSamples[0];
         }
     }
-    usdNurbsPatch.GetPointsAttr().Get(&points, pointsTimeSample);
+    UsdMayaPrimReaderValueCache::Get(
+        context, usdNurbsPatch.GetPointsAttr(), &points, pointsTimeSample);
 
     if (points.empty()) {
         TF_RUNTIME_ERROR(
@@ -22,6 +22,7 @@
 
 #include <pxr/base/tf/staticData.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdSkel/skeleton.h>
 #include <pxr/usd/usdSkel/skeletonQuery.h>
 #include <pxr/usd/usdSkel/skinningQuery.h>
@@ -892,20 +893,31 @@ bool _SetVaryingJointInfluences(
 
     // Compute a vertex-ordered weight arrays. Weights are stored as:
     //   vert_0_joint_0 ... vert_0_joint_n ... vert_n_joint_0 ... vert_n_joint_n
+    // Each point only writes its own row, so the rows are filled in parallel
+    // directly in the storage of the Maya array.
     MDoubleArray vertOrderedWeights(numPoints * numJoints, 0.0f);
-    for (unsigned int pt = 0; pt < numPoints; ++pt) {
-        for (int c = 0; c < numInfluencesPerPoint; ++c) {
-            int jointIdx = indices[pt * numInfluencesPerPoint + c];
-            if (jointIdx >= 0 && static_cast<unsigned int>(jointIdx) < numJoints) {
-                float w = weights[pt * numInfluencesPerPoint + c];
-                // There may be multiple influences referencing the same joint
-                // for this point. eg., 'unweighted' points are assigned
-                // index 0 and weight 0. Sum the weight contributions to ensure
-                // that we properly account for this.
-                vertOrderedWeights[pt * numJoints + jointIdx] += w;
+    if (numPoints * numJoints == 0u) {
+        return true;
+    }
+    double*      vertOrderedWeightsData = &vertOrderedWeights[0];
+    const int*   indicesData = indices.cdata();
+    const float* weightsData = weights.cdata();
+    WorkParallelForN(numPoints, [&](size_t begin, size_t end) {
+        for (size_t pt = begin; pt < end; ++pt) {
+            double* pointWeights = vertOrderedWeightsData + pt * numJoints;
+            for (int c = 0; c < numInfluencesPerPoint; ++c) {
+                int jointIdx = indicesData[pt * numInfluencesPerPoint + c];
+                if (jointIdx >= 0 && static_cast<unsigned int>(jointIdx) < numJoints) {
+                    float w = weightsData[pt * numInfluencesPerPoint + c];
+                    // There may be multiple influences referencing the same joint
+                    // for this point. eg., 'unweighted' points are assigned
+                    // index 0 and weight 0. Sum the weight contributions to ensure
+                    // that we properly account for this.
+                    pointWeights[jointIdx] += w;
+                }
             }
         }
-    }
+    });
 
     MIntArray influenceIndices(numJoints);
     for (unsigned int i = 0; i < numJoints; ++i) {
@@ -57,6 +57,24 @@ TF_DEFINE_PRIVATE_TOKENS(
 
 const MString _DEFAULT_TRANSFORM_TYPE("transform");
 
+static bool _CreateNode(
+    MDagModifier&  dagMod,
+    const MString& nodeName,
+    const MString& nodeTypeName,
+    MObject&       parentNode,
+    MStatus*       status,
+    MObject*       mayaNodeObj)
+{
+    *mayaNodeObj = dagMod.createNode(nodeTypeName, parentNode, status);
+    CHECK_MSTATUS_AND_RETURN(*status, false);
+    *status = dagMod.renameNode(*mayaNodeObj, nodeName);
+    CHECK_MSTATUS_AND_RETURN(*status, false);
+    *status = dagMod.doIt();
+    CHECK_MSTATUS_AND_RETURN(*status, false);
+
+    return TF_VERIFY(!mayaNodeObj->isNull());
+}
+
 /* static */
 bool UsdMayaTranslatorUtil::CreateTransformNode(
     const UsdPrim&               usdPrim,
@@ -182,12 +200,16 @@ bool UsdMayaTranslatorUtil::CreateNode(
     MStatus*                  status,
     MObject*                  mayaNodeObj)
 {
-    if (!CreateNode(
-            MString(path.GetName().c_str(), path.GetName().size()),
-            nodeTypeName,
-            parentNode,
-            status,
-            mayaNodeObj)) {
+    const MString nodeName(path.GetName().c_str(), path.GetName().size());
+
+    // The nodes of an import can all be created by a single modifier, each
+    // doIt() only executes the operations queued since the previous one.
+    MDagModifier* dagMod = context ? context->GetDagModifier() : nullptr;
+    if (dagMod) {
+        if (!_CreateNode(*dagMod, nodeName, nodeTypeName, parentNode, status, mayaNodeObj)) {
+            return false;
+        }
+    } else if (!CreateNode(nodeName, nodeTypeName, parentNode, status, mayaNodeObj)) {
         return false;
     }
 
@@ -214,14 +236,7 @@ bool UsdMayaTranslatorUtil::CreateNode(
     // this, all Maya*Reader node creation needs to be adjusted accordingly (for
     // much less trivial cases like MFnMesh).
     MDagModifier& dagMod = MDagModifierUndoItem::create("Generic node creation");
-    *mayaNodeObj = dagMod.createNode(nodeTypeName, parentNode, status);
-    CHECK_MSTATUS_AND_RETURN(*status, false);
-    *status = dagMod.renameNode(*mayaNodeObj, nodeName);
-    CHECK_MSTATUS_AND_RETURN(*status, false);
-    *status = dagMod.doIt();
-    CHECK_MSTATUS_AND_RETURN(*status, false);
-
-    return TF_VERIFY(!mayaNodeObj->isNull());
+    return _CreateNode(dagMod, nodeName, nodeTypeName, parentNode, status, mayaNodeObj);
 }
 
 /* static */
@@ -15,6 +15,7 @@
 //
 #include "translatorXformable.h"
 
+#include <mayaUsd/fileio/primReaderValueCache.h>
 #include <mayaUsd/fileio/translators/translatorPrim.h>
 #include <mayaUsd/fileio/translators/translatorUtil.h>
 #include <mayaUsd/fileio/utils/xformStack.h>
@@ -23,6 +24,7 @@
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/vec3d.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -49,10 +51,35 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+// Same as UsdGeomXformOp::GetAs(), through the values prefetched by the import
+template <typename T>
+static bool _getXformOpValueAs(
+    const UsdGeomXformOp&           xformOp,
+    T*                              value,
+    const UsdTimeCode&              usdTime,
+    const UsdMayaPrimReaderContext* context)
+{
+    VtValue opValue;
+    if (!UsdMayaPrimReaderValueCache::Get(context, xformOp.GetAttr(), &opValue, usdTime)) {
+        return false;
+    }
+
+    const VtValue castValue = VtValue::Cast<T>(opValue);
+    if (castValue.IsEmpty()) {
+        return false;
+    }
+
+    *value = castValue.UncheckedGet<T>();
+    return true;
+}
+
 // This function retrieves a value for a given xformOp and given time sample. It
 // knows how to deal with different type of ops and angle conversion
-static bool
-_getXformOpAsVec3d(const UsdGeomXformOp& xformOp, GfVec3d& value, const UsdTimeCode& usdTime)
+static bool _getXformOpAsVec3d(
+    const UsdGeomXformOp&           xformOp,
+    GfVec3d&                        value,
+    const UsdTimeCode&              usdTime,
+    const UsdMayaPrimReaderContext* context)
 {
     bool retValue = false;
 
@@ -96,7 +123,7 @@ _getXformOpAsVec3d(const UsdGeomXformOp& xformOp, GfVec3d& value, const UsdTimeC
     } else if (rotAxis != -1) {
         // Single Axis rotation
         double valued = 0;
-        retValue = xformOp.GetAs<double>(&valued, usdTime);
+        retValue = _getXformOpValueAs<double>(xformOp, &valued, usdTime, context);
         if (retValue) {
             if (xformOp.IsInverseOp()) {
                 valued = -valued;
@@ -105,7 +132,7 @@ _getXformOpAsVec3d(const UsdGeomXformOp& xformOp, GfVec3d& value, const UsdTimeC
         }
     } else {
         GfVec3d valued;
-        retValue = xformOp.GetAs<GfVec3d>(&valued, usdTime);
+        retValue = _getXformOpValueAs<GfVec3d>(xformOp, &valued, usdTime, context);
         if (retValue) {
             if (xformOp.IsInverseOp()) {
                 valued = -valued;
@@ -227,12 +254,23 @@ static bool _pushUSDXformOpToMayaXform(
         xValue.resize(timeSamples.size());
         yValue.resize(timeSamples.size());
         zValue.resize(timeSamples.size());
+
+        // Resolve the samples from worker threads, the Maya attributes and
+        // anim curves are then set serially from the gathered values.
+        std::vector<GfVec3d> values(timeSamples.size());
+        std::vector<char>    gotValues(timeSamples.size(), 0);
+        WorkParallelForN(timeSamples.size(), [&](size_t begin, size_t end) {
+            for (size_t ti = begin; ti < end; ++ti) {
+                gotValues[ti] = _getXformOpAsVec3d(
+                    xformop, values[ti], UsdTimeCode(timeSamples[ti]), context);
+            }
+        });
+
         for (unsigned int ti = 0; ti < timeSamples.size(); ++ti) {
-            UsdTimeCode time(timeSamples[ti]);
-            if (_getXformOpAsVec3d(xformop, value, time)) {
-                xValue[ti] = value[0];
-                yValue[ti] = value[1];
-                zValue[ti] = value[2];
+            if (gotValues[ti]) {
+                xValue[ti] = values[ti][0];
+                yValue[ti] = values[ti][1];
+                zValue[ti] = values[ti][2];
                 timeArray.set(MTime(timeSamples[ti] * timeSampleMultiplier, timeUnit), ti);
             } else {
                 TF_RUNTIME_ERROR(
@@ -242,7 +280,7 @@ static bool _pushUSDXformOpToMayaXform(
     } else {
         // pick the first available sample or default
         UsdTimeCode time = UsdTimeCode::EarliestTime();
-        if (_getXformOpAsVec3d(xformop, value, time)) {
+        if (_getXformOpAsVec3d(xformop, value, time, context)) {
             xValue.resize(1);
             yValue.resize(1);
             zValue.resize(1);
@@ -420,13 +458,23 @@ static bool _pushUSDXformToMayaXform(
     std::vector<double> ShearXZVal(timeCodes.size());
     std::vector<double> ShearYZVal(timeCodes.size());
 
+    // Resolve the local transforms from worker threads, they are decomposed
+    // serially below.
+    std::vector<GfMatrix4d> usdLocalTransforms(timeCodes.size(), GfMatrix4d(1.0));
+    std::vector<char>       gotLocalTransforms(timeCodes.size(), 0);
+    WorkParallelForN(timeCodes.size(), [&](size_t begin, size_t end) {
+        for (size_t ti = begin; ti < end; ++ti) {
+            bool resetsXformStack;
+            gotLocalTransforms[ti] = xformSchema.GetLocalTransformation(
+                &usdLocalTransforms[ti], &resetsXformStack, timeCodes[ti]);
+        }
+    });
+
     for (size_t ti = 0u; ti < timeCodes.size(); ++ti) {
         const UsdTimeCode& timeCode = timeCodes[ti];
 
-        GfMatrix4d usdLocalTransform(1.0);
-        bool       resetsXformStack;
-        if (!xformSchema.GetLocalTransformation(&usdLocalTransform, &resetsXformStack, timeCode)
-            && !xformSchema.GetPrim().IsInstance()) {
+        const GfMatrix4d& usdLocalTransform = usdLocalTransforms[ti];
+        if (!gotLocalTransforms[ti] && !xformSchema.GetPrim().IsInstance()) {
             if (timeCode.IsDefault()) {
                 TF_RUNTIME_ERROR(
                     "Missing xform data at the default time on USD prim <%s>",
@@ -29,6 +29,7 @@
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/mesh.h>
@@ -55,6 +56,9 @@
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <algorithm>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -241,36 +245,67 @@ int UsdMayaJointUtil::getCompressedSkinWeights(
     // For example, if there are the joints /a, /a/b, and /a/c, but each point
     // only has non-zero weighting for a single joint, then we only need one
     // slot instead of three.
-    int maxInfluenceCount = 0;
-    for (unsigned int vert = 0; vert < numVertices; ++vert) {
-        // Looping through each vertex.
-        const unsigned int offset = vert * numInfluences;
-        int                influenceCount = 0;
-        for (unsigned int i = 0; i < numInfluences; ++i) {
-            // Looping through each weight for vertex.
-            if (weights[offset + i] != 0.0) {
-                influenceCount++;
+    // The vertices are processed in parallel, the weights of each vertex are
+    // contiguous in the weights array.
+    std::vector<int> influenceCounts(numVertices, 0);
+    WorkParallelForN(
+        numVertices, [&weights, &influenceCounts, numInfluences](size_t begin, size_t end) {
+            for (size_t vert = begin; vert < end; ++vert) {
+                // Looping through each vertex.
+                const unsigned int offset = static_cast<unsigned int>(vert) * numInfluences;
+                int                influenceCount = 0;
+                for (unsigned int i = 0; i < numInfluences; ++i) {
+                    // Looping through each weight for vertex.
+                    if (weights[offset + i] != 0.0) {
+                        influenceCount++;
+                    }
+                }
+                influenceCounts[vert] = influenceCount;
             }
-        }
-        maxInfluenceCount = std::max(maxInfluenceCount, influenceCount);
-    }
+        });
+    const int maxInfluenceCount = influenceCounts.empty()
+        ? 0
+        : *std::max_element(influenceCounts.begin(), influenceCounts.end());
 
+    // The influences of each vertex are packed at the start of its slots and
+    // sorted by decreasing weight, like UsdSkelSortInfluences() does.
     usdJointIndices->assign(maxInfluenceCount * numVertices, 0);
     usdJointWeights->assign(maxInfluenceCount * numVertices, 0.0);
-    for (unsigned int vert = 0; vert < numVertices; ++vert) {
-        // Looping through each vertex.
-        const unsigned int inputOffset = vert * numInfluences;
-        int                outputOffset = vert * maxInfluenceCount;
-        for (unsigned int i = 0; i < numInfluences; ++i) {
-            // Looping through each weight for vertex.
-            float weight = weights[inputOffset + i];
-            if (!GfIsClose(weight, 0.0, 1e-8)) {
-                (*usdJointIndices)[outputOffset] = i;
-                (*usdJointWeights)[outputOffset] = weight;
-                outputOffset++;
+    int*   indicesData = usdJointIndices->data();
+    float* weightsData = usdJointWeights->data();
+    WorkParallelForN(
+        numVertices,
+        [&weights, numInfluences, maxInfluenceCount, indicesData, weightsData](
+            size_t begin, size_t end) {
+            for (size_t vert = begin; vert < end; ++vert) {
+                // Looping through each vertex.
+                const unsigned int inputOffset = static_cast<unsigned int>(vert) * numInfluences;
+                const size_t       firstOutput = vert * maxInfluenceCount;
+                size_t             outputOffset = firstOutput;
+                for (unsigned int i = 0; i < numInfluences; ++i) {
+                    // Looping through each weight for vertex.
+                    float weight = weights[inputOffset + i];
+                    if (!GfIsClose(weight, 0.0, 1e-8)) {
+                        indicesData[outputOffset] = i;
+                        weightsData[outputOffset] = weight;
+                        outputOffset++;
+                    }
+                }
+
+                // Insertion sort, the vertices only have a few influences.
+                for (size_t j = firstOutput + 1; j < outputOffset; ++j) {
+                    const int   index = indicesData[j];
+                    const float weight = weightsData[j];
+                    size_t      k = j;
+                    for (; k > firstOutput && weightsData[k - 1] < weight; --k) {
+                        indicesData[k] = indicesData[k - 1];
+                        weightsData[k] = weightsData[k - 1];
+                    }
+                    indicesData[k] = index;
+                    weightsData[k] = weight;
+                }
             }
-        }
-    }
+        });
     return maxInfluenceCount;
 }
 
@@ -323,7 +358,7 @@ bool UsdMayaJointUtil::writeJointInfluences(
 {
     // The data in the skinCluster is essentially already in the same format
     // as UsdSkel expects, but we're going to compress it by only outputting
-    // the nonzero weights.
+    // the nonzero weights. The compressed influences are already sorted.
     VtIntArray   jointIndices;
     VtFloatArray jointWeights;
     int          maxInfluenceCount
@@ -332,8 +367,6 @@ bool UsdMayaJointUtil::writeJointInfluences(
     if (maxInfluenceCount <= 0)
         return false;
 
-    UsdSkelSortInfluences(&jointIndices, &jointWeights, maxInfluenceCount);
-
     UsdGeomPrimvar indicesPrimvar = binding.CreateJointIndicesPrimvar(false, maxInfluenceCount);
     indicesPrimvar.Set(jointIndices);
 
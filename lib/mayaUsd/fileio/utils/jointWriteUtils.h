@@ -100,7 +100,8 @@ MObject getInputMesh(const MFnSkinCluster& skinCluster);
 
 /// Gets skin weights, and compresses them into the form expected by
 /// UsdSkelBindingAPI, which allows us to omit zero-weight influences from the
-/// joint weights list.
+/// joint weights list. The influences of each point are sorted by decreasing
+/// weight.
 MAYAUSD_CORE_PUBLIC
 int getCompressedSkinWeights(
     const MFnMesh&        mesh,
@@ -28,6 +28,7 @@
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/subset.h>
@@ -45,7 +46,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItMeshEdge.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
@@ -159,32 +159,41 @@ MIntArray getMayaFaceVertexAssignmentIds(
 {
     MIntArray valueIds(meshFn.numFaceVertices(), -1);
 
-    MItMeshFaceVertex itFV(meshFn.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int valueId = 0;
-        if (interpolation == UsdGeomTokens->constant) {
-            valueId = 0;
-        } else if (interpolation == UsdGeomTokens->uniform) {
-            valueId = itFV.faceId();
-        } else if (interpolation == UsdGeomTokens->vertex) {
-            valueId = itFV.vertId();
-        } else if (interpolation == UsdGeomTokens->faceVarying) {
-            valueId = fvi;
-        }
+    // Visit the face vertices in the same order as MItMeshFaceVertex, face by
+    // face, but from the topology arrays fetched once.
+    MIntArray vertexCounts;
+    MIntArray vertexList;
+    meshFn.getVertices(vertexCounts, vertexList);
+
+    const bool isUniform = interpolation == UsdGeomTokens->uniform;
+    const bool isVertex = interpolation == UsdGeomTokens->vertex;
+    const bool isFaceVarying = interpolation == UsdGeomTokens->faceVarying;
+
+    unsigned int fvi = 0;
+    for (unsigned int faceId = 0; faceId < vertexCounts.length(); ++faceId) {
+        for (int i = 0; i < vertexCounts[faceId] && fvi < valueIds.length(); ++i, ++fvi) {
+            int valueId = 0;
+            if (isUniform) {
+                valueId = faceId;
+            } else if (isVertex) {
+                valueId = vertexList[fvi];
+            } else if (isFaceVarying) {
+                valueId = fvi;
+            }
 
-        if (static_cast<size_t>(valueId) < assignmentIndices.size()) {
-            // The data is indexed, so consult the indices array for the
-            // correct index into the data.
-            valueId = assignmentIndices[valueId];
+            if (static_cast<size_t>(valueId) < assignmentIndices.size()) {
+                // The data is indexed, so consult the indices array for the
+                // correct index into the data.
+                valueId = assignmentIndices[valueId];
 
-            if (valueId == unauthoredValuesIndex) {
-                // This component had no authored value, so leave it unassigned.
-                continue;
+                if (valueId == unauthoredValuesIndex) {
+                    // This component had no authored value, so leave it unassigned.
+                    continue;
+                }
             }
-        }
 
-        valueIds[fvi] = valueId;
+            valueIds[fvi] = valueId;
+        }
     }
 
     return valueIds;
@@ -243,16 +252,20 @@ bool assignUVSetPrimvarToMesh(const UsdGeomPrimvar& primvar, MFnMesh& meshFn, bo
     // meaning.
     const int unauthoredValuesIndex = primvar.GetUnauthoredValuesIndex();
 
-    MFloatArray uCoords;
-    MFloatArray vCoords;
+    MFloatArray  uCoords(uvValues.size());
+    MFloatArray  vCoords(uvValues.size());
+    unsigned int numCoords = 0u;
 
     for (size_t uvId = 0u; uvId < uvValues.size(); ++uvId) {
         if (unauthoredValuesIndex < 0 || uvId != static_cast<size_t>(unauthoredValuesIndex)) {
             const GfVec2f& v = uvValues[uvId];
-            uCoords.append(v[0u]);
-            vCoords.append(v[1u]);
+            uCoords[numCoords] = v[0u];
+            vCoords[numCoords] = v[1u];
+            ++numCoords;
         }
     }
+    uCoords.setLength(numCoords);
+    vCoords.setLength(numCoords);
 
     status = meshFn.setUVs(uCoords, vCoords, &uvSetName);
     if (status != MS::kSuccess) {
@@ -400,6 +413,16 @@ bool assignColorSetPrimvarToMesh(
         unauthoredValuesIndex = primvar.GetUnauthoredValuesIndex();
     }
 
+    // Display colors are converted in bulk, once per authored value rather
+    // than once per component. Alpha is not affected by the conversion.
+    if (isDisplayColor) {
+        if (colorRep == MFnMesh::kRGB) {
+            MayaUsd::utils::ConvertLinearToMaya(rgbArray.data(), rgbArray.size());
+        } else if (colorRep == MFnMesh::kRGBA) {
+            MayaUsd::utils::ConvertLinearToMaya(rgbaArray.data(), rgbaArray.size());
+        }
+    }
+
     // Go through the color data and translate the values into MColors in the
     // colorArray, taking into consideration that indexed data may have been
     // authored sparsely. If the assignmentIndices array is empty then the data
@@ -411,7 +434,8 @@ bool assignColorSetPrimvarToMesh(
     // values are ordered in the primvar. Because of this, we recycle the
     // assignmentIndices array as we go to store the new mapping from component
     // index to color index.
-    MColorArray colorArray;
+    MColorArray  colorArray(numValues);
+    unsigned int numColors = 0u;
     for (size_t i = 0; i < numValues; ++i) {
         int valueIndex = i;
 
@@ -428,9 +452,9 @@ bool assignColorSetPrimvarToMesh(
                 continue;
             }
 
-            // We'll be appending a new value, so the current length of the
-            // array gives us the new value's index.
-            assignmentIndices[i] = colorArray.length();
+            // We'll be adding a new value, so the number of values added so
+            // far gives us the new value's index.
+            assignmentIndices[i] = numColors;
         }
 
         GfVec4f colorValue(1.0);
@@ -451,13 +475,10 @@ bool assignColorSetPrimvarToMesh(
         default: break;
         }
 
-        if (isDisplayColor) {
-            colorValue = MayaUsd::utils::ConvertLinearToMaya(colorValue);
-        }
-
-        MColor mColor(colorValue[0], colorValue[1], colorValue[2], colorValue[3]);
-        colorArray.append(mColor);
+        colorArray[numColors++]
+            = MColor(colorValue[0], colorValue[1], colorValue[2], colorValue[3]);
     }
+    colorArray.setLength(numColors);
 
     // colorArray now stores all of the values and any unassigned components
     // have had their indices set to -1, so update the unauthored values index.
@@ -898,14 +919,19 @@ UsdMayaMeshReadUtils::getComponentTags(const UsdGeomMesh& mesh, std::vector<Comp
     std::vector<UsdGeomSubset> subsets
         = UsdGeomSubset::GetGeomSubsets(mesh, UsdGeomTokens->face, componentTagFamilyName);
 
-    for (auto& ss : subsets) {
-        // Get the tagName out of the subset
-        MString tagName(ss.GetPrim().GetName().GetText());
+    // Read the indices of all the subsets up front, in parallel since meshes used for rigging
+    // and shading can have hundreds of them.
+    std::vector<VtIntArray> subsetsFaceIndices(subsets.size());
+    WorkParallelForN(subsets.size(), [&subsets, &subsetsFaceIndices](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            subsets[i].GetIndicesAttr().Get(&subsetsFaceIndices[i]);
+        }
+    });
 
-        // Get the indices out of the subset
-        VtIntArray   faceIndices;
-        UsdAttribute indicesAttribute = ss.GetIndicesAttr();
-        indicesAttribute.Get(&faceIndices);
+    tags.reserve(tags.size() + subsets.size());
+    for (size_t i = 0; i < subsets.size(); ++i) {
+        // Get the tagName out of the subset
+        MString tagName(subsets[i].GetPrim().GetName().GetText());
 
         MFnSingleIndexedComponent compFn;
         MObject                   faceComp = compFn.create(MFn::kMeshPolygonComponent, &status);
@@ -914,8 +940,8 @@ UsdMayaMeshReadUtils::getComponentTags(const UsdGeomMesh& mesh, std::vector<Comp
             return status;
         }
 
-        MIntArray mFaces;
-        TF_FOR_ALL(fIdxIt, faceIndices) { mFaces.append(*fIdxIt); }
+        const VtIntArray& faceIndices = subsetsFaceIndices[i];
+        MIntArray         mFaces(faceIndices.cdata(), faceIndices.size());
         compFn.addElements(mFaces);
 
         tags.emplace_back(tagName, faceComp);
@@ -30,6 +30,7 @@
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/pointBased.h>
@@ -48,7 +49,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItDependencyGraph.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 #include <maya/MPoint.h>
@@ -56,6 +56,10 @@
 #include <maya/MUintArray.h>
 #include <maya/MVector.h>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 static constexpr char kMayaAttrNameInMesh[] = "inMesh";
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -338,16 +342,25 @@ void MergeEquivalentColorSetValues(
     }
 }
 
-GfVec3f LinearColorFromColorSet(const MColor& mayaColor, bool shouldConvertToLinear)
+// Returns the index of the first face vertex of each face of the mesh, followed
+// by the number of face vertices. Face vertices are numbered in the order of
+// the faces, which is the order of the face-varying data returned by MFnMesh.
+std::vector<unsigned int> getFaceVertexOffsets(const MFnMesh& mesh)
 {
-    // we assume all color sets except displayColor are in linear space.
-    // if we got a color from colorSetData and we're a displayColor, we
-    // need to convert it to linear.
-    GfVec3f c(mayaColor[0], mayaColor[1], mayaColor[2]);
-    if (shouldConvertToLinear) {
-        return MayaUsd::utils::ConvertMayaToLinear(c);
-    }
-    return c;
+    std::vector<unsigned int> offsets;
+
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (!mesh.getVertices(faceVertexCounts, faceVertexIndices)) {
+        return offsets;
+    }
+
+    offsets.resize(faceVertexCounts.length() + 1u);
+    offsets[0] = 0u;
+    for (unsigned int face = 0u; face < faceVertexCounts.length(); ++face) {
+        offsets[face + 1u] = offsets[face] + static_cast<unsigned int>(faceVertexCounts[face]);
+    }
+    return offsets;
 }
 
 } // anonymous namespace
@@ -791,30 +804,63 @@ void UsdMayaMeshWriteUtils::assignSubDivTagsToUSDPrim(
     }
 }
 
-void UsdMayaMeshWriteUtils::writePointsData(
-    const MFnMesh&             meshFn,
-    UsdGeomMesh&               primSchema,
-    const UsdTimeCode&         usdTime,
-    UsdUtilsSparseValueWriter* valueWriter)
+bool UsdMayaMeshWriteUtils::readPointsData(
+    const MFnMesh& meshFn,
+    VtVec3fArray*  points,
+    VtVec3fArray*  extent)
 {
     MStatus status { MS::kSuccess };
 
     const uint32_t numVertices = meshFn.numVertices();
     const float*   pointsData = meshFn.getRawPoints(&status);
     if (!status) {
+        return false;
+    }
+
+    const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(pointsData);
+    points->assign(vecData, vecData + numVertices);
+    extent->resize(2);
+    // Compute the extent using the raw points
+    UsdGeomPointBased::ComputeExtent(*points, extent);
+    return true;
+}
+
+void UsdMayaMeshWriteUtils::writePointsData(
+    const MFnMesh&             meshFn,
+    UsdGeomMesh&               primSchema,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter,
+    VtVec3fArray*              previousPoints)
+{
+    VtVec3fArray points;
+    VtVec3fArray extent;
+    if (!readPointsData(meshFn, &points, &extent)) {
         MGlobal::displayError(
             MString("Unable to access mesh vertices on mesh: ") + meshFn.fullPathName());
         return;
     }
 
-    const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(pointsData);
-    VtVec3fArray   points(vecData, vecData + numVertices);
-    VtVec3fArray   extent(2);
-    // Compute the extent using the raw points
-    UsdGeomPointBased::ComputeExtent(points, &extent);
+    writePointsData(points, extent, primSchema, usdTime, valueWriter, previousPoints);
+}
 
-    UsdMayaWriteUtil::SetAttribute(primSchema.GetPointsAttr(), &points, usdTime, valueWriter);
-    UsdMayaWriteUtil::SetAttribute(primSchema.CreateExtentAttr(), &extent, usdTime, valueWriter);
+void UsdMayaMeshWriteUtils::writePointsData(
+    const VtVec3fArray&        points,
+    const VtVec3fArray&        extent,
+    UsdGeomMesh&               primSchema,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter,
+    VtVec3fArray*              previousPoints)
+{
+    if (previousPoints) {
+        // Shares the data of the points, only copied if they differ from the
+        // previous sample.
+        VtVec3fArray pointsSample(points);
+        UsdMayaWriteUtil::SetArrayAttribute(
+            primSchema.GetPointsAttr(), &pointsSample, previousPoints, usdTime, valueWriter);
+    } else {
+        UsdMayaWriteUtil::SetAttribute(primSchema.GetPointsAttr(), points, usdTime, valueWriter);
+    }
+    UsdMayaWriteUtil::SetAttribute(primSchema.CreateExtentAttr(), extent, usdTime, valueWriter);
 }
 
 void UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
@@ -898,40 +944,63 @@ bool UsdMayaMeshWriteUtils::getMeshUVSetData(
         return false;
     }
 
-    uvArray->clear();
-    uvArray->reserve(static_cast<size_t>(uArray.length()));
-    for (unsigned int uvId = 0u; uvId < uArray.length(); ++uvId) {
-#if PXR_VERSION >= 2011
-        uvArray->emplace_back(uArray[uvId], vArray[uvId]);
-#else
-        GfVec2f value(uArray[uvId], vArray[uvId]);
-        uvArray->push_back(value);
-#endif
+    const unsigned int numUVs = uArray.length();
+    uvArray->resize(static_cast<size_t>(numUVs));
+    GfVec2f* uvData = uvArray->data();
+    WorkParallelForN(numUVs, [&uArray, &vArray, uvData](size_t begin, size_t end) {
+        for (size_t uvId = begin; uvId < end; ++uvId) {
+            const unsigned int i = static_cast<unsigned int>(uvId);
+            uvData[uvId] = GfVec2f(uArray[i], vArray[i]);
+        }
+    });
+
+    // Now fill in the faceVarying assignmentIndices array, again in the same
+    // order as in the Maya mesh. The UV ids of the mapped faces are packed in
+    // uvIds, so the offsets of both the face vertices and the UV ids of each
+    // face are accumulated first to fill the faces in parallel.
+    const std::vector<unsigned int> faceVertexOffsets = getFaceVertexOffsets(mesh);
+    if (faceVertexOffsets.size() != uvCounts.length() + 1u) {
+        return false;
     }
 
-    // Now iterate through all the face vertices and fill in the faceVarying
-    // assignmentIndices array, again in the same order as in the Maya mesh.
-    const unsigned int numFaceVertices = mesh.numFaceVertices(&status);
-    CHECK_MSTATUS_AND_RETURN(status, false);
+    std::vector<unsigned int> uvIdOffsets(faceVertexOffsets.size(), 0u);
+    for (unsigned int face = 0u; face < uvCounts.length(); ++face) {
+        uvIdOffsets[face + 1u] = uvIdOffsets[face] + static_cast<unsigned int>(uvCounts[face]);
+    }
+    if (uvIdOffsets.back() > uvIds.length()) {
+        return false;
+    }
 
-    assignmentIndices->assign(static_cast<size_t>(numFaceVertices), -1);
+    assignmentIndices->assign(static_cast<size_t>(faceVertexOffsets.back()), -1);
     *interpolation = UsdGeomTokens->faceVarying;
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0u;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        if (!itFV.hasUVs(uvSetName)) {
-            // No UVs for this faceVertex, so leave it unassigned.
-            continue;
-        }
-
-        int uvIndex;
-        itFV.getUVIndex(uvIndex, &uvSetName);
-        if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= uArray.length()) {
-            return false;
-        }
+    int*              indicesData = assignmentIndices->data();
+    std::atomic<bool> validIndices(true);
+    WorkParallelForN(
+        uvCounts.length(),
+        [&uvCounts, &uvIds, &faceVertexOffsets, &uvIdOffsets, numUVs, indicesData, &validIndices](
+            size_t begin, size_t end) {
+            for (size_t face = begin; face < end; ++face) {
+                // No UVs for the vertices of this face, so leave them unassigned.
+                const unsigned int numFaceVertices
+                    = faceVertexOffsets[face + 1u] - faceVertexOffsets[face];
+                if (static_cast<unsigned int>(uvCounts[static_cast<unsigned int>(face)])
+                    != numFaceVertices) {
+                    continue;
+                }
 
-        (*assignmentIndices)[fvi] = uvIndex;
+                for (unsigned int i = 0u; i < numFaceVertices; ++i) {
+                    const int uvIndex = uvIds[uvIdOffsets[face] + i];
+                    if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= numUVs) {
+                        validIndices = false;
+                        return;
+                    }
+                    indicesData[faceVertexOffsets[face] + i] = uvIndex;
+                }
+            }
+        });
+    if (!validIndices) {
+        return false;
     }
 
     // We do not merge indexed values or compress indices here in an effort to
@@ -1291,109 +1360,148 @@ bool UsdMayaMeshWriteUtils::getMeshColorSetData(
     colorSetAssignmentIndices->assign((size_t)colorSetData.length(), -1);
     *interpolation = UsdGeomTokens->faceVarying;
 
-    // Loop over every face vertex to populate the value arrays.
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        // If this is a displayColor color set, we may need to fallback on the
-        // bound shader colors/alphas for this face in some cases. In
-        // particular, if the color set is alpha-only, we fallback on the
-        // shader values for the color. If the color set is RGB-only, we
-        // fallback on the shader values for alpha only. If there's no authored
-        // color for this face vertex, we use both the color AND alpha values
-        // from the shader.
-        bool useShaderColorFallback = false;
-        bool useShaderAlphaFallback = false;
-        if (isDisplayColor) {
-            if (colorSetData[fvi] == unsetColor) {
-                useShaderColorFallback = true;
-                useShaderAlphaFallback = true;
-            } else if (*colorSetRep == MFnMesh::kAlpha) {
-                // The color set does not provide color, so fallback on shaders.
-                useShaderColorFallback = true;
-            } else if (*colorSetRep == MFnMesh::kRGB) {
-                // The color set does not provide alpha, so fallback on shaders.
-                useShaderAlphaFallback = true;
-            }
-        }
+    // The face vertex colors are in the order of the faces, so the face
+    // vertices are processed in parallel from the face of each of them, and
+    // the authored values are compacted afterwards.
+    const std::vector<unsigned int> faceVertexOffsets = getFaceVertexOffsets(mesh);
+    if (faceVertexOffsets.empty() || faceVertexOffsets.back() != colorSetData.length()) {
+        return false;
+    }
 
-        // If we're exporting displayColor and we use the value from the color
-        // set, we need to convert it to linear.
-        bool convertDisplayColorToLinear = isDisplayColor;
-
-        // Shader values for the mesh could be constant
-        // (shadersAssignmentIndices is empty) or uniform.
-        int faceIndex = itFV.faceId();
-        if (useShaderColorFallback) {
-            // There was no color value in the color set to use, so we use the
-            // shader color, or the default color if there is no shader color.
-            // This color will already be in linear space, so don't convert it
-            // again.
-            convertDisplayColorToLinear = false;
-
-            int valueIndex = -1;
-            if (shadersAssignmentIndices.empty()) {
-                if (shadersRGBData.size() == 1) {
-                    valueIndex = 0;
+    std::vector<int> faceIds(colorSetData.length());
+    for (size_t face = 0u; face + 1u < faceVertexOffsets.size(); ++face) {
+        std::fill(
+            faceIds.begin() + faceVertexOffsets[face],
+            faceIds.begin() + faceVertexOffsets[face + 1u],
+            static_cast<int>(face));
+    }
+
+    std::vector<GfVec3f> rgbValues(colorSetData.length());
+    std::vector<float>   alphaValues(colorSetData.length());
+    std::vector<char>    convertToLinear(colorSetData.length(), false);
+    WorkParallelForN(colorSetData.length(), [&](size_t begin, size_t end) {
+        for (unsigned int fvi = static_cast<unsigned int>(begin); fvi < end; ++fvi) {
+            // If this is a displayColor color set, we may need to fallback on the
+            // bound shader colors/alphas for this face in some cases. In
+            // particular, if the color set is alpha-only, we fallback on the
+            // shader values for the color. If the color set is RGB-only, we
+            // fallback on the shader values for alpha only. If there's no authored
+            // color for this face vertex, we use both the color AND alpha values
+            // from the shader.
+            bool useShaderColorFallback = false;
+            bool useShaderAlphaFallback = false;
+            if (isDisplayColor) {
+                if (colorSetData[fvi] == unsetColor) {
+                    useShaderColorFallback = true;
+                    useShaderAlphaFallback = true;
+                } else if (*colorSetRep == MFnMesh::kAlpha) {
+                    // The color set does not provide color, so fallback on shaders.
+                    useShaderColorFallback = true;
+                } else if (*colorSetRep == MFnMesh::kRGB) {
+                    // The color set does not provide alpha, so fallback on shaders.
+                    useShaderAlphaFallback = true;
                 }
-            } else if (
-                faceIndex >= 0
-                && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+            }
 
-                int tmpIndex = shadersAssignmentIndices[faceIndex];
-                if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersRGBData.size()) {
-                    valueIndex = tmpIndex;
+            // If we're exporting displayColor and we use the value from the color
+            // set, we need to convert it to linear.
+            bool convertDisplayColorToLinear = isDisplayColor;
+
+            // Shader values for the mesh could be constant
+            // (shadersAssignmentIndices is empty) or uniform.
+            const int faceIndex = faceIds[fvi];
+            if (useShaderColorFallback) {
+                // There was no color value in the color set to use, so we use the
+                // shader color, or the default color if there is no shader color.
+                // This color will already be in linear space, so don't convert it
+                // again.
+                convertDisplayColorToLinear = false;
+
+                int valueIndex = -1;
+                if (shadersAssignmentIndices.empty()) {
+                    if (shadersRGBData.size() == 1) {
+                        valueIndex = 0;
+                    }
+                } else if (
+                    faceIndex >= 0
+                    && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+
+                    int tmpIndex = shadersAssignmentIndices[faceIndex];
+                    if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersRGBData.size()) {
+                        valueIndex = tmpIndex;
+                    }
+                }
+                if (valueIndex >= 0) {
+                    colorSetData[fvi][0] = shadersRGBData[valueIndex][0];
+                    colorSetData[fvi][1] = shadersRGBData[valueIndex][1];
+                    colorSetData[fvi][2] = shadersRGBData[valueIndex][2];
+                } else {
+                    // No shader color to fallback on. Use the default shader color.
+                    colorSetData[fvi][0] = UnauthoredShaderRGB[0];
+                    colorSetData[fvi][1] = UnauthoredShaderRGB[1];
+                    colorSetData[fvi][2] = UnauthoredShaderRGB[2];
                 }
             }
-            if (valueIndex >= 0) {
-                colorSetData[fvi][0] = shadersRGBData[valueIndex][0];
-                colorSetData[fvi][1] = shadersRGBData[valueIndex][1];
-                colorSetData[fvi][2] = shadersRGBData[valueIndex][2];
-            } else {
-                // No shader color to fallback on. Use the default shader color.
-                colorSetData[fvi][0] = UnauthoredShaderRGB[0];
-                colorSetData[fvi][1] = UnauthoredShaderRGB[1];
-                colorSetData[fvi][2] = UnauthoredShaderRGB[2];
-            }
-        }
-        if (useShaderAlphaFallback) {
-            int valueIndex = -1;
-            if (shadersAssignmentIndices.empty()) {
-                if (shadersAlphaData.size() == 1) {
-                    valueIndex = 0;
+            if (useShaderAlphaFallback) {
+                int valueIndex = -1;
+                if (shadersAssignmentIndices.empty()) {
+                    if (shadersAlphaData.size() == 1) {
+                        valueIndex = 0;
+                    }
+                } else if (
+                    faceIndex >= 0
+                    && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+                    int tmpIndex = shadersAssignmentIndices[faceIndex];
+                    if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersAlphaData.size()) {
+                        valueIndex = tmpIndex;
+                    }
                 }
-            } else if (
-                faceIndex >= 0
-                && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
-                int tmpIndex = shadersAssignmentIndices[faceIndex];
-                if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersAlphaData.size()) {
-                    valueIndex = tmpIndex;
+                if (valueIndex >= 0) {
+                    colorSetData[fvi][3] = shadersAlphaData[valueIndex];
+                } else {
+                    // No shader alpha to fallback on. Use the default shader alpha.
+                    colorSetData[fvi][3] = UnauthoredShaderAlpha;
                 }
             }
-            if (valueIndex >= 0) {
-                colorSetData[fvi][3] = shadersAlphaData[valueIndex];
-            } else {
-                // No shader alpha to fallback on. Use the default shader alpha.
-                colorSetData[fvi][3] = UnauthoredShaderAlpha;
-            }
-        }
 
-        // If we have a color/alpha value, add it to the data to be returned.
-        if (colorSetData[fvi] != unsetColor) {
-            GfVec3f rgbValue = UnauthoredColorSetRGB;
-            float   alphaValue = UnauthoredColorAlpha;
+            if (colorSetData[fvi] != unsetColor) {
+                GfVec3f rgbValue = UnauthoredColorSetRGB;
+                float   alphaValue = UnauthoredColorAlpha;
+
+                if (useShaderColorFallback || (*colorSetRep == MFnMesh::kRGB)
+                    || (*colorSetRep == MFnMesh::kRGBA)) {
+                    rgbValue.Set(colorSetData[fvi][0], colorSetData[fvi][1], colorSetData[fvi][2]);
+                    convertToLinear[fvi] = convertDisplayColorToLinear;
+                }
+                if (useShaderAlphaFallback || (*colorSetRep == MFnMesh::kAlpha)
+                    || (*colorSetRep == MFnMesh::kRGBA)) {
+                    alphaValue = colorSetData[fvi][3];
+                }
 
-            if (useShaderColorFallback || (*colorSetRep == MFnMesh::kRGB)
-                || (*colorSetRep == MFnMesh::kRGBA)) {
-                rgbValue = LinearColorFromColorSet(colorSetData[fvi], convertDisplayColorToLinear);
+                rgbValues[fvi] = rgbValue;
+                alphaValues[fvi] = alphaValue;
             }
-            if (useShaderAlphaFallback || (*colorSetRep == MFnMesh::kAlpha)
-                || (*colorSetRep == MFnMesh::kRGBA)) {
-                alphaValue = colorSetData[fvi][3];
+        }
+
+        // We assume all color sets except displayColor are in linear space.
+        // The displayColor values from the color set are converted to linear
+        // in bulk, by runs of consecutive face vertices.
+        size_t runBegin = begin;
+        while (runBegin < end) {
+            size_t runEnd = runBegin;
+            while (runEnd < end && convertToLinear[runEnd]) {
+                ++runEnd;
             }
+            MayaUsd::utils::ConvertMayaToLinear(rgbValues.data() + runBegin, runEnd - runBegin);
+            runBegin = std::max(runEnd, runBegin + 1);
+        }
+    });
 
-            colorSetRGBData->push_back(rgbValue);
-            colorSetAlphaData->push_back(alphaValue);
+    // If we have a color/alpha value, add it to the data to be returned.
+    for (unsigned int fvi = 0u; fvi < colorSetData.length(); ++fvi) {
+        if (colorSetData[fvi] != unsetColor) {
+            colorSetRGBData->push_back(rgbValues[fvi]);
+            colorSetAlphaData->push_back(alphaValues[fvi]);
             (*colorSetAssignmentIndices)[fvi] = colorSetRGBData->size() - 1;
         }
     }
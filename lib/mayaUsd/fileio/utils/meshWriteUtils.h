@@ -116,12 +116,31 @@ void assignSubDivTagsToUSDPrim(
     UsdGeomMesh&               primSchema,
     UsdUtilsSparseValueWriter* valueWriter);
 
+/// Writes the points and extent of a mesh. When given, \p previousPoints is
+/// the previous sample of the points, compared with the new one before it is
+/// handed to \p valueWriter, see UsdMayaWriteUtil::SetArrayAttribute().
 MAYAUSD_CORE_PUBLIC
 void writePointsData(
     const MFnMesh&             meshFn,
     UsdGeomMesh&               primSchema,
     const UsdTimeCode&         usdTime,
-    UsdUtilsSparseValueWriter* valueWriter);
+    UsdUtilsSparseValueWriter* valueWriter,
+    VtVec3fArray*              previousPoints = nullptr);
+
+/// Writes points and extent already read from a mesh, see readPointsData().
+MAYAUSD_CORE_PUBLIC
+void writePointsData(
+    const VtVec3fArray&        points,
+    const VtVec3fArray&        extent,
+    UsdGeomMesh&               primSchema,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter,
+    VtVec3fArray*              previousPoints = nullptr);
+
+/// Reads the points of a mesh and computes their extent. Only reads Maya
+/// data, so it can be called for several meshes from worker threads.
+MAYAUSD_CORE_PUBLIC
+bool readPointsData(const MFnMesh& meshFn, VtVec3fArray* points, VtVec3fArray* extent);
 
 MAYAUSD_CORE_PUBLIC
 void writeFaceVertexIndicesData(
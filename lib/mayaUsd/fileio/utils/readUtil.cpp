@@ -25,6 +25,7 @@
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/envSetting.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/sdf/listOp.h>
 #include <pxr/usd/usd/tokens.h>
@@ -52,6 +53,8 @@
 #include <maya/MTimeArray.h>
 #include <maya/MVectorArray.h>
 
+#include <atomic>
+
 using namespace MAYAUSD_NS_DEF;
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -988,15 +991,18 @@ static bool _GetValuesInInterval(
     size_t numTimeSamples = timeSamples.size();
     values.resize(numTimeSamples);
 
-    for (size_t i = 0; i < numTimeSamples; ++i) {
-        const double timeSample = timeSamples[i];
-        T            attrValue;
-        if (!usdAttr.Get(&attrValue, timeSample)) {
-            return false;
+    // The samples are resolved from worker threads, the anim curves are then
+    // created from the values in a single addKeys() call.
+    std::atomic<bool> gotAllValues(true);
+    WorkParallelForN(numTimeSamples, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (!usdAttr.Get(&values[i], timeSamples[i])) {
+                gotAllValues = false;
+                return;
+            }
         }
-        values[i] = attrValue;
-    }
-    return true;
+    });
+    return gotAllValues;
 }
 
 // Check if this usd attribute is animated and eventually connect an animation
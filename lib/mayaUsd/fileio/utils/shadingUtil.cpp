@@ -21,7 +21,10 @@
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/ar/packageUtils.h>
+#include <pxr/usd/sdf/layerUtils.h>
 #include <pxr/usd/sdf/valueTypeName.h>
+#include <pxr/usd/usd/resolver.h>
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/sdr/shaderNode.h>
 #include <pxr/usd/usdShade/input.h>
@@ -41,9 +44,13 @@
 
 #include <ghc/filesystem.hpp>
 
+#include <map>
 #include <regex>
 #include <string>
 #include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -355,3 +362,93 @@ int UsdMayaShadingUtil::GetNumberOfChannels(const std::string& fileTextureName)
     }
 }
 #endif
+
+namespace {
+// Per-import caches of the texture path resolution. Import runs on the main thread.
+using _LayerAndPath = std::pair<std::string, std::string>;
+std::map<_LayerAndPath, std::string> _anchoredPathCache;
+
+// Regular files of each directory listed by FileExists(), by directory.
+std::unordered_map<std::string, std::unordered_set<std::string>> _directoryFilesCache;
+
+std::string _fileNameKey(const ghc::filesystem::path& path)
+{
+#ifdef _WIN32
+    return TfStringToLower(path.filename().string());
+#else
+    return path.filename().string();
+#endif
+}
+
+std::unordered_set<std::string>& _getDirectoryFiles(const ghc::filesystem::path& dirPath)
+{
+    const std::string dirKey = dirPath.generic_string();
+    auto              found = _directoryFilesCache.find(dirKey);
+    if (found != _directoryFilesCache.end()) {
+        return found->second;
+    }
+
+    std::unordered_set<std::string>& files = _directoryFilesCache[dirKey];
+    std::error_code                  ec;
+    for (ghc::filesystem::directory_iterator it(dirKey.empty() ? "." : dirKey, ec), end;
+         !ec && it != end;
+         it.increment(ec)) {
+        if (it->is_regular_file(ec)) {
+            files.insert(_fileNameKey(it->path()));
+        }
+    }
+    return files;
+}
+} // namespace
+
+std::string
+UsdMayaShadingUtil::ResolveUdimFirstTile(const UsdPrim& prim, const std::string& udimFileName)
+{
+    const std::string&     udimTag = _tokens->UDIMTag.GetString();
+    std::string::size_type udimPos = udimFileName.rfind(udimTag);
+    if (udimPos == std::string::npos) {
+        return udimFileName;
+    }
+
+    std::string udimPath(udimFileName.substr(0, udimPos));
+    udimPath += "1001";
+    udimPath += udimFileName.substr(udimPos + udimTag.size());
+
+    // The same texture directories are usually referenced by many file nodes authored in the
+    // same few layers, so only compute the anchored path once per layer.
+    Usd_Resolver res(&prim.GetPrimIndex());
+    for (; res.IsValid(); res.NextLayer()) {
+        const SdfLayerHandle& layer = res.GetLayer();
+        auto                  insertion = _anchoredPathCache.emplace(
+            _LayerAndPath(layer->GetIdentifier(), udimPath), std::string());
+        if (insertion.second) {
+            insertion.first->second = SdfComputeAssetPathRelativeToLayer(layer, udimPath);
+        }
+
+        const std::string& resolvedName = insertion.first->second;
+        if (!resolvedName.empty() && !ArIsPackageRelativePath(resolvedName)
+            && resolvedName != udimPath) {
+            return resolvedName;
+        }
+    }
+
+    return udimPath;
+}
+
+bool UsdMayaShadingUtil::FileExists(const std::string& filePath)
+{
+    const ghc::filesystem::path path(filePath);
+    return _getDirectoryFiles(path.parent_path()).count(_fileNameKey(path)) > 0;
+}
+
+void UsdMayaShadingUtil::AddExistingFile(const std::string& filePath)
+{
+    const ghc::filesystem::path path(filePath);
+    _getDirectoryFiles(path.parent_path()).insert(_fileNameKey(path));
+}
+
+void UsdMayaShadingUtil::ClearImportCaches()
+{
+    _anchoredPathCache.clear();
+    _directoryFilesCache.clear();
+}
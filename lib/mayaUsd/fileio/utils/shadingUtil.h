@@ -23,6 +23,7 @@
 #include <pxr/base/tf/token.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/valueTypeName.h>
+#include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdShade/input.h>
 #include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/output.h>
@@ -102,6 +103,27 @@ MAYAUSD_CORE_PUBLIC void ResolveUsdTextureFileName(
 /// Computes how many channels a texture file has by loading its header from disk
 MAYAUSD_CORE_PUBLIC int GetNumberOfChannels(const std::string& fileTextureName);
 
+/// Computes the path of the first tile (1001) of the UDIM-tagged \p udimFileName authored on
+/// \p prim, anchored to the strongest layer of the prim that makes it absolute.
+///
+/// Returns the untagged tile path unchanged if no layer anchors it. Results are cached per
+/// layer until ClearImportCaches() is called.
+MAYAUSD_CORE_PUBLIC std::string
+ResolveUdimFirstTile(const UsdPrim& prim, const std::string& udimFileName);
+
+/// Returns true if \p filePath is an existing regular file.
+///
+/// The parent directory is listed on the first query and the following queries in that
+/// directory are answered from the listing, until ClearImportCaches() is called. Files created
+/// in the meantime must be reported with AddExistingFile().
+MAYAUSD_CORE_PUBLIC bool FileExists(const std::string& filePath);
+
+/// Records that \p filePath was created, for FileExists().
+MAYAUSD_CORE_PUBLIC void AddExistingFile(const std::string& filePath);
+
+/// Clears the caches of ResolveUdimFirstTile() and FileExists(). Called after each import.
+MAYAUSD_CORE_PUBLIC void ClearImportCaches();
+
 } // namespace UsdMayaShadingUtil
 
 PXR_NAMESPACE_CLOSE_SCOPE
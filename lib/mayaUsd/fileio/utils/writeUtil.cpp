@@ -21,6 +21,8 @@
 #include <mayaUsd/utils/colorSpace.h>
 #include <mayaUsd/utils/converter.h>
 
+#include <mayaUsdUtils/DiffCore.h>
+
 #include <pxr/base/gf/gamma.h>
 #include <pxr/base/gf/rotation.h>
 #include <pxr/base/tf/envSetting.h>
@@ -1231,4 +1233,93 @@ std::vector<double> UsdMayaWriteUtil::GetTimeSamples(
     return samples;
 }
 
+template <typename Scalar, typename T>
+static bool _SetArrayAttribute(
+    const UsdAttribute&        attr,
+    VtArray<T>*                value,
+    VtArray<T>*                previousValue,
+    const UsdTimeCode          time,
+    UsdUtilsSparseValueWriter* valueWriter,
+    Scalar                     tolerance)
+{
+    static_assert(sizeof(T) % sizeof(Scalar) == 0, "Array elements must be made of scalars");
+    constexpr size_t numScalars = sizeof(T) / sizeof(Scalar);
+
+    if (valueWriter && !time.IsDefault()) {
+        const bool sameValue = value->size() == previousValue->size()
+            && (value->IsIdentical(*previousValue)
+                || MayaUsdUtils::compareArray(
+                    reinterpret_cast<const Scalar*>(value->cdata()),
+                    reinterpret_cast<const Scalar*>(previousValue->cdata()),
+                    value->size() * numScalars,
+                    previousValue->size() * numScalars,
+                    tolerance));
+
+        // Both arrays share the same data, the value writer compares them by
+        // identity.
+        if (sameValue) {
+            *value = *previousValue;
+        } else {
+            *previousValue = *value;
+        }
+    }
+
+    return UsdMayaWriteUtil::SetAttribute(attr, value, time, valueWriter);
+}
+
+bool UsdMayaWriteUtil::SetArrayAttribute(
+    const UsdAttribute&        attr,
+    VtFloatArray*              value,
+    VtFloatArray*              previousValue,
+    const UsdTimeCode          time,
+    UsdUtilsSparseValueWriter* valueWriter,
+    float                      tolerance)
+{
+    return _SetArrayAttribute(attr, value, previousValue, time, valueWriter, tolerance);
+}
+
+bool UsdMayaWriteUtil::SetArrayAttribute(
+    const UsdAttribute&        attr,
+    VtVec2fArray*              value,
+    VtVec2fArray*              previousValue,
+    const UsdTimeCode          time,
+    UsdUtilsSparseValueWriter* valueWriter,
+    float                      tolerance)
+{
+    return _SetArrayAttribute(attr, value, previousValue, time, valueWriter, tolerance);
+}
+
+bool UsdMayaWriteUtil::SetArrayAttribute(
+    const UsdAttribute&        attr,
+    VtVec3fArray*              value,
+    VtVec3fArray*              previousValue,
+    const UsdTimeCode          time,
+    UsdUtilsSparseValueWriter* valueWriter,
+    float                      tolerance)
+{
+    return _SetArrayAttribute(attr, value, previousValue, time, valueWriter, tolerance);
+}
+
+bool UsdMayaWriteUtil::SetArrayAttribute(
+    const UsdAttribute&        attr,
+    VtDoubleArray*             value,
+    VtDoubleArray*             previousValue,
+    const UsdTimeCode          time,
+    UsdUtilsSparseValueWriter* valueWriter,
+    double                     tolerance)
+{
+    return _SetArrayAttribute(attr, value, previousValue, time, valueWriter, tolerance);
+}
+
+bool UsdMayaWriteUtil::SetArrayAttribute(
+    const UsdAttribute&        attr,
+    VtVec3dArray*              value,
+    VtVec3dArray*              previousValue,
+    const UsdTimeCode          time,
+    UsdUtilsSparseValueWriter* valueWriter,
+    double                     tolerance)
+{
+    return _SetArrayAttribute(attr, value, previousValue, time, valueWriter, tolerance);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -312,6 +312,63 @@ struct UsdMayaWriteUtil
         return valueWriter ? valueWriter->SetAttribute(attr, VtValue::Take(*value), time)
                            : attr.Set(*value, time);
     }
+
+    /// Sets the array \p value of \p attr at \p time like SetAttribute(),
+    /// comparing it first with \p previousValue, the array previously written
+    /// to \p attr, with the SIMD kernels of mayaUsdUtils.
+    ///
+    /// When both arrays are equal within \p tolerance, the data of
+    /// \p previousValue is written instead, so \p valueWriter finds identical
+    /// arrays without comparing their elements again and skips the sample.
+    /// \p previousValue is then set to the written array.
+    MAYAUSD_CORE_PUBLIC
+    static bool SetArrayAttribute(
+        const UsdAttribute&        attr,
+        VtFloatArray*              value,
+        VtFloatArray*              previousValue,
+        const UsdTimeCode          time,
+        UsdUtilsSparseValueWriter* valueWriter,
+        float                      tolerance = 0.0f);
+
+    /// \overload
+    MAYAUSD_CORE_PUBLIC
+    static bool SetArrayAttribute(
+        const UsdAttribute&        attr,
+        VtVec2fArray*              value,
+        VtVec2fArray*              previousValue,
+        const UsdTimeCode          time,
+        UsdUtilsSparseValueWriter* valueWriter,
+        float                      tolerance = 0.0f);
+
+    /// \overload
+    MAYAUSD_CORE_PUBLIC
+    static bool SetArrayAttribute(
+        const UsdAttribute&        attr,
+        VtVec3fArray*              value,
+        VtVec3fArray*              previousValue,
+        const UsdTimeCode          time,
+        UsdUtilsSparseValueWriter* valueWriter,
+        float                      tolerance = 0.0f);
+
+    /// \overload
+    MAYAUSD_CORE_PUBLIC
+    static bool SetArrayAttribute(
+        const UsdAttribute&        attr,
+        VtDoubleArray*             value,
+        VtDoubleArray*             previousValue,
+        const UsdTimeCode          time,
+        UsdUtilsSparseValueWriter* valueWriter,
+        double                     tolerance = 0.0);
+
+    /// \overload
+    MAYAUSD_CORE_PUBLIC
+    static bool SetArrayAttribute(
+        const UsdAttribute&        attr,
+        VtVec3dArray*              value,
+        VtVec3dArray*              previousValue,
+        const UsdTimeCode          time,
+        UsdUtilsSparseValueWriter* valueWriter,
+        double                     tolerance = 0.0);
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
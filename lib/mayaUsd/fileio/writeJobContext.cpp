@@ -21,9 +21,12 @@
 #include <mayaUsd/fileio/primWriterRegistry.h>
 #include <mayaUsd/fileio/transformWriter.h>
 #include <mayaUsd/fileio/translators/skelBindingsProcessor.h>
+#include <mayaUsd/fileio/utils/jointWriteUtils.h>
+#include <mayaUsd/utils/hash.h>
 #include <mayaUsd/utils/stageCache.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
@@ -39,21 +42,35 @@
 #include <pxr/usd/usdGeom/scope.h>
 #include <pxr/usd/usdGeom/xform.h>
 
+#include <maya/MColorArray.h>
+#include <maya/MDagMessage.h>
 #include <maya/MDagPath.h>
 #include <maya/MDagPathArray.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
+#include <maya/MFloatVectorArray.h>
 #include <maya/MFn.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MFnMesh.h>
+#include <maya/MIntArray.h>
 #include <maya/MItDag.h>
+#include <maya/MNodeMessage.h>
 #include <maya/MObject.h>
+#include <maya/MObjectArray.h>
 #include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
 #include <maya/MPxNode.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
+#include <maya/MStringArray.h>
+#include <maya/MUintArray.h>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -82,15 +99,169 @@ inline SdfPath _GetRootOverridePath(
 
 const SdfPath INSTANCES_SCOPE_PATH("/MayaExportedInstanceSources");
 
+// Data of a mesh compared to find its duplicates, flattened in arrays: the
+// geometry, the primvars and the shading assignments.
+struct _MeshDuplicateKey
+{
+    std::vector<float> floats;
+    std::vector<int>   ints;
+    std::string        names;
+
+    bool operator==(const _MeshDuplicateKey& other) const
+    {
+        return ints == other.ints && names == other.names && floats == other.floats;
+    }
+
+    size_t GetHash() const
+    {
+        size_t hash = ArchHash64(floats.data(), floats.size() * sizeof(float));
+        MayaUsd::hash_combine(hash, ArchHash64(ints.data(), ints.size() * sizeof(int)));
+        MayaUsd::hash_combine(hash, names);
+        return hash;
+    }
+
+    void AppendInts(const MIntArray& values)
+    {
+        ints.push_back(static_cast<int>(values.length()));
+        for (unsigned int i = 0; i < values.length(); ++i) {
+            ints.push_back(values[i]);
+        }
+    }
+
+    void AppendFloats(const MFloatArray& values)
+    {
+        ints.push_back(static_cast<int>(values.length()));
+        for (unsigned int i = 0; i < values.length(); ++i) {
+            floats.push_back(values[i]);
+        }
+    }
+
+    void AppendName(const MString& name)
+    {
+        names += name.asChar();
+        names += '\n';
+    }
+};
+
+bool _ReadMeshDuplicateKey(const MDagPath& meshPath, _MeshDuplicateKey* key)
+{
+    MStatus       status;
+    const MFnMesh mesh(meshPath, &status);
+    if (!status) {
+        return false;
+    }
+
+    const float* points = mesh.getRawPoints(&status);
+    if (!status) {
+        return false;
+    }
+    key->floats.assign(points, points + mesh.numVertices() * 3);
+
+    MIntArray counts;
+    MIntArray indices;
+    mesh.getVertices(counts, indices);
+    key->AppendInts(counts);
+    key->AppendInts(indices);
+
+    MFloatVectorArray normals;
+    mesh.getNormals(normals);
+    for (unsigned int i = 0; i < normals.length(); ++i) {
+        key->floats.insert(key->floats.end(), { normals[i].x, normals[i].y, normals[i].z });
+    }
+    mesh.getNormalIds(counts, indices);
+    key->AppendInts(indices);
+
+    MStringArray setNames;
+    mesh.getUVSetNames(setNames);
+    for (unsigned int i = 0; i < setNames.length(); ++i) {
+        MFloatArray us;
+        MFloatArray vs;
+        mesh.getUVs(us, vs, &setNames[i]);
+        mesh.getAssignedUVs(counts, indices, &setNames[i]);
+        key->AppendName(setNames[i]);
+        key->AppendFloats(us);
+        key->AppendFloats(vs);
+        key->AppendInts(indices);
+    }
+
+    mesh.getColorSetNames(setNames);
+    for (unsigned int i = 0; i < setNames.length(); ++i) {
+        MColorArray colors;
+        mesh.getFaceVertexColors(colors, &setNames[i]);
+        key->AppendName(setNames[i]);
+        for (unsigned int j = 0; j < colors.length(); ++j) {
+            key->floats.insert(
+                key->floats.end(), { colors[j].r, colors[j].g, colors[j].b, colors[j].a });
+        }
+    }
+
+    MUintArray   creaseIds;
+    MDoubleArray creaseValues;
+    if (mesh.getCreaseEdges(creaseIds, creaseValues)) {
+        for (unsigned int i = 0; i < creaseIds.length(); ++i) {
+            key->ints.push_back(static_cast<int>(creaseIds[i]));
+            key->floats.push_back(static_cast<float>(creaseValues[i]));
+        }
+    }
+    if (mesh.getCreaseVertices(creaseIds, creaseValues)) {
+        for (unsigned int i = 0; i < creaseIds.length(); ++i) {
+            key->ints.push_back(static_cast<int>(creaseIds[i]));
+            key->floats.push_back(static_cast<float>(creaseValues[i]));
+        }
+    }
+
+    MObjectArray shaders;
+    mesh.getConnectedShaders(meshPath.instanceNumber(), shaders, indices);
+    for (unsigned int i = 0; i < shaders.length(); ++i) {
+        key->AppendName(MFnDependencyNode(shaders[i]).name());
+    }
+    key->AppendInts(indices);
+
+    const MPlug doubleSidedPlug = mesh.findPlug("doubleSided", true);
+    key->ints.push_back(!doubleSidedPlug.isNull() && doubleSidedPlug.asBool());
+
+    return true;
+}
+
 } // anonymous namespace
 
+namespace {
+
+void _ClearDagToUsdPathCache(void* clientData)
+{
+    static_cast<std::unordered_map<std::string, SdfPath>*>(clientData)->clear();
+}
+
+void _OnDagChanged(MDagMessage::DagMessage, MDagPath&, MDagPath&, void* clientData)
+{
+    _ClearDagToUsdPathCache(clientData);
+}
+
+void _OnNameChanged(MObject& node, const MString&, void* clientData)
+{
+    if (node.hasFn(MFn::kDagNode)) {
+        _ClearDagToUsdPathCache(clientData);
+    }
+}
+
+} // namespace
+
 UsdMayaWriteJobContext::UsdMayaWriteJobContext(const UsdMayaJobExportArgs& args)
     : mArgs(args)
     , _skelBindingsProcessor(new UsdMaya_SkelBindingsProcessor())
 {
+    // Renaming or reparenting DAG nodes changes their USD paths.
+    MObject allNodes;
+    _dagToUsdPathCacheCallbacks.append(
+        MDagMessage::addAllDagChangesCallback(_OnDagChanged, &_dagToUsdPathCache));
+    _dagToUsdPathCacheCallbacks.append(
+        MNodeMessage::addNameChangedCallback(allNodes, _OnNameChanged, &_dagToUsdPathCache));
 }
 
-UsdMayaWriteJobContext::~UsdMayaWriteJobContext() = default;
+UsdMayaWriteJobContext::~UsdMayaWriteJobContext()
+{
+    MMessage::removeCallbacks(_dagToUsdPathCacheCallbacks);
+}
 
 static bool _ShouldCreatePrim(const MDagPath& dagPath, bool isMerged)
 {
@@ -189,7 +360,14 @@ bool UsdMayaWriteJobContext::IsMergedTransform(const MDagPath& path) const
 
 SdfPath UsdMayaWriteJobContext::ConvertDagToUsdPath(const MDagPath& dagPath) const
 {
-    SdfPath path = UsdMayaUtil::MDagPathToUsdPath(dagPath, false, mArgs.stripNamespaces);
+    std::string fullPathName = dagPath.fullPathName().asChar();
+
+    const auto cached = _dagToUsdPathCache.find(fullPathName);
+    if (cached != _dagToUsdPathCache.end()) {
+        return cached->second;
+    }
+
+    SdfPath path = UsdMayaUtil::MayaNodeNameToSdfPath(fullPathName, mArgs.stripNamespaces);
 
     // If we're merging transforms and shapes and this is a shape node, then
     // write to the parent (transform) path instead.
@@ -206,7 +384,10 @@ SdfPath UsdMayaWriteJobContext::ConvertDagToUsdPath(const MDagPath& dagPath) con
         // an absolute path...
         path = path.ReplacePrefix(SdfPath::AbsoluteRootPath(), mParentScopePath);
     }
-    return _GetRootOverridePath(mArgs, path, /* modelRootOverride = */ true, /* rootMap = */ false);
+    path = _GetRootOverridePath(mArgs, path, /* modelRootOverride = */ true, /* rootMap = */ false);
+
+    _dagToUsdPathCache.emplace(std::move(fullPathName), path);
+    return path;
 }
 
 UsdMayaWriteJobContext::_ExportAndRefPaths
@@ -256,17 +437,108 @@ UsdMayaWriteJobContext::_GetInstanceMasterPaths(const MDagPath& instancePath) co
     }
 }
 
+MDagPath UsdMayaWriteJobContext::_GetInstanceMasterDagPath(const MDagPath& instancePath) const
+{
+    const auto it = _duplicateMeshMasters.find(MObjectHandle(instancePath.node()));
+    if (it != _duplicateMeshMasters.end()) {
+        return it->second;
+    }
+
+    MDagPathArray allInstances;
+    if (!MDagPath::getAllPathsTo(instancePath.node(), allInstances)
+        || (allInstances.length() == 0)) {
+        return MDagPath();
+    }
+
+    return allInstances[0];
+}
+
+void UsdMayaWriteJobContext::_FindDuplicateMeshes()
+{
+    _duplicateMeshMasters.clear();
+    if (!mArgs.instanceDuplicateMeshes) {
+        return;
+    }
+
+    const bool checkSkinClusters = mArgs.exportSkin != UsdMayaJobExportArgsTokens->none;
+
+    // Meshes grouped by the hash of their data. Each group keeps the data of
+    // its first mesh so that hash collisions are resolved by comparing it.
+    struct _DuplicateGroup
+    {
+        _MeshDuplicateKey     key;
+        std::vector<MDagPath> meshPaths;
+    };
+    std::unordered_map<size_t, std::vector<_DuplicateGroup>> groupsByHash;
+    std::vector<std::pair<size_t, size_t>>                   groupOrder;
+
+    UsdMayaUtil::MDagPathSet visitedPaths;
+    for (const MDagPath& rootPath : mArgs.dagPaths) {
+        MItDag itDag;
+        for (itDag.reset(rootPath); !itDag.isDone(); itDag.next()) {
+            MDagPath curDagPath;
+            itDag.getPath(curDagPath);
+            if (!_NeedToTraverse(curDagPath) || !visitedPaths.insert(curDagPath).second) {
+                itDag.prune();
+                continue;
+            }
+
+            // Instanced meshes are left to exportInstances, and animated or
+            // skinned meshes cannot share a single static master.
+            const MObject meshObj = curDagPath.node();
+            if (!meshObj.hasFn(MFn::kMesh)
+                || MFnDagNode(curDagPath).isInstanced(/* indirect = */ true)
+                || UsdMayaUtil::isAnimated(meshObj)
+                || (checkSkinClusters && !UsdMayaJointUtil::getSkinCluster(curDagPath).isNull())) {
+                continue;
+            }
+
+            _MeshDuplicateKey key;
+            if (!_ReadMeshDuplicateKey(curDagPath, &key)) {
+                continue;
+            }
+
+            const size_t                  hash = key.GetHash();
+            std::vector<_DuplicateGroup>& groups = groupsByHash[hash];
+            const auto                    groupIt = std::find_if(
+                groups.begin(), groups.end(), [&key](const _DuplicateGroup& group) {
+                    return group.key == key;
+                });
+            if (groupIt == groups.end()) {
+                groupOrder.emplace_back(hash, groups.size());
+                groups.push_back({ std::move(key), { curDagPath } });
+            } else {
+                groupIt->meshPaths.push_back(curDagPath);
+            }
+        }
+    }
+
+    // The first mesh of a group, in the order of the traversal, is the one the
+    // instance master is exported from.
+    for (const auto& entry : groupOrder) {
+        const _DuplicateGroup& group = groupsByHash[entry.first][entry.second];
+        if (group.meshPaths.size() < 2u) {
+            continue;
+        }
+        for (const MDagPath& meshPath : group.meshPaths) {
+            _duplicateMeshMasters[MObjectHandle(meshPath.node())] = group.meshPaths.front();
+        }
+    }
+}
+
 UsdMayaWriteJobContext::_ExportAndRefPaths
 UsdMayaWriteJobContext::_FindOrCreateInstanceMaster(const MDagPath& instancePath)
 {
-    const MObjectHandle handle(instancePath.node());
+    // Instances of the same Maya node, or meshes with identical data, share
+    // the master exported from the DAG path of the first of them.
+    const MDagPath      masterDagPath = _GetInstanceMasterDagPath(instancePath);
+    const MObjectHandle handle(
+        masterDagPath.isValid() ? masterDagPath.node() : instancePath.node());
     const auto          it = _objectsToMasterPaths.find(handle);
     if (it != _objectsToMasterPaths.end()) {
         return it->second;
     } else {
-        MDagPathArray allInstances;
-        if (!MDagPath::getAllPathsTo(instancePath.node(), allInstances)
-            || (allInstances.length() == 0)) {
+        if (!masterDagPath.isValid()) {
             TF_RUNTIME_ERROR(
                 "Could not find any instances for '%s'", instancePath.fullPathName().asChar());
             _objectsToMasterPaths[handle] = _ExportAndRefPaths();
@@ -275,7 +547,7 @@ UsdMayaWriteJobContext::_FindOrCreateInstanceMaster(const MDagPath& instancePath
 
         // We use the DAG path of the first instance to construct the name of
         // the master.
-        const _ExportAndRefPaths masterPaths = _GetInstanceMasterPaths(allInstances[0]);
+        const _ExportAndRefPaths masterPaths = _GetInstanceMasterPaths(masterDagPath);
         const SdfPath&           exportPath = masterPaths.first;
         const SdfPath&           referencePath = masterPaths.second;
 
@@ -290,7 +562,7 @@ UsdMayaWriteJobContext::_FindOrCreateInstanceMaster(const MDagPath& instancePath
         // once).
         std::vector<UsdMayaPrimWriterSharedPtr> primWriters;
         CreatePrimWriterHierarchy(
-            allInstances[0],
+            masterDagPath,
             exportPath,
             /*forceUninstance*/ true,
             /*exportRootVisibility*/ true,
@@ -331,7 +603,9 @@ bool UsdMayaWriteJobContext::_GetInstanceMasterPrimWriters(
     std::vector<UsdMayaPrimWriterSharedPtr>::const_iterator* begin,
     std::vector<UsdMayaPrimWriterSharedPtr>::const_iterator* end) const
 {
-    const MObjectHandle handle(instancePath.node());
+    const MDagPath      masterDagPath = _GetInstanceMasterDagPath(instancePath);
+    const MObjectHandle handle(
+        masterDagPath.isValid() ? masterDagPath.node() : instancePath.node());
     const auto          it = _objectsToMasterWriters.find(handle);
     if (it != _objectsToMasterWriters.end()) {
         std::pair<size_t, size_t> range = it->second;
@@ -444,9 +718,10 @@ bool UsdMayaWriteJobContext::_OpenFile(const std::string& filename, bool append)
             mParentScopePath
                 = UsdGeomScope::Define(mStage, mParentScopePath).GetPrim().GetPrimPath();
         }
+        _dagToUsdPathCache.clear();
     }
 
-    if (mArgs.exportInstances) {
+    if (mArgs.exportInstances || mArgs.instanceDuplicateMeshes) {
         mInstancesPrim = mStage->OverridePrim(INSTANCES_SCOPE_PATH);
     }
 
@@ -455,7 +730,7 @@ bool UsdMayaWriteJobContext::_OpenFile(const std::string& filename, bool append)
 
 bool UsdMayaWriteJobContext::_PostProcess()
 {
-    if (mArgs.exportInstances) {
+    if (mArgs.exportInstances || mArgs.instanceDuplicateMeshes) {
         if (_objectsToMasterWriters.empty()) {
             mStage->RemovePrim(mInstancesPrim.GetPrimPath());
         } else {
@@ -536,6 +811,12 @@ UsdMayaPrimWriterSharedPtr UsdMayaWriteJobContext::CreatePrimWriter(
             // Deal with instances -- we use a special internal writer for them.
             return std::make_shared<UsdMaya_InstancedNodeWriter>(dagNodeFn, writePath, *this);
         }
+
+        if (!forceUninstance && _duplicateMeshMasters.count(MObjectHandle(dagPath.node())) > 0) {
+            // Meshes with identical data are written as instances of the first
+            // one of them.
+            return std::make_shared<UsdMaya_InstancedNodeWriter>(dagNodeFn, writePath, *this);
+        }
     }
 
     // This is either a DG node or a non-instanced DAG node, so try to look up
@@ -645,6 +926,19 @@ void UsdMayaWriteJobContext::CreatePrimWriterHierarchy(
     }
 }
 
+SdfPath UsdMayaWriteJobContext::GetInstancerPrototypePath(const MDagPath& prototypeDagPath) const
+{
+    const auto found = _instancerPrototypePaths.find(MObjectHandle(prototypeDagPath.node()));
+    return found != _instancerPrototypePaths.end() ? found->second : SdfPath();
+}
+
+void UsdMayaWriteJobContext::SetInstancerPrototypePath(
+    const MDagPath& prototypeDagPath,
+    const SdfPath&  usdPath)
+{
+    _instancerPrototypePaths[MObjectHandle(prototypeDagPath.node())] = usdPath;
+}
+
 void UsdMayaWriteJobContext::MarkSkelBindings(
     const SdfPath& path,
     const SdfPath& skelPath,
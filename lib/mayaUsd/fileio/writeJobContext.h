@@ -24,12 +24,15 @@
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 
+#include <maya/MCallbackIdArray.h>
 #include <maya/MDagPath.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MObjectHandle.h>
 #include <maya/MPlugArray.h>
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -71,6 +74,8 @@ public:
     /// visibility, etc).
     /// Note that this does *not* take into account instancing; the returned
     /// path is translated as if \p dagPath were un-instanced.
+    /// The conversions are cached for the lifetime of the context, until a
+    /// DAG node is renamed or reparented.
     MAYAUSD_CORE_PUBLIC
     SdfPath ConvertDagToUsdPath(const MDagPath& dagPath) const;
 
@@ -118,6 +123,18 @@ public:
         const bool                               exportRootVisibility,
         std::vector<UsdMayaPrimWriterSharedPtr>* primWritersOut);
 
+    /// Returns the USD path where the instancer prototype of \p prototypeDagPath
+    /// was exported, or an empty path if no instancer exported it yet.
+    /// Instancers sharing a prototype reference its first export instead of
+    /// writing the prototype hierarchy again.
+    MAYAUSD_CORE_PUBLIC
+    SdfPath GetInstancerPrototypePath(const MDagPath& prototypeDagPath) const;
+
+    /// Records that the instancer prototype of \p prototypeDagPath is exported
+    /// at \p usdPath.
+    MAYAUSD_CORE_PUBLIC
+    void SetInstancerPrototypePath(const MDagPath& prototypeDagPath, const SdfPath& usdPath);
+
     /// Mark \p path as containing bindings utilizing the skeleton
     /// at \p skelPath.
     /// Bindings are marked so that SkelRoots may be post-processed.
@@ -170,6 +187,16 @@ private:
     /// The reference path is _always_ a prefix of the export path.
     _ExportAndRefPaths _GetInstanceMasterPaths(const MDagPath& instancePath) const;
 
+    /// Gets the Maya DAG path that the instance master of \p instancePath is
+    /// exported from: the first Maya instance of the node, or the first of
+    /// the meshes with identical data for duplicated meshes.
+    MDagPath _GetInstanceMasterDagPath(const MDagPath& instancePath) const;
+
+    /// Finds the static meshes with identical data under the exported DAG
+    /// paths, which are exported as instances of the first one of them.
+    /// Does nothing unless the export args enable instanceDuplicateMeshes.
+    void _FindDuplicateMeshes();
+
     /// If the instance master for \p instancePath already exists, returns its
     /// USD path pair. Otherwise, creates the instance master (including its
     /// descendants) and returns the new USD path pair.
@@ -208,9 +235,23 @@ private:
     // manage two containers of shared pointers.
     std::map<MObjectHandle, std::pair<size_t, size_t>, MObjectHandleComp> _objectsToMasterWriters;
 
+    /// Mapping of the Maya object handles of duplicated meshes to the DAG path
+    /// of the mesh their instance master is exported from.
+    std::map<MObjectHandle, MDagPath, MObjectHandleComp> _duplicateMeshMasters;
+
+    /// Mapping of the Maya object handles of instancer prototypes to the USD
+    /// path of their first export.
+    std::map<MObjectHandle, SdfPath, MObjectHandleComp> _instancerPrototypePaths;
+
     UsdPrim mInstancesPrim;
     SdfPath mParentScopePath;
 
+    /// Cache of ConvertDagToUsdPath() results keyed by the full DAG path name.
+    /// It is only valid for the export args and parent scope of this context,
+    /// and is cleared when a DAG node is renamed or reparented.
+    mutable std::unordered_map<std::string, SdfPath> _dagToUsdPathCache;
+    MCallbackIdArray                                 _dagToUsdPathCacheCallbacks;
+
     std::unique_ptr<UsdMaya_SkelBindingsProcessor> _skelBindingsProcessor;
 
     // Cache of node type names mapped to their "resolved" writer factory,
@@ -59,4 +59,12 @@ const UsdNotice::ObjectsChanged& MayaUsdProxyStageObjectsChangedNotice::GetNotic
     return _notice;
 }
 
+const UsdMayaChangedPathIndex& MayaUsdProxyStageObjectsChangedNotice::GetChangedPathIndex() const
+{
+    if (!_changedPathIndex) {
+        _changedPathIndex.reset(new UsdMayaChangedPathIndex(_notice));
+    }
+    return *_changedPathIndex;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
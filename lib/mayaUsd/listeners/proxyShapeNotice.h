@@ -17,6 +17,7 @@
 #define MAYAUSD_PROXYSTAGE_NOTICE_H
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/listeners/stageNoticeListener.h>
 
 #include <pxr/base/tf/notice.h>
 #include <pxr/usd/usd/notice.h>
@@ -24,6 +25,7 @@
 
 #include <maya/MObject.h>
 
+#include <memory>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -74,8 +76,14 @@ public:
     MAYAUSD_CORE_PUBLIC
     const UsdNotice::ObjectsChanged& GetNotice() const;
 
+    /// Get the sorted index of the paths changed by the notice. It is built
+    /// on first use and shared by all the listeners of this notice.
+    MAYAUSD_CORE_PUBLIC
+    const UsdMayaChangedPathIndex& GetChangedPathIndex() const;
+
 private:
-    const UsdNotice::ObjectsChanged& _notice;
+    const UsdNotice::ObjectsChanged&                 _notice;
+    mutable std::unique_ptr<UsdMayaChangedPathIndex> _changedPathIndex;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -20,8 +20,71 @@
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+namespace {
+
+void copySortedPaths(const UsdNotice::ObjectsChanged::PathRange& range, SdfPathVector* paths)
+{
+    paths->reserve(range.size());
+    for (const SdfPath& path : range) {
+        paths->push_back(path);
+    }
+
+    // The notice usually gives its paths in order already.
+    if (!std::is_sorted(paths->begin(), paths->end())) {
+        std::sort(paths->begin(), paths->end());
+    }
+}
+
+// The descendants of a path follow it in the sorted paths.
+void appendPathsWithPrefix(
+    const SdfPathVector& sortedPaths,
+    const SdfPath&       prefix,
+    SdfPathVector*       paths)
+{
+    auto it = std::lower_bound(sortedPaths.begin(), sortedPaths.end(), prefix);
+    for (; it != sortedPaths.end() && it->HasPrefix(prefix); ++it) {
+        paths->push_back(*it);
+    }
+}
+
+} // namespace
+
+UsdMayaChangedPathIndex::UsdMayaChangedPathIndex(const UsdNotice::ObjectsChanged& notice)
+{
+    copySortedPaths(notice.GetResyncedPaths(), &_resyncedPaths);
+    copySortedPaths(notice.GetChangedInfoOnlyPaths(), &_changedInfoOnlyPaths);
+}
+
+SdfPathVector UsdMayaChangedPathIndex::GetResyncedPaths(const SdfPath& prefix) const
+{
+    SdfPathVector paths;
+    if (_resyncedPaths.empty()) {
+        return paths;
+    }
+
+    for (SdfPath ancestor = prefix.GetParentPath(); !ancestor.IsEmpty();
+         ancestor = ancestor.GetParentPath()) {
+        if (std::binary_search(_resyncedPaths.begin(), _resyncedPaths.end(), ancestor)) {
+            paths.push_back(ancestor);
+        }
+    }
+    std::reverse(paths.begin(), paths.end());
+
+    appendPathsWithPrefix(_resyncedPaths, prefix, &paths);
+    return paths;
+}
+
+SdfPathVector UsdMayaChangedPathIndex::GetChangedInfoOnlyPaths(const SdfPath& prefix) const
+{
+    SdfPathVector paths;
+    appendPathsWithPrefix(_changedInfoOnlyPaths, prefix, &paths);
+    return paths;
+}
+
 /* virtual */
 UsdMayaStageNoticeListener::~UsdMayaStageNoticeListener()
 {
@@ -64,6 +127,27 @@ void UsdMayaStageNoticeListener::SetStageLayerMutingChangedCallback(
     _UpdateStageContentsChangedRegistration();
 }
 
+UsdMayaStageNoticeListener::SubscriptionId
+UsdMayaStageNoticeListener::AddObjectsChangedSubscription(
+    const SdfPath&              prefix,
+    unsigned                    changeKinds,
+    const ChangedPathsCallback& callback)
+{
+    const SubscriptionId id = _nextSubscriptionId++;
+    _subscriptions[id] = _Subscription { prefix, changeKinds, callback };
+
+    _UpdateStageContentsChangedRegistration();
+
+    return id;
+}
+
+void UsdMayaStageNoticeListener::RemoveObjectsChangedSubscription(SubscriptionId id)
+{
+    _subscriptions.erase(id);
+
+    _UpdateStageContentsChangedRegistration();
+}
+
 void UsdMayaStageNoticeListener::_UpdateStageContentsChangedRegistration()
 {
     if (_stage && _stageContentsChangedCallback) {
@@ -80,7 +164,7 @@ void UsdMayaStageNoticeListener::_UpdateStageContentsChangedRegistration()
         }
     }
 
-    if (_stage && _stageObjectsChangedCallback) {
+    if (_stage && (_stageObjectsChangedCallback || !_subscriptions.empty())) {
         // Register for notices if we're not already listening.
         if (!_stageObjectsChangedKey.IsValid()) {
             _stageObjectsChangedKey = TfNotice::Register(
@@ -123,9 +207,37 @@ void UsdMayaStageNoticeListener::_OnStageObjectsChanged(
     const UsdNotice::ObjectsChanged& notice,
     const UsdStageWeakPtr&           sender) const
 {
-    if (notice.GetStage() == _stage && _stageObjectsChangedCallback) {
+    if (notice.GetStage() != _stage) {
+        return;
+    }
+
+    if (_stageObjectsChangedCallback) {
         _stageObjectsChangedCallback(notice);
     }
+
+    if (_subscriptions.empty()) {
+        return;
+    }
+
+    // The callbacks can change the subscriptions, so dispatch to a copy.
+    const auto                    subscriptions = _subscriptions;
+    const UsdMayaChangedPathIndex index(notice);
+    for (const auto& entry : subscriptions) {
+        const _Subscription& subscription = entry.second;
+
+        SdfPathVector resyncedPaths;
+        if (subscription.changeKinds & UsdMayaChangedPathIndex::Resynced) {
+            resyncedPaths = index.GetResyncedPaths(subscription.prefix);
+        }
+        SdfPathVector changedInfoOnlyPaths;
+        if (subscription.changeKinds & UsdMayaChangedPathIndex::ChangedInfoOnly) {
+            changedInfoOnlyPaths = index.GetChangedInfoOnlyPaths(subscription.prefix);
+        }
+
+        if (!resyncedPaths.empty() || !changedInfoOnlyPaths.empty()) {
+            subscription.callback(notice, resyncedPaths, changedInfoOnlyPaths);
+        }
+    }
 }
 
 void UsdMayaStageNoticeListener::_OnStageLayerMutingChanged(
@@ -21,13 +21,53 @@
 #include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <cstddef>
 #include <functional>
+#include <map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// The paths changed by a UsdNotice::ObjectsChanged notice, sorted once so
+/// that the changes under a prefix are found with a binary search instead of
+/// a scan of the whole notice.
+class UsdMayaChangedPathIndex
+{
+public:
+    /// The kinds of changes, combined as a bit mask.
+    enum ChangeKind : unsigned
+    {
+        Resynced = 1 << 0,
+        ChangedInfoOnly = 1 << 1,
+        AnyChange = Resynced | ChangedInfoOnly
+    };
+
+    MAYAUSD_CORE_PUBLIC
+    explicit UsdMayaChangedPathIndex(const UsdNotice::ObjectsChanged& notice);
+
+    /// Return all the resynced paths, sorted.
+    const SdfPathVector& GetResyncedPaths() const { return _resyncedPaths; }
+
+    /// Return all the paths with changed info only, sorted.
+    const SdfPathVector& GetChangedInfoOnlyPaths() const { return _changedInfoOnlyPaths; }
+
+    /// Return the resynced paths that affect \p prefix: the paths at or
+    /// under it and its resynced ancestors.
+    MAYAUSD_CORE_PUBLIC
+    SdfPathVector GetResyncedPaths(const SdfPath& prefix) const;
+
+    /// Return the paths with changed info only at or under \p prefix.
+    MAYAUSD_CORE_PUBLIC
+    SdfPathVector GetChangedInfoOnlyPaths(const SdfPath& prefix) const;
+
+private:
+    SdfPathVector _resyncedPaths;
+    SdfPathVector _changedInfoOnlyPaths;
+};
+
 /// A notice listener that can invoke callbacks in response to notices about a
 /// specific USD stage.
 ///
@@ -70,6 +110,33 @@ public:
     MAYAUSD_CORE_PUBLIC
     void SetStageLayerMutingChangedCallback(const StageLayerMutingChangedCallback& callback);
 
+    /// Callback type for the subscriptions to ObjectsChanged notices. It
+    /// receives the changed paths of the subscription only.
+    using ChangedPathsCallback = std::function<void(
+        const UsdNotice::ObjectsChanged& notice,
+        const SdfPathVector&             resyncedPaths,
+        const SdfPathVector&             changedInfoOnlyPaths)>;
+
+    /// Identifies a subscription of the listener, 0 is never a valid id.
+    using SubscriptionId = size_t;
+
+    /// Subscribes \p callback to the ObjectsChanged notices that change
+    /// \p prefix or its descendants, or resync one of its ancestors, with
+    /// changes of the \p changeKinds mask of UsdMayaChangedPathIndex::ChangeKind.
+    ///
+    /// The paths of each notice are indexed once for all the subscriptions
+    /// of the listener, and the callback is only invoked when its slice of
+    /// the notice is not empty.
+    MAYAUSD_CORE_PUBLIC
+    SubscriptionId AddObjectsChangedSubscription(
+        const SdfPath&              prefix,
+        unsigned                    changeKinds,
+        const ChangedPathsCallback& callback);
+
+    /// Removes a subscription added by AddObjectsChangedSubscription().
+    MAYAUSD_CORE_PUBLIC
+    void RemoveObjectsChangedSubscription(SubscriptionId id);
+
 private:
     UsdMayaStageNoticeListener(const UsdMayaStageNoticeListener&) = delete;
     UsdMayaStageNoticeListener& operator=(const UsdMayaStageNoticeListener&) = delete;
@@ -83,6 +150,15 @@ private:
     TfNotice::Key               _stageObjectsChangedKey {};
     StageObjectsChangedCallback _stageObjectsChangedCallback {};
 
+    struct _Subscription
+    {
+        SdfPath              prefix;
+        unsigned             changeKinds;
+        ChangedPathsCallback callback;
+    };
+    std::map<SubscriptionId, _Subscription> _subscriptions;
+    SubscriptionId                          _nextSubscriptionId { 1 };
+
     TfNotice::Key                   _stageLayerMutingChangedKey {};
     StageLayerMutingChangedCallback _stageLayerMutingChangedCallback {};
 
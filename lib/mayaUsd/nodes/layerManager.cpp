@@ -25,7 +25,11 @@
 #include <mayaUsd/utils/utilFileSystem.h>
 #include <mayaUsd/utils/utilSerialization.h>
 
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/instantiateType.h>
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/sdf/textFileFormat.h>
@@ -55,10 +59,25 @@
 #include <ufe/observableSelection.h>
 #include <ufe/selectionNotification.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <set>
 
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_LAYER_MANAGER_SERIALIZE_CRATE,
+    false,
+    "Save the layers kept in the Maya file in the binary usdc format instead of usda text. "
+    "Scenes saved this way load faster but can't be read by older versions of mayaUsd.");
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
 using namespace MAYAUSD_NS_DEF;
 
 namespace {
@@ -229,13 +248,14 @@ public:
     bool removeLayer(SdfLayerRefPtr layer);
     void removeAllLayers();
 
-    SdfLayerHandle findLayer(std::string identifier) const;
+    SdfLayerHandle findLayer(std::string identifier);
 
 private:
     void registerCallbacks();
     void unregisterCallbacks();
 
-    void _addLayer(SdfLayerRefPtr layer, const std::string& identifier);
+    void           _addLayer(SdfLayerRefPtr layer, const std::string& identifier);
+    SdfLayerHandle _restorePendingLayer(const std::string& identifier);
     void onStageSet(const MayaUsdProxyStageSetNotice& notice);
 
     bool            saveUsd(bool isExport);
@@ -250,7 +270,12 @@ private:
     bool hasDirtyLayer() const;
 
     std::map<std::string, SdfLayerRefPtr> _idToLayer;
-    TfNotice::Key                         _onStageSetKey;
+    // Serialized anonymous layers read from the Maya file, by identifier, only recreated
+    // when first found. They can only be reached through the layer database, since their
+    // new identifiers don't match the saved ones, unlike the file-backed layers which
+    // must be in the layer registry before any stage is opened.
+    std::map<std::string, std::string> _pendingAnonymousLayers;
+    TfNotice::Key                      _onStageSetKey;
     std::set<unsigned int>                _supportedTypes;
     std::vector<StageSavingInfo>          _proxiesToSave;
     std::vector<StageSavingInfo>          _internalProxiesToSave;
@@ -568,6 +593,127 @@ bool LayerDatabase::saveUsd(bool isExport)
     return (MayaUsd::kCompleted == result);
 }
 
+// Start of the layers serialized in the usdc format. The usda text starts with "#usda".
+const std::string kCrateSerializationPrefix("#usdc-base64\n");
+
+const char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Maya string attributes can't hold arbitrary bytes, so the usdc data is base64-encoded.
+std::string encodeBase64(const std::string& data)
+{
+    std::string encoded;
+    encoded.reserve((data.size() + 2) / 3 * 4);
+
+    for (size_t i = 0; i < data.size(); i += 3) {
+        const size_t   count = std::min<size_t>(3, data.size() - i);
+        const uint32_t bits = (uint32_t(uint8_t(data[i])) << 16)
+            | (count > 1 ? uint32_t(uint8_t(data[i + 1])) << 8 : 0)
+            | (count > 2 ? uint32_t(uint8_t(data[i + 2])) : 0);
+
+        encoded.push_back(kBase64Chars[(bits >> 18) & 0x3F]);
+        encoded.push_back(kBase64Chars[(bits >> 12) & 0x3F]);
+        encoded.push_back(count > 1 ? kBase64Chars[(bits >> 6) & 0x3F] : '=');
+        encoded.push_back(count > 2 ? kBase64Chars[bits & 0x3F] : '=');
+    }
+
+    return encoded;
+}
+
+bool decodeBase64(const std::string& encoded, std::string* data)
+{
+    if (encoded.size() % 4 != 0)
+        return false;
+
+    data->clear();
+    data->reserve(encoded.size() / 4 * 3);
+
+    for (size_t i = 0; i < encoded.size(); i += 4) {
+        uint32_t bits = 0;
+        int      padding = 0;
+        for (size_t j = 0; j < 4; ++j) {
+            const char c = encoded[i + j];
+            const char* found = (c == '=') ? nullptr : std::strchr(kBase64Chars, c);
+            if (c == '=' && i + 4 == encoded.size() && j >= 2) {
+                ++padding;
+            } else if (!found || !*found || padding > 0) {
+                return false;
+            }
+            bits = (bits << 6) | (found ? uint32_t(found - kBase64Chars) : 0);
+        }
+
+        data->push_back(char((bits >> 16) & 0xFF));
+        if (padding < 2)
+            data->push_back(char((bits >> 8) & 0xFF));
+        if (padding < 1)
+            data->push_back(char(bits & 0xFF));
+    }
+
+    return true;
+}
+
+// The crate format can only be written to and read from files, so the layer goes through a
+// temporary usdc file.
+bool exportToCrateString(const SdfLayerHandle& layer, std::string* serialized)
+{
+    const std::string tmpFileName = ArchMakeTmpFileName("mayaUsdLayer", ".usdc");
+
+    bool exported = layer->Export(tmpFileName);
+    if (exported) {
+        std::ifstream tmpFile(tmpFileName, std::ios::binary);
+        std::string   data(
+            (std::istreambuf_iterator<char>(tmpFile)), std::istreambuf_iterator<char>());
+        exported = !tmpFile.bad();
+        *serialized = kCrateSerializationPrefix + encodeBase64(data);
+    }
+
+    TfDeleteFile(tmpFileName);
+    return exported;
+}
+
+bool importFromCrateString(const SdfLayerRefPtr& layer, const std::string& serialized);
+
+bool importSerializedLayer(const SdfLayerRefPtr& layer, const std::string& serialized)
+{
+    return TfStringStartsWith(serialized, kCrateSerializationPrefix)
+        ? importFromCrateString(layer, serialized)
+        : layer->ImportFromString(serialized);
+}
+
+bool importFromCrateString(const SdfLayerRefPtr& layer, const std::string& serialized)
+{
+    std::string data;
+    if (!decodeBase64(serialized.substr(kCrateSerializationPrefix.size()), &data))
+        return false;
+
+    const std::string tmpFileName = ArchMakeTmpFileName("mayaUsdLayer", ".usdc");
+    {
+        std::ofstream tmpFile(tmpFileName, std::ios::binary);
+        tmpFile.write(data.data(), data.size());
+        if (!tmpFile) {
+            TfDeleteFile(tmpFileName);
+            return false;
+        }
+    }
+
+    bool imported = false;
+    {
+        // The usdc data is read lazily from its file, copy it to an in-memory layer first
+        // so that the temporary file can be deleted.
+        SdfLayerRefPtr crateLayer = SdfLayer::OpenAsAnonymous(tmpFileName);
+        if (crateLayer) {
+            SdfLayerRefPtr memoryLayer = SdfLayer::CreateAnonymous(
+                "crate", SdfFileFormat::FindById(SdfTextFileFormatTokens->Id));
+            memoryLayer->TransferContent(crateLayer);
+            crateLayer = nullptr;
+            layer->TransferContent(memoryLayer);
+            imported = true;
+        }
+    }
+
+    TfDeleteFile(tmpFileName);
+    return imported;
+}
+
 MStatus addLayerToBuilder(
     MayaUsd::LayerManager* lm,
     MArrayDataBuilder&     builder,
@@ -595,7 +741,10 @@ MStatus addLayerToBuilder(
 
     std::string temp;
     if (!stubOnly && ((exportOnlyIfDirty && layer->IsDirty()) || !exportOnlyIfDirty)) {
-        if (!layer->ExportToString(&temp)) {
+        const bool exported = TfGetEnvSetting(MAYAUSD_LAYER_MANAGER_SERIALIZE_CRATE)
+            ? exportToCrateString(layer, &temp)
+            : layer->ExportToString(&temp);
+        if (!exported) {
             status = MS::kFailure;
         }
     }
@@ -735,6 +884,10 @@ BatchSaveResult LayerDatabase::saveUsdToMayaFile()
 
 BatchSaveResult LayerDatabase::saveUsdToUsdFiles()
 {
+    // File-backed layers are gathered across all the proxies and saved together at the end, since
+    // the saves to different files are independent from one another.
+    std::vector<SdfLayerRefPtr> layersToSave;
+
     MFnDependencyNode fn;
     for (size_t i = 0; i < _proxiesToSave.size() + _internalProxiesToSave.size(); i++) {
         const StageSavingInfo& info = i < _proxiesToSave.size()
@@ -759,13 +912,15 @@ BatchSaveResult LayerDatabase::saveUsdToUsdFiles()
                 SdfLayerHandleVector allLayers = info.stage->GetLayerStack(false);
                 for (auto layer : allLayers) {
                     if (layer->PermissionToSave()) {
-                        MayaUsd::utils::saveLayerWithFormat(layer);
+                        layersToSave.push_back(layer);
                     }
                 }
             }
         }
     }
 
+    MayaUsd::utils::saveLayersWithFormat(layersToSave);
+
     clearProxies();
 
     return MayaUsd::kCompleted;
@@ -873,10 +1028,9 @@ void LayerDatabase::loadLayersPostRead(void*)
 
         bool isAnon = anonymousPlug.asBool(MDGContext::fsNormal, &status);
         if (isAnon) {
-            // Note that the new identifier will not match the old identifier - only the "tag"
-            // will be retained
-            layer
-                = SdfLayer::CreateAnonymous(SdfLayer::GetDisplayNameFromIdentifier(identifierVal));
+            // Parsing the anonymous layers is deferred until a proxy shape needs them.
+            LayerDatabase::instance()._pendingAnonymousLayers[identifierVal] = serializedVal;
+            continue;
         } else {
             SdfLayerHandle layerHandle = SdfLayer::Find(identifierVal);
             if (layerHandle) {
@@ -924,7 +1078,7 @@ void LayerDatabase::loadLayersPostRead(void*)
 
         if (layer) {
             if (layerContainsEdits) {
-                if (!layer->ImportFromString(serializedVal)) {
+                if (!importSerializedLayer(layer, serializedVal)) {
                     MGlobal::displayError(
                         MString("Failed to import serialized layer: ") + serializedVal.c_str());
                     continue;
@@ -996,6 +1150,8 @@ bool LayerDatabase::removeLayer(SdfLayerRefPtr layer)
 {
     std::vector<std::string> paths = layer->GetSubLayerPaths();
     for (auto pathName : paths) {
+        // Sublayers which were never needed don't have to be restored to be removed.
+        _pendingAnonymousLayers.erase(pathName);
         SdfLayerRefPtr childLayer = findLayer(pathName);
         if (childLayer) {
             removeLayer(childLayer);
@@ -1013,16 +1169,48 @@ bool LayerDatabase::removeLayer(SdfLayerRefPtr layer)
     return true;
 }
 
-void LayerDatabase::removeAllLayers() { _idToLayer.clear(); }
+void LayerDatabase::removeAllLayers()
+{
+    _idToLayer.clear();
+    _pendingAnonymousLayers.clear();
+}
 
-SdfLayerHandle LayerDatabase::findLayer(std::string identifier) const
+SdfLayerHandle LayerDatabase::findLayer(std::string identifier)
 {
     auto foundIdAndLayer = _idToLayer.find(identifier);
     if (foundIdAndLayer != _idToLayer.end()) {
         return foundIdAndLayer->second;
     }
 
-    return SdfLayerHandle();
+    return _restorePendingLayer(identifier);
+}
+
+SdfLayerHandle LayerDatabase::_restorePendingLayer(const std::string& identifier)
+{
+    auto pendingLayer = _pendingAnonymousLayers.find(identifier);
+    if (pendingLayer == _pendingAnonymousLayers.end()) {
+        return SdfLayerHandle();
+    }
+
+    // Removed first, so that a cycle of sublayers doesn't restore a layer twice.
+    const std::string serialized = std::move(pendingLayer->second);
+    _pendingAnonymousLayers.erase(pendingLayer);
+
+    // Note that the new identifier will not match the old identifier - only the "tag"
+    // will be retained
+    SdfLayerRefPtr layer
+        = SdfLayer::CreateAnonymous(SdfLayer::GetDisplayNameFromIdentifier(identifier));
+    if (!serialized.empty() && !importSerializedLayer(layer, serialized)) {
+        MGlobal::displayError(MString("Failed to import serialized layer: ") + serialized.c_str());
+        return SdfLayerHandle();
+    }
+
+    addLayer(layer, identifier);
+
+    // The anonymous sublayers are restored in turn when their paths are remapped.
+    remapSubLayerPaths(layer);
+
+    return layer;
 }
 
 void LayerDatabase::clearManagerNode(MayaUsd::LayerManager* lm)
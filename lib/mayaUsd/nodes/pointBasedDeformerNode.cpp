@@ -17,13 +17,13 @@
 
 #include <mayaUsd/nodes/stageData.h>
 
-#include <pxr/base/gf/math.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
@@ -43,6 +43,7 @@
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPoint.h>
+#include <maya/MPointArray.h>
 #include <maya/MPxDeformerNode.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
@@ -50,6 +51,7 @@
 #include <maya/MTypeId.h>
 
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -147,10 +149,27 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
 
     const SdfPath primPath(primPathString);
 
-    const UsdPrim&          usdPrim = usdStage->GetPrimAtPath(primPath);
-    const UsdGeomPointBased usdPointBased(usdPrim);
-    if (!usdPointBased) {
-        return MS::kFailure;
+    if (!_pointsQuery.IsValid() || _pointsStageDataVersion != stageData->version
+        || _pointsPrimPath != primPath) {
+        const UsdPrim&          usdPrim = usdStage->GetPrimAtPath(primPath);
+        const UsdGeomPointBased usdPointBased(usdPrim);
+        if (!usdPointBased) {
+            return MS::kFailure;
+        }
+
+        _pointsQuery = UsdAttributeQuery(usdPointBased.GetPointsAttr());
+        _pointsStageDataVersion = stageData->version;
+        _pointsPrimPath = primPath;
+        _stageNoticeListener.SetStage(usdStage);
+
+        // Only the changes of the deformed prim reset the query.
+        _stageNoticeListener.RemoveObjectsChangedSubscription(_pointsSubscription);
+        _pointsSubscription = _stageNoticeListener.AddObjectsChangedSubscription(
+            primPath,
+            UsdMayaChangedPathIndex::AnyChange,
+            [this](const UsdNotice::ObjectsChanged&, const SdfPathVector&, const SdfPathVector&) {
+                _pointsQuery = UsdAttributeQuery();
+            });
     }
 
     const MDataHandle timeHandle = block.inputValue(timeAttr, &status);
@@ -162,27 +181,51 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
     const float envelope = envelopeHandle.asFloat();
 
     VtVec3fArray usdPoints;
-    if (!usdPointBased.GetPointsAttr().Get(&usdPoints, usdTime) || usdPoints.empty()) {
+    if (!_pointsQuery.Get(&usdPoints, usdTime) || usdPoints.empty()) {
         return MS::kFailure;
     }
 
-    for (; !iter.isDone(); iter.next()) {
-        const int index = iter.index();
-        if (index < 0 || static_cast<size_t>(index) >= usdPoints.size()) {
-            continue;
-        }
-
-        const MPoint mayaPoint = iter.position();
-        const float  weight = weightValue(block, multiIndex, index);
-
-        const GfVec3f& usdPoint = usdPoints[static_cast<size_t>(index)];
+    MPointArray mayaPoints;
+    status = iter.allPositions(mayaPoints);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
 
-        const GfVec3f deformedPoint = GfLerp<GfVec3f>(
-            weight * envelope, GfVec3f(mayaPoint[0], mayaPoint[1], mayaPoint[2]), usdPoint);
+    // The weights are read from the data block, only the blend itself runs in parallel.
+    std::vector<int>   indices;
+    std::vector<float> weights;
+    indices.reserve(mayaPoints.length());
+    weights.reserve(mayaPoints.length());
+    for (iter.reset(); !iter.isDone(); iter.next()) {
+        const int index = iter.index();
+        indices.push_back(index);
+        weights.push_back(weightValue(block, multiIndex, index) * envelope);
+    }
 
-        iter.setPosition(MPoint(deformedPoint[0], deformedPoint[1], deformedPoint[2]));
+    if (indices.size() != mayaPoints.length()) {
+        return MS::kFailure;
     }
 
+    const GfVec3f* usdPointsData = usdPoints.cdata();
+    const size_t   numUsdPoints = usdPoints.size();
+    WorkParallelForN(
+        indices.size(),
+        [&indices, &weights, &mayaPoints, usdPointsData, numUsdPoints](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const int index = indices[i];
+                if (index < 0 || static_cast<size_t>(index) >= numUsdPoints) {
+                    continue;
+                }
+
+                const GfVec3f& usdPoint = usdPointsData[index];
+                const double   weight = weights[i];
+                MPoint&        mayaPoint = mayaPoints[static_cast<unsigned int>(i)];
+                mayaPoint.x += weight * (usdPoint[0] - mayaPoint.x);
+                mayaPoint.y += weight * (usdPoint[1] - mayaPoint.y);
+                mayaPoint.z += weight * (usdPoint[2] - mayaPoint.z);
+            }
+        });
+
+    status = iter.setAllPositions(mayaPoints);
+
     return status;
 }
 
@@ -17,9 +17,13 @@
 #define PXRUSDMAYA_POINT_BASED_DEFORMER_NODE_H
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/listeners/stageNoticeListener.h>
 
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/stage.h>
 
 #include <maya/MDataBlock.h>
 #include <maya/MItGeometry.h>
@@ -86,6 +90,15 @@ private:
 
     UsdMayaPointBasedDeformerNode(const UsdMayaPointBasedDeformerNode&);
     UsdMayaPointBasedDeformerNode& operator=(const UsdMayaPointBasedDeformerNode&);
+
+    // The points attribute is resolved once and read through the query at
+    // each time. Any change of the prim, or resync of its ancestors, resets
+    // the query, and so does new input stage data.
+    UsdAttributeQuery                          _pointsQuery;
+    size_t                                     _pointsStageDataVersion { 0 };
+    SdfPath                                    _pointsPrimPath;
+    UsdMayaStageNoticeListener                 _stageNoticeListener;
+    UsdMayaStageNoticeListener::SubscriptionId _pointsSubscription { 0 };
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
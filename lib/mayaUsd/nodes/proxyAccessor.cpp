@@ -17,7 +17,9 @@
 
 #include <mayaUsd/base/debugCodes.h>
 #include <mayaUsd/utils/converter.h>
+#include <mayaUsd/utils/profilingScope.h>
 
+#include <pxr/base/arch/threads.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolverScopedCache.h>
 #include <pxr/usd/sdf/path.h>
@@ -25,6 +27,7 @@
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdGeom/xformOp.h>
 
@@ -46,11 +49,30 @@
 #include <maya/MString.h>
 
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 
 namespace MAYAUSD_NS_DEF {
 
+namespace {
+//! Innermost compute context of all the accessors on this thread. Contexts are chained, so that
+//! nested computes of different accessors can find their own.
+thread_local ComputeContext* computeContextOnThread = nullptr;
+
+//! \brief  Returns the lock serializing the computes, cache syncs, dirty propagation and stage
+//! notices of all the accessors. Stages can't be written concurrently, and a nested compute of one
+//! accessor can pull the accessor of another stage. One lock per stage would then have no defined
+//! order: accessors chained from stage A to stage B on one thread, and from B to A on another,
+//! would deadlock. A single lock can't, and the proxy shapes without accessors still evaluate in
+//! parallel. It is recursive because nested computes lock it again.
+std::recursive_mutex& accessorMutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+} // namespace
+
 /*! /brief  Scoped object setting up compute context for accessor
 
     Proxy accessor supports nested compute that allows injecting DG dependencies to USD. More
@@ -67,14 +89,18 @@ class ComputeContext
 public:
     //! \brief  Construct compute context for both inputs and outputs
     ComputeContext(ProxyAccessor& accessor, const MObject& ownerNode)
-        : _restoreState(accessor._inCompute)
+        : _restoreState(computeContextOnThread)
+        , _nested(accessor.inCompute())
         , _accessor(accessor)
         , _stage(accessor.getUsdStage())
         , _editContext(_stage, _stage->GetSessionLayer())
+        , _xformCache(accessor._xformCache)
     {
-        // Start with setting this context on the accessor. This is important in case
+        // Start with setting this context on the thread. This is important in case
         // anything below causes compute.
-        accessor._inCompute = this;
+        computeContextOnThread = this;
+
+        accessor.validateResolveCache(_stage);
 
         _args._timeCode = _accessor.getTime();
         _xformCache.SetTime(_args._timeCode);
@@ -85,34 +111,38 @@ public:
 
         // Only increment evaluation ID for top most evaluation scope.
         // Nested scope is allowed, but shouldn't in really be needed.
-        if (!_restoreState) {
+        if (!_nested) {
             accessor._evaluationId.next();
         }
     }
 
     //! \brief  Construct compute context for inputs only.
     ComputeContext(ProxyAccessor& accessor)
-        : _restoreState(accessor._inCompute)
+        : _restoreState(computeContextOnThread)
+        , _nested(accessor.inCompute())
         , _accessor(accessor)
         , _stage(accessor.getUsdStage())
         , _editContext(_stage, _stage->GetSessionLayer())
+        , _xformCache(accessor._xformCache)
     {
-        // Start with setting this context on the accessor. This is important in case
+        // Start with setting this context on the thread. This is important in case
         // anything below causes compute.
-        accessor._inCompute = this;
+        computeContextOnThread = this;
+
+        accessor.validateResolveCache(_stage);
 
         _args._timeCode = _accessor.getTime();
         _xformCache.SetTime(_args._timeCode);
 
         // Only increment evaluation ID for top most evaluation scope.
         // Nested scope is allowed, but shouldn't in really be needed.
-        if (!_restoreState) {
+        if (!_nested) {
             accessor._evaluationId.next();
         }
     }
 
-    //! \brief  Restore will handle changing context pointer in the accessor to the state before
-    ~ComputeContext() { _accessor._inCompute = _restoreState; }
+    //! \brief  Restore will handle changing context pointer on the thread to the state before
+    ~ComputeContext() { computeContextOnThread = _restoreState; }
 
     ComputeContext(const ComputeContext&) = delete;
     ComputeContext& operator=(const ComputeContext&) = delete;
@@ -120,6 +150,10 @@ public:
 private:
     //! Remember context pointer at the creation of this object
     ComputeContext* _restoreState;
+    //! Is there already a context of the same accessor on this thread
+    const bool _nested;
+
+    friend ProxyAccessor;
 
 public:
     //! Accessor setting up this context
@@ -131,8 +165,8 @@ public:
     ArResolverScopedCache _resolverCache;
     //! Scoped object changing current edit context to the session layer
     UsdEditContext _editContext;
-    //! Xform compute cache
-    UsdGeomXformCache _xformCache;
+    //! Xform compute cache, owned by the accessor and reused between computes
+    UsdGeomXformCache& _xformCache;
 
     //! Converter arguments used when translating between Maya's and USD data model
     ConverterArgs _args;
@@ -267,12 +301,30 @@ MStatus ProxyAccessor::removeCallbacks()
     return MS::kSuccess;
 }
 
+ComputeContext* ProxyAccessor::currentComputeContext() const
+{
+    for (ComputeContext* context = computeContextOnThread; context;
+         context = context->_restoreState) {
+        if (&context->_accessor == this)
+            return context;
+    }
+    return nullptr;
+}
+
 void ProxyAccessor::collectAccessorItems(MObject node)
 {
     if (_validAccessorItems)
         return;
 
-    MProfilingScope profilingScope(
+    // The SdfPaths are read from the nice names with MEL, which only runs on the main thread.
+    // The items are normally collected there, when the accessor plugs are dirtied.
+    if (!ArchIsMainThread()) {
+        TF_DEBUG(USDMAYA_PROXYACCESSOR)
+            .Msg("Skipped collecting accessor plugs outside of the main thread\n");
+        return;
+    }
+
+    ProfilingScope profilingScope(
         _accessorProfilerCategory, MProfiler::kColorB_L1, "Generate acceleration structure");
 
     _accessorInputItems.clear();
@@ -284,6 +336,8 @@ void ProxyAccessor::collectAccessorItems(MObject node)
     if (!stage)
         return;
 
+    validateResolveCache(stage);
+
     ArResolverScopedCache resolverCache;
 
     MFnDependencyNode fnDep(node);
@@ -316,7 +370,8 @@ void ProxyAccessor::collectAccessorItems(MObject node)
         SdfPath        primPath = path.GetPrimPath();
         const UsdPrim& prim = stage->GetPrimAtPath(primPath);
 
-        const Converter* converter = nullptr;
+        const Converter*  converter = nullptr;
+        UsdAttributeQuery query;
         if (!path.IsPrimPropertyPath()) {
             SdfValueTypeName typeName = Converter::getUsdTypeName(valuePlug, false);
             if (typeName != SdfValueTypeNames->Matrix4d) {
@@ -341,6 +396,7 @@ void ProxyAccessor::collectAccessorItems(MObject node)
             }
 
             converter = Converter::find(valuePlug, attribute);
+            query = UsdAttributeQuery(attribute);
         }
 
         if (!converter) {
@@ -349,22 +405,27 @@ void ProxyAccessor::collectAccessorItems(MObject node)
             continue;
         }
 
+        SyncId queryId;
+        queryId.sync(_resolveId);
+
         if (isAccessorInputPlug(valuePlug)) {
             TF_DEBUG(USDMAYA_PROXYACCESSOR).Msg("Added INPUT '%s'\n", path.GetText());
-            _accessorInputItems.emplace_back(valuePlug, path, converter, SyncId());
+            _accessorInputItems.emplace_back(
+                valuePlug, path, converter, SyncId(), std::move(query), queryId);
         } else {
             TF_DEBUG(USDMAYA_PROXYACCESSOR).Msg("Added OUTPUT '%s'\n", path.GetText());
-            _accessorOutputItems.emplace_back(valuePlug, path, converter, SyncId());
+            _accessorOutputItems.emplace_back(
+                valuePlug, path, converter, SyncId(), std::move(query), queryId);
         }
     }
 
     return;
 }
 
-const ProxyAccessor::Item* ProxyAccessor::findAccessorItem(const MPlug& plug, bool isInput) const
+ProxyAccessor::Item* ProxyAccessor::findAccessorItem(const MPlug& plug, bool isInput)
 {
-    const Container& accessorItems = isInput ? _accessorInputItems : _accessorOutputItems;
-    for (const auto& item : accessorItems) {
+    Container& accessorItems = isInput ? _accessorInputItems : _accessorOutputItems;
+    for (auto& item : accessorItems) {
         const MPlug& itemPlug = std::get<0>(item);
 
         if ((plug.isElement() && itemPlug == plug.array()) || itemPlug == plug)
@@ -374,14 +435,50 @@ const ProxyAccessor::Item* ProxyAccessor::findAccessorItem(const MPlug& plug, bo
     return nullptr;
 }
 
+void ProxyAccessor::validateResolveCache(const UsdStageRefPtr& stage)
+{
+    // Compare raw pointers: an expired weak pointer returns null, so a new stage allocated at the
+    // address of a deleted one is still detected.
+    if (get_pointer(_resolveStage) != get_pointer(stage)) {
+        _resolveStage = stage;
+        invalidateResolveCache();
+    }
+}
+
+void ProxyAccessor::invalidateResolveCache()
+{
+    _resolveId.next();
+    _xformCache.Clear();
+}
+
+const UsdAttributeQuery& ProxyAccessor::getAttributeQuery(Item& item, const UsdStageRefPtr& stage)
+{
+    UsdAttributeQuery& query = std::get<4>(item);
+    SyncId&            queryId = std::get<5>(item);
+    if (queryId.inSync(_resolveId))
+        return query;
+
+    queryId.sync(_resolveId);
+
+    const SdfPath& itemPath = std::get<1>(item);
+    const UsdPrim& itemPrim = stage->GetPrimAtPath(itemPath.GetPrimPath());
+    UsdAttribute   itemAttribute
+        = itemPrim ? itemPrim.GetAttribute(itemPath.GetNameToken()) : UsdAttribute();
+
+    query = itemAttribute.IsDefined() ? UsdAttributeQuery(itemAttribute) : UsdAttributeQuery();
+    return query;
+}
+
 MStatus ProxyAccessor::addDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
 {
     if (inCompute())
         return MS::kUnknownParameter;
 
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _accessorProfilerCategory, MProfiler::kColorB_L1, "Dirty accessor plugs");
 
+    std::lock_guard<std::recursive_mutex> lock(accessorMutex());
+
     collectAccessorItems(plug.node());
 
     if (_accessorInputItems.size() == 0 && _accessorOutputItems.size() == 0)
@@ -412,15 +509,15 @@ MStatus ProxyAccessor::compute(const MPlug& plug, MDataBlock& dataBlock)
 {
     // Special handling for nested compute
     if (inCompute()) {
-        MProfilingScope profilingScope(
+        ProfilingScope profilingScope(
             _accessorProfilerCategory, MProfiler::kColorB_L3, "Nested compute USD accessor");
 
-        const auto* accessorItem = findAccessorItem(plug, false);
+        auto* accessorItem = findAccessorItem(plug, false);
         if (accessorItem) {
             TF_DEBUG(USDMAYA_PROXYACCESSOR)
                 .Msg("Nested compute triggered by '%s'\n", plug.name().asChar());
 
-            ComputeContext& topState = *_inCompute;
+            ComputeContext& topState = *currentComputeContext();
 
             const SdfPath& itemPath = std::get<1>(*accessorItem);
             // If it's not a property path, then we will be writing out world matrix data
@@ -462,12 +559,14 @@ MStatus ProxyAccessor::compute(const MPlug& plug, MDataBlock& dataBlock)
         return MS::kSuccess;
     }
 
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _accessorProfilerCategory, MProfiler::kColorB_L1, "Compute USD accessor");
 
     TF_DEBUG(USDMAYA_PROXYACCESSOR)
         .Msg("Compute USD accessor triggered by '%s'\n", plug.name().asChar());
 
+    std::lock_guard<std::recursive_mutex> lock(accessorMutex());
+
     collectAccessorItems(plug.node());
 
     // Early exit to avoid virtual function calls when no compute will happen
@@ -482,7 +581,7 @@ MStatus ProxyAccessor::compute(const MPlug& plug, MDataBlock& dataBlock)
         computeInput(item, evalState._stage, dataBlock, evalState._args);
     }
     // Write outputs that haven't been yet computed
-    for (const auto& item : _accessorOutputItems) {
+    for (auto& item : _accessorOutputItems) {
         computeOutput(
             item,
             evalState._proxyInclusiveMatrix,
@@ -510,24 +609,17 @@ MStatus ProxyAccessor::computeInput(
     const MPlug&     itemPlug = std::get<0>(inputItemToCompute);
     const SdfPath&   itemPath = std::get<1>(inputItemToCompute);
     const Converter* itemConverter = std::get<2>(inputItemToCompute);
-    // We should cache UsdAttribute in here too and avoid expensive
-    // searches (i.e. getting the prim, getting attribute, checking if defined)
 
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _accessorProfilerCategory, MProfiler::kColorB_L1, "Write input", itemPath.GetText());
 
     evaluationId.sync(_evaluationId);
 
-    SdfPath        itemPrimPath = itemPath.GetPrimPath();
-    const UsdPrim& itemPrim = stage->GetPrimAtPath(itemPrimPath);
-
     if (!itemPath.IsPrimPropertyPath() || !itemConverter)
         return MS::kFailure;
 
-    const TfToken& itemPropertyToken = itemPath.GetNameToken();
-    UsdAttribute   itemAttribute = itemPrim.GetAttribute(itemPropertyToken);
-
-    if (!itemAttribute.IsDefined()) {
+    const UsdAttributeQuery& itemQuery = getAttributeQuery(inputItemToCompute, stage);
+    if (!itemQuery.IsValid()) {
         TF_CODING_ERROR("Undefined/invalid attribute '%s'", itemPath.GetText());
         return MS::kFailure;
     }
@@ -543,15 +635,26 @@ MStatus ProxyAccessor::computeInput(
     // Don't set the value if it didn't change. This will save us expensive invalidation +
     // compute
     VtValue currentValue;
-    if (itemAttribute.Get(&currentValue, args._timeCode) && convertedValue != currentValue) {
+    if (itemQuery.Get(&currentValue, args._timeCode) && convertedValue != currentValue) {
+        // The first opinion authored in the edit target changes where the value resolves from.
+        const bool newOpinion = !stage->GetEditTarget().GetPropertySpecForScenePath(itemPath);
+
+        UsdAttribute itemAttribute = itemQuery.GetAttribute();
         itemAttribute.Set(convertedValue, args._timeCode);
+
+        if (newOpinion)
+            invalidateResolveCache();
+        else if (
+            UsdGeomXformOp::IsXformOp(itemPath.GetNameToken())
+            || itemPath.GetNameToken() == UsdGeomTokens->xformOpOrder)
+            _xformCache.Clear();
     }
 
     return MS::kSuccess;
 }
 
 MStatus ProxyAccessor::computeOutput(
-    const Item&          outputItemToCompute,
+    Item&                outputItemToCompute,
     const MMatrix&       proxyInclusiveMatrix,
     const UsdStageRefPtr stage,
     MDataBlock&          dataBlock,
@@ -563,15 +666,10 @@ MStatus ProxyAccessor::computeOutput(
     const MPlug&     itemPlug = std::get<0>(outputItemToCompute);
     const SdfPath&   itemPath = std::get<1>(outputItemToCompute);
     const Converter* itemConverter = std::get<2>(outputItemToCompute);
-    // We should cache UsdAttribute in here too and avoid expensive
-    // searches (i.e. getting the prim, getting attribute, checking if defined)
 
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _accessorProfilerCategory, MProfiler::kColorB_L1, "Write output", itemPath.GetText());
 
-    SdfPath        itemPrimPath = itemPath.GetPrimPath();
-    const UsdPrim& itemPrim = stage->GetPrimAtPath(itemPrimPath);
-
     MDataHandle itemDataHandle = dataBlock.outputValue(itemPlug, &retValue);
     if (MFAIL(retValue)) {
         return retValue;
@@ -579,7 +677,8 @@ MStatus ProxyAccessor::computeOutput(
 
     // If it's not a property path, then we will be writing out world matrix data
     if (!itemPath.IsPrimPropertyPath()) {
-        GfMatrix4d mat = xformCache.GetLocalToWorldTransform(itemPrim);
+        const UsdPrim& itemPrim = stage->GetPrimAtPath(itemPath);
+        GfMatrix4d     mat = xformCache.GetLocalToWorldTransform(itemPrim);
         MMatrix    mayaMat;
         TypedConverter<MMatrix, GfMatrix4d>::convert(mat, mayaMat);
 
@@ -598,18 +697,17 @@ MStatus ProxyAccessor::computeOutput(
         dstArray.set(dstArrayBuilder);
         dstArray.setAllClean();
     } else if (itemConverter) {
-        const TfToken& itemPropertyToken = itemPath.GetNameToken();
-        UsdAttribute   itemAttribute = itemPrim.GetAttribute(itemPropertyToken);
-
-        // cache this! expensive call
-        if (!itemAttribute.IsDefined()) {
+        const UsdAttributeQuery& itemQuery = getAttributeQuery(outputItemToCompute, stage);
+        if (!itemQuery.IsValid()) {
             TF_CODING_ERROR("Undefined/invalid attribute '%s'", itemPath.GetText());
 
             dataBlock.setClean(itemPlug);
             return MS::kFailure;
         }
 
-        itemConverter->convert(itemAttribute, itemDataHandle, args);
+        VtValue value;
+        if (itemQuery.Get(&value, args._timeCode))
+            itemConverter->convert(value, itemDataHandle, args);
     }
 
     // Even if we have no data to write, we set the data in data block as clean
@@ -627,11 +725,13 @@ MStatus ProxyAccessor::syncCache(const MObject& node, MDataBlock& dataBlock)
     if (inCompute())
         return MS::kSuccess;
 
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _accessorProfilerCategory, MProfiler::kColorB_L1, "Update USD cache");
 
     TF_DEBUG(USDMAYA_PROXYACCESSOR).Msg("Update USD cache\n");
 
+    std::lock_guard<std::recursive_mutex> lock(accessorMutex());
+
     collectAccessorItems(node);
 
     // Early exit to avoid virtual function calls when no compute will happen
@@ -655,6 +755,13 @@ MStatus ProxyAccessor::stageChanged(const MObject& node, const UsdNotice::Object
         return MS::kUnknownParameter;
     }
 
+    // The notice may come from the compute of another accessor of the same stage, on another
+    // thread than the computes of this one.
+    std::lock_guard<std::recursive_mutex> lock(accessorMutex());
+
+    // Any edit made outside of compute may change value resolution or transforms.
+    invalidateResolveCache();
+
     bool needsForceCompute = true;
 
     if (_accessorInputItems.size() > 0) {
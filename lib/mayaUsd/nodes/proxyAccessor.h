@@ -22,9 +22,11 @@
 
 #include <pxr/base/tf/notice.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/usd/attributeQuery.h>
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 
 #include <maya/MCallbackIdArray.h>
 #include <maya/MDataBlock.h>
@@ -40,10 +42,6 @@
 #include <tuple>
 #include <type_traits>
 
-PXR_NAMESPACE_OPEN_SCOPE
-class UsdGeomXformCache;
-PXR_NAMESPACE_CLOSE_SCOPE
-
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MAYAUSD_NS_DEF {
@@ -173,9 +171,10 @@ public:
 private:
     /*! \brief  Single item in acceleration structure holding.
         To avoid expensive searches during compute, we cache MPlug, SdfPath and converter needed
-       to translate values between data models.
+       to translate values between data models, as well as the attribute query used to read and
+       write the USD value. The last SyncId tells against which resolve id the query was built.
      */
-    using Item = std::tuple<MPlug, SdfPath, const Converter*, SyncId>;
+    using Item = std::tuple<MPlug, SdfPath, const Converter*, SyncId, UsdAttributeQuery, SyncId>;
     using Container = std::vector<Item>;
 
     ProxyAccessor(ProxyStageProvider& provider)
@@ -201,7 +200,14 @@ private:
     //! \brief  Invalidate acceleration structure
     void invalidateAccessorItems() { _validAccessorItems = false; }
     //! \brief  Find accessor item in the acceleration structure
-    const Item* findAccessorItem(const MPlug& plug, bool isInput) const;
+    Item* findAccessorItem(const MPlug& plug, bool isInput);
+
+    //! \brief  Invalidate cached attribute queries and transforms if the stage was replaced
+    void validateResolveCache(const UsdStageRefPtr& stage);
+    //! \brief  Invalidate all cached attribute queries and transforms
+    void invalidateResolveCache();
+    //! \brief  Returns the attribute query of a property item, rebuilt if it is out of date
+    const UsdAttributeQuery& getAttributeQuery(Item& item, const UsdStageRefPtr& stage);
 
     //! \brief  Notification from MPxNode to insert accessor plugs dependencies
     MStatus addDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
@@ -215,7 +221,7 @@ private:
         const ConverterArgs& args);
     //! \brief  Using acceleration structure, do computation of a given accessor output plug.
     MStatus computeOutput(
-        const Item&          outputItemToCompute,
+        Item&                outputItemToCompute,
         const MMatrix&       proxyInclusiveMatrix,
         const UsdStageRefPtr stage,
         MDataBlock&          dataBlock,
@@ -234,8 +240,10 @@ private:
     //! \brief  Trigger computation of accessor plugs
     MStatus forceCompute(const MObject& node);
 
-    //! \brief  Is accessor compute started
-    bool inCompute() const { return (_inCompute != nullptr); }
+    //! \brief  Is accessor compute started on this thread
+    bool inCompute() const { return (currentComputeContext() != nullptr); }
+    //! \brief  Innermost compute context of this accessor on this thread, if any
+    ComputeContext* currentComputeContext() const;
 
     ProxyStageProvider& _stageProvider; //!< Accessor holds reference to stage provider in order
                                         //!< to query the stage and time
@@ -250,10 +258,6 @@ private:
     //! \brief  Acceleration structure holding all output accessor plugs
     Container _accessorOutputItems;
 
-    ComputeContext* _inCompute {
-        nullptr
-    }; //!< Detect nested compute and provide access to top level context
-
     //! \brief  Current evaluation id. Used to prevent endless recursion when computing cyclic
     //! dependencies
     Id _evaluationId;
@@ -261,6 +265,14 @@ private:
     //! \brief  Flag to indicate if acceleration structure is valid or needs to be recreated
     bool _validAccessorItems { false };
 
+    //! \brief  Bumped whenever value resolution of the stage may have changed, which makes the
+    //! cached attribute queries out of date
+    Id _resolveId;
+    //! \brief  Stage the cached attribute queries and transforms were built from
+    UsdStageWeakPtr _resolveStage;
+    //! \brief  World transforms reused between computes until the stage or time changes
+    UsdGeomXformCache _xformCache;
+
     friend ComputeContext;
 };
 
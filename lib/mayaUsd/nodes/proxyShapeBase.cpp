@@ -25,11 +25,13 @@
 #include <mayaUsd/utils/customLayerData.h>
 #include <mayaUsd/utils/layerMuting.h>
 #include <mayaUsd/utils/loadRules.h>
+#include <mayaUsd/utils/profilingScope.h>
 #include <mayaUsd/utils/query.h>
 #include <mayaUsd/utils/stageCache.h>
 #include <mayaUsd/utils/util.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 
+#include <pxr/base/arch/threads.h>
 #include <pxr/base/gf/bbox3d.h>
 #include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/ray.h>
@@ -50,6 +52,7 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -83,6 +86,7 @@
 #include <maya/MGlobal.h>
 #include <maya/MItDependencyNodes.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 #include <maya/MPoint.h>
@@ -116,6 +120,30 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(MayaUsdProxyShapeBaseTokens, MAYAUSD_PROXY_SHAPE_BASE_TOKENS);
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_PROXY_SHAPE_BOUNDS_USE_EXTENTS_HINT,
+    false,
+    "Use the authored extentsHint of the models when computing the bounding box of the proxy "
+    "shapes, instead of the bounds of all their descendants.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_PROXY_SHAPE_PREFETCH_LAYERS,
+    false,
+    "Open the layers used by the proxy shapes on worker threads while the Maya scene is read, "
+    "so that the stages only have to be composed when first computed.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_PROXY_SHAPE_PARALLEL_EVALUATION,
+    false,
+    "Let the evaluation manager compute independent proxy shapes concurrently in parallel "
+    "mode, instead of scheduling them serially.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_PROXY_SHAPE_TRACK_TIME_VARYING_PRIMS,
+    false,
+    "Track the prims of the proxy shape stages with time-varying attributes, so that time "
+    "changes don't redraw the stages without any.");
+
 MayaUsdProxyShapeBase::ClosestPointDelegate MayaUsdProxyShapeBase::_sharedClosestPointDelegate
     = nullptr;
 
@@ -139,9 +167,11 @@ MObject MayaUsdProxyShapeBase::filePathAttr;
 MObject MayaUsdProxyShapeBase::primPathAttr;
 MObject MayaUsdProxyShapeBase::excludePrimPathsAttr;
 MObject MayaUsdProxyShapeBase::loadPayloadsAttr;
+MObject MayaUsdProxyShapeBase::populationMaskAttr;
 MObject MayaUsdProxyShapeBase::shareStageAttr;
 MObject MayaUsdProxyShapeBase::timeAttr;
 MObject MayaUsdProxyShapeBase::complexityAttr;
+MObject MayaUsdProxyShapeBase::boundsLodScreenSizeAttr;
 MObject MayaUsdProxyShapeBase::inStageDataAttr;
 MObject MayaUsdProxyShapeBase::inStageDataCachedAttr;
 MObject MayaUsdProxyShapeBase::stageCacheIdAttr;
@@ -213,6 +243,75 @@ const int _shapeBaseProfilerCategory = MProfiler::addCategory(
     "ProxyShapeBase"
 #endif
 );
+
+// Depth of the outStageData computes running on this thread.
+thread_local int computeDepthOnThread = 0;
+
+// The stage set notices are listened to by the UI, so the ones of the proxy shapes computed
+// by the evaluation manager on worker threads are sent from the main thread once idle.
+void sendStageSetNoticeOnIdle(void* data)
+{
+    std::unique_ptr<MObjectHandle> proxyShapeHandle(static_cast<MObjectHandle*>(data));
+    if (!proxyShapeHandle->isAlive() || !proxyShapeHandle->isValid())
+        return;
+
+    MFnDependencyNode proxyShapeFn(proxyShapeHandle->object());
+    if (auto proxyShape = dynamic_cast<MayaUsdProxyShapeBase*>(proxyShapeFn.userNode()))
+        MayaUsdProxyStageSetNotice(*proxyShape).Send();
+}
+
+bool primHasTimeVaryingAttributes(const UsdPrim& prim)
+{
+    for (const UsdAttribute& attr : prim.GetAttributes()) {
+        if (attr.ValueMightBeTimeVarying()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void addTimeVaryingPrims(const UsdPrim& root, SdfPathSet* timeVaryingPrims)
+{
+    for (const UsdPrim& prim :
+         UsdPrimRange(root, UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate))) {
+        if (primHasTimeVaryingAttributes(prim)) {
+            timeVaryingPrims->insert(prim.GetPath());
+        }
+    }
+}
+
+// Return true if the changes can modify the bounds of the stage.  Only the
+// properties which are not read by the bounds computation are ignored: the
+// attributes of GPrim itself, the primvars and the material bindings.
+bool changesCanAffectBounds(const UsdNotice::ObjectsChanged& notice)
+{
+    if (!notice.GetResyncedPaths().empty()) {
+        return true;
+    }
+
+    static const std::unordered_set<TfToken, TfToken::HashFunctor> ignoredAttributes(
+        UsdGeomGprim::GetSchemaAttributeNames(false).cbegin(),
+        UsdGeomGprim::GetSchemaAttributeNames(false).cend());
+
+    for (const auto& changedPath : notice.GetChangedInfoOnlyPaths()) {
+        if (!changedPath.IsPrimPropertyPath()) {
+            return true;
+        }
+
+        // The skinning primvars move the points of skinned meshes.
+        const std::string& name = changedPath.GetName();
+        const bool         isPrimvar
+            = TfStringStartsWith(name, "primvars:") && !TfStringStartsWith(name, "primvars:skel:");
+        if (isPrimvar || ignoredAttributes.count(changedPath.GetNameToken()) > 0
+            || TfStringStartsWith(name, "material:binding")) {
+            continue;
+        }
+
+        return true;
+    }
+
+    return false;
+}
 } // namespace
 
 /* static */
@@ -263,6 +362,13 @@ MStatus MayaUsdProxyShapeBase::initialize()
     retValue = addAttribute(loadPayloadsAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
+    populationMaskAttr = typedAttrFn.create(
+        "populationMask", "pmsk", MFnData::kString, MObject::kNullObj, &retValue);
+    typedAttrFn.setAffectsAppearance(true);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = addAttribute(populationMaskAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
     shareStageAttr
         = numericAttrFn.create("shareStage", "scmp", MFnNumericData::kBoolean, 1.0, &retValue);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
@@ -289,6 +395,17 @@ MStatus MayaUsdProxyShapeBase::initialize()
     retValue = addAttribute(complexityAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
+    boundsLodScreenSizeAttr = numericAttrFn.create(
+        "boundsLodScreenSize", "blss", MFnNumericData::kFloat, 0.0, &retValue);
+    numericAttrFn.setMin(0.0);
+    numericAttrFn.setSoftMax(100.0);
+    numericAttrFn.setKeyable(true);
+    numericAttrFn.setReadable(false);
+    numericAttrFn.setAffectsAppearance(true);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = addAttribute(boundsLodScreenSizeAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
     inStageDataAttr = typedAttrFn.create(
         "inStageData", "id", MayaUsdStageData::mayaTypeId, MObject::kNullObj, &retValue);
     typedAttrFn.setReadable(false);
@@ -434,6 +551,13 @@ MStatus MayaUsdProxyShapeBase::initialize()
     retValue = attributeAffects(loadPayloadsAttr, outStageCacheIdAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
+    retValue = attributeAffects(populationMaskAttr, inStageDataCachedAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = attributeAffects(populationMaskAttr, outStageDataAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = attributeAffects(populationMaskAttr, outStageCacheIdAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
     retValue = attributeAffects(inStageDataAttr, inStageDataCachedAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
     retValue = attributeAffects(inStageDataAttr, outStageDataAttr);
@@ -487,6 +611,12 @@ void MayaUsdProxyShapeBase::SetClosestPointDelegate(ClosestPointDelegate delegat
     _sharedClosestPointDelegate = delegate;
 }
 
+/* static */
+MayaUsdProxyShapeBase::ClosestPointDelegate MayaUsdProxyShapeBase::GetClosestPointDelegate()
+{
+    return _sharedClosestPointDelegate;
+}
+
 /* virtual */
 bool MayaUsdProxyShapeBase::GetObjectSoftSelectEnabled() const { return false; }
 
@@ -498,7 +628,7 @@ void MayaUsdProxyShapeBase::enableProxyAccessor()
 /* virtual */
 void MayaUsdProxyShapeBase::postConstructor()
 {
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Issue Invalidate Stage Notice");
 
     setRenderable(true);
@@ -513,9 +643,9 @@ MStatus MayaUsdProxyShapeBase::compute(const MPlug& plug, MDataBlock& dataBlock)
         ProxyAccessor::compute(_usdAccessor, plug, dataBlock);
 
     if (plug == excludePrimPathsAttr || plug == timeAttr || plug == complexityAttr
-        || plug == drawRenderPurposeAttr || plug == drawProxyPurposeAttr
-        || plug == drawGuidePurposeAttr) {
-        MProfilingScope profilingScope(
+        || plug == boundsLodScreenSizeAttr || plug == drawRenderPurposeAttr
+        || plug == drawProxyPurposeAttr || plug == drawGuidePurposeAttr) {
+        ProfilingScope profilingScope(
             _shapeBaseProfilerCategory,
             MProfiler::kColorE_L3,
             "Call MHWRender::MRenderer::setGeometryDrawDirty from compute");
@@ -527,7 +657,9 @@ MStatus MayaUsdProxyShapeBase::compute(const MPlug& plug, MDataBlock& dataBlock)
         // connection from another node (e.g. "time1.outTime" being connected
         // to the proxy shape's "time" attribute). In that case,
         // setDependentsDirty() might not get called and only compute() might.
-        MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+        if (plug != timeAttr || isStageTimeVarying()) {
+            MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+        }
         return MS::kUnknownParameter;
     } else if (plug == inStageDataCachedAttr) {
         return computeInStageDataCached(dataBlock);
@@ -547,6 +679,43 @@ MStatus MayaUsdProxyShapeBase::compute(const MPlug& plug, MDataBlock& dataBlock)
     return MS::kUnknownParameter;
 }
 
+/* virtual */
+MPxNode::SchedulingType MayaUsdProxyShapeBase::schedulingType() const
+{
+    // The stage is opened under the locks of the stage caches and of the layer manager, the
+    // re-entrance of the computes is tracked per thread, and the proxy accessors serialize
+    // their computes, so independent proxy shapes can be computed concurrently.
+    static const bool parallel = TfGetEnvSetting(MAYAUSD_PROXY_SHAPE_PARALLEL_EVALUATION);
+    return parallel ? kParallel : MPxSurfaceShape::schedulingType();
+}
+
+/* virtual */
+bool MayaUsdProxyShapeBase::getInternalValue(const MPlug& plug, MDataHandle& dataHandle)
+{
+    // The load rules changed since the last save are only recorded in memory
+    // until they are written to the attribute.
+    if (isLoadRulesAttribute(plug)) {
+        MString loadRulesText;
+        if (MayaUsdProxyShapeStageExtraData::getPendingLoadRulesText(*this, loadRulesText)) {
+            dataHandle.set(loadRulesText);
+            return true;
+        }
+    }
+
+    return MPxSurfaceShape::getInternalValue(plug, dataHandle);
+}
+
+/* virtual */
+bool MayaUsdProxyShapeBase::setInternalValue(const MPlug& plug, const MDataHandle& dataHandle)
+{
+    // Setting the load rules attribute replaces the recorded rules.
+    if (isLoadRulesAttribute(plug)) {
+        MayaUsdProxyShapeStageExtraData::discardPendingLoadRules(*this);
+    }
+
+    return MPxSurfaceShape::setInternalValue(plug, dataHandle);
+}
+
 #if defined(WANT_UFE_BUILD)
 /* virtual */
 SdfLayerRefPtr MayaUsdProxyShapeBase::computeRootLayer(MDataBlock& dataBlock, const std::string&)
@@ -647,9 +816,40 @@ void reproduceSharedStageState(
 
 } // namespace
 
+std::string MayaUsdProxyShapeBase::_ResolveFilePath(const MString& file) const
+{
+    std::string fileString = TfStringTrimRight(file.asChar());
+
+    TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
+        .Msg("ProxyShapeBase::reloadStage original USD file path is %s\n", fileString.c_str());
+
+    ghc::filesystem::path filestringPath(fileString);
+    if (filestringPath.is_absolute()) {
+        fileString = UsdMayaUtilFileSystem::resolvePath(fileString);
+        TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
+            .Msg(
+                "ProxyShapeBase::reloadStage resolved the USD file path to %s\n",
+                fileString.c_str());
+    } else {
+        fileString = UsdMayaUtilFileSystem::resolveRelativePathWithinMayaContext(
+            thisMObject(), fileString);
+        TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
+            .Msg(
+                "ProxyShapeBase::reloadStage resolved the relative USD file path to %s\n",
+                fileString.c_str());
+    }
+
+    // Fall back on providing the path "as is" to USD
+    if (fileString.empty()) {
+        fileString.assign(file.asChar(), file.length());
+    }
+
+    return fileString;
+}
+
 MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
 {
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Compute inStageDataCached plug");
 
     MStatus retValue = MS::kSuccess;
@@ -747,12 +947,16 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
         ? UsdStage::InitialLoadSet::LoadAll
         : UsdStage::InitialLoadSet::LoadNone;
 
-    // If there is a dynamic attribute containing the exact load rules
-    // for payload, start by loading nothing. The correct payload will
-    // be loaded by the load rules.
-    if (hasLoadRulesAttribute(*this))
+    // If there is a dynamic attribute or recorded rules containing the
+    // exact load rules for payload, start by loading nothing. The correct
+    // payload will be loaded by the load rules.
+    if (MayaUsdProxyShapeStageExtraData::hasPendingLoadRules(*this)
+        || hasLoadRulesAttribute(*this))
         loadSet = UsdStage::InitialLoadSet::LoadNone;
 
+    // Only the masked prims are composed when the population mask is not empty.
+    const UsdStagePopulationMask populationMask = _GetPopulationMask(dataBlock);
+
     // If inData has an incoming connection, then use it. Otherwise generate stage from the filepath
     if (!inDataHandle.data().isNull()) {
         MayaUsdStageData* inStageData
@@ -781,37 +985,15 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
             //
             // let the usd stage cache deal with caching the usd stage data
             //
-            std::string fileString = TfStringTrimRight(file.asChar());
-
-            TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
-                .Msg(
-                    "ProxyShapeBase::reloadStage original USD file path is %s\n",
-                    fileString.c_str());
-
-            ghc::filesystem::path filestringPath(fileString);
-            if (filestringPath.is_absolute()) {
-                fileString = UsdMayaUtilFileSystem::resolvePath(fileString);
-                TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
-                    .Msg(
-                        "ProxyShapeBase::reloadStage resolved the USD file path to %s\n",
-                        fileString.c_str());
-            } else {
-                fileString = UsdMayaUtilFileSystem::resolveRelativePathWithinMayaContext(
-                    thisMObject(), fileString);
-                TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
-                    .Msg(
-                        "ProxyShapeBase::reloadStage resolved the relative USD file path to %s\n",
-                        fileString.c_str());
-            }
-
-            // Fall back on providing the path "as is" to USD
-            if (fileString.empty()) {
-                fileString.assign(file.asChar(), file.length());
-            }
+            std::string fileString = _ResolveFilePath(file);
 
             TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
                 .Msg("ProxyShapeBase::loadStage called for the usd file: %s\n", fileString.c_str());
 
+            // The layers opened in the background while reading the Maya
+            // file are found by SdfLayer::FindOrOpen() below.
+            UsdMayaStageCache::WaitForPrefetchedLayers();
+
             // == Load the Stage
 
             {
@@ -849,7 +1031,7 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
                     //       stage we potentially find in the stage cache.
                     SdfLayerRefPtr sessionLayer = computeSessionLayer(dataBlock);
 
-                    MProfilingScope profilingScope(
+                    ProfilingScope profilingScope(
                         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Open stage");
 
                     static const MString kSessionLayerOptionVarName(
@@ -875,7 +1057,15 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
                     //       If the stage is not in the cache and no session layer is passed
                     //       then UsdStage::Open will create the in-memory session layer for us,
                     //       just as we want.
-                    if (sessionLayer) {
+                    if (!populationMask.IncludesSubtree(SdfPath::AbsoluteRootPath())) {
+                        sharedUsdStage = _OpenMaskedStage(
+                            _maskedSharedStage,
+                            rootLayer,
+                            sessionLayer,
+                            ArGetResolver().CreateDefaultContextForAsset(fileString),
+                            populationMask,
+                            loadSet);
+                    } else if (sessionLayer) {
                         sharedUsdStage = UsdStage::Open(
                             rootLayer,
                             sessionLayer,
@@ -975,7 +1165,7 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
                 newReferencedLayers, _unsharedStageRootLayer, MayaUsdMetadata->ReferencedLayers);
         }
 
-        unsharedUsdStage = getUnsharedStage(loadSet);
+        unsharedUsdStage = getUnsharedStage(loadSet, populationMask);
         finalUsdStage = unsharedUsdStage;
 
         // Transfer data of the original root layer to the new unshared root layer,
@@ -987,7 +1177,8 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
 
     if (finalUsdStage) {
         primPath = finalUsdStage->GetPseudoRoot().GetPath();
-        copyLoadRulesFromAttribute(*this, *finalUsdStage);
+        if (!MayaUsdProxyShapeStageExtraData::restorePendingLoadRules(*this, *finalUsdStage))
+            copyLoadRulesFromAttribute(*this, *finalUsdStage);
         copyLayerMutingFromAttribute(*this, *finalUsdStage);
         updateShareMode(sharedUsdStage, unsharedUsdStage, loadSet);
     }
@@ -1006,7 +1197,9 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
     return MS::kSuccess;
 }
 
-UsdStageRefPtr MayaUsdProxyShapeBase::getUnsharedStage(UsdStage::InitialLoadSet loadSet)
+UsdStageRefPtr MayaUsdProxyShapeBase::getUnsharedStage(
+    UsdStage::InitialLoadSet      loadSet,
+    const UsdStagePopulationMask& mask)
 {
     // The unshared stages are *also* kept in a stage cache so that we can find them
     // again when proxy shape attribute change. For example, if the 'loadPayloads'
@@ -1025,9 +1218,48 @@ UsdStageRefPtr MayaUsdProxyShapeBase::getUnsharedStage(UsdStage::InitialLoadSet
     if (!_unsharedStageSessionLayer)
         _unsharedStageSessionLayer = SdfLayer::CreateAnonymous();
 
+    if (!mask.IncludesSubtree(SdfPath::AbsoluteRootPath())) {
+        return _OpenMaskedStage(
+            _maskedUnsharedStage,
+            _unsharedStageRootLayer,
+            _unsharedStageSessionLayer,
+            ArResolverContext(),
+            mask,
+            loadSet);
+    }
+
     return UsdStage::UsdStage::Open(_unsharedStageRootLayer, _unsharedStageSessionLayer, loadSet);
 }
 
+UsdStageRefPtr MayaUsdProxyShapeBase::_OpenMaskedStage(
+    _MaskedStage&                 maskedStage,
+    const SdfLayerRefPtr&         rootLayer,
+    const SdfLayerRefPtr&         sessionLayer,
+    const ArResolverContext&      resolverContext,
+    const UsdStagePopulationMask& mask,
+    UsdStage::InitialLoadSet      loadSet)
+{
+    const bool sameLayers = maskedStage.stage && maskedStage.stage->GetRootLayer() == rootLayer
+        && (!sessionLayer || maskedStage.stage->GetSessionLayer() == sessionLayer);
+
+    if (sameLayers && maskedStage.loadSet == loadSet
+        && maskedStage.stage->GetPopulationMask() == mask) {
+        return maskedStage.stage;
+    }
+
+    // Keep the session layer edits when only the mask or the load set changed.
+    SdfLayerRefPtr maskedSessionLayer = sessionLayer;
+    if (!maskedSessionLayer && sameLayers)
+        maskedSessionLayer = maskedStage.stage->GetSessionLayer();
+    if (!maskedSessionLayer)
+        maskedSessionLayer = SdfLayer::CreateAnonymous();
+
+    maskedStage.stage
+        = UsdStage::OpenMasked(rootLayer, maskedSessionLayer, resolverContext, mask, loadSet);
+    maskedStage.loadSet = loadSet;
+    return maskedStage.stage;
+}
+
 void MayaUsdProxyShapeBase::updateShareMode(
     const UsdStageRefPtr&    sharedUsdStage,
     const UsdStageRefPtr&    unsharedUsdStage,
@@ -1085,13 +1317,21 @@ void MayaUsdProxyShapeBase::transferSessionLayer(
 
 MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
 {
-    MProfilingScope computeOutStageDatacomputeOutStageData(
+    ProfilingScope computeOutStageDatacomputeOutStageData(
         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Compute outStageData plug");
 
     struct in_computeGuard
     {
-        in_computeGuard() { in_compute++; }
-        ~in_computeGuard() { in_compute--; }
+        in_computeGuard()
+        {
+            in_compute++;
+            computeDepthOnThread++;
+        }
+        ~in_computeGuard()
+        {
+            in_compute--;
+            computeDepthOnThread--;
+        }
     } in_computeGuard;
 
     MStatus retValue = MS::kSuccess;
@@ -1099,6 +1339,11 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
     const bool isNormalContext = dataBlock.context().isNormal();
     if (isNormalContext) {
         TfReset(_boundingBoxCache);
+        _bboxCache.reset();
+
+        _timeVaryingPrimsStage = nullptr;
+        _timeVaryingPrims.clear();
+        _timeVaryingPrimsScanned = false;
 
         // Reset the stage listener until we determine that everything is valid.
         _stageNoticeListener.SetStage(UsdStageWeakPtr());
@@ -1153,28 +1398,39 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
         usdPrim = usdStage->GetPseudoRoot();
     }
 
-    // Create the output outData
-    MFnPluginData pluginDataFn;
-    pluginDataFn.create(MayaUsdStageData::mayaTypeId, &retValue);
-    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    const SdfPath outPrimPath = usdPrim ? usdPrim.GetPath() : usdStage->GetPseudoRoot().GetPath();
 
-    MayaUsdStageData* stageData = reinterpret_cast<MayaUsdStageData*>(pluginDataFn.data(&retValue));
+    MDataHandle outDataHandle = dataBlock.outputValue(outStageDataAttr, &retValue);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
-    // Set the outUsdStageData
-    stageData->stage = usdStage;
-    stageData->primPath = usdPrim ? usdPrim.GetPath() : usdStage->GetPseudoRoot().GetPath();
+    // When the stage and prim path did not change, keep handing out the same data so
+    // that it keeps its version and downstream nodes do not resolve the stage again.
+    const MayaUsdStageData* prevData
+        = dynamic_cast<const MayaUsdStageData*>(outDataHandle.asPluginData());
+    if (!prevData || prevData->stage != usdStage || prevData->primPath != outPrimPath) {
+        // Create the output outData
+        MFnPluginData pluginDataFn;
+        pluginDataFn.create(MayaUsdStageData::mayaTypeId, &retValue);
+        CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
-    //
-    // set the data on the output plug
-    //
-    MDataHandle outDataHandle = dataBlock.outputValue(outStageDataAttr, &retValue);
-    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+        MayaUsdStageData* stageData
+            = reinterpret_cast<MayaUsdStageData*>(pluginDataFn.data(&retValue));
+        CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
+        // Set the outUsdStageData
+        stageData->stage = usdStage;
+        stageData->primPath = outPrimPath;
 
-    outDataHandle.set(stageData);
+        //
+        // set the data on the output plug
+        //
+        outDataHandle.set(stageData);
+    }
     outDataHandle.setClean();
 
     if (isNormalContext) {
+        _timeVaryingPrimsStage = usdStage;
+
         // Start listening for notices for the USD stage.
         _stageNoticeListener.SetStage(usdStage);
         _stageNoticeListener.SetStageContentsChangedCallback(
@@ -1192,7 +1448,11 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
                 return _OnLayerMutingChanged(notice);
             });
 
-        MayaUsdProxyStageSetNotice(*this).Send();
+        if (ArchIsMainThread()) {
+            MayaUsdProxyStageSetNotice(*this).Send();
+        } else {
+            MGlobal::executeTaskOnIdle(sendStageSetNoticeOnIdle, new MObjectHandle(thisMObject()));
+        }
     }
 
     return MS::kSuccess;
@@ -1357,7 +1617,7 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilerScope(
+    ProfilingScope profilerScope(
         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Compute bounding box");
 
     MStatus status;
@@ -1381,7 +1641,7 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         return cacheLookup->second;
     }
 
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _shapeBaseProfilerCategory, MProfiler::kColorB_L1, "Compute USD Stage BoundingBox");
 
     UsdPrim prim = _GetUsdPrim(dataBlock);
@@ -1389,20 +1649,35 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         return MBoundingBox();
     }
 
-    const UsdGeomImageable imageablePrim(prim);
-
     bool drawRenderPurpose = false;
     bool drawProxyPurpose = true;
     bool drawGuidePurpose = false;
     _GetDrawPurposeToggles(dataBlock, &drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
 
-    const TfToken purpose1 = UsdGeomTokens->default_;
-    const TfToken purpose2 = drawRenderPurpose ? UsdGeomTokens->render : TfToken();
-    const TfToken purpose3 = drawProxyPurpose ? UsdGeomTokens->proxy : TfToken();
-    const TfToken purpose4 = drawGuidePurpose ? UsdGeomTokens->guide : TfToken();
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose) {
+        purposes.push_back(UsdGeomTokens->render);
+    }
+    if (drawProxyPurpose) {
+        purposes.push_back(UsdGeomTokens->proxy);
+    }
+    if (drawGuidePurpose) {
+        purposes.push_back(UsdGeomTokens->guide);
+    }
 
-    GfBBox3d allBox
-        = imageablePrim.ComputeUntransformedBound(currTime, purpose1, purpose2, purpose3, purpose4);
+    // The bounding box cache of the shape is only cleared by the stage
+    // changes which can modify the bounds, and by a time change.
+    if (!_bboxCache) {
+        static const bool useExtentsHint
+            = TfGetEnvSetting(MAYAUSD_PROXY_SHAPE_BOUNDS_USE_EXTENTS_HINT);
+        nonConstThis->_bboxCache
+            = std::make_unique<UsdGeomBBoxCache>(currTime, purposes, useExtentsHint);
+    } else {
+        _bboxCache->SetTime(currTime);
+        _bboxCache->SetIncludedPurposes(purposes);
+    }
+
+    GfBBox3d allBox = _bboxCache->ComputeUntransformedBound(prim);
 
     UsdMayaUtil::AddMayaExtents(allBox, prim, currTime);
 
@@ -1423,7 +1698,13 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     return retval;
 }
 
-void MayaUsdProxyShapeBase::clearBoundingBoxCache() { _boundingBoxCache.clear(); }
+void MayaUsdProxyShapeBase::clearBoundingBoxCache()
+{
+    _boundingBoxCache.clear();
+    if (_bboxCache) {
+        _bboxCache->Clear();
+    }
+}
 
 bool MayaUsdProxyShapeBase::isStageValid() const
 {
@@ -1546,8 +1827,11 @@ MStatus MayaUsdProxyShapeBase::setDependentsDirty(const MPlug& plug, MPlugArray&
     // If/when the MPxDrawOverride for the proxy shape specifies
     // isAlwaysDirty=false to improve performance, we must be sure to notify
     // the Maya renderer that the geometry is dirty and needs to be redrawn
-    // when any plug on the proxy shape is dirtied.
-    MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+    // when any plug on the proxy shape is dirtied. Time changes can't change
+    // the drawing of a stage without time-varying attributes.
+    if (plug != timeAttr || isStageTimeVarying()) {
+        MHWRender::MRenderer::setGeometryDrawDirty(thisMObject());
+    }
 
     if (plug == excludePrimPathsAttr) {
         _IncreaseExcludePrimPathsVersion();
@@ -1558,6 +1842,21 @@ MStatus MayaUsdProxyShapeBase::setDependentsDirty(const MPlug& plug, MPlugArray&
         || plug == shareStageAttr || plug == inStageDataAttr || plug == stageCacheIdAttr) {
         _IncreaseUsdStageVersion();
         MayaUsdProxyStageInvalidateNotice(*this).Send();
+
+        // Start opening the layers of the stage while Maya reads the rest of
+        // the file, the stage is composed later by the compute. The layers
+        // shared with the other proxy shapes of the scene are opened once.
+        if (plug == filePathAttr && MFileIO::isReadingFile()
+            && TfGetEnvSetting(MAYAUSD_PROXY_SHAPE_PREFETCH_LAYERS)) {
+            const MString file = MPlug(thisMObject(), filePathAttr).asString();
+            if (file.length() > 0) {
+                const bool loadPayloads = MPlug(thisMObject(), loadPayloadsAttr).asBool();
+                UsdMayaStageCache::PrefetchLayers(
+                    { _ResolveFilePath(file) },
+                    loadPayloads ? UsdStage::InitialLoadSet::LoadAll
+                                 : UsdStage::InitialLoadSet::LoadNone);
+            }
+        }
     }
 
     retValue = MPxSurfaceShape::setDependentsDirty(plug, plugArray);
@@ -1665,6 +1964,15 @@ int MayaUsdProxyShapeBase::_GetComplexity(MDataBlock dataBlock) const
     return complexity;
 }
 
+float MayaUsdProxyShapeBase::getBoundsLodScreenSize() const
+{
+    MStatus     status;
+    MDataBlock  dataBlock = const_cast<MayaUsdProxyShapeBase*>(this)->forceCache();
+    const float screenSize = dataBlock.inputValue(boundsLodScreenSizeAttr, &status).asFloat();
+
+    return status == MStatus::kSuccess ? screenSize : 0.0f;
+}
+
 UsdTimeCode MayaUsdProxyShapeBase::getTime() const
 {
     return _GetTime(const_cast<MayaUsdProxyShapeBase*>(this)->forceCache());
@@ -1729,6 +2037,22 @@ SdfPathVector MayaUsdProxyShapeBase::_GetExcludePrimPaths(MDataBlock dataBlock)
     return ret;
 }
 
+UsdStagePopulationMask MayaUsdProxyShapeBase::_GetPopulationMask(MDataBlock dataBlock) const
+{
+    const MString populationMaskStr = dataBlock.inputValue(populationMaskAttr).asString();
+    std::vector<std::string> maskPaths = TfStringTokenize(populationMaskStr.asChar(), ",");
+    if (maskPaths.empty())
+        return UsdStagePopulationMask::All();
+
+    UsdStagePopulationMask mask;
+    for (const std::string& maskPath : maskPaths) {
+        const SdfPath path(TfStringTrim(maskPath));
+        if (path.IsAbsolutePath() && path.IsAbsoluteRootOrPrimPath())
+            mask.Add(path);
+    }
+    return mask.IsEmpty() ? UsdStagePopulationMask::All() : mask;
+}
+
 bool MayaUsdProxyShapeBase::_GetDrawPurposeToggles(
     MDataBlock dataBlock,
     bool*      drawRenderPurpose,
@@ -1857,6 +2181,65 @@ MSelectionMask MayaUsdProxyShapeBase::getShapeSelectionMask() const
 
 bool MayaUsdProxyShapeBase::canBeSoftSelected() const { return false; }
 
+bool MayaUsdProxyShapeBase::isStageTimeVarying()
+{
+    static const bool trackTimeVaryingPrims
+        = TfGetEnvSetting(MAYAUSD_PROXY_SHAPE_TRACK_TIME_VARYING_PRIMS);
+
+    const UsdStageRefPtr stage = _timeVaryingPrimsStage;
+    if (!trackTimeVaryingPrims || !stage) {
+        return true;
+    }
+
+    if (!_timeVaryingPrimsScanned) {
+        ProfilingScope profilingScope(
+            _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Find time-varying prims");
+
+        addTimeVaryingPrims(stage->GetPseudoRoot(), &_timeVaryingPrims);
+        _timeVaryingPrimsScanned = true;
+    }
+
+    return !_timeVaryingPrims.empty();
+}
+
+void MayaUsdProxyShapeBase::_UpdateTimeVaryingPrims(const UsdNotice::ObjectsChanged& notice)
+{
+    const UsdStageRefPtr stage = _timeVaryingPrimsStage;
+    if (!_timeVaryingPrimsScanned || !stage) {
+        return;
+    }
+
+    auto updatePrims = [this, &stage](const SdfPath& changedPath) {
+        const SdfPath primPath = changedPath.GetPrimPath();
+        const UsdPrim prim = stage->GetPrimAtPath(primPath);
+
+        // Property changes only affect their prim, the other changes, like a
+        // new reference or value clips, can affect the whole subtree.
+        if (changedPath.IsPropertyPath()) {
+            _timeVaryingPrims.erase(primPath);
+            if (prim && primHasTimeVaryingAttributes(prim)) {
+                _timeVaryingPrims.insert(primPath);
+            }
+            return;
+        }
+
+        auto it = _timeVaryingPrims.lower_bound(primPath);
+        while (it != _timeVaryingPrims.end() && it->HasPrefix(primPath)) {
+            it = _timeVaryingPrims.erase(it);
+        }
+        if (prim) {
+            addTimeVaryingPrims(prim, &_timeVaryingPrims);
+        }
+    };
+
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        updatePrims(path);
+    }
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        updatePrims(path);
+    }
+}
+
 void MayaUsdProxyShapeBase::_OnStageContentsChanged(const UsdNotice::StageContentsChanged& notice)
 {
     // If the USD stage this proxy represents changes without Maya's knowledge,
@@ -1875,13 +2258,18 @@ void MayaUsdProxyShapeBase::_OnLayerMutingChanged(const UsdNotice::LayerMutingCh
 
 void MayaUsdProxyShapeBase::_OnStageObjectsChanged(const UsdNotice::ObjectsChanged& notice)
 {
-    MProfilingScope profilingScope(
+    ProfilingScope profilingScope(
         _shapeBaseProfilerCategory, MProfiler::kColorB_L1, "Process USD objects changed");
 
     // This will definitely force a BBox recomputation on "Frame All" or when framing a selected
     // stage. Computing bounds in USD is expensive, so if it pops up in other frequently used
     // scenarios we will have to investigate ways to make this cache clearing less expensive.
-    clearBoundingBoxCache();
+    // Changes which can't move the prims, like display colors or material bindings, keep it.
+    if (changesCanAffectBounds(notice)) {
+        clearBoundingBoxCache();
+    }
+
+    _UpdateTimeVaryingPrims(notice);
 
     ProxyAccessor::stageChanged(_usdAccessor, thisMObject(), notice);
     MayaUsdProxyStageObjectsChangedNotice(*this, notice).Send();
@@ -1953,7 +2341,7 @@ bool MayaUsdProxyShapeBase::closestPoint(
     bool /*findClosestOnMiss*/,
     double /*tolerance*/)
 {
-    MProfilingScope profilerScope(
+    ProfilingScope profilerScope(
         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Compute closest point");
 
     if (_sharedClosestPointDelegate) {
@@ -1994,4 +2382,7 @@ Ufe::Path MayaUsdProxyShapeBase::ufePath() const
 
 std::atomic<int> MayaUsdProxyShapeBase::in_compute { 0 };
 
+/* static */
+int MayaUsdProxyShapeBase::computeDepth() { return computeDepthOnThread; }
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -20,10 +20,13 @@
 #include <pxr/base/gf/vec3d.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/ar/resolverContext.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stagePopulationMask.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
 
 #include <maya/MBoundingBox.h>
 #include <maya/MDGContext.h>
@@ -40,6 +43,8 @@
 #include <maya/MTypeId.h>
 
 #include <map>
+#include <memory>
+#include <vector>
 
 #if defined(WANT_UFE_BUILD)
 #include <ufe/ufe.h>
@@ -99,12 +104,16 @@ public:
     MAYAUSD_CORE_PUBLIC
     static MObject loadPayloadsAttr;
     MAYAUSD_CORE_PUBLIC
+    static MObject populationMaskAttr;
+    MAYAUSD_CORE_PUBLIC
     static MObject shareStageAttr;
     MAYAUSD_CORE_PUBLIC
     static MObject timeAttr;
     MAYAUSD_CORE_PUBLIC
     static MObject complexityAttr;
     MAYAUSD_CORE_PUBLIC
+    static MObject boundsLodScreenSizeAttr;
+    MAYAUSD_CORE_PUBLIC
     static MObject inStageDataAttr;
     MAYAUSD_CORE_PUBLIC
     static MObject inStageDataCachedAttr;
@@ -154,6 +163,9 @@ public:
     MAYAUSD_CORE_PUBLIC
     static void SetClosestPointDelegate(ClosestPointDelegate delegate);
 
+    MAYAUSD_CORE_PUBLIC
+    static ClosestPointDelegate GetClosestPointDelegate();
+
     // UsdMayaUsdPrimProvider overrides:
     /**
      * accessor to get the usdprim
@@ -172,6 +184,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     MStatus compute(const MPlug& plug, MDataBlock& dataBlock) override;
     MAYAUSD_CORE_PUBLIC
+    SchedulingType schedulingType() const override;
+    MAYAUSD_CORE_PUBLIC
+    bool getInternalValue(const MPlug& plug, MDataHandle& dataHandle) override;
+    MAYAUSD_CORE_PUBLIC
+    bool setInternalValue(const MPlug& plug, const MDataHandle& dataHandle) override;
+    MAYAUSD_CORE_PUBLIC
     bool isBounded() const override;
     MAYAUSD_CORE_PUBLIC
     MBoundingBox boundingBox() const override;
@@ -199,6 +217,10 @@ public:
     MAYAUSD_CORE_PUBLIC
     int getComplexity() const;
 
+    /// Projected size in pixels below which prims are drawn as their bounds, 0 when disabled.
+    MAYAUSD_CORE_PUBLIC
+    float getBoundsLodScreenSize() const;
+
     MAYAUSD_CORE_PUBLIC
     std::vector<std::string> getMutedLayers() const;
 
@@ -286,6 +308,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool isStageIncoming() const;
 
+    /// Returns false when no attribute of the last computed stage might be
+    /// time-varying, so that a time change can't change its drawing. Always
+    /// true unless MAYAUSD_PROXY_SHAPE_TRACK_TIME_VARYING_PRIMS is enabled.
+    MAYAUSD_CORE_PUBLIC
+    bool isStageTimeVarying();
+
     MAYAUSD_CORE_PUBLIC
     bool isIncomingLayer(const std::string& layerIdentifier) const;
 
@@ -375,9 +403,30 @@ private:
         const UsdStageRefPtr&    unsharedUsdStage,
         UsdStage::InitialLoadSet loadSet);
 
-    UsdStageRefPtr getUnsharedStage(UsdStage::InitialLoadSet loadSet);
+    UsdStageRefPtr getUnsharedStage(
+        UsdStage::InitialLoadSet      loadSet,
+        const UsdStagePopulationMask& mask = UsdStagePopulationMask::All());
 
-    SdfPathVector _GetExcludePrimPaths(MDataBlock dataBlock) const;
+    // A stage opened with a population mask, with the load set it was opened with.
+    struct _MaskedStage
+    {
+        UsdStageRefPtr           stage;
+        UsdStage::InitialLoadSet loadSet { UsdStage::InitialLoadSet::LoadAll };
+    };
+
+    // Open the stage with the population mask, or reuse the one previously opened in
+    // maskedStage when it was opened with the same arguments. A null sessionLayer keeps the
+    // session layer of the previous stage, like UsdStage::Open() finds it in the stage cache.
+    UsdStageRefPtr _OpenMaskedStage(
+        _MaskedStage&                 maskedStage,
+        const SdfLayerRefPtr&         rootLayer,
+        const SdfLayerRefPtr&         sessionLayer,
+        const ArResolverContext&      resolverContext,
+        const UsdStagePopulationMask& mask,
+        UsdStage::InitialLoadSet      loadSet);
+
+    SdfPathVector          _GetExcludePrimPaths(MDataBlock dataBlock) const;
+    UsdStagePopulationMask _GetPopulationMask(MDataBlock dataBlock) const;
     int           _GetComplexity(MDataBlock dataBlock) const;
     UsdTimeCode   _GetTime(MDataBlock dataBlock) const;
 
@@ -387,6 +436,12 @@ private:
         bool*      drawProxyPurpose,
         bool*      drawGuidePurpose) const;
 
+    // Resolve the filePath attribute value to the path of the root layer.
+    std::string _ResolveFilePath(const MString& file) const;
+
+    // Update the time-varying prims under the paths changed by the notice.
+    void _UpdateTimeVaryingPrims(const UsdNotice::ObjectsChanged& notice);
+
     void _OnStageContentsChanged(const UsdNotice::StageContentsChanged& notice);
     void _OnStageObjectsChanged(const UsdNotice::ObjectsChanged& notice);
     void _OnLayerMutingChanged(const UsdNotice::LayerMutingChanged& notice);
@@ -394,6 +449,7 @@ private:
     UsdMayaStageNoticeListener _stageNoticeListener;
 
     std::map<UsdTimeCode, MBoundingBox> _boundingBoxCache;
+    std::unique_ptr<UsdGeomBBoxCache>   _bboxCache;
     size_t                              _excludePrimPathsVersion { 1 };
     size_t                              _UsdStageVersion { 1 };
 
@@ -418,12 +474,29 @@ private:
     // We need to keep track of unshared sublayers (otherwise they get removed)
     std::vector<SdfLayerRefPtr> _unsharedStageRootSublayers;
 
+    // Stages opened with a population mask. UsdStage::OpenMasked() doesn't look stages up in
+    // the stage cache and the proxy shapes opening the whole stage must not find them there,
+    // so each proxy shape keeps its own.
+    _MaskedStage _maskedSharedStage;
+    _MaskedStage _maskedUnsharedStage;
+
+    // Prims with attributes which might be time-varying, scanned on first use and then updated
+    // from the stage notices.
+    UsdStageWeakPtr _timeVaryingPrimsStage;
+    SdfPathSet      _timeVaryingPrims;
+    bool            _timeVaryingPrimsScanned { false };
+
     // Keep track of the incoming layers
     std::set<std::string> _incomingLayers;
 
 public:
     // Counter for the number of times compute is re-entered
     static std::atomic<int> in_compute;
+
+    // Number of times compute is re-entered on the calling thread. Unlike in_compute, it
+    // doesn't count the proxy shapes computed concurrently by the evaluation manager.
+    MAYAUSD_CORE_PUBLIC
+    static int computeDepth();
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -17,9 +17,12 @@
 
 #include <mayaUsd/utils/loadRules.h>
 
+#include <maya/MGlobal.h>
+#include <maya/MModelMessage.h>
 #include <maya/MSceneMessage.h>
 
 #include <set>
+#include <unordered_map>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -27,7 +30,13 @@ namespace {
 
 using ProxyShapeSet = std::set<MayaUsdProxyShapeBase*>;
 
+// Load rules recorded since the last scene save, not yet written to the proxy shape attribute.
+using PendingLoadRules
+    = std::unordered_map<const MayaUsdProxyShapeBase*, PXR_NS::UsdStageLoadRules>;
+
 MCallbackId beforeFileSaveCallbackId = 0;
+MCallbackId beforeFileExportCallbackId = 0;
+MCallbackId beforeDuplicateCallbackId = 0;
 
 ProxyShapeSet& getTrackedProxyShapes()
 {
@@ -35,6 +44,12 @@ ProxyShapeSet& getTrackedProxyShapes()
     return tracked;
 }
 
+PendingLoadRules& getPendingLoadRules()
+{
+    static PendingLoadRules pending;
+    return pending;
+}
+
 void onMayaAboutToSave(void* /* unused */) { MayaUsdProxyShapeStageExtraData::saveAllStageData(); }
 
 // Saving some stage data for all valid tracked stages or one specific stage.
@@ -60,6 +75,46 @@ void saveTrackedData(const UsdStageRefPtr& stage, SaveFunc saveFunc)
 void saveTrackedLoadRules(const UsdStageRefPtr& stage)
 {
     saveTrackedData(stage, copyLoadRulesToAttribute);
+
+    if (stage)
+        return;
+
+    // Every proxy shape attribute is now up to date.
+    getPendingLoadRules().clear();
+}
+
+// Writes the load rules recorded since the last save to the proxy shapes before
+// their attributes are exported or duplicated.
+void onMayaAboutToCopy(void* /* unused */)
+{
+    PendingLoadRules& pending = getPendingLoadRules();
+    if (pending.empty())
+        return;
+
+    for (MayaUsdProxyShapeBase* proxyShape : getTrackedProxyShapes()) {
+        if (!proxyShape || pending.count(proxyShape) == 0)
+            continue;
+
+        auto stagePtr = proxyShape->getUsdStage();
+        if (stagePtr)
+            copyLoadRulesToAttribute(*stagePtr, *proxyShape);
+    }
+
+    pending.clear();
+}
+
+MStatus recordLoadRules(const PXR_NS::UsdStage& stage, MayaUsdProxyShapeBase& proxyShape)
+{
+    getPendingLoadRules()[&proxyShape] = stage.GetLoadRules();
+
+    // The attribute reads the recorded rules until they are written to it.
+    MStatus status = createLoadRulesAttribute(proxyShape);
+
+    // Writing the attribute used to mark the scene as modified, the rules need
+    // to be saved all the same.
+    MGlobal::executeCommand("file -modified 1");
+
+    return status;
 }
 
 } // namespace
@@ -72,6 +127,14 @@ MStatus MayaUsdProxyShapeStageExtraData::initialize()
         beforeFileSaveCallbackId = MSceneMessage::addCallback(
             MSceneMessage::kBeforeSave, onMayaAboutToSave, nullptr, &status);
     }
+    if (beforeFileExportCallbackId == 0) {
+        beforeFileExportCallbackId = MSceneMessage::addCallback(
+            MSceneMessage::kBeforeExport, onMayaAboutToCopy, nullptr, &status);
+    }
+    if (beforeDuplicateCallbackId == 0) {
+        beforeDuplicateCallbackId
+            = MModelMessage::addBeforeDuplicateCallback(onMayaAboutToCopy, nullptr, &status);
+    }
     return status;
 }
 
@@ -85,6 +148,16 @@ MStatus MayaUsdProxyShapeStageExtraData::finalize()
         beforeFileSaveCallbackId = 0;
     }
 
+    if (beforeFileExportCallbackId != 0) {
+        status = MMessage::removeCallback(beforeFileExportCallbackId);
+        beforeFileExportCallbackId = 0;
+    }
+
+    if (beforeDuplicateCallbackId != 0) {
+        status = MMessage::removeCallback(beforeDuplicateCallbackId);
+        beforeDuplicateCallbackId = 0;
+    }
+
     return status;
 }
 
@@ -98,6 +171,7 @@ void MayaUsdProxyShapeStageExtraData::addProxyShape(MayaUsdProxyShapeBase& proxy
 void MayaUsdProxyShapeStageExtraData::removeProxyShape(MayaUsdProxyShapeBase& proxyShape)
 {
     getTrackedProxyShapes().erase(&proxyShape);
+    getPendingLoadRules().erase(&proxyShape);
 }
 
 /* static */
@@ -113,7 +187,53 @@ void MayaUsdProxyShapeStageExtraData::saveAllLoadRules()
 /* static */
 void MayaUsdProxyShapeStageExtraData::saveLoadRules(const UsdStageRefPtr& stage)
 {
-    saveTrackedLoadRules(stage);
+    // Note: the rules are only serialized to the proxy shape attribute when the scene
+    //       is saved. Until then they are kept as-is in memory.
+    if (stage)
+        saveTrackedData(stage, recordLoadRules);
+}
+
+/* static */
+bool MayaUsdProxyShapeStageExtraData::hasPendingLoadRules(const MayaUsdProxyShapeBase& proxyShape)
+{
+    const PendingLoadRules& pending = getPendingLoadRules();
+    return pending.find(&proxyShape) != pending.end();
+}
+
+/* static */
+bool MayaUsdProxyShapeStageExtraData::getPendingLoadRulesText(
+    const MayaUsdProxyShapeBase& proxyShape,
+    MString&                     text)
+{
+    const PendingLoadRules& pending = getPendingLoadRules();
+    const auto              iter = pending.find(&proxyShape);
+    if (iter == pending.end())
+        return false;
+
+    text = convertLoadRulesToText(iter->second);
+    return true;
+}
+
+/* static */
+void MayaUsdProxyShapeStageExtraData::discardPendingLoadRules(
+    const MayaUsdProxyShapeBase& proxyShape)
+{
+    getPendingLoadRules().erase(&proxyShape);
+}
+
+/* static */
+bool MayaUsdProxyShapeStageExtraData::restorePendingLoadRules(
+    const MayaUsdProxyShapeBase& proxyShape,
+    PXR_NS::UsdStage&            stage)
+{
+    const PendingLoadRules& pending = getPendingLoadRules();
+    const auto              iter = pending.find(&proxyShape);
+    if (iter == pending.end())
+        return false;
+
+    if (stage.GetLoadRules() != iter->second)
+        stage.SetLoadRules(iter->second);
+    return true;
 }
 
 } // namespace MAYAUSD_NS_DEF
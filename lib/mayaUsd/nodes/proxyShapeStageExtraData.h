@@ -23,6 +23,7 @@
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MObject.h>
+#include <maya/MString.h>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -30,9 +31,11 @@ namespace MAYAUSD_NS_DEF {
 /// \brief Encapsulates plugin registration and deregistration for the proxy shape extra data
 /// handling.
 ///
-/// USD proxy shape extra data are persisted on-disk in the proxy shape. We use a Maya callback
-/// triggered before a scene is saved to copy the current proxy shape extra data from the stage
-/// to the proxy shape.
+/// USD proxy shape extra data are persisted on-disk in the proxy shape. We use Maya callbacks
+/// triggered before a scene is saved or exported and before nodes are duplicated to copy the
+/// current proxy shape extra data from the stage to the proxy shape. In between, load rules changed
+/// by commands are only recorded in memory, so that toggling payloads does not re-serialize the
+/// whole rule list each time. Reading the load rules attribute returns the recorded rules.
 ///
 /// The extra data saved this way currently are: payload load rules.
 
@@ -64,9 +67,30 @@ public:
     MAYAUSD_CORE_PUBLIC
     static void saveAllLoadRules();
 
-    /// \brief save load rules of the tracked proxy shape corresponding to the given stage.
+    /// \brief record the load rules of the tracked proxy shape corresponding to the given stage.
+    /// They are written to the proxy shape when the scene is saved.
     MAYAUSD_CORE_PUBLIC
     static void saveLoadRules(const UsdStageRefPtr& stage);
+
+    /// \brief verify if load rules were recorded for the proxy shape since the last save.
+    MAYAUSD_CORE_PUBLIC
+    static bool hasPendingLoadRules(const MayaUsdProxyShapeBase& proxyShape);
+
+    /// \brief get the text of the load rules recorded for the proxy shape since the last save.
+    /// Returns false if there are no recorded rules.
+    MAYAUSD_CORE_PUBLIC
+    static bool getPendingLoadRulesText(const MayaUsdProxyShapeBase& proxyShape, MString& text);
+
+    /// \brief forget the load rules recorded for the proxy shape, when its attribute is set.
+    MAYAUSD_CORE_PUBLIC
+    static void discardPendingLoadRules(const MayaUsdProxyShapeBase& proxyShape);
+
+    /// \brief set the stage load rules from the rules recorded for the proxy shape.
+    /// Returns false if there are no recorded rules.
+    MAYAUSD_CORE_PUBLIC
+    static bool restorePendingLoadRules(
+        const MayaUsdProxyShapeBase& proxyShape,
+        PXR_NS::UsdStage&            stage);
 };
 
 } // namespace MAYAUSD_NS_DEF
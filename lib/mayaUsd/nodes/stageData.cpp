@@ -25,6 +25,8 @@
 #include <maya/MString.h>
 #include <maya/MTypeId.h>
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(MayaUsdStageDataTokens, PXRMAYAUSD_STAGE_DATA_TOKENS);
@@ -37,6 +39,8 @@ const MString MayaUsdStageData::typeName(MayaUsdStageDataTokens->MayaTypeName.Ge
  * that might have been created are unlinked.
  */
 namespace {
+std::atomic<size_t> _lastVersion { 0 };
+
 void _cleanUp(void* gdPtr)
 {
     MayaUsdStageData* gd = (MayaUsdStageData*)gdPtr;
@@ -58,6 +62,7 @@ void MayaUsdStageData::copy(const MPxData& src)
     if (stageData) {
         stage = stageData->stage;
         primPath = stageData->primPath;
+        version = stageData->version;
     }
 }
 
@@ -67,8 +72,11 @@ MTypeId MayaUsdStageData::typeId() const { return mayaTypeId; }
 /* virtual */
 MString MayaUsdStageData::name() const { return typeName; }
 
+void MayaUsdStageData::updateVersion() { version = ++_lastVersion; }
+
 MayaUsdStageData::MayaUsdStageData()
     : MPxGeometryData()
+    , version(++_lastVersion)
 {
     registerExitCallback();
 }
@@ -29,6 +29,8 @@
 #include <maya/MString.h>
 #include <maya/MTypeId.h>
 
+#include <cstddef>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -79,8 +81,18 @@ public:
 
     SdfPath primPath;
 
+    /// Version of the stage and prim path. Every new data object gets a unique version and
+    /// copies keep it, so consumers can compare it against the version they last resolved
+    /// instead of resolving the stage again. Producers that modify the stage or prim path of
+    /// data already handed out must call updateVersion().
+    size_t version;
+
     //@}
 
+    /// \brief give the data a new unique version.
+    MAYAUSD_CORE_PUBLIC
+    void updateVersion();
+
 protected:
     MAYAUSD_CORE_PUBLIC
     MayaUsdStageData();
@@ -33,6 +33,7 @@ TF_WRAP_MODULE
     TF_WRAP(ConverterArgs);
     TF_WRAP(DiagnosticDelegate);
     TF_WRAP(EditRouter);
+    TF_WRAP(MemoryReport);
     TF_WRAP(MeshWriteUtils);
 #ifdef UFE_V3_FEATURES_AVAILABLE
     TF_WRAP(PrimUpdater);
@@ -43,6 +44,7 @@ TF_WRAP_MODULE
     TF_WRAP(OpUndoItem);
     TF_WRAP(Query);
     TF_WRAP(ReadUtil);
+    TF_WRAP(RenderStats);
     TF_WRAP(RoundTripUtil);
     TF_WRAP(StageCache);
     TF_WRAP(Tokens);
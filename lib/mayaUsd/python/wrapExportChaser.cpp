@@ -176,6 +176,7 @@ void wrapExportChaser()
         .def("ExportDefault", &This::ExportDefault, &ExportChaserWrapper::default_ExportDefault)
         .def("ExportFrame", &This::ExportFrame, &ExportChaserWrapper::default_ExportFrame)
         .def("PostExport", &This::PostExport, &ExportChaserWrapper::default_PostExport)
+        .def("CanRunConcurrently", &This::CanRunConcurrently)
         .def("Register", &ExportChaserWrapper::Register)
         .staticmethod("Register")
         .def("Unregister", &ExportChaserWrapper::Unregister)
@@ -0,0 +1,64 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/utils/memoryReport.h>
+
+#include <pxr/pxr.h>
+
+#include <boost/python.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/dict.hpp>
+#include <boost/python/list.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+object _Compute(const std::string& shapeName, size_t maxPrims)
+{
+    UsdMayaMemoryReport report;
+    if (!UsdMayaMemoryReport::Compute(shapeName, maxPrims, &report)) {
+        return object();
+    }
+
+    dict result;
+    for (const auto& total : report.GetTotals()) {
+        result[total.first] = total.second;
+    }
+
+    list prims;
+    for (const HdVP2PrimMemoryUsage& primUsage : report.renderUsage._prims) {
+        dict prim;
+        prim["path"] = primUsage._usdPath.GetString();
+        prim["cpuCacheBytes"] = primUsage._cpuBytes;
+        prim["vertexBufferBytes"] = primUsage._vertexBufferBytes;
+        prim["indexBufferBytes"] = primUsage._indexBufferBytes;
+        prim["totalBytes"] = primUsage.GetTotalBytes();
+        prims.append(prim);
+    }
+    result["prims"] = prims;
+
+    return result;
+}
+} // namespace
+
+void wrapMemoryReport()
+{
+    class_<UsdMayaMemoryReport>("MemoryReport", no_init)
+        .def("Compute", _Compute, (arg("shapeName"), arg("maxPrims") = 10))
+        .staticmethod("Compute");
+}
@@ -26,6 +26,7 @@
 
 #include <pxr/base/tf/pyContainerConversions.h>
 #include <pxr/base/tf/pyEnum.h>
+#include <pxr/base/tf/pyError.h>
 #include <pxr/base/tf/pyPolymorphic.h>
 #include <pxr/base/tf/pyResultConversions.h>
 
@@ -83,6 +84,14 @@ public:
         this->template CallVirtual<>("PostExport", &This::default_PostExport)();
     }
 
+    bool default_IsAnimated() const { return base_t::IsAnimated(); }
+    bool IsAnimated() const override
+    {
+        return this->template CallVirtual<bool>("IsAnimated", &This::default_IsAnimated)();
+    }
+
+    UsdMayaPrimWriterBatchSharedPtr GetFrameBatch() const override { return _frameBatch; }
+
     bool default_ExportsGprims() const { return base_t::ExportsGprims(); }
     bool ExportsGprims() const override
     {
@@ -179,6 +188,52 @@ public:
         return This::default_GetDagToUsdPathMapping();
     }
 
+    //---------------------------------------------------------------------------------------------
+    /// \brief  writes the time samples of all the prim writers of a Python class with a single
+    ///         call to its WriteBatch class method, instead of taking the GIL for each of them
+    //---------------------------------------------------------------------------------------------
+    class FrameBatch
+        : public UsdMayaPrimWriterBatch
+        , public UsdMayaPythonObjectRegistry
+    {
+    public:
+        FrameBatch(size_t classIndex)
+            : _classIndex(classIndex)
+        {
+        }
+
+        void Write(const std::vector<UsdMayaPrimWriter*>& primWriters, const UsdTimeCode& usdTime)
+            override
+        {
+            TfPyLock              pyLock;
+            boost::python::object pyClass = GetPythonObject(_classIndex);
+            if (!pyClass || !PyObject_HasAttrString(pyClass.ptr(), "WriteBatch")) {
+                // The class was unregistered or updated without batch support.
+                for (UsdMayaPrimWriter* primWriter : primWriters) {
+                    primWriter->Write(usdTime);
+                }
+                return;
+            }
+
+            boost::python::list writers;
+            for (UsdMayaPrimWriter* primWriter : primWriters) {
+                PyObject* instance = static_cast<This*>(primWriter)->_pyInstance;
+                writers.append(boost::python::object(
+                    boost::python::handle<>(boost::python::borrowed(instance))));
+            }
+
+            try {
+                pyClass.attr("WriteBatch")(writers, usdTime);
+            } catch (const boost::python::error_already_set&) {
+                TfPyConvertPythonExceptionToTfErrors();
+                PyErr_Clear();
+            }
+        }
+
+    private:
+        size_t _classIndex;
+    };
+
     //---------------------------------------------------------------------------------------------
     /// \brief  wraps a factory function that allows registering an updated Python class
     //---------------------------------------------------------------------------------------------
@@ -203,6 +258,12 @@ public:
             boost::python::object instance = pyClass((uintptr_t)&sptr);
             boost::python::incref(instance.ptr());
             initialize_wrapper(instance.ptr(), sptr.get());
+
+            // Classes defining WriteBatch write all their prims at once at each time sample.
+            sptr->_pyInstance = instance.ptr();
+            if (PyObject_HasAttrString(pyClass.ptr(), "WriteBatch")) {
+                sptr->_frameBatch = _frameBatch;
+            }
             return sptr;
         }
 
@@ -232,9 +293,13 @@ public:
     private:
         // Function object constructor. Requires only the index of the Python class to use.
         FactoryFnWrapper(size_t classIndex)
-            : _classIndex(classIndex) {};
+            : _classIndex(classIndex)
+            , _frameBatch(std::make_shared<FrameBatch>(classIndex)) {};
 
         size_t _classIndex;
+        // Shared by all the copies of the function object, so all the prim writers of the class
+        // are in the same batch.
+        std::shared_ptr<FrameBatch> _frameBatch;
 
         // Generates a unique key based on the name of the class, along with the class
         // purpose:
@@ -261,6 +326,10 @@ public:
 private:
     SdfPathVector                     _modelPaths;
     UsdMayaUtil::MDagPathMap<SdfPath> _dagPathMap;
+
+    // The Python object of this prim writer, kept alive by the reference added on creation
+    PyObject*                       _pyInstance = nullptr;
+    UsdMayaPrimWriterBatchSharedPtr _frameBatch;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -605,6 +674,10 @@ void wrapPrimWriter()
             &PrimWriterWrapper<>::PostExport,
             &PrimWriterWrapper<>::default_PostExport)
         .def("Write", &PrimWriterWrapper<>::Write, &PrimWriterWrapper<>::default_Write)
+        .def(
+            "IsAnimated",
+            &PrimWriterWrapper<>::IsAnimated,
+            &PrimWriterWrapper<>::default_IsAnimated)
 
         .def("GetExportVisibility", &PrimWriterWrapper<>::GetExportVisibility)
         .def("SetExportVisibility", &PrimWriterWrapper<>::SetExportVisibility)
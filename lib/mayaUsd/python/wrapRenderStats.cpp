@@ -0,0 +1,51 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/vp2RenderDelegate/renderStats.h>
+
+#include <pxr/pxr.h>
+
+#include <boost/python.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/dict.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+dict _GetCounters()
+{
+    dict result;
+    for (const auto& counter : HdVP2RenderStats::GetCounters()) {
+        result[counter.first.GetString()] = counter.second;
+    }
+    return result;
+}
+} // namespace
+
+void wrapRenderStats()
+{
+    class_<HdVP2RenderStats>("RenderStats", no_init)
+        .def("Enable", &HdVP2RenderStats::Enable)
+        .staticmethod("Enable")
+        .def("Disable", &HdVP2RenderStats::Disable)
+        .staticmethod("Disable")
+        .def("IsEnabled", &HdVP2RenderStats::IsEnabled)
+        .staticmethod("IsEnabled")
+        .def("GetCounters", _GetCounters)
+        .staticmethod("GetCounters");
+}
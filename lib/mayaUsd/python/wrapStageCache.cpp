@@ -37,6 +37,13 @@ UsdStageCache& _UsdMayaStageCacheGet(bool loadAll, bool shared)
         shared ? UsdMayaStageCache::ShareMode::Shared : UsdMayaStageCache::ShareMode::Unshared);
 }
 
+void _UsdMayaStageCachePrefetchLayers(const std::vector<std::string>& rootLayerPaths, bool loadAll)
+{
+    UsdMayaStageCache::PrefetchLayers(
+        rootLayerPaths,
+        loadAll ? UsdStage::InitialLoadSet::LoadAll : UsdStage::InitialLoadSet::LoadNone);
+}
+
 } // namespace
 
 void wrapStageCache()
@@ -50,5 +57,14 @@ void wrapStageCache()
             return_value_policy<reference_existing_object>())
         .staticmethod("Get")
         .def("Clear", &UsdMayaStageCache::Clear)
-        .staticmethod("Clear");
+        .staticmethod("Clear")
+        .def(
+            "PrefetchLayers",
+            _UsdMayaStageCachePrefetchLayers,
+            (python::arg("rootLayerPaths"), python::arg("loadAll") = true))
+        .staticmethod("PrefetchLayers")
+        .def("WaitForPrefetchedLayers", &UsdMayaStageCache::WaitForPrefetchedLayers)
+        .staticmethod("WaitForPrefetchedLayers")
+        .def("ReleasePrefetchedLayers", &UsdMayaStageCache::ReleasePrefetchedLayers)
+        .staticmethod("ReleasePrefetchedLayers");
 }
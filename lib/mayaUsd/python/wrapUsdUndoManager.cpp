@@ -67,6 +67,12 @@ void _trackLayerStates(const SdfLayerHandle& layer)
     MayaUsd::UsdUndoManager::instance().trackLayerStates(layer);
 }
 
+void _beginInteraction() { MayaUsd::UsdUndoManager::instance().beginInteraction(); }
+
+void _endInteraction() { MayaUsd::UsdUndoManager::instance().endInteraction(); }
+
+size_t _memoryUsage() { return MayaUsd::UsdUndoManager::instance().memoryUsage(); }
+
 } // namespace
 
 void wrapUsdUndoManager()
@@ -76,7 +82,13 @@ void wrapUsdUndoManager()
         typedef MayaUsd::UsdUndoManager This;
         class_<This, boost::noncopyable>("UsdUndoManager", no_init)
             .def("trackLayerStates", &_trackLayerStates)
-            .staticmethod("trackLayerStates");
+            .staticmethod("trackLayerStates")
+            .def("beginInteraction", &_beginInteraction)
+            .staticmethod("beginInteraction")
+            .def("endInteraction", &_endInteraction)
+            .staticmethod("endInteraction")
+            .def("memoryUsage", &_memoryUsage)
+            .staticmethod("memoryUsage");
     }
 
     // UsdUndoBlock
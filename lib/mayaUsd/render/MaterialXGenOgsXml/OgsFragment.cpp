@@ -42,6 +42,7 @@ const MString OPTVAR_ALBEDO_METHOD = "MxMayaEnvironmentAlbedoMethod";
 // Find the expected environment mode depending on Maya capabilities and optionVars:
 mx::HwSpecularEnvironmentMethod _getEnvironmentOptions(int& numSamples, bool& isMonteCarlo)
 {
+    // Maya option vars can only be queried from the main thread.
     bool varExists = false;
     switch (mx::OgsXmlGenerator::useLightAPI()) {
     case 1:
@@ -83,8 +84,9 @@ class GlslGeneratorWrapperBase
     GlslGeneratorWrapperBase() = delete;
 
 protected:
-    explicit GlslGeneratorWrapperBase(mx::ElementPtr element)
+    GlslGeneratorWrapperBase(mx::ElementPtr element, const OgsFragment::SpecularEnv& specularEnv)
         : _element(element)
+        , _specularEnv(specularEnv)
     {
         if (!_element)
             throw mx::Exception("No element specified");
@@ -109,21 +111,22 @@ protected:
         }
     }
 
+public:
+    const OgsFragment::SpecularEnv& specularEnv() const { return _specularEnv; }
+
 protected:
     void setCommonOptions(
         mx::GenOptions&            genOptions,
         mx::GenContext&            context,
         const mx::ShaderGenerator& generator)
     {
-        int  numSamples = 64;
-        bool isMonteCarlo = false;
-        genOptions.hwSpecularEnvironmentMethod = _getEnvironmentOptions(numSamples, isMonteCarlo);
+        genOptions.hwSpecularEnvironmentMethod = _specularEnv.method;
         // FIS option has further sub-options to check:
         if (genOptions.hwSpecularEnvironmentMethod == mx::SPECULAR_ENVIRONMENT_FIS) {
             context.pushUserData(
                 mx::HwSpecularEnvironmentSamples::name(),
-                mx::HwSpecularEnvironmentSamples::create(numSamples));
-            if (isMonteCarlo) {
+                mx::HwSpecularEnvironmentSamples::create(_specularEnv.numSamples));
+            if (_specularEnv.isMonteCarlo) {
                 genOptions.hwDirectionalAlbedoMethod = mx::DIRECTIONAL_ALBEDO_MONTE_CARLO;
             }
         }
@@ -156,7 +159,8 @@ protected:
     mx::ElementPtr _element;
 
 private:
-    bool _isSurface = false;
+    OgsFragment::SpecularEnv _specularEnv;
+    bool                     _isSurface = false;
 };
 
 // Knows how to create a temporary local GLSL fragment generator to generate
@@ -165,8 +169,11 @@ private:
 class LocalGlslGeneratorWrapper : public GlslGeneratorWrapperBase
 {
 public:
-    LocalGlslGeneratorWrapper(mx::ElementPtr element, const mx::FileSearchPath& librarySearchPath)
-        : GlslGeneratorWrapperBase(element)
+    LocalGlslGeneratorWrapper(
+        mx::ElementPtr                  element,
+        const mx::FileSearchPath&       librarySearchPath,
+        const OgsFragment::SpecularEnv& specularEnv)
+        : GlslGeneratorWrapperBase(element, specularEnv)
         , _librarySearchPath(librarySearchPath)
     {
     }
@@ -250,7 +257,7 @@ class ExternalGlslGeneratorWrapper : public GlslGeneratorWrapperBase
 {
 public:
     ExternalGlslGeneratorWrapper(mx::ElementPtr element, mx::GenContext& genContext)
-        : GlslGeneratorWrapperBase(element)
+        : GlslGeneratorWrapperBase(element, OgsFragment::getSpecularEnv())
         , _genContext(genContext)
     {
     }
@@ -274,9 +281,10 @@ private:
 /// Generate the complete XML fragment source embedding both GLSL and HLSL code.
 /// @return The unique name of the fragment
 std::string generateFragment(
-    std::string&       fragmentSource,
-    const mx::Shader&  glslShader,
-    const std::string& baseFragmentName)
+    std::string&                    fragmentSource,
+    const mx::Shader&               glslShader,
+    const std::string&              baseFragmentName,
+    const OgsFragment::SpecularEnv& specularEnv)
 {
     static const std::string FRAGMENT_NAME_TOKEN = "$fragmentName";
 
@@ -316,7 +324,7 @@ std::string generateFragment(
     std::ostringstream nameStream;
     const size_t       sourceHash = std::hash<std::string> {}(fragmentSource);
     nameStream << baseFragmentName << "__" << std::hex << sourceHash
-               << OgsFragment::getSpecularEnvKey();
+               << OgsFragment::getSpecularEnvKey(specularEnv);
     std::string fragmentName = nameStream.str();
 
     // Substitute the placeholder name token with the actual name.
@@ -368,7 +376,15 @@ std::string generateLightRig(
 } // anonymous namespace
 
 OgsFragment::OgsFragment(mx::ElementPtr element, const mx::FileSearchPath& librarySearchPath)
-    : OgsFragment(element, LocalGlslGeneratorWrapper(element, librarySearchPath))
+    : OgsFragment(element, librarySearchPath, getSpecularEnv())
+{
+}
+
+OgsFragment::OgsFragment(
+    mx::ElementPtr            element,
+    const mx::FileSearchPath& librarySearchPath,
+    const SpecularEnv&        specularEnv)
+    : OgsFragment(element, LocalGlslGeneratorWrapper(element, librarySearchPath, specularEnv))
 {
 }
 
@@ -397,7 +413,8 @@ OgsFragment::OgsFragment(mx::ElementPtr element, GLSL_GENERATOR_WRAPPER&& glslGe
 
     // Generate the complete XML fragment source embedding both GLSL and HLSL
     // code.
-    _fragmentName = generateFragment(_fragmentSource, *_glslShader, baseFragmentName);
+    _fragmentName = generateFragment(
+        _fragmentSource, *_glslShader, baseFragmentName, glslGeneratorWrapper.specularEnv());
 
     const mx::ShaderGraph& graph = _glslShader->getGraph();
     bool                   lighting
@@ -479,14 +496,15 @@ std::string OgsFragment::getMatrix4Name(const std::string& matrix3Name)
     return matrix3Name + mx::GlslFragmentGenerator::MATRIX3_TO_MATRIX4_POSTFIX;
 }
 
-std::string OgsFragment::getSpecularEnvKey()
+std::string OgsFragment::getSpecularEnvKey() { return getSpecularEnvKey(getSpecularEnv()); }
+
+std::string OgsFragment::getSpecularEnvKey(const SpecularEnv& specularEnv)
 {
     std::string retVal;
-    int         numSamples = 64;
-    bool        isMonteCarlo = false;
-    switch (_getEnvironmentOptions(numSamples, isMonteCarlo)) {
+    switch (specularEnv.method) {
     case mx::SPECULAR_ENVIRONMENT_FIS:
-        retVal += "F" + std::to_string(numSamples) + (isMonteCarlo ? "MC" : "P");
+        retVal += "F" + std::to_string(specularEnv.numSamples)
+            + (specularEnv.isMonteCarlo ? "MC" : "P");
         break;
     case mx::SPECULAR_ENVIRONMENT_PREFILTER: retVal = "P"; break;
     default: retVal = "N"; break;
@@ -495,4 +513,11 @@ std::string OgsFragment::getSpecularEnvKey()
     return retVal;
 }
 
+OgsFragment::SpecularEnv OgsFragment::getSpecularEnv()
+{
+    SpecularEnv specularEnv;
+    specularEnv.method = _getEnvironmentOptions(specularEnv.numSamples, specularEnv.isMonteCarlo);
+    return specularEnv;
+}
+
 } // namespace MaterialXMaya
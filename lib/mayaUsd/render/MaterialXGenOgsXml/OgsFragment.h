@@ -5,6 +5,7 @@
 /// OGS fragment wrapper.
 
 #include <MaterialXCore/Document.h>
+#include <MaterialXGenShader/GenOptions.h>
 #include <MaterialXGenShader/Shader.h>
 #include <MaterialXRender/ImageHandler.h>
 
@@ -19,9 +20,21 @@ namespace MaterialXMaya {
 class OgsFragment
 {
 public:
+    /// Specular environment settings of the Maya viewport.
+    struct SpecularEnv
+    {
+        mx::HwSpecularEnvironmentMethod method = mx::SPECULAR_ENVIRONMENT_NONE;
+        int                             numSamples = 64;
+        bool                            isMonteCarlo = false;
+    };
+
     /// Creates a local GLSL fragment generator
     OgsFragment(mx::ElementPtr, const mx::FileSearchPath& librarySearchPath);
 
+    /// Creates a local GLSL fragment generator for the given environment settings. Unlike the
+    /// other constructors, it doesn't query Maya and can be called from a worker thread.
+    OgsFragment(mx::ElementPtr, const mx::FileSearchPath& librarySearchPath, const SpecularEnv&);
+
     /// Reuses an externally-provided GLSL fragment generator. Used in the test
     /// harness.
     OgsFragment(mx::ElementPtr, mx::GenContext&);
@@ -87,6 +100,11 @@ public:
 
     /// Get a string that is unique for each environment settings possible:
     static std::string getSpecularEnvKey();
+    static std::string getSpecularEnvKey(const SpecularEnv&);
+
+    /// Read the environment settings from the Maya option vars. Must be called from the main
+    /// thread.
+    static SpecularEnv getSpecularEnv();
 
 private:
     /// The constructor implementation that public constructors delegate to.
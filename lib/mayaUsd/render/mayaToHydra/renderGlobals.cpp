@@ -52,6 +52,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (mtohSelectionOutline)
     (mtohMotionSampleStart)
     (mtohMotionSampleEnd)
+    (mtohFrameTimeBudget)
 );
 // clang-format on
 
@@ -81,6 +82,7 @@ global proc mtohRenderOverride_AddMTOHAttributes(int $fromAE) {
     mtohRenderOverride_AddAttribute("mtoh", "Show Wireframe on Selected Objects", "mtohWireframeSelectionHighlight", $fromAE);
     mtohRenderOverride_AddAttribute("mtoh", "Highlight Selected Objects", "mtohColorSelectionHighlight", $fromAE);
     mtohRenderOverride_AddAttribute("mtoh", "Highlight Color for Selected Objects", "mtohColorSelectionHighlightColor", $fromAE);
+    mtohRenderOverride_AddAttribute("mtoh", "Frame Time Budget (ms, 0 to disable)", "mtohFrameTimeBudget", $fromAE);
 )mel"
 #if PXR_VERSION >= 2005
                                           R"mel(
@@ -890,6 +892,20 @@ MObject MtohRenderGlobals::CreateAttributes(const GlobalParams& params)
             return mayaObject;
         }
     }
+    if (filter(_tokens->mtohFrameTimeBudget)) {
+        _CreateIntAttribute(
+            node,
+            filter.mayaString(),
+            defGlobals.frameTimeBudget,
+            userDefaults,
+            [](MFnNumericAttribute& nAttr) {
+                nAttr.setMin(0);
+                nAttr.setSoftMax(1000);
+            });
+        if (filter.attributeFilter()) {
+            return mayaObject;
+        }
+    }
 #if PXR_VERSION >= 2005
     if (filter(_tokens->mtohSelectionOutline)) {
         _CreateFloatAttribute(
@@ -1083,6 +1099,12 @@ MtohRenderGlobals::GetInstance(const GlobalParams& params, bool storeUserSetting
             return globals;
         }
     }
+    if (filter(_tokens->mtohFrameTimeBudget)) {
+        _GetAttribute(node, filter.mayaString(), globals.frameTimeBudget, storeUserSetting);
+        if (filter.attributeFilter()) {
+            return globals;
+        }
+    }
 #if PXR_VERSION >= 2005
     if (filter(_tokens->mtohSelectionOutline)) {
         _GetAttribute(node, filter.mayaString(), globals.outlineSelectionWidth, storeUserSetting);
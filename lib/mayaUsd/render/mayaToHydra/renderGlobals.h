@@ -97,6 +97,8 @@ public:
     GfVec4f      colorSelectionHighlightColor = GfVec4f(1.0f, 1.0f, 0.0f, 0.5f);
     bool         colorSelectionHighlight = true;
     bool         wireframeSelectionHighlight = true;
+    // Milliseconds a frame can wait for the renderer to converge, 0 to disable
+    int frameTimeBudget = 0;
 #if PXR_VERSION >= 2005
     float outlineSelectionWidth = 4.f;
 #endif
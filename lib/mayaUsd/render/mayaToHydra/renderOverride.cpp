@@ -52,10 +52,12 @@
 #include <maya/MTimerMessage.h>
 #include <maya/MUiMessage.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <exception>
 #include <limits>
+#include <thread>
 
 #if WANT_UFE_BUILD
 #include <mayaUsd/ufe/Global.h>
@@ -499,6 +501,33 @@ MStatus MtohRenderOverride::Render(const MHWRender::MDrawContext& drawContext)
             } else {
                 TF_WARN("HdxProgressiveTask not found");
             }
+        } else if (_globals.frameTimeBudget > 0 && !tasks.empty()) {
+            // Let the renderer converge further within the budget. The timer callback keeps
+            // refreshing the viewport while it is not converged, resuming on the next frame.
+#if PXR_VERSION >= 2005
+            std::shared_ptr<HdxRenderTask> renderTask
+                = std::dynamic_pointer_cast<HdxRenderTask>(tasks.front());
+#else
+            boost::shared_ptr<HdxRenderTask> renderTask
+                = boost::dynamic_pointer_cast<HdxRenderTask>(tasks.front());
+#endif
+            if (renderTask) {
+                constexpr auto maxWait = std::chrono::milliseconds(10);
+                const auto     deadline = std::chrono::steady_clock::now()
+                    + std::chrono::milliseconds(_globals.frameTimeBudget);
+                HdTaskSharedPtrVector renderOnly = { renderTask };
+                _engine.Execute(_renderIndex, &renderOnly);
+
+                while (!renderTask->IsConverged()) {
+                    const auto now = std::chrono::steady_clock::now();
+                    if (now >= deadline) {
+                        break;
+                    }
+                    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                        maxWait, deadline - now));
+                    _engine.Execute(_renderIndex, &renderOnly);
+                }
+            }
         }
 
         // MAYA-114630
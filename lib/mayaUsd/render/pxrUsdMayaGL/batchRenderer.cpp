@@ -28,6 +28,7 @@
 #include <mayaUsd/render/px_vp20/utils_legacy.h>
 #include <mayaUsd/render/pxrUsdMayaGL/debugCodes.h>
 #include <mayaUsd/render/pxrUsdMayaGL/userData.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/vec2i.h>
@@ -36,6 +37,7 @@
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/debug.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/instantiateSingleton.h>
 #include <pxr/base/tf/singleton.h>
 #include <pxr/base/tf/staticTokens.h>
@@ -79,11 +81,18 @@
 #include <maya/MUserData.h>
 #include <maya/MViewport2Renderer.h>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    PXRMAYAHD_SINGLE_PASS_DEPTH_SELECTION,
+    false,
+    "Computes area selections in depth with a single deep pick pass over all "
+    "of the shape adapters instead of one pick pass per shape adapter.");
+
 // clang-format off
 TF_DEFINE_PRIVATE_TOKENS(
     _tokens,
@@ -91,6 +100,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((BatchRendererRootName, "MayaHdBatchRenderer"))
     ((LegacyViewport, "LegacyViewport"))
     ((Viewport2, "Viewport2"))
+    ((DepthSelection, "DepthSelection"))
     ((MayaEndRenderNotificationName, "UsdMayaEndRenderNotification"))
 );
 // clang-format on
@@ -138,7 +148,7 @@ bool UsdMayaGLBatchRenderer::AddShapeAdapter(PxrMayaHdShapeAdapter* shapeAdapter
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorE_L3, "Batch Renderer Adding Shape Adapter");
 
     if (!TF_VERIFY(shapeAdapter, "Cannot add invalid shape adapter")) {
@@ -245,7 +255,7 @@ bool UsdMayaGLBatchRenderer::RemoveShapeAdapter(PxrMayaHdShapeAdapter* shapeAdap
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorE_L3, "Batch Renderer Removing Shape Adapter");
 
     if (!TF_VERIFY(shapeAdapter, "Cannot remove invalid shape adapter")) {
@@ -377,7 +387,9 @@ void UsdMayaGLBatchRenderer::_OnMayaEndRenderCallback(
 void UsdMayaGLBatchRenderer::_OnSoftSelectOptionsChangedCallback(void* clientData)
 {
     auto batchRenderer = static_cast<UsdMayaGLBatchRenderer*>(clientData);
-    int  commandResult;
+    batchRenderer->_softSelectHelper.Reset();
+
+    int commandResult;
     // -sse == -softSelectEnabled
     MGlobal::executeCommand("softSelect -q -sse", commandResult);
     if (!commandResult) {
@@ -390,6 +402,15 @@ void UsdMayaGLBatchRenderer::_OnSoftSelectOptionsChangedCallback(void* clientDat
     batchRenderer->_objectSoftSelectEnabled = (commandResult == 3);
 }
 
+/* static */
+void UsdMayaGLBatchRenderer::_OnSoftSelectionChangedCallback(void* clientData)
+{
+    // The soft selection state is re-populated by the next call to
+    // GetSoftSelectHelper().
+    auto batchRenderer = static_cast<UsdMayaGLBatchRenderer*>(clientData);
+    batchRenderer->_softSelectHelper.Reset();
+}
+
 UsdMayaGLBatchRenderer::UsdMayaGLBatchRenderer()
     : _isSelectionPending(false)
     , _objectSoftSelectEnabled(false)
@@ -403,6 +424,7 @@ UsdMayaGLBatchRenderer::UsdMayaGLBatchRenderer()
     , _hgiDriver { HgiTokens->renderDriver, VtValue(_hgi.get()) }
     , _selectionResolution(256)
     , _enableDepthSelection(false)
+    , _enableSinglePassDepthSelection(TfGetEnvSetting(PXRMAYAHD_SINGLE_PASS_DEPTH_SELECTION))
 {
     _rootId = SdfPath::AbsoluteRootPath().AppendChild(_tokens->BatchRendererRootName);
     _legacyViewportPrefix = _rootId.AppendChild(_tokens->LegacyViewport);
@@ -427,6 +449,11 @@ UsdMayaGLBatchRenderer::UsdMayaGLBatchRenderer()
     _viewport2RprimCollection.SetRootPath(_viewport2Prefix);
     _renderIndex->GetChangeTracker().AddCollection(_viewport2RprimCollection.GetName());
 
+    _depthSelectionRprimCollection.SetName(TfToken(TfStringPrintf(
+        "%s_%s", _tokens->BatchRendererRootName.GetText(), _tokens->DepthSelection.GetText())));
+    _depthSelectionRprimCollection.SetReprSelector(HdReprSelector(HdReprTokens->refined));
+    _renderIndex->GetChangeTracker().AddCollection(_depthSelectionRprimCollection.GetName());
+
     _selectionTracker.reset(new HdxSelectionTracker());
 
     TfWeakPtr<UsdMayaGLBatchRenderer> me(this);
@@ -454,6 +481,13 @@ UsdMayaGLBatchRenderer::UsdMayaGLBatchRenderer()
     _OnSoftSelectOptionsChangedCallback(this);
     _softSelectOptionsCallbackId = MEventMessage::addEventCallback(
         "softSelectOptionsChanged", _OnSoftSelectOptionsChangedCallback, this);
+
+    // The soft selection changes with the selection, and with the position of
+    // the objects relative to it when they are moved or when a move is undone.
+    for (const char* eventName : { "SelectionChanged", "DragRelease", "Undo", "Redo" }) {
+        _softSelectionChangedCallbackIds.append(MEventMessage::addEventCallback(
+            eventName, _OnSoftSelectionChangedCallback, this));
+    }
 }
 
 /* virtual */
@@ -467,6 +501,7 @@ UsdMayaGLBatchRenderer::~UsdMayaGLBatchRenderer()
     // using CurrentlyExists()/GetInstance() because we call it within the
     // constructor
     MMessage::removeCallback(_softSelectOptionsCallbackId);
+    MMessage::removeCallbacks(_softSelectionChangedCallbackIds);
 }
 
 const UsdMayaGLSoftSelectHelper& UsdMayaGLBatchRenderer::GetSoftSelectHelper()
@@ -543,7 +578,7 @@ void UsdMayaGLBatchRenderer::Draw(const MDrawRequest& request, M3dView& view)
 
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorC_L2, "Batch Renderer Draw() (Legacy Viewport)");
 
     MDrawData drawData = request.drawData();
@@ -577,7 +612,7 @@ void UsdMayaGLBatchRenderer::Draw(const MHWRender::MDrawContext& context, const
 
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorC_L2, "Batch Renderer Draw() (Viewport 2.0)");
 
     const PxrMayaHdUserData* hdUserData = dynamic_cast<const PxrMayaHdUserData*>(userData);
@@ -634,7 +669,7 @@ void UsdMayaGLBatchRenderer::DrawBoundingBox(const MDrawRequest& request, M3dVie
 
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory,
         MProfiler::kColorC_L2,
         "Batch Renderer DrawBoundingBox() (Legacy Viewport)");
@@ -675,7 +710,7 @@ void UsdMayaGLBatchRenderer::DrawBoundingBox(
 
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorC_L2, "Batch Renderer DrawBoundingBox() (Viewport 2.0)");
 
     const PxrMayaHdUserData* hdUserData = dynamic_cast<const PxrMayaHdUserData*>(userData);
@@ -723,7 +758,7 @@ const HdxPickHitVector* UsdMayaGLBatchRenderer::TestIntersection(
 
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory,
         MProfiler::kColorE_L3,
         "Batch Renderer Testing Intersection (Legacy Viewport)");
@@ -801,7 +836,7 @@ const HdxPickHitVector* UsdMayaGLBatchRenderer::TestIntersection(
 
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory,
         MProfiler::kColorE_L3,
         "Batch Renderer Testing Intersection (Viewport 2.0)");
@@ -905,7 +940,7 @@ bool UsdMayaGLBatchRenderer::TestIntersectionCustomPrimFilter(
         primFilter.renderTags,
         viewMatrix,
         projectionMatrix,
-        true,
+        HdxPickTokens->resolveNearestToCenter,
         outResult);
 }
 
@@ -986,17 +1021,54 @@ PxrMayaHdPrimFilterVector UsdMayaGLBatchRenderer::_GetIntersectionPrimFilters(
     return primFilters;
 }
 
+PxrMayaHdPrimFilter
+UsdMayaGLBatchRenderer::_MergeIntersectionPrimFilters(const PxrMayaHdPrimFilterVector& primFilters)
+{
+    SdfPathVector rootPaths;
+    SdfPathVector excludePaths;
+    TfTokenVector renderTags;
+
+    for (const PxrMayaHdPrimFilter& primFilter : primFilters) {
+        const SdfPathVector& roots = primFilter.collection.GetRootPaths();
+        rootPaths.insert(rootPaths.end(), roots.begin(), roots.end());
+
+        const SdfPathVector& excludes = primFilter.collection.GetExcludePaths();
+        excludePaths.insert(excludePaths.end(), excludes.begin(), excludes.end());
+
+        for (const TfToken& renderTag : primFilter.renderTags) {
+            if (std::find(renderTags.begin(), renderTags.end(), renderTag) == renderTags.end()) {
+                renderTags.push_back(renderTag);
+            }
+        }
+    }
+
+    // Only update the collection and mark it dirty if the paths have actually
+    // changed. The collection keeps its paths sorted, so we sort them too
+    // before comparing.
+    std::sort(rootPaths.begin(), rootPaths.end());
+    std::sort(excludePaths.begin(), excludePaths.end());
+    if (_depthSelectionRprimCollection.GetRootPaths() != rootPaths
+        || _depthSelectionRprimCollection.GetExcludePaths() != excludePaths) {
+        _depthSelectionRprimCollection.SetRootPaths(rootPaths);
+        _depthSelectionRprimCollection.SetExcludePaths(excludePaths);
+        _renderIndex->GetChangeTracker().MarkCollectionDirty(
+            _depthSelectionRprimCollection.GetName());
+    }
+
+    return PxrMayaHdPrimFilter { nullptr, _depthSelectionRprimCollection, renderTags };
+}
+
 bool UsdMayaGLBatchRenderer::_TestIntersection(
     const HdRprimCollection& rprimCollection,
     const TfTokenVector&     renderTags,
     const GfMatrix4d&        viewMatrix,
     const GfMatrix4d&        projectionMatrix,
-    const bool               singleSelection,
+    const TfToken&           resolveMode,
     HdxPickHitVector*        result)
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorE_L3, "Batch Renderer Testing Intersection");
 
     if (!result) {
@@ -1029,8 +1101,7 @@ bool UsdMayaGLBatchRenderer::_TestIntersection(
 
     HdxPickTaskContextParams pickParams;
     pickParams.resolution = _selectionResolution;
-    pickParams.resolveMode
-        = singleSelection ? HdxPickTokens->resolveNearestToCenter : HdxPickTokens->resolveUnique;
+    pickParams.resolveMode = resolveMode;
     pickParams.viewMatrix = viewMatrix;
     pickParams.projectionMatrix = projectionMatrix;
     pickParams.collection = rprimCollection;
@@ -1057,7 +1128,7 @@ void UsdMayaGLBatchRenderer::_ComputeSelection(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorE_L3, "Batch Renderer Computing Selection");
 
     // If depth selection has not been turned on, then we can optimize
@@ -1066,9 +1137,22 @@ void UsdMayaGLBatchRenderer::_ComputeSelection(
     // renderer-based collection.
     const bool useDepthSelection = (!singleSelection && _enableDepthSelection);
 
-    const PxrMayaHdPrimFilterVector primFilters
+    PxrMayaHdPrimFilterVector primFilters
         = _GetIntersectionPrimFilters(bucketsMap, view3d, useDepthSelection);
 
+    TfToken resolveMode
+        = singleSelection ? HdxPickTokens->resolveNearestToCenter : HdxPickTokens->resolveUnique;
+
+#if PXR_VERSION >= 2108
+    // A deep pick pass also records the hits that are occluded in depth, so
+    // all of the shape adapters can be tested with a single render of the ID
+    // buffer rather than one render per shape adapter.
+    if (useDepthSelection && _enableSinglePassDepthSelection && primFilters.size() > 1u) {
+        primFilters = { _MergeIntersectionPrimFilters(primFilters) };
+        resolveMode = HdxPickTokens->resolveDeep;
+    }
+#endif
+
     TF_DEBUG(PXRUSDMAYAGL_BATCHED_SELECTION)
         .Msg(
             "    ____________ SELECTION STAGE START ______________ "
@@ -1092,7 +1176,7 @@ void UsdMayaGLBatchRenderer::_ComputeSelection(
                 primFilter.renderTags,
                 viewMatrix,
                 projectionMatrix,
-                singleSelection,
+                resolveMode,
                 &hits)) {
             continue;
         }
@@ -1153,7 +1237,7 @@ void UsdMayaGLBatchRenderer::_Render(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorC_L2, "Batch Renderer Rendering Batch");
 
     _taskDelegate->SetCameraState(worldToViewMatrix, projectionMatrix, viewport);
@@ -1212,7 +1296,7 @@ void UsdMayaGLBatchRenderer::_Render(
     {
         TRACE_SCOPE("Executing Hydra Tasks");
 
-        MProfilingScope hydraProfilingScope(
+        MayaUsd::ProfilingScope hydraProfilingScope(
             ProfilerCategory, MProfiler::kColorC_L3, "Batch Renderer Executing Hydra Tasks");
 
         _hdEngine.Execute(_renderIndex.get(), &tasks);
@@ -1233,7 +1317,7 @@ void UsdMayaGLBatchRenderer::_RenderBatches(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         ProfilerCategory, MProfiler::kColorC_L2, "Batch Renderer Rendering Batches");
 
     _ShapeAdapterBucketsMap& bucketsMap
@@ -1271,11 +1355,6 @@ void UsdMayaGLBatchRenderer::_RenderBatches(
     // longer valid.
     _selectResults.clear();
 
-    // We've already populated with all the selection info we need.  We Reset
-    // and the first call to GetSoftSelectHelper in the next render pass will
-    // re-populate it.
-    _softSelectHelper.Reset();
-
     // Assume shaded displayStyle, but we *should* be able to pull it from
     // either the vp2Context for Viewport 2.0 or the M3dView for the legacy
     // viewport.
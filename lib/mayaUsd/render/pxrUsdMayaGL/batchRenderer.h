@@ -61,6 +61,7 @@
 #include <pxr/usd/sdf/types.h>
 
 #include <maya/M3dView.h>
+#include <maya/MCallbackIdArray.h>
 #include <maya/MDrawContext.h>
 #include <maya/MDrawRequest.h>
 #include <maya/MMessage.h>
@@ -320,7 +321,7 @@ private:
         const GfVec4d&                 viewport);
 
     /// Private helper function for testing intersection on a single collection
-    /// only.
+    /// only, resolving the hits with the given HdxPickTokens \p resolveMode.
     /// \returns True if there was at least one hit. All hits are returned in
     /// the \p *result.
     bool _TestIntersection(
@@ -328,7 +329,7 @@ private:
         const TfTokenVector&     renderTags,
         const GfMatrix4d&        viewMatrix,
         const GfMatrix4d&        projectionMatrix,
-        const bool               singleSelection,
+        const TfToken&           resolveMode,
         HdxPickHitVector*        result);
 
     // Handler for Maya scene resets (e.g. new scene or switch scenes).
@@ -350,6 +351,10 @@ private:
     /// options through mel every time we have a selection event.
     static void _OnSoftSelectOptionsChangedCallback(void* clientData);
 
+    /// Invalidate the soft selection state when the selection or the objects
+    /// in the falloff of the soft selection may have changed.
+    static void _OnSoftSelectionChangedCallback(void* clientData);
+
     /// Perform post-render state cleanup.
     ///
     /// For Viewport 2.0, this method gets invoked by
@@ -369,8 +374,9 @@ private:
     /// selection as pending.
     bool _isSelectionPending;
 
-    bool        _objectSoftSelectEnabled;
-    MCallbackId _softSelectOptionsCallbackId;
+    bool             _objectSoftSelectEnabled;
+    MCallbackId      _softSelectOptionsCallbackId;
+    MCallbackIdArray _softSelectionChangedCallbackIds;
 
     /// Type definition for a set of pointers to shape adapters.
     typedef std::unordered_set<PxrMayaHdShapeAdapter*> _ShapeAdapterSet;
@@ -419,6 +425,14 @@ private:
         const M3dView*           view,
         const bool               useDepthSelection) const;
 
+    /// Merges the given shape adapter prim filters into a single prim filter
+    /// whose collection includes all of their rprims.
+    ///
+    /// When the PXRMAYAHD_SINGLE_PASS_DEPTH_SELECTION env setting is enabled,
+    /// area selections in depth test this prim filter with a single deep pick
+    /// pass instead of testing each shape adapter's prim filter individually.
+    PxrMayaHdPrimFilter _MergeIntersectionPrimFilters(const PxrMayaHdPrimFilterVector& primFilters);
+
     /// Populates the selection results using the given parameters by
     /// performing intersection tests against all of the shapes in the given
     /// \p bucketsMap.
@@ -471,10 +485,15 @@ private:
     HdRprimCollection _legacyViewportRprimCollection;
     HdRprimCollection _viewport2RprimCollection;
 
+    /// Collection of the shape adapters tested with a single deep pick pass
+    /// during area selections in depth.
+    HdRprimCollection _depthSelectionRprimCollection;
+
     PxrMayaHdSceneDelegateSharedPtr _taskDelegate;
 
     GfVec2i _selectionResolution;
     bool    _enableDepthSelection;
+    bool    _enableSinglePassDepthSelection;
 
     HdxSelectionTrackerSharedPtr _selectionTracker;
 
@@ -20,6 +20,7 @@
 #include <mayaUsd/render/pxrUsdMayaGL/debugCodes.h>
 #include <mayaUsd/render/pxrUsdMayaGL/instancerImager.h>
 #include <mayaUsd/render/pxrUsdMayaGL/userData.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/vec2i.h>
 #include <pxr/base/tf/debug.h>
@@ -86,7 +87,7 @@ MBoundingBox PxrMayaHdImagingShapeDrawOverride::boundingBox(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L1,
         "Hydra Imaging Shape Computing Bounding Box (Viewport 2.0)");
@@ -124,7 +125,7 @@ MUserData* PxrMayaHdImagingShapeDrawOverride::prepareForDraw(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L2,
         "Hydra Imaging Shape prepareForDraw() (Viewport 2.0)");
@@ -186,7 +187,7 @@ void PxrMayaHdImagingShapeDrawOverride::draw(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorC_L1,
         "Hydra Imaging Shape draw() (Viewport 2.0)");
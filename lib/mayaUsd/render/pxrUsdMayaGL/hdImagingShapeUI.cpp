@@ -20,6 +20,7 @@
 #include <mayaUsd/render/pxrUsdMayaGL/debugCodes.h>
 #include <mayaUsd/render/pxrUsdMayaGL/instancerImager.h>
 #include <mayaUsd/render/pxrUsdMayaGL/userData.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/vec2i.h>
 #include <pxr/base/tf/debug.h>
@@ -56,7 +57,7 @@ void PxrMayaHdImagingShapeUI::getDrawRequests(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L2,
         "Hydra Imaging Shape getDrawRequests() (Legacy Viewport)");
@@ -123,7 +124,7 @@ void PxrMayaHdImagingShapeUI::draw(const MDrawRequest& request, M3dView& view) c
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorC_L1,
         "Hydra Imaging Shape draw() (Legacy Viewport)");
@@ -34,7 +34,11 @@
 #include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/tokens.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -54,7 +58,11 @@
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 
+#include <algorithm>
+#include <iterator>
 #include <string>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -112,21 +120,61 @@ static void _ClearInstancer(const UsdGeomPointInstancer& usdInstancer)
     usdInstancer.CreateScalesAttr().Set(VtVec3fArray());
 }
 
+// Creates a bare-bones instancer stage with the required properties for the
+// instancer.
+static UsdStageRefPtr _CreateInstancerStage(const UsdStage::InitialLoadSet load)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory(load);
+
+    const SdfPath instancerPath = SdfPath::AbsoluteRootPath().AppendChild(_tokens->Instancer);
+    const SdfPath prototypesPath = instancerPath.AppendChild(_tokens->Prototypes);
+    const SdfPath emptyPrimPath = instancerPath.AppendChild(_tokens->EmptyPrim);
+    const UsdGeomPointInstancer instancer = UsdGeomPointInstancer::Define(stage, instancerPath);
+    const UsdPrim               prototypesGroupPrim = stage->DefinePrim(prototypesPath);
+    const UsdPrim               emptyPrim = stage->DefinePrim(emptyPrimPath);
+    instancer.CreatePrototypesRel().AddTarget(emptyPrimPath);
+    instancer.CreateProtoIndicesAttr().Set(VtIntArray());
+    instancer.CreatePositionsAttr().Set(VtVec3fArray());
+    instancer.CreateOrientationsAttr().Set(VtQuathArray());
+    instancer.CreateScalesAttr().Set(VtVec3fArray());
+    UsdModelAPI(instancer).SetKind(KindTokens->assembly);
+    UsdModelAPI(prototypesGroupPrim).SetKind(KindTokens->group);
+    stage->SetDefaultPrim(instancer.GetPrim());
+
+    return stage;
+}
+
+// Exports the prototypes group of the given layer to a string, so that the
+// prototypes authored by two syncs can be compared.
+static std::string _ExportPrototypes(const SdfLayerHandle& layer, const SdfPath& prototypesPath)
+{
+    SdfLayerRefPtr prototypesLayer = SdfLayer::CreateAnonymous();
+    SdfCreatePrimInLayer(prototypesLayer, prototypesPath.GetParentPath());
+    SdfCopySpec(layer, prototypesPath, prototypesLayer, prototypesPath);
+
+    std::string result;
+    prototypesLayer->ExportToString(&result);
+    return result;
+}
+
 size_t UsdMayaGL_InstancerShapeAdapter::_SyncInstancerPrototypes(
     const UsdGeomPointInstancer& usdInstancer,
     const MPlug&                 inputHierarchy)
 {
-    usdInstancer.GetPrototypesRel().ClearTargets(/*removeSpec*/ false);
-
     // Write prototypes using a custom code path. We're only going to
     // export USD reference assemblies; any native objects will be left
     // as empty prims.
-    const UsdStagePtr stage = usdInstancer.GetPrim().GetStage();
-    stage->MuteAndUnmuteLayers({}, stage->GetMutedLayers());
-
+    //
+    // The prototypes are written to the scratch stage first. Editing the
+    // prototypes of the instancer stage makes Hydra re-sync them, so they are
+    // only copied over when they actually changed since the last sync.
     const SdfPath prototypesGroupPath = SdfPath::AbsoluteRootPath()
                                             .AppendChild(_tokens->Instancer)
                                             .AppendChild(_tokens->Prototypes);
+    _scratchStage->RemovePrim(prototypesGroupPath);
+    UsdModelAPI(_scratchStage->DefinePrim(prototypesGroupPath)).SetKind(KindTokens->group);
+
+    SdfPathVector            prototypePaths;
     std::vector<std::string> layerIdsToMute;
     for (unsigned int i = 0; i < inputHierarchy.numElements(); ++i) {
         // Set up an empty prim for the prototype reference.
@@ -134,15 +182,63 @@ size_t UsdMayaGL_InstancerShapeAdapter::_SyncInstancerPrototypes(
         // we can just leave it and "continue" if we error trying to set it up.
         const TfToken prototypeName(TfStringPrintf("prototype_%d", i));
         const SdfPath prototypeUsdPath = prototypesGroupPath.AppendChild(prototypeName);
-        UsdPrim       prototypePrim = stage->DefinePrim(prototypeUsdPath);
+        UsdPrim       prototypePrim = _scratchStage->DefinePrim(prototypeUsdPath);
         UsdModelAPI(prototypePrim).SetKind(KindTokens->component);
-        usdInstancer.GetPrototypesRel().AddTarget(prototypeUsdPath);
+        prototypePaths.push_back(prototypeUsdPath);
 
         SyncInstancerPerPrototypePostHook(inputHierarchy[i], prototypePrim, layerIdsToMute);
     }
 
-    // Actually do all the muting in a batch.
-    stage->MuteAndUnmuteLayers(layerIdsToMute, {});
+    const UsdStagePtr    stage = usdInstancer.GetPrim().GetStage();
+    const SdfLayerHandle layer = stage->GetRootLayer();
+
+    std::string prototypes = _ExportPrototypes(_scratchStage->GetRootLayer(), prototypesGroupPath);
+    if (prototypes != _syncedPrototypes) {
+        SdfChangeBlock changeBlock;
+
+        // Copying over existing specs would keep the prototypes which were
+        // removed, so the whole prototypes group is replaced.
+        if (const SdfPrimSpecHandle prototypesSpec = layer->GetPrimAtPath(prototypesGroupPath)) {
+            layer->GetPrimAtPath(prototypesGroupPath.GetParentPath())
+                ->RemoveNameChild(prototypesSpec);
+        }
+        SdfCopySpec(
+            _scratchStage->GetRootLayer(), prototypesGroupPath, layer, prototypesGroupPath);
+
+        _syncedPrototypes = std::move(prototypes);
+    }
+
+    SdfPathVector targets;
+    usdInstancer.GetPrototypesRel().GetTargets(&targets);
+    if (targets != prototypePaths) {
+        usdInstancer.GetPrototypesRel().SetTargets(prototypePaths);
+    }
+
+    // Actually do all the muting in a batch, only changing the layers whose
+    // muting differs from the last sync.
+    std::vector<std::string> mutedLayerIds = stage->GetMutedLayers();
+    std::sort(mutedLayerIds.begin(), mutedLayerIds.end());
+    std::sort(layerIdsToMute.begin(), layerIdsToMute.end());
+    layerIdsToMute.erase(
+        std::unique(layerIdsToMute.begin(), layerIdsToMute.end()), layerIdsToMute.end());
+
+    std::vector<std::string> muteLayerIds;
+    std::set_difference(
+        layerIdsToMute.begin(),
+        layerIdsToMute.end(),
+        mutedLayerIds.begin(),
+        mutedLayerIds.end(),
+        std::back_inserter(muteLayerIds));
+    std::vector<std::string> unmuteLayerIds;
+    std::set_difference(
+        mutedLayerIds.begin(),
+        mutedLayerIds.end(),
+        layerIdsToMute.begin(),
+        layerIdsToMute.end(),
+        std::back_inserter(unmuteLayerIds));
+    if (!muteLayerIds.empty() || !unmuteLayerIds.empty()) {
+        stage->MuteAndUnmuteLayers(muteLayerIds, unmuteLayerIds);
+    }
 
     return inputHierarchy.numElements();
 }
@@ -194,9 +290,39 @@ void UsdMayaGL_InstancerShapeAdapter::_SyncInstancer(
         return;
     }
 
-    // Write PointInstancer attrs using export code path.
+    // Write PointInstancer attrs using export code path, to the scratch
+    // stage so that only the attributes which changed are authored on the
+    // instancer stage. Dragging a single particle then only updates the
+    // positions of the instances in Hydra.
+    const UsdGeomPointInstancer scratchInstancer(_scratchStage->GetDefaultPrim());
     UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
-        data, usdInstancer, numPrototypes, UsdTimeCode::Default());
+        data, scratchInstancer, numPrototypes, UsdTimeCode::Default());
+
+    std::vector<std::pair<UsdAttribute, VtValue>> changedValues;
+    for (const UsdAttribute& scratchAttr : scratchInstancer.GetPrim().GetAuthoredAttributes()) {
+        VtValue value;
+        if (!scratchAttr.Get(&value)) {
+            continue;
+        }
+
+        UsdAttribute attr = usdInstancer.GetPrim().GetAttribute(scratchAttr.GetName());
+        VtValue      syncedValue;
+        if (attr && attr.Get(&syncedValue) && syncedValue == value) {
+            continue;
+        }
+
+        if (!attr) {
+            attr = usdInstancer.GetPrim().CreateAttribute(
+                scratchAttr.GetName(), scratchAttr.GetTypeName(), /*custom*/ false);
+        }
+        changedValues.emplace_back(attr, std::move(value));
+    }
+
+    // Send a single change notice for all of the changed attributes.
+    SdfChangeBlock changeBlock;
+    for (const auto& changedValue : changedValues) {
+        changedValue.first.Set(changedValue.second);
+    }
 }
 
 /* virtual */
@@ -308,24 +434,11 @@ UsdMayaGL_InstancerShapeAdapter::UsdMayaGL_InstancerShapeAdapter(bool isViewport
     TF_DEBUG(PXRUSDMAYAGL_SHAPE_ADAPTER_LIFECYCLE)
         .Msg("Constructing UsdMayaGL_InstancerShapeAdapter: %p\n", this);
 
-    // Set up bare-bones instancer stage.
-    // Populate the required properties for the instancer.
-    _instancerStage = UsdStage::CreateInMemory();
-    const SdfPath instancerPath = SdfPath::AbsoluteRootPath().AppendChild(_tokens->Instancer);
-    const SdfPath prototypesPath = instancerPath.AppendChild(_tokens->Prototypes);
-    const SdfPath emptyPrimPath = instancerPath.AppendChild(_tokens->EmptyPrim);
-    const UsdGeomPointInstancer instancer
-        = UsdGeomPointInstancer::Define(_instancerStage, instancerPath);
-    const UsdPrim prototypesGroupPrim = _instancerStage->DefinePrim(prototypesPath);
-    const UsdPrim emptyPrim = _instancerStage->DefinePrim(emptyPrimPath);
-    instancer.CreatePrototypesRel().AddTarget(emptyPrimPath);
-    instancer.CreateProtoIndicesAttr().Set(VtIntArray());
-    instancer.CreatePositionsAttr().Set(VtVec3fArray());
-    instancer.CreateOrientationsAttr().Set(VtQuathArray());
-    instancer.CreateScalesAttr().Set(VtVec3fArray());
-    UsdModelAPI(instancer).SetKind(KindTokens->assembly);
-    UsdModelAPI(prototypesGroupPrim).SetKind(KindTokens->group);
-    _instancerStage->SetDefaultPrim(instancer.GetPrim());
+    // Set up bare-bones instancer stage, and the scratch stage the instancer
+    // is written to before authoring what changed on the instancer stage.
+    // The scratch stage doesn't need the payloads of the prototypes.
+    _instancerStage = _CreateInstancerStage(UsdStage::LoadAll);
+    _scratchStage = _CreateInstancerStage(UsdStage::LoadNone);
 }
 
 /* virtual */
@@ -18,6 +18,7 @@
 
 /// \file pxrUsdMayaGL/instancerShapeAdapter.h
 #include <memory>
+#include <string>
 
 // XXX: With Maya versions up through 2019 on Linux, M3dView.h ends up
 // indirectly including an X11 header that #define's "Bool" as int:
@@ -108,6 +109,8 @@ protected:
     // Derived class hook to allow derived classes to augment
     // _SyncInstancerPrototypes(), for each prototype.  The implementation
     // in this class clears references on the argument prototypePrim.
+    // The prototypePrim belongs to a scratch stage, which is copied to the
+    // instancer stage when the prototypes changed.
     MAYAUSD_CORE_PUBLIC
     virtual void SyncInstancerPerPrototypePostHook(
         const MPlug&              hierarchyPlug,
@@ -144,6 +147,14 @@ private:
 
     UsdStageRefPtr _instancerStage;
 
+    /// Stage the instancer is written to first at each sync, so that only the
+    /// prototypes and attributes that changed are authored on
+    /// _instancerStage.
+    UsdStageRefPtr _scratchStage;
+
+    /// Prototypes last copied to _instancerStage, exported to a string.
+    std::string _syncedPrototypes;
+
     std::shared_ptr<UsdImagingDelegate> _delegate;
 
     /// The classes that maintain ownership of and are responsible for
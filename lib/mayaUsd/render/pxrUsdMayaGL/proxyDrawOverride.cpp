@@ -46,6 +46,7 @@
 
 #if defined(BUILD_HDMAYA)
 #include <mayaUsd/render/mayaToHydra/utils.h>
+#include <mayaUsd/utils/profilingScope.h>
 #endif
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -107,7 +108,7 @@ MBoundingBox UsdMayaProxyDrawOverride::boundingBox(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L1,
         "USD Proxy Shape Computing Bounding Box (Viewport 2.0)");
@@ -178,7 +179,7 @@ MUserData* UsdMayaProxyDrawOverride::prepareForDraw(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L2,
         "USD Proxy Shape prepareForDraw() (Viewport 2.0)");
@@ -239,7 +240,7 @@ bool UsdMayaProxyDrawOverride::userSelect(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L2,
         "USD Proxy Shape userSelect() (Viewport 2.0)");
@@ -289,7 +290,7 @@ void UsdMayaProxyDrawOverride::draw(const MHWRender::MDrawContext& context, cons
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorC_L1,
         "USD Proxy Shape draw() (Viewport 2.0)");
@@ -19,12 +19,13 @@
 /// \file pxrUsdMayaGL/softSelectHelper.h
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/hash.h>
 
-#include <pxr/base/tf/hash.h>
 #include <pxr/pxr.h>
 
 #include <maya/MColor.h>
 #include <maya/MDagPath.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MRampAttribute.h>
 #include <maya/MString.h>
 
@@ -41,6 +42,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// expensive do in the middle of the render loop so this class lets us compute
 /// it once at the beginning of a frame render, and then query it later.
 ///
+/// The state is kept until Reset() is called, which the batch renderer does
+/// when the selection or the soft select options change, so that the queries
+/// made while drawing are hash lookups only.
+///
 /// While this class doesn't have anything particular to rendering, it is only
 /// used by the render and is therefore here.  We can move this to usdMaya if
 /// we'd like to use it outside of the rendering.
@@ -77,11 +82,15 @@ private:
     void _PopulateWeights();
     void _PopulateSoftSelectColorRamp();
 
+    // Hashing the node and the instance number avoids building the full path
+    // name of the DAG path for every query.
     struct _MDagPathHash
     {
         inline size_t operator()(const MDagPath& dagPath) const
         {
-            return TfHash()(std::string(dagPath.fullPathName().asChar()));
+            size_t seed = MObjectHandle(dagPath.node()).hashCode();
+            MayaUsd::hash_combine(seed, dagPath.instanceNumber());
+            return seed;
         }
     };
     typedef std::unordered_map<MDagPath, float, _MDagPathHash> _MDagPathsToWeights;
@@ -21,6 +21,7 @@
 #include <mayaUsd/render/pxrUsdMayaGL/debugCodes.h>
 #include <mayaUsd/render/pxrUsdMayaGL/renderParams.h>
 #include <mayaUsd/render/pxrUsdMayaGL/shapeAdapter.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/debug.h>
@@ -103,7 +104,7 @@ bool PxrMayaHdUsdProxyShapeAdapter::_Sync(
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L2,
         "USD Proxy Shape Syncing Shape Adapter");
@@ -231,7 +232,7 @@ bool PxrMayaHdUsdProxyShapeAdapter::_Init(HdRenderIndex* renderIndex)
 {
     TRACE_FUNCTION();
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         UsdMayaGLBatchRenderer::ProfilerCategory,
         MProfiler::kColorE_L2,
         "USD Proxy Shape Initializing Shape Adapter");
@@ -0,0 +1,49 @@
+cbuffer Values : register( b0 )
+{
+	uint VertexCount;
+};
+
+// These are float3 but are stored as raw floats
+ByteAddressBuffer Positions : register( t0 );
+ByteAddressBuffer Adjacency : register( t1 );
+ByteAddressBuffer RenderingToScene : register( t2 );
+ByteAddressBuffer SceneToRendering : register( t3 );
+RWByteAddressBuffer Normals : register( u0 );
+
+float3 LoadPosition(uint vertexId)
+{
+	return asfloat(Positions.Load3(vertexId * 12));
+}
+
+[numthreads( 256, 1, 1 )]
+void main(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint renderingVertexId = dispatchThreadId.x;
+
+	if (renderingVertexId < VertexCount)
+	{
+		uint sceneVertexId = RenderingToScene.Load(renderingVertexId * 4);
+
+		uint adjOffsetIdx = sceneVertexId*2;
+		int offset = asint(Adjacency.Load(adjOffsetIdx * 4));
+		int valence = asint(Adjacency.Load((adjOffsetIdx + 1) * 4));
+
+		float3 currVertex = LoadPosition(renderingVertexId);
+		float3 accumulatedNormal = float3(0.0, 0.0, 0.0);
+
+		for (int neighbour=0; neighbour<valence; neighbour++)
+		{
+			uint prevVertexId = SceneToRendering.Load(Adjacency.Load(offset * 4) * 4);
+			float3 prevVertex = LoadPosition(prevVertexId);
+			offset++;
+			uint nextVertexId = SceneToRendering.Load(Adjacency.Load(offset * 4) * 4);
+			float3 nextVertex = LoadPosition(nextVertexId);
+			offset++;
+			accumulatedNormal += cross(nextVertex - currVertex, prevVertex - currVertex);
+		}
+
+		accumulatedNormal = normalize(accumulatedNormal);
+
+		Normals.Store3(renderingVertexId * 12, asuint(accumulatedNormal));
+	}
+}
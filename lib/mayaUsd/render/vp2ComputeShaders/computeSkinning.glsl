@@ -0,0 +1,71 @@
+#version 430
+
+layout( std140, binding=0 ) uniform Values
+{
+	uint VertexCount;
+	uint NumInfluencesPerComponent;
+	uint HasConstantInfluences;
+	uint NumJoints;
+};
+
+// This is a float3 but for buffer layout to be correct use float
+layout( std430, binding=1 ) buffer Pos
+{
+	float Positions[ ];
+};
+
+// This is a float3 but for buffer layout to be correct use float
+layout( std430, binding=2 ) buffer Rest
+{
+	float RestPoints[ ];
+};
+
+layout( std430, binding=3 ) buffer RtoS
+{
+	int RenderingToScene[ ];
+};
+
+// Pairs of joint index and weight
+layout( std430, binding=4 ) buffer Infl
+{
+	float Influences[ ];
+};
+
+// The joint transforms are uploaded row-major, as read here they are transposed so
+// transforming column vectors by them matches the row vector convention of USD.
+layout( std430, binding=5 ) buffer Xforms
+{
+	mat4 SkinningXforms[ ];
+};
+
+layout( local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+void main() {
+	uint renderingVertexId = gl_GlobalInvocationID.x;
+	uint renderingVertexOffset = renderingVertexId *3;
+
+	if (renderingVertexId < VertexCount)
+	{
+		uint sceneVertexId = RenderingToScene[renderingVertexId];
+		uint restPointOffset = sceneVertexId*3;
+
+		vec4 restPoint = vec4(RestPoints[restPointOffset], RestPoints[restPointOffset+1], RestPoints[restPointOffset+2], 1.0);
+		vec3 skinnedPoint = vec3(0.0, 0.0, 0.0);
+
+		uint influenceOffset = (HasConstantInfluences != 0) ? 0 : sceneVertexId*NumInfluencesPerComponent;
+		for (uint influence=0; influence<NumInfluencesPerComponent; influence++)
+		{
+			uint influenceIdx = (influenceOffset + influence)*2;
+			int jointIdx = int(Influences[influenceIdx]);
+			float weight = Influences[influenceIdx+1];
+			if (weight != 0.0 && jointIdx >= 0 && uint(jointIdx) < NumJoints)
+			{
+				skinnedPoint += weight * (SkinningXforms[jointIdx] * restPoint).xyz;
+			}
+		}
+
+		Positions[renderingVertexOffset] = skinnedPoint.x;
+		Positions[renderingVertexOffset+1] = skinnedPoint.y;
+		Positions[renderingVertexOffset+2] = skinnedPoint.z;
+	}
+}
@@ -16,13 +16,18 @@
 //
 #include "basisCurves.h"
 
+#include "bboxBatch.h"
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "draw_item.h"
 #include "instancer.h"
 #include "material.h"
+#include "renderStats.h"
 #include "render_delegate.h"
 #include "tokens.h"
+#include "vertexBufferCache.h"
+
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/matrix4f.h>
@@ -419,11 +424,19 @@ void HdVP2BasisCurves::Sync(
     HdDirtyBits*     dirtyBits,
     TfToken const&   reprToken)
 {
-    if (!_SyncCommon(*this, delegate, renderParam, dirtyBits, _GetRepr(reprToken), reprToken)) {
+    if (!_SyncCommon(
+            *this,
+            _sharedData,
+            delegate,
+            renderParam,
+            dirtyBits,
+            _reprs,
+            _GetRepr(reprToken),
+            reprToken)) {
         return;
     }
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L2,
         _rprimId.asChar(),
@@ -466,38 +479,72 @@ void HdVP2BasisCurves::Sync(
     // Prepare position buffer. It is shared among all draw items so it should
     // be updated only once when it gets dirty.
     if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)) {
-        const VtValue value = delegate->Get(id, HdTokens->points);
-        _curvesSharedData._points = value.Get<VtVec3fArray>();
+        // Points updated at another time may come from the vertex buffer cache.
+        UsdTimeCode             bufferTime;
+        SdfPath                 bufferKey;
+        HdVP2VertexBufferCache* bufferCache = _GetVertexBufferCache(id, bufferTime, bufferKey);
+        if (bufferCache && HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
+            bufferCache = nullptr;
+        }
 
-        const size_t numVertices = _curvesSharedData._points.size();
+        HdVP2CachedVertexBuffersSharedPtr cachedBuffers
+            = bufferCache ? bufferCache->Find(bufferKey, bufferTime) : nullptr;
+        if (cachedBuffers && cachedBuffers->_positionsBuffer) {
+            _curvesSharedData._points = cachedBuffers->_points;
+            _curvesSharedData._positionsBuffer = cachedBuffers->_positionsBuffer;
+        } else {
+            const VtValue value = delegate->Get(id, HdTokens->points);
+            _curvesSharedData._points = value.Get<VtVec3fArray>();
 
-        const HdBasisCurvesTopology& topology = _curvesSharedData._topology;
-        const size_t numControlPoints = topology.CalculateNeededNumberOfControlPoints();
+            // The current buffer may belong to a frame cached for another time.
+            if (bufferCache) {
+                bufferCache->Release(std::move(_curvesSharedData._positionsBuffer));
 
-        if (!topology.HasIndices() && numVertices != numControlPoints) {
-            TF_WARN("Topology and vertices do not match for BasisCurve %s", id.GetName().c_str());
-        }
+                const MHWRender::MVertexBufferDescriptor desc(
+                    "", MHWRender::MGeometry::kPosition, MHWRender::MGeometry::kFloat, 3);
+                _curvesSharedData._positionsBuffer.reset(new MHWRender::MVertexBuffer(desc));
+            }
+
+            const size_t numVertices = _curvesSharedData._points.size();
+
+            const HdBasisCurvesTopology& topology = _curvesSharedData._topology;
+            const size_t numControlPoints = topology.CalculateNeededNumberOfControlPoints();
 
-        void* bufferData = _curvesSharedData._positionsBuffer->acquire(numVertices, true);
-        if (bufferData) {
-            const size_t numBytes = sizeof(GfVec3f) * numVertices;
-            memcpy(bufferData, _curvesSharedData._points.cdata(), numBytes);
-
-            // Capture class member for lambda
-            MHWRender::MVertexBuffer* const positionsBuffer
-                = _curvesSharedData._positionsBuffer.get();
-            const MString& rprimId = _rprimId;
-
-            _delegate->GetVP2ResourceRegistry().EnqueueCommit(
-                [positionsBuffer, bufferData, rprimId]() {
-                    MProfilingScope profilingScope(
-                        HdVP2RenderDelegate::sProfilerCategory,
-                        MProfiler::kColorC_L2,
-                        rprimId.asChar(),
-                        "CommitPositions");
-
-                    positionsBuffer->commit(bufferData);
-                });
+            if (!topology.HasIndices() && numVertices != numControlPoints) {
+                TF_WARN(
+                    "Topology and vertices do not match for BasisCurve %s", id.GetName().c_str());
+            }
+
+            void* bufferData = _curvesSharedData._positionsBuffer->acquire(numVertices, true);
+            if (bufferData) {
+                const size_t numBytes = sizeof(GfVec3f) * numVertices;
+                memcpy(bufferData, _curvesSharedData._points.cdata(), numBytes);
+
+                // Capture class member for lambda
+                MHWRender::MVertexBuffer* const positionsBuffer
+                    = _curvesSharedData._positionsBuffer.get();
+                const MString& rprimId = _rprimId;
+
+                _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+                    [positionsBuffer, bufferData, rprimId]() {
+                        MayaUsd::ProfilingScope profilingScope(
+                            HdVP2RenderDelegate::sProfilerCategory,
+                            MProfiler::kColorC_L2,
+                            rprimId.asChar(),
+                            "CommitPositions");
+
+                        positionsBuffer->commit(bufferData);
+                        HdVP2RenderStats::AddVertexBufferUpload(*positionsBuffer);
+                    });
+            }
+
+            if (bufferCache && bufferData) {
+                auto entry = std::make_shared<HdVP2CachedVertexBuffers>();
+                entry->_points = _curvesSharedData._points;
+                entry->_numVertices = numVertices;
+                entry->_positionsBuffer = _curvesSharedData._positionsBuffer;
+                bufferCache->Insert(bufferKey, bufferTime, entry);
+            }
         }
     }
 
@@ -1087,10 +1134,12 @@ void HdVP2BasisCurves::_UpdateDrawItem(
     const PrimvarBufferMap*   primvarBuffers = &_curvesSharedData._primvarBuffers;
     MHWRender::MIndexBuffer*  indexBuffer = drawItemData._indexBuffer.get();
 
+    HdVP2BBoxBatch* bboxBatch = nullptr;
     if (isBoundingBoxItem) {
         const HdVP2BBoxGeom& sharedBBoxGeom = _delegate->GetSharedBBoxGeom();
         positionsBuffer = const_cast<MHWRender::MVertexBuffer*>(sharedBBoxGeom.GetPositionBuffer());
         indexBuffer = const_cast<MHWRender::MIndexBuffer*>(sharedBBoxGeom.GetIndexBuffer());
+        bboxBatch = _GetBBoxBatch(*renderItem, GetInstancerId());
     }
 
     _delegate->GetVP2ResourceRegistry().EnqueueCommit([drawItem,
@@ -1100,7 +1149,8 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                                                        normalsBuffer,
                                                        colorBuffer,
                                                        primvarBuffers,
-                                                       indexBuffer]() {
+                                                       indexBuffer,
+                                                       bboxBatch]() {
         // This code executes serially, once per basisCurve updated. Keep
         // performance in mind while modifying this code.
         MHWRender::MRenderItem* renderItem = drawItem->GetRenderItem();
@@ -1118,14 +1168,30 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                         unsigned int numElems
                             = primvarBufferData.size() / (desc.dataTypeSize() * desc.dimension());
                         primvarBuffer->update(&primvarBufferData[0], 0, numElems, true);
+                        HdVP2RenderStats::AddVertexBufferUpload(*primvarBuffer);
                     }
                 }
             }
         }
 
         // If available, something changed
-        if (stateToCommit._indexBufferData)
+        if (stateToCommit._indexBufferData) {
             indexBuffer->commit(stateToCommit._indexBufferData);
+            HdVP2RenderStats::AddIndexBufferUpload(*indexBuffer);
+        }
+
+        // The bounding box is drawn by the batch, the render item stays without geometry.
+        if (bboxBatch) {
+            const HdVP2DrawItem::RenderItemData& drawItemData = stateToCommit._renderItemData;
+            bboxBatch->Update(
+                *renderItem,
+                drawItemData._worldMatrix,
+                drawItemData._shader,
+                drawItemData._enabled,
+                MSelectionMask::kSelectNurbsCurves,
+                MHWRender::MFrameContext::kExcludeNurbsCurves);
+            return;
+        }
 
         // If available, something changed
         if (stateToCommit._shader != nullptr) {
@@ -1423,6 +1489,28 @@ HdDirtyBits HdVP2BasisCurves::GetInitialDirtyBitsMask() const
     return bits;
 }
 
+/*! \brief  Add the memory used by the cached scene data and the VP2 buffers of the curves.
+*/
+void HdVP2BasisCurves::GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const
+{
+    const HdBasisCurvesTopology& topology = _curvesSharedData._topology;
+    prim._cpuBytes += (topology.GetCurveVertexCounts().size() + topology.GetCurveIndices().size())
+            * sizeof(int)
+        + _curvesSharedData._points.size() * sizeof(GfVec3f);
+    for (const auto& entry : _curvesSharedData._primvarSourceMap) {
+        prim._cpuBytes += HdVP2GetValueBytes(entry.second.data);
+    }
+
+    usage.AddVertexBuffer(prim, _curvesSharedData._positionsBuffer.get());
+    usage.AddVertexBuffer(prim, _curvesSharedData._colorBuffer.get());
+    usage.AddVertexBuffer(prim, _curvesSharedData._normalsBuffer.get());
+    for (const auto& entry : _curvesSharedData._primvarBuffers) {
+        usage.AddVertexBuffer(prim, entry.second.get());
+    }
+
+    _GetRenderItemsMemoryUsage(_reprs, usage, prim);
+}
+
 /*! \brief  Update _primvarSourceMap, our local cache of raw primvar data.
 
     This function pulls data from the scene delegate, but defers processing.
@@ -72,7 +72,7 @@ struct HdVP2BasisCurvesSharedData
     VtVec3fArray _points;
 
     //! Position buffer of the Rprim to be shared among all its draw items.
-    std::unique_ptr<MHWRender::MVertexBuffer> _positionsBuffer;
+    std::shared_ptr<MHWRender::MVertexBuffer> _positionsBuffer;
 
     //! Render item color buffer - use when updating data
     std::unique_ptr<MHWRender::MVertexBuffer> _colorBuffer;
@@ -126,6 +126,8 @@ public:
 
     HdDirtyBits GetInitialDirtyBitsMask() const override;
 
+    void GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const override;
+
 protected:
     HdDirtyBits _PropagateDirtyBits(HdDirtyBits bits) const override;
 
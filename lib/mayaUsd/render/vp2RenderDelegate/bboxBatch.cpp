@@ -0,0 +1,216 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "bboxBatch.h"
+
+#include "bboxGeom.h"
+#include "draw_item.h"
+
+#include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <maya/MBoundingBox.h>
+#include <maya/MPxSubSceneOverride.h>
+
+#include <tuple>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_INSTANCED_BBOX,
+    true,
+    "Draw the bounding boxes of the non-instanced rprims of a proxy shape through instanced render "
+    "items instead of one render item per rprim.");
+
+namespace {
+
+//! Name of the positions stream of the batch render items
+const MString kPositionsStr("positions");
+
+} // namespace
+
+bool HdVP2BBoxBatch::IsEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_INSTANCED_BBOX);
+    return enabled;
+}
+
+bool HdVP2BBoxBatch::_GroupKey::operator<(const _GroupKey& other) const
+{
+    return std::tie(_shader, _selectionType, _exclusionFlag, _selectable)
+        < std::tie(other._shader, other._selectionType, other._exclusionFlag, other._selectable);
+}
+
+void HdVP2BBoxBatch::Update(
+    MHWRender::MRenderItem&       renderItem,
+    const MMatrix&                worldMatrix,
+    MHWRender::MShaderInstance*   shader,
+    bool                          enabled,
+    MSelectionMask::SelectionType selectionType,
+    MUint64                       exclusionFlag)
+{
+    if (renderItem.isEnabled()) {
+        renderItem.enable(false);
+    }
+
+    // The selection mask of the render item is cleared in template and reference modes.
+    const bool selectable = renderItem.selectionMask().intersects(selectionType);
+
+    _Instance& instance = _instances[&renderItem];
+    if (instance._enabled == enabled && instance._shader == shader
+        && instance._selectionType == selectionType && instance._exclusionFlag == exclusionFlag
+        && instance._selectable == selectable && instance._worldMatrix == worldMatrix) {
+        return;
+    }
+
+    instance._worldMatrix = worldMatrix;
+    instance._shader = shader;
+    instance._selectionType = selectionType;
+    instance._exclusionFlag = exclusionFlag;
+    instance._selectable = selectable;
+    instance._enabled = enabled;
+    _dirty = true;
+}
+
+void HdVP2BBoxBatch::Remove(const MHWRender::MRenderItem& renderItem)
+{
+    if (_instances.erase(&renderItem) > 0) {
+        _dirty = true;
+    }
+}
+
+void HdVP2BBoxBatch::Commit(
+    ProxyRenderDelegate& drawScene,
+    MSubSceneContainer&  container,
+    const HdVP2BBoxGeom& sharedBBoxGeom)
+{
+    if (!_dirty) {
+        return;
+    }
+    _dirty = false;
+
+    // The instances are regrouped from scratch, one transform array update per render item is
+    // still much cheaper than one render item update per rprim.
+    for (auto& entry : _groups) {
+        entry.second._sourceItems.clear();
+        entry.second._instanceTransforms.clear();
+    }
+
+    for (const auto& entry : _instances) {
+        const _Instance& instance = entry.second;
+        if (!instance._enabled || !instance._shader) {
+            continue;
+        }
+
+        const _GroupKey key { instance._shader,
+                              instance._selectionType,
+                              instance._exclusionFlag,
+                              instance._selectable };
+
+        _Group& group = _groups[key];
+        group._sourceItems.push_back(entry.first);
+        group._instanceTransforms.append(instance._worldMatrix);
+    }
+
+    for (auto it = _groups.begin(); it != _groups.end();) {
+        _Group& group = it->second;
+
+        // Render items of shaders which are no longer used are removed, selection highlight
+        // would otherwise leave one render item per color.
+        if (group._sourceItems.empty()) {
+            if (group._renderItem) {
+                container.remove(group._renderItem->name());
+            }
+            it = _groups.erase(it);
+            continue;
+        }
+
+        if (!group._renderItem) {
+            group._renderItem = _CreateRenderItem(it->first, drawScene, container, sharedBBoxGeom);
+        }
+
+        const MStatus result
+            = drawScene.setInstanceTransformArray(*group._renderItem, group._instanceTransforms);
+        TF_VERIFY(result == MStatus::kSuccess);
+        ++it;
+    }
+}
+
+SdfPath HdVP2BBoxBatch::GetInstancePrimPath(
+    const MHWRender::MRenderItem& renderItem,
+    int                           instanceId) const
+{
+    for (const auto& entry : _groups) {
+        const _Group& group = entry.second;
+        if (group._renderItem != &renderItem) {
+            continue;
+        }
+
+        // VP2 defines instance ID of the first instance to be 1.
+        const size_t index = static_cast<size_t>(instanceId - 1);
+        if (instanceId > 0 && index < group._sourceItems.size()
+            && _instances.count(group._sourceItems[index]) > 0) {
+            return HdVP2DrawItem::RenderItemToPrimPath(*group._sourceItems[index]);
+        }
+        break;
+    }
+    return SdfPath();
+}
+
+MHWRender::MRenderItem* HdVP2BBoxBatch::_CreateRenderItem(
+    const _GroupKey&     key,
+    ProxyRenderDelegate& drawScene,
+    MSubSceneContainer&  container,
+    const HdVP2BBoxGeom& sharedBBoxGeom)
+{
+    const MString name
+        = TfStringPrintf("HdVP2BBoxBatch_%p_%zu", this, _numCreatedRenderItems++).c_str();
+
+    MHWRender::MRenderItem* const renderItem = MHWRender::MRenderItem::Create(
+        name, MHWRender::MRenderItem::DecorationItem, MHWRender::MGeometry::kLines);
+
+    renderItem->setDrawMode(MHWRender::MGeometry::kBoundingBox);
+    renderItem->castsShadows(false);
+    renderItem->receivesShadows(false);
+    renderItem->setShader(key._shader);
+    renderItem->setSelectionMask(
+        key._selectable ? MSelectionMask(key._selectionType) : MSelectionMask());
+#if MAYA_API_VERSION >= 20220000
+    renderItem->setObjectTypeExclusionFlag(key._exclusionFlag);
+#endif
+    container.add(renderItem);
+
+    MHWRender::MVertexBufferArray vertexBuffers;
+    vertexBuffers.addBuffer(
+        kPositionsStr, const_cast<MHWRender::MVertexBuffer*>(sharedBBoxGeom.GetPositionBuffer()));
+
+    const GfVec3d&     min = sharedBBoxGeom.GetRange().GetMin();
+    const GfVec3d&     max = sharedBBoxGeom.GetRange().GetMax();
+    const MBoundingBox bounds(MPoint(min[0], min[1], min[2]), MPoint(max[0], max[1], max[2]));
+
+    const MStatus result = drawScene.setGeometryForRenderItem(
+        *renderItem,
+        vertexBuffers,
+        *const_cast<MHWRender::MIndexBuffer*>(sharedBBoxGeom.GetIndexBuffer()),
+        &bounds);
+    TF_VERIFY(result == MStatus::kSuccess);
+
+    return renderItem;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,131 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_BBOX_BATCH
+#define HD_VP2_BBOX_BATCH
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <maya/MHWGeometry.h>
+#include <maya/MMatrixArray.h>
+#include <maya/MSelectionMask.h>
+#include <maya/MShaderManager.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+class MSubSceneContainer;
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class HdVP2BBoxGeom;
+class ProxyRenderDelegate;
+
+/*! \brief  Instanced drawing of the bounding boxes of the rprims of a proxy shape.
+    \class  HdVP2BBoxBatch
+
+    With one render item per rprim, the bounding box display of large stages is limited by the
+    per-item overhead of VP2. When the batch is enabled, the bounding box render items of the
+    non-instanced rprims stay disabled and without geometry: their world matrix, shader and
+    enabled state are forwarded to the batch, which draws all of them through one instanced render
+    item per shader and selection mask, using the geometry of HdVP2BBoxGeom.
+
+    The batch is enabled by the MAYAUSD_VP2_INSTANCED_BBOX environment variable. All methods must
+    be called from the main thread.
+*/
+class HdVP2BBoxBatch final
+{
+public:
+    //! Return true when the bounding boxes are drawn by the batch.
+    static bool IsEnabled();
+
+    HdVP2BBoxBatch() = default;
+    ~HdVP2BBoxBatch() = default;
+
+    /*! \brief  Draw the bounding box of a render item through the batch.
+
+        The render item is disabled, it is only used to identify its rprim.
+    */
+    void Update(
+        MHWRender::MRenderItem&       renderItem,
+        const MMatrix&                worldMatrix,
+        MHWRender::MShaderInstance*   shader,
+        bool                          enabled,
+        MSelectionMask::SelectionType selectionType,
+        MUint64                       exclusionFlag);
+
+    //! Stop drawing the bounding box of a render item which is about to be deleted.
+    void Remove(const MHWRender::MRenderItem& renderItem);
+
+    //! Update the instanced render items after the render items of the rprims were committed.
+    void Commit(
+        ProxyRenderDelegate& drawScene,
+        MSubSceneContainer&  container,
+        const HdVP2BBoxGeom& sharedBBoxGeom);
+
+    /*! \brief  Return the id of the rprim drawn by an instance of a batch render item.
+
+        \return An empty path when the render item is not owned by the batch.
+    */
+    SdfPath GetInstancePrimPath(const MHWRender::MRenderItem& renderItem, int instanceId) const;
+
+private:
+    //! Bounding box of one rprim.
+    struct _Instance
+    {
+        MMatrix                       _worldMatrix;
+        MHWRender::MShaderInstance*   _shader { nullptr };
+        MSelectionMask::SelectionType _selectionType { MSelectionMask::kSelectMeshes };
+        MUint64                       _exclusionFlag { 0 };
+        bool                          _selectable { true };
+        bool                          _enabled { false };
+    };
+
+    //! Render items are shared by the instances with the same key.
+    struct _GroupKey
+    {
+        MHWRender::MShaderInstance*   _shader;
+        MSelectionMask::SelectionType _selectionType;
+        MUint64                       _exclusionFlag;
+        bool                          _selectable;
+
+        bool operator<(const _GroupKey& other) const;
+    };
+
+    //! One instanced render item and the rprim items it draws, in instance order.
+    struct _Group
+    {
+        MHWRender::MRenderItem*                    _renderItem { nullptr };
+        std::vector<const MHWRender::MRenderItem*> _sourceItems;
+        MMatrixArray                               _instanceTransforms;
+    };
+
+    MHWRender::MRenderItem* _CreateRenderItem(
+        const _GroupKey&     key,
+        ProxyRenderDelegate& drawScene,
+        MSubSceneContainer&  container,
+        const HdVP2BBoxGeom& sharedBBoxGeom);
+
+    std::unordered_map<const MHWRender::MRenderItem*, _Instance> _instances;
+    std::map<_GroupKey, _Group>                                  _groups;
+    size_t _numCreatedRenderItems { 0 }; //!< Used to name the render items uniquely
+    bool   _dirty { false };             //!< Whether the instances changed since the last commit
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_BBOX_BATCH
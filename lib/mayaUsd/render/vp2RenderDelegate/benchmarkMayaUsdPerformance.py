@@ -0,0 +1,307 @@
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from __future__ import division
+
+"""
+Benchmark the VP2 render delegate on synthetic stages.
+
+Unlike analyticMayaUsdPerformance, which measures a USD file in an interactive
+session, this benchmark builds its own stages so that the results of two
+mayaUsd releases can be compared. It runs in an interactive session or in a
+batch session under mayapy, in which case the frames are drawn offscreen with
+ogsRender.
+
+Usage from mayapy:
+
+    mayapy benchmarkMayaUsdPerformance.py --output results.json
+    mayapy benchmarkMayaUsdPerformance.py --config big=10000,0,10 --frames 50
+
+The results of each configuration are:
+
+    "build_time"      : time taken to author the stage, in seconds
+    "first_frame"     : time taken to attach the stage and draw the first frame
+    "populate_ms"     : time spent populating the render index
+    "execute_ms"      : time spent updating the proxy shape for the first frame
+    "sync_ms"         : time spent synchronizing the prims for the first frame
+    "fill_ms"         : time spent filling buffers for the first frame
+    "commit_ms"       : time spent committing resources for the first frame
+    "rprims_synced"   : number of rprims synchronized for the first frame
+    "shader_instances": number of shader instances created for the first frame
+    "playback"        : total and per-frame averages of the same timings during playback
+    "memory"          : [physical, virtual] memory in MB before attaching the
+                        stage, after the first frame and after playback
+"""
+
+import argparse
+import json
+import math
+import sys
+from timeit import default_timer
+
+import maya.cmds as cmds
+
+import mayaUsd.lib as mayaUsdLib
+
+from pxr import Gf, Sdf, Usd, UsdGeom, UsdShade, UsdUtils, Vt
+
+# Configurations run when none is given, as name: (meshes, instances, materials)
+DEFAULT_CONFIGURATIONS = {
+    'meshes'    : (1000, 0, 1),
+    'instances' : (1, 10000, 1),
+    'materials' : (1000, 0, 1000),
+}
+
+DEFAULT_FRAMES = 100
+DEFAULT_WIDTH  = 960
+DEFAULT_HEIGHT = 540
+
+# Distance between two neighbouring meshes or instances
+GRID_SPACING = 3.0
+
+CUBE_POINTS = [(-1, -1, 1), (1, -1, 1), (-1, 1, 1), (1, 1, 1),
+               (-1, 1, -1), (1, 1, -1), (-1, -1, -1), (1, -1, -1)]
+CUBE_COUNTS = [4, 4, 4, 4, 4, 4]
+CUBE_INDICES = [0, 1, 3, 2, 2, 3, 5, 4, 4, 5, 7, 6, 6, 7, 1, 0, 1, 7, 5, 3, 6, 0, 2, 4]
+
+# Render statistics counters recorded for each drawn frame
+FRAME_COUNTERS = {
+    'execute_ms'       : 'vp2ExecuteTimeMs',
+    'sync_ms'          : 'vp2SyncTimeMs',
+    'fill_ms'          : 'vp2FillTimeMs',
+    'commit_ms'        : 'vp2CommitTimeMs',
+    'rprims_synced'    : 'vp2RprimsSynced',
+    'shader_instances' : 'vp2ShaderInstances',
+}
+
+
+def get_memory():
+    '''
+    :return: A 2 member list with current physical and virtual memory in use by Maya
+    '''
+    return [ cmds.memory(asFloat=True, megaByte=True, physicalMemory=True)
+           , cmds.memory(asFloat=True, megaByte=True, adjustedVirtualMemory=True) ]
+
+
+def grid_position(index, count):
+    '''
+    :return: The position of the index-th element of a square grid of count elements
+    '''
+    side = max(1, int(math.ceil(math.sqrt(count))))
+    return Gf.Vec3f((index % side) * GRID_SPACING, 0.0, (index // side) * GRID_SPACING)
+
+
+def define_cube(stage, path):
+    mesh = UsdGeom.Mesh.Define(stage, path)
+    mesh.CreatePointsAttr(Vt.Vec3fArray(CUBE_POINTS))
+    mesh.CreateFaceVertexCountsAttr(Vt.IntArray(CUBE_COUNTS))
+    mesh.CreateFaceVertexIndicesAttr(Vt.IntArray(CUBE_INDICES))
+    return mesh
+
+
+def build_stage(numMeshes, numInstances, numMaterials, numFrames):
+    '''
+    Author an in-memory stage with numMeshes animated cubes, a point instancer
+    of numInstances cubes and numMaterials UsdPreviewSurface materials bound
+    round-robin to the meshes.
+    '''
+    stage = Usd.Stage.CreateInMemory()
+    stage.SetStartTimeCode(1)
+    stage.SetEndTimeCode(numFrames)
+    UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.y)
+
+    with Sdf.ChangeBlock():
+        materials = []
+        for i in range(numMaterials):
+            material = UsdShade.Material.Define(stage, '/World/Looks/material%d' % i)
+            shader = UsdShade.Shader.Define(stage, material.GetPath().AppendChild('surface'))
+            shader.CreateIdAttr('UsdPreviewSurface')
+            hue = i / max(1, numMaterials)
+            shader.CreateInput('diffuseColor', Sdf.ValueTypeNames.Color3f).Set(
+                Gf.Vec3f(hue, 1.0 - hue, 0.5))
+            material.CreateSurfaceOutput().ConnectToSource(
+                shader.ConnectableAPI(), 'surface')
+            materials.append(material)
+
+        for i in range(numMeshes):
+            mesh = define_cube(stage, '/World/Meshes/mesh%d' % i)
+            position = grid_position(i, numMeshes)
+            translate = mesh.AddTranslateOp()
+            translate.Set(Gf.Vec3d(position), 1)
+            translate.Set(Gf.Vec3d(position + Gf.Vec3f(0.0, GRID_SPACING, 0.0)), numFrames)
+            if materials:
+                UsdShade.MaterialBindingAPI.Apply(mesh.GetPrim()).Bind(
+                    materials[i % len(materials)])
+
+        if numInstances > 0:
+            instancer = UsdGeom.PointInstancer.Define(stage, '/World/Instancer')
+            prototype = define_cube(stage, '/World/Instancer/Prototypes/cube')
+            instancer.CreatePrototypesRel().SetTargets([prototype.GetPath()])
+            instancer.CreateProtoIndicesAttr(Vt.IntArray([0] * numInstances))
+            instancer.CreatePositionsAttr(Vt.Vec3fArray(
+                [grid_position(i, numInstances) for i in range(numInstances)]))
+            if materials:
+                UsdShade.MaterialBindingAPI.Apply(prototype.GetPrim()).Bind(materials[0])
+
+    return stage
+
+
+def frame_camera(numElements):
+    '''
+    Place the perspective camera so that the whole grid is in view.
+    '''
+    extent = max(1, int(math.ceil(math.sqrt(numElements)))) * GRID_SPACING
+    cmds.xform('persp', worldSpace=True, translation=(extent * 1.2, extent, extent * 1.2))
+    cmds.viewLookAt('persp', position=(extent * 0.5, 0.0, extent * 0.5))
+
+
+def draw_frame(width, height):
+    if cmds.about(batch=True):
+        cmds.ogsRender(camera='persp', width=width, height=height, currentFrame=True)
+    else:
+        cmds.refresh(force=True)
+
+
+def get_counters():
+    return mayaUsdLib.RenderStats.GetCounters()
+
+
+def run_configuration(numMeshes, numInstances, numMaterials, numFrames, width, height):
+    '''
+    Attach a synthetic stage to a proxy shape and measure its first frame and playback.
+
+    :return: A dictionary with the results, see the module docs.
+    '''
+    cmds.file(new=True, force=True)
+    frame_camera(max(numMeshes, numInstances))
+    cmds.playbackOptions(minTime=1, maxTime=numFrames)
+    cmds.currentTime(1)
+
+    results = {
+        'meshes'    : numMeshes,
+        'instances' : numInstances,
+        'materials' : numMaterials,
+        'frames'    : numFrames,
+        'memory'    : [get_memory()],
+    }
+
+    start = default_timer()
+    stage = build_stage(numMeshes, numInstances, numMaterials, numFrames)
+    results['build_time'] = default_timer() - start
+
+    cache = UsdUtils.StageCache.Get()
+    stageId = cache.Insert(stage)
+    try:
+        mayaUsdLib.RenderStats.Enable()
+
+        start = default_timer()
+        shapeNode = cmds.createNode('mayaUsdProxyShape', skipSelect=True, name='benchmarkShape')
+        cmds.setAttr(shapeNode + '.stageCacheId', stageId.ToLongInt())
+        cmds.connectAttr('time1.outTime', shapeNode + '.time')
+        draw_frame(width, height)
+        results['first_frame'] = default_timer() - start
+
+        counters = get_counters()
+        results['populate_ms'] = counters['vp2PopulateTimeMs']
+        for key, counter in FRAME_COUNTERS.items():
+            results[key] = counters[counter]
+        results['memory'].append(get_memory())
+
+        playback = {key: 0.0 for key in FRAME_COUNTERS}
+        start = default_timer()
+        for frame in range(2, numFrames + 1):
+            cmds.currentTime(frame, update=True)
+            draw_frame(width, height)
+            counters = get_counters()
+            for key, counter in FRAME_COUNTERS.items():
+                playback[key] += counters[counter]
+        playback['time'] = default_timer() - start
+
+        numPlayed = max(1, numFrames - 1)
+        for key in FRAME_COUNTERS:
+            playback[key + '_per_frame'] = playback[key] / numPlayed
+        results['playback'] = playback
+        results['memory'].append(get_memory())
+    finally:
+        mayaUsdLib.RenderStats.Disable()
+        cmds.file(new=True, force=True)
+        cache.Erase(stageId)
+
+    return results
+
+
+def parse_configuration(text):
+    '''
+    Parse a NAME=MESHES,INSTANCES,MATERIALS configuration argument.
+    '''
+    try:
+        name, counts = text.split('=', 1)
+        numMeshes, numInstances, numMaterials = [int(value) for value in counts.split(',')]
+    except ValueError:
+        raise argparse.ArgumentTypeError(
+            'expected NAME=MESHES,INSTANCES,MATERIALS, got "%s"' % text)
+    return name, (numMeshes, numInstances, numMaterials)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description='Benchmark the VP2 render delegate.')
+    parser.add_argument('--config', action='append', type=parse_configuration, default=[],
+                        metavar='NAME=MESHES,INSTANCES,MATERIALS',
+                        help='stage to benchmark, may be repeated (default: %s)'
+                        % ', '.join(sorted(DEFAULT_CONFIGURATIONS)))
+    parser.add_argument('--frames', type=int, default=DEFAULT_FRAMES,
+                        help='number of frames of the playback')
+    parser.add_argument('--width', type=int, default=DEFAULT_WIDTH,
+                        help='width of the offscreen frames')
+    parser.add_argument('--height', type=int, default=DEFAULT_HEIGHT,
+                        help='height of the offscreen frames')
+    parser.add_argument('--output', help='JSON file to write, standard output by default')
+    args = parser.parse_args(argv)
+
+    configurations = dict(args.config) if args.config else DEFAULT_CONFIGURATIONS
+
+    cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+    report = {
+        'maya_version'    : cmds.about(version=True),
+        'mayausd_version' : cmds.pluginInfo('mayaUsdPlugin', query=True, version=True),
+        'usd_version'     : '.'.join(str(value) for value in Usd.GetVersion()),
+        'configurations'  : {},
+    }
+
+    for name in sorted(configurations):
+        numMeshes, numInstances, numMaterials = configurations[name]
+        report['configurations'][name] = run_configuration(
+            numMeshes, numInstances, numMaterials, args.frames, args.width, args.height)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=4, sort_keys=True)
+    else:
+        json.dump(report, sys.stdout, indent=4, sort_keys=True)
+        sys.stdout.write('\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    import maya.standalone
+    maya.standalone.initialize(name='python')
+    try:
+        status = main()
+    finally:
+        maya.standalone.uninitialize()
+    sys.exit(status)
@@ -0,0 +1,86 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "boundsBVH.h"
+
+#include <algorithm>
+#include <numeric>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Maximum number of items of a leaf
+constexpr uint32_t kMaxLeafSize = 4;
+
+} // namespace
+
+HdVP2BoundsBVH::HdVP2BoundsBVH(const std::vector<GfRange3f>& itemBounds)
+{
+    const uint32_t numItems = static_cast<uint32_t>(itemBounds.size());
+    if (numItems == 0) {
+        return;
+    }
+
+    _indices.resize(numItems);
+    std::iota(_indices.begin(), _indices.end(), 0u);
+
+    _nodes.reserve(2 * (numItems / kMaxLeafSize + 1));
+    _BuildNode(itemBounds, 0, numItems);
+}
+
+uint32_t HdVP2BoundsBVH::_BuildNode(
+    const std::vector<GfRange3f>& itemBounds,
+    uint32_t                      first,
+    uint32_t                      count)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    GfRange3f bounds;
+    GfRange3f centers;
+    for (uint32_t i = first; i < first + count; ++i) {
+        const GfRange3f& item = itemBounds[_indices[i]];
+        bounds.UnionWith(item);
+        centers.UnionWith(item.GetMidpoint());
+    }
+    _nodes[nodeIndex]._bounds = bounds;
+
+    // The median split halves the items at each level, the depth stays below the traversal
+    // stack size for any number of items addressable with 32 bits.
+    if (count <= kMaxLeafSize) {
+        _nodes[nodeIndex]._first = first;
+        _nodes[nodeIndex]._count = count;
+        return nodeIndex;
+    }
+
+    const GfVec3f size = centers.GetSize();
+    const int     axis
+        = (size[0] > size[1]) ? (size[0] > size[2] ? 0 : 2) : (size[1] > size[2] ? 1 : 2);
+
+    const uint32_t half = count / 2;
+    const auto     begin = _indices.begin() + first;
+    std::nth_element(
+        begin, begin + half, begin + count, [&itemBounds, axis](uint32_t a, uint32_t b) {
+            return itemBounds[a].GetMidpoint()[axis] < itemBounds[b].GetMidpoint()[axis];
+        });
+
+    _BuildNode(itemBounds, first, half);
+    const uint32_t second = _BuildNode(itemBounds, first + half, count - half);
+    _nodes[nodeIndex]._second = second;
+    return nodeIndex;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
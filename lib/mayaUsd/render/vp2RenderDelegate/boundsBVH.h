@@ -0,0 +1,103 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_BOUNDS_BVH
+#define HD_VP2_BOUNDS_BVH
+
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/ray.h>
+#include <pxr/pxr.h>
+
+#include <cstdint>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Bounding volume hierarchy over a list of bounding boxes, used to cast rays.
+    \class  HdVP2BoundsBVH
+
+    The items are split at the median of their centers along the longest axis of each node. The
+    hierarchy only knows the bounds of the items, the ray is tested against the items themselves
+    by the visitor given to Intersect().
+*/
+class HdVP2BoundsBVH final
+{
+public:
+    HdVP2BoundsBVH() = default;
+    explicit HdVP2BoundsBVH(const std::vector<GfRange3f>& itemBounds);
+
+    //! Return true when the hierarchy has no item.
+    bool IsEmpty() const { return _indices.empty(); }
+
+    //! Return the bounds of all the items.
+    GfRange3f GetBounds() const { return _nodes.empty() ? GfRange3f() : _nodes.front()._bounds; }
+
+    /*! \brief  Visit the items whose bounds are hit by the ray closer than maxDistance.
+
+        The visitor is called as visitor(itemIndex, maxDistance) and may decrease maxDistance to
+        the distance of the hit it found, the items farther than the closest hit are then skipped.
+        Distances are expressed in parameters of the ray.
+    */
+    template <class Visitor>
+    void Intersect(const GfRay& ray, double maxDistance, Visitor&& visitor) const
+    {
+        if (_indices.empty()) {
+            return;
+        }
+
+        uint32_t stack[64];
+        int      stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            const _Node& node = _nodes[stack[--stackSize]];
+
+            double enter = 0.0;
+            double exit = 0.0;
+            if (!ray.Intersect(GfRange3d(node._bounds), &enter, &exit) || enter > maxDistance) {
+                continue;
+            }
+
+            if (node._count > 0) {
+                for (uint32_t i = node._first; i < node._first + node._count; ++i) {
+                    visitor(static_cast<size_t>(_indices[i]), maxDistance);
+                }
+            } else if (stackSize + 2 <= 64) {
+                stack[stackSize++] = node._second;
+                stack[stackSize++] = static_cast<uint32_t>(&node - _nodes.data()) + 1;
+            }
+        }
+    }
+
+private:
+    //! A node is a leaf when _count is not null, its children are otherwise the next node and
+    //! the node at _second.
+    struct _Node
+    {
+        GfRange3f _bounds;
+        uint32_t  _first { 0 };  //!< First index of the items of a leaf
+        uint32_t  _count { 0 };  //!< Number of items of a leaf
+        uint32_t  _second { 0 }; //!< Index of the second child of an inner node
+    };
+
+    uint32_t _BuildNode(const std::vector<GfRange3f>& itemBounds, uint32_t first, uint32_t count);
+
+    std::vector<uint32_t> _indices; //!< Item indices, ordered by leaf
+    std::vector<_Node>    _nodes;   //!< Nodes in depth-first order, the root first
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_BOUNDS_BVH
@@ -15,8 +15,11 @@
 //
 #include "draw_item.h"
 
+#include "bboxBatch.h"
 #include "render_delegate.h"
 
+#include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
+
 #include <pxr/imaging/hd/mesh.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -47,10 +50,14 @@ HdVP2DrawItem::~HdVP2DrawItem()
         auto* const         param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
         MSubSceneContainer* subSceneContainer = param ? param->GetContainer() : nullptr;
         if (subSceneContainer) {
+            HdVP2BBoxBatch* const bboxBatch = param->GetDrawScene().GetBBoxBatch();
             for (const auto& renderItemData : _renderItems) {
                 const auto& sharedRenderItemCounter = renderItemData._sharedRenderItemCounter;
                 if (!sharedRenderItemCounter || (--(*sharedRenderItemCounter)) == 0) {
                     TF_VERIFY(renderItemData._renderItemName == renderItemData._renderItem->name());
+                    if (bboxBatch) {
+                        bboxBatch->Remove(*renderItemData._renderItem);
+                    }
                     subSceneContainer->remove(renderItemData._renderItem->name());
                 }
             }
@@ -55,8 +55,10 @@ public:
         HdGeomSubset _geomSubset;
 
         //! Render item index buffer - use when updating data
-        std::unique_ptr<MHWRender::MIndexBuffer> _indexBuffer;
+        std::shared_ptr<MHWRender::MIndexBuffer> _indexBuffer;
         bool                                     _indexBufferValid { false };
+        //! Whether _indexBuffer is owned by a rendering topology shared among several rprims
+        bool _indexBufferShared { false };
         //! Bounding box of the render item.
         MBoundingBox _boundingBox;
         //! World matrix of the render item.
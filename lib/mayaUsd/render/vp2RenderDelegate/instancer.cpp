@@ -27,6 +27,9 @@
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
+#include <algorithm>
+#include <cstring>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // Define local tokens for the names of the primvars the instancer
@@ -111,14 +114,24 @@ void HdVP2Instancer::_SyncPrimvars()
             HdPrimvarDescriptorVector primvars
                 = GetDelegate()->GetPrimvarDescriptors(id, HdInterpolationInstance);
 
+            // Track which primvar elements changed so the transforms of the other instances
+            // can be reused.
+            _changedElements.clear();
+            _allElementsChanged = false;
+            ++_primvarVersion;
+
             for (HdPrimvarDescriptor const& pv : primvars) {
                 if (HdChangeTracker::IsPrimvarDirty(dirtyBits, id, pv.name)) {
                     VtValue value = GetDelegate()->Get(id, pv.name);
                     if (!value.IsEmpty()) {
+                        HdVtBufferSource* source = new HdVtBufferSource(pv.name, value);
                         if (_primvarMap.count(pv.name) > 0) {
+                            _UpdateChangedElements(_primvarMap[pv.name], *source);
                             delete _primvarMap[pv.name];
+                        } else {
+                            _UpdateChangedElements(nullptr, *source);
                         }
-                        _primvarMap[pv.name] = new HdVtBufferSource(pv.name, value);
+                        _primvarMap[pv.name] = source;
                     }
                 }
             }
@@ -129,6 +142,112 @@ void HdVP2Instancer::_SyncPrimvars()
     }
 }
 
+/*! \brief  Mark the elements which differ between the previous and the new value of a primvar.
+ */
+void HdVP2Instancer::_UpdateChangedElements(
+    const HdVtBufferSource* oldSource,
+    const HdVtBufferSource& newSource)
+{
+    if (_allElementsChanged) {
+        return;
+    }
+
+    const size_t numElements = newSource.GetNumElements();
+    if (!oldSource || oldSource->GetTupleType() != newSource.GetTupleType()
+        || oldSource->GetNumElements() != numElements) {
+        _allElementsChanged = true;
+        return;
+    }
+
+    const size_t         elementSize = HdDataSizeOfTupleType(newSource.GetTupleType());
+    const uint8_t* const oldData = static_cast<const uint8_t*>(oldSource->GetData());
+    const uint8_t* const newData = static_cast<const uint8_t*>(newSource.GetData());
+
+    _changedElements.resize(std::max(_changedElements.size(), numElements), false);
+    for (size_t i = 0; i < numElements; ++i) {
+        const size_t offset = i * elementSize;
+        if (memcmp(oldData + offset, newData + offset, elementSize) != 0) {
+            _changedElements[i] = true;
+        }
+    }
+}
+
+namespace {
+
+//! Instance primvars consumed by the instancer, null when not authored.
+struct _InstancePrimvars
+{
+    const HdVtBufferSource* _translate { nullptr };
+    const HdVtBufferSource* _rotate { nullptr };
+    const HdVtBufferSource* _scale { nullptr };
+    const HdVtBufferSource* _instanceTransform { nullptr };
+};
+
+/*! \brief  Compute the transform of one instance.
+
+    The transform is computed by:
+    instancerTransform * translate(index) * rotate(index) *
+    scale(index) * instanceTransform(index)
+    If any transform isn't provided, it's assumed to be the identity.
+*/
+GfMatrix4d _ComputeInstanceTransform(
+    const _InstancePrimvars& primvars,
+    const GfMatrix4d&        instancerTransform,
+    int                      index)
+{
+    GfMatrix4d transform = instancerTransform;
+
+    // "translate" holds a translation vector for each index.
+    if (primvars._translate) {
+        GfVec3f translate;
+        if (HdVP2BufferSampler(*primvars._translate).Sample(index, &translate)) {
+            GfMatrix4d translateMat(1);
+            translateMat.SetTranslate(GfVec3d(translate));
+            transform = translateMat * transform;
+        }
+    }
+
+    // "rotate" holds a quaternion in <real, i, j, k> format for each index.
+    if (primvars._rotate) {
+        HdVP2BufferSampler sampler(*primvars._rotate);
+        GfQuath            quath;
+        if (sampler.Sample(index, &quath)) {
+            GfMatrix4d rotateMat(1);
+            rotateMat.SetRotate(quath);
+            transform = rotateMat * transform;
+        } else {
+            GfVec4f quat;
+            if (sampler.Sample(index, &quat)) {
+                GfMatrix4d rotateMat(1);
+                rotateMat.SetRotate(GfQuatd(quat[0], quat[1], quat[2], quat[3]));
+                transform = rotateMat * transform;
+            }
+        }
+    }
+
+    // "scale" holds an axis-aligned scale vector for each index.
+    if (primvars._scale) {
+        GfVec3f scale;
+        if (HdVP2BufferSampler(*primvars._scale).Sample(index, &scale)) {
+            GfMatrix4d scaleMat(1);
+            scaleMat.SetScale(GfVec3d(scale));
+            transform = scaleMat * transform;
+        }
+    }
+
+    // "instanceTransform" holds a 4x4 transform matrix for each index.
+    if (primvars._instanceTransform) {
+        GfMatrix4d instanceTransform;
+        if (HdVP2BufferSampler(*primvars._instanceTransform).Sample(index, &instanceTransform)) {
+            transform = instanceTransform * transform;
+        }
+    }
+
+    return transform;
+}
+
+} // namespace
+
 /*! \brief  Computes all instance transforms for the provided prototype id.
 
     Taking into account the scene delegate's instancerTransform and the
@@ -146,76 +265,65 @@ VtMatrix4dArray HdVP2Instancer::ComputeInstanceTransforms(SdfPath const& prototy
 
     _SyncPrimvars();
 
-    // The transforms for this level of instancer are computed by:
-    // foreach(index : indices) {
-    //     instancerTransform * translate(index) * rotate(index) *
-    //     scale(index) * instanceTransform(index)
-    // }
-    // If any transform isn't provided, it's assumed to be the identity.
-
     GfMatrix4d instancerTransform = GetDelegate()->GetInstancerTransform(GetId());
     VtIntArray instanceIndices = GetDelegate()->GetInstanceIndices(GetId(), prototypeId);
 
-    VtMatrix4dArray transforms(instanceIndices.size());
-    for (size_t i = 0; i < instanceIndices.size(); ++i) {
-        transforms[i] = instancerTransform;
-    }
-
-    // "translate" holds a translation vector for each index.
-    if (_primvarMap.count(_tokens->translate) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[_tokens->translate]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfVec3f translate;
-            if (sampler.Sample(instanceIndices[i], &translate)) {
-                GfMatrix4d translateMat(1);
-                translateMat.SetTranslate(GfVec3d(translate));
-                transforms[i] = translateMat * transforms[i];
-            }
+    auto findPrimvar = [this](const TfToken& name) -> const HdVtBufferSource* {
+        auto it = _primvarMap.find(name);
+        return it != _primvarMap.end() ? it->second : nullptr;
+    };
+
+    _InstancePrimvars primvars;
+    primvars._translate = findPrimvar(_tokens->translate);
+    primvars._rotate = findPrimvar(_tokens->rotate);
+    primvars._scale = findPrimvar(_tokens->scale);
+    primvars._instanceTransform = findPrimvar(_tokens->instanceTransform);
+
+    _PrototypeTransforms prototypeTransforms;
+    {
+        std::lock_guard<std::mutex> lock(_prototypeTransformsLock);
+        auto                        it = _prototypeTransforms.find(prototypeId);
+        if (it != _prototypeTransforms.end()) {
+            prototypeTransforms = it->second;
         }
     }
 
-    // "rotate" holds a quaternion in <real, i, j, k> format for each index.
-    if (_primvarMap.count(_tokens->rotate) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[_tokens->rotate]);
+    // The previous transforms can be reused when only some primvar elements changed since they
+    // were computed. VtArray comparison returns early when both arrays share the same data.
+    const bool sameInstances = prototypeTransforms._primvarVersion != 0
+        && prototypeTransforms._instancerTransform == instancerTransform
+        && prototypeTransforms._instanceIndices == instanceIndices;
+
+    VtMatrix4dArray transforms;
+    if (sameInstances && prototypeTransforms._primvarVersion == _primvarVersion) {
+        transforms = prototypeTransforms._transforms;
+    } else if (
+        sameInstances && prototypeTransforms._primvarVersion + 1 == _primvarVersion
+        && !_allElementsChanged) {
+        transforms = prototypeTransforms._transforms;
         for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfQuath quath;
-            if (sampler.Sample(instanceIndices[i], &quath)) {
-                GfMatrix4d rotateMat(1);
-                rotateMat.SetRotate(quath);
-                transforms[i] = rotateMat * transforms[i];
-            } else {
-                GfVec4f quat;
-                if (sampler.Sample(instanceIndices[i], &quat)) {
-                    GfMatrix4d rotateMat(1);
-                    rotateMat.SetRotate(GfQuatd(quat[0], quat[1], quat[2], quat[3]));
-                    transforms[i] = rotateMat * transforms[i];
-                }
+            const int index = instanceIndices[i];
+            if (index >= 0 && static_cast<size_t>(index) < _changedElements.size()
+                && _changedElements[index]) {
+                transforms[i] = _ComputeInstanceTransform(primvars, instancerTransform, index);
             }
         }
-    }
-
-    // "scale" holds an axis-aligned scale vector for each index.
-    if (_primvarMap.count(_tokens->scale) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[_tokens->scale]);
+    } else {
+        transforms.resize(instanceIndices.size());
         for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfVec3f scale;
-            if (sampler.Sample(instanceIndices[i], &scale)) {
-                GfMatrix4d scaleMat(1);
-                scaleMat.SetScale(GfVec3d(scale));
-                transforms[i] = scaleMat * transforms[i];
-            }
+            transforms[i]
+                = _ComputeInstanceTransform(primvars, instancerTransform, instanceIndices[i]);
         }
     }
 
-    // "instanceTransform" holds a 4x4 transform matrix for each index.
-    if (_primvarMap.count(_tokens->instanceTransform) > 0) {
-        HdVP2BufferSampler sampler(*_primvarMap[_tokens->instanceTransform]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfMatrix4d instanceTransform;
-            if (sampler.Sample(instanceIndices[i], &instanceTransform)) {
-                transforms[i] = instanceTransform * transforms[i];
-            }
-        }
+    if (prototypeTransforms._primvarVersion != _primvarVersion || !sameInstances) {
+        prototypeTransforms._primvarVersion = _primvarVersion;
+        prototypeTransforms._instancerTransform = instancerTransform;
+        prototypeTransforms._instanceIndices = instanceIndices;
+        prototypeTransforms._transforms = transforms;
+
+        std::lock_guard<std::mutex> lock(_prototypeTransformsLock);
+        _prototypeTransforms[prototypeId] = std::move(prototypeTransforms);
     }
 
     if (GetParentId().IsEmpty()) {
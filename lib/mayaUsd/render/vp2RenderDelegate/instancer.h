@@ -18,13 +18,18 @@
 #ifndef HD_VP2_INSTANCER
 #define HD_VP2_INSTANCER
 
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
 #include <pxr/imaging/hd/instancer.h>
 #include <pxr/imaging/hd/vtBufferSource.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -34,6 +39,10 @@ PXR_NAMESPACE_OPEN_SCOPE
     Nested instancing can be handled by recursion, and by taking the
     cartesian product of the transform arrays at each nesting level, to
     create a flattened transform array.
+
+    The transforms computed for each prototype are kept. When the instancer
+    primvars change for a few instances only, e.g. when moving one point
+    instance, only the transforms of the changed instances are recomputed.
 */
 class HdVP2Instancer final : public HdInstancer
 {
@@ -50,10 +59,36 @@ public:
 
 private:
     void _SyncPrimvars();
+    void
+    _UpdateChangedElements(const HdVtBufferSource* oldSource, const HdVtBufferSource& newSource);
 
     //! Mutex guard for _SyncPrimvars().
     std::mutex _instanceLock;
 
+    //! Transforms of the instances of a prototype at this level of instancing.
+    struct _PrototypeTransforms
+    {
+        size_t          _primvarVersion { 0 }; //!< Value of _primvarVersion when computed
+        GfMatrix4d      _instancerTransform;   //!< Instancer transform when computed
+        VtIntArray      _instanceIndices;      //!< Instance indices of the prototype
+        VtMatrix4dArray _transforms;           //!< One transform per instance index
+    };
+
+    //! Mutex guard for _prototypeTransforms.
+    std::mutex _prototypeTransformsLock;
+
+    //! Transforms last computed for each prototype
+    std::unordered_map<SdfPath, _PrototypeTransforms, SdfPath::Hash> _prototypeTransforms;
+
+    //! Incremented every time primvars are pulled
+    size_t _primvarVersion { 1 };
+
+    //! Primvar elements changed by the last pull, ignored when _allElementsChanged is true
+    std::vector<bool> _changedElements;
+
+    //! Whether the last pull changed the number or the type of primvar elements
+    bool _allElementsChanged { true };
+
     /*! Map of the latest primvar data for this instancer, keyed by
         primvar name. Primvar values are VtValue, an any-type; they are
         interpreted at consumption time (here, in ComputeInstanceTransforms).
@@ -16,6 +16,7 @@
 #include "material.h"
 
 #include "debugCodes.h"
+#include "materialDiskCache.h"
 #include "pxr/usd/sdr/registry.h"
 #include "pxr/usd/sdr/shaderNode.h"
 #include "render_delegate.h"
@@ -32,8 +33,11 @@
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/getenv.h>
 #include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/work/detachedTask.h>
+#include <pxr/imaging/hd/perfLog.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
 #ifdef WANT_MATERIALX_BUILD
@@ -44,6 +48,7 @@
 #include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/usdHydra/tokens.h>
+#include <pxr/usdImaging/usdImaging/delegate.h>
 #include <pxr/usdImaging/usdImaging/textureUtils.h>
 #include <pxr/usdImaging/usdImaging/tokens.h>
 
@@ -63,6 +68,7 @@
 #ifdef WANT_MATERIALX_BUILD
 #include <mayaUsd/render/MaterialXGenOgsXml/OgsFragment.h>
 #include <mayaUsd/render/MaterialXGenOgsXml/OgsXmlGenerator.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <MaterialXCore/Document.h>
 #include <MaterialXFormat/File.h>
@@ -82,9 +88,12 @@
 #include <ghc/filesystem.hpp>
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 
 #if PXR_VERSION >= 2102
 #include <pxr/imaging/hdSt/udimTextureObject.h>
@@ -104,6 +113,39 @@ namespace mx = MaterialX;
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_TEXTURE_MEMORY_BUDGET,
+    0,
+    "Memory budget in megabytes for the textures loaded by the VP2 render delegate. When "
+    "exceeded, the least recently used textures are reloaded at a lower resolution, and at a "
+    "higher resolution again once they fit. A value of 0 disables the budget.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_PROGRESSIVE_TEXTURE_LOADING,
+    false,
+    "When asynchronous texture loading is enabled, show a low resolution preview of each texture "
+    "first and load the full resolution on a worker thread.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_TEXTURE_UPLOAD_BUDGET,
+    64,
+    "Maximum number of megabytes of full resolution texels uploaded to VP2 per frame when "
+    "progressive texture loading is enabled. A value of 0 removes the limit.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_SHARED_MATERIAL_SHADERS,
+    true,
+    "Share a single shader instance between the materials whose networks and parameter values are "
+    "identical, instead of cloning one shader instance per material.");
+
+#ifdef WANT_MATERIALX_BUILD
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_ASYNC_MATERIALX_GENERATION,
+    true,
+    "Generate the OGS fragments of MaterialX materials on worker threads in interactive sessions. "
+    "The materials are drawn with the fallback shader until their fragment is generated.");
+#endif
+
 static bool _IsDisabledAsyncTextureLoading()
 {
     static const MString kOptionVarName(MayaUsdOptionVars->DisableAsyncTextureLoading.GetText());
@@ -210,6 +252,8 @@ TF_DEFINE_PRIVATE_TOKENS(
     (Float4ToFloatW)
     (Float4ToFloat3)
 
+    (DecodeOctahedralNormal)
+
     (UsdPrimvarReader_color)
     (UsdPrimvarReader_vector)
 
@@ -345,9 +389,19 @@ struct _MaterialXData
         _FixLibraryTangentInputs(_mtlxLibrary);
 
         mx::OgsXmlGenerator::setUseLightAPI(MAYA_LIGHTAPI_VERSION_2);
+
+        if (HdVP2MaterialDiskCache::IsEnabled()) {
+            std::vector<std::string> directories;
+            for (const mx::FilePath& path : _mtlxSearchPath) {
+                directories.push_back(path.asString());
+            }
+            _mtlxLibraryFingerprint
+                = HdVP2MaterialDiskCache::ComputeLibraryFingerprint(directories);
+        }
     }
-    MaterialX::FileSearchPath _mtlxSearchPath; //!< MaterialX library search path
-    MaterialX::DocumentPtr    _mtlxLibrary;    //!< MaterialX library
+    MaterialX::FileSearchPath _mtlxSearchPath;         //!< MaterialX library search path
+    MaterialX::DocumentPtr    _mtlxLibrary;            //!< MaterialX library
+    std::string               _mtlxLibraryFingerprint; //!< Library contents, for the disk cache
 
 private:
     void _FixLibraryTangentInputs(MaterialX::DocumentPtr& mtlxLibrary);
@@ -362,6 +416,69 @@ _MaterialXData& _GetMaterialXData()
     return *materialXData;
 }
 
+bool _IsAsyncMaterialXGenerationEnabled()
+{
+    // Idle tasks, which register the fragments with VP2, are not processed in batch sessions.
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_ASYNC_MATERIALX_GENERATION)
+        && MGlobal::mayaState() == MGlobal::kInteractive;
+    return enabled;
+}
+
+/*! \brief  Generation of the OGS fragment of a MaterialX network on a worker thread.
+
+    Only _done is accessed concurrently, the other members are written by the worker thread
+    before _done is set, or accessed from the main thread only.
+ */
+struct _MaterialXFragmentTask
+{
+    std::atomic_bool                   _done { false };
+    HdVP2MaterialDiskCache::Entry      _fragmentData;     //!< The generated fragment, once done
+    std::string                        _error;            //!< Error of a failed generation
+    std::string                        _materialName;     //!< Material starting the generation
+    bool                               _errorReported { false };
+    std::unordered_set<HdVP2Material*> _waitingMaterials; //!< Materials to sync once done
+};
+
+//! Fragment generations, by shader cache id. Accessed from the main thread only. Failed
+//! generations are kept so that they are not started again.
+std::unordered_map<TfToken, std::shared_ptr<_MaterialXFragmentTask>, TfToken::HashFunctor>
+    _materialXFragmentTasks;
+
+/*! \brief  Generates the OGS fragment of a MaterialX material node.
+
+    Each call uses its own GenContext and doesn't query Maya, so it can run on any thread. Throws
+    a MaterialX exception on failure.
+ */
+void _GenerateMaterialXFragment(
+    const mx::NodePtr&                             materialNode,
+    const MaterialXMaya::OgsFragment::SpecularEnv& specularEnv,
+    HdVP2MaterialDiskCache::Entry&                 fragmentData)
+{
+    MaterialXMaya::OgsFragment ogsFragment(
+        materialNode, _GetMaterialXData()._mtlxSearchPath, specularEnv);
+
+    // Explore the fragment for primvars:
+    mx::ShaderPtr            shader = ogsFragment.getShader();
+    const mx::VariableBlock& vertexInputs
+        = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
+    for (size_t i = 0; i < vertexInputs.size(); ++i) {
+        const mx::ShaderPort* variable = vertexInputs[i];
+        // Position is always assumed.
+        // Tangent will be generated in the vertex shader using a utility fragment
+        if (variable->getName() == mx::HW::T_IN_NORMAL) {
+            fragmentData._requiredPrimvars.push_back(HdTokens->normals);
+        }
+    }
+
+    fragmentData._fragmentName = ogsFragment.getFragmentName();
+    fragmentData._fragmentSource = ogsFragment.getFragmentSource();
+    fragmentData._lightRigName = ogsFragment.getLightRigName();
+    fragmentData._lightRigSource = ogsFragment.getLightRigSource();
+    fragmentData._pathInputMap.assign(
+        ogsFragment.getPathInputMap().begin(), ogsFragment.getPathInputMap().end());
+    fragmentData._isTransparent = ogsFragment.isTransparent();
+}
+
 //! Return true if that node parameter has topological impact on the generated code.
 //
 // Swizzle and geompropvalue nodes are known to have an attribute that affects
@@ -1062,6 +1179,19 @@ bool _IsTransparent(const HdMaterialNetwork& network)
     return false;
 }
 
+//! Return true if materials with the same network and parameter values can share the shader
+//! instance. Textures are loaded asynchronously for each material, which modifies the shader
+//! instance after its parameters are set.
+bool _CanShareShaderInstance(const HdMaterialNetwork& network)
+{
+    for (const HdMaterialNode& node : network.nodes) {
+        if (_IsUsdUVTexture(node)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //! Helper utility function to convert Hydra texture addressing token to VP2 enum.
 MHWRender::MSamplerState::TextureAddress _ConvertToTextureSamplerAddressEnum(const TfToken& token)
 {
@@ -1163,8 +1293,74 @@ MHWRender::MSamplerStateDesc _GetSamplerStateDesc(const HdMaterialNode& node)
     return desc;
 }
 
-MHWRender::MTexture*
-_LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& uvScaleOffset)
+//! Name used to register a texture in the VP2 texture manager, unique per resolution clamp.
+std::string _GetTextureName(const std::string& path, unsigned int maxDimension)
+{
+    return maxDimension > 0 ? path + ".max" + std::to_string(maxDimension) : path;
+}
+
+//! Textures are never reduced below this resolution by the texture memory budget.
+const unsigned int kMinBudgetTextureDimension = 128;
+
+//! Return the texture memory budget in bytes, 0 if there is no budget.
+size_t _GetTextureMemoryBudget()
+{
+    static const size_t budget
+        = static_cast<size_t>(std::max(TfGetEnvSetting(MAYAUSD_VP2_TEXTURE_MEMORY_BUDGET), 0))
+        * 1024 * 1024;
+    return budget;
+}
+
+//! Resolution of the preview shown while the full resolution of a texture is being loaded.
+const unsigned int kPreviewTextureDimension = 128;
+
+bool _IsProgressiveTextureLoadingEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_PROGRESSIVE_TEXTURE_LOADING);
+    return enabled;
+}
+
+bool _IsShaderSharingEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_SHARED_MATERIAL_SHADERS);
+    return enabled;
+}
+
+//! Return the per-frame texture upload budget in bytes, 0 if there is no budget.
+size_t _GetTextureUploadBudget()
+{
+    static const size_t budget
+        = static_cast<size_t>(std::max(TfGetEnvSetting(MAYAUSD_VP2_TEXTURE_UPLOAD_BUDGET), 0))
+        * 1024 * 1024;
+    return budget;
+}
+
+//! Estimate the GPU memory used by a texture, including its mipmaps.
+size_t _GetTextureSizeInBytes(MHWRender::MTexture* texture, unsigned int& dimension)
+{
+    dimension = 0;
+    if (!texture) {
+        return 0;
+    }
+
+    MHWRender::MTextureDescription desc;
+    texture->textureDescription(desc);
+    dimension = std::max(desc.fWidth, desc.fHeight);
+
+    size_t size = static_cast<size_t>(desc.fBytesPerSlice) * std::max(desc.fDepth, 1u)
+        * std::max(desc.fArraySlices, 1u);
+    // A full mipmap chain adds a third of the size of the top level.
+    if (desc.fMipmaps != 1) {
+        size += size / 3;
+    }
+    return size;
+}
+
+MHWRender::MTexture* _LoadUdimTexture(
+    const std::string& path,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset,
+    unsigned int       maxDimension)
 {
     /*
         For this method to work path needs to be an absolute file path, not an asset path.
@@ -1200,7 +1396,8 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
         return nullptr;
     }
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
+    const std::string    textureName = _GetTextureName(path, maxDimension);
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
     if (texture) {
         return texture;
     }
@@ -1222,6 +1419,12 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
     unsigned int maxHeight = 0;
     renderer->GPUmaximumOutputTargetSize(maxWidth, maxHeight);
 
+    // A lower resolution may have been requested to stay within the texture memory budget.
+    if (maxDimension > 0) {
+        maxWidth = std::min(maxWidth, maxDimension);
+        maxHeight = std::min(maxHeight, maxDimension);
+    }
+
     // Open the first image and get it's resolution. Assuming that all the tiles have the same
     // resolution, warn the user if Maya's tiled texture implementation is going to result in
     // a loss of texture data.
@@ -1248,8 +1451,6 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
                 path.c_str());
     }
 
-    MString textureName(
-        path.c_str()); // used for caching, using the string with <UDIM> in it is fine
     MStringArray tilePaths;
     MFloatArray  tilePositions;
     for (auto& tile : tiles) {
@@ -1282,7 +1483,7 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
     MColor       undefinedColor(0.0f, 1.0f, 0.0f, 1.0f);
     MStringArray failedTilePaths;
     texture = textureMgr->acquireTiledTexture(
-        textureName,
+        textureName.c_str(), // used for caching, using the string with <UDIM> in it is fine
         tilePaths,
         tilePositions,
         undefinedColor,
@@ -1324,37 +1525,24 @@ MHWRender::MTexture* _GenerateFallbackTexture(
     return textureMgr->acquireTexture(path.c_str(), desc, texels.data());
 }
 
-//! Load texture from the specified path
-MHWRender::MTexture* _LoadTexture(
-    const std::string& path,
-    bool               hasFallbackColor,
-    const GfVec4f&     fallbackColor,
-    bool&              isColorSpaceSRGB,
-    MFloatArray&       uvScaleOffset)
+//! CPU-side texels of a texture, read from an image file before being uploaded to VP2.
+struct _TextureData
 {
-    MProfilingScope profilingScope(
-        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
-
-    // If it is a UDIM texture we need to modify the path before calling OpenForReading
-#if PXR_VERSION >= 2102
-    if (HdStIsSupportedUdimTexture(path))
-        return _LoadUdimTexture(path, isColorSpaceSRGB, uvScaleOffset);
-#else
-    if (GlfIsSupportedUdimTexture(path))
-        return _LoadUdimTexture(path, isColorSpaceSRGB, uvScaleOffset);
-#endif
+    MHWRender::MTextureDescription _desc;
+    std::vector<unsigned char>     _texels;
+    bool                           _isColorSpaceSRGB { false };
+};
 
-    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
-    MHWRender::MTextureManager* const textureMgr
-        = renderer ? renderer->getTextureManager() : nullptr;
-    if (!TF_VERIFY(textureMgr)) {
-        return nullptr;
-    }
+/*! \brief  Read the texels of the image at the specified path, converting them to a format
+            supported by VP2.
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
-    if (texture) {
-        return texture;
-    }
+    No VP2 API is called, so this function can be executed on a worker thread. Returns false if the
+    image can't be opened. The texels are left empty if the image format isn't supported.
+*/
+bool _ReadTextureData(const std::string& path, unsigned int maxDimension, _TextureData& data)
+{
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "ReadTexture", path.c_str());
 
 #if PXR_VERSION >= 2102
     HioImageSharedPtr image = HioImage::OpenForReading(path);
@@ -1363,11 +1551,7 @@ MHWRender::MTexture* _LoadTexture(
 #endif
 
     if (!TF_VERIFY(image, "Unable to create an image from %s", path.c_str())) {
-        if (!hasFallbackColor) {
-            return nullptr;
-        }
-        // Create a 1x1 texture of the fallback color, if it was specified:
-        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+        return false;
     }
 
     // This image is used for loading pixel data from usdz only and should
@@ -1391,6 +1575,15 @@ MHWRender::MTexture* _LoadTexture(
 #endif
     spec.flipped = false;
 
+    // Read a lower mip level if requested to stay within the texture memory budget. The image
+    // is resized while being read since the storage size differs from the image size.
+    if (maxDimension > 0) {
+        while (std::max(spec.width, spec.height) > static_cast<int>(maxDimension)) {
+            spec.width = std::max(1, spec.width / 2);
+            spec.height = std::max(1, spec.height / 2);
+        }
+    }
+
     const int bpp = image->GetBytesPerPixel();
     const int bytesPerRow = spec.width * bpp;
     const int bytesPerSlice = bytesPerRow * spec.height;
@@ -1399,7 +1592,7 @@ MHWRender::MTexture* _LoadTexture(
     spec.data = storage.data();
 
     if (!image->Read(spec)) {
-        return nullptr;
+        return true;
     }
 
     MHWRender::MTextureDescription desc;
@@ -1419,21 +1612,21 @@ MHWRender::MTexture* _LoadTexture(
     // Single Channel
     case HioFormatFloat32:
         desc.fFormat = MHWRender::kR32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case HioFormatFloat16:
         desc.fFormat = MHWRender::kR16_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case HioFormatUNorm8:
         desc.fFormat = MHWRender::kR8_UNORM;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
 
     // Dual channel (quite rare, but seen with mono + alpha files)
     case HioFormatFloat32Vec2:
         desc.fFormat = MHWRender::kR32G32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case HioFormatFloat16Vec2: {
         // R16G16 is not supported by VP2. Converted to R16G16B16A16.
@@ -1459,7 +1652,7 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        data._texels = std::move(texels);
         break;
     }
     case HioFormatUNorm8Vec2:
@@ -1483,15 +1676,15 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        data._texels = std::move(texels);
+        data._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 3-Channel
     case HioFormatFloat32Vec3:
         desc.fFormat = MHWRender::kR32G32B32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case HioFormatFloat16Vec3: {
         // R16G16B16 is not supported by VP2. Converted to R16G16B16A16.
@@ -1522,12 +1715,12 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        data._texels = std::move(texels);
         break;
     }
     case HioFormatFloat16Vec4:
         desc.fFormat = MHWRender::kR16G16B16A16_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec3:
     case HioFormatUNorm8Vec3srgb: {
@@ -1550,21 +1743,21 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        data._texels = std::move(texels);
+        data._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 4-Channel
     case HioFormatFloat32Vec4:
         desc.fFormat = MHWRender::kR32G32B32A32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec4:
     case HioFormatUNorm8Vec4srgb:
         desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        data._texels = std::move(storage);
         break;
     default:
         TF_WARN(
@@ -1581,12 +1774,12 @@ MHWRender::MTexture* _LoadTexture(
             desc.fFormat = MHWRender::kR32_FLOAT;
         else if (spec.type == GL_HALF_FLOAT)
             desc.fFormat = MHWRender::kR16_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     case GL_RGB:
         if (spec.type == GL_FLOAT) {
             desc.fFormat = MHWRender::kR32G32B32_FLOAT;
-            texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+            data._texels = std::move(storage);
         } else if (spec.type == GL_HALF_FLOAT) {
             // R16G16B16 is not supported by VP2. Converted to R16G16B16A16.
             constexpr int bpp_8 = 8;
@@ -1616,7 +1809,7 @@ MHWRender::MTexture* _LoadTexture(
                 }
             }
 
-            texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+            data._texels = std::move(texels);
         } else {
             // R8G8B8 is not supported by VP2. Converted to R8G8B8A8.
             constexpr int bpp_4 = 4;
@@ -1637,8 +1830,8 @@ MHWRender::MTexture* _LoadTexture(
                 }
             }
 
-            texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-            isColorSpaceSRGB = image->IsColorSpaceSRGB();
+            data._texels = std::move(texels);
+            data._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         }
         break;
     case GL_RGBA:
@@ -1648,15 +1841,79 @@ MHWRender::MTexture* _LoadTexture(
             desc.fFormat = MHWRender::kR16G16B16A16_FLOAT;
         } else {
             desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
-            isColorSpaceSRGB = image->IsColorSpaceSRGB();
+            data._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         }
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        data._texels = std::move(storage);
         break;
     default: break;
     }
 #endif
 
-    return texture;
+    data._desc = desc;
+    return true;
+}
+
+bool _IsUdimTexture(const std::string& path)
+{
+#if PXR_VERSION >= 2102
+    return HdStIsSupportedUdimTexture(path);
+#else
+    return GlfIsSupportedUdimTexture(path);
+#endif
+}
+
+//! Upload texels to a new VP2 texture. This function must be called from the main thread.
+MHWRender::MTexture* _UploadTextureData(
+    MHWRender::MTextureManager* const textureMgr,
+    const std::string&                textureName,
+    const _TextureData&               data)
+{
+    if (data._texels.empty()) {
+        return nullptr;
+    }
+    return textureMgr->acquireTexture(textureName.c_str(), data._desc, data._texels.data());
+}
+
+//! Load texture from the specified path
+MHWRender::MTexture* _LoadTexture(
+    const std::string& path,
+    bool               hasFallbackColor,
+    const GfVec4f&     fallbackColor,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset,
+    unsigned int       maxDimension)
+{
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+
+    // If it is a UDIM texture we need to modify the path before calling OpenForReading
+    if (_IsUdimTexture(path))
+        return _LoadUdimTexture(path, isColorSpaceSRGB, uvScaleOffset, maxDimension);
+
+    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+    MHWRender::MTextureManager* const textureMgr
+        = renderer ? renderer->getTextureManager() : nullptr;
+    if (!TF_VERIFY(textureMgr)) {
+        return nullptr;
+    }
+
+    const std::string    textureName = _GetTextureName(path, maxDimension);
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
+    if (texture) {
+        return texture;
+    }
+
+    _TextureData data;
+    if (!_ReadTextureData(path, maxDimension, data)) {
+        if (!hasFallbackColor) {
+            return nullptr;
+        }
+        // Create a 1x1 texture of the fallback color, if it was specified:
+        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+    }
+
+    isColorSpaceSRGB = data._isColorSpaceSRGB;
+    return _UploadTextureData(textureMgr, textureName, data);
 }
 
 TfToken MayaDescriptorToToken(const MVertexBufferDescriptor& descriptor)
@@ -1670,7 +1927,11 @@ TfToken MayaDescriptorToToken(const MVertexBufferDescriptor& descriptor)
     switch (descriptor.semantic()) {
     case MGeometry::kPosition: token = HdTokens->points; break;
     case MGeometry::kNormal: token = HdTokens->normals; break;
-    case MGeometry::kTexture: break;
+    case MGeometry::kTexture:
+        if (descriptor.name() == HdVP2Tokens->octahedralNormals.GetText()) {
+            token = HdVP2Tokens->octahedralNormals;
+        }
+        break;
     case MGeometry::kColor: token = HdTokens->displayColor; break;
     case MGeometry::kTangent: token = _tokens->Computed; break;
     case MGeometry::kBitangent: token = _tokens->Computed; break;
@@ -1691,12 +1952,14 @@ public:
         HdSceneDelegate*   sceneDelegate,
         const std::string& path,
         bool               hasFallbackColor,
-        const GfVec4f&     fallbackColor)
+        const GfVec4f&     fallbackColor,
+        unsigned int       maxDimension)
         : _parent(parent)
         , _sceneDelegate(sceneDelegate)
         , _path(path)
         , _fallbackColor(fallbackColor)
         , _hasFallbackColor(hasFallbackColor)
+        , _maxDimension(maxDimension)
     {
     }
 
@@ -1730,9 +1993,11 @@ public:
         auto ret = MGlobal::executeTaskOnIdle(
             [](void* data) {
                 auto* task = static_cast<HdVP2Material::TextureLoadingTask*>(data);
-                task->_Load();
-                // Once it is done, free the memory.
-                delete task;
+                // Once it is done, free the memory. A task refining a preview deletes itself
+                // once the full resolution is uploaded.
+                if (task->_Load()) {
+                    delete task;
+                }
             },
             this);
         return ret == MStatus::kSuccess;
@@ -1747,20 +2012,125 @@ public:
         return !_started.load();
     }
 
+    //! Start a new frame of full resolution uploads. Must be called from the main thread.
+    static void ResetUploadBudget()
+    {
+        _uploadedBytes = 0;
+
+        bool hasPendingUploads = false;
+        {
+            std::lock_guard<std::mutex> lock(_uploadMutex);
+            hasPendingUploads = !_pendingUploads.empty();
+        }
+        if (hasPendingUploads) {
+            MGlobal::executeTaskOnIdle(_ProcessPendingUploads, nullptr);
+        }
+    }
+
 private:
-    void _Load()
+    //! Return true when the task is complete and can be deleted.
+    bool _Load()
     {
         if (_terminated) {
-            return;
+            return true;
         }
+
+        // UDIM atlases are built from several images and are always loaded in one pass.
+        const bool isProgressive = _IsProgressiveTextureLoadingEnabled() && !_IsUdimTexture(_path)
+            && (_maxDimension == 0 || _maxDimension > kPreviewTextureDimension);
+        const unsigned int loadDimension = isProgressive ? kPreviewTextureDimension : _maxDimension;
+
         bool        isSRGB = false;
         MFloatArray uvScaleOffset;
-        auto*       texture
-            = _LoadTexture(_path, _hasFallbackColor, _fallbackColor, isSRGB, uvScaleOffset);
+        auto*       texture = _LoadTexture(
+            _path, _hasFallbackColor, _fallbackColor, isSRGB, uvScaleOffset, loadDimension);
+        if (_terminated) {
+            return true;
+        }
+        if (!_parent->_UpdateLoadedTexture(
+                _sceneDelegate,
+                _path,
+                texture,
+                isSRGB,
+                uvScaleOffset,
+                loadDimension,
+                isProgressive && texture)) {
+            return true;
+        }
+
+        // The preview is displayed, read the full resolution on a worker thread.
+        WorkRunDetachedTask([this]() {
+            if (!_terminated) {
+                _ReadTextureData(_path, _maxDimension, _fullResolutionData);
+            }
+            {
+                std::lock_guard<std::mutex> lock(_uploadMutex);
+                _pendingUploads.push_back(this);
+            }
+            MGlobal::executeTaskOnIdle(_ProcessPendingUploads, nullptr);
+        });
+        return false;
+    }
+
+    //! Upload the full resolution texels which have been read on a worker thread.
+    void _Upload()
+    {
         if (_terminated) {
             return;
         }
-        _parent->_UpdateLoadedTexture(_sceneDelegate, _path, texture, isSRGB, uvScaleOffset);
+
+        MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+        MHWRender::MTextureManager* const textureMgr
+            = renderer ? renderer->getTextureManager() : nullptr;
+
+        MHWRender::MTexture* texture = nullptr;
+        if (textureMgr) {
+            const std::string textureName = _GetTextureName(_path, _maxDimension);
+            texture = textureMgr->findTexture(textureName.c_str());
+            if (!texture) {
+                texture = _UploadTextureData(textureMgr, textureName, _fullResolutionData);
+            }
+        }
+        _parent->_RefineLoadedTexture(_path, texture, _maxDimension);
+    }
+
+    /*! \brief  Upload the pending full resolution textures on idle, within the per-frame upload
+                budget. The remaining uploads are resumed at the next frame.
+    */
+    static void _ProcessPendingUploads(void*)
+    {
+        MayaUsd::ProfilingScope profilingScope(
+            HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorD_L2,
+            "ProcessPendingTextureUploads");
+
+        const size_t budget = _GetTextureUploadBudget();
+        bool         hasUploaded = false;
+        for (;;) {
+            TextureLoadingTask* task = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_uploadMutex);
+                if (_pendingUploads.empty()) {
+                    break;
+                }
+                // At least one texture is uploaded per frame so that large textures progress.
+                const size_t size = _pendingUploads.front()->_fullResolutionData._texels.size();
+                if (budget > 0 && _uploadedBytes > 0 && _uploadedBytes + size > budget) {
+                    break;
+                }
+                task = _pendingUploads.front();
+                _pendingUploads.pop_front();
+                _uploadedBytes += size;
+            }
+
+            task->_Upload();
+            delete task;
+            hasUploaded = true;
+        }
+
+        if (hasUploaded) {
+            M3dView::scheduleRefreshAllViews();
+        }
     }
 
     HdVP2TextureInfo  _fallbackTextureInfo;
@@ -1769,14 +2139,29 @@ private:
     const std::string _path;
     const GfVec4f     _fallbackColor;
     std::atomic_bool  _started { false };
-    bool              _terminated { false };
+    std::atomic_bool  _terminated { false };
     bool              _hasFallbackColor;
+    unsigned int      _maxDimension;
+    _TextureData      _fullResolutionData; //!< Texels read on a worker thread, when progressive
+
+    static std::mutex                      _uploadMutex;
+    static std::deque<TextureLoadingTask*> _pendingUploads; //!< Full resolutions ready to upload
+    static size_t                          _uploadedBytes;  //!< Bytes uploaded this frame
 };
 
-std::mutex                            HdVP2Material::_refreshMutex;
-std::chrono::steady_clock::time_point HdVP2Material::_startTime;
-std::atomic_size_t                    HdVP2Material::_runningTasksCounter;
-HdVP2GlobalTextureMap                 HdVP2Material::_globalTextureMap;
+std::mutex                                     HdVP2Material::TextureLoadingTask::_uploadMutex;
+std::deque<HdVP2Material::TextureLoadingTask*> HdVP2Material::TextureLoadingTask::_pendingUploads;
+
+size_t HdVP2Material::TextureLoadingTask::_uploadedBytes = 0;
+
+std::mutex                                    HdVP2Material::_refreshMutex;
+std::chrono::steady_clock::time_point         HdVP2Material::_startTime;
+std::atomic_size_t                            HdVP2Material::_runningTasksCounter;
+HdVP2GlobalTextureMap                         HdVP2Material::_globalTextureMap;
+std::unordered_map<std::string, unsigned int> HdVP2Material::_textureMaxDimensions;
+uint64_t                                      HdVP2Material::_textureUseStamp = 0;
+std::unordered_map<const MHWRender::MShaderInstance*, std::multiset<HdVP2Material*>>
+    HdVP2Material::_surfaceShaderUsers;
 
 /*! \brief  Releases the reference to the texture owned by a smart pointer.
  */
@@ -1804,6 +2189,16 @@ HdVP2Material::~HdVP2Material()
     // Tell pending tasks or running tasks (if any) to terminate
     ClearPendingTasks();
 
+#ifdef WANT_MATERIALX_BUILD
+    for (const auto& entry : _materialXFragmentTasks) {
+        entry.second->_waitingMaterials.erase(this);
+    }
+#endif
+
+    for (const auto& info : _localTextureMap) {
+        info.second->_users.erase(this);
+    }
+
     if (!_IsDisabledAsyncTextureLoading() && !_localTextureMap.empty()) {
         _TransientTexturePreserver::GetInstance().PreserveTextures(_localTextureMap);
     }
@@ -1834,7 +2229,7 @@ void HdVP2Material::Sync(
     if (*dirtyBits & (HdMaterial::DirtyResource | HdMaterial::DirtyParams)) {
         const SdfPath& id = GetId();
 
-        MProfilingScope profilingScope(
+        MayaUsd::ProfilingScope profilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorC_L2,
             "HdVP2Material::Sync",
@@ -1868,6 +2263,18 @@ void HdVP2Material::Sync(
     *dirtyBits = HdMaterial::Clean;
 }
 
+HdVP2Material::CompiledNetwork::~CompiledNetwork()
+{
+    _UntrackSurfaceShader(_surfaceShader.get(), _owner);
+}
+
+void HdVP2Material::CompiledNetwork::_SetSurfaceShader(const HdVP2ShaderSharedPtr& shader)
+{
+    _UntrackSurfaceShader(_surfaceShader.get(), _owner);
+    _surfaceShader = shader;
+    _TrackSurfaceShader(_surfaceShader.get(), _owner);
+}
+
 void HdVP2Material::CompiledNetwork::Sync(
     HdSceneDelegate*            sceneDelegate,
     const HdMaterialNetworkMap& networkMap)
@@ -1898,9 +2305,11 @@ void HdVP2Material::CompiledNetwork::Sync(
 
             size_t topoHash = _GenerateNetwork2TopoHash(surfaceNetwork);
 
-            if (!_surfaceShader || topoHash != _topoHash) {
-                _surfaceShader.reset(_CreateMaterialXShaderInstance(id, surfaceNetwork));
+            if (!_surfaceShader || topoHash != _topoHash || !_sharedShaderToken.IsEmpty()) {
+                _SetSurfaceShader(
+                    HdVP2MakeSharedShader(_CreateMaterialXShaderInstance(id, surfaceNetwork)));
                 _pointShader.reset(nullptr);
+                _sharedShaderToken = TfToken();
                 _topoHash = topoHash;
                 // TopoChanged: We have a brand new surface material, tell the mesh to use
                 // it.
@@ -1926,11 +2335,27 @@ void HdVP2Material::CompiledNetwork::Sync(
         // faster hashing and comparison.
         const TfToken token(_GenerateXMLString(vp2BxdfNet, false));
 
+        // Materials whose networks only differ by their paths often have the same parameter
+        // values too. They share a single shader instance, whose parameters are never modified
+        // once it is shared.
+        TfToken              sharedShaderToken;
+        HdVP2ShaderSharedPtr sharedShader;
+#ifndef HDVP2_DISABLE_SHADER_CACHE
+        if (_IsShaderSharingEnabled() && _CanShareShaderInstance(vp2BxdfNet)) {
+            sharedShaderToken = TfToken(_GenerateXMLString(vp2BxdfNet));
+            if (sharedShaderToken == _sharedShaderToken) {
+                return;
+            }
+            sharedShader = _owner->_renderDelegate->GetSharedShader(sharedShaderToken);
+        }
+#endif
+
         // Skip creating a new shader instance if the token is unchanged. There is no plan
         // to implement fine-grain dirty bit in Hydra for the same purpose:
         // https://groups.google.com/g/usd-interest/c/xytT2azlJec/m/22Tnw4yXAAAJ
-        if (_surfaceNetworkToken != token) {
-            MProfilingScope subProfilingScope(
+        // A shared shader instance is replaced instead of having its parameters updated.
+        if (_surfaceNetworkToken != token || sharedShader || !_sharedShaderToken.IsEmpty()) {
+            MayaUsd::ProfilingScope subProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorD_L2,
                 "CreateShaderInstance");
@@ -1939,14 +2364,16 @@ void HdVP2Material::CompiledNetwork::Sync(
             // fragments, the parameters of the surface shader fragment can't be renamed.
             _surfaceShaderId = vp2BxdfNet.nodes.back().path;
 
-            MHWRender::MShaderInstance* shader;
+            MHWRender::MShaderInstance* shader = sharedShader.get();
 
 #ifndef HDVP2_DISABLE_SHADER_CACHE
             // Acquire a shader instance from the shader cache. If a shader instance has
             // been cached with the same token, a clone of the shader instance will be
             // returned. Multiple clones of a shader instance will share the same shader
             // effect, thus reduce compilation overhead and enable material consolidation.
-            shader = _owner->_renderDelegate->GetShaderFromCache(token);
+            if (!shader) {
+                shader = _owner->_renderDelegate->GetShaderFromCache(token);
+            }
 
             // If the shader instance is not found in the cache, create one from the
             // material network and add a clone to the cache for reuse.
@@ -1961,8 +2388,9 @@ void HdVP2Material::CompiledNetwork::Sync(
             shader = _CreateShaderInstance(vp2BxdfNet);
 #endif
 
-            // The shader instance is owned by the material solely.
-            _surfaceShader.reset(shader);
+            // Unless it is shared, the shader instance is owned by the material solely.
+            _SetSurfaceShader(sharedShader ? sharedShader : HdVP2MakeSharedShader(shader));
+            _sharedShaderToken = sharedShader ? sharedShaderToken : TfToken();
             _pointShader.reset(nullptr);
             // TopoChanged: We have a brand new surface material, tell the mesh to use it.
             _owner->_MaterialChanged(sceneDelegate);
@@ -2029,13 +2457,24 @@ void HdVP2Material::CompiledNetwork::Sync(
             // state according to the primvars:displayOpacity data. If the opacity attr
             // isn't connected, the transparency state will be set in
             // _UpdateShaderInstance() according to the opacity value.
-            if (shader) {
+            if (shader && !sharedShader) {
                 shader->setIsTransparent(_IsTransparent(bxdfNet));
             }
         }
 
+        // The parameters of a shared shader instance are already set.
+        if (sharedShader) {
+            return;
+        }
+
         _UpdateShaderInstance(sceneDelegate, bxdfNet);
 
+        // Share the shader instance once its parameters are set.
+        if (_surfaceShader && !sharedShaderToken.IsEmpty()) {
+            _owner->_renderDelegate->AddSharedShader(sharedShaderToken, _surfaceShader);
+            _sharedShaderToken = sharedShaderToken;
+        }
+
 // Consolidation workaround requires dirtying the mesh even on a ValueChanged
 #ifdef HDVP2_MATERIAL_CONSOLIDATION_UPDATE_WORKAROUND
         _owner->_MaterialChanged(sceneDelegate);
@@ -2532,9 +2971,14 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
     HdMaterialNetwork2 fixedNetwork;
     _ApplyMtlxVP2Fixes(fixedNetwork, surfaceNetwork);
 
+    // The environment settings are read once, from the main thread.
+    const MaterialXMaya::OgsFragment::SpecularEnv specularEnv
+        = MaterialXMaya::OgsFragment::getSpecularEnv();
+
     SdfPath       terminalPath = terminalConnIt->second.upstreamNode;
     const TfToken shaderCacheID(
-        _GenerateXMLString(fixedNetwork) + MaterialXMaya::OgsFragment::getSpecularEnvKey());
+        _GenerateXMLString(fixedNetwork)
+        + MaterialXMaya::OgsFragment::getSpecularEnvKey(specularEnv));
 
     // Acquire a shader instance from the shader cache. If a shader instance has been cached with
     // the same token, a clone of the shader instance will be returned. Multiple clones of a shader
@@ -2556,159 +3000,226 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
         return shaderInstance;
     }
 
-    try {
-        // The HdMtlxCreateMtlxDocumentFromHdNetwork function can throw if any MaterialX error is
-        // raised.
+    // The fragment generated for this network may have been stored on disk by a previous
+    // session. In that case only the fragment registration and the shader instance creation
+    // remain to be done.
+    HdVP2MaterialDiskCache::Entry fragmentData;
+    const bool                    useDiskCache = HdVP2MaterialDiskCache::IsEnabled();
+    std::string                   diskCacheKey;
+    if (useDiskCache) {
+        diskCacheKey = HdVP2MaterialDiskCache::ComputeKey(
+            shaderCacheID.GetString(), _GetMaterialXData()._mtlxLibraryFingerprint);
+    }
 
-        // Check if the Terminal is a MaterialX Node
-        SdrRegistry&                sdrRegistry = SdrRegistry::GetInstance();
-        const SdrShaderNodeConstPtr mtlxSdrNode = sdrRegistry.GetShaderNodeByIdentifierAndType(
-            surfTerminal->nodeTypeId, HdVP2Tokens->mtlx);
+    const bool generateAsync = _IsAsyncMaterialXGenerationEnabled();
+    const auto taskIt = generateAsync ? _materialXFragmentTasks.find(shaderCacheID)
+                                      : _materialXFragmentTasks.end();
+
+    if (useDiskCache && HdVP2MaterialDiskCache::Load(diskCacheKey, fragmentData)) {
+        // The fragment doesn't need to be generated.
+    } else if (taskIt != _materialXFragmentTasks.end()) {
+        // The fragment is generated by a worker thread, this material is synced again once the
+        // generation is done.
+        _MaterialXFragmentTask& task = *taskIt->second;
+        if (!task._done) {
+            task._waitingMaterials.insert(_owner);
+            return shaderInstance;
+        }
+        if (!task._error.empty()) {
+            if (!task._errorReported) {
+                TF_RUNTIME_ERROR(
+                    "Caught exception '%s' while processing '%s'",
+                    task._error.c_str(),
+                    task._materialName.c_str());
+                task._errorReported = true;
+            }
+            return nullptr;
+        }
+        fragmentData = std::move(task._fragmentData);
+        _materialXFragmentTasks.erase(taskIt);
+
+        if (useDiskCache) {
+            HdVP2MaterialDiskCache::Store(diskCacheKey, fragmentData);
+        }
+    } else {
+        try {
+            // The HdMtlxCreateMtlxDocumentFromHdNetwork function can throw if any MaterialX error
+            // is raised.
+
+            // Check if the Terminal is a MaterialX Node
+            SdrRegistry&                sdrRegistry = SdrRegistry::GetInstance();
+            const SdrShaderNodeConstPtr mtlxSdrNode
+                = sdrRegistry.GetShaderNodeByIdentifierAndType(
+                    surfTerminal->nodeTypeId, HdVP2Tokens->mtlx);
 
-        mx::DocumentPtr           mtlxDoc;
-        const mx::FileSearchPath& crLibrarySearchPath(_GetMaterialXData()._mtlxSearchPath);
-        if (mtlxSdrNode) {
+            mx::DocumentPtr mtlxDoc;
+            if (mtlxSdrNode) {
 
-            // Create the MaterialX Document from the HdMaterialNetwork
+                // Create the MaterialX Document from the HdMaterialNetwork
 #if PXR_VERSION > 2111
-            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
-                fixedNetwork,
-                *surfTerminal, // MaterialX HdNode
-                fixedPath,
-                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
-                _GetMaterialXData()._mtlxLibrary);
+                mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+                    fixedNetwork,
+                    *surfTerminal, // MaterialX HdNode
+                    fixedPath,
+                    SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
+                    _GetMaterialXData()._mtlxLibrary);
 #else
-            std::set<SdfPath> hdTextureNodes;
-            mx::StringMap     mxHdTextureMap; // Mx-Hd texture name counterparts
-            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
-                fixedNetwork,
-                *surfTerminal, // MaterialX HdNode
-                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
-                _GetMaterialXData()._mtlxLibrary,
-                &hdTextureNodes,
-                &mxHdTextureMap);
+                std::set<SdfPath> hdTextureNodes;
+                mx::StringMap     mxHdTextureMap; // Mx-Hd texture name counterparts
+                mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+                    fixedNetwork,
+                    *surfTerminal, // MaterialX HdNode
+                    SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
+                    _GetMaterialXData()._mtlxLibrary,
+                    &hdTextureNodes,
+                    &mxHdTextureMap);
 #endif
 
-            if (!mtlxDoc) {
+                if (!mtlxDoc) {
+                    return shaderInstance;
+                }
+
+                // Touchups required to fix input stream issues:
+                _AddMissingTexcoordReaders(mtlxDoc);
+                _AddMissingTangents(mtlxDoc);
+
+                if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
+                    std::cout << "generated shader code for " << materialId.GetText() << ":\n";
+                    std::cout << "Generated graph\n==============================\n";
+                    mx::writeToXmlStream(mtlxDoc, std::cout);
+                    std::cout << "\n==============================\n";
+                }
+            } else {
                 return shaderInstance;
             }
 
-            // Touchups required to fix input stream issues:
-            _AddMissingTexcoordReaders(mtlxDoc);
-            _AddMissingTangents(mtlxDoc);
-
-            _surfaceShaderId = terminalPath;
+            mx::NodePtr materialNode;
+            for (const mx::NodePtr& material : mtlxDoc->getMaterialNodes()) {
+                if (material->getName() == _mtlxTokens->USD_Mtlx_VP2_Material.GetText()) {
+                    materialNode = material;
+                }
+            }
 
-            if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
-                std::cout << "generated shader code for " << materialId.GetText() << ":\n";
-                std::cout << "Generated graph\n==============================\n";
-                mx::writeToXmlStream(mtlxDoc, std::cout);
-                std::cout << "\n==============================\n";
+            if (!materialNode) {
+                return shaderInstance;
             }
-        } else {
-            return shaderInstance;
-        }
 
-        mx::NodePtr materialNode;
-        for (const mx::NodePtr& material : mtlxDoc->getMaterialNodes()) {
-            if (material->getName() == _mtlxTokens->USD_Mtlx_VP2_Material.GetText()) {
-                materialNode = material;
+            if (generateAsync) {
+                // Only the shader generation, which is the most expensive part and doesn't use
+                // the Maya API, runs on the worker thread. The fragment is registered with VP2
+                // by the next sync of the waiting materials.
+                auto task = std::make_shared<_MaterialXFragmentTask>();
+                task->_materialName = materialId.GetString();
+                task->_waitingMaterials.insert(_owner);
+                _materialXFragmentTasks.emplace(shaderCacheID, task);
+
+                // The document is captured rather than the node, which only holds a weak
+                // reference to its document.
+                WorkRunDetachedTask([task, mtlxDoc, specularEnv]() {
+                    try {
+                        _GenerateMaterialXFragment(
+                            mtlxDoc->getNode(_mtlxTokens->USD_Mtlx_VP2_Material.GetText()),
+                            specularEnv,
+                            task->_fragmentData);
+                    } catch (mx::Exception& e) {
+                        task->_error = e.what();
+                    }
+                    task->_done = true;
+                    MGlobal::executeTaskOnIdle(
+                        HdVP2Material::_OnMaterialXFragmentsGenerated, nullptr);
+                });
+                return shaderInstance;
             }
+
+            _GenerateMaterialXFragment(materialNode, specularEnv, fragmentData);
+        } catch (mx::Exception& e) {
+            TF_RUNTIME_ERROR(
+                "Caught exception '%s' while processing '%s'", e.what(), materialId.GetText());
+            return nullptr;
         }
 
-        if (!materialNode) {
-            return shaderInstance;
+        if (useDiskCache) {
+            HdVP2MaterialDiskCache::Store(diskCacheKey, fragmentData);
         }
+    }
 
-        MaterialXMaya::OgsFragment ogsFragment(materialNode, crLibrarySearchPath);
+    _surfaceShaderId = terminalPath;
+    _requiredPrimvars.insert(
+        _requiredPrimvars.end(),
+        fragmentData._requiredPrimvars.begin(),
+        fragmentData._requiredPrimvars.end());
 
-        // Explore the fragment for primvars:
-        mx::ShaderPtr            shader = ogsFragment.getShader();
-        const mx::VariableBlock& vertexInputs
-            = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
-        for (size_t i = 0; i < vertexInputs.size(); ++i) {
-            const mx::ShaderPort* variable = vertexInputs[i];
-            // Position is always assumed.
-            // Tangent will be generated in the vertex shader using a utility fragment
-            if (variable->getName() == mx::HW::T_IN_NORMAL) {
-                _requiredPrimvars.push_back(HdTokens->normals);
-            }
-        }
+    MHWRender::MRenderer* const renderer = MHWRender::MRenderer::theRenderer();
+    if (!TF_VERIFY(renderer)) {
+        return shaderInstance;
+    }
 
-        MHWRender::MRenderer* const renderer = MHWRender::MRenderer::theRenderer();
-        if (!TF_VERIFY(renderer)) {
-            return shaderInstance;
-        }
+    MHWRender::MFragmentManager* const fragmentManager = renderer->getFragmentManager();
+    if (!TF_VERIFY(fragmentManager)) {
+        return shaderInstance;
+    }
+
+    MString fragmentName(fragmentData._fragmentName.c_str());
 
-        MHWRender::MFragmentManager* const fragmentManager = renderer->getFragmentManager();
-        if (!TF_VERIFY(fragmentManager)) {
+    if (!fragmentManager->hasFragment(fragmentName)) {
+        const MString registeredFragment = fragmentManager->addShadeFragmentFromBuffer(
+            fragmentData._fragmentSource.c_str(), false);
+        if (registeredFragment.length() == 0) {
+            TF_WARN("Failed to register shader fragment %s", fragmentName.asChar());
             return shaderInstance;
         }
+    }
 
-        MString fragmentName(ogsFragment.getFragmentName().c_str());
-
-        if (!fragmentManager->hasFragment(fragmentName)) {
-            std::string   fragSrc = ogsFragment.getFragmentSource();
-            const MString registeredFragment
-                = fragmentManager->addShadeFragmentFromBuffer(fragSrc.c_str(), false);
-            if (registeredFragment.length() == 0) {
-                TF_WARN("Failed to register shader fragment %s", fragmentName.asChar());
-                return shaderInstance;
-            }
-        }
+    const MHWRender::MShaderManager* const shaderMgr = renderer->getShaderManager();
+    if (!TF_VERIFY(shaderMgr)) {
+        return shaderInstance;
+    }
 
-        const MHWRender::MShaderManager* const shaderMgr = renderer->getShaderManager();
-        if (!TF_VERIFY(shaderMgr)) {
-            return shaderInstance;
+    shaderInstance = shaderMgr->getFragmentShader(fragmentName, "outColor", true);
+    if (!shaderInstance) {
+        return shaderInstance;
+    }
+    HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2ShaderInstances);
+
+    // Find named primvar readers:
+    MStringArray parameterList;
+    shaderInstance->parameterList(parameterList);
+    for (unsigned int i = 0; i < parameterList.length(); ++i) {
+        static const unsigned int u_geomprop_length
+            = static_cast<unsigned int>(_mtlxTokens->i_geomprop_.GetString().length());
+        if (parameterList[i].substring(0, u_geomprop_length - 1)
+            == _mtlxTokens->i_geomprop_.GetText()) {
+            MString varname
+                = parameterList[i].substring(u_geomprop_length, parameterList[i].length());
+            shaderInstance->renameParameter(parameterList[i], varname);
+            _requiredPrimvars.push_back(TfToken(varname.asChar()));
         }
+    }
 
-        shaderInstance = shaderMgr->getFragmentShader(fragmentName, "outColor", true);
-
-        // Find named primvar readers:
-        MStringArray parameterList;
-        shaderInstance->parameterList(parameterList);
-        for (unsigned int i = 0; i < parameterList.length(); ++i) {
-            static const unsigned int u_geomprop_length
-                = static_cast<unsigned int>(_mtlxTokens->i_geomprop_.GetString().length());
-            if (parameterList[i].substring(0, u_geomprop_length - 1)
-                == _mtlxTokens->i_geomprop_.GetText()) {
-                MString varname
-                    = parameterList[i].substring(u_geomprop_length, parameterList[i].length());
-                shaderInstance->renameParameter(parameterList[i], varname);
-                _requiredPrimvars.push_back(TfToken(varname.asChar()));
-            }
-        }
-
-        // Fixup inputs that were renamed because they conflicted with reserved keywords:
-        for (const auto& namePair : ogsFragment.getPathInputMap()) {
-            std::string path = namePair.first;
-            std::string input = namePair.second;
-            // Renaming adds digits at the end, so only compare the backs.
-            if (path.back() != input.back()) {
-                // If a digit was added, we should be able to find the last path element inside the
-                // input name:
-                size_t      lastSlash = path.rfind("/");
-                std::string originalName = path;
-                if (lastSlash != std::string::npos) {
-                    originalName = path.substr(lastSlash + 1);
-                }
-                size_t foundOriginal = input.find(originalName);
-                if (foundOriginal != std::string::npos) {
-                    MString uniqueName(input.c_str());
-                    input = input.substr(0, foundOriginal + originalName.size());
-                    shaderInstance->renameParameter(uniqueName, input.c_str());
-                }
+    // Fixup inputs that were renamed because they conflicted with reserved keywords:
+    for (const auto& namePair : fragmentData._pathInputMap) {
+        std::string path = namePair.first;
+        std::string input = namePair.second;
+        // Renaming adds digits at the end, so only compare the backs.
+        if (path.back() != input.back()) {
+            // If a digit was added, we should be able to find the last path element inside the
+            // input name:
+            size_t      lastSlash = path.rfind("/");
+            std::string originalName = path;
+            if (lastSlash != std::string::npos) {
+                originalName = path.substr(lastSlash + 1);
+            }
+            size_t foundOriginal = input.find(originalName);
+            if (foundOriginal != std::string::npos) {
+                MString uniqueName(input.c_str());
+                input = input.substr(0, foundOriginal + originalName.size());
+                shaderInstance->renameParameter(uniqueName, input.c_str());
             }
         }
-
-        shaderInstance->setIsTransparent(ogsFragment.isTransparent());
-
-    } catch (mx::Exception& e) {
-        TF_RUNTIME_ERROR(
-            "Caught exception '%s' while processing '%s'", e.what(), materialId.GetText());
-        return nullptr;
     }
 
+    shaderInstance->setIsTransparent(fragmentData._isTransparent);
+
     if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
         std::cout << "BXDF material network for " << materialId << ":\n"
                   << _GenerateXMLString(surfaceNetwork) << "\n"
@@ -2779,6 +3290,7 @@ HdVP2Material::CompiledNetwork::_CreateShaderInstance(const HdMaterialNetwork& m
                 TF_WARN("Failed to create shader instance for %s", nodeId.asChar());
                 break;
             }
+            HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2ShaderInstances);
 
             continue;
         }
@@ -2853,6 +3365,7 @@ HdVP2Material::CompiledNetwork::_CreateShaderInstance(const HdMaterialNetwork& m
                 TF_WARN("Failed to create shader instance for %s", nodeId.asChar());
                 break;
             }
+            HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2ShaderInstances);
 
             continue;
         }
@@ -2926,6 +3439,19 @@ HdVP2Material::CompiledNetwork::_CreateShaderInstance(const HdMaterialNetwork& m
 
 #endif
 
+    // Read the normals from the octahedral-encoded stream of the mesh instead of the 3-float
+    // normals stream.
+    if (shaderInstance && HdVP2RenderDelegate::IsOctahedralNormalsEnabled()) {
+        MStatus status = shaderInstance->addInputFragment(
+            _tokens->DecodeOctahedralNormal.GetText(), "output", "Nw");
+        if (!status) {
+            TF_DEBUG(HDVP2_DEBUG_MATERIAL)
+                .Msg(
+                    "Error %s happened when connecting the octahedral normal decoder\n",
+                    status.errorString().asChar());
+        }
+    }
+
     return shaderInstance;
 }
 
@@ -2939,7 +3465,7 @@ void HdVP2Material::CompiledNetwork::_UpdateShaderInstance(
         return;
     }
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "UpdateShaderInstance");
 
     for (const HdMaterialNode& node : mat.nodes) {
@@ -3168,6 +3694,8 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         HdVP2TextureInfoSharedPtr cacheEntry = it->second.lock();
         if (cacheEntry) {
             _localTextureMap[path] = cacheEntry;
+            cacheEntry->_lastUseStamp = ++_textureUseStamp;
+            cacheEntry->_users.insert(this);
             return *cacheEntry;
         } else {
             // if cacheEntry is nullptr then there is a stale entry in the _globalTextureMap. Erase
@@ -3185,38 +3713,270 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         hasFallbackColor = true;
     }
 
+    // The texture memory budget may require loading a lower resolution.
+    const auto         maxDimensionIt = _textureMaxDimensions.find(path);
+    const unsigned int maxDimension
+        = maxDimensionIt != _textureMaxDimensions.end() ? maxDimensionIt->second : 0;
+
     if (_IsDisabledAsyncTextureLoading()) {
         bool        isSRGB = false;
         MFloatArray uvScaleOffset;
 
-        MHWRender::MTexture* texture
-            = _LoadTexture(path, hasFallbackColor, fallbackColor, isSRGB, uvScaleOffset);
-
-        HdVP2TextureInfoSharedPtr info = std::make_shared<HdVP2TextureInfo>();
-        // path should never already be in _localTextureMap because if it was
-        // we'd have found it in _globalTextureMap
-        _localTextureMap.emplace(path, info);
-        // path should never already be in _globalTextureMap because if it was present
-        // and nullptr then we erased it.
-        _globalTextureMap.emplace(path, info);
-        info->_texture.reset(texture);
-        info->_isColorSpaceSRGB = isSRGB;
-        if (uvScaleOffset.length() > 0) {
-            TF_VERIFY(uvScaleOffset.length() == 4);
-            info->_stScale.Set(
-                uvScaleOffset[0], uvScaleOffset[1]); // The first 2 elements are the scale
-            info->_stOffset.Set(
-                uvScaleOffset[2], uvScaleOffset[3]); // The next two elements are the offset
-        }
+        MHWRender::MTexture* texture = _LoadTexture(
+            path, hasFallbackColor, fallbackColor, isSRGB, uvScaleOffset, maxDimension);
+
+        HdVP2TextureInfoSharedPtr info
+            = _AddLoadedTexture(path, texture, isSRGB, uvScaleOffset, maxDimension);
+        _EnforceTextureMemoryBudget();
 
         return *info;
     }
 
-    auto* task = new TextureLoadingTask(this, sceneDelegate, path, hasFallbackColor, fallbackColor);
+    auto* task = new TextureLoadingTask(
+        this, sceneDelegate, path, hasFallbackColor, fallbackColor, maxDimension);
     _textureLoadingTasks.emplace(path, task);
     return task->GetFallbackTextureInfo();
 }
 
+HdVP2TextureInfoSharedPtr HdVP2Material::_AddLoadedTexture(
+    const std::string&   path,
+    MHWRender::MTexture* texture,
+    bool                 isColorSpaceSRGB,
+    const MFloatArray&   uvScaleOffset,
+    unsigned int         maxDimension)
+{
+    HdVP2TextureInfoSharedPtr info = std::make_shared<HdVP2TextureInfo>();
+    // path should never already be in _localTextureMap because if it was
+    // we'd have found it in _globalTextureMap
+    _localTextureMap.emplace(path, info);
+    // path should never already be in _globalTextureMap because if it was present
+    // and nullptr then we erased it.
+    _globalTextureMap.emplace(path, info);
+    info->_texture.reset(texture);
+    info->_isColorSpaceSRGB = isColorSpaceSRGB;
+    if (uvScaleOffset.length() > 0) {
+        TF_VERIFY(uvScaleOffset.length() == 4);
+        info->_stScale.Set(
+            uvScaleOffset[0], uvScaleOffset[1]); // The first 2 elements are the scale
+        info->_stOffset.Set(
+            uvScaleOffset[2], uvScaleOffset[3]); // The next two elements are the offset
+    }
+    info->_sizeInBytes = _GetTextureSizeInBytes(texture, info->_dimension);
+    info->_maxDimension = maxDimension;
+    info->_lastUseStamp = ++_textureUseStamp;
+    info->_users.insert(this);
+    return info;
+}
+
+void HdVP2Material::_ReleaseTexture(const std::string& path)
+{
+    _localTextureMap.erase(path);
+
+    // Sync the material again so that the texture gets acquired, and thus loaded, again.
+    _MarkResourceDirty();
+}
+
+void HdVP2Material::_MarkResourceDirty()
+{
+    auto* const param = static_cast<HdVP2RenderParam*>(_renderDelegate->GetRenderParam());
+    if (UsdImagingDelegate* sceneDelegate = param->GetDrawScene().GetUsdImagingDelegate()) {
+        sceneDelegate->GetRenderIndex().GetChangeTracker().MarkSprimDirty(
+            GetId(), HdMaterial::DirtyResource);
+    }
+}
+
+/*! \brief  Reduce the resolution of the least recently used textures when the textures held by
+            the global texture map exceed the texture memory budget.
+
+    Materials holding a reduced texture release it and are marked dirty, so the texture is loaded
+    again at the lower resolution, through the texture loading task when loading is asynchronous.
+*/
+/*static*/
+void HdVP2Material::_EnforceTextureMemoryBudget()
+{
+    const size_t budget = _GetTextureMemoryBudget();
+    if (budget == 0) {
+        return;
+    }
+
+    size_t usage = 0;
+    std::vector<std::pair<std::string, HdVP2TextureInfoSharedPtr>> residentTextures;
+    for (auto it = _globalTextureMap.begin(); it != _globalTextureMap.end();) {
+        if (HdVP2TextureInfoSharedPtr info = it->second.lock()) {
+            usage += info->_sizeInBytes;
+            residentTextures.emplace_back(it->first, std::move(info));
+            ++it;
+        } else {
+            it = _globalTextureMap.erase(it);
+        }
+    }
+
+    if (usage <= budget) {
+        return;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "EnforceTextureMemoryBudget");
+
+    std::sort(
+        residentTextures.begin(),
+        residentTextures.end(),
+        [](const std::pair<std::string, HdVP2TextureInfoSharedPtr>& a,
+           const std::pair<std::string, HdVP2TextureInfoSharedPtr>& b) {
+            return a.second->_lastUseStamp < b.second->_lastUseStamp;
+        });
+
+    // The most recently used texture is never reduced, it is the one which has just been loaded.
+    residentTextures.pop_back();
+
+    for (const auto& residentTexture : residentTextures) {
+        if (usage <= budget) {
+            break;
+        }
+
+        const std::string&      path = residentTexture.first;
+        const HdVP2TextureInfo& info = *residentTexture.second;
+        if (info._dimension / 2 < kMinBudgetTextureDimension) {
+            continue;
+        }
+
+        // Halving the resolution divides the memory by four.
+        _textureMaxDimensions[path] = info._dimension / 2;
+        usage -= info._sizeInBytes - info._sizeInBytes / 4;
+
+        _globalTextureMap.erase(path);
+
+        // Copy the users since releasing the texture may modify the set.
+        const std::set<HdVP2Material*> users = info._users;
+        for (HdVP2Material* user : users) {
+            user->_ReleaseTexture(path);
+        }
+    }
+}
+
+/*! \brief  Reload at a higher resolution the most recently used texture reduced by the texture
+            memory budget, once the textures fit again within the budget with it.
+
+    Called once per frame. Only one texture is restored at a time, and only when no texture is
+    loading, so that the usage includes the textures restored before.
+*/
+/*static*/
+void HdVP2Material::RestoreReducedTextures()
+{
+    const size_t budget = _GetTextureMemoryBudget();
+    if (budget == 0 || _textureMaxDimensions.empty() || _runningTasksCounter.load() > 0) {
+        return;
+    }
+
+    size_t                    usage = 0;
+    std::string               restoredPath;
+    HdVP2TextureInfoSharedPtr restoredInfo;
+    for (auto it = _globalTextureMap.begin(); it != _globalTextureMap.end();) {
+        HdVP2TextureInfoSharedPtr info = it->second.lock();
+        if (!info) {
+            it = _globalTextureMap.erase(it);
+            continue;
+        }
+
+        usage += info->_sizeInBytes;
+        if (info->_maxDimension > 0 && !info->_isPreview
+            && (!restoredInfo || info->_lastUseStamp > restoredInfo->_lastUseStamp)) {
+            restoredPath = it->first;
+            restoredInfo = std::move(info);
+        }
+        ++it;
+    }
+
+    if (!restoredInfo) {
+        return;
+    }
+
+    // The image is not larger than the clamp, it is already loaded at full resolution.
+    if (restoredInfo->_dimension < restoredInfo->_maxDimension) {
+        _textureMaxDimensions.erase(restoredPath);
+        restoredInfo->_maxDimension = 0;
+        return;
+    }
+
+    // Doubling the resolution multiplies the memory by four.
+    if (usage + 3 * restoredInfo->_sizeInBytes > budget) {
+        return;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "RestoreReducedTextures");
+
+    _textureMaxDimensions[restoredPath] = restoredInfo->_maxDimension * 2;
+
+    _globalTextureMap.erase(restoredPath);
+
+    // Copy the users since releasing the texture may modify the set.
+    const std::set<HdVP2Material*> users = restoredInfo->_users;
+    for (HdVP2Material* user : users) {
+        user->_ReleaseTexture(restoredPath);
+    }
+}
+
+/*static*/
+void HdVP2Material::_TrackSurfaceShader(
+    MHWRender::MShaderInstance* shader,
+    HdVP2Material*              material)
+{
+    if (!shader || _GetTextureMemoryBudget() == 0) {
+        return;
+    }
+
+    auto& users = _surfaceShaderUsers[shader];
+    if (users.empty()) {
+        shader->addCallbacks(_OnSurfaceShaderDraw, nullptr);
+    }
+    users.insert(material);
+}
+
+/*static*/
+void HdVP2Material::_UntrackSurfaceShader(
+    MHWRender::MShaderInstance* shader,
+    HdVP2Material*              material)
+{
+    const auto it = _surfaceShaderUsers.find(shader);
+    if (it == _surfaceShaderUsers.end()) {
+        return;
+    }
+
+    const auto userIt = it->second.find(material);
+    if (userIt != it->second.end()) {
+        it->second.erase(userIt);
+    }
+    if (it->second.empty()) {
+        _surfaceShaderUsers.erase(it);
+    }
+}
+
+/*! \brief  Stamp the textures of the materials drawing with the shader as the most recently used.
+ */
+/*static*/
+void HdVP2Material::_OnSurfaceShaderDraw(
+    MHWRender::MDrawContext&,
+    const MHWRender::MRenderItemList&,
+    MHWRender::MShaderInstance* shader)
+{
+    const auto it = _surfaceShaderUsers.find(shader);
+    if (it == _surfaceShaderUsers.end()) {
+        return;
+    }
+
+    const uint64_t stamp = ++_textureUseStamp;
+    for (const HdVP2Material* material : it->second) {
+        for (const auto& entry : material->_localTextureMap) {
+            if (entry.second) {
+                entry.second->_lastUseStamp = stamp;
+            }
+        }
+    }
+}
+
 void HdVP2Material::EnqueueLoadTextures()
 {
     for (const auto& task : _textureLoadingTasks) {
@@ -3244,12 +4004,14 @@ void HdVP2Material::ClearPendingTasks()
     _runningTasksCounter = 0;
 }
 
-void HdVP2Material::_UpdateLoadedTexture(
+bool HdVP2Material::_UpdateLoadedTexture(
     HdSceneDelegate*     sceneDelegate,
     const std::string&   path,
     MHWRender::MTexture* texture,
     bool                 isColorSpaceSRGB,
-    const MFloatArray&   uvScaleOffset)
+    const MFloatArray&   uvScaleOffset,
+    unsigned int         maxDimension,
+    bool                 isPreview)
 {
     // Decrease the counter if texture finished loading.
     // Please notice that we do not do the same thing for terminated tasks,
@@ -3260,31 +4022,25 @@ void HdVP2Material::_UpdateLoadedTexture(
         --_runningTasksCounter;
     }
 
+    // Check the cache again. If the texture is not in the cache
+    // the add it.
+    bool isRefining = false;
+    if (_globalTextureMap.find(path) == _globalTextureMap.end()) {
+        HdVP2TextureInfoSharedPtr info
+            = _AddLoadedTexture(path, texture, isColorSpaceSRGB, uvScaleOffset, maxDimension);
+        info->_isPreview = isPreview;
+        isRefining = isPreview;
+        _EnforceTextureMemoryBudget();
+    }
+
     // Pop the task object from the container, since this method is
     // called directly from the task object method `loadOnIdle()`,
     // we do not handle the deletion here, we will let the
     // function on idle to delete the task object.
-    _textureLoadingTasks.erase(path);
-
-    // Check the cache again. If the texture is not in the cache
-    // the add it.
-    if (_globalTextureMap.find(path) == _globalTextureMap.end()) {
-        HdVP2TextureInfoSharedPtr info = std::make_shared<HdVP2TextureInfo>();
-        // path should never already be in _localTextureMap because if it was
-        // we'd have found it in _globalTextureMap
-        _localTextureMap.emplace(path, info);
-        // path should never already be in _globalTextureMap because if it was present
-        // and nullptr then we erased it.
-        _globalTextureMap.emplace(path, info);
-        info->_texture.reset(texture);
-        info->_isColorSpaceSRGB = isColorSpaceSRGB;
-        if (uvScaleOffset.length() > 0) {
-            TF_VERIFY(uvScaleOffset.length() == 4);
-            info->_stScale.Set(
-                uvScaleOffset[0], uvScaleOffset[1]); // The first 2 elements are the scale
-            info->_stOffset.Set(
-                uvScaleOffset[2], uvScaleOffset[3]); // The next two elements are the offset
-        }
+    // A task refining a preview is kept until the full resolution is uploaded, so that
+    // it gets terminated if this material is destroyed in the meantime.
+    if (!isRefining) {
+        _textureLoadingTasks.erase(path);
     }
 
     // Mark sprim dirty
@@ -3292,6 +4048,69 @@ void HdVP2Material::_UpdateLoadedTexture(
         GetId(), HdMaterial::DirtyResource);
 
     _ScheduleRefresh();
+    return isRefining;
+}
+
+void HdVP2Material::_RefineLoadedTexture(
+    const std::string&   path,
+    MHWRender::MTexture* texture,
+    unsigned int         maxDimension)
+{
+    HdVP2TextureUniquePtr refinedTexture(texture);
+
+    _textureLoadingTasks.erase(path);
+
+    // The preview may have been released while the full resolution was loading.
+    const auto                it = _globalTextureMap.find(path);
+    HdVP2TextureInfoSharedPtr info = it != _globalTextureMap.end() ? it->second.lock() : nullptr;
+    if (!info || !info->_isPreview) {
+        return;
+    }
+    info->_isPreview = false;
+
+    // Keep the preview if the image is not larger than it, or if it failed to load.
+    unsigned int dimension = 0;
+    const size_t sizeInBytes = _GetTextureSizeInBytes(refinedTexture.get(), dimension);
+    if (dimension <= info->_dimension) {
+        return;
+    }
+
+    info->_texture = std::move(refinedTexture);
+    info->_sizeInBytes = sizeInBytes;
+    info->_dimension = dimension;
+    info->_maxDimension = maxDimension;
+    info->_lastUseStamp = ++_textureUseStamp;
+
+    // Sync all materials using the preview so that their shaders get the full resolution.
+    for (HdVP2Material* user : info->_users) {
+        user->_MarkResourceDirty();
+    }
+
+    _EnforceTextureMemoryBudget();
+}
+
+/*static*/
+void HdVP2Material::ResetTextureUploadBudget() { TextureLoadingTask::ResetUploadBudget(); }
+
+/*static*/
+size_t HdVP2Material::GetTextureMemoryUsage()
+{
+    size_t usage = 0;
+    for (const auto& entry : _globalTextureMap) {
+        if (HdVP2TextureInfoSharedPtr info = entry.second.lock()) {
+            usage += info->_sizeInBytes;
+        }
+    }
+    return usage;
+}
+
+void HdVP2Material::GetMemoryUsage(HdVP2MemoryUsage& usage) const
+{
+    for (const auto& entry : _localTextureMap) {
+        if (entry.second) {
+            usage.AddTexture(entry.second.get(), entry.second->_sizeInBytes);
+        }
+    }
 }
 
 /*static*/
@@ -3320,6 +4139,7 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::GetPointShader() con
 {
     if (!_pointShader && _surfaceShader) {
         _pointShader.reset(_surfaceShader->clone());
+        HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2ShaderInstances);
         _pointShader->addInputFragment("PointsGeometry", "GPUStage", "GPUStage");
     }
 
@@ -3370,10 +4190,37 @@ void HdVP2Material::_MaterialChanged(HdSceneDelegate* sceneDelegate)
     }
 }
 
+#ifdef WANT_MATERIALX_BUILD
+/*static*/
+void HdVP2Material::_OnMaterialXFragmentsGenerated(void*)
+{
+    bool hasWaitingMaterials = false;
+    for (const auto& entry : _materialXFragmentTasks) {
+        _MaterialXFragmentTask& task = *entry.second;
+        if (!task._done) {
+            continue;
+        }
+        for (HdVP2Material* material : task._waitingMaterials) {
+            material->_MarkResourceDirty();
+            hasWaitingMaterials = true;
+        }
+        task._waitingMaterials.clear();
+    }
+
+    if (hasWaitingMaterials) {
+        M3dView::scheduleRefreshAllViews();
+    }
+}
+#endif
+
 void HdVP2Material::OnMayaExit()
 {
     _TransientTexturePreserver::GetInstance().OnMayaExit();
+#ifdef WANT_MATERIALX_BUILD
+    _materialXFragmentTasks.clear();
+#endif
     _globalTextureMap.clear();
+    _textureMaxDimensions.clear();
     HdVP2RenderDelegate::OnMayaExit();
 }
 
@@ -16,6 +16,7 @@
 #ifndef HD_VP2_MATERIAL
 #define HD_VP2_MATERIAL
 
+#include "memoryUsage.h"
 #include "shader.h"
 
 #include <pxr/base/gf/vec2f.h>
@@ -39,6 +40,7 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdSceneDelegate;
+class HdVP2Material;
 class HdVP2RenderDelegate;
 
 /*! \brief  A deleter for MTexture, for use with smart pointers.
@@ -56,10 +58,16 @@ using HdVP2TextureUniquePtr = std::unique_ptr<MHWRender::MTexture, HdVP2TextureD
  */
 struct HdVP2TextureInfo
 {
-    HdVP2TextureUniquePtr _texture;                    //!< Unique pointer of the texture
-    GfVec2f               _stScale { 1.0f, 1.0f };     //!< UV scale for tiled textures
-    GfVec2f               _stOffset { 0.0f, 0.0f };    //!< UV offset for tiled textures
-    bool                  _isColorSpaceSRGB { false }; //!< Whether sRGB linearization is needed
+    HdVP2TextureUniquePtr    _texture;                    //!< Unique pointer of the texture
+    GfVec2f                  _stScale { 1.0f, 1.0f };     //!< UV scale for tiled textures
+    GfVec2f                  _stOffset { 0.0f, 0.0f };    //!< UV offset for tiled textures
+    bool                     _isColorSpaceSRGB { false }; //!< Whether sRGB linearization is needed
+    size_t                   _sizeInBytes { 0 };          //!< Estimated GPU memory of the texture
+    unsigned int             _dimension { 0 };     //!< Largest dimension of the loaded texture
+    unsigned int             _maxDimension { 0 };  //!< Resolution clamp used for loading, 0 if none
+    uint64_t                 _lastUseStamp { 0 };  //!< Stamp of the last draw or acquisition
+    std::set<HdVP2Material*> _users;               //!< Materials holding this texture
+    bool                     _isPreview { false }; //!< Whether the full resolution is loading
 };
 
 using HdVP2TextureInfoSharedPtr = std::shared_ptr<HdVP2TextureInfo>;
@@ -74,6 +82,10 @@ using HdVP2TextureInfoWeakPtr = std::weak_ptr<HdVP2TextureInfo>;
     In order to correctly delete textures when they are no longer in use the global texture map
     holds only a weak_ptr to the HdVP2TextureInfo. The individual materials hold shared_ptrs to
     the textures they are using, so that when no materials are using a texture it'll be deleted.
+
+    When the MAYAUSD_VP2_TEXTURE_MEMORY_BUDGET environment variable is set, the least recently
+    used textures are reloaded at a lower resolution whenever the textures referenced by the
+    global texture map exceed the budget, and at a higher resolution again once they fit.
  */
 using HdVP2LocalTextureMap = std::unordered_map<std::string, HdVP2TextureInfoSharedPtr>;
 using HdVP2GlobalTextureMap = std::unordered_map<std::string, HdVP2TextureInfoWeakPtr>;
@@ -118,6 +130,18 @@ public:
     class TextureLoadingTask;
     friend class TextureLoadingTask;
 
+    //! Start a new frame of progressive texture uploads. Must be called from the main thread.
+    static void ResetTextureUploadBudget();
+
+    //! Reload at a higher resolution a texture reduced by the texture memory budget, if it fits.
+    static void RestoreReducedTextures();
+
+    //! Return the estimated GPU memory used by the textures of all materials, in bytes.
+    static size_t GetTextureMemoryUsage();
+
+    //! Add the textures used by this material, unless already counted for another material.
+    void GetMemoryUsage(HdVP2MemoryUsage& usage) const;
+
     static void OnMayaExit();
 
 private:
@@ -128,6 +152,7 @@ private:
             : _owner(m)
         {
         }
+        ~CompiledNetwork();
 
         void Sync(HdSceneDelegate*, const HdMaterialNetworkMap&);
 
@@ -138,8 +163,9 @@ private:
     private:
         HdVP2Material* _owner;
         TfToken _surfaceNetworkToken; //!< Generated token to uniquely identify a material network
+        TfToken _sharedShaderToken;   //!< Network and parameter values of a shared surface shader
         SdfPath _surfaceShaderId;     //!< Path of the surface shader
-        HdVP2ShaderUniquePtr         _surfaceShader;    //!< VP2 surface shader instance
+        HdVP2ShaderSharedPtr         _surfaceShader;    //!< VP2 surface shader instance
         mutable HdVP2ShaderUniquePtr _pointShader;      //!< VP2 point shader instance, if needed
         TfTokenVector                _requiredPrimvars; //!< primvars required by this network
         std::unordered_map<SdfPath, SdfPath, SdfPath::Hash>
@@ -154,6 +180,7 @@ private:
             SdfPath const&            materialId,
             HdMaterialNetwork2 const& hdNetworkMap);
 #endif
+        void _SetSurfaceShader(const HdVP2ShaderSharedPtr& shader);
         void _ApplyVP2Fixes(HdMaterialNetwork& outNet, const HdMaterialNetwork& inNet);
         MHWRender::MShaderInstance* _CreateShaderInstance(const HdMaterialNetwork& mat);
         void _UpdateShaderInstance(HdSceneDelegate* sceneDelegate, const HdMaterialNetwork& mat);
@@ -171,18 +198,52 @@ private:
         HdSceneDelegate*      sceneDelegate,
         const std::string&    path,
         const HdMaterialNode& node);
-    void _UpdateLoadedTexture(
+    //! Return true if the texture is a preview which will be refined by the loading task.
+    bool _UpdateLoadedTexture(
         HdSceneDelegate*     sceneDelegate,
         const std::string&   path,
         MHWRender::MTexture* texture,
         bool                 isColorSpaceSRGB,
-        const MFloatArray&   uvScaleOffset);
+        const MFloatArray&   uvScaleOffset,
+        unsigned int         maxDimension,
+        bool                 isPreview);
+    //! Replace the preview of a texture by its full resolution.
+    void _RefineLoadedTexture(
+        const std::string&   path,
+        MHWRender::MTexture* texture,
+        unsigned int         maxDimension);
+    HdVP2TextureInfoSharedPtr _AddLoadedTexture(
+        const std::string&   path,
+        MHWRender::MTexture* texture,
+        bool                 isColorSpaceSRGB,
+        const MFloatArray&   uvScaleOffset,
+        unsigned int         maxDimension);
+
+    //! Drop the texture so it gets acquired again at the next sync.
+    void _ReleaseTexture(const std::string& path);
+    //! Sync this material again so that its shaders get the latest textures.
+    void _MarkResourceDirty();
+
+    static void _EnforceTextureMemoryBudget();
+
+    //! Record the materials drawing with a surface shader, to stamp their textures when drawn.
+    static void _TrackSurfaceShader(MHWRender::MShaderInstance*, HdVP2Material*);
+    static void _UntrackSurfaceShader(MHWRender::MShaderInstance*, HdVP2Material*);
+    static void _OnSurfaceShaderDraw(
+        MHWRender::MDrawContext&,
+        const MHWRender::MRenderItemList&,
+        MHWRender::MShaderInstance*);
 
     //! Trigger sync on all Rprims which are listening to changes on this material.
     void _MaterialChanged(HdSceneDelegate* sceneDelegate);
 
     static void _ScheduleRefresh();
 
+#ifdef WANT_MATERIALX_BUILD
+    //! Sync the materials waiting for MaterialX fragments generated on worker threads.
+    static void _OnMaterialXFragmentsGenerated(void*);
+#endif
+
     NetworkConfig _GetCompiledConfig(const TfToken& reprToken) const;
 
     static std::mutex                            _refreshMutex;
@@ -196,6 +257,15 @@ private:
     static HdVP2GlobalTextureMap _globalTextureMap; //!< Texture in use by all materials in MayaUSD
     HdVP2LocalTextureMap         _localTextureMap;  //!< Textures used by this material
 
+    //! Resolution clamps applied to the textures to stay within the texture memory budget
+    static std::unordered_map<std::string, unsigned int> _textureMaxDimensions;
+    //! Incremented each time a texture is drawn or acquired, used to find the least recently
+    //! used ones
+    static uint64_t _textureUseStamp;
+    //! Materials drawing with each surface shader, tracked only with a texture memory budget
+    static std::unordered_map<const MHWRender::MShaderInstance*, std::multiset<HdVP2Material*>>
+        _surfaceShaderUsers;
+
     std::unordered_map<std::string, TextureLoadingTask*> _textureLoadingTasks;
 
     //! Mutex protecting concurrent access to the Rprim set
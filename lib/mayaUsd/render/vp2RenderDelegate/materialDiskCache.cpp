@@ -0,0 +1,273 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "materialDiskCache.h"
+
+#include <pxr/base/arch/hash.h>
+#include <pxr/base/arch/systemInfo.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <maya/MTypes.h>
+#include <maya/MViewport2Renderer.h>
+
+#ifdef WANT_MATERIALX_BUILD
+#include <MaterialXCore/Util.h>
+#endif
+
+#include <ghc/filesystem.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_MATERIAL_CACHE_DIR,
+    "",
+    "Directory where the VP2 render delegate stores the shader fragments generated for material "
+    "networks so they can be reused by later Maya sessions. Caching is disabled when empty.");
+
+namespace {
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+
+// Bump this version whenever the content of a cache entry changes meaning.
+const int kCacheFormatVersion = 2;
+
+const std::string kFormatVersionKey = "formatVersion";
+const std::string kFragmentNameKey = "fragmentName";
+const std::string kFragmentSourceKey = "fragmentSource";
+const std::string kLightRigNameKey = "lightRigName";
+const std::string kLightRigSourceKey = "lightRigSource";
+const std::string kRequiredPrimvarsKey = "requiredPrimvars";
+const std::string kPathInputMapKey = "pathInputMap";
+const std::string kIsTransparentKey = "isTransparent";
+
+const std::string& _GetCacheDir()
+{
+    static const std::string cacheDir = TfGetEnvSetting(MAYAUSD_VP2_MATERIAL_CACHE_DIR);
+    return cacheDir;
+}
+
+ghc::filesystem::path _GetEntryPath(const std::string& key)
+{
+    ghc::filesystem::path path(_GetCacheDir());
+    path /= key + ".json";
+    return path;
+}
+
+//! Return a string identifying everything besides the network which affects fragment generation.
+std::string _GetConfigurationString()
+{
+    std::string config = TfStringPrintf("maya:%d", MAYA_API_VERSION);
+
+#ifdef WANT_MATERIALX_BUILD
+    config += ";mtlx:" + MaterialX::getVersionString();
+#endif
+
+    // The fragment generators are part of mayaUsd.
+#ifdef MAYAUSD_VERSION
+    config += ";mayaUsd:" TOSTRING(MAYAUSD_VERSION);
+#endif
+
+    if (MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer()) {
+        config += TfStringPrintf(";drawAPI:%d", static_cast<int>(renderer->drawAPI()));
+    }
+
+    config += TfStringPrintf(";format:%d", kCacheFormatVersion);
+    return config;
+}
+
+} // namespace
+
+bool HdVP2MaterialDiskCache::IsEnabled() { return !_GetCacheDir().empty(); }
+
+std::string
+HdVP2MaterialDiskCache::ComputeLibraryFingerprint(const std::vector<std::string>& directories)
+{
+    // Sort the files so that the fingerprint doesn't depend on the iteration order of the file
+    // system.
+    std::vector<std::string> files;
+    for (const std::string& directory : directories) {
+        std::error_code errorCode;
+        for (ghc::filesystem::recursive_directory_iterator it(directory, errorCode), end;
+             !errorCode && it != end;
+             it.increment(errorCode)) {
+            std::error_code entryErrorCode;
+            if (!it->is_regular_file(entryErrorCode)) {
+                continue;
+            }
+            const auto size = it->file_size(entryErrorCode);
+            const auto time = it->last_write_time(entryErrorCode);
+            files.push_back(TfStringPrintf(
+                "%s;%llu;%lld",
+                it->path().string().c_str(),
+                static_cast<unsigned long long>(size),
+                static_cast<long long>(time.time_since_epoch().count())));
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    uint64_t hash = 0;
+    for (const std::string& file : files) {
+        hash = ArchHash64(file.c_str(), file.size(), hash);
+    }
+    return TfStringPrintf("%016llx", static_cast<unsigned long long>(hash));
+}
+
+std::string HdVP2MaterialDiskCache::ComputeKey(
+    const std::string& networkId,
+    const std::string& libraryFingerprint)
+{
+    static const std::string config = _GetConfigurationString();
+
+    // ArchHash64 is stable across sessions and platforms, unlike std::hash.
+    uint64_t hash = ArchHash64(config.c_str(), config.size());
+    hash = ArchHash64(libraryFingerprint.c_str(), libraryFingerprint.size(), hash);
+    hash = ArchHash64(networkId.c_str(), networkId.size(), hash);
+    return TfStringPrintf("%016llx", static_cast<unsigned long long>(hash));
+}
+
+bool HdVP2MaterialDiskCache::Load(const std::string& key, Entry& entry)
+{
+    if (!IsEnabled()) {
+        return false;
+    }
+
+    std::ifstream stream(_GetEntryPath(key).string());
+    if (!stream) {
+        return false;
+    }
+
+    JsParseError  error;
+    const JsValue value = JsParseStream(stream, &error);
+    if (!value.IsObject()) {
+        TF_WARN(
+            "Ignoring invalid VP2 material cache entry %s (line %u, column %u): %s",
+            key.c_str(),
+            error.line,
+            error.column,
+            error.reason.c_str());
+        return false;
+    }
+
+    const JsObject& object = value.GetJsObject();
+
+    auto get = [&object](const std::string& name) -> const JsValue* {
+        auto it = object.find(name);
+        return it == object.end() ? nullptr : &it->second;
+    };
+
+    const JsValue* version = get(kFormatVersionKey);
+    const JsValue* name = get(kFragmentNameKey);
+    const JsValue* source = get(kFragmentSourceKey);
+    const JsValue* lightRigName = get(kLightRigNameKey);
+    const JsValue* lightRigSource = get(kLightRigSourceKey);
+    const JsValue* primvars = get(kRequiredPrimvarsKey);
+    const JsValue* pathInputMap = get(kPathInputMapKey);
+    const JsValue* isTransparent = get(kIsTransparentKey);
+    if (!version || !version->IsInt() || version->GetInt() != kCacheFormatVersion || !name
+        || !name->IsString() || !source || !source->IsString() || !primvars
+        || !primvars->IsArray() || !pathInputMap || !pathInputMap->IsObject() || !isTransparent
+        || !isTransparent->IsBool() || !lightRigName || !lightRigName->IsString()
+        || !lightRigSource || !lightRigSource->IsString()) {
+        return false;
+    }
+
+    entry._fragmentName = name->GetString();
+    entry._fragmentSource = source->GetString();
+    entry._lightRigName = lightRigName->GetString();
+    entry._lightRigSource = lightRigSource->GetString();
+    entry._isTransparent = isTransparent->GetBool();
+
+    entry._requiredPrimvars.clear();
+    for (const JsValue& primvar : primvars->GetJsArray()) {
+        if (primvar.IsString()) {
+            entry._requiredPrimvars.emplace_back(primvar.GetString());
+        }
+    }
+
+    entry._pathInputMap.clear();
+    for (const auto& input : pathInputMap->GetJsObject()) {
+        if (input.second.IsString()) {
+            entry._pathInputMap.emplace_back(input.first, input.second.GetString());
+        }
+    }
+
+    return !entry._fragmentName.empty() && !entry._fragmentSource.empty();
+}
+
+void HdVP2MaterialDiskCache::Store(const std::string& key, const Entry& entry)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+
+    std::error_code errorCode;
+    ghc::filesystem::create_directories(_GetCacheDir(), errorCode);
+    if (errorCode) {
+        TF_WARN(
+            "Unable to create VP2 material cache directory %s: %s",
+            _GetCacheDir().c_str(),
+            errorCode.message().c_str());
+        return;
+    }
+
+    JsArray primvars;
+    for (const TfToken& primvar : entry._requiredPrimvars) {
+        primvars.emplace_back(primvar.GetString());
+    }
+
+    JsObject pathInputMap;
+    for (const auto& input : entry._pathInputMap) {
+        pathInputMap[input.first] = JsValue(input.second);
+    }
+
+    JsObject object;
+    object[kFormatVersionKey] = JsValue(kCacheFormatVersion);
+    object[kFragmentNameKey] = JsValue(entry._fragmentName);
+    object[kFragmentSourceKey] = JsValue(entry._fragmentSource);
+    object[kLightRigNameKey] = JsValue(entry._lightRigName);
+    object[kLightRigSourceKey] = JsValue(entry._lightRigSource);
+    object[kRequiredPrimvarsKey] = JsValue(primvars);
+    object[kPathInputMapKey] = JsValue(pathInputMap);
+    object[kIsTransparentKey] = JsValue(entry._isTransparent);
+
+    // Write to a temporary file first and rename it, so that concurrent Maya sessions sharing
+    // the same cache directory never read a partially written entry.
+    const ghc::filesystem::path entryPath = _GetEntryPath(key);
+    ghc::filesystem::path       tmpPath = entryPath;
+    tmpPath += TfStringPrintf(".%d.tmp", ArchGetProcessId());
+    {
+        std::ofstream stream(tmpPath.string());
+        if (!stream) {
+            TF_WARN("Unable to write VP2 material cache entry %s", tmpPath.string().c_str());
+            return;
+        }
+        JsWriteToStream(JsValue(object), stream);
+    }
+
+    ghc::filesystem::rename(tmpPath, entryPath, errorCode);
+    if (errorCode) {
+        ghc::filesystem::remove(tmpPath, errorCode);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
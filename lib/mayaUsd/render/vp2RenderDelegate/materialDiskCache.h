@@ -0,0 +1,81 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MATERIAL_DISK_CACHE
+#define HD_VP2_MATERIAL_DISK_CACHE
+
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Optional persistent cache of the shader fragments generated for material networks.
+    \class  HdVP2MaterialDiskCache
+
+    Generating the OGS fragment of a MaterialX network is expensive, and the result only depends
+    on the network topology, the Maya version and the VP2 draw API. When the
+    MAYAUSD_VP2_MATERIAL_CACHE_DIR environment variable points to a directory, the generated
+    fragment XML and the parameter mapping are stored there so that the next Maya session only
+    has to register the fragment and link the shader instance.
+
+    The cache is keyed by a stable hash of the network identifier combined with the Maya API
+    version, the MaterialX version, the mayaUsd version, the VP2 draw API and a fingerprint of the
+    shader library files, so entries produced by a different configuration are never reused.
+*/
+class HdVP2MaterialDiskCache
+{
+public:
+    //! Data needed to recreate a shader instance without regenerating the fragment.
+    struct Entry
+    {
+        std::string   _fragmentName;     //!< Name of the generated fragment
+        std::string   _fragmentSource;   //!< XML source of the generated fragment
+        std::string   _lightRigName;     //!< Name of the light rig graph, if any
+        std::string   _lightRigSource;   //!< XML source of the light rig graph, if any
+        TfTokenVector _requiredPrimvars; //!< Primvars found while exploring vertex inputs
+        std::vector<std::pair<std::string, std::string>>
+             _pathInputMap;            //!< Mapping from node paths to fragment input names
+        bool _isTransparent { false }; //!< Transparency of the generated fragment
+    };
+
+    //! Return true if a cache directory has been configured.
+    static bool IsEnabled();
+
+    /*! \brief  Compute a fingerprint of the files found in the given library directories.
+
+        The fingerprint changes when a file is added, removed, resized or modified. It only
+        inspects the file system metadata, the files are not read.
+    */
+    static std::string ComputeLibraryFingerprint(const std::vector<std::string>& directories);
+
+    //! Compute the cache key of a material network from its identifier string and the
+    //! fingerprint of the libraries used to generate its fragment.
+    static std::string
+    ComputeKey(const std::string& networkId, const std::string& libraryFingerprint);
+
+    //! Load the entry with the given key. Return false if the entry is missing or invalid.
+    static bool Load(const std::string& key, Entry& entry);
+
+    //! Store the entry with the given key. Failures are reported as warnings only.
+    static void Store(const std::string& key, const Entry& entry);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_MATERIAL_DISK_CACHE
@@ -16,11 +16,17 @@
 
 #include "mayaPrimCommon.h"
 
+#include "bboxBatch.h"
 #include "bboxGeom.h"
 #include "material.h"
+#include "playbackPrefetcher.h"
+#include "renderStats.h"
 #include "render_delegate.h"
 #include "tokens.h"
+#include "vertexBufferCache.h"
 
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/imaging/hd/perfLog.h>
 #include <pxr/usdImaging/usdImaging/delegate.h>
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
@@ -113,7 +119,10 @@ void MayaUsdRPrim::_CommitMVertexBuffer(MHWRender::MVertexBuffer* const buffer,
     const MString& rprimId = _rprimId;
 
     _delegate->GetVP2ResourceRegistry().EnqueueCommit(
-        [buffer, bufferData, rprimId]() { buffer->commit(bufferData); });
+        [buffer, bufferData, rprimId]() {
+            buffer->commit(bufferData);
+            HdVP2RenderStats::AddVertexBufferUpload(*buffer);
+        });
 }
 
 void MayaUsdRPrim::_SetWantConsolidation(MHWRender::MRenderItem& renderItem, bool state)
@@ -313,6 +322,111 @@ TfToken MayaUsdRPrim::_GetOverrideToken(TfToken const& reprToken) const
     return TfToken();
 }
 
+void MayaUsdRPrim::_UpdateWorldBounds(
+    HdSceneDelegate* delegate,
+    const SdfPath&   id,
+    HdDirtyBits      dirtyBits)
+{
+    if (!_worldBoundsValid
+        || (dirtyBits & (HdChangeTracker::DirtyExtent | HdChangeTracker::DirtyTransform))) {
+        const GfBBox3d bounds(delegate->GetExtent(id), delegate->GetTransform(id));
+        _worldBounds = bounds.ComputeAlignedRange();
+        _worldBoundsValid = true;
+    }
+}
+
+bool MayaUsdRPrim::_EvaluateScreenSizeLod(const ProxyRenderDelegate& drawScene) const
+{
+    const float lodScreenSize = drawScene.GetBoundsLodScreenSize();
+    if (lodScreenSize <= 0.0f || !_worldBoundsValid) {
+        return false;
+    }
+
+    // Small hysteresis so prims close to the threshold don't flicker while tumbling.
+    constexpr float kHysteresis = 1.1f;
+    const float     screenSize = drawScene.GetScreenSize(_worldBounds);
+    return screenSize < (_screenSizeLodBBox ? lodScreenSize * kHysteresis : lodScreenSize);
+}
+
+bool MayaUsdRPrim::IsScreenSizeLodDirty(const ProxyRenderDelegate& drawScene) const
+{
+    return _EvaluateScreenSizeLod(drawScene) != _screenSizeLodBBox;
+}
+
+bool MayaUsdRPrim::IsScreenSizeLodActive(const ProxyRenderDelegate& drawScene) const
+{
+    return drawScene.GetBoundsLodScreenSize() > 0.0f;
+}
+
+/*! \brief  Register the prim to the ProxyRenderDelegate, which marks it dirty when a change of
+            the view changes its screen size LOD state.
+*/
+void MayaUsdRPrim::_TrackScreenSizeLod(const SdfPath& id)
+{
+    if (_screenSizeLodTracked) {
+        return;
+    }
+    _screenSizeLodTracked = true;
+
+    auto* const          param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+    ProxyRenderDelegate& drawScene = param->GetDrawScene();
+
+    // AddScreenSizeLodRprim is not multithread-safe, so enqueue the call
+    _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+        [&drawScene, id]() { drawScene.AddScreenSizeLodRprim(id); });
+}
+
+/*! \brief  Return the vertex buffer cache if the points being updated changed with the time.
+
+    Call only when the points are dirty. Points updated at the same time changed because of an
+    edit, and the first update of the prim doesn't tell whether it is animated, neither of them
+    use the cache.
+
+    \param  id         Id of the rprim.
+    \param  time       Set to the time the points are updated at.
+    \param  cacheKey   Set to the path identifying the rprim in the cache, the USD path when the
+                       cache is shared by the proxy shapes displaying the stage.
+*/
+HdVP2VertexBufferCache*
+MayaUsdRPrim::_GetVertexBufferCache(const SdfPath& id, UsdTimeCode& time, SdfPath& cacheKey)
+{
+    auto* const          param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+    ProxyRenderDelegate& drawScene = param->GetDrawScene();
+
+    HdVP2VertexBufferCache* cache = drawScene.GetVertexBufferCache();
+    if (!cache) {
+        return nullptr;
+    }
+
+    time = drawScene.GetUsdImagingDelegate()->GetTime();
+    const UsdTimeCode previousTime = _vertexBuffersTime;
+    _vertexBuffersTime = time;
+
+    cacheKey = HdVP2RenderDelegate::IsStageBufferSharingEnabled()
+        ? drawScene.GetUsdImagingDelegate()->ConvertIndexPathToCachePath(id)
+        : id;
+
+    return (!previousTime.IsDefault() && previousTime != time) ? cache : nullptr;
+}
+
+/*! \brief  Return the batch drawing the bounding box of the render item, nullptr when the render
+            item draws it on its own.
+
+    Instanced rprims already draw all their bounding boxes with one render item, and the items
+    drawn in other display modes because of a bounding box override are left out.
+*/
+HdVP2BBoxBatch* MayaUsdRPrim::_GetBBoxBatch(
+    const MHWRender::MRenderItem& renderItem,
+    const SdfPath&                instancerId) const
+{
+    if (renderItem.drawMode() != MHWRender::MGeometry::kBoundingBox || !instancerId.IsEmpty()) {
+        return nullptr;
+    }
+
+    auto* const param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+    return param->GetDrawScene().GetBBoxBatch();
+}
+
 TfToken MayaUsdRPrim::_GetMaterialNetworkToken(const TfToken& reprToken) const
 {
     return _displayLayerModes._texturing ? reprToken : TfToken();
@@ -568,45 +682,27 @@ MHWRender::MRenderItem* MayaUsdRPrim::_CreatePointsRenderItem(
 }
 #endif
 
-/*! \brief Hide all of the repr objects for this Rprim except the named repr.
-    Repr objects are created to support specific reprName tokens, and contain a list of
-    HdVP2DrawItems and corresponding RenderItems.
+/*! \brief  Hide the render items of a repr.
+
+    Render items which are already hidden are skipped, hiding a large branch again and again only
+    costs a visit of its render items. Bounding boxes drawn by the batch are removed from it.
 */
-void MayaUsdRPrim::_MakeOtherReprRenderItemsInvisible(
-    const TfToken&    reprToken,
-    const ReprVector& reprs)
+void MayaUsdRPrim::_HideAllDrawItems(HdReprSharedPtr const& curRepr)
 {
-    for (const std::pair<TfToken, HdReprSharedPtr>& pair : reprs) {
-        if (pair.first != reprToken) {
-            // For each relevant draw item, update dirty buffer sources.
-            const HdReprSharedPtr& repr = pair.second;
-            const auto&            items = repr->GetDrawItems();
+    auto* const     param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+    HdVP2BBoxBatch* bboxBatch = param->GetDrawScene().GetBBoxBatch();
 
-#if HD_API_VERSION < 35
-            for (HdDrawItem* item : items) {
-                if (HdVP2DrawItem* drawItem = static_cast<HdVP2DrawItem*>(item)) {
-#else
-            for (const HdRepr::DrawItemUniquePtr& item : items) {
-                if (HdVP2DrawItem* const drawItem = static_cast<HdVP2DrawItem*>(item.get())) {
-#endif
-                    for (auto& renderItemData : drawItem->GetRenderItems()) {
-                        _delegate->GetVP2ResourceRegistry().EnqueueCommit([&renderItemData]() {
-                            renderItemData._enabled = false;
-                            renderItemData._renderItem->enable(false);
-                        });
-                    }
-                }
-            }
+    RenderItemFunc hideDrawItem = [this, bboxBatch](HdVP2DrawItem::RenderItemData& renderItemData) {
+        if (!renderItemData._enabled) {
+            return;
         }
-    }
-}
-
-void MayaUsdRPrim::_HideAllDrawItems(HdReprSharedPtr const& curRepr)
-{
-    RenderItemFunc hideDrawItem = [this](HdVP2DrawItem::RenderItemData& renderItemData) {
         renderItemData._enabled = false;
-        _delegate->GetVP2ResourceRegistry().EnqueueCommit(
-            [&]() { renderItemData._renderItem->enable(false); });
+        _delegate->GetVP2ResourceRegistry().EnqueueCommit([&renderItemData, bboxBatch]() {
+            renderItemData._renderItem->enable(false);
+            if (bboxBatch) {
+                bboxBatch->Remove(*renderItemData._renderItem);
+            }
+        });
     };
 
     _ForEachRenderItemInRepr(curRepr, hideDrawItem);
@@ -641,6 +737,37 @@ void MayaUsdRPrim::_ForEachRenderItem(const ReprVector& reprs, RenderItemFunc& f
     }
 }
 
+/*! \brief  Add the index buffers and the shaders of the render items of all the reprs.
+
+    The index buffers of shared rendering topologies are counted for the first prim using them.
+*/
+void MayaUsdRPrim::_GetRenderItemsMemoryUsage(
+    const ReprVector&     reprs,
+    HdVP2MemoryUsage&     usage,
+    HdVP2PrimMemoryUsage& prim) const
+{
+    for (const std::pair<TfToken, HdReprSharedPtr>& pair : reprs) {
+        if (!pair.second) {
+            continue;
+        }
+
+        const auto& items = pair.second->GetDrawItems();
+#if HD_API_VERSION < 35
+        for (HdDrawItem* item : items) {
+            if (const HdVP2DrawItem* drawItem = static_cast<HdVP2DrawItem*>(item)) {
+#else
+        for (const HdRepr::DrawItemUniquePtr& item : items) {
+            if (const HdVP2DrawItem* const drawItem = static_cast<HdVP2DrawItem*>(item.get())) {
+#endif
+                for (const auto& renderItemData : drawItem->GetRenderItems()) {
+                    usage.AddIndexBuffer(prim, renderItemData._indexBuffer.get());
+                    usage.AddShader(renderItemData._shader);
+                }
+            }
+        }
+    }
+}
+
 void MayaUsdRPrim::_UpdatePrimvarSourcesGeneric(
     HdSceneDelegate*       sceneDelegate,
     HdDirtyBits            dirtyBits,
@@ -681,6 +808,16 @@ void MayaUsdRPrim::_UpdatePrimvarSourcesGeneric(
     }
 
     const SdfPath& id = refThis.GetId();
+
+    // Values of time-varying primvars may have been resolved ahead of time during playback.
+    // Instanced rprims read their primvars through the instancer and are not prefetched.
+    auto* const              param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+    ProxyRenderDelegate&     drawScene = param->GetDrawScene();
+    HdVP2PlaybackPrefetcher* prefetcher = drawScene.GetPlaybackPrefetcher();
+    if (prefetcher && (!prefetcher->IsActive() || !instancerId.IsEmpty())) {
+        prefetcher = nullptr;
+    }
+
     for (size_t i = 0; i < HdInterpolationCount; i++) {
         const HdInterpolation           interp = static_cast<HdInterpolation>(i);
         const HdPrimvarDescriptorVector primvars
@@ -692,7 +829,16 @@ void MayaUsdRPrim::_UpdatePrimvarSourcesGeneric(
                 erasePrimvarInfo(pv.name);
             } else {
                 if (HdChangeTracker::IsPrimvarDirty(dirtyBits, id, pv.name)) {
-                    const VtValue value = refThis.GetPrimvar(sceneDelegate, pv.name);
+                    VtValue value;
+                    if (!prefetcher
+                        || !prefetcher->Consume(
+                            id,
+                            drawScene.GetScenePrimPath(id, UsdImagingDelegate::ALL_INSTANCES),
+                            pv.name,
+                            drawScene.GetUsdImagingDelegate()->GetTime(),
+                            value)) {
+                        value = refThis.GetPrimvar(sceneDelegate, pv.name);
+                    }
                     updatePrimvarInfo(pv.name, value, interp);
                 }
             }
@@ -796,6 +942,16 @@ void MayaUsdRPrim::_SyncDisplayLayerModes(SdfPath const& id)
     _displayLayerModesFrame = drawScene.GetFrameCounter();
     auto usdPath = drawScene.GetScenePrimPath(id, UsdImagingDelegate::ALL_INSTANCES);
     _PopulateDisplayLayerModes(usdPath, _displayLayerModes, drawScene);
+
+    // Prims with a small screen size are drawn as their bounds, the same way as with the level of
+    // detail of display layers.
+    if (drawScene.GetBoundsLodScreenSize() > 0.0f) {
+        _UpdateWorldBounds(drawScene.GetUsdImagingDelegate(), id, HdChangeTracker::Clean);
+    }
+    _screenSizeLodBBox = _EvaluateScreenSizeLod(drawScene);
+    if (_screenSizeLodBBox) {
+        _displayLayerModes._reprOverride = kBBox;
+    }
 }
 
 void MayaUsdRPrim::_SyncDisplayLayerModesInstanced(SdfPath const& id, unsigned int instanceCount)
@@ -831,7 +987,7 @@ void MayaUsdRPrim::_SyncSharedData(
     HdRprimSharedData& sharedData,
     HdSceneDelegate*   delegate,
     HdDirtyBits const* dirtyBits,
-    TfToken const&     reprToken,
+    TfToken const&     /*reprToken*/,
     HdRprim const&     refThis,
     ReprVector const&  reprs,
     TfToken const&     renderTag)
@@ -847,15 +1003,9 @@ void MayaUsdRPrim::_SyncSharedData(
     }
 
     if (HdChangeTracker::IsVisibilityDirty(*dirtyBits, id)) {
+        // Invisible rprims are handled by _SyncCommon() and never get here.
         sharedData.visible = delegate->GetVisible(id) && _displayLayerModes._visibility;
 
-        // Invisible rprims don't get calls to Sync or _PropagateDirtyBits while
-        // they are invisible. This means that when a prim goes from visible to
-        // invisible that we must update every repr, because if we switch reprs while
-        // invisible we'll get no chance to update!
-        if (!sharedData.visible)
-            _MakeOtherReprRenderItemsInvisible(reprToken, reprs);
-
         // Update "hide on playback" status
         if (_hideOnPlayback != _displayLayerModes._hideOnPlayback) {
             _hideOnPlayback = _displayLayerModes._hideOnPlayback;
@@ -904,9 +1054,11 @@ void MayaUsdRPrim::_SyncSharedData(
 
 bool MayaUsdRPrim::_SyncCommon(
     HdRprim&               refThis,
+    HdRprimSharedData&     sharedData,
     HdSceneDelegate*       delegate,
     HdRenderParam*         renderParam,
     HdDirtyBits*           dirtyBits,
+    ReprVector const&      reprs,
     HdReprSharedPtr const& curRepr,
     TfToken const&         reprToken)
 {
@@ -934,7 +1086,20 @@ bool MayaUsdRPrim::_SyncCommon(
     // of the ProxyRenderDelegate. In additional, we need to hide any already
     // existing render items because they should not be drawn.
     HdRenderIndex& renderIndex = delegate->GetRenderIndex();
-    if (!drawScene.DrawRenderTag(renderIndex.GetRenderTag(id))) {
+    const TfToken& renderTag = renderIndex.GetRenderTag(id);
+
+    // Keep the render tag buckets of the ProxyRenderDelegate up to date, so toggling the display
+    // of a purpose only visits the rprims of the matching tag.
+    if (renderTag != _bucketRenderTag) {
+        // UpdateRenderTagEntry is not multithread-safe, so enqueue the call
+        _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+            [&drawScene, id, oldRenderTag = _bucketRenderTag, renderTag]() {
+                drawScene.UpdateRenderTagEntry(oldRenderTag, renderTag, id);
+            });
+        _bucketRenderTag = renderTag;
+    }
+
+    if (!drawScene.DrawRenderTag(renderTag)) {
         _HideAllDrawItems(curRepr);
         *dirtyBits &= ~(
             HdChangeTracker::DirtyRenderTag
@@ -945,6 +1110,42 @@ bool MayaUsdRPrim::_SyncCommon(
         return false;
     }
 
+    // Invisible rprims are not synchronized: all their render items are hidden and their other
+    // dirty bits are left untouched. Hydra skips them until they are visible again, the changes
+    // made in the meantime are then synchronized at once, for the reprs in use at that time.
+    if (HdChangeTracker::IsVisibilityDirty(*dirtyBits, id)) {
+        sharedData.visible = delegate->GetVisible(id) && _displayLayerModes._visibility;
+    }
+    if (!sharedData.visible) {
+        for (const std::pair<TfToken, HdReprSharedPtr>& pair : reprs) {
+            _HideAllDrawItems(pair.second);
+        }
+        *dirtyBits &= ~HdChangeTracker::DirtyVisibility;
+        return false;
+    }
+
+    // Instanced rprims are neither culled nor affected by the screen size LOD since their extent
+    // doesn't account for the instance transforms.
+    if (refThis.GetInstancerId().IsEmpty()) {
+        if (drawScene.IsFrustumCullingActive() || drawScene.GetBoundsLodScreenSize() > 0.0f) {
+            _UpdateWorldBounds(delegate, id, *dirtyBits);
+        }
+        if (drawScene.GetBoundsLodScreenSize() > 0.0f) {
+            _TrackScreenSizeLod(id);
+        }
+
+        // Skip rprims outside of the view frustum. Their dirty bits are left untouched and the
+        // ProxyRenderDelegate marks them dirty again when the view changes, so they get
+        // synchronized, and get their render items, as soon as they come back into view.
+        if (drawScene.IsFrustumCullingActive() && drawScene.IsOutsideViewFrustum(_worldBounds)) {
+            // AddCulledRprim is not multithread-safe, so enqueue the call
+            _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+                [&drawScene, id]() { drawScene.AddCulledRprim(id); });
+            return false;
+        }
+    }
+
+    HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2RprimsSynced);
     return true;
 }
 
@@ -17,8 +17,10 @@
 #define HD_VP2_MAYA_PRIM_COMMON
 
 #include "draw_item.h"
+#include "memoryUsage.h"
 #include "pxr/imaging/hd/changeTracker.h"
 #include "pxr/imaging/hd/types.h"
+#include "pxr/usd/usd/timeCode.h"
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
@@ -30,7 +32,9 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdVP2BBoxBatch;
 class HdVP2RenderDelegate;
+class HdVP2VertexBufferCache;
 
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
 // Each instanced render item needs to map from a Maya instance id
@@ -100,6 +104,10 @@ struct MayaUsdCommitState
     //! transforms
     std::shared_ptr<MMatrixArray> _instanceTransforms;
 
+    //! Indices of the instance transforms which changed since the last commit, all of them
+    //! changed when empty
+    std::vector<unsigned int> _changedInstanceTransforms;
+
     //! Color parameter that _instanceColors should be bound to
     MString _instanceColorParam;
 
@@ -165,6 +173,18 @@ public:
     MayaUsdRPrim(HdVP2RenderDelegate* delegate, const SdfPath& id);
     virtual ~MayaUsdRPrim() = default;
 
+    //! Return true when the screen size LOD state of the prim doesn't match the current view
+    virtual bool IsScreenSizeLodDirty(const ProxyRenderDelegate& drawScene) const;
+
+    //! Return true when the display of the prim depends on its screen size in the current view
+    virtual bool IsScreenSizeLodActive(const ProxyRenderDelegate& drawScene) const;
+
+    //! Called by the ProxyRenderDelegate when it stops checking the screen size of the prim
+    void ResetScreenSizeLodTracking() { _screenSizeLodTracked = false; }
+
+    //! Add the memory used by the cached scene data and the VP2 resources of the prim
+    virtual void GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const = 0;
+
 protected:
     using ReprVector = std::vector<std::pair<TfToken, HdReprSharedPtr>>;
     using RenderItemFunc = std::function<void(HdVP2DrawItem::RenderItemData&)>;
@@ -239,6 +259,16 @@ protected:
 
     TfToken _GetOverrideToken(TfToken const& reprToken) const;
 
+    void _UpdateWorldBounds(HdSceneDelegate* delegate, const SdfPath& id, HdDirtyBits dirtyBits);
+    bool _EvaluateScreenSizeLod(const ProxyRenderDelegate& drawScene) const;
+    void _TrackScreenSizeLod(const SdfPath& id);
+
+    HdVP2VertexBufferCache*
+    _GetVertexBufferCache(const SdfPath& id, UsdTimeCode& time, SdfPath& cacheKey);
+
+    HdVP2BBoxBatch*
+    _GetBBoxBatch(const MHWRender::MRenderItem& renderItem, const SdfPath& instancerId) const;
+
     TfToken _GetMaterialNetworkToken(const TfToken& reprToken) const;
 
     HdReprSharedPtr _InitReprCommon(
@@ -250,9 +280,11 @@ protected:
 
     bool _SyncCommon(
         HdRprim&               refThis,
+        HdRprimSharedData&     sharedData,
         HdSceneDelegate*       delegate,
         HdRenderParam*         renderParam,
         HdDirtyBits*           dirtyBits,
+        ReprVector const&      reprs,
         HdReprSharedPtr const& curRepr,
         TfToken const&         reprToken);
 
@@ -291,13 +323,16 @@ protected:
 
     void _PropagateDirtyBitsCommon(HdDirtyBits& bits, const ReprVector& reprs) const;
 
-    void _MakeOtherReprRenderItemsInvisible(const TfToken&, const ReprVector&);
-
     void _HideAllDrawItems(HdReprSharedPtr const& curRepr);
 
     void _ForEachRenderItemInRepr(const HdReprSharedPtr& curRepr, RenderItemFunc& func);
     void _ForEachRenderItem(const ReprVector& reprs, RenderItemFunc& func);
 
+    void _GetRenderItemsMemoryUsage(
+        const ReprVector&     reprs,
+        HdVP2MemoryUsage&     usage,
+        HdVP2PrimMemoryUsage& prim) const;
+
     //! Helper utility function to adapt Maya API changes.
     static void _SetWantConsolidation(MHWRender::MRenderItem& renderItem, bool state);
 
@@ -361,6 +396,23 @@ protected:
 
     //! For instanced prim, holds the corresponding path in USD prototype
     SdfPath _pathInPrototype;
+
+    //! Render tag under which the prim is registered in the ProxyRenderDelegate buckets
+    TfToken _bucketRenderTag;
+
+    //! World extent used for view frustum culling and screen size LOD, refreshed while extent or
+    //! transform are dirty
+    GfRange3d _worldBounds;
+    bool      _worldBoundsValid { false };
+
+    //! Whether the prim is drawn as its bounds because of its small screen size
+    bool _screenSizeLodBBox { false };
+
+    //! Whether the ProxyRenderDelegate checks the screen size of the prim when the view changes
+    bool _screenSizeLodTracked { false };
+
+    //! Time of the last points update, points updated at a new time use the vertex buffer cache
+    UsdTimeCode _vertexBuffersTime { UsdTimeCode::Default() };
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
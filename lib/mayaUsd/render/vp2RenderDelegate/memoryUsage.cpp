@@ -0,0 +1,116 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "memoryUsage.h"
+
+#include <pxr/imaging/hd/types.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Return the size in bytes of one element of the given data type.
+size_t _GetDataTypeSize(MHWRender::MGeometry::DataType dataType)
+{
+    switch (dataType) {
+    case MHWRender::MGeometry::kDouble: return 8;
+    case MHWRender::MGeometry::kChar:
+    case MHWRender::MGeometry::kUnsignedChar: return 1;
+    case MHWRender::MGeometry::kInt16:
+    case MHWRender::MGeometry::kUnsignedInt16: return 2;
+    default: return 4;
+    }
+}
+
+} // namespace
+
+size_t HdVP2GetBufferBytes(const MHWRender::MVertexBuffer& buffer)
+{
+    const MHWRender::MVertexBufferDescriptor& desc = buffer.descriptor();
+    return static_cast<size_t>(buffer.vertexCount()) * desc.dimension()
+        * _GetDataTypeSize(desc.dataType());
+}
+
+size_t HdVP2GetBufferBytes(const MHWRender::MIndexBuffer& buffer)
+{
+    return static_cast<size_t>(buffer.size()) * _GetDataTypeSize(buffer.dataType());
+}
+
+size_t HdVP2GetValueBytes(const VtValue& value)
+{
+    const HdTupleType tupleType = HdGetValueTupleType(value);
+    if (tupleType.type == HdTypeInvalid) {
+        return 0;
+    }
+    return HdDataSizeOfTupleType(tupleType);
+}
+
+void HdVP2MemoryUsage::AddVertexBuffer(
+    HdVP2PrimMemoryUsage&           prim,
+    const MHWRender::MVertexBuffer* buffer)
+{
+    if (CountOnce(buffer)) {
+        prim._vertexBufferBytes += HdVP2GetBufferBytes(*buffer);
+    }
+}
+
+void HdVP2MemoryUsage::AddIndexBuffer(
+    HdVP2PrimMemoryUsage&          prim,
+    const MHWRender::MIndexBuffer* buffer)
+{
+    if (CountOnce(buffer)) {
+        prim._indexBufferBytes += HdVP2GetBufferBytes(*buffer);
+    }
+}
+
+void HdVP2MemoryUsage::AddShader(const MHWRender::MShaderInstance* shader)
+{
+    if (CountOnce(shader)) {
+        ++_numShaders;
+    }
+}
+
+void HdVP2MemoryUsage::AddTexture(const void* texture, size_t numBytes)
+{
+    if (CountOnce(texture)) {
+        _textureBytes += numBytes;
+    }
+}
+
+void HdVP2MemoryUsage::AddPrim(const HdVP2PrimMemoryUsage& prim)
+{
+    _cpuBytes += prim._cpuBytes;
+    _vertexBufferBytes += prim._vertexBufferBytes;
+    _indexBufferBytes += prim._indexBufferBytes;
+    _prims.push_back(prim);
+}
+
+void HdVP2MemoryUsage::KeepLargestPrims(size_t maxPrims)
+{
+    const auto isLarger = [](const HdVP2PrimMemoryUsage& a, const HdVP2PrimMemoryUsage& b) {
+        return a.GetTotalBytes() > b.GetTotalBytes();
+    };
+
+    if (maxPrims < _prims.size()) {
+        std::partial_sort(_prims.begin(), _prims.begin() + maxPrims, _prims.end(), isLarger);
+        _prims.resize(maxPrims);
+    } else {
+        std::sort(_prims.begin(), _prims.end(), isLarger);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,99 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MEMORY_USAGE
+#define HD_VP2_MEMORY_USAGE
+
+#include <pxr/base/vt/value.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <maya/MHWGeometry.h>
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+namespace MHWRender {
+class MShaderInstance;
+}
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+//! Return the size in bytes of the data of a vertex buffer.
+size_t HdVP2GetBufferBytes(const MHWRender::MVertexBuffer& buffer);
+
+//! Return the size in bytes of the data of an index buffer.
+size_t HdVP2GetBufferBytes(const MHWRender::MIndexBuffer& buffer);
+
+//! Return the size in bytes of the data of a value holding an array of Hydra data types.
+size_t HdVP2GetValueBytes(const VtValue& value);
+
+//! Memory used by the VP2 resources of a rprim, in bytes
+struct HdVP2PrimMemoryUsage
+{
+    SdfPath _usdPath;                 //!< Path of the USD prim drawn by the rprim
+    size_t  _cpuBytes { 0 };          //!< Scene data and topology cached by the rprim
+    size_t  _vertexBufferBytes { 0 }; //!< VP2 vertex buffers of the rprim
+    size_t  _indexBufferBytes { 0 };  //!< VP2 index buffers of the rprim
+
+    size_t GetTotalBytes() const { return _cpuBytes + _vertexBufferBytes + _indexBufferBytes; }
+};
+
+/*! \brief  Memory used by the VP2 resources of a proxy shape.
+    \class  HdVP2MemoryUsage
+
+    The buffers, textures and shaders shared by several rprims or materials of the proxy shape
+    are only counted once, for the first rprim reporting them. Buffers shared with other proxy
+    shapes are counted for each of them.
+*/
+class HdVP2MemoryUsage
+{
+public:
+    //! Return true the first time a resource is reported, false once it was counted.
+    bool CountOnce(const void* resource) { return resource && _counted.insert(resource).second; }
+
+    //! Add the bytes of a vertex buffer of the rprim, unless already counted.
+    void AddVertexBuffer(HdVP2PrimMemoryUsage& prim, const MHWRender::MVertexBuffer* buffer);
+
+    //! Add the bytes of an index buffer of the rprim, unless already counted.
+    void AddIndexBuffer(HdVP2PrimMemoryUsage& prim, const MHWRender::MIndexBuffer* buffer);
+
+    //! Count a shader instance, unless already counted.
+    void AddShader(const MHWRender::MShaderInstance* shader);
+
+    //! Add the estimated size of a texture, unless already counted.
+    void AddTexture(const void* texture, size_t numBytes);
+
+    //! Add the rprim to the totals and to the list of prims.
+    void AddPrim(const HdVP2PrimMemoryUsage& prim);
+
+    //! Sort the prims from the largest to the smallest, keeping the given number of them.
+    void KeepLargestPrims(size_t maxPrims);
+
+    size_t _cpuBytes { 0 };                   //!< Scene data and topology cached by the rprims
+    size_t _vertexBufferBytes { 0 };          //!< VP2 vertex buffers
+    size_t _indexBufferBytes { 0 };           //!< VP2 index buffers
+    size_t _textureBytes { 0 };               //!< Estimated GPU memory of the textures
+    size_t _numShaders { 0 };                 //!< Number of distinct shader instances
+    std::vector<HdVP2PrimMemoryUsage> _prims; //!< Usage of each rprim
+
+private:
+    std::unordered_set<const void*> _counted; //!< Resources already counted
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_MEMORY_USAGE
@@ -15,24 +15,28 @@
 //
 #include "mesh.h"
 
+#include "bboxBatch.h"
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "instancer.h"
 #include "material.h"
+#include "meshViewportComputeBackend.h"
+#include "renderStats.h"
 #include "render_delegate.h"
 #include "tokens.h"
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 #include <mayaUsd/utils/colorSpace.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/getenv.h>
+#include <pxr/base/tf/staticTokens.h>
 #include <pxr/imaging/hd/extCompCpuComputation.h>
 #include <pxr/imaging/hd/extCompPrimvarBufferSource.h>
 #include <pxr/imaging/hd/extComputation.h>
 #include <pxr/imaging/hd/meshUtil.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
-#include <pxr/imaging/hd/smoothNormals.h>
 #include <pxr/imaging/hd/version.h>
 #include <pxr/imaging/hd/vertexAdjacency.h>
 #include <pxr/pxr.h>
@@ -46,6 +50,10 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <cmath>
 #include <numeric>
 #include <type_traits>
 
@@ -57,6 +65,48 @@ namespace {
 const TfTokenVector sFallbackShaderPrimvars
     = { HdTokens->displayColor, HdTokens->displayOpacity, HdTokens->normals };
 
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+// Inputs of the UsdSkelImaging skinning computation.
+// clang-format off
+TF_DEFINE_PRIVATE_TOKENS(
+    _skinningTokens,
+
+    (restPoints)
+    (geomBindXform)
+    (influences)
+    (numInfluencesPerComponent)
+    (hasConstantInfluences)
+    (primWorldToLocal)
+    (blendShapeOffsets)
+    (skinningXforms)
+    (skelLocalToWorld)
+    (skinningMethod)
+    (classicLinear)
+);
+// clang-format on
+
+//! Get an input of an ext computation, whether it comes from the scene or from another computation.
+VtValue _GetExtComputationInput(
+    HdSceneDelegate*        sceneDelegate,
+    const HdExtComputation& computation,
+    const TfToken&          name)
+{
+    for (const HdExtComputationInputDescriptor& input : computation.GetComputationInputs()) {
+        if (input.name == name) {
+            return sceneDelegate->GetExtComputationInput(
+                input.sourceComputationId, input.sourceComputationOutputName);
+        }
+    }
+
+    const TfTokenVector& sceneInputNames = computation.GetSceneInputNames();
+    if (std::find(sceneInputNames.begin(), sceneInputNames.end(), name) != sceneInputNames.end()) {
+        return sceneDelegate->GetExtComputationInput(computation.GetId(), name);
+    }
+
+    return VtValue();
+}
+#endif
+
 //! Helper utility function to fill primvar data to vertex buffer.
 template <class DEST_TYPE, class SRC_TYPE>
 void _FillPrimvarData(
@@ -215,6 +265,166 @@ void _FillPrimvarData(
     }
 }
 
+/*! \brief  Helper utility function to fill primvar data to a vertex buffer from the parallel fill
+            stage of the resource registry.
+
+    The vertex buffer memory must have been acquired already. The shared data is captured to
+    keep the topology and face vertex mapping alive until the fill task has been executed.
+*/
+template <class DEST_TYPE, class SRC_TYPE>
+void _EnqueueFillPrimvarData(
+    HdVP2ResourceRegistry&                      registry,
+    DEST_TYPE*                                  vertexBuffer,
+    const std::shared_ptr<HdVP2MeshSharedData>& meshSharedData,
+    const MString&                              rprimId,
+    const TfToken&                              primvarName,
+    const VtArray<SRC_TYPE>&                    primvarData,
+    const HdInterpolation&                      primvarInterp)
+{
+    registry.EnqueueFill(
+        [vertexBuffer, meshSharedData, rprimId, primvarName, primvarData, primvarInterp]() {
+            _FillPrimvarData(
+                vertexBuffer,
+                meshSharedData->_numVertices,
+                0,
+                meshSharedData->_renderingToSceneFaceVtxIds,
+                rprimId,
+                meshSharedData->_topology,
+                primvarName,
+                primvarData,
+                primvarInterp);
+        });
+}
+
+//! Compute the smooth normal of a scene point from the adjacency table, like Hd_SmoothNormals.
+inline GfVec3f _ComputeSmoothNormal(const int* adjacency, const GfVec3f* points, int pointIndex)
+{
+    int       offset = adjacency[pointIndex * 2];
+    const int valence = adjacency[pointIndex * 2 + 1];
+
+    const GfVec3f& curr = points[pointIndex];
+    GfVec3f        normal(0.0f);
+    for (int i = 0; i < valence; ++i) {
+        const GfVec3f& prev = points[adjacency[offset++]];
+        const GfVec3f& next = points[adjacency[offset++]];
+        normal += GfCross(next - curr, prev - curr);
+    }
+    normal.Normalize();
+    return normal;
+}
+
+/*! \brief  Compute smooth normals straight into a normals vertex buffer, in the rendering order.
+
+    The vertex buffer memory must have been acquired already. Large meshes are split across
+    threads. With the shared vertex layout each rendering vertex maps to a single scene point
+    so the normals are written directly, otherwise they are computed once per scene point.
+*/
+void _FillSmoothNormals(
+    GfVec3f*                   vertexBuffer,
+    const HdVP2MeshSharedData& meshSharedData,
+    const VtVec3fArray&        points,
+    const MString&             rprimId)
+{
+    const size_t      numVertices = meshSharedData._numVertices;
+    const VtIntArray& renderingToSceneFaceVtxIds = meshSharedData._renderingToSceneFaceVtxIds;
+    if (!TF_VERIFY(meshSharedData._adjacency)) {
+        return;
+    }
+    if (numVertices > renderingToSceneFaceVtxIds.size()) {
+        TF_CODING_ERROR(
+            "Invalid Hydra prim '%s': "
+            "requires %zu vertices, while the number of elements in "
+            "renderingToSceneFaceVtxIds is %zu. Skipping normals update.",
+            rprimId.asChar(),
+            numVertices,
+            renderingToSceneFaceVtxIds.size());
+
+        memset(vertexBuffer, 0, sizeof(GfVec3f) * numVertices);
+        return;
+    }
+
+    // Only the points referenced by the topology are used to compute smooth normals.
+    const Hd_VertexAdjacency& adjacency = *meshSharedData._adjacency;
+
+    const int   numPoints = std::min(adjacency.GetNumPoints(), static_cast<int>(points.size()));
+    const int*  adjacencyTable = adjacency.GetAdjacencyTable().cdata();
+    const int*  sceneIds = renderingToSceneFaceVtxIds.cdata();
+    const auto* pointsData = points.cdata();
+
+    constexpr size_t kGrainSize = 4096;
+
+    if (!meshSharedData._isVertexLayoutUnshared) {
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, numVertices, kGrainSize),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t v = range.begin(); v < range.end(); ++v) {
+                    const int pointIndex = sceneIds[v];
+                    vertexBuffer[v] = (pointIndex >= 0 && pointIndex < numPoints)
+                        ? _ComputeSmoothNormal(adjacencyTable, pointsData, pointIndex)
+                        : GfVec3f(0.0f);
+                }
+            });
+        return;
+    }
+
+    std::vector<GfVec3f> normals(numPoints);
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, numPoints, kGrainSize),
+        [&](const tbb::blocked_range<int>& range) {
+            for (int p = range.begin(); p < range.end(); ++p) {
+                normals[p] = _ComputeSmoothNormal(adjacencyTable, pointsData, p);
+            }
+        });
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numVertices, kGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t v = range.begin(); v < range.end(); ++v) {
+                const int pointIndex = sceneIds[v];
+                vertexBuffer[v] = (pointIndex >= 0 && pointIndex < numPoints)
+                    ? normals[pointIndex]
+                    : GfVec3f(0.0f);
+            }
+        });
+}
+
+//! Quantize a value in [-1, 1] to a signed normalized 16-bit integer.
+inline int16_t _ToSnorm16(float value)
+{
+    return static_cast<int16_t>(std::round(std::min(std::max(value, -1.0f), 1.0f) * 32767.0f));
+}
+
+/*! \brief  Encode normals to the octahedral representation used by the DecodeOctahedralNormal
+            shader fragment, two signed normalized 16-bit integers per vertex.
+
+    The normal is projected on the octahedron |x| + |y| + |z| = 1, the lower half of which is
+    folded over the upper half. Null normals are encoded as +Z.
+*/
+void _FillOctahedralNormals(int16_t* vertexBuffer, const GfVec3f* normals, size_t numVertices)
+{
+    constexpr size_t kGrainSize = 4096;
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numVertices, kGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t v = range.begin(); v < range.end(); ++v) {
+                const GfVec3f& n = normals[v];
+                const float    l1Norm = std::abs(n[0]) + std::abs(n[1]) + std::abs(n[2]);
+
+                float x = l1Norm > 0.0f ? n[0] / l1Norm : 0.0f;
+                float y = l1Norm > 0.0f ? n[1] / l1Norm : 0.0f;
+                if (n[2] < 0.0f) {
+                    const float foldedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+                    const float foldedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+                    x = foldedX;
+                    y = foldedY;
+                }
+
+                vertexBuffer[v * 2] = _ToSnorm16(x);
+                vertexBuffer[v * 2 + 1] = _ToSnorm16(y);
+            }
+        });
+}
+
 //! If there is uniform or face-varying primvar, we have to create unshared
 //! vertex layout on CPU because SSBO technique is not widely supported by
 //! GPUs and 3D APIs.
@@ -294,9 +504,7 @@ void _getColorData(
         infoMap[HdTokens->displayColor] = std::make_unique<PrimvarInfo>(
             PrimvarSource(VtValue(colorArray), interpolation, PrimvarSource::CPUCompute), nullptr);
     } else {
-        for (size_t i = 0; i < colorArray.size(); ++i) {
-            colorArray[i] = MayaUsd::utils::ConvertLinearToMaya(colorArray[i]);
-        }
+        MayaUsd::utils::ConvertLinearToMaya(colorArray.data(), colorArray.size());
     }
 }
 
@@ -340,19 +548,28 @@ VtVec3fArray _points(PrimvarInfoMap& infoMap)
 
 void HdVP2Mesh::_InitGPUCompute()
 {
-    // check that the viewport is using OpenGL, we need it for the OpenGL normals computation
+    // check that the viewport device has a compute backend for the normals computation
     MRenderer* renderer = MRenderer::theRenderer();
     // would also be nice to check the openGL version but renderer->drawAPIVersion() returns 4.
     // Compute was added in 4.3 so I don't have enough information to make the check
-    if (renderer && renderer->drawAPIIsOpenGL()
-        && (TfGetenvInt("HDVP2_USE_GPU_NORMAL_COMPUTATION", 0) > 0)) {
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+    const bool hasComputeBackend
+        = renderer && MeshViewportComputeBackend::supportsDrawAPI(renderer->drawAPI());
+#else
+    const bool hasComputeBackend = renderer && renderer->drawAPIIsOpenGL();
+#endif
+    if (hasComputeBackend && (TfGetenvInt("HDVP2_USE_GPU_NORMAL_COMPUTATION", 0) > 0)) {
         int threshold = TfGetenvInt("HDVP2_GPU_NORMAL_COMPUTATION_MINIMUM_THRESHOLD", 8000);
         _gpuNormalsComputeThreshold = threshold >= 0 ? (size_t)threshold : SIZE_MAX;
+        // The skinning kernel is only implemented in GLSL.
+        _gpuSkinningEnabled
+            = renderer->drawAPIIsOpenGL() && TfGetenvInt("HDVP2_USE_GPU_SKINNING", 0) > 0;
     } else
         _gpuNormalsComputeThreshold = SIZE_MAX;
 }
 
 size_t HdVP2Mesh::_gpuNormalsComputeThreshold = SIZE_MAX;
+bool   HdVP2Mesh::_gpuSkinningEnabled = false;
 //! \brief  Constructor
 #if defined(HD_API_VERSION) && HD_API_VERSION >= 36
 HdVP2Mesh::HdVP2Mesh(HdVP2RenderDelegate* delegate, const SdfPath& id)
@@ -373,12 +590,195 @@ HdVP2Mesh::HdVP2Mesh(HdVP2RenderDelegate* delegate, const SdfPath& id, const Sdf
 #endif
 }
 
+/*! \brief  Return the hierarchy of the local space points of the mesh, built on first use.
+
+    The hierarchy is dropped when the points change. Must be called from the main thread, outside
+    of the synchronization of the render index.
+
+    \return A null pointer when the mesh has no points or is skinned on the GPU.
+*/
+HdVP2PointBVHSharedPtr HdVP2Mesh::GetPointBVH() const
+{
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+    // The points skinned on the GPU are never read back.
+    if (_meshSharedData->_skinningData) {
+        return nullptr;
+    }
+#endif
+
+    if (!_meshSharedData->_pointBVH) {
+        const VtVec3fArray points = _points(_meshSharedData->_primvarInfo);
+        if (points.empty()) {
+            return nullptr;
+        }
+
+        MayaUsd::ProfilingScope profilingScope(
+            HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorC_L2,
+            _rprimId.asChar(),
+            "HdVP2Mesh::BuildPointBVH");
+
+        _meshSharedData->_pointBVH = std::make_shared<HdVP2PointBVH>(points);
+    }
+
+    return _meshSharedData->_pointBVH;
+}
+
+/*! \brief  Return the hierarchy of the local space triangles of the mesh, built on first use.
+
+    The hierarchy is dropped when the points or the topology change. Must be called from the main
+    thread, outside of the synchronization of the render index.
+
+    \return A null pointer when the mesh has no points or is skinned on the GPU.
+*/
+HdVP2TriangleBVHSharedPtr HdVP2Mesh::GetTriangleBVH() const
+{
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+    // The points skinned on the GPU are never read back.
+    if (_meshSharedData->_skinningData) {
+        return nullptr;
+    }
+#endif
+
+    if (!_meshSharedData->_triangleBVH) {
+        const VtVec3fArray points = _points(_meshSharedData->_primvarInfo);
+        if (points.empty()) {
+            return nullptr;
+        }
+
+        MayaUsd::ProfilingScope profilingScope(
+            HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorC_L2,
+            _rprimId.asChar(),
+            "HdVP2Mesh::BuildTriangleBVH");
+
+        _meshSharedData->_triangleBVH
+            = std::make_shared<HdVP2TriangleBVH>(_meshSharedData->_topology, points);
+    }
+
+    return _meshSharedData->_triangleBVH;
+}
+
+namespace {
+
+size_t _GetTopologyBytes(const HdMeshTopology& topology)
+{
+    return (topology.GetFaceVertexCounts().size() + topology.GetFaceVertexIndices().size()
+            + topology.GetHoleIndices().size())
+        * sizeof(int);
+}
+
+} // namespace
+
+/*! \brief  Add the memory used by the cached scene data and the VP2 buffers of the mesh.
+
+    The rendering topology shared with other meshes is counted for the first mesh using it, the
+    hierarchies built for snapping and picking are not counted.
+*/
+void HdVP2Mesh::GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const
+{
+    const HdVP2MeshSharedData& sharedData = *_meshSharedData;
+
+    prim._cpuBytes += _GetTopologyBytes(sharedData._topology);
+    if (!sharedData._sharedRenderingTopology
+        || usage.CountOnce(sharedData._sharedRenderingTopology.get())) {
+        prim._cpuBytes += _GetTopologyBytes(sharedData._renderingTopology)
+            + sharedData._renderingToSceneFaceVtxIds.size() * sizeof(int)
+            + sharedData._trianglesFaceVertexIndices.size() * sizeof(GfVec3i)
+            + sharedData._primitiveParam.size() * sizeof(int);
+    }
+    prim._cpuBytes += sharedData._sceneToRenderingFaceVtxIds.size() * sizeof(int)
+        + sharedData._faceIdToGeomSubsetId.size() * sizeof(SdfPath);
+
+    for (const auto& entry : sharedData._primvarInfo) {
+        const PrimvarInfo& info = *entry.second;
+        prim._cpuBytes += HdVP2GetValueBytes(info._source.data)
+            + info._extraInstanceData.length() * sizeof(float);
+        usage.AddVertexBuffer(prim, info._buffer.get());
+    }
+
+    _GetRenderItemsMemoryUsage(_reprs, usage, prim);
+}
+
+/*! \brief  Fill the octahedral-encoded normals buffer read by the UsdPreviewSurface shaders.
+
+    \param  normals         Authored normals, or an empty value to use the smooth normals
+                            computed from the points and the adjacency table.
+    \param  interpolation   Interpolation of the authored normals.
+*/
+void HdVP2Mesh::_PrepareOctahedralNormals(const VtValue& normals, HdInterpolation interpolation)
+{
+    const TfToken& token = HdVP2Tokens->octahedralNormals;
+
+    PrimvarInfo* info = _getInfo(_meshSharedData->_primvarInfo, token);
+    if (!info) {
+        _meshSharedData->_primvarInfo[token] = std::make_unique<PrimvarInfo>(
+            PrimvarSource(VtValue(), HdInterpolationVertex, PrimvarSource::CPUCompute), nullptr);
+        info = _getInfo(_meshSharedData->_primvarInfo, token);
+    }
+
+    if (!info->_buffer) {
+        const MHWRender::MVertexBufferDescriptor vbDesc(
+            "", MHWRender::MGeometry::kTexture, MHWRender::MGeometry::kInt16, 2);
+
+        info->_buffer.reset(new MHWRender::MVertexBuffer(vbDesc));
+    }
+
+    void* bufferData = _meshSharedData->_numVertices > 0
+        ? info->_buffer->acquire(_meshSharedData->_numVertices, true)
+        : nullptr;
+    if (!bufferData) {
+        return;
+    }
+
+    const std::shared_ptr<HdVP2MeshSharedData>& meshSharedData = _meshSharedData;
+    const MString&                              rprimId = _rprimId;
+    const VtVec3fArray authoredNormals = normals.IsHolding<VtVec3fArray>()
+        ? normals.UncheckedGet<VtVec3fArray>()
+        : VtVec3fArray();
+    const VtVec3fArray points
+        = authoredNormals.empty() ? _points(_meshSharedData->_primvarInfo) : VtVec3fArray();
+    _delegate->GetVP2ResourceRegistry().EnqueueFill(
+        [bufferData, meshSharedData, rprimId, authoredNormals, points, interpolation]() {
+            // The normals are expanded to the rendering vertices before being encoded.
+            std::vector<GfVec3f> renderingNormals(meshSharedData->_numVertices);
+            if (authoredNormals.empty()) {
+                _FillSmoothNormals(renderingNormals.data(), *meshSharedData, points, rprimId);
+            } else {
+                _FillPrimvarData(
+                    renderingNormals.data(),
+                    meshSharedData->_numVertices,
+                    0,
+                    meshSharedData->_renderingToSceneFaceVtxIds,
+                    rprimId,
+                    meshSharedData->_topology,
+                    HdTokens->normals,
+                    authoredNormals,
+                    interpolation);
+            }
+
+            _FillOctahedralNormals(
+                static_cast<int16_t*>(bufferData),
+                renderingNormals.data(),
+                renderingNormals.size());
+        });
+
+    _CommitMVertexBuffer(info->_buffer.get(), bufferData);
+}
+
+/*! \brief  Prepare the vertex buffers shared by all the draw items.
+
+    When bufferCache is given, the positions and normals buffers may belong to frames cached for
+    other time codes: new buffers are filled instead and recorded in cachedBuffers.
+*/
 void HdVP2Mesh::_PrepareSharedVertexBuffers(
-    HdSceneDelegate*   delegate,
-    const HdDirtyBits& rprimDirtyBits,
-    const TfToken&     reprToken)
+    HdSceneDelegate*          delegate,
+    const HdDirtyBits&        rprimDirtyBits,
+    const TfToken&            reprToken,
+    HdVP2VertexBufferCache*   bufferCache,
+    HdVP2CachedVertexBuffers& cachedBuffers)
 {
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L2,
         _rprimId.asChar(),
@@ -388,7 +788,8 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
     // in which case we should find them in _primvarInfo, or they could be computed
     // normals. Compute the normal buffer if necessary.
     PrimvarInfo* normalsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->normals);
-    bool         needNormals = _PrimvarIsRequired(HdTokens->normals);
+    bool         needNormals = _PrimvarIsRequired(HdTokens->normals)
+        || _PrimvarIsRequired(HdVP2Tokens->octahedralNormals);
     bool         computeCPUNormals = (!normalsInfo && !_gpuNormalsEnabled)
         || (normalsInfo && PrimvarSource::CPUCompute == normalsInfo->_source.dataSource);
     bool computeGPUNormals = (!normalsInfo && _gpuNormalsEnabled)
@@ -431,7 +832,7 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     HdBufferSourceSharedPtr adjacencyComputation
                         = _meshSharedData->_adjacency->GetSharedAdjacencyBuilderComputation(
                             &_meshSharedData->_topology);
-                    MProfilingScope profilingScope(
+                    MayaUsd::ProfilingScope profilingScope(
                         HdVP2RenderDelegate::sProfilerCategory,
                         MProfiler::kColorC_L2,
                         _rprimId.asChar(),
@@ -440,23 +841,61 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     adjacencyComputation->Resolve();
                 }
 
-                // Only the points referenced by the topology are used to compute
-                // smooth normals.
-                VtValue normals(Hd_SmoothNormals::ComputeSmoothNormals(
-                    _meshSharedData->_adjacency.get(),
-                    _points(_meshSharedData->_primvarInfo).size(),
-                    _points(_meshSharedData->_primvarInfo).cdata()));
-
+                // The normals are computed by the fill stage straight into the vertex buffer,
+                // the primvar source is left empty so the buffer doesn't get filled again below.
                 if (!normalsInfo) {
                     _meshSharedData->_primvarInfo[HdTokens->normals]
                         = std::make_unique<PrimvarInfo>(
                             PrimvarSource(
-                                normals, HdInterpolationVertex, PrimvarSource::CPUCompute),
+                                VtValue(VtVec3fArray()),
+                                HdInterpolationVertex,
+                                PrimvarSource::CPUCompute),
                             nullptr);
+                    normalsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->normals);
                 } else {
-                    normalsInfo->_source.data = normals;
+                    normalsInfo->_source.data = VtValue(VtVec3fArray());
                     normalsInfo->_source.interpolation = HdInterpolationVertex;
                 }
+
+                if (_PrimvarIsRequired(HdVP2Tokens->octahedralNormals)) {
+                    _PrepareOctahedralNormals(VtValue(), HdInterpolationVertex);
+                }
+
+                // The 3-float normals are skipped when only the encoded normals are drawn.
+                const bool fillNormals = _PrimvarIsRequired(HdTokens->normals);
+                if (fillNormals && bufferCache) {
+                    bufferCache->Release(std::move(normalsInfo->_buffer));
+                }
+
+                if (fillNormals && !normalsInfo->_buffer) {
+                    const MHWRender::MVertexBufferDescriptor vbDesc(
+                        "", MHWRender::MGeometry::kNormal, MHWRender::MGeometry::kFloat, 3);
+
+                    normalsInfo->_buffer.reset(new MHWRender::MVertexBuffer(vbDesc));
+                }
+
+                if (fillNormals && bufferCache) {
+                    cachedBuffers._normalsBuffer = normalsInfo->_buffer;
+                }
+
+                void* bufferData = fillNormals && _meshSharedData->_numVertices > 0
+                    ? normalsInfo->_buffer->acquire(_meshSharedData->_numVertices, true)
+                    : nullptr;
+                if (bufferData) {
+                    const std::shared_ptr<HdVP2MeshSharedData>& meshSharedData = _meshSharedData;
+                    const MString&                              rprimId = _rprimId;
+                    const VtVec3fArray points = _points(_meshSharedData->_primvarInfo);
+                    _delegate->GetVP2ResourceRegistry().EnqueueFill(
+                        [bufferData, meshSharedData, points, rprimId]() {
+                            _FillSmoothNormals(
+                                static_cast<GfVec3f*>(bufferData),
+                                *meshSharedData,
+                                points,
+                                rprimId);
+                        });
+
+                    _CommitMVertexBuffer(normalsInfo->_buffer.get(), bufferData);
+                }
             }
         }
 
@@ -539,29 +978,40 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                 ? colorAndOpacityInfo->_buffer->acquire(_meshSharedData->_numVertices, true)
                 : nullptr;
 
-            // Fill color and opacity into the float4 color stream.
+            // Fill color and opacity into the float4 color stream. Both channels are filled by
+            // the same task since they share the same memory.
             if (bufferData) {
-                _FillPrimvarData(
-                    static_cast<GfVec4f*>(bufferData),
-                    _meshSharedData->_numVertices,
-                    0,
-                    _meshSharedData->_renderingToSceneFaceVtxIds,
-                    _rprimId,
-                    _meshSharedData->_topology,
-                    HdTokens->displayColor,
-                    colorArray,
-                    colorInterp);
-
-                _FillPrimvarData(
-                    static_cast<GfVec4f*>(bufferData),
-                    _meshSharedData->_numVertices,
-                    3,
-                    _meshSharedData->_renderingToSceneFaceVtxIds,
-                    _rprimId,
-                    _meshSharedData->_topology,
-                    HdTokens->displayOpacity,
-                    alphaArray,
-                    alphaInterp);
+                const std::shared_ptr<HdVP2MeshSharedData>& meshSharedData = _meshSharedData;
+                const MString&                              rprimId = _rprimId;
+                _delegate->GetVP2ResourceRegistry().EnqueueFill([bufferData,
+                                                                 meshSharedData,
+                                                                 rprimId,
+                                                                 colorArray,
+                                                                 colorInterp,
+                                                                 alphaArray,
+                                                                 alphaInterp]() {
+                    _FillPrimvarData(
+                        static_cast<GfVec4f*>(bufferData),
+                        meshSharedData->_numVertices,
+                        0,
+                        meshSharedData->_renderingToSceneFaceVtxIds,
+                        rprimId,
+                        meshSharedData->_topology,
+                        HdTokens->displayColor,
+                        colorArray,
+                        colorInterp);
+
+                    _FillPrimvarData(
+                        static_cast<GfVec4f*>(bufferData),
+                        meshSharedData->_numVertices,
+                        3,
+                        meshSharedData->_renderingToSceneFaceVtxIds,
+                        rprimId,
+                        meshSharedData->_topology,
+                        HdTokens->displayOpacity,
+                        alphaArray,
+                        alphaInterp);
+                });
 
                 _CommitMVertexBuffer(colorAndOpacityInfo->_buffer.get(), bufferData);
             }
@@ -584,10 +1034,24 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
             if (token == HdTokens->points) {
                 if ((rprimDirtyBits & HdChangeTracker::DirtyPoints) == 0)
                     continue;
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+                // Points skinned on the GPU are only uploaded when the rest points change.
+                if (_meshSharedData->_skinningData
+                    && !_meshSharedData->_skinningData->_restPointsDirty)
+                    continue;
+#endif
                 semantic = MHWRender::MGeometry::kPosition;
             } else if (token == HdTokens->normals) {
                 if ((rprimDirtyBits & (HdChangeTracker::DirtyNormals | DirtySmoothNormals)) == 0)
                     continue;
+                if (it.second->_source.dataSource == PrimvarSource::Primvar
+                    && it.second->_source.data.GetArraySize() > 0
+                    && _PrimvarIsRequired(HdVP2Tokens->octahedralNormals)) {
+                    _PrepareOctahedralNormals(
+                        it.second->_source.data, it.second->_source.interpolation);
+                }
+                if (!_PrimvarIsRequired(HdTokens->normals))
+                    continue;
                 semantic = MHWRender::MGeometry::kNormal;
             } else if ((rprimDirtyBits & HdChangeTracker::DirtyPrimvar) == 0) {
                 continue;
@@ -599,6 +1063,12 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
             if (!value.IsArrayValued() || value.GetArraySize() == 0)
                 continue;
 
+            const bool isCachedBuffer
+                = bufferCache && (token == HdTokens->points || token == HdTokens->normals);
+            if (isCachedBuffer) {
+                bufferCache->Release(std::move(it.second->_buffer));
+            }
+
             MHWRender::MVertexBuffer* buffer = _meshSharedData->_primvarInfo[token]->_buffer.get();
 
             void* bufferData = nullptr;
@@ -617,13 +1087,11 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                         ? buffer->acquire(_meshSharedData->_numVertices, true)
                         : nullptr;
                     if (bufferData) {
-                        _FillPrimvarData(
+                        _EnqueueFillPrimvarData(
+                            _delegate->GetVP2ResourceRegistry(),
                             static_cast<float*>(bufferData),
-                            _meshSharedData->_numVertices,
-                            0,
-                            _meshSharedData->_renderingToSceneFaceVtxIds,
+                            _meshSharedData,
                             _rprimId,
-                            _meshSharedData->_topology,
                             token,
                             value.UncheckedGet<VtFloatArray>(),
                             interp);
@@ -643,13 +1111,11 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                         ? buffer->acquire(_meshSharedData->_numVertices, true)
                         : nullptr;
                     if (bufferData) {
-                        _FillPrimvarData(
+                        _EnqueueFillPrimvarData(
+                            _delegate->GetVP2ResourceRegistry(),
                             static_cast<GfVec2f*>(bufferData),
-                            _meshSharedData->_numVertices,
-                            0,
-                            _meshSharedData->_renderingToSceneFaceVtxIds,
+                            _meshSharedData,
                             _rprimId,
-                            _meshSharedData->_topology,
                             token,
                             value.UncheckedGet<VtVec2fArray>(),
                             interp);
@@ -669,13 +1135,11 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                         ? buffer->acquire(_meshSharedData->_numVertices, true)
                         : nullptr;
                     if (bufferData) {
-                        _FillPrimvarData(
+                        _EnqueueFillPrimvarData(
+                            _delegate->GetVP2ResourceRegistry(),
                             static_cast<GfVec3f*>(bufferData),
-                            _meshSharedData->_numVertices,
-                            0,
-                            _meshSharedData->_renderingToSceneFaceVtxIds,
+                            _meshSharedData,
                             _rprimId,
-                            _meshSharedData->_topology,
                             token,
                             value.UncheckedGet<VtVec3fArray>(),
                             interp);
@@ -695,13 +1159,11 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                         ? buffer->acquire(_meshSharedData->_numVertices, true)
                         : nullptr;
                     if (bufferData) {
-                        _FillPrimvarData(
+                        _EnqueueFillPrimvarData(
+                            _delegate->GetVP2ResourceRegistry(),
                             static_cast<GfVec4f*>(bufferData),
-                            _meshSharedData->_numVertices,
-                            0,
-                            _meshSharedData->_renderingToSceneFaceVtxIds,
+                            _meshSharedData,
                             _rprimId,
-                            _meshSharedData->_topology,
                             token,
                             value.UncheckedGet<VtVec4fArray>(),
                             interp);
@@ -721,24 +1183,29 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                         ? buffer->acquire(_meshSharedData->_numVertices, true)
                         : nullptr;
                     if (bufferData) {
+                        const std::shared_ptr<HdVP2MeshSharedData>& meshSharedData
+                            = _meshSharedData;
+                        const MString&    rprimId = _rprimId;
                         const VtIntArray& primvarData = value.UncheckedGet<VtIntArray>();
-
-                        VtFloatArray convertedPrimvarData;
-                        convertedPrimvarData.reserve(primvarData.size());
-                        for (auto& source : primvarData) {
-                            convertedPrimvarData.push_back(static_cast<float>(source));
-                        }
-
-                        _FillPrimvarData(
-                            static_cast<float*>(bufferData),
-                            _meshSharedData->_numVertices,
-                            0,
-                            _meshSharedData->_renderingToSceneFaceVtxIds,
-                            _rprimId,
-                            _meshSharedData->_topology,
-                            token,
-                            convertedPrimvarData,
-                            interp);
+                        _delegate->GetVP2ResourceRegistry().EnqueueFill(
+                            [bufferData, meshSharedData, rprimId, token, primvarData, interp]() {
+                                VtFloatArray convertedPrimvarData;
+                                convertedPrimvarData.reserve(primvarData.size());
+                                for (auto& source : primvarData) {
+                                    convertedPrimvarData.push_back(static_cast<float>(source));
+                                }
+
+                                _FillPrimvarData(
+                                    static_cast<float*>(bufferData),
+                                    meshSharedData->_numVertices,
+                                    0,
+                                    meshSharedData->_renderingToSceneFaceVtxIds,
+                                    rprimId,
+                                    meshSharedData->_topology,
+                                    token,
+                                    convertedPrimvarData,
+                                    interp);
+                            });
                     }
                 }
             } else {
@@ -746,10 +1213,47 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
             }
 
             _CommitMVertexBuffer(buffer, bufferData);
+
+            if (isCachedBuffer && bufferData) {
+                if (token == HdTokens->points) {
+                    cachedBuffers._positionsBuffer = it.second->_buffer;
+                } else {
+                    cachedBuffers._normalsBuffer = it.second->_buffer;
+                }
+            }
         }
     }
 }
 
+/*! \brief  Bind the vertex buffers cached for the current time instead of filling them.
+
+    \param  dirtyBits   Cleared of the bits of the primvars which don't need an update anymore.
+
+    \return True if the cached buffers were restored.
+*/
+bool HdVP2Mesh::_RestoreCachedVertexBuffers(
+    const HdVP2CachedVertexBuffers& cachedBuffers,
+    HdDirtyBits&                    dirtyBits)
+{
+    PrimvarInfo* pointsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->points);
+    if (!pointsInfo || !cachedBuffers._positionsBuffer
+        || cachedBuffers._numVertices != _meshSharedData->_numVertices) {
+        return false;
+    }
+
+    pointsInfo->_source.data = VtValue(cachedBuffers._points);
+    pointsInfo->_buffer = cachedBuffers._positionsBuffer;
+    dirtyBits &= ~HdChangeTracker::DirtyPoints;
+
+    PrimvarInfo* normalsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->normals);
+    if (normalsInfo && cachedBuffers._normalsBuffer) {
+        normalsInfo->_buffer = cachedBuffers._normalsBuffer;
+        dirtyBits &= ~(HdChangeTracker::DirtyNormals | DirtySmoothNormals | DirtyFlatNormals);
+    }
+
+    return true;
+}
+
 bool HdVP2Mesh::_PrimvarIsRequired(const TfToken& primvar) const
 {
     const TfTokenVector& allRequiredPrimvars = _meshSharedData->_allRequiredPrimvars;
@@ -763,6 +1267,7 @@ bool HdVP2Mesh::_PrimvarIsRequired(const TfToken& primvar) const
 void HdVP2Mesh::_ResetRenderingTopology()
 {
     _meshSharedData->_renderingTopology = HdMeshTopology();
+    _meshSharedData->_sharedRenderingTopology.reset();
 
     RenderItemFunc setIndexBufferDirty = [](HdVP2DrawItem::RenderItemData& renderItemData) {
         renderItemData._indexBufferValid = false;
@@ -777,11 +1282,19 @@ void HdVP2Mesh::Sync(
     HdDirtyBits*     dirtyBits,
     TfToken const&   reprToken)
 {
-    if (!_SyncCommon(*this, delegate, renderParam, dirtyBits, _GetRepr(reprToken), reprToken)) {
+    if (!_SyncCommon(
+            *this,
+            _sharedData,
+            delegate,
+            renderParam,
+            dirtyBits,
+            _reprs,
+            _GetRepr(reprToken),
+            reprToken)) {
         return;
     }
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L2,
         _rprimId.asChar(),
@@ -818,7 +1331,7 @@ void HdVP2Mesh::Sync(
         }
 
         {
-            MProfilingScope profilingScope(
+            MayaUsd::ProfilingScope profilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorC_L2,
                 _rprimId.asChar(),
@@ -831,6 +1344,7 @@ void HdVP2Mesh::Sync(
             if (!(newTopology == _meshSharedData->_topology)) {
                 _meshSharedData->_topology = newTopology;
                 _meshSharedData->_adjacency.reset();
+                _meshSharedData->_triangleBVH.reset();
                 _ResetRenderingTopology();
             }
         }
@@ -877,6 +1391,34 @@ void HdVP2Mesh::Sync(
                | HdChangeTracker::DirtyInstanceIndex))
            != 0);
 
+    // Points updated at another time may come from the vertex buffer cache. The buffers are
+    // filled according to bufferDirtyBits, the draw items are still updated with dirtyBits so
+    // they get bound to the right buffers.
+    HdVP2VertexBufferCache*  bufferCache = nullptr;
+    HdVP2CachedVertexBuffers cachedBuffers;
+    HdDirtyBits              bufferDirtyBits = *dirtyBits;
+    UsdTimeCode              bufferTime;
+    SdfPath                  bufferKey;
+    bool                     restoredCachedBuffers = false;
+    if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)) {
+        _meshSharedData->_pointBVH.reset();
+        _meshSharedData->_triangleBVH.reset();
+
+        bufferCache = _GetVertexBufferCache(id, bufferTime, bufferKey);
+        if (_gpuNormalsEnabled || _meshSharedData->_renderingTopology == HdMeshTopology()
+            || HdVP2RenderDelegate::IsOctahedralNormalsEnabled()) {
+            bufferCache = nullptr;
+        }
+    }
+    if (bufferCache) {
+        if (HdVP2CachedVertexBuffersSharedPtr entry = bufferCache->Find(bufferKey, bufferTime)) {
+            restoredCachedBuffers = _RestoreCachedVertexBuffers(*entry, bufferDirtyBits);
+            if (restoredCachedBuffers) {
+                cachedBuffers = *entry;
+            }
+        }
+    }
+
     if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)
         || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->normals)
         || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->primvar) || instancerDirty) {
@@ -915,7 +1457,7 @@ void HdVP2Mesh::Sync(
         if (!_PrimvarIsRequired(HdTokens->points))
             _meshSharedData->_allRequiredPrimvars.push_back(HdTokens->points);
 
-        _UpdatePrimvarSources(delegate, *dirtyBits, _meshSharedData->_allRequiredPrimvars);
+        _UpdatePrimvarSources(delegate, bufferDirtyBits, _meshSharedData->_allRequiredPrimvars);
 
         // update the type of vertex layout to use (shared/unshared)
         bool requireUnsharedVertexLayout
@@ -927,88 +1469,29 @@ void HdVP2Mesh::Sync(
     }
 
     if (_meshSharedData->_renderingTopology == HdMeshTopology()) {
-        MProfilingScope profilingScope(
+        MayaUsd::ProfilingScope profilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorC_L2,
             _rprimId.asChar(),
             "HdVP2Mesh Create Rendering Topology");
 
-        const HdMeshTopology& topology = _meshSharedData->_topology;
-        const VtIntArray&     faceVertexIndices = topology.GetFaceVertexIndices();
-        const size_t          numFaceVertexIndices = faceVertexIndices.size();
-
-        VtIntArray newFaceVertexIndices;
-        newFaceVertexIndices.resize(numFaceVertexIndices);
-
-        if (_meshSharedData->_isVertexLayoutUnshared) {
-            _meshSharedData->_numVertices = numFaceVertexIndices;
-            _meshSharedData->_renderingToSceneFaceVtxIds = faceVertexIndices;
-            _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(topology.GetNumPoints(), -1);
-
-            for (size_t i = 0; i < numFaceVertexIndices; i++) {
-                const int sceneFaceVtxId = faceVertexIndices[i];
-                _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId]
-                    = i; // could check if the existing value is -1, but it doesn't matter.
-                         // we just need to map to a vertex in the position buffer that has
-                         // the correct value.
-            }
-
-            // Fill with sequentially increasing values, starting from 0. The new
-            // face vertex indices will be used to populate index data for unshared
-            // vertex layout. Note that _FillPrimvarData assumes this sequence to
-            // be used for face-varying primvars and saves lookup and remapping
-            // with _renderingToSceneFaceVtxIds, so in case we change the array we
-            // should update _FillPrimvarData() code to remap indices correctly.
-            std::iota(newFaceVertexIndices.begin(), newFaceVertexIndices.end(), 0);
-        } else {
-            _meshSharedData->_numVertices = topology.GetNumPoints();
-            _meshSharedData->_renderingToSceneFaceVtxIds.clear();
-
-            // Allocate large enough memory with initial value of -1 to indicate
-            // the rendering face vertex index is not determined yet.
-            _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(numFaceVertexIndices, -1);
-            unsigned int sceneToRenderingFaceVtxIdsCount = 0;
-
-            // Sort vertices to avoid drastically jumping indices. Cache efficiency
-            // is important to fast rendering performance for dense mesh.
-            for (size_t i = 0; i < numFaceVertexIndices; i++) {
-                const int sceneFaceVtxId = faceVertexIndices[i];
-
-                int renderFaceVtxId = _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId];
-                if (renderFaceVtxId < 0) {
-                    renderFaceVtxId = _meshSharedData->_renderingToSceneFaceVtxIds.size();
-                    _meshSharedData->_renderingToSceneFaceVtxIds.push_back(sceneFaceVtxId);
-
-                    _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId] = renderFaceVtxId;
-                    sceneToRenderingFaceVtxIdsCount++;
-                }
-
-                newFaceVertexIndices[i] = renderFaceVtxId;
-            }
-
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(
-                sceneToRenderingFaceVtxIdsCount); // drop any extra -1 values.
-        }
-
-        _meshSharedData->_renderingTopology = HdMeshTopology(
-            topology.GetScheme(),
-            topology.GetOrientation(),
-            topology.GetFaceVertexCounts(),
-            newFaceVertexIndices,
-            topology.GetHoleIndices(),
-            topology.GetRefineLevel());
-
-        // All the render items to draw the shaded (Hull) style share the topology
-        // calculation
-        HdMeshUtil meshUtil(&_meshSharedData->_renderingTopology, GetId());
-        _meshSharedData->_trianglesFaceVertexIndices.clear();
-        _meshSharedData->_primitiveParam.clear();
-        meshUtil.ComputeTriangleIndices(
-            &_meshSharedData->_trianglesFaceVertexIndices,
-            &_meshSharedData->_primitiveParam,
-            nullptr);
+        // Meshes with identical topology and vertex layout share the rendering topology and
+        // triangulation. VtArrays are reference counted so copying them is cheap.
+        _meshSharedData->_sharedRenderingTopology
+            = _delegate->GetMeshTopologyRegistry().GetRenderingTopology(
+                _meshSharedData->_topology, _meshSharedData->_isVertexLayoutUnshared, GetId());
+
+        const HdVP2RenderingTopology& renderingTopology
+            = *_meshSharedData->_sharedRenderingTopology;
+        _meshSharedData->_renderingTopology = renderingTopology._renderingTopology;
+        _meshSharedData->_renderingToSceneFaceVtxIds
+            = renderingTopology._renderingToSceneFaceVtxIds;
+        _meshSharedData->_sceneToRenderingFaceVtxIds
+            = renderingTopology._sceneToRenderingFaceVtxIds;
+        _meshSharedData->_trianglesFaceVertexIndices
+            = renderingTopology._trianglesFaceVertexIndices;
+        _meshSharedData->_primitiveParam = renderingTopology._primitiveParam;
+        _meshSharedData->_numVertices = renderingTopology._numVertices;
 
         // Decide if we should use GPU compute, and set up compute objects for later user
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
@@ -1025,7 +1508,19 @@ void HdVP2Mesh::Sync(
 #endif
     }
 
-    _PrepareSharedVertexBuffers(delegate, *dirtyBits, reprToken);
+    const HdVP2VertexBufferSharedPtr restoredNormalsBuffer = cachedBuffers._normalsBuffer;
+    _PrepareSharedVertexBuffers(delegate, bufferDirtyBits, reprToken, bufferCache, cachedBuffers);
+
+    // Cache the buffers filled for this time, or the normals filled for the first time for it.
+    if (bufferCache && cachedBuffers._positionsBuffer
+        && (!restoredCachedBuffers || cachedBuffers._normalsBuffer != restoredNormalsBuffer)) {
+        if (PrimvarInfo* pointsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->points)) {
+            cachedBuffers._points = pointsInfo->_source.data.Get<VtVec3fArray>();
+        }
+        cachedBuffers._numVertices = _meshSharedData->_numVertices;
+        bufferCache->Insert(
+            bufferKey, bufferTime, std::make_shared<HdVP2CachedVertexBuffers>(cachedBuffers));
+    }
 
 #if PXR_VERSION > 2111
     const TfToken& renderTag = GetRenderTag();
@@ -1406,7 +1901,7 @@ void HdVP2Mesh::_UpdateRepr(HdSceneDelegate* sceneDelegate, const TfToken& reprT
     if (ARCH_UNLIKELY(!subSceneContainer))
         return;
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L2,
         _rprimId.asChar(),
@@ -1520,11 +2015,12 @@ void HdVP2Mesh::_UpdateDrawItem(
 #endif
 
     // Prepare index buffer.
+    HdVP2RenderingTopology* sharedIndexBufferTopology = nullptr;
     if (requiresIndexUpdate && !renderItemData._indexBufferValid) {
         const HdMeshTopology& topologyToUse = _meshSharedData->_renderingTopology;
 
         if (desc.geomStyle == HdMeshGeomStyleHull) {
-            MProfilingScope profilingScope(
+            MayaUsd::ProfilingScope profilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorC_L2,
                 _rprimId.asChar(),
@@ -1536,8 +2032,10 @@ void HdVP2Mesh::_UpdateDrawItem(
 
             VtVec3iArray     trianglesFaceVertexIndices; // for this item only!
             std::vector<int> faceIds;
+            bool             drawsAllFaces = false;
             if (_meshSharedData->_faceIdToGeomSubsetId.size() == 0
                 || reprToken == HdVP2ReprTokens->defaultMaterial) {
+                drawsAllFaces = true;
                 // If there is no mapping from face to render item or if this is the default
                 // material item then all the faces are on this render item. VtArray has
                 // copy-on-write semantics so this is fast
@@ -1602,14 +2100,43 @@ void HdVP2Mesh::_UpdateDrawItem(
 
             const int numIndex = trianglesFaceVertexIndices.size() * 3;
 
-            stateToCommit._indexBufferData = numIndex > 0
-                ? static_cast<int*>(drawItemData._indexBuffer->acquire(numIndex, true))
-                : nullptr;
-            if (stateToCommit._indexBufferData) {
-                memcpy(
-                    stateToCommit._indexBufferData,
-                    trianglesFaceVertexIndices.data(),
-                    numIndex * sizeof(int));
+            const HdVP2RenderingTopologySharedPtr& sharedTopology
+                = _meshSharedData->_sharedRenderingTopology;
+            if (drawsAllFaces && sharedTopology) {
+                // Items drawing every face use the index buffer of the shared rendering topology,
+                // only the first mesh requesting it has to fill it.
+                int*                     sharedIndexData = nullptr;
+                MHWRender::MIndexBuffer* sharedIndexBuffer
+                    = sharedTopology->GetTriangleIndexBuffer(sharedIndexData);
+                if (sharedIndexData) {
+                    memcpy(
+                        sharedIndexData,
+                        trianglesFaceVertexIndices.data(),
+                        numIndex * sizeof(int));
+                }
+
+                // The aliasing constructor keeps the shared rendering topology alive for as long
+                // as the render item uses its index buffer.
+                drawItemData._indexBuffer
+                    = std::shared_ptr<MHWRender::MIndexBuffer>(sharedTopology, sharedIndexBuffer);
+                drawItemData._indexBufferShared = true;
+                sharedIndexBufferTopology = sharedTopology.get();
+            } else {
+                if (drawItemData._indexBufferShared) {
+                    drawItemData._indexBuffer.reset(
+                        new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32));
+                    drawItemData._indexBufferShared = false;
+                }
+
+                stateToCommit._indexBufferData = numIndex > 0
+                    ? static_cast<int*>(drawItemData._indexBuffer->acquire(numIndex, true))
+                    : nullptr;
+                if (stateToCommit._indexBufferData) {
+                    memcpy(
+                        stateToCommit._indexBufferData,
+                        trianglesFaceVertexIndices.data(),
+                        numIndex * sizeof(int));
+                }
             }
         } else if (desc.geomStyle == HdMeshGeomStyleHullEdgeOnly) {
             unsigned int numIndex = _GetNumOfEdgeIndices(topologyToUse);
@@ -1938,15 +2465,25 @@ void HdVP2Mesh::_UpdateDrawItem(
             ? !static_cast<bool>(drawItemData._instanceTransforms)
             : static_cast<bool>(drawItemData._instanceTransforms);
         if (stateToCommit._instanceTransforms && drawItemData._instanceTransforms) {
+            const unsigned int numInstances = stateToCommit._instanceTransforms->length();
             instanceTransformsChanged
-                = (stateToCommit._instanceTransforms->length()
-                   != drawItemData._instanceTransforms->length());
-            for (unsigned int index = 0;
-                 index < stateToCommit._instanceTransforms->length() && !instanceTransformsChanged;
-                 index++) {
-                instanceTransformsChanged
-                    = ((*stateToCommit._instanceTransforms)[index]
-                       != (*drawItemData._instanceTransforms)[index]);
+                = (numInstances != drawItemData._instanceTransforms->length());
+            if (!instanceTransformsChanged) {
+                // Collect the changed instances so only their transforms get uploaded. Updating
+                // them one by one isn't worth it when most of them changed.
+                auto& changedInstances = stateToCommit._changedInstanceTransforms;
+                for (unsigned int index = 0; index < numInstances; index++) {
+                    if ((*stateToCommit._instanceTransforms)[index]
+                        != (*drawItemData._instanceTransforms)[index]) {
+                        changedInstances.push_back(index);
+                        if (changedInstances.size() > numInstances / 2) {
+                            changedInstances.clear();
+                            instanceTransformsChanged = true;
+                            break;
+                        }
+                    }
+                }
+                instanceTransformsChanged = instanceTransformsChanged || !changedInstances.empty();
             }
         }
         // if the values are the same then there is nothing to do. Don't update
@@ -2024,10 +2561,12 @@ void HdVP2Mesh::_UpdateDrawItem(
         }
     }
 
+    // The render item needs its geometry reassigned when it switches to a shared index buffer.
     stateToCommit._geometryDirty
         = (itemDirtyBits
            & (HdChangeTracker::DirtyPoints | HdChangeTracker::DirtyNormals
-              | HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyTopology));
+              | HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyTopology))
+        || sharedIndexBufferTopology;
 
     // Some items may require selection mask overrides
     if (!isDedicatedHighlightItem && !isPointSnappingItem
@@ -2062,8 +2601,10 @@ void HdVP2Mesh::_UpdateDrawItem(
     PrimvarInfoMap*          primvarInfo = &_meshSharedData->_primvarInfo;
     TfTokenVector*           primvars = &_meshSharedData->_allRequiredPrimvars;
     const HdVP2BBoxGeom&     sharedBBoxGeom = _delegate->GetSharedBBoxGeom();
+    HdVP2BBoxBatch*          bboxBatch = nullptr;
     if (isBBoxItem) {
         indexBuffer = const_cast<MHWRender::MIndexBuffer*>(sharedBBoxGeom.GetIndexBuffer());
+        bboxBatch = _GetBBoxBatch(*renderItem, GetInstancerId());
     }
 
     // We can get an empty stateToCommit when viewport draw modes change. In this case every
@@ -2075,8 +2616,10 @@ void HdVP2Mesh::_UpdateDrawItem(
                                                            primvarInfo,
                                                            primvars,
                                                            indexBuffer,
+                                                           sharedIndexBufferTopology,
                                                            isBBoxItem,
-                                                           &sharedBBoxGeom]() {
+                                                           &sharedBBoxGeom,
+                                                           bboxBatch]() {
             // This code executes serially, once per mesh updated. Keep
             // performance in mind while modifying this code.
             const HdVP2DrawItem::RenderItemData& drawItemData = stateToCommit._renderItemData;
@@ -2086,9 +2629,26 @@ void HdVP2Mesh::_UpdateDrawItem(
 
             MStatus result;
 
-            // If available, something changed
-            if (stateToCommit._indexBufferData)
+            // If available, something changed. The shared index buffer is committed by the
+            // first commit task of all the meshes using it.
+            if (stateToCommit._indexBufferData) {
                 indexBuffer->commit(stateToCommit._indexBufferData);
+                HdVP2RenderStats::AddIndexBufferUpload(*indexBuffer);
+            } else if (sharedIndexBufferTopology) {
+                sharedIndexBufferTopology->CommitTriangleIndexBuffer();
+            }
+
+            // The bounding box is drawn by the batch, the render item stays without geometry.
+            if (bboxBatch) {
+                bboxBatch->Update(
+                    *renderItem,
+                    drawItemData._worldMatrix,
+                    drawItemData._shader,
+                    drawItemData._enabled,
+                    MSelectionMask::kSelectMeshes,
+                    MHWRender::MFrameContext::kExcludeMeshes);
+                return;
+            }
 
             // If available, something changed
             if (stateToCommit._shader != nullptr) {
@@ -2170,7 +2730,15 @@ void HdVP2Mesh::_UpdateDrawItem(
             // without recreating render item, so we keep using GPU instancing.
             if (stateToCommit._renderItemData._usingInstancedDraw) {
                 if (stateToCommit._instanceTransforms) {
-                    if (oldInstanceCount == newInstanceCount) {
+                    const auto& changedInstances = stateToCommit._changedInstanceTransforms;
+                    if (oldInstanceCount == newInstanceCount && !changedInstances.empty()) {
+                        for (unsigned int i : changedInstances) {
+                            // VP2 defines instance ID of the first instance to be 1.
+                            result = drawScene.updateInstanceTransform(
+                                *renderItem, i + 1, (*stateToCommit._instanceTransforms)[i]);
+                            TF_VERIFY(result == MStatus::kSuccess);
+                        }
+                    } else if (oldInstanceCount == newInstanceCount) {
                         for (unsigned int i = 0; i < newInstanceCount; i++) {
                             // VP2 defines instance ID of the first instance to be 1.
                             result = drawScene.updateInstanceTransform(
@@ -2270,7 +2838,7 @@ void HdVP2Mesh::_CreateOSDTables()
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
 
     assert(_meshSharedData->_viewportCompute);
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "createOSDTables");
 
     // create topology refiner
@@ -2308,7 +2876,7 @@ void HdVP2Mesh::_CreateOSDTables()
 
         // split trace scopes.
         {
-            MProfilingScope subProfilingScope(
+            MayaUsd::ProfilingScope subProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "refine");
             if (_meshSharedData->_viewportCompute->adaptive) {
                 OpenSubdiv::Far::TopologyRefiner::AdaptiveOptions adaptiveOptions(
@@ -2324,7 +2892,7 @@ void HdVP2Mesh::_CreateOSDTables()
 #define GENERATE_SOURCE_TABLES
 #ifdef GENERATE_SOURCE_TABLES
         {
-            MProfilingScope subProfilingScope(
+            MayaUsd::ProfilingScope subProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "stencilFactory");
             OpenSubdiv::Far::StencilTableFactory::Options options;
             options.generateOffsets = true;
@@ -2336,7 +2904,7 @@ void HdVP2Mesh::_CreateOSDTables()
             varyingStencils = OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
         }
         {
-            MProfilingScope subProfilingScope(
+            MayaUsd::ProfilingScope subProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "patchFactory");
             patchTable = OpenSubdiv::Far::PatchTableFactory::Create(*refiner, patchOptions);
         }
@@ -2381,6 +2949,92 @@ void HdVP2Mesh::_CreateOSDTables()
 }
 #endif
 
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+/*! \brief  Gather the inputs of a UsdSkel skinning computation for GPU skinning.
+
+    Returns false if the computation can't be skinned on the GPU, in which case it is evaluated
+    on the CPU.
+*/
+bool HdVP2Mesh::_UpdateGPUSkinningData(
+    HdSceneDelegate*        sceneDelegate,
+    const HdExtComputation& computation)
+{
+    if (!_gpuSkinningEnabled || !_gpuNormalsEnabled || !_meshSharedData->_viewportCompute)
+        return false;
+
+    auto getInput = [&](const TfToken& name) {
+        return _GetExtComputationInput(sceneDelegate, computation, name);
+    };
+
+    // Only the linear blend skinning without blend shapes is supported.
+    const VtValue skinningMethod = getInput(_skinningTokens->skinningMethod);
+    if (skinningMethod.IsHolding<TfToken>()
+        && skinningMethod.UncheckedGet<TfToken>() != _skinningTokens->classicLinear)
+        return false;
+    const VtValue blendShapeOffsets = getInput(_skinningTokens->blendShapeOffsets);
+    if (!blendShapeOffsets.IsEmpty() && blendShapeOffsets.GetArraySize() > 0)
+        return false;
+
+    const VtValue restPoints = getInput(_skinningTokens->restPoints);
+    const VtValue geomBindXform = getInput(_skinningTokens->geomBindXform);
+    const VtValue influences = getInput(_skinningTokens->influences);
+    const VtValue numInfluencesPerComponent = getInput(_skinningTokens->numInfluencesPerComponent);
+    const VtValue hasConstantInfluences = getInput(_skinningTokens->hasConstantInfluences);
+    const VtValue primWorldToLocal = getInput(_skinningTokens->primWorldToLocal);
+    const VtValue skinningXforms = getInput(_skinningTokens->skinningXforms);
+    const VtValue skelLocalToWorld = getInput(_skinningTokens->skelLocalToWorld);
+    if (!restPoints.IsHolding<VtVec3fArray>() || !geomBindXform.IsHolding<GfMatrix4f>()
+        || !influences.IsHolding<VtVec2fArray>() || !numInfluencesPerComponent.IsHolding<int>()
+        || !hasConstantInfluences.IsHolding<bool>() || !primWorldToLocal.IsHolding<GfMatrix4d>()
+        || !skinningXforms.IsHolding<VtMatrix4fArray>()
+        || !skelLocalToWorld.IsHolding<GfMatrix4d>())
+        return false;
+
+    std::unique_ptr<HdVP2SkinningData>& skinningData = _meshSharedData->_skinningData;
+    if (!skinningData) {
+        skinningData.reset(new HdVP2SkinningData());
+    }
+
+    // The rest points and the influences are static, VtArray comparison is cheap when they
+    // share the same data.
+    const VtVec3fArray& sourceRestPoints = restPoints.UncheckedGet<VtVec3fArray>();
+    const GfMatrix4f&   geomBind = geomBindXform.UncheckedGet<GfMatrix4f>();
+    if (skinningData->_restPoints.empty() || sourceRestPoints != skinningData->_sourceRestPoints
+        || geomBind != skinningData->_geomBindXform) {
+        skinningData->_sourceRestPoints = sourceRestPoints;
+        skinningData->_geomBindXform = geomBind;
+        skinningData->_restPoints.resize(sourceRestPoints.size());
+        for (size_t i = 0; i < sourceRestPoints.size(); ++i) {
+            skinningData->_restPoints[i] = geomBind.Transform(sourceRestPoints[i]);
+        }
+        skinningData->_restPointsDirty = true;
+    }
+
+    const VtVec2fArray& jointInfluences = influences.UncheckedGet<VtVec2fArray>();
+    if (jointInfluences != skinningData->_influences
+        || numInfluencesPerComponent.UncheckedGet<int>()
+            != skinningData->_numInfluencesPerComponent
+        || hasConstantInfluences.UncheckedGet<bool>() != skinningData->_hasConstantInfluences) {
+        skinningData->_influences = jointInfluences;
+        skinningData->_numInfluencesPerComponent = numInfluencesPerComponent.UncheckedGet<int>();
+        skinningData->_hasConstantInfluences = hasConstantInfluences.UncheckedGet<bool>();
+        skinningData->_restPointsDirty = true;
+    }
+
+    // Fold the skeleton to prim transform into the joint transforms, so the compute kernel only
+    // blends the joint transforms. This relies on the weights being normalized by UsdSkel.
+    const GfMatrix4f skelToPrim(
+        skelLocalToWorld.UncheckedGet<GfMatrix4d>() * primWorldToLocal.UncheckedGet<GfMatrix4d>());
+    const VtMatrix4fArray& jointXforms = skinningXforms.UncheckedGet<VtMatrix4fArray>();
+    skinningData->_skinningXforms.resize(jointXforms.size());
+    for (size_t i = 0; i < jointXforms.size(); ++i) {
+        skinningData->_skinningXforms[i] = jointXforms[i] * skelToPrim;
+    }
+
+    return true;
+}
+#endif
+
 /*! \brief  Update the _primvarInfo's _source information for all required primvars.
 
     This function pulls data from the scene delegate & caches it, but defers processing.
@@ -2394,7 +3048,7 @@ void HdVP2Mesh::_UpdatePrimvarSources(
     HdDirtyBits          dirtyBits,
     const TfTokenVector& requiredPrimvars)
 {
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L2,
         _rprimId.asChar(),
@@ -2451,6 +3105,9 @@ void HdVP2Mesh::_UpdatePrimvarSources(
         = sceneDelegate->GetExtComputationPrimvarDescriptors(id, HdInterpolationVertex);
     const HdRenderIndex& renderIndex = sceneDelegate->GetRenderIndex();
     bool                 pointsAreComputed = false;
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+    bool pointsAreSkinnedOnGPU = false;
+#endif
     for (const auto& primvarName : requiredPrimvars) {
         // The compPrimvars are a description of the link between the compute system and
         // what we need to draw.
@@ -2469,6 +3126,23 @@ void HdVP2Mesh::_UpdatePrimvarSources(
         if (!sourceComp || sourceComp->GetElementCount() <= 0)
             continue;
 
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+        // Skinning on the GPU replaces the CPU evaluation of the computation. The points primvar
+        // then holds the rest points, which are only updated when they change.
+        if (primvarName == HdTokens->points && _UpdateGPUSkinningData(sceneDelegate, *sourceComp)) {
+            if (_meshSharedData->_skinningData->_restPointsDirty) {
+                updatePrimvarInfo(
+                    primvarName,
+                    VtValue(_meshSharedData->_skinningData->_restPoints),
+                    HdInterpolationVertex);
+            }
+            _meshSharedData->_viewportCompute->setSkinningDirty();
+            pointsAreComputed = true;
+            pointsAreSkinnedOnGPU = true;
+            continue;
+        }
+#endif
+
         // This compPrimvar is telling me that the primvar with "name" comes from compute.
         // The compPrimvar has the Id of the compute the data comes from, and the output
         // of the compute which contains the data
@@ -2500,6 +3174,16 @@ void HdVP2Mesh::_UpdatePrimvarSources(
         }
     }
 
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+    if (!pointsAreSkinnedOnGPU && _meshSharedData->_skinningData) {
+        // The points are skinned on the CPU again, they have been updated above.
+        _meshSharedData->_skinningData.reset();
+        if (_meshSharedData->_viewportCompute) {
+            _meshSharedData->_viewportCompute->setSkinningDirty();
+        }
+    }
+#endif
+
     // When points are computed then we will have to propagate that fact to the function
     // _PropagateDirtyBits() so that it can mark points dirty when the transform change.
     // This support UsdSkel affecting the points position and properly making the render
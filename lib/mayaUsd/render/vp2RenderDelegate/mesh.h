@@ -18,8 +18,12 @@
 
 #include "draw_item.h"
 #include "mayaPrimCommon.h"
+#include "meshTopologyRegistry.h"
 #include "meshViewportCompute.h"
+#include "pointBVH.h"
 #include "primvarInfo.h"
+#include "triangleBVH.h"
+#include "vertexBufferCache.h"
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
@@ -31,6 +35,7 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdExtComputation;
 class HdSceneDelegate;
 class HdVP2DrawItem;
 class HdVP2RenderDelegate;
@@ -59,6 +64,10 @@ struct HdVP2MeshSharedData
     //! Defines whether or not the vertex layout used for drawing is unshared
     bool _isVertexLayoutUnshared { false };
 
+    //! Rendering topology shared with every mesh having the same topology and vertex layout, the
+    //! rendering topology members below are copies of its members.
+    HdVP2RenderingTopologySharedPtr _sharedRenderingTopology;
+
     //! An array to store original scene face vertex index of each rendering
     //! face vertex index.
     VtIntArray _renderingToSceneFaceVtxIds;
@@ -89,8 +98,17 @@ struct HdVP2MeshSharedData
 
     //! Render tag of the Rprim.
     TfToken _renderTag;
+
+    //! Hierarchy of the points, built on demand and reset when the points change.
+    HdVP2PointBVHSharedPtr _pointBVH;
+
+    //! Hierarchy of the triangles, built on demand and reset when the points or topology change.
+    HdVP2TriangleBVHSharedPtr _triangleBVH;
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
     MSharedPtr<MeshViewportCompute> _viewportCompute;
+
+    //! Skinning inputs when the points are skinned by _viewportCompute, null otherwise
+    std::unique_ptr<HdVP2SkinningData> _skinningData;
 #endif
 };
 
@@ -126,6 +144,17 @@ public:
 
     HdDirtyBits GetInitialDirtyBitsMask() const override;
 
+    //! Return the hierarchy of the local space points, built on first use.
+    HdVP2PointBVHSharedPtr GetPointBVH() const;
+
+    //! Return the hierarchy of the local space triangles, built on first use.
+    HdVP2TriangleBVHSharedPtr GetTriangleBVH() const;
+
+    void GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const override;
+
+    //! Return the render tag of the mesh as of its last synchronization.
+    const TfToken& GetSyncedRenderTag() const { return _meshSharedData->_renderTag; }
+
 private:
     HdDirtyBits _PropagateDirtyBits(HdDirtyBits) const override;
 
@@ -137,6 +166,7 @@ private:
 
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
     void _CreateViewportCompute();
+    bool _UpdateGPUSkinningData(HdSceneDelegate*, const HdExtComputation&);
 #endif
 #ifdef HDVP2_ENABLE_GPU_OSD
     void _CreateOSDTables();
@@ -157,9 +187,17 @@ private:
         const TfTokenVector& requiredPrimvars);
 
     void _PrepareSharedVertexBuffers(
-        HdSceneDelegate*   delegate,
-        const HdDirtyBits& rprimDirtyBits,
-        const TfToken&     reprToken);
+        HdSceneDelegate*          delegate,
+        const HdDirtyBits&        rprimDirtyBits,
+        const TfToken&            reprToken,
+        HdVP2VertexBufferCache*   bufferCache,
+        HdVP2CachedVertexBuffers& cachedBuffers);
+
+    void _PrepareOctahedralNormals(const VtValue& normals, HdInterpolation interpolation);
+
+    bool _RestoreCachedVertexBuffers(
+        const HdVP2CachedVertexBuffers& cachedBuffers,
+        HdDirtyBits&                    dirtyBits);
 
     void _CreateSmoothHullRenderItems(
         HdVP2DrawItem&      drawItem,
@@ -214,6 +252,7 @@ private:
     bool _pointsFromSkel { false };
 
     static size_t _gpuNormalsComputeThreshold;
+    static bool   _gpuSkinningEnabled; //!< Skin UsdSkel points in the viewport compute
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
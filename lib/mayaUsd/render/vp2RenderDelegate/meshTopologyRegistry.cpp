@@ -0,0 +1,197 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshTopologyRegistry.h"
+
+#include "renderStats.h"
+
+#include <mayaUsd/utils/hash.h>
+
+#include <pxr/base/arch/threads.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/imaging/hd/meshUtil.h>
+
+#include <algorithm>
+#include <numeric>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+HdVP2RenderingTopology::HdVP2RenderingTopology(
+    const HdMeshTopology& sceneTopology,
+    bool                  isVertexLayoutUnshared,
+    const SdfPath&        id)
+    : _sceneTopology(sceneTopology)
+    , _isVertexLayoutUnshared(isVertexLayoutUnshared)
+{
+    const VtIntArray& faceVertexIndices = sceneTopology.GetFaceVertexIndices();
+    const size_t      numFaceVertexIndices = faceVertexIndices.size();
+
+    VtIntArray newFaceVertexIndices;
+    newFaceVertexIndices.resize(numFaceVertexIndices);
+
+    if (isVertexLayoutUnshared) {
+        _numVertices = numFaceVertexIndices;
+        _renderingToSceneFaceVtxIds = faceVertexIndices;
+        _sceneToRenderingFaceVtxIds.resize(sceneTopology.GetNumPoints(), -1);
+
+        for (size_t i = 0; i < numFaceVertexIndices; i++) {
+            const int sceneFaceVtxId = faceVertexIndices[i];
+            _sceneToRenderingFaceVtxIds[sceneFaceVtxId]
+                = i; // could check if the existing value is -1, but it doesn't matter.
+                     // we just need to map to a vertex in the position buffer that has
+                     // the correct value.
+        }
+
+        // Fill with sequentially increasing values, starting from 0. The new
+        // face vertex indices will be used to populate index data for unshared
+        // vertex layout. Note that _FillPrimvarData assumes this sequence to
+        // be used for face-varying primvars and saves lookup and remapping
+        // with _renderingToSceneFaceVtxIds, so in case we change the array we
+        // should update _FillPrimvarData() code to remap indices correctly.
+        std::iota(newFaceVertexIndices.begin(), newFaceVertexIndices.end(), 0);
+    } else {
+        _numVertices = sceneTopology.GetNumPoints();
+
+        // Allocate large enough memory with initial value of -1 to indicate
+        // the rendering face vertex index is not determined yet.
+        _sceneToRenderingFaceVtxIds.resize(numFaceVertexIndices, -1);
+        unsigned int sceneToRenderingFaceVtxIdsCount = 0;
+
+        // Sort vertices to avoid drastically jumping indices. Cache efficiency
+        // is important to fast rendering performance for dense mesh.
+        for (size_t i = 0; i < numFaceVertexIndices; i++) {
+            const int sceneFaceVtxId = faceVertexIndices[i];
+
+            int renderFaceVtxId = _sceneToRenderingFaceVtxIds[sceneFaceVtxId];
+            if (renderFaceVtxId < 0) {
+                renderFaceVtxId = _renderingToSceneFaceVtxIds.size();
+                _renderingToSceneFaceVtxIds.push_back(sceneFaceVtxId);
+
+                _sceneToRenderingFaceVtxIds[sceneFaceVtxId] = renderFaceVtxId;
+                sceneToRenderingFaceVtxIdsCount++;
+            }
+
+            newFaceVertexIndices[i] = renderFaceVtxId;
+        }
+
+        _sceneToRenderingFaceVtxIds.resize(
+            sceneToRenderingFaceVtxIdsCount); // drop any extra -1 values.
+    }
+
+    _renderingTopology = HdMeshTopology(
+        sceneTopology.GetScheme(),
+        sceneTopology.GetOrientation(),
+        sceneTopology.GetFaceVertexCounts(),
+        newFaceVertexIndices,
+        sceneTopology.GetHoleIndices(),
+        sceneTopology.GetRefineLevel());
+
+    // All the render items to draw the shaded (Hull) style share the topology
+    // calculation
+    HdMeshUtil meshUtil(&_renderingTopology, id);
+    meshUtil.ComputeTriangleIndices(&_trianglesFaceVertexIndices, &_primitiveParam, nullptr);
+}
+
+MHWRender::MIndexBuffer* HdVP2RenderingTopology::GetTriangleIndexBuffer(int*& indexData)
+{
+    indexData = nullptr;
+
+    std::lock_guard<std::mutex> lock(_indexBufferMutex);
+    if (!_triangleIndexBuffer) {
+        _triangleIndexBuffer.reset(
+            new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32));
+
+        const unsigned int numIndex = _trianglesFaceVertexIndices.size() * 3;
+        if (numIndex > 0) {
+            _pendingIndexData = static_cast<int*>(_triangleIndexBuffer->acquire(numIndex, true));
+            indexData = _pendingIndexData;
+        }
+    }
+
+    return _triangleIndexBuffer.get();
+}
+
+void HdVP2RenderingTopology::CommitTriangleIndexBuffer()
+{
+    TF_VERIFY(ArchIsMainThread(), "Committing shared index buffer from worker threads");
+
+    // Commit tasks run serially on main thread, no lock is needed to access pending data.
+    if (_pendingIndexData) {
+        _triangleIndexBuffer->commit(_pendingIndexData);
+        HdVP2RenderStats::AddIndexBufferUpload(*_triangleIndexBuffer);
+        _pendingIndexData = nullptr;
+    }
+}
+
+HdVP2RenderingTopologySharedPtr HdVP2MeshTopologyRegistry::GetRenderingTopology(
+    const HdMeshTopology& topology,
+    bool                  isVertexLayoutUnshared,
+    const SdfPath&        id)
+{
+    size_t key = topology.ComputeHash();
+    MayaUsd::hash_combine(key, isVertexLayoutUnshared);
+
+    // Hash collisions are unlikely but must not corrupt drawing, such topology is simply not
+    // shared.
+    auto isMatching = [&](const HdVP2RenderingTopology& entry) {
+        return entry._isVertexLayoutUnshared == isVertexLayoutUnshared
+            && entry._sceneTopology == topology;
+    };
+
+    HdVP2RenderingTopologySharedPtr entry;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        it = _entries.find(key);
+        if (it != _entries.end()) {
+            entry = it->second.lock();
+        }
+    }
+
+    // Topologies are compared outside of the lock, VtArray comparison is linear in the array
+    // size unless both topologies share their arrays.
+    if (entry && isMatching(*entry)) {
+        return entry;
+    }
+
+    // Build outside of the lock, meshes with different topologies are built in parallel.
+    HdVP2RenderingTopologySharedPtr newEntry
+        = std::make_shared<HdVP2RenderingTopology>(topology, isVertexLayoutUnshared, id);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _Entry&                     slot = _entries[key];
+    entry = slot.lock();
+    if (entry) {
+        // Either another mesh built the same topology concurrently, use the registered one so
+        // both share the index buffer, or this is a collision and the new entry stays private.
+        return isMatching(*entry) ? entry : newEntry;
+    }
+    slot = newEntry;
+
+    // Purge expired entries from time to time to keep the map small when topologies are edited.
+    if (_entries.size() >= _purgeThreshold) {
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->second.expired()) {
+                it = _entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        _purgeThreshold = std::max<size_t>(1024, _entries.size() * 2);
+    }
+
+    return newEntry;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,130 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MESH_TOPOLOGY_REGISTRY
+#define HD_VP2_MESH_TOPOLOGY_REGISTRY
+
+#include <pxr/base/vt/array.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <maya/MHWGeometry.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Rendering topology and triangulation computed once for a scene topology.
+    \class  HdVP2RenderingTopology
+
+    The data is immutable once built and can be shared by every HdVP2Mesh using an identical
+    scene topology with the same vertex layout. The triangle index buffer drawing every face of
+    the mesh is shared too, it is filled by the first mesh that needs it and committed by the
+    first commit task referencing it.
+*/
+struct HdVP2RenderingTopology
+{
+    //! Scene topology the data was computed from, used to resolve hash collisions.
+    HdMeshTopology _sceneTopology;
+
+    //! Unshared or sorted vertex layout topology for efficient GPU rendering.
+    HdMeshTopology _renderingTopology;
+
+    //! Whether _renderingTopology uses an unshared vertex layout.
+    bool _isVertexLayoutUnshared { false };
+
+    //! Original scene face vertex index of each rendering face vertex index.
+    VtIntArray _renderingToSceneFaceVtxIds;
+
+    //! Rendering face vertex index for each original scene face vertex index.
+    std::vector<int> _sceneToRenderingFaceVtxIds;
+
+    //! Triangulation of _renderingTopology.
+    VtVec3iArray _trianglesFaceVertexIndices;
+
+    //! Encoded triangleId to faceId of _trianglesFaceVertexIndices.
+    VtIntArray _primitiveParam;
+
+    //! The number of vertices in each vertex buffer.
+    size_t _numVertices { 0 };
+
+    //! Build the rendering topology and triangulation of a scene topology.
+    HdVP2RenderingTopology(
+        const HdMeshTopology& sceneTopology,
+        bool                  isVertexLayoutUnshared,
+        const SdfPath&        id);
+
+    /*! \brief  Return the shared index buffer of all triangles, acquiring it if needed.
+
+        \param  indexData   Set to the acquired index data when the caller is the first one to
+                            request the buffer and must fill it, nullptr otherwise.
+
+        Call is thread safe. The caller filling the buffer must do so before any commit task runs.
+    */
+    MHWRender::MIndexBuffer* GetTriangleIndexBuffer(int*& indexData);
+
+    //! Commit the shared index buffer if it has pending data. Call from main thread only.
+    void CommitTriangleIndexBuffer();
+
+private:
+    std::mutex                               _indexBufferMutex;
+    std::unique_ptr<MHWRender::MIndexBuffer> _triangleIndexBuffer;
+    int*                                     _pendingIndexData { nullptr };
+};
+
+using HdVP2RenderingTopologySharedPtr = std::shared_ptr<HdVP2RenderingTopology>;
+
+/*! \brief  Registry deduplicating the rendering topology of HdVP2Mesh rprims.
+    \class  HdVP2MeshTopologyRegistry
+
+    Scenes often instance the same mesh topology many times without using point instancing
+    (e.g. referenced assets, bolts, leaves). The registry is keyed by the scene topology hash and
+    the vertex layout so the triangulation and the full triangle index buffer are only computed
+    and uploaded once. Entries hold weak references and are released with the last mesh using
+    them.
+*/
+class HdVP2MeshTopologyRegistry
+{
+public:
+    HdVP2MeshTopologyRegistry() = default;
+    ~HdVP2MeshTopologyRegistry() = default;
+
+    //! Return the rendering topology for the scene topology, building it if needed. Thread safe.
+    HdVP2RenderingTopologySharedPtr GetRenderingTopology(
+        const HdMeshTopology& topology,
+        bool                  isVertexLayoutUnshared,
+        const SdfPath&        id);
+
+private:
+    HdVP2MeshTopologyRegistry(const HdVP2MeshTopologyRegistry&) = delete;
+    HdVP2MeshTopologyRegistry& operator=(const HdVP2MeshTopologyRegistry&) = delete;
+
+    using _Entry = std::weak_ptr<HdVP2RenderingTopology>;
+
+    //! Protects _entries
+    std::mutex _mutex;
+    //! Entries keyed by the hash of the scene topology and vertex layout
+    std::unordered_map<size_t, _Entry> _entries;
+    //! Number of entries the next purge of expired entries is triggered at
+    size_t _purgeThreshold { 1024 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_MESH_TOPOLOGY_REGISTRY
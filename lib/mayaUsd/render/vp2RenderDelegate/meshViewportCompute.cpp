@@ -19,9 +19,11 @@
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
 
 #include "mesh.h"
+#include "meshViewportComputeBackend.h"
 #include "render_delegate.h"
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/imaging/hd/vertexAdjacency.h>
 #include <pxr/imaging/pxOsd/refinerFactory.h>
@@ -34,20 +36,6 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
 
-std::string _GetResourcePath(const std::string& resource)
-{
-    static PlugPluginPtr plugin
-        = PlugRegistry::GetInstance().GetPluginWithName("mayaUsd_ComputeShaders");
-    if (!TF_VERIFY(plugin, "Could not get plugin\n")) {
-        return std::string();
-    }
-
-    const std::string path = PlugFindPluginResource(plugin, resource);
-    TF_VERIFY(!path.empty(), "Cound not find resource: %s\n", resource.c_str());
-
-    return path;
-}
-
 template <typename F> class LambdaTask : public tbb::task
 {
 public:
@@ -72,8 +60,8 @@ template <typename F> void EnqueueLambdaTask(const F& f)
 }
 } // namespace
 
-std::once_flag      MeshViewportCompute::_compileProgramOnce;
-PxrMayaGLSLProgram* MeshViewportCompute::_computeNormalsProgram;
+std::once_flag      MeshViewportCompute::_compileSkinningProgramOnce;
+PxrMayaGLSLProgram* MeshViewportCompute::_computeSkinningProgram;
 
 void MeshViewportCompute::openGLErrorCheck()
 {
@@ -113,6 +101,12 @@ void MeshViewportCompute::setNormalVertexBufferGPUDirty()
         _consolidatedCompute->_normalVertexBufferGPUDirty = true;
 }
 
+void MeshViewportCompute::setSkinningDirty()
+{
+    _skinningDirty = true;
+    _executed = false;
+}
+
 void MeshViewportCompute::reset()
 {
     /*  don't clear _meshSharedData, it's either an input from the external HdVP2Mesh
@@ -124,9 +118,9 @@ void MeshViewportCompute::reset()
     _consolidatedCompute.reset();
     _geometryIndexMapping.reset();
     _vertexCount = 0;
-    if (0 != _uboResourceHandle) {
-        glDeleteBuffers(1, &_uboResourceHandle);
-        _uboResourceHandle = 0;
+    if (0 != _skinningUboResourceHandle) {
+        glDeleteBuffers(1, &_skinningUboResourceHandle);
+        _skinningUboResourceHandle = 0;
     }
 
     _adjacencyBufferSize = 0;
@@ -135,6 +129,10 @@ void MeshViewportCompute::reset()
     _renderingToSceneFaceVtxIdsGPU.reset();
     _sceneToRenderingFaceVtxIdsGPU.reset();
 
+    _restPointsGPU.reset();
+    _influencesGPU.reset();
+    _skinningXformsGPU.reset();
+
     fRenderGeom = nullptr;
 
     _positionVertexBufferGPU = nullptr;
@@ -164,7 +162,7 @@ void MeshViewportCompute::findConsolidationMapping(MRenderItem& renderItem)
         return;
     }
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:MGeometryIndexMapping");
@@ -208,7 +206,7 @@ void MeshViewportCompute::createConsolidatedTopology(TopologyAccessor getTopolog
         return;
     _topologyDirty = false;
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:createConsolidatedTopology");
@@ -350,7 +348,7 @@ void MeshViewportCompute::createConsolidatedAdjacency()
     if (_adjacencyBufferSize > 0)
         return;
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:createConsolidatedAdjacency");
@@ -371,7 +369,7 @@ void MeshViewportCompute::createConsolidatedAdjacency()
 
 void MeshViewportCompute::findRenderGeometry(MRenderItem& renderItem)
 {
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:findRenderGeometry");
@@ -390,7 +388,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
 {
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:consolidatedOSDTables");
@@ -406,7 +404,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
         // if this is a consolidated item then we won't have any stencils or tables.
         // If this is an unconsolidated item then we'll already have the tables we need.
         if (!_vertexStencils || !_varyingStencils || !_patchTable) {
-            MProfilingScope subsubProfilingScope(
+            MayaUsd::ProfilingScope subsubProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorD_L2,
                 "MeshViewportCompute:createConsolidatedMeshTables");
@@ -438,7 +436,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
 
                 // split trace scopes.
                 {
-                    MProfilingScope subsubsubProfilingScope(
+                    MayaUsd::ProfilingScope subsubsubProfilingScope(
                         HdVP2RenderDelegate::sProfilerCategory,
                         MProfiler::kColorD_L2,
                         "MeshViewportCompute:refine");
@@ -453,7 +451,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
                     }
                 }
                 {
-                    MProfilingScope subsubsubProfilingScope(
+                    MayaUsd::ProfilingScope subsubsubProfilingScope(
                         HdVP2RenderDelegate::sProfilerCategory,
                         MProfiler::kColorD_L2,
                         "MeshViewportCompute:stencilFactory");
@@ -471,7 +469,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
                         = OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
                 }
                 {
-                    MProfilingScope subsubsubProfilingScope(
+                    MayaUsd::ProfilingScope subsubsubProfilingScope(
                         HdVP2RenderDelegate::sProfilerCategory,
                         MProfiler::kColorD_L2,
                         "MeshViewportCompute:patchFactory");
@@ -509,7 +507,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
     }
 
     if (_geometryIndexMapping && _geometryIndexMapping->geometryCount() > 0) {
-        MProfilingScope subsubProfilingScope(
+        MayaUsd::ProfilingScope subsubProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L2,
             "MeshViewportCompute:updateIndexMapping");
@@ -546,7 +544,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
         renderItem.setSourceIndexMapping(*_geometryIndexMapping.get());
     }
 
-    MProfilingScope subsubProfilingScope(
+    MayaUsd::ProfilingScope subsubProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:triangulateSmoothPatchTable");
@@ -576,7 +574,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
         memcpy(indices.data(), firstIndex, ptableSize * sizeof(int));
 
         {
-            MProfilingScope subsubProfilingScope(
+            MayaUsd::ProfilingScope subsubProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorD_L1,
                 "MeshViewportCompute:createTriangleIndexBuffer");
@@ -625,7 +623,7 @@ void MeshViewportCompute::findVertexBuffers(MRenderItem& renderItem)
         return;
     }
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:findVertexBuffers");
@@ -636,14 +634,14 @@ void MeshViewportCompute::findVertexBuffers(MRenderItem& renderItem)
         const MVertexBufferDescriptor& descriptor = renderBuffer->descriptor();
 
         if (MGeometry::kPosition == descriptor.semantic()) {
-            MProfilingScope subsubProfilingScope(
+            MayaUsd::ProfilingScope subsubProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorD_L2,
                 "MeshViewportCompute:positionBufferResourceHandle");
             TF_VERIFY(renderBuffer->vertexCount() == _vertexCount);
             _positionVertexBufferGPU = renderBuffer;
         } else if (MGeometry::kNormal == descriptor.semantic()) {
-            MProfilingScope subsubProfilingScope(
+            MayaUsd::ProfilingScope subsubProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorD_L2,
                 "MeshViewportCompute:normalBufferResourceHandle");
@@ -657,7 +655,7 @@ void MeshViewportCompute::findVertexBuffers(MRenderItem& renderItem)
     }
 
     if (nullptr == _normalVertexBufferGPU) {
-        MProfilingScope subsubProfilingScope(
+        MayaUsd::ProfilingScope subsubProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L1,
             "MeshViewportCompute:createNormalBuffer");
@@ -668,8 +666,7 @@ void MeshViewportCompute::findVertexBuffers(MRenderItem& renderItem)
         _normalVertexBufferGPU = fRenderGeom->createVertexBuffer(vbDesc);
     }
 
-    GLuint* normalBufferResourceHandle = (GLuint*)_normalVertexBufferGPU->resourceHandle();
-    if (!normalBufferResourceHandle) {
+    if (!_normalVertexBufferGPU->resourceHandle()) {
         // tell the buffer what size it is
         void* normalsBufferData = _normalVertexBufferGPU->acquire(_vertexCount, true);
         memset(normalsBufferData, 0, _vertexCount * sizeof(float) * 3);
@@ -684,7 +681,7 @@ void MeshViewportCompute::prepareAdjacencyBuffer()
         return;
     _adjacencyBufferGPUDirty = false;
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:prepareAdjacencyBuffer");
@@ -753,102 +750,134 @@ void MeshViewportCompute::prepareAdjacencyBuffer()
 #endif
 }
 
-void MeshViewportCompute::prepareUniformBufferForNormals()
-{
-    if (0 != _uboResourceHandle)
-        return;
-
-    if (hasOpenGL()) {
-        glGenBuffers(1, &_uboResourceHandle);
-        glBindBuffer(GL_UNIFORM_BUFFER, _uboResourceHandle);
-        glBufferData(GL_UNIFORM_BUFFER, sizeof(unsigned int), &_vertexCount, GL_STATIC_DRAW);
-        glBindBuffer(GL_UNIFORM_BUFFER, 0);
-    }
-}
-
 bool MeshViewportCompute::hasOpenGL()
 {
     // test an arbitrary OpenGL function pointer and make sure it is not nullptr
     return nullptr != glBindBufferBase;
 }
 
-void MeshViewportCompute::initializeOpenGL()
+void MeshViewportCompute::prepareSkinningBuffers()
 {
-#if PXR_VERSION < 2102
-    GlfGlewInit();
-#else
-    GarchGLApiLoad();
+#if defined(HDVP2_OPENGL_NORMALS)
+    HdVP2SkinningData& skinningData = *_meshSharedData->_skinningData;
+
+    MayaUsd::ProfilingScope subProfilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "MeshViewportCompute:prepareSkinningBuffers");
+
+    // The rest points and influences only change with the skinning setup, each frame of
+    // animation only uploads the joint transforms.
+    if (skinningData._restPointsDirty || !_restPointsGPU || !_influencesGPU) {
+        skinningData._restPointsDirty = false;
+
+        const MHWRender::MVertexBufferDescriptor restPointsDesc(
+            "", MHWRender::MGeometry::kPosition, MHWRender::MGeometry::kFloat, 3);
+        _restPointsGPU.reset(new MHWRender::MVertexBuffer(restPointsDesc));
+        void* bufferData = _restPointsGPU->acquire(skinningData._restPoints.size(), true);
+        memcpy(
+            bufferData,
+            skinningData._restPoints.cdata(),
+            skinningData._restPoints.size() * sizeof(GfVec3f));
+        _restPointsGPU->commit(bufferData);
+
+        const MHWRender::MVertexBufferDescriptor influencesDesc(
+            "", MHWRender::MGeometry::kTexture, MHWRender::MGeometry::kFloat, 2);
+        _influencesGPU.reset(new MHWRender::MVertexBuffer(influencesDesc));
+        bufferData = _influencesGPU->acquire(skinningData._influences.size(), true);
+        memcpy(
+            bufferData,
+            skinningData._influences.cdata(),
+            skinningData._influences.size() * sizeof(GfVec2f));
+        _influencesGPU->commit(bufferData);
+    }
+
+    // Each joint transform is uploaded as four rows of four floats.
+    const MHWRender::MVertexBufferDescriptor xformsDesc(
+        "", MHWRender::MGeometry::kTexture, MHWRender::MGeometry::kFloat, 4);
+    if (!_skinningXformsGPU) {
+        _skinningXformsGPU.reset(new MHWRender::MVertexBuffer(xformsDesc));
+    }
+    void* bufferData = _skinningXformsGPU->acquire(skinningData._skinningXforms.size() * 4, true);
+    memcpy(
+        bufferData,
+        skinningData._skinningXforms.cdata(),
+        skinningData._skinningXforms.size() * sizeof(GfMatrix4f));
+    _skinningXformsGPU->commit(bufferData);
+
+    if (hasOpenGL()) {
+        const unsigned int values[4]
+            = { _vertexCount,
+                static_cast<unsigned int>(skinningData._numInfluencesPerComponent),
+                skinningData._hasConstantInfluences ? 1u : 0u,
+                static_cast<unsigned int>(skinningData._skinningXforms.size()) };
+        if (0 == _skinningUboResourceHandle)
+            glGenBuffers(1, &_skinningUboResourceHandle);
+        glBindBuffer(GL_UNIFORM_BUFFER, _skinningUboResourceHandle);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(values), values, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
 #endif
 }
 
-void MeshViewportCompute::compileNormalsProgram()
+void MeshViewportCompute::compileSkinningProgram()
 {
 #if defined(HDVP2_OPENGL_NORMALS)
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
-        "MeshViewportCompute:compileNormalsProgram");
+        "MeshViewportCompute:compileSkinningProgram");
 
-    std::string   computeShaderSource = _GetResourcePath("computeNormals.glsl");
-    std::ifstream glslFile(computeShaderSource.c_str());
-    std::string   glslString;
-    glslFile.seekg(0, std::ios::end);
-    glslString.reserve(glslFile.tellg());
-    glslFile.seekg(0, std::ios::beg);
-
-    glslString.assign((std::istreambuf_iterator<char>(glslFile)), std::istreambuf_iterator<char>());
-
-    _computeNormalsProgram = new PxrMayaGLSLProgram;
-    _computeNormalsProgram->CompileShader(GL_COMPUTE_SHADER, glslString);
-    _computeNormalsProgram->Link();
-    _computeNormalsProgram->Validate();
+    _computeSkinningProgram = new PxrMayaGLSLProgram;
+    _computeSkinningProgram->CompileShader(
+        GL_COMPUTE_SHADER, MeshViewportComputeBackend::readShaderSource("computeSkinning.glsl"));
+    _computeSkinningProgram->Link();
+    _computeSkinningProgram->Validate();
     openGLErrorCheck();
 #endif
 }
 
-void MeshViewportCompute::computeNormals()
+void MeshViewportCompute::computeSkinning()
 {
 #if defined(HDVP2_OPENGL_NORMALS)
+    if (!_skinningDirty)
+        return;
+    _skinningDirty = false;
 
-    if (!_normalVertexBufferGPUDirty)
+    if (!_meshSharedData->_skinningData)
         return;
-    _normalVertexBufferGPUDirty = false;
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
-        "MeshViewportCompute:computeNormals");
-    GLuint* adjacencyBufferResourceHandle = (GLuint*)_adjacencyBufferGPU->resourceHandle();
+        "MeshViewportCompute:computeSkinning");
 
-    std::call_once(_compileProgramOnce, MeshViewportCompute::compileNormalsProgram);
+    prepareSkinningBuffers();
 
-    GLuint programId = _computeNormalsProgram->GetProgramId();
+    std::call_once(_compileSkinningProgramOnce, MeshViewportCompute::compileSkinningProgram);
 
-    // We already did another lambda task that did the commit for _positionsBuffer, so we should be
-    // able to get the resource handle.
-    GLuint* positionBufferResourceHandle = (GLuint*)_positionVertexBufferGPU->resourceHandle();
+    GLuint programId = _computeSkinningProgram->GetProgramId();
 
-    // normal buffer needs to be locked because we are modifying it. We don't want the CPU version
-    // and GPU version of the buffer to hold different data. Locking the buffer deletes the CPU
-    // version of the buffer.
-    _normalVertexBufferGPU->lockResourceHandle();
-    GLuint* normalBufferResourceHandle = (GLuint*)_normalVertexBufferGPU->resourceHandle();
+    // position buffer needs to be locked because we are modifying it, the same way the normal
+    // buffer is locked when computing normals.
+    _positionVertexBufferGPU->lockResourceHandle();
+    GLuint* positionBufferResourceHandle = (GLuint*)_positionVertexBufferGPU->resourceHandle();
 
-    // remapping buffers
+    GLuint* restPointsResourceHandle = (GLuint*)_restPointsGPU->resourceHandle();
     GLuint* renderingToSceneFaceVtxIdsResourceHandle
         = (GLuint*)_renderingToSceneFaceVtxIdsGPU->resourceHandle();
-    GLuint* sceneToRenderingFaceVtxIdsResourceHandle
-        = (GLuint*)_sceneToRenderingFaceVtxIdsGPU->resourceHandle();
+    GLuint* influencesResourceHandle = (GLuint*)_influencesGPU->resourceHandle();
+    GLuint* skinningXformsResourceHandle = (GLuint*)_skinningXformsGPU->resourceHandle();
 
     if (hasOpenGL()) {
-        glBindBufferBase(GL_UNIFORM_BUFFER, 0, _uboResourceHandle);
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, _skinningUboResourceHandle);
         openGLErrorCheck();
 
         glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, *positionBufferResourceHandle);
-        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, *adjacencyBufferResourceHandle);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, *restPointsResourceHandle);
         glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, *renderingToSceneFaceVtxIdsResourceHandle);
-        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, *sceneToRenderingFaceVtxIdsResourceHandle);
-        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, *normalBufferResourceHandle);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, *influencesResourceHandle);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, *skinningXformsResourceHandle);
         openGLErrorCheck();
 
         size_t localWorkSize = 256;
@@ -858,6 +887,8 @@ void MeshViewportCompute::computeNormals()
         glUseProgram(programId);
         glDispatchCompute(num_groups, 1, 1);
         glUseProgram(0);
+        // The normals computation reads the skinned positions.
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
         openGLErrorCheck();
 
         glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0);
@@ -868,6 +899,42 @@ void MeshViewportCompute::computeNormals()
         glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, 0);
         openGLErrorCheck();
     }
+    _positionVertexBufferGPU->unlockResourceHandle();
+
+    // The normals follow the skinned positions.
+    _normalVertexBufferGPUDirty = true;
+#endif
+}
+
+void MeshViewportCompute::computeNormals(MeshViewportComputeBackend& backend)
+{
+#if defined(HDVP2_OPENGL_NORMALS)
+
+    if (!_normalVertexBufferGPUDirty)
+        return;
+    _normalVertexBufferGPUDirty = false;
+
+    MayaUsd::ProfilingScope subProfilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "MeshViewportCompute:computeNormals");
+
+    // normal buffer needs to be locked because we are modifying it. We don't want the CPU version
+    // and GPU version of the buffer to hold different data. Locking the buffer deletes the CPU
+    // version of the buffer.
+    _normalVertexBufferGPU->lockResourceHandle();
+
+    // We already did another lambda task that did the commit for _positionsBuffer, so we should be
+    // able to get the resource handle.
+    MeshViewportComputeBackend::NormalsBuffers buffers;
+    buffers.positions = _positionVertexBufferGPU;
+    buffers.adjacency = _adjacencyBufferGPU.get();
+    buffers.renderingToSceneFaceVtxIds = _renderingToSceneFaceVtxIdsGPU.get();
+    buffers.sceneToRenderingFaceVtxIds = _sceneToRenderingFaceVtxIdsGPU.get();
+    buffers.normals = _normalVertexBufferGPU;
+    buffers.vertexCount = _vertexCount;
+    TF_VERIFY(backend.computeNormals(buffers));
+
     _normalVertexBufferGPU->unlockResourceHandle();
 #elif defined(HDVP2_OPENCL_NORMALS)
 
@@ -876,7 +943,7 @@ void MeshViewportCompute::computeNormals()
     cl_int              err;
 
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L2,
             "MeshViewportCompute:copyAdjacencyToOpenCL");
@@ -898,7 +965,7 @@ void MeshViewportCompute::computeNormals()
     }
 
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L2,
             "MeshViewportCompute:attachToGLBuffers");
@@ -931,7 +998,7 @@ void MeshViewportCompute::computeNormals()
     // acquire the shared buffers
     MAutoCLEvent acquireEvent;
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L2,
             "MeshViewportCompute:acquireSharedBuffers");
@@ -979,7 +1046,7 @@ void MeshViewportCompute::computeNormals()
 
     cl_event* events = new cl_event[consolidatedItems.size()];
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L2,
             "MeshViewportCompute:enqueueKernels");
@@ -1044,7 +1111,7 @@ void MeshViewportCompute::computeNormals()
     // release the shared buffers
     MAutoCLEvent releaseEvent;
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L2,
             "MeshViewportCompute:releaseSharedBuffers");
@@ -1067,7 +1134,7 @@ void MeshViewportCompute::computeNormals()
 #endif
     }
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L3,
             "MeshViewportCompute:syncOpenCL");
@@ -1075,7 +1142,7 @@ void MeshViewportCompute::computeNormals()
     }
     delete[] events;
 
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L2,
         "MeshViewportCompute:releaseOpenCLBuffers");
@@ -1100,7 +1167,7 @@ void MeshViewportCompute::computeNormals()
 void MeshViewportCompute::computeOSD()
 {
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
-    MProfilingScope subProfilingScope(
+    MayaUsd::ProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "MeshViewportCompute:doOSD");
     // Inspired by HdSt_Osd3TopologyComputation::Resolve()
 
@@ -1262,6 +1329,7 @@ void MeshViewportCompute::setClean()
     _topologyDirty = false;
     _adjacencyBufferGPUDirty = false;
     _normalVertexBufferGPUDirty = false;
+    _skinningDirty = false;
     _executed = true;
 }
 
@@ -1273,14 +1341,14 @@ bool MeshViewportCompute::execute(
         return false;
     }
 
-    MProfilingScope mainProfilingScope(
+    MayaUsd::ProfilingScope mainProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L1,
         "MeshViewportCompute::execute");
 
     findConsolidationMapping(renderItem);
 
-    if (!_normalVertexBufferGPUDirty) {
+    if (!_normalVertexBufferGPUDirty && !_skinningDirty) {
         return true;
     }
 
@@ -1304,14 +1372,15 @@ bool MeshViewportCompute::execute(
 
     prepareAdjacencyBuffer();
 
-    if (!hasOpenGL()) {
-        initializeOpenGL();
+    // Creating the backend also loads the OpenGL functions used by the skinning.
+    MeshViewportComputeBackend* backend = MeshViewportComputeBackend::current();
+    if (!TF_VERIFY(backend)) {
+        return false;
     }
-    TF_VERIFY(hasOpenGL());
 
-    prepareUniformBufferForNormals();
+    computeSkinning();
 
-    computeNormals();
+    computeNormals(*backend);
 
     computeOSD(); // disabled by preprocessor macros
 
@@ -1327,6 +1396,10 @@ bool MeshViewportCompute::canConsolidate(const MPxViewportComputeItem& other) co
     if (nullptr == otherMeshViewportCompute)
         return false;
 
+    // Skinning reads the rest points and influences of a single mesh.
+    if (_meshSharedData->_skinningData || otherMeshViewportCompute->_meshSharedData->_skinningData)
+        return false;
+
     // If the compute has executed then the data to be consolidated will already
     // be smoothed. Smoothed items can only consolidate with other smoothed items.
     return hasExecuted() == otherMeshViewportCompute->hasExecuted()
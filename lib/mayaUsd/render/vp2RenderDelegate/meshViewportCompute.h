@@ -28,12 +28,19 @@
 
     The normal calculation code is enabled by setting HDVP2_USE_GPU_NORMAL_COMPUTATION=1 at runtime.
     The normal calculation code is close to being stable enough for general use, but hasn't had
-    enough polish to enable by default.
+    enough polish to enable by default. The kernels run through the MeshViewportComputeBackend of
+    the VP2 device, which exists for OpenGL and DirectX 11.
 
     The OSD code requires the normal calculation code to be enabled to use. OSD is enabled
     by compiling with HDVP2_ENABLE_GPU_OSD. The OSD code is much less stable then the normals
     calculation code and comes with a number of huge
 
+    GPU skinning of UsdSkel meshes is enabled by setting HDVP2_USE_GPU_SKINNING=1 at runtime, on
+    top of the normal calculation code, and only runs on OpenGL. The rest points and joint
+    influences are uploaded once and only the joint transforms are uploaded when the skeleton
+    animates. Meshes with blend shapes or using dual quaternion skinning are still skinned on the
+    CPU, and skinned meshes are not consolidated.
+
     OSD Limitations:
      * No OSD adaptive support
      * scenes with animation behave poorly
@@ -59,6 +66,8 @@
 //#define DO_CPU_OSD
 #endif
 
+#include <pxr/base/gf/matrix4f.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/imaging/hd/mesh.h>
 
 #include <maya/MHWGeometry.h>
@@ -129,8 +138,23 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 struct HdVP2MeshSharedData;
 class HdVP2DrawItem;
+class MeshViewportComputeBackend;
 class PxrMayaGLSLProgram;
 
+/*! \brief  UsdSkel linear blend skinning inputs of a mesh, evaluated by MeshViewportCompute.
+ */
+struct HdVP2SkinningData
+{
+    VtVec3fArray    _sourceRestPoints;                //!< Rest points as authored
+    GfMatrix4f      _geomBindXform { 1.0f };          //!< Transform applied to the rest points
+    VtVec3fArray    _restPoints;                      //!< Rest points in the skeleton bind space
+    VtVec2fArray    _influences;                      //!< Pairs of joint index and weight
+    int             _numInfluencesPerComponent { 0 }; //!< Number of influences of each point
+    bool            _hasConstantInfluences { false }; //!< Whether all points share influences
+    VtMatrix4fArray _skinningXforms;                  //!< Joint transforms to the prim space
+    bool            _restPointsDirty { true };        //!< Rest points need to be uploaded
+};
+
 /*! \brief  HdVP2Mesh-specific compute class for evaluating geometry streams and OSD
     \class  MeshViewportCompute
 
@@ -157,7 +181,6 @@ private:
 
     std::unique_ptr<MHWRender::MGeometryIndexMapping> _geometryIndexMapping;
     unsigned int                                      _vertexCount { 0 };
-    GLuint                                            _uboResourceHandle { 0 };
 
     // adjacency information for normals
     size_t                                    _adjacencyBufferSize { 0 };
@@ -173,10 +196,17 @@ private:
     MVertexBuffer* _normalVertexBufferGPU { nullptr };   // not owned by *this, owned by fRenderGeom
     MVertexBuffer* _colorVertexBufferGPU { nullptr };    // not owned by *this, owned by fRenderGeom
 
+    // skinning information
+    std::unique_ptr<MHWRender::MVertexBuffer> _restPointsGPU;
+    std::unique_ptr<MHWRender::MVertexBuffer> _influencesGPU;
+    std::unique_ptr<MHWRender::MVertexBuffer> _skinningXformsGPU;
+    GLuint                                    _skinningUboResourceHandle { 0 };
+
     bool _adjacencyTaskInProgress { false };
     bool _topologyDirty { true };           // sourceMeshSharedData->_renderingTopology has changed
     bool _adjacencyBufferGPUDirty { true }; //_adjacencyBufferGPU is dirty
     bool _normalVertexBufferGPUDirty { true }; //_normalVertexBufferGPU is dirty
+    bool _skinningDirty { false };             //_meshSharedData->_skinningData has changed
 
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
     // OSD information
@@ -188,8 +218,8 @@ private:
 #endif
 
 #if defined(HDVP2_OPENGL_NORMALS)
-    static std::once_flag      _compileProgramOnce;
-    static PxrMayaGLSLProgram* _computeNormalsProgram;
+    static std::once_flag      _compileSkinningProgramOnce;
+    static PxrMayaGLSLProgram* _computeSkinningProgram;
 #endif
 
 #if defined(HDVP2_OPENCL_NORMALS)
@@ -205,9 +235,7 @@ private:
     MAutoCLEvent                   _normalsBufferReady;
 #endif
 
-    static void openGLErrorCheck();
     static bool hasOpenGL();
-    static void initializeOpenGL();
     bool        hasExecuted() const;
     void        reset();
     void        findConsolidationMapping(MRenderItem& renderItem);
@@ -218,9 +246,10 @@ private:
     void        createConsolidatedOSDTables(MRenderItem& renderItem);
     void        findVertexBuffers(MRenderItem& renderItem);
     void        prepareAdjacencyBuffer();
-    void        prepareUniformBufferForNormals();
-    static void compileNormalsProgram();
-    void        computeNormals();
+    void        prepareSkinningBuffers();
+    static void compileSkinningProgram();
+    void        computeSkinning();
+    void        computeNormals(MeshViewportComputeBackend& backend);
     void        computeOSD();
     void        setClean();
 
@@ -240,8 +269,8 @@ public:
 
     virtual ~MeshViewportCompute()
     {
-        if (0 != _uboResourceHandle)
-            glDeleteBuffers(1, &_uboResourceHandle);
+        if (0 != _skinningUboResourceHandle)
+            glDeleteBuffers(1, &_skinningUboResourceHandle);
     }
 
     bool execute(const MPxViewportComputeItem::Actions& availableActions, MRenderItem& renderItem)
@@ -252,6 +281,9 @@ public:
     void setTopologyDirty();
     void setAdjacencyBufferGPUDirty();
     void setNormalVertexBufferGPUDirty();
+    void setSkinningDirty();
+
+    static void openGLErrorCheck();
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,199 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshViewportComputeBackend.h"
+
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+
+#include "render_delegate.h"
+
+#include <mayaUsd/utils/profilingScope.h>
+
+#include <maya/MProfiler.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+std::string _GetResourcePath(const std::string& resource)
+{
+    static PlugPluginPtr plugin
+        = PlugRegistry::GetInstance().GetPluginWithName("mayaUsd_ComputeShaders");
+    if (!TF_VERIFY(plugin, "Could not get plugin\n")) {
+        return std::string();
+    }
+
+    const std::string path = PlugFindPluginResource(plugin, resource);
+    TF_VERIFY(!path.empty(), "Cound not find resource: %s\n", resource.c_str());
+
+    return path;
+}
+
+#if defined(HDVP2_OPENGL_NORMALS)
+//! OpenGL 4.3 compute shader implementation, also used by the OpenGL core profile.
+class MeshViewportComputeGL : public MeshViewportComputeBackend
+{
+public:
+    MeshViewportComputeGL()
+    {
+#if PXR_VERSION < 2102
+        GlfGlewInit();
+#else
+        GarchGLApiLoad();
+#endif
+    }
+
+    bool computeNormals(const NormalsBuffers& buffers) override;
+
+private:
+    void compileNormalsProgram();
+
+    std::once_flag      _compileProgramOnce;
+    PxrMayaGLSLProgram* _computeNormalsProgram { nullptr };
+    GLuint              _uboResourceHandle { 0 };
+};
+
+void MeshViewportComputeGL::compileNormalsProgram()
+{
+    MayaUsd::ProfilingScope subProfilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "MeshViewportCompute:compileNormalsProgram");
+
+    _computeNormalsProgram = new PxrMayaGLSLProgram;
+    _computeNormalsProgram->CompileShader(
+        GL_COMPUTE_SHADER, readShaderSource("computeNormals.glsl"));
+    _computeNormalsProgram->Link();
+    _computeNormalsProgram->Validate();
+    MeshViewportCompute::openGLErrorCheck();
+}
+
+bool MeshViewportComputeGL::computeNormals(const NormalsBuffers& buffers)
+{
+    if (nullptr == glBindBufferBase)
+        return false;
+
+    std::call_once(_compileProgramOnce, [this]() { compileNormalsProgram(); });
+
+    GLuint programId = _computeNormalsProgram->GetProgramId();
+
+    // All the computes share the uniform buffer, it is updated before each dispatch.
+    if (0 == _uboResourceHandle)
+        glGenBuffers(1, &_uboResourceHandle);
+    glBindBuffer(GL_UNIFORM_BUFFER, _uboResourceHandle);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(unsigned int), &buffers.vertexCount, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    GLuint* positionBufferResourceHandle = (GLuint*)buffers.positions->resourceHandle();
+    GLuint* adjacencyBufferResourceHandle = (GLuint*)buffers.adjacency->resourceHandle();
+    GLuint* renderingToSceneFaceVtxIdsResourceHandle
+        = (GLuint*)buffers.renderingToSceneFaceVtxIds->resourceHandle();
+    GLuint* sceneToRenderingFaceVtxIdsResourceHandle
+        = (GLuint*)buffers.sceneToRenderingFaceVtxIds->resourceHandle();
+    GLuint* normalBufferResourceHandle = (GLuint*)buffers.normals->resourceHandle();
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, _uboResourceHandle);
+    MeshViewportCompute::openGLErrorCheck();
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, *positionBufferResourceHandle);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, *adjacencyBufferResourceHandle);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, *renderingToSceneFaceVtxIdsResourceHandle);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, *sceneToRenderingFaceVtxIdsResourceHandle);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, *normalBufferResourceHandle);
+    MeshViewportCompute::openGLErrorCheck();
+
+    size_t localWorkSize = kWorkGroupSize;
+    size_t globalWorkSize
+        = (localWorkSize - buffers.vertexCount % localWorkSize) + buffers.vertexCount;
+    size_t num_groups = globalWorkSize / localWorkSize;
+
+    glUseProgram(programId);
+    glDispatchCompute(num_groups, 1, 1);
+    glUseProgram(0);
+    MeshViewportCompute::openGLErrorCheck();
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, 0);
+    MeshViewportCompute::openGLErrorCheck();
+
+    return true;
+}
+#endif
+
+} // namespace
+
+/* static */
+bool MeshViewportComputeBackend::supportsDrawAPI(MHWRender::DrawAPI drawAPI)
+{
+    switch (drawAPI) {
+#if defined(HDVP2_OPENGL_NORMALS)
+    case MHWRender::kOpenGL:
+    case MHWRender::kOpenGLCoreProfile: return true;
+#endif
+#if defined(_WIN32)
+    case MHWRender::kDirectX11: return true;
+#endif
+    default: return false;
+    }
+}
+
+/* static */
+MeshViewportComputeBackend* MeshViewportComputeBackend::current()
+{
+    MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
+    if (!renderer)
+        return nullptr;
+
+    switch (renderer->drawAPI()) {
+#if defined(HDVP2_OPENGL_NORMALS)
+    case MHWRender::kOpenGL:
+    case MHWRender::kOpenGLCoreProfile: {
+        static MeshViewportComputeBackend* backend = new MeshViewportComputeGL;
+        return backend;
+    }
+#endif
+#if defined(_WIN32)
+    case MHWRender::kDirectX11: {
+        static MeshViewportComputeBackend* backend
+            = CreateMeshViewportComputeDX11(renderer->GPUDeviceHandle()).release();
+        return backend;
+    }
+#endif
+    default: return nullptr;
+    }
+}
+
+/* static */
+std::string MeshViewportComputeBackend::readShaderSource(const std::string& resource)
+{
+    std::string   computeShaderSource = _GetResourcePath(resource);
+    std::ifstream shaderFile(computeShaderSource.c_str());
+    std::string   shaderString;
+    shaderFile.seekg(0, std::ios::end);
+    shaderString.reserve(shaderFile.tellg());
+    shaderFile.seekg(0, std::ios::beg);
+
+    shaderString.assign(
+        (std::istreambuf_iterator<char>(shaderFile)), std::istreambuf_iterator<char>());
+    return shaderString;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -0,0 +1,85 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MESHVIEWPORTCOMPUTEBACKEND
+#define HD_VP2_MESHVIEWPORTCOMPUTEBACKEND
+
+#include "meshViewportCompute.h"
+
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+
+#include <maya/MHWGeometry.h>
+#include <maya/MViewport2Renderer.h>
+
+#include <memory>
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Graphics API specific implementation of the MeshViewportCompute kernels
+    \class  MeshViewportComputeBackend
+
+    MeshViewportCompute prepares its buffers as MVertexBuffers of the VP2 device and hands
+    them to the backend of the device to run the kernels. Each backend interprets the resource
+    handles of the buffers for its own graphics API: a GLuint* on OpenGL and an ID3D11Buffer*
+    on DirectX 11.
+
+    The backends are created on first use and are never destroyed, since they hold resources
+    of the device which may already be gone when static objects are destroyed.
+*/
+class MeshViewportComputeBackend
+{
+public:
+    //! Inputs and output of the smooth normals kernel
+    struct NormalsBuffers
+    {
+        MHWRender::MVertexBuffer* positions { nullptr };
+        MHWRender::MVertexBuffer* adjacency { nullptr };
+        MHWRender::MVertexBuffer* renderingToSceneFaceVtxIds { nullptr };
+        MHWRender::MVertexBuffer* sceneToRenderingFaceVtxIds { nullptr };
+        MHWRender::MVertexBuffer* normals { nullptr };
+        unsigned int              vertexCount { 0 };
+    };
+
+    //! Number of threads in a work group of the kernels
+    static constexpr unsigned int kWorkGroupSize = 256;
+
+    virtual ~MeshViewportComputeBackend() = default;
+
+    //! Whether there is a backend for the given VP2 draw API
+    static bool supportsDrawAPI(MHWRender::DrawAPI drawAPI);
+
+    //! Returns the backend of the current VP2 device, nullptr if there is none. Must be called
+    //! from the thread drawing the viewport.
+    static MeshViewportComputeBackend* current();
+
+    //! Returns the content of a compute shader resource of the mayaUsd_ComputeShaders plugin
+    static std::string readShaderSource(const std::string& resource);
+
+    //! Writes the smooth normals of the rendering vertices. Returns false if the kernel could
+    //! not run.
+    virtual bool computeNormals(const NormalsBuffers& buffers) = 0;
+};
+
+#if defined(_WIN32)
+//! Creates the DirectX 11 backend for the ID3D11Device of the VP2 device
+std::unique_ptr<MeshViewportComputeBackend> CreateMeshViewportComputeDX11(void* device);
+#endif
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
+
+#endif
@@ -0,0 +1,263 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshViewportComputeBackend.h"
+
+#if defined(HDVP2_ENABLE_GPU_COMPUTE) && defined(_WIN32)
+
+#include "render_delegate.h"
+
+#include <mayaUsd/utils/profilingScope.h>
+
+#include <maya/MProfiler.h>
+
+#include <d3d11.h>
+#include <d3dcompiler.h>
+#include <wrl/client.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+using Microsoft::WRL::ComPtr;
+
+/*! \brief  DirectX 11 compute shader implementation
+
+    Maya creates its vertex buffers with the vertex buffer binding only, so the kernel cannot
+    access them directly. Their content is copied on the GPU into raw buffers the kernel can
+    read, and the normals are written to a raw buffer which is then copied into the normals
+    vertex buffer. The raw buffers are shared by all the computes and only grow.
+*/
+class MeshViewportComputeDX11 : public MeshViewportComputeBackend
+{
+public:
+    MeshViewportComputeDX11(ID3D11Device* device)
+        : _device(device)
+    {
+        _device->GetImmediateContext(&_context);
+    }
+
+    bool computeNormals(const NormalsBuffers& buffers) override;
+
+private:
+    struct RawBuffer
+    {
+        ComPtr<ID3D11Buffer>              buffer;
+        ComPtr<ID3D11ShaderResourceView>  srv;
+        ComPtr<ID3D11UnorderedAccessView> uav;
+        UINT                              byteWidth { 0 };
+    };
+
+    bool compileNormalsShader();
+    bool prepareRawBuffer(RawBuffer& raw, UINT byteWidth, bool writable);
+    bool copyToRawBuffer(RawBuffer& raw, MHWRender::MVertexBuffer& source, UINT byteWidth);
+
+    ComPtr<ID3D11Device>        _device;
+    ComPtr<ID3D11DeviceContext> _context;
+    ComPtr<ID3D11ComputeShader> _computeNormalsShader;
+    ComPtr<ID3D11Buffer>        _constants;
+    bool                        _shaderCompiled { false };
+
+    RawBuffer _positions;
+    RawBuffer _adjacency;
+    RawBuffer _renderingToSceneFaceVtxIds;
+    RawBuffer _sceneToRenderingFaceVtxIds;
+    RawBuffer _normals;
+};
+
+bool MeshViewportComputeDX11::compileNormalsShader()
+{
+    if (_shaderCompiled)
+        return _computeNormalsShader != nullptr;
+    _shaderCompiled = true;
+
+    MayaUsd::ProfilingScope subProfilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "MeshViewportCompute:compileNormalsProgram");
+
+    const std::string source = readShaderSource("computeNormals.hlsl");
+
+    ComPtr<ID3DBlob> code;
+    ComPtr<ID3DBlob> errors;
+    HRESULT          hr = D3DCompile(
+        source.data(),
+        source.size(),
+        "computeNormals.hlsl",
+        nullptr,
+        nullptr,
+        "main",
+        "cs_5_0",
+        D3DCOMPILE_OPTIMIZATION_LEVEL3,
+        0,
+        &code,
+        &errors);
+    if (FAILED(hr)) {
+        TF_WARN(
+            "Failed to compile computeNormals.hlsl: %s",
+            errors ? (const char*)errors->GetBufferPointer() : "");
+        return false;
+    }
+
+    hr = _device->CreateComputeShader(
+        code->GetBufferPointer(), code->GetBufferSize(), nullptr, &_computeNormalsShader);
+    if (FAILED(hr))
+        return false;
+
+    // Constant buffers are a multiple of 16 bytes, only the first uint is used.
+    D3D11_BUFFER_DESC constantsDesc = {};
+    constantsDesc.ByteWidth = 16;
+    constantsDesc.Usage = D3D11_USAGE_DEFAULT;
+    constantsDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    hr = _device->CreateBuffer(&constantsDesc, nullptr, &_constants);
+    if (FAILED(hr)) {
+        _computeNormalsShader.Reset();
+        return false;
+    }
+    return true;
+}
+
+bool MeshViewportComputeDX11::prepareRawBuffer(RawBuffer& raw, UINT byteWidth, bool writable)
+{
+    if (raw.buffer && raw.byteWidth >= byteWidth)
+        return true;
+
+    raw = RawBuffer();
+
+    D3D11_BUFFER_DESC desc = {};
+    desc.ByteWidth = byteWidth;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = writable ? D3D11_BIND_UNORDERED_ACCESS : D3D11_BIND_SHADER_RESOURCE;
+    desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    if (FAILED(_device->CreateBuffer(&desc, nullptr, &raw.buffer)))
+        return false;
+
+    if (writable) {
+        D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
+        uavDesc.Format = DXGI_FORMAT_R32_TYPELESS;
+        uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+        uavDesc.Buffer.NumElements = byteWidth / 4;
+        uavDesc.Buffer.Flags = D3D11_BUFFER_UAV_FLAG_RAW;
+        if (FAILED(_device->CreateUnorderedAccessView(raw.buffer.Get(), &uavDesc, &raw.uav)))
+            return false;
+    } else {
+        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+        srvDesc.Format = DXGI_FORMAT_R32_TYPELESS;
+        srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFEREX;
+        srvDesc.BufferEx.NumElements = byteWidth / 4;
+        srvDesc.BufferEx.Flags = D3D11_BUFFEREX_SRV_FLAG_RAW;
+        if (FAILED(_device->CreateShaderResourceView(raw.buffer.Get(), &srvDesc, &raw.srv)))
+            return false;
+    }
+
+    raw.byteWidth = byteWidth;
+    return true;
+}
+
+bool MeshViewportComputeDX11::copyToRawBuffer(
+    RawBuffer&                raw,
+    MHWRender::MVertexBuffer& source,
+    UINT                      byteWidth)
+{
+    ID3D11Buffer* sourceBuffer = (ID3D11Buffer*)source.resourceHandle();
+    if (!sourceBuffer || !prepareRawBuffer(raw, byteWidth, false))
+        return false;
+
+    const D3D11_BOX box = { 0, 0, 0, byteWidth, 1, 1 };
+    _context->CopySubresourceRegion(raw.buffer.Get(), 0, 0, 0, 0, sourceBuffer, 0, &box);
+    return true;
+}
+
+bool MeshViewportComputeDX11::computeNormals(const NormalsBuffers& buffers)
+{
+    if (!compileNormalsShader())
+        return false;
+
+    ID3D11Buffer* normalsBuffer = (ID3D11Buffer*)buffers.normals->resourceHandle();
+    if (!normalsBuffer)
+        return false;
+
+    // GPU copies are only possible into default usage buffers.
+    D3D11_BUFFER_DESC normalsDesc;
+    normalsBuffer->GetDesc(&normalsDesc);
+    if (normalsDesc.Usage != D3D11_USAGE_DEFAULT) {
+        TF_WARN("The VP2 normals buffer cannot be written by the DirectX 11 normals compute.");
+        return false;
+    }
+
+    const UINT pointsByteWidth = buffers.vertexCount * 3 * sizeof(float);
+    const UINT adjacencyByteWidth = buffers.adjacency->vertexCount() * sizeof(int);
+    const UINT renderingToSceneByteWidth
+        = buffers.renderingToSceneFaceVtxIds->vertexCount() * sizeof(int);
+    const UINT sceneToRenderingByteWidth
+        = buffers.sceneToRenderingFaceVtxIds->vertexCount() * sizeof(int);
+
+    if (!copyToRawBuffer(_positions, *buffers.positions, pointsByteWidth)
+        || !copyToRawBuffer(_adjacency, *buffers.adjacency, adjacencyByteWidth)
+        || !copyToRawBuffer(
+            _renderingToSceneFaceVtxIds,
+            *buffers.renderingToSceneFaceVtxIds,
+            renderingToSceneByteWidth)
+        || !copyToRawBuffer(
+            _sceneToRenderingFaceVtxIds,
+            *buffers.sceneToRenderingFaceVtxIds,
+            sceneToRenderingByteWidth)
+        || !prepareRawBuffer(_normals, pointsByteWidth, true)) {
+        return false;
+    }
+
+    const UINT constants[4] = { buffers.vertexCount, 0, 0, 0 };
+    _context->UpdateSubresource(_constants.Get(), 0, nullptr, constants, 0, 0);
+
+    ID3D11ShaderResourceView* srvs[] = { _positions.srv.Get(),
+                                         _adjacency.srv.Get(),
+                                         _renderingToSceneFaceVtxIds.srv.Get(),
+                                         _sceneToRenderingFaceVtxIds.srv.Get() };
+    ID3D11UnorderedAccessView* uav = _normals.uav.Get();
+
+    _context->CSSetShader(_computeNormalsShader.Get(), nullptr, 0);
+    _context->CSSetConstantBuffers(0, 1, _constants.GetAddressOf());
+    _context->CSSetShaderResources(0, 4, srvs);
+    _context->CSSetUnorderedAccessViews(0, 1, &uav, nullptr);
+
+    _context->Dispatch((buffers.vertexCount + kWorkGroupSize - 1) / kWorkGroupSize, 1, 1);
+
+    // Unbind everything so that the buffers can be used by the rest of the frame.
+    ID3D11ShaderResourceView*  nullSrvs[] = { nullptr, nullptr, nullptr, nullptr };
+    ID3D11UnorderedAccessView* nullUav = nullptr;
+    ID3D11Buffer*              nullConstants = nullptr;
+    _context->CSSetShaderResources(0, 4, nullSrvs);
+    _context->CSSetUnorderedAccessViews(0, 1, &nullUav, nullptr);
+    _context->CSSetConstantBuffers(0, 1, &nullConstants);
+    _context->CSSetShader(nullptr, nullptr, 0);
+
+    const D3D11_BOX box = { 0, 0, 0, pointsByteWidth, 1, 1 };
+    _context->CopySubresourceRegion(normalsBuffer, 0, 0, 0, 0, _normals.buffer.Get(), 0, &box);
+
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<MeshViewportComputeBackend> CreateMeshViewportComputeDX11(void* device)
+{
+    if (!device)
+        return nullptr;
+    return std::make_unique<MeshViewportComputeDX11>(static_cast<ID3D11Device*>(device));
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -0,0 +1,180 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "pickingScene.h"
+
+#include "instancer.h"
+#include "mesh.h"
+#include "render_delegate.h"
+
+#include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
+#include <mayaUsd/utils/profilingScope.h>
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/imaging/hd/renderIndex.h>
+#include <pxr/imaging/hd/sceneDelegate.h>
+
+#include <maya/MProfiler.h>
+
+#include <limits>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_CPU_PICKING,
+    false,
+    "Answer the ray casts against the meshes of a proxy shape with CPU hierarchies of their "
+    "triangles instead of letting the closest point queries fall back to the GL batch renderer.");
+
+bool HdVP2PickingScene::IsEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_CPU_PICKING);
+    return enabled;
+}
+
+void HdVP2PickingScene::SetSyncedSceneStateVersion(unsigned int version)
+{
+    _syncedSceneStateVersion = version;
+}
+
+bool HdVP2PickingScene::Intersect(
+    const ProxyRenderDelegate& drawScene,
+    HdRenderIndex&             renderIndex,
+    HdSceneDelegate&           sceneDelegate,
+    const GfRay&               worldRay,
+    Hit*                       hit)
+{
+    if (!hit) {
+        return false;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L1,
+        "HdVP2PickingScene::Intersect");
+
+    if (!_built || _builtSceneStateVersion != _syncedSceneStateVersion) {
+        _Rebuild(drawScene, renderIndex, sceneDelegate);
+    }
+
+    bool found = false;
+    _entriesBVH.Intersect(
+        worldRay,
+        std::numeric_limits<double>::max(),
+        [this, &renderIndex, &worldRay, hit, &found](size_t entryIndex, double& maxDistance) {
+            const _Entry&    entry = _entries[entryIndex];
+            const HdVP2Mesh* mesh
+                = dynamic_cast<const HdVP2Mesh*>(renderIndex.GetRprim(entry._rprimId));
+            const HdVP2TriangleBVHSharedPtr bvh = mesh ? mesh->GetTriangleBVH() : nullptr;
+            if (!bvh) {
+                return;
+            }
+
+            // GfRay::Transform() keeps the parametric distances, the hits of the different
+            // entries can be compared without going back to world space.
+            GfRay localRay = worldRay;
+            localRay.Transform(entry._worldToLocal);
+
+            double  distance = 0.0;
+            GfVec3d normal;
+            if (!bvh->Intersect(localRay, maxDistance, &distance, &normal)) {
+                return;
+            }
+
+            maxDistance = distance;
+            hit->_rprimId = entry._rprimId;
+            hit->_instanceIndex = entry._instanceIndex;
+            hit->_point = worldRay.GetPoint(distance);
+            hit->_normal = entry._worldToLocal.GetTranspose().TransformDir(normal).GetNormalized();
+            hit->_distance = distance;
+            found = true;
+        });
+
+    return found;
+}
+
+void HdVP2PickingScene::_Rebuild(
+    const ProxyRenderDelegate& drawScene,
+    HdRenderIndex&             renderIndex,
+    HdSceneDelegate&           sceneDelegate)
+{
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L1,
+        "HdVP2PickingScene::Rebuild");
+
+    _entries.clear();
+    std::vector<GfRange3f> entryBounds;
+
+    const auto addEntry = [this, &entryBounds](
+                              const SdfPath&    id,
+                              int               instanceIndex,
+                              const GfMatrix4d& localToWorld,
+                              const GfRange3d&  localBounds) {
+        _entries.push_back({ id, instanceIndex, localToWorld, localToWorld.GetInverse() });
+
+        const GfRange3d worldBounds = GfBBox3d(localBounds, localToWorld).ComputeAlignedRange();
+        entryBounds.emplace_back(GfVec3f(worldBounds.GetMin()), GfVec3f(worldBounds.GetMax()));
+    };
+
+    for (const SdfPath& id : renderIndex.GetRprimIds()) {
+        const HdVP2Mesh* mesh = dynamic_cast<const HdVP2Mesh*>(renderIndex.GetRprim(id));
+        if (!mesh || !mesh->IsVisible() || !drawScene.DrawRenderTag(mesh->GetSyncedRenderTag())) {
+            continue;
+        }
+
+        // The triangles are only built for the meshes whose extent is not authored, the others
+        // are built on the first ray which hits their bounds.
+        GfRange3d localBounds = sceneDelegate.GetExtent(id);
+        if (localBounds.IsEmpty()) {
+            const HdVP2TriangleBVHSharedPtr bvh = mesh->GetTriangleBVH();
+            if (!bvh || bvh->GetBounds().IsEmpty()) {
+                continue;
+            }
+            localBounds = GfRange3d(bvh->GetBounds().GetMin(), bvh->GetBounds().GetMax());
+        }
+
+        // The transform includes the world matrix of the proxy shape, which is the root
+        // transform of the scene delegate.
+        const GfMatrix4d primMatrix = sceneDelegate.GetTransform(id);
+
+        const SdfPath& instancerId = mesh->GetInstancerId();
+        if (instancerId.IsEmpty()) {
+            addEntry(id, -1, primMatrix, localBounds);
+            continue;
+        }
+
+        HdInstancer* instancer = renderIndex.GetInstancer(instancerId);
+        if (!instancer) {
+            continue;
+        }
+
+        // Same transforms and instance order as the render items of the mesh, the instance
+        // index is the one resolved by ProxyRenderDelegate::getInstancedSelectionPath().
+        const VtMatrix4dArray transforms
+            = static_cast<HdVP2Instancer*>(instancer)->ComputeInstanceTransforms(id);
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            addEntry(id, static_cast<int>(i), primMatrix * transforms[i], localBounds);
+        }
+    }
+
+    _entriesBVH = HdVP2BoundsBVH(entryBounds);
+    _builtSceneStateVersion = _syncedSceneStateVersion;
+    _built = true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,105 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_PICKING_SCENE
+#define HD_VP2_PICKING_SCENE
+
+#include "boundsBVH.h"
+#include "triangleBVH.h"
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class HdRenderIndex;
+class HdSceneDelegate;
+class ProxyRenderDelegate;
+
+/*! \brief  CPU ray casts against the meshes of a proxy shape.
+    \class  HdVP2PickingScene
+
+    The picking scene is a two-level hierarchy: the top level holds the world bounds of every
+    visible mesh and mesh instance, the bottom level is the triangle hierarchy of each mesh, built
+    by the mesh on first use and shared by its instances. The top level is rebuilt on the next ray
+    cast after the render index was synchronized with changes, which includes the proxy shape
+    moving since its world matrix is the root transform of the scene delegate.
+
+    The picking scene is enabled by the MAYAUSD_VP2_CPU_PICKING environment variable. All methods
+    must be called from the main thread, outside of the synchronization of the render index.
+*/
+class HdVP2PickingScene final
+{
+public:
+    //! Closest intersection of a ray with the meshes.
+    struct Hit
+    {
+        SdfPath _rprimId;              //!< Id of the mesh hit
+        int     _instanceIndex { -1 }; //!< Index of the instance hit, -1 for a non-instanced mesh
+        GfVec3d _point;                //!< World space position of the hit
+        GfVec3d _normal;               //!< World space normal of the triangle hit
+        double  _distance { 0.0 };     //!< Parametric distance of the hit along the ray
+    };
+
+    //! Return true when the ray casts run on the CPU.
+    static bool IsEnabled();
+
+    HdVP2PickingScene() = default;
+    ~HdVP2PickingScene() = default;
+
+    //! Record the version of the scene state after the render index was synchronized.
+    void SetSyncedSceneStateVersion(unsigned int version);
+
+    /*! \brief  Find the closest intersection of a world space ray with the visible meshes.
+
+        \return True if a mesh was hit.
+    */
+    bool Intersect(
+        const ProxyRenderDelegate& drawScene,
+        HdRenderIndex&             renderIndex,
+        HdSceneDelegate&           sceneDelegate,
+        const GfRay&               worldRay,
+        Hit*                       hit);
+
+private:
+    //! One mesh, or instance of a mesh, of the top level.
+    struct _Entry
+    {
+        SdfPath    _rprimId;
+        int        _instanceIndex;
+        GfMatrix4d _localToWorld;
+        GfMatrix4d _worldToLocal;
+    };
+
+    void _Rebuild(
+        const ProxyRenderDelegate& drawScene,
+        HdRenderIndex&             renderIndex,
+        HdSceneDelegate&           sceneDelegate);
+
+    std::vector<_Entry> _entries;
+    HdVP2BoundsBVH      _entriesBVH; //!< Hierarchy of the world bounds of _entries
+    unsigned int        _syncedSceneStateVersion { 0 };
+    unsigned int        _builtSceneStateVersion { 0 };
+    bool                _built { false };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_PICKING_SCENE
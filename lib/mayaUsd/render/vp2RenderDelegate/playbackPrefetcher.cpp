@@ -0,0 +1,221 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "playbackPrefetcher.h"
+
+#include "tokens.h"
+
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/imaging/hd/perfLog.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usdGeom/primvar.h>
+
+#include <algorithm>
+#include <cmath>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_PLAYBACK_PREFETCH_FRAMES,
+    0,
+    "Number of frames whose time-varying primvars are resolved on worker threads ahead of the "
+    "current frame during playback. A value of 0 disables prefetching.");
+
+size_t HdVP2PlaybackPrefetcher::GetNumPrefetchFrames()
+{
+    static const size_t numFrames
+        = static_cast<size_t>(std::max(TfGetEnvSetting(MAYAUSD_VP2_PLAYBACK_PREFETCH_FRAMES), 0));
+    return numFrames;
+}
+
+HdVP2PlaybackPrefetcher::HdVP2PlaybackPrefetcher(size_t numFrames)
+    : _numFrames(numFrames)
+{
+}
+
+HdVP2PlaybackPrefetcher::~HdVP2PlaybackPrefetcher()
+{
+    _cancelled = true;
+    _dispatcher.Wait();
+    TfNotice::Revoke(_objectsChangedKey);
+}
+
+void HdVP2PlaybackPrefetcher::BeginUpdate(const UsdStageRefPtr& stage, bool isPlaying)
+{
+    // The tasks of the previous update are done, EndUpdate() waited for them.
+    if (_stage != stage) {
+        TfNotice::Revoke(_objectsChangedKey);
+        _Clear();
+
+        _stage = stage;
+        if (stage) {
+            _objectsChangedKey = TfNotice::Register(
+                TfCreateWeakPtr(this), &HdVP2PlaybackPrefetcher::_OnObjectsChanged, _stage);
+        }
+    }
+
+    if (_stageChanged.exchange(false) || !isPlaying) {
+        _Clear();
+    }
+
+    _isPlaying = isPlaying;
+}
+
+void HdVP2PlaybackPrefetcher::Prefetch(
+    UsdTimeCode                     time,
+    double                          timeStep,
+    const std::vector<UsdTimeCode>& nextTimes)
+{
+    if (!_isPlaying || _numFrames == 0 || timeStep <= 0.0 || time.IsDefault()) {
+        return;
+    }
+
+    _timeStep = timeStep;
+
+    std::vector<UsdTimeCode> times(
+        nextTimes.begin(), nextTimes.begin() + std::min(nextTimes.size(), _numFrames));
+
+    _cancelled = false;
+
+    std::lock_guard<std::mutex> lock(_tracksMutex);
+    for (const auto& entry : _tracks) {
+        _Track* track = entry.second.get();
+        if (!track) {
+            continue;
+        }
+
+        _dispatcher.Run([this, track, times]() {
+            for (const UsdTimeCode& frameTime : times) {
+                if (_cancelled) {
+                    return;
+                }
+
+                _Slot& slot = track->_slots[_GetSlotIndex(frameTime)];
+                {
+                    std::lock_guard<std::mutex> slotLock(track->_mutex);
+                    if (slot._time == frameTime && !slot._value.IsEmpty()) {
+                        continue;
+                    }
+                }
+
+                VtValue value;
+                if (track->_attribute.Get(&value, frameTime)) {
+                    std::lock_guard<std::mutex> slotLock(track->_mutex);
+                    slot._time = frameTime;
+                    slot._value = std::move(value);
+                }
+            }
+        });
+    }
+}
+
+void HdVP2PlaybackPrefetcher::EndUpdate() { _dispatcher.Wait(); }
+
+bool HdVP2PlaybackPrefetcher::Consume(
+    const SdfPath& rprimId,
+    const SdfPath& usdPrimPath,
+    const TfToken& primvarName,
+    UsdTimeCode    time,
+    VtValue&       value)
+{
+    if (!_isPlaying || time.IsDefault()) {
+        return false;
+    }
+
+    _Track* track = _FindOrCreateTrack(rprimId, usdPrimPath, primvarName);
+    if (!track) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(track->_mutex);
+    _Slot&                      slot = track->_slots[_GetSlotIndex(time)];
+    if (slot._time != time || slot._value.IsEmpty()) {
+        return false;
+    }
+
+    value = std::move(slot._value);
+    slot._value = VtValue();
+    HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2PrefetchedPrimvars);
+    return true;
+}
+
+HdVP2PlaybackPrefetcher::_Track* HdVP2PlaybackPrefetcher::_FindOrCreateTrack(
+    const SdfPath& rprimId,
+    const SdfPath& usdPrimPath,
+    const TfToken& primvarName)
+{
+    const _TrackKey key(rprimId, primvarName);
+    {
+        std::lock_guard<std::mutex> lock(_tracksMutex);
+        auto                        it = _tracks.find(key);
+        if (it != _tracks.end()) {
+            return it->second.get();
+        }
+    }
+
+    // Only primvars read as is from a time-varying attribute can be prefetched: indexed primvars
+    // are flattened by the scene delegate. A null track is stored for all other primvars so the
+    // stage is only queried once.
+    std::unique_ptr<_Track> newTrack;
+    if (UsdStageRefPtr stage = _stage) {
+        const UsdPrim prim = stage->GetPrimAtPath(usdPrimPath);
+        UsdAttribute  attribute;
+        if (prim) {
+            attribute = prim.GetAttribute(primvarName);
+            if (!attribute) {
+                const UsdGeomPrimvar primvar(
+                    prim.GetAttribute(UsdGeomPrimvar::MakeNamespaced(primvarName)));
+                if (primvar && !primvar.IsIndexed()) {
+                    attribute = primvar.GetAttr();
+                }
+            }
+        }
+
+        if (attribute && attribute.ValueMightBeTimeVarying()) {
+            newTrack = std::make_unique<_Track>();
+            newTrack->_attribute = attribute;
+            newTrack->_slots.resize(_numFrames + 1);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_tracksMutex);
+    auto                        result = _tracks.emplace(key, std::move(newTrack));
+    return result.first->second.get();
+}
+
+size_t HdVP2PlaybackPrefetcher::_GetSlotIndex(UsdTimeCode time) const
+{
+    // One more slot than prefetched frames, so the current frame is never overwritten.
+    const long long numSlots = static_cast<long long>(_numFrames + 1);
+    const long long frame = std::llround(time.GetValue() / _timeStep);
+    return static_cast<size_t>(((frame % numSlots) + numSlots) % numSlots);
+}
+
+void HdVP2PlaybackPrefetcher::_Clear()
+{
+    std::lock_guard<std::mutex> lock(_tracksMutex);
+    _tracks.clear();
+}
+
+void HdVP2PlaybackPrefetcher::_OnObjectsChanged(
+    const UsdNotice::ObjectsChanged&,
+    const UsdStageWeakPtr&)
+{
+    // Values staged or being read may be stale, they are discarded by the next update.
+    _stageChanged = true;
+    _cancelled = true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,162 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_PLAYBACK_PREFETCHER
+#define HD_VP2_PLAYBACK_PREFETCHER
+
+#include <mayaUsd/utils/hash.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Resolve time-varying primvars of the next frames on worker threads during playback.
+    \class  HdVP2PlaybackPrefetcher
+
+    When the MAYAUSD_VP2_PLAYBACK_PREFETCH_FRAMES environment variable is greater than 0, rprims
+    register their time-varying primvars which are backed by a USD attribute the first time they
+    read them during playback. After each update, the values of the following frames are read
+    from the stage on worker threads and staged in a ring buffer per primvar, so the next syncs
+    only have to consume them instead of resolving USD values on the critical path.
+
+    Prefetch tasks only run during the update of the proxy shape, concurrently with the sync of
+    the current frame, which only reads the stage too. They are done before the update returns to
+    Maya, which may then edit the stage. Staged values are discarded when the stage changes or
+    when the playback stops.
+*/
+class HdVP2PlaybackPrefetcher : public TfWeakBase
+{
+public:
+    //! Return the number of frames to prefetch, 0 when prefetching is disabled.
+    static size_t GetNumPrefetchFrames();
+
+    explicit HdVP2PlaybackPrefetcher(size_t numFrames);
+    ~HdVP2PlaybackPrefetcher();
+
+    //! Return the number of frames prefetched ahead of the current one.
+    size_t GetNumFrames() const { return _numFrames; }
+
+    /*! \brief  Discard stale values. Call from main thread only.
+
+        \param  stage       Stage being drawn.
+        \param  isPlaying   Whether Maya is playing back, staged values are released otherwise.
+    */
+    void BeginUpdate(const UsdStageRefPtr& stage, bool isPlaying);
+
+    /*! \brief  Start prefetching the frames following the current time. Call from main thread,
+                between BeginUpdate() and EndUpdate().
+
+        \param  time        USD time of the current update.
+        \param  timeStep    USD time between two frames of the playback.
+        \param  nextTimes   USD times of the next frames of the playback, in playback order.
+    */
+    void Prefetch(UsdTimeCode time, double timeStep, const std::vector<UsdTimeCode>& nextTimes);
+
+    //! Wait for the prefetch tasks, before the stage can be edited again. Call from main thread.
+    void EndUpdate();
+
+    //! Return true while primvars should be registered and consumed.
+    bool IsActive() const { return _isPlaying; }
+
+    /*! \brief  Move the staged value of the primvar at the given time into value.
+
+        Registers the primvar for prefetching when it is backed by a time-varying attribute
+        and no value is staged yet. Call is thread safe.
+
+        \return True if a staged value was found.
+    */
+    bool Consume(
+        const SdfPath& rprimId,
+        const SdfPath& usdPrimPath,
+        const TfToken& primvarName,
+        UsdTimeCode    time,
+        VtValue&       value);
+
+private:
+    HdVP2PlaybackPrefetcher(const HdVP2PlaybackPrefetcher&) = delete;
+    HdVP2PlaybackPrefetcher& operator=(const HdVP2PlaybackPrefetcher&) = delete;
+
+    void _Clear();
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender);
+
+    //! One staged frame of a primvar.
+    struct _Slot
+    {
+        UsdTimeCode _time { UsdTimeCode::Default() }; //!< Time of the staged value
+        VtValue     _value;                           //!< Staged value, moved out by Consume()
+    };
+
+    //! Ring buffer of the staged frames of a primvar.
+    struct _Track
+    {
+        UsdAttribute       _attribute; //!< Attribute holding the primvar value
+        std::mutex         _mutex;     //!< Protects _slots
+        std::vector<_Slot> _slots;     //!< One slot per prefetched frame
+    };
+
+    using _TrackKey = std::pair<SdfPath, TfToken>;
+
+    struct _TrackKeyHash
+    {
+        size_t operator()(const _TrackKey& key) const
+        {
+            size_t seed = key.first.GetHash();
+            MayaUsd::hash_combine(seed, key.second.Hash());
+            return seed;
+        }
+    };
+
+    using _TrackMap = std::unordered_map<_TrackKey, std::unique_ptr<_Track>, _TrackKeyHash>;
+
+    _Track* _FindOrCreateTrack(
+        const SdfPath& rprimId,
+        const SdfPath& usdPrimPath,
+        const TfToken& primvarName);
+    size_t _GetSlotIndex(UsdTimeCode time) const;
+
+    const size_t _numFrames;           //!< Number of frames prefetched ahead of the current one
+    double       _timeStep { 1.0 };    //!< Time between two frames of the playback
+    bool         _isPlaying { false }; //!< Whether the last update happened during playback
+
+    UsdStageWeakPtr   _stage;                  //!< Stage the tracks belong to
+    TfNotice::Key     _objectsChangedKey;      //!< Registration of the stage change listener
+    std::atomic<bool> _stageChanged { false }; //!< True when staged values must be discarded
+    std::atomic<bool> _cancelled { false };    //!< Cancels the running prefetch tasks
+
+    std::mutex     _tracksMutex; //!< Protects _tracks
+    _TrackMap      _tracks;      //!< Tracks of all registered primvars
+    WorkDispatcher _dispatcher;  //!< Runs the prefetch tasks
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_PLAYBACK_PREFETCHER
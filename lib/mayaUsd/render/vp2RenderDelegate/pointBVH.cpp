@@ -0,0 +1,138 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "pointBVH.h"
+
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3d.h>
+
+#include <algorithm>
+#include <numeric>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Maximum number of points of a leaf
+constexpr uint32_t kMaxLeafSize = 16;
+
+} // namespace
+
+HdVP2PointBVH::HdVP2PointBVH(const VtVec3fArray& points)
+    : _points(points)
+{
+    const uint32_t numPoints = static_cast<uint32_t>(_points.size());
+
+    _indices.resize(numPoints);
+    std::iota(_indices.begin(), _indices.end(), 0u);
+
+    // Without points, the root is an empty inner node which is never visited.
+    _nodes.reserve(2 * (numPoints / kMaxLeafSize + 1));
+    if (numPoints > 0) {
+        _BuildNode(0, numPoints);
+    } else {
+        _nodes.emplace_back();
+    }
+}
+
+const GfRange3f& HdVP2PointBVH::GetBounds() const { return _nodes.front()._bounds; }
+
+uint32_t HdVP2PointBVH::_BuildNode(uint32_t first, uint32_t count)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    GfRange3f bounds;
+    for (uint32_t i = first; i < first + count; ++i) {
+        bounds.UnionWith(_points[_indices[i]]);
+    }
+    _nodes[nodeIndex]._bounds = bounds;
+
+    if (count <= kMaxLeafSize) {
+        _nodes[nodeIndex]._first = first;
+        _nodes[nodeIndex]._count = count;
+        return nodeIndex;
+    }
+
+    const GfVec3f size = bounds.GetSize();
+    const int     axis
+        = (size[0] > size[1]) ? (size[0] > size[2] ? 0 : 2) : (size[1] > size[2] ? 1 : 2);
+
+    const uint32_t half = count / 2;
+    const auto     begin = _indices.begin() + first;
+    std::nth_element(begin, begin + half, begin + count, [this, axis](uint32_t a, uint32_t b) {
+        return _points[a][axis] < _points[b][axis];
+    });
+
+    _BuildNode(first, half);
+    const uint32_t second = _BuildNode(first + half, count - half);
+    _nodes[nodeIndex]._second = second;
+    return nodeIndex;
+}
+
+bool HdVP2PointBVH::FindClosestToRay(
+    const GfRay& ray,
+    double       maxDistance,
+    size_t*      pointIndex,
+    double*      distance) const
+{
+    if (_points.empty()) {
+        return false;
+    }
+
+    bool   found = false;
+    double bestDistance = maxDistance;
+
+    std::vector<uint32_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const uint32_t current = stack.back();
+        stack.pop_back();
+        const _Node& node = _nodes[current];
+
+        // The node is skipped when the ray misses its bounds grown by the best distance.
+        const GfVec3d   margin(bestDistance);
+        const GfRange3d bounds(
+            GfVec3d(node._bounds.GetMin()) - margin, GfVec3d(node._bounds.GetMax()) + margin);
+        double enter = 0.0;
+        double exit = 0.0;
+        if (!ray.Intersect(bounds, &enter, &exit)) {
+            continue;
+        }
+
+        if (node._count == 0) {
+            stack.push_back(node._second);
+            stack.push_back(current + 1);
+            continue;
+        }
+
+        for (uint32_t i = node._first; i < node._first + node._count; ++i) {
+            const GfVec3d point(_points[_indices[i]]);
+            const double  pointDistance = (ray.FindClosestPoint(point) - point).GetLength();
+            if (pointDistance <= bestDistance) {
+                bestDistance = pointDistance;
+                *pointIndex = _indices[i];
+                found = true;
+            }
+        }
+    }
+
+    if (found) {
+        *distance = bestDistance;
+    }
+    return found;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
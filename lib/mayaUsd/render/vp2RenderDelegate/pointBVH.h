@@ -0,0 +1,84 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_POINT_BVH
+#define HD_VP2_POINT_BVH
+
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/pxr.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Bounding volume hierarchy over the points of an rprim, used to find points near a ray.
+    \class  HdVP2PointBVH
+
+    The hierarchy is built in the local space of the rprim with median splits along the longest
+    axis of each node, so that the same hierarchy serves every instance and transform of the
+    rprim. It is immutable once built and must be rebuilt when the points change.
+*/
+class HdVP2PointBVH final
+{
+public:
+    explicit HdVP2PointBVH(const VtVec3fArray& points);
+    ~HdVP2PointBVH() = default;
+
+    //! Return the bounds of all the points.
+    const GfRange3f& GetBounds() const;
+
+    //! Return the points the hierarchy was built on.
+    const VtVec3fArray& GetPoints() const { return _points; }
+
+    /*! \brief  Find the point closest to a ray, among the points within maxDistance of it.
+
+        \param  pointIndex  Index of the closest point, unchanged when none is found.
+        \param  distance    Distance of the closest point to the ray, unchanged when none is found.
+
+        \return True if a point was found.
+    */
+    bool FindClosestToRay(
+        const GfRay& ray,
+        double       maxDistance,
+        size_t*      pointIndex,
+        double*      distance) const;
+
+private:
+    //! A node is a leaf when _count is not null, its children are otherwise the next node and
+    //! the node at _second.
+    struct _Node
+    {
+        GfRange3f _bounds;
+        uint32_t  _first { 0 };  //!< First index of the points of a leaf
+        uint32_t  _count { 0 };  //!< Number of points of a leaf
+        uint32_t  _second { 0 }; //!< Index of the second child of an inner node
+    };
+
+    uint32_t _BuildNode(uint32_t first, uint32_t count);
+
+    VtVec3fArray          _points;
+    std::vector<uint32_t> _indices; //!< Point indices, ordered by leaf
+    std::vector<_Node>    _nodes;   //!< Nodes in depth-first order, the root first
+};
+
+using HdVP2PointBVHSharedPtr = std::shared_ptr<const HdVP2PointBVH>;
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_POINT_BVH
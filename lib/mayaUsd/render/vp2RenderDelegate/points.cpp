@@ -21,11 +21,16 @@
 #include "draw_item.h"
 #include "instancer.h"
 #include "material.h"
+#include "renderStats.h"
 #include "render_delegate.h"
 #include "tokens.h"
+#include "vertexBufferCache.h"
+
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/matrix4f.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/vt/value.h>
 #include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
@@ -34,11 +39,15 @@
 #include <pxr/pxr.h>
 #include <pxr/usdImaging/usdImaging/delegate.h>
 
+#include <maya/M3dView.h>
 #include <maya/MFrameContext.h>
 #include <maya/MMatrix.h>
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <algorithm>
+#include <cmath>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -50,8 +59,37 @@ TF_DEFINE_PRIVATE_TOKENS(
 );
 // clang-format on
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_POINTS_UPLOAD_BUDGET,
+    0,
+    "Maximum number of point positions uploaded to VP2 per frame. Larger point clouds are "
+    "uploaded in chunks across several frames. A value of 0 uploads all the positions at once.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_POINTS_DECIMATION_DENSITY,
+    0,
+    "Maximum number of points drawn per pixel of the screen area covered by a point cloud. Point "
+    "clouds that are far away from the camera are decimated to this density. A value of 0 "
+    "disables the decimation.");
+
 namespace {
 
+//! Return the maximum number of point positions uploaded per frame, 0 if unlimited.
+size_t _GetPointsUploadBudget()
+{
+    static const size_t budget
+        = static_cast<size_t>(std::max(TfGetEnvSetting(MAYAUSD_VP2_POINTS_UPLOAD_BUDGET), 0));
+    return budget;
+}
+
+//! Return the maximum number of points drawn per pixel, 0 if decimation is disabled.
+size_t _GetPointsDecimationDensity()
+{
+    static const size_t density
+        = static_cast<size_t>(std::max(TfGetEnvSetting(MAYAUSD_VP2_POINTS_DECIMATION_DENSITY), 0));
+    return density;
+}
+
 //! Required primvars when there is no material binding.
 const TfTokenVector sFallbackShaderPrimvars
     = { HdTokens->displayColor, HdTokens->displayOpacity, HdTokens->normals, HdTokens->widths };
@@ -87,6 +125,9 @@ VtArray<BaseType> _BuildInterpolatedArray(
 
 } // anonymous namespace
 
+size_t HdVP2Points::_uploadedPoints = 0;
+bool   HdVP2Points::_pendingUploads = false;
+
 //! \brief  Constructor
 HdVP2Points::HdVP2Points(
     HdVP2RenderDelegate* delegate,
@@ -114,11 +155,19 @@ void HdVP2Points::Sync(
     HdDirtyBits*     dirtyBits,
     TfToken const&   reprToken)
 {
-    if (!_SyncCommon(*this, delegate, renderParam, dirtyBits, _GetRepr(reprToken), reprToken)) {
+    if (!_SyncCommon(
+            *this,
+            _sharedData,
+            delegate,
+            renderParam,
+            dirtyBits,
+            _reprs,
+            _GetRepr(reprToken),
+            reprToken)) {
         return;
     }
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L2,
         _rprimId.asChar(),
@@ -159,32 +208,73 @@ void HdVP2Points::Sync(
 
     // Prepare position buffer. It is shared among all draw items so it should
     // be updated only once when it gets dirty.
-    if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)) {
-        const VtValue value = delegate->Get(id, HdTokens->points);
-        _pointsSharedData._points = value.Get<VtVec3fArray>();
-
-        const size_t numVertices = _pointsSharedData._points.size();
-
-        void* bufferData = _pointsSharedData._positionsBuffer->acquire(numVertices, true);
-        if (bufferData) {
-            const size_t numBytes = sizeof(GfVec3f) * numVertices;
-            memcpy(bufferData, _pointsSharedData._points.cdata(), numBytes);
-
-            // Capture class member for lambda
-            MHWRender::MVertexBuffer* const positionsBuffer
-                = _pointsSharedData._positionsBuffer.get();
-            const MString& rprimId = _rprimId;
-
-            _delegate->GetVP2ResourceRegistry().EnqueueCommit(
-                [positionsBuffer, bufferData, rprimId]() {
-                    MProfilingScope profilingScope(
-                        HdVP2RenderDelegate::sProfilerCategory,
-                        MProfiler::kColorC_L2,
-                        rprimId.asChar(),
-                        "CommitPositions");
-
-                    positionsBuffer->commit(bufferData);
-                });
+    const bool pointsDirty = HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points);
+    if (pointsDirty) {
+        // Points updated at another time may come from the vertex buffer cache.
+        UsdTimeCode             bufferTime;
+        SdfPath                 bufferKey;
+        HdVP2VertexBufferCache* bufferCache = _GetVertexBufferCache(id, bufferTime, bufferKey);
+
+        HdVP2CachedVertexBuffersSharedPtr cachedBuffers
+            = bufferCache ? bufferCache->Find(bufferKey, bufferTime) : nullptr;
+        if (cachedBuffers && cachedBuffers->_positionsBuffer) {
+            _pointsSharedData._points = cachedBuffers->_points;
+            _pointsSharedData._positionsBuffer = cachedBuffers->_positionsBuffer;
+            _pointsSharedData._numUploadedPoints = _pointsSharedData._points.size();
+        } else {
+            const VtValue value = delegate->Get(id, HdTokens->points);
+            _pointsSharedData._points = value.Get<VtVec3fArray>();
+
+            // The current buffer may belong to a frame cached for another time.
+            if (bufferCache) {
+                bufferCache->Release(std::move(_pointsSharedData._positionsBuffer));
+
+                const MHWRender::MVertexBufferDescriptor desc(
+                    "", MHWRender::MGeometry::kPosition, MHWRender::MGeometry::kFloat, 3);
+                _pointsSharedData._positionsBuffer.reset(new MHWRender::MVertexBuffer(desc));
+            }
+
+            const size_t numVertices = _pointsSharedData._points.size();
+
+            // Large point clouds are uploaded in chunks across frames, straight from the points
+            // array without a staging copy. The buffer cache needs complete buffers.
+            const size_t uploadBudget = _GetPointsUploadBudget();
+            const bool   uploadInChunks = !bufferCache && uploadBudget > 0
+                && numVertices > uploadBudget;
+            _pointsSharedData._numUploadedPoints = uploadInChunks ? 0 : numVertices;
+
+            void* bufferData = uploadInChunks
+                ? nullptr
+                : _pointsSharedData._positionsBuffer->acquire(numVertices, true);
+            if (bufferData) {
+                const size_t numBytes = sizeof(GfVec3f) * numVertices;
+                memcpy(bufferData, _pointsSharedData._points.cdata(), numBytes);
+
+                // Capture class member for lambda
+                MHWRender::MVertexBuffer* const positionsBuffer
+                    = _pointsSharedData._positionsBuffer.get();
+                const MString& rprimId = _rprimId;
+
+                _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+                    [positionsBuffer, bufferData, rprimId]() {
+                        MayaUsd::ProfilingScope profilingScope(
+                            HdVP2RenderDelegate::sProfilerCategory,
+                            MProfiler::kColorC_L2,
+                            rprimId.asChar(),
+                            "CommitPositions");
+
+                        positionsBuffer->commit(bufferData);
+                        HdVP2RenderStats::AddVertexBufferUpload(*positionsBuffer);
+                    });
+            }
+
+            if (bufferCache && bufferData) {
+                auto entry = std::make_shared<HdVP2CachedVertexBuffers>();
+                entry->_points = _pointsSharedData._points;
+                entry->_numVertices = numVertices;
+                entry->_positionsBuffer = _pointsSharedData._positionsBuffer;
+                bufferCache->Insert(bufferKey, bufferTime, entry);
+            }
         }
     }
 
@@ -194,9 +284,23 @@ void HdVP2Points::Sync(
     const TfToken& renderTag = delegate->GetRenderTag(id);
 #endif
 
+    // Upload the next chunk of the positions, keep the Rprim dirty until all chunks are uploaded.
+    const bool uploadPending
+        = _pointsSharedData._numUploadedPoints < _pointsSharedData._points.size();
+    if (uploadPending) {
+        _delegate->GetVP2ResourceRegistry().EnqueueCommit([this]() { _UploadPositionsChunk(); });
+    }
+
+    if (_GetPointsDecimationDensity() > 0 && GetInstancerId().IsEmpty()) {
+        auto* const param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+        _UpdateWorldBounds(delegate, id, *dirtyBits);
+        _UpdateDecimation(param->GetDrawScene(), pointsDirty);
+        _TrackScreenSizeLod(id);
+    }
+
     _SyncSharedData(_sharedData, delegate, dirtyBits, reprToken, *this, _reprs, renderTag);
 
-    *dirtyBits = HdChangeTracker::Clean;
+    *dirtyBits = uploadPending ? DirtyPointsUpload : HdChangeTracker::Clean;
 
     // Draw item update is controlled by its own dirty bits.
     _UpdateRepr(delegate, reprToken);
@@ -708,12 +812,15 @@ void HdVP2Points::_UpdateDrawItem(
         || (itemDirtyBits
             & (HdChangeTracker::DirtyVisibility | HdChangeTracker::DirtyRenderTag
                | HdChangeTracker::DirtyPoints | HdChangeTracker::DirtyExtent
-               | DirtySelectionHighlight))) {
+               | DirtySelectionHighlight | DirtyPointsUpload))) {
         bool enable = drawItem->GetVisible() && !_pointsSharedData._points.empty()
             && !instancerWithNoInstances;
 
         if (isBoundingBoxItem) {
             enable = enable && !range.IsEmpty();
+        } else {
+            // Positions uploaded in chunks are drawn from the frame after the first chunk.
+            enable = enable && _pointsSharedData._numUploadedPoints > 0;
         }
 
         enable = enable && drawScene.DrawRenderTag(_pointsSharedData._renderTag);
@@ -728,7 +835,7 @@ void HdVP2Points::_UpdateDrawItem(
         = (itemDirtyBits
            & (HdChangeTracker::DirtyPoints | HdChangeTracker::DirtyNormals
               | HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyTopology
-              | DirtySelectionHighlight));
+              | DirtySelectionHighlight | DirtyPointsUpload));
 
     // update selection mask if dirty
     if (itemDirtyBits & DirtySelectionHighlight) {
@@ -765,6 +872,8 @@ void HdVP2Points::_UpdateDrawItem(
         const HdVP2BBoxGeom& sharedBBoxGeom = _delegate->GetSharedBBoxGeom();
         positionsBuffer = const_cast<MHWRender::MVertexBuffer*>(sharedBBoxGeom.GetPositionBuffer());
         indexBuffer = const_cast<MHWRender::MIndexBuffer*>(sharedBBoxGeom.GetIndexBuffer());
+    } else if (_pointsSharedData._decimationStride > 1) {
+        indexBuffer = _pointsSharedData._decimatedIndexBuffer.get();
     }
 
     _delegate->GetVP2ResourceRegistry().EnqueueCommit([drawItem,
@@ -792,14 +901,17 @@ void HdVP2Points::_UpdateDrawItem(
                         unsigned int numElems
                             = primvarBufferData.size() / (desc.dataTypeSize() * desc.dimension());
                         primvarBuffer->update(&primvarBufferData[0], 0, numElems, true);
+                        HdVP2RenderStats::AddVertexBufferUpload(*primvarBuffer);
                     }
                 }
             }
         }
 
         // If available, something changed
-        if (stateToCommit._indexBufferData)
+        if (stateToCommit._indexBufferData) {
             indexBuffer->commit(stateToCommit._indexBufferData);
+            HdVP2RenderStats::AddIndexBufferUpload(*indexBuffer);
+        }
 
         // If available, something changed
         if (stateToCommit._shader != nullptr) {
@@ -1025,6 +1137,170 @@ void HdVP2Points::_UpdateRepr(HdSceneDelegate* sceneDelegate, TfToken const& rep
     }
 }
 
+/*! \brief  Upload the next chunk of positions within the per-frame upload budget.
+
+    This is called by a commit task on the main thread. The chunk is copied to the position buffer
+    straight from the points array, which stays alive in _pointsSharedData.
+*/
+void HdVP2Points::_UploadPositionsChunk()
+{
+    const size_t numPoints = _pointsSharedData._points.size();
+    const size_t offset = _pointsSharedData._numUploadedPoints;
+    const size_t budget = _GetPointsUploadBudget();
+    if (offset >= numPoints) {
+        return;
+    }
+
+    // Refresh to upload the remaining chunks and to update the draw items at the next frame.
+    _pendingUploads = true;
+    if (_uploadedPoints >= budget) {
+        return;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorC_L2,
+        _rprimId.asChar(),
+        "CommitPositionsChunk");
+
+    // The first chunk truncates the buffer holding the previous positions.
+    const size_t count = std::min(numPoints - offset, budget - _uploadedPoints);
+    _pointsSharedData._positionsBuffer->update(
+        _pointsSharedData._points.cdata() + offset, offset, count, offset == 0);
+    HdVP2RenderStats::AddVertexBufferUpload(*_pointsSharedData._positionsBuffer);
+
+    _pointsSharedData._numUploadedPoints += count;
+    _uploadedPoints += count;
+}
+
+void HdVP2Points::ResetPointsUploadBudget()
+{
+    _uploadedPoints = 0;
+
+    if (_pendingUploads) {
+        _pendingUploads = false;
+        M3dView::scheduleRefreshAllViews();
+    }
+}
+
+/*! \brief  Return the decimation stride keeping the points drawn under the density limit.
+
+    The stride is rounded to a power of two so that small camera moves don't rebuild the index
+    buffer. Points are not decimated while their positions are uploaded in chunks.
+*/
+size_t HdVP2Points::_ComputeDecimationStride(const ProxyRenderDelegate& drawScene) const
+{
+    const size_t density = _GetPointsDecimationDensity();
+    const size_t numPoints = _pointsSharedData._points.size();
+    if (density == 0 || !_worldBoundsValid || _pointsSharedData._numUploadedPoints < numPoints) {
+        return 1;
+    }
+
+    const double screenSize = drawScene.GetScreenSize(_worldBounds);
+    const double maxPoints = static_cast<double>(density) * screenSize * screenSize;
+    if (maxPoints <= 0.0 || numPoints <= maxPoints) {
+        return 1;
+    }
+
+    const size_t minStride = static_cast<size_t>(std::ceil(numPoints / maxPoints));
+    size_t       stride = 1;
+    while (stride < minStride) {
+        stride <<= 1;
+    }
+    return stride;
+}
+
+/*! \brief  Update the index buffer of the drawn points when the decimation stride changes.
+
+    Decimated points are drawn with an index buffer referencing one point out of the stride, the
+    vertex buffers are left untouched.
+*/
+void HdVP2Points::_UpdateDecimation(const ProxyRenderDelegate& drawScene, bool pointsDirty)
+{
+    const size_t stride = _ComputeDecimationStride(drawScene);
+    if (stride == _pointsSharedData._decimationStride && (stride == 1 || !pointsDirty)) {
+        return;
+    }
+
+    _pointsSharedData._decimationStride = stride;
+
+    // The draw items switch between the decimated index buffer and the non-indexed draw.
+    RenderItemFunc setDirty = [](HdVP2DrawItem::RenderItemData& renderItemData) {
+        renderItemData.SetDirtyBits(DirtyPointsUpload);
+    };
+    _ForEachRenderItem(_reprs, setDirty);
+
+    if (stride == 1) {
+        return;
+    }
+
+    if (!_pointsSharedData._decimatedIndexBuffer) {
+        _pointsSharedData._decimatedIndexBuffer.reset(
+            new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32));
+    }
+
+    MHWRender::MIndexBuffer* const indexBuffer = _pointsSharedData._decimatedIndexBuffer.get();
+
+    const size_t numIndices = (_pointsSharedData._points.size() + stride - 1) / stride;
+    void*        bufferData = indexBuffer->acquire(numIndices, true);
+    if (!bufferData) {
+        return;
+    }
+
+    unsigned int* indices = static_cast<unsigned int*>(bufferData);
+    for (size_t i = 0; i < numIndices; ++i) {
+        indices[i] = static_cast<unsigned int>(i * stride);
+    }
+
+    _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+        [indexBuffer, bufferData]() {
+            indexBuffer->commit(bufferData);
+            HdVP2RenderStats::AddIndexBufferUpload(*indexBuffer);
+        });
+}
+
+/*! \brief  Return true when the screen size LOD state or the decimation stride of the points
+            doesn't match the current view.
+*/
+bool HdVP2Points::IsScreenSizeLodDirty(const ProxyRenderDelegate& drawScene) const
+{
+    if (MayaUsdRPrim::IsScreenSizeLodDirty(drawScene)) {
+        return true;
+    }
+
+    return _GetPointsDecimationDensity() > 0 && GetInstancerId().IsEmpty()
+        && _ComputeDecimationStride(drawScene) != _pointsSharedData._decimationStride;
+}
+
+/*! \brief  Return true when the screen size LOD or the decimation of the points depend on the
+            current view.
+*/
+bool HdVP2Points::IsScreenSizeLodActive(const ProxyRenderDelegate& drawScene) const
+{
+    return MayaUsdRPrim::IsScreenSizeLodActive(drawScene)
+        || (_GetPointsDecimationDensity() > 0 && GetInstancerId().IsEmpty());
+}
+
+/*! \brief  Add the memory used by the cached scene data and the VP2 buffers of the points.
+*/
+void HdVP2Points::GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const
+{
+    prim._cpuBytes += _pointsSharedData._points.size() * sizeof(GfVec3f);
+    for (const auto& entry : _pointsSharedData._primvarSourceMap) {
+        prim._cpuBytes += HdVP2GetValueBytes(entry.second.data);
+    }
+
+    usage.AddVertexBuffer(prim, _pointsSharedData._positionsBuffer.get());
+    usage.AddVertexBuffer(prim, _pointsSharedData._colorBuffer.get());
+    usage.AddVertexBuffer(prim, _pointsSharedData._normalsBuffer.get());
+    for (const auto& entry : _pointsSharedData._primvarBuffers) {
+        usage.AddVertexBuffer(prim, entry.second.get());
+    }
+    usage.AddIndexBuffer(prim, _pointsSharedData._decimatedIndexBuffer.get());
+
+    _GetRenderItemsMemoryUsage(_reprs, usage, prim);
+}
+
 /*! \brief  Returns the minimal set of dirty bits to place in the
             change tracker for use in the first sync of this prim.
 */
@@ -66,7 +66,17 @@ struct HdVP2PointsSharedData
     VtVec3fArray _points;
 
     //! Position buffer of the Rprim to be shared among all its draw items.
-    std::unique_ptr<MHWRender::MVertexBuffer> _positionsBuffer;
+    std::shared_ptr<MHWRender::MVertexBuffer> _positionsBuffer;
+
+    //! Number of points in the position buffer. It is less than the number of points while the
+    //! positions are uploaded in chunks across frames.
+    size_t _numUploadedPoints { 0 };
+
+    //! One point out of _decimationStride is drawn, all points are drawn when it is 1.
+    size_t _decimationStride { 1 };
+
+    //! Index buffer of the drawn points when the points are decimated.
+    std::unique_ptr<MHWRender::MIndexBuffer> _decimatedIndexBuffer;
 
     //! Render item color buffer - use when updating data
     std::unique_ptr<MHWRender::MVertexBuffer> _colorBuffer;
@@ -110,6 +120,15 @@ public:
 
     HdDirtyBits GetInitialDirtyBitsMask() const override;
 
+    bool IsScreenSizeLodDirty(const ProxyRenderDelegate& drawScene) const override;
+
+    bool IsScreenSizeLodActive(const ProxyRenderDelegate& drawScene) const override;
+
+    void GetMemoryUsage(HdVP2MemoryUsage& usage, HdVP2PrimMemoryUsage& prim) const override;
+
+    //! Start a new frame of chunked position uploads. Must be called from the main thread.
+    static void ResetPointsUploadBudget();
+
 protected:
     HdDirtyBits _PropagateDirtyBits(HdDirtyBits bits) const override;
 
@@ -134,11 +153,23 @@ private:
     MHWRender::MRenderItem*
     _CreateFatPointsRenderItem(const MString& name, const TfToken& reprToken) const;
 
+    void   _UploadPositionsChunk();
+    size_t _ComputeDecimationStride(const ProxyRenderDelegate& drawScene) const;
+    void   _UpdateDecimation(const ProxyRenderDelegate& drawScene, bool pointsDirty);
+
     enum DirtyBits : HdDirtyBits
     {
-        DirtySelectionHighlight = MayaUsdRPrim::DirtySelectionHighlight
+        DirtySelectionHighlight = MayaUsdRPrim::DirtySelectionHighlight,
+        //! The positions are uploaded in chunks and the upload is not complete yet.
+        DirtyPointsUpload = (MayaUsdRPrim::DirtyBitLast << 1)
     };
 
+    //! Number of points uploaded by all the points Rprims during the current frame
+    static size_t _uploadedPoints;
+
+    //! Whether positions remain to be uploaded at the next frames
+    static bool _pendingUploads;
+
     //! Shared data for all draw items of the Rprim
     HdVP2PointsSharedData _pointsSharedData;
 };
@@ -65,7 +65,7 @@ struct PrimvarInfo
     }
 
     PrimvarSource                             _source;
-    std::unique_ptr<MHWRender::MVertexBuffer> _buffer;
+    std::shared_ptr<MHWRender::MVertexBuffer> _buffer;
     MFloatArray                               _extraInstanceData;
 };
 
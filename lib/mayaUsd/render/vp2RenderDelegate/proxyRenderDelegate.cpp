@@ -15,17 +15,31 @@
 //
 #include "proxyRenderDelegate.h"
 
+#include "bboxBatch.h"
 #include "draw_item.h"
+#include "material.h"
 #include "mayaPrimCommon.h"
+#include "memoryUsage.h"
+#include "mesh.h"
+#include "pickingScene.h"
+#include "playbackPrefetcher.h"
+#include "renderStats.h"
 #include "render_delegate.h"
 #include "tokens.h"
+#include "vertexBufferCache.h"
 
 #include <mayaUsd/base/tokens.h>
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/nodes/stageData.h>
+#include <mayaUsd/utils/profilingScope.h>
 #include <mayaUsd/utils/selectability.h>
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec2d.h>
+#include <pxr/base/gf/vec4d.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
@@ -34,8 +48,8 @@
 #include <pxr/imaging/hd/enums.h>
 #include <pxr/imaging/hd/material.h>
 #include <pxr/imaging/hd/mesh.h>
+#include <pxr/imaging/hd/perfLog.h>
 #include <pxr/imaging/hd/points.h>
-#include <pxr/imaging/hd/primGather.h>
 #include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/rprimCollection.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
@@ -56,20 +70,34 @@
 #include <maya/MDisplayLayerMessage.h>
 #endif
 #include <maya/M3dView.h>
+#include <maya/MAnimControl.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MEventMessage.h>
 #include <maya/MFileIO.h>
 #include <maya/MFnPluginData.h>
+#include <maya/MGlobal.h>
 #include <maya/MHWGeometryUtilities.h>
+#include <maya/MIntArray.h>
+#include <maya/MPlug.h>
 #include <maya/MProfiler.h>
 #include <maya/MSelectionContext.h>
+#include <maya/MTime.h>
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
 #include <maya/MFnDisplayLayer.h>
 #include <maya/MFnDisplayLayerManager.h>
 #include <maya/MNodeMessage.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
 #if defined(WANT_UFE_BUILD)
 #include <mayaUsd/ufe/Global.h>
+#ifdef UFE_V2_FEATURES_AVAILABLE
+#include <mayaUsd/ufe/GlobalSelectionIndex.h>
+#endif
 #include <mayaUsd/ufe/UsdSceneItem.h>
 #include <mayaUsd/ufe/Utils.h>
 
@@ -96,11 +124,22 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_FRUSTUM_CULLING,
+    false,
+    "Skip the synchronization of rprims whose world extent is outside of the viewport camera "
+    "frustum. Culled rprims are synchronized as soon as they come back into view.");
+
 namespace {
 
 //! Representation selector for point snapping
 const HdReprSelector kPointsReprSelector(TfToken(), TfToken(), HdReprTokens->points);
 
+//! Dirty bits of an rprim switching between its bounds and its full geometry, same as a display
+//! layer level of detail change
+constexpr HdDirtyBits kScreenSizeLodDirtyBits = HdChangeTracker::DirtyVisibility
+    | HdChangeTracker::DirtyRepr | HdChangeTracker::DirtyDisplayStyle;
+
 #if defined(WANT_UFE_BUILD)
 //! \brief  Query the global selection list adjustment.
 MGlobal::ListAdjustment GetListAdjustment()
@@ -252,6 +291,43 @@ void AppendSelectedPrimPaths(const HdSelectionSharedPtr& selection, SdfPathVecto
     }
 }
 
+//! \brief  Return true if a prim has the same state in two selections.
+bool IsSameSelectionState(
+    const HdSelection::PrimSelectionState* oldState,
+    const HdSelection::PrimSelectionState* newState)
+{
+    if (!oldState || !newState) {
+        return oldState == newState;
+    }
+
+    // VtArray comparison returns early when both arrays share the same data.
+    return oldState->fullySelected == newState->fullySelected
+        && oldState->instanceIndices == newState->instanceIndices;
+}
+
+//! \brief  Append the prims whose state, including selected instances, differs between two
+//!         selections to the result list.
+void AppendSelectionChanges(
+    const HdSelectionSharedPtr& oldSelection,
+    const HdSelectionSharedPtr& newSelection,
+    SdfPathVector&              result)
+{
+    auto getState = [](const HdSelectionSharedPtr& selection, const SdfPath& path) {
+        return selection ? selection->GetPrimSelectionState(HdSelection::HighlightModeSelect, path)
+                         : nullptr;
+    };
+
+    SdfPathVector paths;
+    AppendSelectedPrimPaths(oldSelection, paths);
+    AppendSelectedPrimPaths(newSelection, paths);
+
+    for (const SdfPath& path : paths) {
+        if (!IsSameSelectionState(getState(oldSelection, path), getState(newSelection, path))) {
+            result.push_back(path);
+        }
+    }
+}
+
 //! \brief  Configure repr descriptions
 void _ConfigureReprs()
 {
@@ -435,102 +511,45 @@ void colorPrefsChangedCB(void* clientData)
     }
 }
 
-// Copied from renderIndex.cpp, the code that does HdRenderIndex::GetDrawItems. But I just want the
-// rprimIds, I don't want to go all the way to draw items.
-#if defined(HD_API_VERSION) && HD_API_VERSION >= 42
-struct _FilterParam
-{
-    const TfTokenVector& renderTags;
-    const HdRenderIndex* renderIndex;
-};
-
-bool _DrawItemFilterPredicate(const SdfPath& rprimID, const void* predicateParam)
-{
-    const _FilterParam* filterParam = static_cast<const _FilterParam*>(predicateParam);
+//! Render delegates of the proxy shapes whose closest point queries are answered on the CPU
+std::unordered_map<const MayaUsdProxyShapeBase*, const ProxyRenderDelegate*>
+    pickingRenderDelegates;
 
-    const TfTokenVector& renderTags = filterParam->renderTags;
-    const HdRenderIndex* renderIndex = filterParam->renderIndex;
+//! Render delegates of all the proxy shapes drawn in VP2
+std::unordered_map<const MayaUsdProxyShapeBase*, const ProxyRenderDelegate*> proxyRenderDelegates;
 
-    //
-    // Render Tag Filter
-    //
-    if (renderTags.empty()) {
-        // An empty render tag set means everything passes the filter
-        // Primary user is tests, but some single task render delegates
-        // that don't support render tags yet also use it.
-        return true;
-    } else {
-        // As the number of tags is expected to be low (<10)
-        // use a simple linear search.
-        TfToken primRenderTag = renderIndex->GetRenderTag(rprimID);
-        size_t  numRenderTags = renderTags.size();
-        size_t  tagNum = 0;
-        while (tagNum < numRenderTags) {
-            if (renderTags[tagNum] == primRenderTag) {
-                return true;
-            }
-            ++tagNum;
-        }
-    }
-    return false;
-}
-#else
-struct _FilterParam
-{
-    const HdRprimCollection& collection;
-    const TfTokenVector&     renderTags;
-    const HdRenderIndex*     renderIndex;
-};
+//! Closest point delegate installed before the CPU picking one, used for the other proxy shapes
+MayaUsdProxyShapeBase::ClosestPointDelegate fallbackClosestPointDelegate;
 
-bool _DrawItemFilterPredicate(const SdfPath& rprimID, const void* predicateParam)
+//! \brief  Closest point delegate of the proxy shapes when CPU picking is enabled.
+bool closestPointOnProxyShape(
+    const MayaUsdProxyShapeBase& proxyShape,
+    const GfRay&                 localRay,
+    GfVec3d*                     localPoint,
+    GfVec3d*                     localNormal)
 {
-    const _FilterParam* filterParam = static_cast<const _FilterParam*>(predicateParam);
-
-    const HdRprimCollection& collection = filterParam->collection;
-    const TfTokenVector&     renderTags = filterParam->renderTags;
-    const HdRenderIndex*     renderIndex = filterParam->renderIndex;
-
-    //
-    // Render Tag Filter
-    //
-    bool passedRenderTagFilter = false;
-    if (renderTags.empty()) {
-        // An empty render tag set means everything passes the filter
-        // Primary user is tests, but some single task render delegates
-        // that don't support render tags yet also use it.
-        passedRenderTagFilter = true;
-    } else {
-        // As the number of tags is expected to be low (<10)
-        // use a simple linear search.
-        TfToken primRenderTag = renderIndex->GetRenderTag(rprimID);
-        size_t  numRenderTags = renderTags.size();
-        size_t  tagNum = 0;
-        while (!passedRenderTagFilter && tagNum < numRenderTags) {
-            if (renderTags[tagNum] == primRenderTag) {
-                passedRenderTagFilter = true;
-            }
-            ++tagNum;
-        }
+    const auto it = pickingRenderDelegates.find(&proxyShape);
+    if (it == pickingRenderDelegates.end()) {
+        return fallbackClosestPointDelegate
+            && fallbackClosestPointDelegate(proxyShape, localRay, localPoint, localNormal);
     }
 
-    //
-    // Material Tag Filter
-    //
-    bool passedMaterialTagFilter = false;
+    const GfMatrix4d localToWorld(it->second->GetProxyShapeDagPath().inclusiveMatrix().matrix);
+    const GfMatrix4d worldToLocal = localToWorld.GetInverse();
+
+    GfRay worldRay = localRay;
+    worldRay.Transform(localToWorld);
 
-    // Filter out rprims that do not match the collection's materialTag.
-    // E.g. We may want to gather only opaque or translucent prims.
-    // An empty materialTag on collection means: ignore material-tags.
-    // This is important for tasks such as the selection-task which wants
-    // to ignore materialTags and receive all prims in its collection.
-    TfToken const& collectionMatTag = collection.GetMaterialTag();
-    if (collectionMatTag.IsEmpty() || renderIndex->GetMaterialTag(rprimID) == collectionMatTag) {
-        passedMaterialTagFilter = true;
+    GfVec3d worldPoint;
+    GfVec3d worldNormal;
+    if (!it->second->Pick(worldRay, nullptr, &worldPoint, &worldNormal)) {
+        return false;
     }
 
-    return (passedRenderTagFilter && passedMaterialTagFilter);
+    *localPoint = worldToLocal.Transform(worldPoint);
+    *localNormal = localToWorld.GetTranspose().TransformDir(worldNormal).GetNormalized();
+    return true;
 }
-#endif
 
 } // namespace
 
@@ -558,11 +577,15 @@ ProxyRenderDelegate::ProxyRenderDelegate(const MObject& obj)
     const MFnDependencyNode fnDepNode(obj);
     _proxyShapeData.reset(new ProxyShapeData(
         static_cast<MayaUsdProxyShapeBase*>(fnDepNode.userNode()), proxyDagPath));
+
+    proxyRenderDelegates[_proxyShapeData->ProxyShape()] = this;
 }
 
 //! \brief  Destructor
 ProxyRenderDelegate::~ProxyRenderDelegate()
 {
+    proxyRenderDelegates.erase(_proxyShapeData->ProxyShape());
+
     _ClearRenderDelegate();
 
 #if !defined(WANT_UFE_BUILD)
@@ -616,12 +639,27 @@ void ProxyRenderDelegate::_ClearRenderDelegate()
 {
     // The order of deletion matters. Some orders cause crashes.
 
+    // Prefetch tasks read the stage, wait for them before anything else is released.
+    _playbackPrefetcher.reset();
     _sceneDelegate.reset();
+    _vertexBufferCache.reset();
     _taskController.reset();
     _renderIndex.reset();
     _renderDelegate.reset();
+    // The draw items remove their render items from the batch when they are deleted.
+    _bboxBatch.reset();
+    if (_pickingScene) {
+        pickingRenderDelegates.erase(_proxyShapeData->ProxyShape());
+        _pickingScene.reset();
+    }
 
     _dummyTasks.clear();
+    _renderTagBuckets.clear();
+    _culledRprims.clear();
+    _screenSizeLodRprims.clear();
+#ifdef MAYA_HAS_DISPLAY_LAYER_API
+    _pendingDirtyUsdSubtrees.clear();
+#endif
 
     // reset any version ids or dirty information that doesn't make sense if we clear
     // the render index.
@@ -665,7 +703,7 @@ void ProxyRenderDelegate::_InitRenderDelegate()
     _proxyShapeData->UsdStageUpdated();
 
     if (!_renderDelegate) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L1,
             "Allocate VP2RenderDelegate");
@@ -673,7 +711,7 @@ void ProxyRenderDelegate::_InitRenderDelegate()
     }
 
     if (!_renderIndex) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L1, "Allocate RenderIndex");
         _renderIndex.reset(HdRenderIndex::New(_renderDelegate.get(), HdDriverVector()));
 
@@ -687,7 +725,7 @@ void ProxyRenderDelegate::_InitRenderDelegate()
     }
 
     if (!_sceneDelegate) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorD_L1,
             "Allocate SceneDelegate");
@@ -709,6 +747,31 @@ void ProxyRenderDelegate::_InitRenderDelegate()
         _defaultCollection.reset(new HdRprimCollection());
         _defaultCollection->SetName(HdTokens->geometry);
 
+        const size_t numPrefetchFrames = HdVP2PlaybackPrefetcher::GetNumPrefetchFrames();
+        if (numPrefetchFrames > 0) {
+            _playbackPrefetcher.reset(new HdVP2PlaybackPrefetcher(numPrefetchFrames));
+        }
+
+        const size_t vertexBufferCacheSize = HdVP2VertexBufferCache::GetMemoryBudget();
+        if (vertexBufferCacheSize > 0) {
+            _CreateVertexBufferCache(vertexBufferCacheSize);
+        }
+
+        if (HdVP2BBoxBatch::IsEnabled()) {
+            _bboxBatch.reset(new HdVP2BBoxBatch());
+        }
+
+        if (HdVP2PickingScene::IsEnabled()) {
+            _pickingScene.reset(new HdVP2PickingScene());
+            pickingRenderDelegates[_proxyShapeData->ProxyShape()] = this;
+
+            static std::once_flag delegateOnce;
+            std::call_once(delegateOnce, []() {
+                fallbackClosestPointDelegate = MayaUsdProxyShapeBase::GetClosestPointDelegate();
+                MayaUsdProxyShapeBase::SetClosestPointDelegate(closestPointOnProxyShape);
+            });
+        }
+
 #if defined(WANT_UFE_BUILD)
         if (!_observer) {
             _observer = std::make_shared<UfeObserver>(*this);
@@ -793,7 +856,7 @@ bool ProxyRenderDelegate::_Populate()
         return false;
 
     if (_proxyShapeData->UsdStage() && !_isPopulated) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L1, "Populate");
 
         // Remove any excluded prims before populating
@@ -805,8 +868,19 @@ bool ProxyRenderDelegate::_Populate()
             }
         }
         _proxyShapeData->ExcludePrimsUpdated();
+
+        using Clock = std::chrono::steady_clock;
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        const Clock::time_point populateStart = Clock::now();
         _sceneDelegate->Populate(_proxyShapeData->ProxyShape()->usdPrim(), excludePrimPaths);
         _isPopulated = true;
+
+        if (HdVP2RenderStats::IsEnabled()) {
+            HD_PERF_COUNTER_SET(
+                HdVP2PerfTokens->vp2PopulateTimeMs,
+                Milliseconds(Clock::now() - populateStart).count());
+        }
     }
 
     return _isPopulated;
@@ -820,11 +894,11 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
     if (!_sceneDelegate)
         return;
 
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "UpdateSceneDelegate");
 
     {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "SetTime");
 
         const UsdTimeCode timeCode = _proxyShapeData->ProxyShape()->getTime();
@@ -851,14 +925,14 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
 
     constexpr double tolerance = 1e-9;
     if (!GfIsClose(transform, _sceneDelegate->GetRootTransform(), tolerance)) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "SetRootTransform");
         _sceneDelegate->SetRootTransform(transform);
     }
 
     const bool isVisible = _proxyShapeData->ProxyDagPath().isVisible();
     if (isVisible != _sceneDelegate->GetRootVisibility()) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "SetRootVisibility");
         _sceneDelegate->SetRootVisibility(isVisible);
 
@@ -870,7 +944,7 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
 
     const int refineLevel = _proxyShapeData->ProxyShape()->getComplexity();
     if (refineLevel != _sceneDelegate->GetRefineLevelFallback()) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorC_L1,
             "SetRefineLevelFallback");
@@ -911,40 +985,109 @@ void ProxyRenderDelegate::UpdateInstancingMapEntry(
     }
 }
 
+void ProxyRenderDelegate::UpdateRenderTagEntry(
+    const TfToken& oldRenderTag,
+    const TfToken& newRenderTag,
+    const SdfPath& rprimId)
+{
+    if (!oldRenderTag.IsEmpty()) {
+        auto it = _renderTagBuckets.find(oldRenderTag);
+        if (it != _renderTagBuckets.end()) {
+            it->second.erase(rprimId);
+        }
+    }
+
+    if (!newRenderTag.IsEmpty()) {
+        _renderTagBuckets[newRenderTag].insert(rprimId);
+    }
+}
+
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
+//! \brief  Record a USD subtree whose rprims must be dirtied on the next update.
 void ProxyRenderDelegate::_DirtyUsdSubtree(const UsdPrim& prim)
 {
     if (!prim.IsValid())
         return;
 
-    HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+    _pendingDirtyUsdSubtrees.insert(prim.GetPath());
+}
+
+/*! \brief  Dirty the rprims of the USD subtrees recorded since the last update.
+
+    The subtrees nested in other recorded subtrees are dropped first, and instance proxies of the
+    same prototype prim only dirty its rprims once.
+*/
+void ProxyRenderDelegate::_DirtyPendingUsdSubtrees()
+{
+    if (_pendingDirtyUsdSubtrees.empty()) {
+        return;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorC_L1,
+        "DirtyPendingUsdSubtrees");
 
-    auto markRprimDirty = [this, &changeTracker](const UsdPrim& prim) {
-        constexpr HdDirtyBits dirtyBits = HdChangeTracker::DirtyVisibility
-            | HdChangeTracker::DirtyRepr | HdChangeTracker::DirtyDisplayStyle
-            | MayaUsdRPrim::DirtySelectionHighlight | HdChangeTracker::DirtyMaterialId;
+    SdfPathVector roots(_pendingDirtyUsdSubtrees.begin(), _pendingDirtyUsdSubtrees.end());
+    _pendingDirtyUsdSubtrees.clear();
+    SdfPath::RemoveDescendentPaths(&roots);
+
+    const UsdStageRefPtr stage = _proxyShapeData->UsdStage();
+    if (!stage) {
+        return;
+    }
+
+    HdChangeTracker&      changeTracker = _renderIndex->GetChangeTracker();
+    constexpr HdDirtyBits dirtyBits = HdChangeTracker::DirtyVisibility
+        | HdChangeTracker::DirtyRepr | HdChangeTracker::DirtyDisplayStyle
+        | MayaUsdRPrim::DirtySelectionHighlight | HdChangeTracker::DirtyMaterialId;
+
+    // Without native instancing, the rprims of the subtrees are found in the render index directly
+    // instead of traversing the USD prims. The subtrees are disjoint so no rprim is visited twice.
+    if (stage->GetPrototypes().empty()) {
+        for (const SdfPath& root : roots) {
+            if (!stage->GetPrimAtPath(root)) {
+                continue;
+            }
+            const SdfPath indexPath = _sceneDelegate->ConvertCachePathToIndexPath(root);
+            for (const SdfPath& rprimId : _renderIndex->GetRprimSubtree(indexPath)) {
+                changeTracker.MarkRprimDirty(rprimId, dirtyBits);
+            }
+        }
+        return;
+    }
 
+    RprimIdSet dirtiedRprims;
+    auto markRprimDirty = [this, &changeTracker, &dirtiedRprims](const UsdPrim& prim) {
         if (prim.IsA<UsdGeomGprim>()) {
             if (prim.IsInstanceProxy()) {
                 auto range = _instancingMap.equal_range(prim.GetPrimInPrototype().GetPath());
                 for (auto it = range.first; it != range.second; ++it) {
-                    if (_renderIndex->HasRprim(it->second)) {
+                    if (_renderIndex->HasRprim(it->second)
+                        && dirtiedRprims.insert(it->second).second) {
                         changeTracker.MarkRprimDirty(it->second, dirtyBits);
                     }
                 }
             } else {
                 auto indexPath = _sceneDelegate->ConvertCachePathToIndexPath(prim.GetPath());
-                if (_renderIndex->HasRprim(indexPath)) {
+                if (_renderIndex->HasRprim(indexPath) && dirtiedRprims.insert(indexPath).second) {
                     changeTracker.MarkRprimDirty(indexPath, dirtyBits);
                 }
             }
         }
     };
 
-    markRprimDirty(prim);
-    auto range = prim.GetFilteredDescendants(UsdTraverseInstanceProxies());
-    for (auto iter = range.begin(); iter != range.end(); ++iter) {
-        markRprimDirty(iter->GetPrim());
+    for (const SdfPath& root : roots) {
+        const UsdPrim prim = stage->GetPrimAtPath(root);
+        if (!prim) {
+            continue;
+        }
+
+        markRprimDirty(prim);
+        auto range = prim.GetFilteredDescendants(UsdTraverseInstanceProxies());
+        for (auto iter = range.begin(); iter != range.end(); ++iter) {
+            markRprimDirty(iter->GetPrim());
+        }
     }
 }
 
@@ -1042,9 +1185,15 @@ void ProxyRenderDelegate::ComputeCombinedDisplayStyles(const unsigned int newDis
 //! \brief  Execute Hydra engine to perform minimal VP2 draw data update based on change tracker.
 void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 {
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "Execute");
 
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    HdVP2RenderStats::BeginUpdate();
+    const Clock::time_point executeStart = Clock::now();
+
     ++_frameCounter;
 
     _refreshRequested = false;
@@ -1053,6 +1202,7 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
     UpdateProxyShapeDisplayLayers();
+    _DirtyPendingUsdSubtrees();
 #endif
 
     // If update for selection is enabled, the draw data for the "points" repr
@@ -1168,6 +1318,8 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
             }
         }
 
+        _UpdateView(frameContext);
+
         if (dirtyBits != HdChangeTracker::Clean) {
             // Mark everything "dirty" so that sync is called on everything
             // If there are multiple views up with different viewport modes then
@@ -1178,14 +1330,231 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
             }
         }
 
+        const Clock::time_point engineStart = Clock::now();
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
+
+        if (_pickingScene) {
+            _pickingScene->SetSyncedSceneStateVersion(changeTracker.GetSceneStateVersion());
+        }
+
+        // The bounding boxes forwarded to the batch by the commit tasks are drawn in one go.
+        if (_bboxBatch) {
+            auto* const delegate = static_cast<HdVP2RenderDelegate*>(_renderDelegate.get());
+            auto* const param = static_cast<HdVP2RenderParam*>(delegate->GetRenderParam());
+            _bboxBatch->Commit(*this, *param->GetContainer(), delegate->GetSharedBBoxGeom());
+        }
+
+        // The engine syncs the prims, then fills and commits the VP2 resources.
+        if (HdVP2RenderStats::IsEnabled()) {
+            const HdPerfLog& perfLog = HdPerfLog::GetInstance();
+            const double     engineTimeMs = Milliseconds(Clock::now() - engineStart).count();
+            HD_PERF_COUNTER_SET(
+                HdVP2PerfTokens->vp2SyncTimeMs,
+                engineTimeMs - perfLog.GetCounter(HdVP2PerfTokens->vp2FillTimeMs)
+                    - perfLog.GetCounter(HdVP2PerfTokens->vp2CommitTimeMs));
+        }
+    }
+
+    HD_PERF_COUNTER_SET(
+        HdVP2PerfTokens->vp2ExecuteTimeMs, Milliseconds(Clock::now() - executeStart).count());
+}
+
+//! \brief  Create the vertex buffer cache, shared with the proxy shapes of the same stage when
+//!         the stage buffers are shared.
+void ProxyRenderDelegate::_CreateVertexBufferCache(size_t memoryBudget)
+{
+    if (HdVP2RenderDelegate::IsStageBufferSharingEnabled()) {
+        _vertexBufferCache
+            = HdVP2VertexBufferCache::GetSharedCache(_proxyShapeData->UsdStage(), memoryBudget);
+    } else {
+        _vertexBufferCache = std::make_shared<HdVP2VertexBufferCache>(memoryBudget);
+    }
+}
+
+//! \brief  Keep the vertex buffer cache only while Maya cached playback is enabled, when the
+//!         cache is not always enabled.
+void ProxyRenderDelegate::_UpdateCachedPlaybackBuffers()
+{
+    const size_t memoryBudget = HdVP2VertexBufferCache::GetCachedPlaybackMemoryBudget();
+    if (memoryBudget == 0 || HdVP2VertexBufferCache::GetMemoryBudget() > 0 || !_sceneDelegate) {
+        return;
+    }
+
+    MIntArray cachedPlaybackEnabled;
+    MGlobal::executeCommand("evaluator -query -enable -name \"cache\"", cachedPlaybackEnabled);
+    if (cachedPlaybackEnabled.length() == 0 || !cachedPlaybackEnabled[0]) {
+        _vertexBufferCache.reset();
+    } else if (!_vertexBufferCache) {
+        _CreateVertexBufferCache(memoryBudget);
     }
 }
 
+//! \brief  Capture the view used to cull rprims and to evaluate the screen size LOD.
+void ProxyRenderDelegate::_UpdateView(const MHWRender::MFrameContext& frameContext)
+{
+    static const bool frustumCullingEnabled = TfGetEnvSetting(MAYAUSD_VP2_FRUSTUM_CULLING);
+
+    _frustumCullingActive = false;
+
+    // Selection passes might not use the camera of the view, never cull in them and keep the
+    // screen size LOD state of the last draw.
+    if (frameContext.getSelectionInfo() != nullptr) {
+        return;
+    }
+
+    MStatus       status;
+    const MMatrix viewProjection
+        = frameContext.getMatrix(MHWRender::MFrameContext::kViewProjMtx, &status);
+    if (status != MStatus::kSuccess) {
+        return;
+    }
+
+    int originX = 0, originY = 0, width = 0, height = 0;
+    if (frameContext.getViewportDimensions(originX, originY, width, height) != MStatus::kSuccess
+        || width <= 0 || height <= 0) {
+        return;
+    }
+
+    const GfMatrix4d newViewProjection(viewProjection.matrix);
+    const bool       viewChanged = newViewProjection != _viewProjection
+        || width != _viewportWidth || height != _viewportHeight;
+    _viewProjection = newViewProjection;
+    _viewportWidth = width;
+    _viewportHeight = height;
+    _frustumCullingActive = frustumCullingEnabled;
+
+    // The culled rprims keep their dirty bits, but Hydra only syncs rprims again after a change
+    // of the scene. Mark them dirty when the view changes, so the ones now in view are synced;
+    // the others are culled again.
+    if (viewChanged && !_culledRprims.empty()) {
+        HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+        for (const SdfPath& id : _culledRprims) {
+            if (_renderIndex->HasRprim(id)) {
+                changeTracker.MarkRprimDirty(id, HdChangeTracker::DirtyExtent);
+            }
+        }
+        _culledRprims.clear();
+    }
+
+    // A change of the threshold can switch any prim between its bounds and its full geometry,
+    // so all of them are synchronized again, the way a display style change does. They register
+    // for the next view changes during the synchronization when there is a threshold.
+    const float boundsLodScreenSize = _proxyShapeData->ProxyShape()->getBoundsLodScreenSize();
+    if (boundsLodScreenSize != _boundsLodScreenSize) {
+        _boundsLodScreenSize = boundsLodScreenSize;
+
+        HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+        for (const SdfPath& id : _renderIndex->GetRprimIds()) {
+            changeTracker.MarkRprimDirty(id, kScreenSizeLodDirtyBits);
+        }
+    } else if (viewChanged) {
+        _UpdateScreenSizeLod();
+    }
+}
+
+//! \brief  Mark dirty the rprims switching between their bounds and their full geometry.
+void ProxyRenderDelegate::_UpdateScreenSizeLod()
+{
+    // Without a threshold, only the decimated points stay in the list, the other prims are
+    // dropped from it below.
+    if (_screenSizeLodRprims.empty()) {
+        return;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "Update screen size LOD");
+
+    HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+    for (auto it = _screenSizeLodRprims.begin(); it != _screenSizeLodRprims.end();) {
+        auto* rprim = dynamic_cast<MayaUsdRPrim*>(_renderIndex->GetRprim(*it));
+        if (!rprim) {
+            it = _screenSizeLodRprims.erase(it);
+            continue;
+        }
+
+        if (rprim->IsScreenSizeLodDirty(*this)) {
+            changeTracker.MarkRprimDirty(*it, kScreenSizeLodDirtyBits);
+        }
+
+        if (rprim->IsScreenSizeLodActive(*this)) {
+            ++it;
+        } else {
+            rprim->ResetScreenSizeLodTracking();
+            it = _screenSizeLodRprims.erase(it);
+        }
+    }
+}
+
+/*! \brief  Return the size in pixels of the world bounds projected in the viewport.
+
+    The largest of the projected width and height is returned. Bounds which are empty or which
+    cross the camera plane are considered infinitely large.
+*/
+float ProxyRenderDelegate::GetScreenSize(const GfRange3d& worldBounds) const
+{
+    if (worldBounds.IsEmpty()) {
+        return std::numeric_limits<float>::max();
+    }
+
+    GfVec2d ndcMin(std::numeric_limits<double>::max());
+    GfVec2d ndcMax(std::numeric_limits<double>::lowest());
+    for (size_t i = 0; i < 8; ++i) {
+        const GfVec3d corner = worldBounds.GetCorner(i);
+        const GfVec4d clip = GfVec4d(corner[0], corner[1], corner[2], 1.0) * _viewProjection;
+        if (clip[3] <= std::numeric_limits<double>::epsilon()) {
+            return std::numeric_limits<float>::max();
+        }
+
+        const GfVec2d ndc(clip[0] / clip[3], clip[1] / clip[3]);
+        ndcMin = GfVec2d(std::min(ndcMin[0], ndc[0]), std::min(ndcMin[1], ndc[1]));
+        ndcMax = GfVec2d(std::max(ndcMax[0], ndc[0]), std::max(ndcMax[1], ndc[1]));
+    }
+
+    // NDC range is [-1, 1], thus half of the viewport size per unit.
+    const double screenWidth = (ndcMax[0] - ndcMin[0]) * 0.5 * _viewportWidth;
+    const double screenHeight = (ndcMax[1] - ndcMin[1]) * 0.5 * _viewportHeight;
+    return static_cast<float>(std::max(screenWidth, screenHeight));
+}
+
+/*! \brief  Return true when the world bounds are outside of the view frustum of the current
+            update and the prim doesn't need to be synchronized.
+
+    Always false when frustum culling is disabled. An empty range is never culled.
+*/
+bool ProxyRenderDelegate::IsOutsideViewFrustum(const GfRange3d& worldBounds) const
+{
+    if (!_frustumCullingActive || worldBounds.IsEmpty()) {
+        return false;
+    }
+
+    // Transform the corners to clip space. The box is outside when all its corners are on the
+    // outer side of one of the frustum planes: -w <= x, y, z <= w. Maya uses row vectors.
+    int outsideMask = 0x3F;
+    for (size_t i = 0; i < 8; ++i) {
+        const GfVec3d corner = worldBounds.GetCorner(i);
+        const GfVec4d clip = GfVec4d(corner[0], corner[1], corner[2], 1.0) * _viewProjection;
+
+        int cornerMask = 0;
+        cornerMask |= (clip[0] < -clip[3]) ? 0x01 : 0;
+        cornerMask |= (clip[0] > clip[3]) ? 0x02 : 0;
+        cornerMask |= (clip[1] < -clip[3]) ? 0x04 : 0;
+        cornerMask |= (clip[1] > clip[3]) ? 0x08 : 0;
+        cornerMask |= (clip[2] < -clip[3]) ? 0x10 : 0;
+        cornerMask |= (clip[2] > clip[3]) ? 0x20 : 0;
+
+        outsideMask &= cornerMask;
+        if (outsideMask == 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 //! \brief  Main update entry from subscene override.
 void ProxyRenderDelegate::update(MSubSceneContainer& container, const MFrameContext& frameContext)
 {
-    MProfilingScope profilingScope(
+    MayaUsd::ProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L1,
         "ProxyRenderDelegate::update");
@@ -1229,15 +1598,77 @@ void ProxyRenderDelegate::update(MSubSceneContainer& container, const MFrameCont
     param->BeginUpdate(container, _sceneDelegate->GetTime());
     _currentFrameContext = &frameContext;
 
+    // Staged playback values must be settled before the stage is read by this update.
+    if (_playbackPrefetcher) {
+        _playbackPrefetcher->BeginUpdate(_proxyShapeData->UsdStage(), MAnimControl::isPlaying());
+    }
+    // The cached playback state can't change during playback, don't query it at each frame.
+    if (!MAnimControl::isPlaying()) {
+        _UpdateCachedPlaybackBuffers();
+    }
+    if (_vertexBufferCache) {
+        _vertexBufferCache->BeginUpdate(_proxyShapeData->UsdStage());
+    }
+
     if (_Populate()) {
         _UpdateSceneDelegate();
+
+        // Resolve the primvars of the next frames while this one is synchronized.
+        if (_playbackPrefetcher && _playbackPrefetcher->IsActive()) {
+            _PrefetchPlaybackFrames();
+        }
+
         _Execute(frameContext);
     }
 
+    // The prefetch tasks read the stage, which Maya can edit once the update returns.
+    if (_playbackPrefetcher) {
+        _playbackPrefetcher->EndUpdate();
+    }
+
     _currentFrameContext = nullptr;
     param->EndUpdate();
 }
 
+//! \brief  Start prefetching the primvars of the frames following the current one. The Maya
+//!         times of the playback are mapped to USD times through the time of the proxy shape,
+//!         evaluated at each frame, since it may not be connected to the Maya time directly.
+void ProxyRenderDelegate::_PrefetchPlaybackFrames()
+{
+    const MTime step(MAnimControl::playbackBy(), MTime::uiUnit());
+    if (step <= MTime(0.0)) {
+        return;
+    }
+
+    const MTime minTime = MAnimControl::minTime();
+    const MTime maxTime = MAnimControl::maxTime();
+    MTime       mayaTime = MAnimControl::currentTime();
+    MPlug       timePlug(
+        _proxyShapeData->ProxyShape()->thisMObject(), MayaUsdProxyShapeBase::outTimeAttr);
+
+    auto usdTimeAt = [&timePlug](const MTime& time) {
+        MDGContext      context(time);
+        MDGContextGuard contextGuard(context);
+        return timePlug.asMTime().value();
+    };
+
+    // Frames of the playback range after the current one, wrapping around like a looping playback.
+    const size_t             numFrames = _playbackPrefetcher->GetNumFrames();
+    std::vector<UsdTimeCode> nextTimes;
+    nextTimes.reserve(numFrames);
+    for (size_t i = 0; i < numFrames; ++i) {
+        mayaTime += step;
+        if (mayaTime > maxTime) {
+            mayaTime = minTime;
+        }
+        nextTimes.emplace_back(usdTimeAt(mayaTime));
+    }
+
+    const UsdTimeCode time = _sceneDelegate->GetTime();
+    const double      timeStep = usdTimeAt(MAnimControl::currentTime() + step) - time.GetValue();
+    _playbackPrefetcher->Prefetch(time, std::abs(timeStep), nextTimes);
+}
+
 MDagPath ProxyRenderDelegate::GetProxyShapeDagPath() const
 {
     return _proxyShapeData->ProxyDagPath();
@@ -1342,7 +1773,7 @@ bool ProxyRenderDelegate::getInstancedSelectionPath(
     if (handler == nullptr)
         return false;
 
-    const SdfPath rprimId = HdVP2DrawItem::RenderItemToPrimPath(renderItem);
+    SdfPath rprimId = HdVP2DrawItem::RenderItemToPrimPath(renderItem);
 
     // If drawInstID is positive, it means the selection hit comes from one instanced render item,
     // in this case its instance transform matrices have been sorted w.r.t. USD instance index, thus
@@ -1362,6 +1793,15 @@ bool ProxyRenderDelegate::getInstancedSelectionPath(
     }
 #endif
 
+    // The instances of the bounding box batch are the bounding boxes of different rprims.
+    if (_bboxBatch) {
+        const SdfPath bboxPrimId = _bboxBatch->GetInstancePrimPath(renderItem, drawInstID);
+        if (!bboxPrimId.IsEmpty()) {
+            rprimId = bboxPrimId;
+            instanceIndex = UsdImagingDelegate::ALL_INSTANCES;
+        }
+    }
+
     SdfPath topLevelPath;
     int     topLevelInstanceIndex = UsdImagingDelegate::ALL_INSTANCES;
 
@@ -1590,11 +2030,25 @@ void ProxyRenderDelegate::DisplayLayerMembershipChanged(const MString& memberPat
 
             SdfPath usdPath(path.getSegments()[1].string());
             MObject displayLayerObj = displayLayerManager.getLayer(memberPath);
-            if (displayLayerObj.hasFn(MFn::kDisplayLayer)
-                && MFnDisplayLayer(displayLayerObj).name() != "defaultLayer") {
+            if (!displayLayerObj.hasFn(MFn::kDisplayLayer)
+                || MFnDisplayLayer(displayLayerObj).name() == "defaultLayer") {
+                displayLayerObj = MObject();
+            }
+
+            // Only the prims under the member inherit its display layer, nothing needs to be
+            // redrawn if its layer didn't change. Erasing the entry would also drop the layers
+            // of its descendants, so a null object is stored instead.
+            auto it = _usdPathToDisplayLayerMap.find(usdPath);
+            if (it == _usdPathToDisplayLayerMap.end()) {
+                if (displayLayerObj.isNull()) {
+                    return;
+                }
                 _usdPathToDisplayLayerMap[usdPath] = displayLayerObj;
             } else {
-                _usdPathToDisplayLayerMap.erase(usdPath);
+                if (it->second == displayLayerObj) {
+                    return;
+                }
+                it->second = displayLayerObj;
             }
         }
     } else if (path.runTimeId() == MayaUsd::ufe::getMayaRunTimeId()) {
@@ -1644,10 +2098,14 @@ void ProxyRenderDelegate::DisplayLayerPathChanged(
             && newPath.nbSegments() > 1) {
             std::vector<std::pair<SdfPath, MObject>> pathsToUpdate;
             SdfPath oldUsdPrefix(oldPath.getSegments()[1].string());
-            auto    it = _usdPathToDisplayLayerMap.lower_bound(oldUsdPrefix);
-            while (it != _usdPathToDisplayLayerMap.end() && it->first.HasPrefix(oldUsdPrefix)) {
-                pathsToUpdate.push_back(*it);
-                _usdPathToDisplayLayerMap.erase(it++);
+            auto    range = _usdPathToDisplayLayerMap.FindSubtreeRange(oldUsdPrefix);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (!it->second.isNull()) {
+                    pathsToUpdate.push_back(*it);
+                }
+            }
+            if (range.first != range.second) {
+                _usdPathToDisplayLayerMap.erase(range.first);
             }
 
             SdfPath newUsdPrefix(newPath.getSegments()[1].string());
@@ -1758,6 +2216,26 @@ void ProxyRenderDelegate::_PopulateSelection()
     const auto proxyPath = _proxyShapeData->ProxyShape()->ufePath();
     const auto globalSelection = Ufe::GlobalSelection::get();
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    if (globalSelection->empty()) {
+        return;
+    }
+
+    // Only go through the selected items under this proxy shape. The lead
+    // selection is the last item in UFE global selection, the others are the
+    // active selection.
+    const Ufe::SceneItem::Ptr& leadItem = *globalSelection->crbegin();
+    const Ufe::SceneItemList   items = MayaUsd::ufe::GlobalSelectionIndex::itemsUnder(proxyPath);
+    for (auto it = items.crbegin(); it != items.crend(); ++it) {
+        if (*it == leadItem) {
+            PopulateSelection(*it, proxyPath, *_sceneDelegate, _leadSelection);
+        } else if (!globalSelection->containsAncestor((*it)->path())) {
+            // Descendants of selected items are already highlighted through
+            // their ancestor, either as active or as lead, which wins.
+            PopulateSelection(*it, proxyPath, *_sceneDelegate, _activeSelection);
+        }
+    }
+#else
     // Populate lead selection from the last item in UFE global selection.
     auto it = globalSelection->crbegin();
     if (it != globalSelection->crend()) {
@@ -1770,6 +2248,7 @@ void ProxyRenderDelegate::_PopulateSelection()
         }
     }
 #endif
+#endif
 }
 
 /*! \brief  Notify selection change to rprims.
@@ -1792,16 +2271,18 @@ void ProxyRenderDelegate::_UpdateSelectionStates()
         dirtyPaths = &_renderIndex->GetRprimIds();
         _PopulateSelection();
     } else {
-        // Append pre-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
-
         // Update lead and active selection.
+        const HdSelectionSharedPtr oldLeadSelection = _leadSelection;
+        const HdSelectionSharedPtr oldActiveSelection = _activeSelection;
         _PopulateSelection();
 
-        // Append post-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+        // Only the prims whose lead or active state changed need their selection highlight to be
+        // updated, prims staying selected with the same instances are left untouched.
+        AppendSelectionChanges(oldLeadSelection, _leadSelection, rootPaths);
+        AppendSelectionChanges(oldActiveSelection, _activeSelection, rootPaths);
+
+        std::sort(rootPaths.begin(), rootPaths.end());
+        rootPaths.erase(std::unique(rootPaths.begin(), rootPaths.end()), rootPaths.end());
 
         dirtyPaths = &rootPaths;
     }
@@ -1881,7 +2362,7 @@ void ProxyRenderDelegate::_UpdateRenderTags()
         &renderPurposeChanged, &proxyPurposeChanged, &guidePurposeChanged);
     bool anyPurposeChanged = renderPurposeChanged || proxyPurposeChanged || guidePurposeChanged;
     if (anyPurposeChanged) {
-        MProfilingScope subProfilingScope(
+        MayaUsd::ProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L1, "Update Purpose");
 
         TfTokenVector changedRenderTags;
@@ -1898,8 +2379,9 @@ void ProxyRenderDelegate::_UpdateRenderTags()
             changedRenderTags.push_back(HdRenderTagTokens->guide);
         }
 
-        // Mark all the rprims which have a render tag which changed dirty
-        SdfPathVector rprimsToDirty = _GetFilteredRprims(*_defaultCollection, changedRenderTags);
+        // Mark all the rprims which have a render tag which changed dirty. Only the rprims of
+        // these tags are visited, the buckets are kept up to date when rprims are synchronized.
+        SdfPathVector rprimsToDirty = _GetRprimsWithRenderTags(changedRenderTags);
 
         for (auto& id : rprimsToDirty) {
             // this call to MarkRprimDirty will increment the change tracker render
@@ -1958,23 +2440,27 @@ void ProxyRenderDelegate::_UpdateRenderTags()
     // the future.
 }
 
-//! \brief  List the rprims in collection that match renderTags
-SdfPathVector ProxyRenderDelegate::_GetFilteredRprims(
-    HdRprimCollection const& collection,
-    TfTokenVector const&     renderTags)
+//! \brief  List the rprims whose render tag is one of renderTags
+SdfPathVector ProxyRenderDelegate::_GetRprimsWithRenderTags(TfTokenVector const& renderTags)
 {
-    SdfPathVector        rprimIds;
-    const SdfPathVector& paths = _renderIndex->GetRprimIds();
-    const SdfPathVector& includePaths = collection.GetRootPaths();
-    const SdfPathVector& excludePaths = collection.GetExcludePaths();
-#if defined(HD_API_VERSION) && HD_API_VERSION >= 42
-    _FilterParam filterParam = { renderTags, _renderIndex.get() };
-#else
-    _FilterParam filterParam = { collection, renderTags, _renderIndex.get() };
-#endif
-    HdPrimGather gather;
-    gather.PredicatedFilter(
-        paths, includePaths, excludePaths, _DrawItemFilterPredicate, &filterParam, &rprimIds);
+    SdfPathVector rprimIds;
+    for (const TfToken& renderTag : renderTags) {
+        auto bucketIt = _renderTagBuckets.find(renderTag);
+        if (bucketIt == _renderTagBuckets.end()) {
+            continue;
+        }
+
+        RprimIdSet& bucket = bucketIt->second;
+        for (auto it = bucket.begin(); it != bucket.end();) {
+            if (_renderIndex->HasRprim(*it) && _renderIndex->GetRenderTag(*it) == renderTag) {
+                rprimIds.push_back(*it);
+                ++it;
+            } else {
+                // The rprim was removed, or its new tag is not synchronized yet.
+                it = bucket.erase(it);
+            }
+        }
+    }
 
     return rprimIds;
 }
@@ -2257,6 +2743,162 @@ UsdImagingDelegate* ProxyRenderDelegate::GetUsdImagingDelegate() const
     return _sceneDelegate.get();
 }
 
+/*! \brief  Find the point of the meshes closest to a world space ray, within tolerance of it.
+
+    The points of each mesh are searched through the hierarchy of its local space points, built
+    on first use and kept until the points change. Instanced meshes are skipped.
+
+    \param  worldPoint  Closest point, unchanged when none is found.
+    \param  rprimId     Optional id of the mesh of the closest point.
+
+    \return True if a point was found.
+*/
+bool ProxyRenderDelegate::FindClosestPoint(
+    const GfRay& worldRay,
+    double       tolerance,
+    GfVec3d*     worldPoint,
+    SdfPath*     rprimId) const
+{
+    if (!_renderIndex || !_sceneDelegate || !worldPoint) {
+        return false;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L1,
+        "ProxyRenderDelegate::FindClosestPoint");
+
+    bool   found = false;
+    double bestDistance = tolerance;
+    for (const SdfPath& id : _renderIndex->GetRprimIds()) {
+        const HdVP2Mesh* mesh = dynamic_cast<const HdVP2Mesh*>(_renderIndex->GetRprim(id));
+        if (!mesh || !mesh->IsVisible() || !mesh->GetInstancerId().IsEmpty()) {
+            continue;
+        }
+
+        const HdVP2PointBVHSharedPtr bvh = mesh->GetPointBVH();
+        if (!bvh) {
+            continue;
+        }
+
+        // The transform includes the world matrix of the proxy shape, which is the root
+        // transform of the scene delegate.
+        const GfMatrix4d localToWorld = _sceneDelegate->GetTransform(id);
+        const GfMatrix4d worldToLocal = localToWorld.GetInverse();
+
+        // The search runs in local space, the tolerance is scaled by the mean scale of the
+        // transform and the candidate is measured again in world space.
+        GfRay localRay = worldRay;
+        localRay.Transform(worldToLocal);
+        const double scale = std::cbrt(std::abs(worldToLocal.GetDeterminant3()));
+
+        size_t pointIndex = 0;
+        double localDistance = 0.0;
+        if (!bvh->FindClosestToRay(localRay, bestDistance * scale, &pointIndex, &localDistance)) {
+            continue;
+        }
+
+        const GfVec3d point = localToWorld.Transform(GfVec3d(bvh->GetPoints()[pointIndex]));
+        const double  distance = (worldRay.FindClosestPoint(point) - point).GetLength();
+        if (distance <= bestDistance) {
+            bestDistance = distance;
+            *worldPoint = point;
+            if (rprimId) {
+                *rprimId = id;
+            }
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+/*! \brief  Find the closest intersection of a world space ray with the visible meshes.
+
+    The ray is cast on the CPU against the picking scene, it is only available when CPU picking
+    is enabled. Instanced meshes are resolved to the USD prim of the instance hit, like the
+    selection hits of their render items are in getInstancedSelectionPath().
+
+    \param  usdPath     Optional path of the USD prim hit, unchanged on a miss.
+    \param  worldPoint  Optional position of the hit, unchanged on a miss.
+    \param  worldNormal Optional normal of the triangle hit, unchanged on a miss.
+
+    \return True if a mesh was hit.
+*/
+bool ProxyRenderDelegate::Pick(
+    const GfRay& worldRay,
+    SdfPath*     usdPath,
+    GfVec3d*     worldPoint,
+    GfVec3d*     worldNormal) const
+{
+    if (!_pickingScene || !_renderIndex || !_sceneDelegate) {
+        return false;
+    }
+
+    HdVP2PickingScene::Hit hit;
+    if (!_pickingScene->Intersect(*this, *_renderIndex, *_sceneDelegate, worldRay, &hit)) {
+        return false;
+    }
+
+    if (usdPath) {
+        const int instanceIndex
+            = (hit._instanceIndex >= 0) ? hit._instanceIndex : UsdImagingDelegate::ALL_INSTANCES;
+        *usdPath = GetScenePrimPath(hit._rprimId, instanceIndex);
+    }
+    if (worldPoint) {
+        *worldPoint = hit._point;
+    }
+    if (worldNormal) {
+        *worldNormal = hit._normal;
+    }
+    return true;
+}
+
+HdVP2MemoryUsage ProxyRenderDelegate::GetMemoryUsage(size_t maxPrims) const
+{
+    HdVP2MemoryUsage usage;
+    if (!_renderIndex || !_sceneDelegate) {
+        return usage;
+    }
+
+    MayaUsd::ProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L1,
+        "ProxyRenderDelegate::GetMemoryUsage");
+
+    for (const SdfPath& id : _renderIndex->GetRprimIds()) {
+        const MayaUsdRPrim* rprim = dynamic_cast<const MayaUsdRPrim*>(_renderIndex->GetRprim(id));
+        if (!rprim) {
+            continue;
+        }
+
+        HdVP2PrimMemoryUsage prim;
+        prim._usdPath = GetScenePrimPath(id, UsdImagingDelegate::ALL_INSTANCES);
+        rprim->GetMemoryUsage(usage, prim);
+        usage.AddPrim(prim);
+    }
+
+    const SdfPathVector materialIds = _renderIndex->GetSprimSubtree(
+        HdPrimTypeTokens->material, SdfPath::AbsoluteRootPath());
+    for (const SdfPath& id : materialIds) {
+        const HdVP2Material* material = dynamic_cast<const HdVP2Material*>(
+            _renderIndex->GetSprim(HdPrimTypeTokens->material, id));
+        if (material) {
+            material->GetMemoryUsage(usage);
+        }
+    }
+
+    usage.KeepLargestPrims(maxPrims);
+    return usage;
+}
+
+/* static */
+const ProxyRenderDelegate* ProxyRenderDelegate::Find(const MayaUsdProxyShapeBase* proxyShape)
+{
+    const auto it = proxyRenderDelegates.find(proxyShape);
+    return (it != proxyRenderDelegates.end()) ? it->second : nullptr;
+}
+
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
 bool ProxyRenderDelegate::SnapToSelectedObjects() const { return _snapToSelectedObjects; }
 bool ProxyRenderDelegate::SnapToPoints() const { return _snapToPoints; }
@@ -17,13 +17,18 @@
 #define PROXY_RENDER_DELEGATE
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/render/vp2RenderDelegate/memoryUsage.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/ray.h>
 #include <pxr/imaging/hd/engine.h>
 #include <pxr/imaging/hd/selection.h>
 #include <pxr/imaging/hd/task.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/pathTable.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usdImaging/usdImaging/version.h>
 
@@ -38,6 +43,8 @@
 #include <maya/MPxSubSceneOverride.h>
 
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #if defined(WANT_UFE_BUILD)
 #include <ufe/observer.h>
 #include <ufe/path.h>
@@ -74,6 +81,10 @@ class HdRprimCollection;
 class UsdImagingDelegate;
 class MayaUsdProxyShapeBase;
 class HdxTaskController;
+class HdVP2BBoxBatch;
+class HdVP2PickingScene;
+class HdVP2PlaybackPrefetcher;
+class HdVP2VertexBufferCache;
 
 /*! \brief  Enumerations for selection status
  */
@@ -246,6 +257,35 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool DrawRenderTag(const TfToken& renderTag) const;
 
+    MAYAUSD_CORE_PUBLIC
+    bool IsFrustumCullingActive() const { return _frustumCullingActive; }
+
+    MAYAUSD_CORE_PUBLIC
+    bool IsOutsideViewFrustum(const GfRange3d& worldBounds) const;
+
+    //! Remember an rprim skipped by the frustum culling, call from the main thread only
+    MAYAUSD_CORE_PUBLIC
+    void AddCulledRprim(const SdfPath& rprimId) { _culledRprims.push_back(rprimId); }
+
+    //! Remember an rprim depending on its screen size, call from the main thread only
+    MAYAUSD_CORE_PUBLIC
+    void AddScreenSizeLodRprim(const SdfPath& rprimId) { _screenSizeLodRprims.insert(rprimId); }
+
+    MAYAUSD_CORE_PUBLIC
+    float GetBoundsLodScreenSize() const { return _boundsLodScreenSize; }
+
+    MAYAUSD_CORE_PUBLIC
+    float GetScreenSize(const GfRange3d& worldBounds) const;
+
+    //! Return the prefetcher of playback primvars, nullptr when prefetching is disabled.
+    HdVP2PlaybackPrefetcher* GetPlaybackPrefetcher() const { return _playbackPrefetcher.get(); }
+
+    //! Return the cache of vertex buffers per time code, nullptr when the cache is disabled.
+    HdVP2VertexBufferCache* GetVertexBufferCache() const { return _vertexBufferCache.get(); }
+
+    //! Return the instanced bounding boxes of the rprims, nullptr when the batch is disabled.
+    HdVP2BBoxBatch* GetBBoxBatch() const { return _bboxBatch.get(); }
+
     MAYAUSD_CORE_PUBLIC
     UsdImagingDelegate* GetUsdImagingDelegate() const;
 
@@ -262,6 +302,48 @@ public:
         const SdfPath& newPathInPrototype,
         const SdfPath& rprimId);
 
+    //! Move the rprim between render tag buckets, call from the main thread only
+    MAYAUSD_CORE_PUBLIC
+    void UpdateRenderTagEntry(
+        const TfToken& oldRenderTag,
+        const TfToken& newRenderTag,
+        const SdfPath& rprimId);
+
+    /*! \brief  Find the point of the meshes closest to a world space ray, within tolerance of it.
+
+        Must be called from the main thread, outside of the update of the proxy shape.
+    */
+    MAYAUSD_CORE_PUBLIC
+    bool FindClosestPoint(
+        const GfRay& worldRay,
+        double       tolerance,
+        GfVec3d*     worldPoint,
+        SdfPath*     rprimId = nullptr) const;
+
+    /*! \brief  Find the closest intersection of a world space ray with the visible meshes.
+
+        Only available when CPU picking is enabled. Must be called from the main thread, outside
+        of the update of the proxy shape.
+    */
+    MAYAUSD_CORE_PUBLIC
+    bool Pick(
+        const GfRay& worldRay,
+        SdfPath*     usdPath,
+        GfVec3d*     worldPoint,
+        GfVec3d*     worldNormal = nullptr) const;
+
+    /*! \brief  Return the memory used by the cached scene data and the VP2 resources.
+
+        The prims are sorted from the largest to the smallest, only the given number of them is
+        returned. Must be called from the main thread, outside of the update of the proxy shape.
+    */
+    MAYAUSD_CORE_PUBLIC
+    HdVP2MemoryUsage GetMemoryUsage(size_t maxPrims) const;
+
+    //! Return the render delegate drawing the proxy shape, nullptr when it isn't drawn in VP2.
+    MAYAUSD_CORE_PUBLIC
+    static const ProxyRenderDelegate* Find(const MayaUsdProxyShapeBase* proxyShape);
+
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
     MAYAUSD_CORE_PUBLIC
     bool SnapToSelectedObjects() const;
@@ -280,6 +362,11 @@ private:
     bool _Populate();
     void _UpdateSceneDelegate();
     void _Execute(const MHWRender::MFrameContext& frameContext);
+    void _UpdateView(const MHWRender::MFrameContext& frameContext);
+    void _UpdateScreenSizeLod();
+    void _PrefetchPlaybackFrames();
+    void _CreateVertexBufferCache(size_t memoryBudget);
+    void _UpdateCachedPlaybackBuffers();
 
     typedef std::pair<MColor, std::atomic<uint64_t>>  MColorCache;
     typedef std::pair<GfVec3f, std::atomic<uint64_t>> GfVec3fCache;
@@ -298,10 +385,10 @@ private:
     bool _DirtyUfeSubtree(const Ufe::Path& rootPath);
     bool _DirtyUfeSubtree(const MString& rootStr);
     void _DirtyUsdSubtree(const UsdPrim& prim);
+    void _DirtyPendingUsdSubtrees();
 #endif
     void _RequestRefresh();
-    SdfPathVector
-    _GetFilteredRprims(HdRprimCollection const& collection, TfTokenVector const& renderTags);
+    SdfPathVector _GetRprimsWithRenderTags(TfTokenVector const& renderTags);
 
     void ComputeCombinedDisplayStyles(const unsigned int newDisplayStyle);
 
@@ -363,6 +450,12 @@ private:
                          //!< really need it, but there doesn't seem to be a way to get
                          //!< synchronization running without it)
     std::unique_ptr<UsdImagingDelegate> _sceneDelegate; //!< USD scene delegate
+    std::unique_ptr<HdVP2PlaybackPrefetcher>
+        _playbackPrefetcher; //!< Prefetches primvars of the next frames during playback
+    std::shared_ptr<HdVP2VertexBufferCache>
+        _vertexBufferCache; //!< Vertex buffers of the frames visited while scrubbing
+    std::unique_ptr<HdVP2BBoxBatch>     _bboxBatch;    //!< Instanced bounding boxes of the rprims
+    std::unique_ptr<HdVP2PickingScene>  _pickingScene; //!< CPU ray casts against the meshes
     const MHWRender::MFrameContext*     _currentFrameContext = nullptr;
     std::map<TfToken, uint64_t>         _combinedDisplayStyles;
     bool                                _needTexturedMaterials = false;
@@ -370,6 +463,11 @@ private:
     // maps from a path in USD prototype to the corresponding rprim paths
     std::multimap<SdfPath, SdfPath> _instancingMap;
 
+    // the synchronized rprims, bucketed by render tag. Entries of removed rprims are dropped
+    // lazily, the next time their bucket is visited.
+    using RprimIdSet = std::unordered_set<SdfPath, SdfPath::Hash>;
+    std::unordered_map<TfToken, RprimIdSet, TfToken::HashFunctor> _renderTagBuckets;
+
     bool _isPopulated {
         false
     }; //!< If false, scene delegate wasn't populated yet within render index
@@ -377,6 +475,18 @@ private:
     bool _colorPrefsChanged { false }; //!< Whether there is any color preferences change or not
     bool _refreshRequested { false };  //!< True when a refresh has been requested.
 
+    bool       _frustumCullingActive { false }; //!< Whether rprims are culled in this update
+    GfMatrix4d _viewProjection;                //!< View projection matrix of the last draw
+    int        _viewportWidth { 0 };           //!< Viewport width of the last draw
+    int        _viewportHeight { 0 };          //!< Viewport height of the last draw
+    float      _boundsLodScreenSize { 0.0f };  //!< Screen size in pixels of the bounds LOD
+
+    //! Rprims skipped by the frustum culling since the last change of the view
+    SdfPathVector _culledRprims;
+
+    //! Rprims checked by the screen size LOD when the view changes
+    RprimIdSet _screenSizeLodRprims;
+
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
     using NodeHandleToCallbackIdMap = UsdMayaUtil::MObjectHandleUnorderedMap<MCallbackId>;
 
@@ -385,10 +495,17 @@ private:
     MCallbackId               _mayaDisplayLayerMembersCallbackId { 0 };
     NodeHandleToCallbackIdMap _mayaDisplayLayerDirtyCallbackIds;
 
-    // for performace reasons we need to cache display layers' info
-    bool                       _usdStageDisplayLayersDirty = false;
-    MObjectArray               _usdStageDisplayLayers;
-    std::map<SdfPath, MObject> _usdPathToDisplayLayerMap;
+    // for performace reasons we need to cache display layers' info. The display layers of USD
+    // prims are stored in a path table so the layers inherited by a prim are found by walking its
+    // ancestors, and a subtree can be moved or dropped at once. Null objects are stored for the
+    // prims without a display layer.
+    bool                  _usdStageDisplayLayersDirty = false;
+    MObjectArray          _usdStageDisplayLayers;
+    SdfPathTable<MObject> _usdPathToDisplayLayerMap;
+
+    // Bursts of display layer changes dirty the same subtrees many times, their roots are
+    // collected until the next update and each rprim is dirtied once.
+    SdfPathSet _pendingDirtyUsdSubtrees;
 #endif
 
     std::vector<MCallbackId> _mayaColorPrefsCallbackIds;
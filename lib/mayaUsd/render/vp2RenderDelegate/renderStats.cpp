@@ -0,0 +1,111 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "renderStats.h"
+
+#include "memoryUsage.h"
+#include "tokens.h"
+
+#include <pxr/imaging/hd/perfLog.h>
+
+#include <atomic>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Whether the statistics have been enabled through HdVP2RenderStats
+std::atomic<bool> _enabled { false };
+
+} // namespace
+
+void HdVP2RenderStats::Enable()
+{
+    _enabled = true;
+    HdPerfLog::GetInstance().Enable();
+}
+
+void HdVP2RenderStats::Disable()
+{
+    _enabled = false;
+    HdPerfLog::GetInstance().Disable();
+}
+
+bool HdVP2RenderStats::IsEnabled() { return _enabled; }
+
+HdVP2RenderStats::Counters HdVP2RenderStats::GetCounters()
+{
+    HdPerfLog& perfLog = HdPerfLog::GetInstance();
+
+    Counters counters;
+    counters.reserve(HdVP2PerfTokens->allTokens.size());
+    for (const TfToken& name : HdVP2PerfTokens->allTokens) {
+        counters.emplace_back(name, perfLog.GetCounter(name));
+    }
+    return counters;
+}
+
+void HdVP2RenderStats::BeginUpdate()
+{
+    if (!_enabled) {
+        return;
+    }
+
+    // The texture memory is not reset, it is the memory in use rather than a per-update count.
+    // Neither is the population time, the stage is populated once before its first update, nor
+    // the prefetched primvars, which are counted over the whole playback.
+    HdPerfLog& perfLog = HdPerfLog::GetInstance();
+    for (const TfToken& name : HdVP2PerfTokens->allTokens) {
+        if (name != HdVP2PerfTokens->vp2TextureMemoryBytes
+            && name != HdVP2PerfTokens->vp2PopulateTimeMs
+            && name != HdVP2PerfTokens->vp2PrefetchedPrimvars) {
+            perfLog.SetCounter(name, 0.0);
+        }
+    }
+}
+
+void HdVP2RenderStats::AddVertexBufferUpload(const MHWRender::MVertexBuffer& buffer)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    const double numBytes = static_cast<double>(HdVP2GetBufferBytes(buffer));
+
+    switch (buffer.descriptor().semantic()) {
+    case MHWRender::MGeometry::kPosition:
+        HD_PERF_COUNTER_ADD(HdVP2PerfTokens->vp2PositionBytes, numBytes);
+        break;
+    case MHWRender::MGeometry::kNormal:
+        HD_PERF_COUNTER_ADD(HdVP2PerfTokens->vp2NormalBytes, numBytes);
+        break;
+    case MHWRender::MGeometry::kColor:
+        HD_PERF_COUNTER_ADD(HdVP2PerfTokens->vp2ColorBytes, numBytes);
+        break;
+    default: HD_PERF_COUNTER_ADD(HdVP2PerfTokens->vp2PrimvarBytes, numBytes); break;
+    }
+}
+
+void HdVP2RenderStats::AddIndexBufferUpload(const MHWRender::MIndexBuffer& buffer)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    const double numBytes = static_cast<double>(HdVP2GetBufferBytes(buffer));
+    HD_PERF_COUNTER_ADD(HdVP2PerfTokens->vp2IndexBytes, numBytes);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
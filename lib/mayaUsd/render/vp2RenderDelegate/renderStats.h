@@ -0,0 +1,71 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_RENDER_STATS
+#define HD_VP2_RENDER_STATS
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+
+#include <maya/MHWGeometry.h>
+
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Runtime statistics of the VP2 render delegate.
+    \class  HdVP2RenderStats
+
+    The statistics are recorded as counters of the Hydra performance log, thus they cost nothing
+    until the log is enabled. Counters are reset at the beginning of each update of a proxy shape,
+    they describe the last update when several proxy shapes are drawn.
+*/
+class HdVP2RenderStats
+{
+public:
+    using Counters = std::vector<std::pair<TfToken, double>>;
+
+    //! Start recording the statistics.
+    MAYAUSD_CORE_PUBLIC
+    static void Enable();
+
+    //! Stop recording the statistics.
+    MAYAUSD_CORE_PUBLIC
+    static void Disable();
+
+    //! Return true when the statistics are recorded.
+    MAYAUSD_CORE_PUBLIC
+    static bool IsEnabled();
+
+    //! Return the name and the value of all the counters of the VP2 render delegate.
+    MAYAUSD_CORE_PUBLIC
+    static Counters GetCounters();
+
+    //! Reset the per-update counters. Called at the beginning of each proxy shape update.
+    static void BeginUpdate();
+
+    //! Count the upload of a vertex buffer, by semantic. Call from the main thread only.
+    static void AddVertexBufferUpload(const MHWRender::MVertexBuffer& buffer);
+
+    //! Count the upload of an index buffer. Call from the main thread only.
+    static void AddIndexBufferUpload(const MHWRender::MIndexBuffer& buffer);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_RENDER_STATS
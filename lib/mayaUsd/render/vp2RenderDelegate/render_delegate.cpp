@@ -22,15 +22,20 @@
 #include "material.h"
 #include "mesh.h"
 #include "points.h"
+#include "renderStats.h"
 #include "render_pass.h"
 #include "tokens.h"
 
 #include <mayaUsd/render/vp2ShaderFragments/shaderFragments.h>
 #include <mayaUsd/utils/hash.h>
+#include <mayaUsd/utils/profilingScope.h>
 
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/getenv.h>
 #include <pxr/imaging/hd/bprim.h>
 #include <pxr/imaging/hd/camera.h>
 #include <pxr/imaging/hd/instancer.h>
+#include <pxr/imaging/hd/perfLog.h>
 #include <pxr/imaging/hd/resourceRegistry.h>
 #include <pxr/imaging/hd/rprim.h>
 #include <pxr/imaging/hd/tokens.h>
@@ -44,6 +49,20 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_OCTAHEDRAL_NORMALS,
+    false,
+    "Upload the normals of the meshes drawn with UsdPreviewSurface materials as octahedral-encoded "
+    "2x16-bit vectors instead of 3 floats, decoded by the shader. Ignored when the normals are "
+    "computed on the GPU.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_SHARE_STAGE_BUFFERS,
+    false,
+    "Share the vertex buffers filled for a time code between the proxy shapes displaying the same "
+    "stage, and the rendering topologies and index buffers between all the proxy shapes. Vertex "
+    "buffers are shared through the vertex buffer cache, which must be enabled.");
+
 namespace {
 /*! \brief List of supported Rprims by VP2 render delegate
  */
@@ -396,6 +415,7 @@ public:
 
         // Insert the new shader instance
         if (TF_VERIFY(shader)) {
+            HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2ShaderInstances);
             float diffuseColor[] = { color.r, color.g, color.b, color.a };
             shader->setParameter(_diffuseColorParameterName, diffuseColor);
             shaderMap._map[color] = shader;
@@ -412,7 +432,12 @@ public:
 
         const MHWRender::MShaderInstance* shader
             = (it != _userCache._map.cend() ? it->second.get() : nullptr);
-        return (shader ? shader->clone() : nullptr);
+        if (!shader) {
+            return nullptr;
+        }
+
+        HD_PERF_COUNTER_INCR(HdVP2PerfTokens->vp2ShaderInstances);
+        return shader->clone();
     }
 
     /*! \brief  Adds a clone of the shader to the cache with the specified id if it doesn't exist.
@@ -431,6 +456,31 @@ public:
         return true;
     }
 
+    /*! \brief  Returns the shader instance shared with the specified id, or an empty pointer.
+     */
+    HdVP2ShaderSharedPtr GetSharedShader(const TfToken& id)
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
+
+        const auto it = _userCache._sharedInstances.find(id);
+        return (it != _userCache._sharedInstances.cend() ? it->second.lock() : nullptr);
+    }
+
+    /*! \brief  Shares a shader instance with the specified id, replacing a released one.
+     */
+    void AddSharedShader(const TfToken& id, const HdVP2ShaderSharedPtr& shader)
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, true /*write*/);
+
+        // Prune the entries of the shader instances released by all their materials.
+        for (auto it = _userCache._sharedInstances.begin();
+             it != _userCache._sharedInstances.end();) {
+            it = it->second.expired() ? _userCache._sharedInstances.erase(it) : std::next(it);
+        }
+
+        _userCache._sharedInstances[id] = shader;
+    }
+
 #ifdef WANT_MATERIALX_BUILD
     /*! \brief  Returns the cached primvars associated with a shader entry.
                 Will return nullptr if there are no primvars associated with the shader id.
@@ -471,6 +521,7 @@ public:
             _3dSolidShaders._map.clear();
             _3dFatPointShaders._map.clear();
             _userCache._map.clear();
+            _userCache._sharedInstances.clear();
             _3dDefaultMaterialShader = nullptr;
             _3dCPVSolidShader = nullptr;
             _3dCPVFatPointShader = nullptr;
@@ -638,7 +689,8 @@ void HdVP2RenderDelegate::CommitResources(HdChangeTracker* tracker)
 {
     TF_UNUSED(tracker);
 
-    MProfilingScope profilingScope(sProfilerCategory, MProfiler::kColorC_L2, "Commit resources");
+    MayaUsd::ProfilingScope profilingScope(
+        sProfilerCategory, MProfiler::kColorC_L2, "Commit resources");
 
     // --------------------------------------------------------------------- //
     // RESOLVE, COMPUTE & COMMIT PHASE
@@ -648,8 +700,30 @@ void HdVP2RenderDelegate::CommitResources(HdChangeTracker* tracker)
     //     1) Execute compute as needed for normals, tessellation, etc.
     //     2) Commit resources to the GPU.
     //     3) Update any scene-level acceleration structures.
+    //
+    // Buffer fill tasks run first in parallel, followed by the serial execution of VP2 API calls.
 
-    _resourceRegistryVP2.Commit();
+    _resourceRegistryVP2.Commit(sProfilerCategory);
+
+    const HdVP2ResourceRegistry::CommitStats& stats = _resourceRegistryVP2.GetLastCommitStats();
+    HD_PERF_COUNTER_SET(HdVP2PerfTokens->vp2FillTasks, stats._fillTaskCount);
+    HD_PERF_COUNTER_SET(HdVP2PerfTokens->vp2FillTimeMs, stats._fillTimeMs);
+    HD_PERF_COUNTER_SET(HdVP2PerfTokens->vp2CommitTasks, stats._commitTaskCount);
+    HD_PERF_COUNTER_SET(HdVP2PerfTokens->vp2CommitTimeMs, stats._commitTimeMs);
+
+    // Full resolution textures loaded progressively are uploaded within a per-frame budget.
+    HdVP2Material::ResetTextureUploadBudget();
+
+    // Textures reduced by the texture memory budget get their resolution back once they fit.
+    HdVP2Material::RestoreReducedTextures();
+
+    // Positions of large point clouds are uploaded in chunks within a per-frame budget.
+    HdVP2Points::ResetPointsUploadBudget();
+
+    if (HdVP2RenderStats::IsEnabled()) {
+        HD_PERF_COUNTER_SET(
+            HdVP2PerfTokens->vp2TextureMemoryBytes, HdVP2Material::GetTextureMemoryUsage());
+    }
 }
 
 /*! \brief  Return a list of which Rprim types can be created by this class's.
@@ -687,6 +761,18 @@ HdVP2ResourceRegistry& HdVP2RenderDelegate::GetVP2ResourceRegistry()
     return _resourceRegistryVP2;
 }
 
+/*! \brief  Return the registry deduplicating mesh rendering topologies and index buffers.
+ */
+HdVP2MeshTopologyRegistry& HdVP2RenderDelegate::GetMeshTopologyRegistry()
+{
+    if (IsStageBufferSharingEnabled()) {
+        // The entries are weak references, the registry outlives the render delegates.
+        static HdVP2MeshTopologyRegistry sharedRegistry;
+        return sharedRegistry;
+    }
+    return _meshTopologyRegistry;
+}
+
 /*! \brief  Create a renderpass for rendering a given collection.
  */
 HdRenderPassSharedPtr
@@ -996,6 +1082,23 @@ bool HdVP2RenderDelegate::AddShaderToCache(
     return sShaderCache.AddShaderToCache(id, shader);
 }
 
+/*! \brief  Returns the shader instance shared with the specified id, or an empty pointer.
+ */
+HdVP2ShaderSharedPtr HdVP2RenderDelegate::GetSharedShader(const TfToken& id)
+{
+    return sShaderCache.GetSharedShader(id);
+}
+
+/*! \brief  Shares a shader instance with the specified id, replacing a released one.
+
+    The cache doesn't own the shader instance, the entry is pruned once all the materials using
+    it are released.
+ */
+void HdVP2RenderDelegate::AddSharedShader(const TfToken& id, const HdVP2ShaderSharedPtr& shader)
+{
+    sShaderCache.AddSharedShader(id, shader);
+}
+
 #ifdef WANT_MATERIALX_BUILD
 /*! \brief  Returns the cached primvars associated with a shader entry.
             Will return nullptr if there are no primvars associated with the shader id.
@@ -1164,4 +1267,27 @@ void HdVP2RenderDelegate::CleanupMaterials()
 
 void HdVP2RenderDelegate::OnMayaExit() { sShaderCache.OnMayaExit(); }
 
+/*! \brief  Return true when the normals are uploaded octahedral-encoded.
+
+    The GPU normals computation writes 3 floats per vertex, the encoding is disabled with it so
+    that the materials and the meshes always agree on the normals stream.
+*/
+bool HdVP2RenderDelegate::IsOctahedralNormalsEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_OCTAHEDRAL_NORMALS)
+        && TfGetenvInt("HDVP2_USE_GPU_NORMAL_COMPUTATION", 0) <= 0;
+    return enabled;
+}
+
+/*! \brief  Return true when the proxy shapes share the buffers filled for identical data.
+
+    Proxy shapes displaying the same stage at the same time share the vertex buffers of their
+    rprims, and meshes with identical topology share their index buffer across proxy shapes.
+*/
+bool HdVP2RenderDelegate::IsStageBufferSharingEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_VP2_SHARE_STAGE_BUFFERS);
+    return enabled;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -16,6 +16,7 @@
 #ifndef HD_VP2_RENDER_DELEGATE
 #define HD_VP2_RENDER_DELEGATE
 
+#include "meshTopologyRegistry.h"
 #include "render_param.h"
 #include "resource_registry.h"
 #include "shader.h"
@@ -87,6 +88,8 @@ public:
 
     HdVP2ResourceRegistry& GetVP2ResourceRegistry();
 
+    HdVP2MeshTopologyRegistry& GetMeshTopologyRegistry();
+
     HdRenderPassSharedPtr
     CreateRenderPass(HdRenderIndex* index, HdRprimCollection const& collection) override;
 
@@ -154,6 +157,9 @@ public:
 
     MHWRender::MShaderInstance* GetShaderFromCache(const TfToken& id);
     bool AddShaderToCache(const TfToken& id, const MHWRender::MShaderInstance& shader);
+
+    HdVP2ShaderSharedPtr GetSharedShader(const TfToken& id);
+    void                 AddSharedShader(const TfToken& id, const HdVP2ShaderSharedPtr& shader);
 #ifdef WANT_MATERIALX_BUILD
     const TfTokenVector* GetPrimvarsFromCache(const TfToken& id);
     bool                 AddPrimvarsToCache(const TfToken& id, const TfTokenVector& primvars);
@@ -169,6 +175,12 @@ public:
 
     static void OnMayaExit();
 
+    //! Return true when the mesh normals are uploaded octahedral-encoded.
+    static bool IsOctahedralNormalsEnabled();
+
+    //! Return true when the proxy shapes share the buffers filled for identical data.
+    static bool IsStageBufferSharingEnabled();
+
 private:
     HdVP2RenderDelegate(const HdVP2RenderDelegate&) = delete;
     HdVP2RenderDelegate& operator=(const HdVP2RenderDelegate&) = delete;
@@ -188,6 +200,8 @@ private:
     SdfPath _id;          //!< Render delegate ID
     HdVP2ResourceRegistry
         _resourceRegistryVP2; //!< VP2 resource registry used for enqueue and execution of commits
+    HdVP2MeshTopologyRegistry
+        _meshTopologyRegistry; //!< Rendering topologies shared by meshes with identical topology
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -18,9 +18,17 @@
 
 #include "task_commit.h"
 
+#include <mayaUsd/utils/profilingScope.h>
+
+#include <maya/MProfiler.h>
+
 #include <tbb/concurrent_queue.h>
+#include <tbb/parallel_for.h>
 #include <tbb/tbb_allocator.h>
 
+#include <chrono>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  Central place to manage GPU resources commits and any resources not managed by VP2
@@ -34,14 +42,79 @@ public:
     //! \brief  Default destructor
     ~HdVP2ResourceRegistry() = default;
 
-    //! \brief  Execute commit tasks (called by render delegate)
-    void Commit()
+    /*! \brief  Timing and task counters of the last call to Commit()
+
+        Fill tasks are executed in parallel, thus their time is the wall-clock duration of the
+        whole fill phase and not the sum of all individual task durations.
+    */
+    struct CommitStats
     {
-        HdVP2TaskCommit* commitTask;
-        while (_commitTasks.try_pop(commitTask)) {
-            (*commitTask)();
-            commitTask->destroy();
+        size_t _fillTaskCount { 0 };   //!< Number of buffer fill tasks executed in parallel
+        size_t _commitTaskCount { 0 }; //!< Number of commit tasks executed on the main thread
+        double _fillTimeMs { 0.0 };    //!< Wall-clock time spent in the fill phase
+        double _commitTimeMs { 0.0 };  //!< Time spent in the serial commit phase
+    };
+
+    //! \brief  Execute fill tasks in parallel, then commit tasks serially (called by render
+    //! delegate)
+    void Commit(int profilerCategory)
+    {
+        using Clock = std::chrono::steady_clock;
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        CommitStats stats;
+
+        // Phase 1: fill mapped buffers in parallel. Fill tasks only write to memory which has
+        // been acquired during Sync and don't call any VP2 API, thus they are safe to run on
+        // worker threads.
+        {
+            MayaUsd::ProfilingScope profilingScope(
+                profilerCategory, MProfiler::kColorC_L2, "Fill vertex buffers");
+
+            const Clock::time_point start = Clock::now();
+
+            HdVP2TaskCommit* fillTask;
+            while (_fillTasks.try_pop(fillTask)) {
+                _pendingFillTasks.push_back(fillTask);
+            }
+
+            stats._fillTaskCount = _pendingFillTasks.size();
+            if (stats._fillTaskCount > 0) {
+                tbb::parallel_for(
+                    tbb::blocked_range<size_t>(0, stats._fillTaskCount),
+                    [this](const tbb::blocked_range<size_t>& range) {
+                        for (size_t i = range.begin(); i != range.end(); ++i) {
+                            (*_pendingFillTasks[i])();
+                        }
+                    });
+
+                for (HdVP2TaskCommit* task : _pendingFillTasks) {
+                    task->destroy();
+                }
+                _pendingFillTasks.clear();
+            }
+
+            stats._fillTimeMs = Milliseconds(Clock::now() - start).count();
         }
+
+        // Phase 2: unmap buffers and execute VP2 API calls on the main thread.
+        {
+            MayaUsd::ProfilingScope profilingScope(
+                profilerCategory, MProfiler::kColorC_L2, "Commit VP2 resources");
+
+            const Clock::time_point start = Clock::now();
+
+            HdVP2TaskCommit* commitTask;
+            while (_commitTasks.try_pop(commitTask)) {
+                (*commitTask)();
+                commitTask->destroy();
+                ++stats._commitTaskCount;
+            }
+
+            stats._commitTimeMs = Milliseconds(Clock::now() - start).count();
+        }
+
+        _lastCommitStats = stats;
     }
 
     //! \brief  Enqueue commit task. Call is thread safe.
@@ -50,9 +123,33 @@ public:
         _commitTasks.push(HdVP2TaskCommitBody<Body>::construct(taskBody));
     }
 
+    /*! \brief  Enqueue buffer fill task. Call is thread safe.
+
+        Fill tasks are executed in parallel on TBB worker threads before any commit task, so the
+        body must only write to CPU memory previously acquired from a VP2 buffer and must not make
+        any VP2 API call. The matching buffer commit is expected to be enqueued with
+        EnqueueCommit().
+    */
+    template <typename Body> void EnqueueFill(Body taskBody)
+    {
+        _fillTasks.push(HdVP2TaskCommitBody<Body>::construct(taskBody));
+    }
+
+    //! \brief  Return the counters of the last call to Commit()
+    const CommitStats& GetLastCommitStats() const { return _lastCommitStats; }
+
 private:
     //! Concurrent queue for commit tasks
     tbb::concurrent_queue<HdVP2TaskCommit*, tbb::tbb_allocator<HdVP2TaskCommit*>> _commitTasks;
+
+    //! Concurrent queue for buffer fill tasks
+    tbb::concurrent_queue<HdVP2TaskCommit*, tbb::tbb_allocator<HdVP2TaskCommit*>> _fillTasks;
+
+    //! Fill tasks popped from the queue, kept around to avoid reallocation every frame
+    std::vector<HdVP2TaskCommit*> _pendingFillTasks;
+
+    //! Counters of the last commit
+    CommitStats _lastCommitStats;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -31,4 +31,11 @@ void HdVP2ShaderDeleter::operator()(MHWRender::MShaderInstance* shader)
     }
 }
 
+/*! \brief  Takes the ownership of a shader, returns an empty pointer if the shader is null.
+ */
+HdVP2ShaderSharedPtr HdVP2MakeSharedShader(MHWRender::MShaderInstance* shader)
+{
+    return shader ? HdVP2ShaderSharedPtr(shader, HdVP2ShaderDeleter()) : HdVP2ShaderSharedPtr();
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -39,6 +39,14 @@ struct HdVP2ShaderDeleter
  */
 using HdVP2ShaderUniquePtr = std::unique_ptr<MHWRender::MShaderInstance, HdVP2ShaderDeleter>;
 
+/*! \brief  A MShaderInstance owned by a std::shared_ptr.
+ */
+using HdVP2ShaderSharedPtr = std::shared_ptr<MHWRender::MShaderInstance>;
+
+/*! \brief  Takes the ownership of a shader, returns an empty pointer if the shader is null.
+ */
+HdVP2ShaderSharedPtr HdVP2MakeSharedShader(MHWRender::MShaderInstance* shader);
+
 /*! \brief  Thread-safe cache of named shaders.
  */
 struct HdVP2ShaderCache
@@ -46,6 +54,10 @@ struct HdVP2ShaderCache
     //! Shader registry
     std::unordered_map<TfToken, HdVP2ShaderUniquePtr, TfToken::HashFunctor> _map;
 
+    //! Shader instances shared by the materials with identical networks and parameter values
+    std::unordered_map<TfToken, std::weak_ptr<MHWRender::MShaderInstance>, TfToken::HashFunctor>
+        _sharedInstances;
+
 #ifdef WANT_MATERIALX_BUILD
     //! Primvars registry
     std::unordered_map<TfToken, TfTokenVector, TfToken::HashFunctor> _primvars;
@@ -21,4 +21,6 @@ TF_DEFINE_PUBLIC_TOKENS(HdVP2ReprTokens, HDVP2_REPR_TOKENS);
 
 TF_DEFINE_PUBLIC_TOKENS(HdVP2Tokens, HDVP2_TOKENS);
 
+TF_DEFINE_PUBLIC_TOKENS(HdVP2PerfTokens, HDVP2_PERF_TOKENS);
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -31,7 +31,26 @@ PXR_NAMESPACE_OPEN_SCOPE
 #define HDVP2_TOKENS \
     (displayColorAndOpacity) \
     (glslfx) \
-    (mtlx)
+    (mtlx) \
+    (octahedralNormals)
+
+#define HDVP2_PERF_TOKENS \
+    (vp2FillTasks) \
+    (vp2FillTimeMs) \
+    (vp2CommitTasks) \
+    (vp2CommitTimeMs) \
+    (vp2RprimsSynced) \
+    (vp2PositionBytes) \
+    (vp2NormalBytes) \
+    (vp2ColorBytes) \
+    (vp2PrimvarBytes) \
+    (vp2IndexBytes) \
+    (vp2ShaderInstances) \
+    (vp2TextureMemoryBytes) \
+    (vp2ExecuteTimeMs) \
+    (vp2SyncTimeMs) \
+    (vp2PopulateTimeMs) \
+    (vp2PrefetchedPrimvars)
 
 // clang-format on
 
@@ -39,6 +58,8 @@ TF_DECLARE_PUBLIC_TOKENS(HdVP2ReprTokens, , HDVP2_REPR_TOKENS);
 
 TF_DECLARE_PUBLIC_TOKENS(HdVP2Tokens, , HDVP2_TOKENS);
 
+TF_DECLARE_PUBLIC_TOKENS(HdVP2PerfTokens, , HDVP2_PERF_TOKENS);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // HD_VP2_TOKENS_H
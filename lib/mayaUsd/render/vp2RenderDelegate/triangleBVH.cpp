@@ -0,0 +1,111 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "triangleBVH.h"
+
+#include <pxr/imaging/hd/meshUtil.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Return the triangles of the scene topology whose points all exist.
+VtVec3iArray _ComputeTriangles(const HdMeshTopology& topology, size_t numPoints)
+{
+    HdMeshUtil   meshUtil(&topology, SdfPath());
+    VtVec3iArray triangles;
+    VtIntArray   primitiveParams;
+    meshUtil.ComputeTriangleIndices(&triangles, &primitiveParams);
+
+    const int    maxIndex = static_cast<int>(numPoints);
+    VtVec3iArray validTriangles;
+    validTriangles.reserve(triangles.size());
+    for (const GfVec3i& triangle : triangles) {
+        if (triangle[0] >= 0 && triangle[0] < maxIndex && triangle[1] >= 0
+            && triangle[1] < maxIndex && triangle[2] >= 0 && triangle[2] < maxIndex) {
+            validTriangles.push_back(triangle);
+        }
+    }
+    return validTriangles;
+}
+
+//! Return the bounds of each triangle.
+std::vector<GfRange3f>
+_ComputeTriangleBounds(const VtVec3iArray& triangles, const VtVec3fArray& points)
+{
+    std::vector<GfRange3f> bounds;
+    bounds.reserve(triangles.size());
+    for (const GfVec3i& triangle : triangles) {
+        GfRange3f range;
+        range.UnionWith(points[triangle[0]]);
+        range.UnionWith(points[triangle[1]]);
+        range.UnionWith(points[triangle[2]]);
+        bounds.push_back(range);
+    }
+    return bounds;
+}
+
+} // namespace
+
+HdVP2TriangleBVH::HdVP2TriangleBVH(const HdMeshTopology& topology, const VtVec3fArray& points)
+    : _points(points)
+    , _triangles(_ComputeTriangles(topology, points.size()))
+    , _bvh(_ComputeTriangleBounds(_triangles, _points))
+{
+}
+
+bool HdVP2TriangleBVH::Intersect(
+    const GfRay& ray,
+    double       maxDistance,
+    double*      distance,
+    GfVec3d*     normal) const
+{
+    bool   found = false;
+    double closest = maxDistance;
+    size_t closestTriangle = 0;
+
+    _bvh.Intersect(ray, maxDistance, [&](size_t triangleIndex, double& maxHitDistance) {
+        const GfVec3i& triangle = _triangles[triangleIndex];
+
+        double hitDistance = 0.0;
+        if (ray.Intersect(
+                GfVec3d(_points[triangle[0]]),
+                GfVec3d(_points[triangle[1]]),
+                GfVec3d(_points[triangle[2]]),
+                &hitDistance,
+                nullptr,
+                nullptr,
+                closest)
+            && hitDistance < closest) {
+            closest = hitDistance;
+            closestTriangle = triangleIndex;
+            maxHitDistance = hitDistance;
+            found = true;
+        }
+    });
+
+    if (found) {
+        const GfVec3i& triangle = _triangles[closestTriangle];
+        const GfVec3d  p0(_points[triangle[0]]);
+        const GfVec3d  p1(_points[triangle[1]]);
+        const GfVec3d  p2(_points[triangle[2]]);
+
+        *distance = closest;
+        *normal = GfCross(p1 - p0, p2 - p0).GetNormalized();
+    }
+    return found;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
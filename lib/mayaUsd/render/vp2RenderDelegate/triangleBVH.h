@@ -0,0 +1,66 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_TRIANGLE_BVH
+#define HD_VP2_TRIANGLE_BVH
+
+#include "boundsBVH.h"
+
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/pxr.h>
+
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Bounding volume hierarchy over the triangles of a mesh, used for CPU ray casts.
+    \class  HdVP2TriangleBVH
+
+    The triangles are built in the local space of the mesh from its scene topology, so that the
+    same hierarchy serves every instance and transform of the mesh. It is immutable once built and
+    must be rebuilt when the points or the topology change.
+*/
+class HdVP2TriangleBVH final
+{
+public:
+    HdVP2TriangleBVH(const HdMeshTopology& topology, const VtVec3fArray& points);
+    ~HdVP2TriangleBVH() = default;
+
+    //! Return the bounds of all the triangles.
+    GfRange3f GetBounds() const { return _bvh.GetBounds(); }
+
+    /*! \brief  Find the closest intersection of a local space ray with the triangles.
+
+        \param  distance    Parametric distance of the hit along the ray, unchanged on a miss.
+        \param  normal      Local space normal of the triangle hit, unchanged on a miss.
+
+        \return True if a triangle closer than maxDistance was hit.
+    */
+    bool Intersect(const GfRay& ray, double maxDistance, double* distance, GfVec3d* normal) const;
+
+private:
+    VtVec3fArray   _points;
+    VtVec3iArray   _triangles; //!< Point indices of the triangles
+    HdVP2BoundsBVH _bvh;       //!< Hierarchy of the bounds of the triangles
+};
+
+using HdVP2TriangleBVHSharedPtr = std::shared_ptr<const HdVP2TriangleBVH>;
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_TRIANGLE_BVH
@@ -0,0 +1,218 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "vertexBufferCache.h"
+
+#include <pxr/base/arch/threads.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+
+#include <algorithm>
+#include <map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_VERTEX_BUFFER_CACHE_SIZE,
+    0,
+    "Size in megabytes of the vertex buffers kept per time code to speed up scrubbing animated "
+    "USD. A value of 0 disables the cache.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_CACHED_PLAYBACK_BUFFER_CACHE_SIZE,
+    0,
+    "Size in megabytes of the vertex buffers kept per time code while Maya cached playback is "
+    "enabled, when MAYAUSD_VP2_VERTEX_BUFFER_CACHE_SIZE is 0. A value of 0 disables it.");
+
+namespace {
+
+size_t _GetBufferSizeInBytes(const HdVP2VertexBufferSharedPtr& buffer, size_t numVertices)
+{
+    if (!buffer) {
+        return 0;
+    }
+
+    const MHWRender::MVertexBufferDescriptor& desc = buffer->descriptor();
+    return numVertices * desc.dataTypeSize() * desc.dimension();
+}
+
+//! Caches shared by the proxy shapes displaying the same stage
+std::map<const UsdStage*, std::weak_ptr<HdVP2VertexBufferCache>> sharedCaches;
+
+} // namespace
+
+size_t HdVP2CachedVertexBuffers::GetSizeInBytes() const
+{
+    return _points.size() * sizeof(GfVec3f) + _GetBufferSizeInBytes(_positionsBuffer, _numVertices)
+        + _GetBufferSizeInBytes(_normalsBuffer, _numVertices);
+}
+
+size_t HdVP2VertexBufferCache::GetMemoryBudget()
+{
+    static const size_t memoryBudget
+        = static_cast<size_t>(std::max(TfGetEnvSetting(MAYAUSD_VP2_VERTEX_BUFFER_CACHE_SIZE), 0))
+        * 1024 * 1024;
+    return memoryBudget;
+}
+
+size_t HdVP2VertexBufferCache::GetCachedPlaybackMemoryBudget()
+{
+    static const size_t memoryBudget
+        = static_cast<size_t>(
+              std::max(TfGetEnvSetting(MAYAUSD_VP2_CACHED_PLAYBACK_BUFFER_CACHE_SIZE), 0))
+        * 1024 * 1024;
+    return memoryBudget;
+}
+
+HdVP2VertexBufferCache::HdVP2VertexBufferCache(size_t memoryBudget)
+    : _memoryBudget(memoryBudget)
+{
+}
+
+HdVP2VertexBufferCache::~HdVP2VertexBufferCache() { TfNotice::Revoke(_objectsChangedKey); }
+
+std::shared_ptr<HdVP2VertexBufferCache>
+HdVP2VertexBufferCache::GetSharedCache(const UsdStageRefPtr& stage, size_t memoryBudget)
+{
+    TF_VERIFY(ArchIsMainThread(), "Sharing vertex buffer caches from worker threads");
+
+    // Expired entries are purged here, the caches are only created when a proxy shape is
+    // initialized so the map stays small.
+    for (auto it = sharedCaches.begin(); it != sharedCaches.end();) {
+        it = it->second.expired() ? sharedCaches.erase(it) : std::next(it);
+    }
+
+    std::weak_ptr<HdVP2VertexBufferCache>& entry = sharedCaches[get_pointer(stage)];
+    std::shared_ptr<HdVP2VertexBufferCache> cache = entry.lock();
+    if (!cache) {
+        cache = std::make_shared<HdVP2VertexBufferCache>(memoryBudget);
+        entry = cache;
+    }
+    return cache;
+}
+
+void HdVP2VertexBufferCache::BeginUpdate(const UsdStageRefPtr& stage)
+{
+    TF_VERIFY(ArchIsMainThread(), "Releasing vertex buffers from worker threads");
+
+    if (_stage != stage) {
+        TfNotice::Revoke(_objectsChangedKey);
+        _Clear();
+
+        _stage = stage;
+        if (stage) {
+            _objectsChangedKey = TfNotice::Register(
+                TfCreateWeakPtr(this), &HdVP2VertexBufferCache::_OnObjectsChanged, _stage);
+        }
+    }
+
+    if (_stageChanged.exchange(false)) {
+        _Clear();
+    }
+
+    // The previous update has rebound the render items, the buffers which are not used anymore
+    // are only referenced by these lists.
+    std::vector<HdVP2CachedVertexBuffersSharedPtr> evicted;
+    std::vector<HdVP2VertexBufferSharedPtr>        released;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        evicted.swap(_evicted);
+        released.swap(_released);
+    }
+}
+
+HdVP2CachedVertexBuffersSharedPtr
+HdVP2VertexBufferCache::Find(const SdfPath& rprimId, UsdTimeCode time)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(_Key(rprimId, time.GetValue()));
+    if (it == _entries.end()) {
+        return nullptr;
+    }
+
+    _lru.splice(_lru.begin(), _lru, it->second._lruIt);
+    return it->second._buffers;
+}
+
+void HdVP2VertexBufferCache::Insert(
+    const SdfPath&                    rprimId,
+    UsdTimeCode                       time,
+    HdVP2CachedVertexBuffersSharedPtr entry)
+{
+    if (!entry) {
+        return;
+    }
+
+    const size_t sizeInBytes = entry->GetSizeInBytes();
+    if (sizeInBytes > _memoryBudget) {
+        return;
+    }
+
+    const _Key                  key(rprimId, time.GetValue());
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(key);
+    if (it != _entries.end()) {
+        _memoryUsed -= it->second._buffers->GetSizeInBytes();
+        _evicted.push_back(std::move(it->second._buffers));
+        it->second._buffers = std::move(entry);
+        _lru.splice(_lru.begin(), _lru, it->second._lruIt);
+    } else {
+        _lru.push_front(key);
+        _entries.emplace(key, _Entry { std::move(entry), _lru.begin() });
+    }
+    _memoryUsed += sizeInBytes;
+
+    // Evict the least recently used frames, the entry just inserted is the most recent one.
+    while (_memoryUsed > _memoryBudget && !_lru.empty()) {
+        auto evictedIt = _entries.find(_lru.back());
+        _memoryUsed -= evictedIt->second._buffers->GetSizeInBytes();
+        _evicted.push_back(std::move(evictedIt->second._buffers));
+        _entries.erase(evictedIt);
+        _lru.pop_back();
+    }
+}
+
+void HdVP2VertexBufferCache::Release(HdVP2VertexBufferSharedPtr&& buffer)
+{
+    if (!buffer) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _released.push_back(std::move(buffer));
+}
+
+void HdVP2VertexBufferCache::_Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& entry : _entries) {
+        _evicted.push_back(std::move(entry.second._buffers));
+    }
+    _entries.clear();
+    _lru.clear();
+    _memoryUsed = 0;
+}
+
+void HdVP2VertexBufferCache::_OnObjectsChanged(
+    const UsdNotice::ObjectsChanged&,
+    const UsdStageWeakPtr&)
+{
+    // Any edit may change the values of the cached frames, they are discarded by the next update.
+    _stageChanged = true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
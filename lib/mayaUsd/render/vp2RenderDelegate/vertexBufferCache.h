@@ -0,0 +1,157 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_VERTEX_BUFFER_CACHE
+#define HD_VP2_VERTEX_BUFFER_CACHE
+
+#include <mayaUsd/utils/hash.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <maya/MHWGeometry.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+using HdVP2VertexBufferSharedPtr = std::shared_ptr<MHWRender::MVertexBuffer>;
+
+//! Vertex buffers of an rprim filled for one time code.
+struct HdVP2CachedVertexBuffers
+{
+    VtVec3fArray               _points;            //!< Points the buffers were filled from
+    size_t                     _numVertices { 0 }; //!< Number of vertices in each buffer
+    HdVP2VertexBufferSharedPtr _positionsBuffer;   //!< Positions of the vertices
+    HdVP2VertexBufferSharedPtr _normalsBuffer;     //!< Normals, null if none were filled
+
+    //! Return the memory used by the points and the buffers.
+    size_t GetSizeInBytes() const;
+};
+
+using HdVP2CachedVertexBuffersSharedPtr = std::shared_ptr<const HdVP2CachedVertexBuffers>;
+
+/*! \brief  Keep the vertex buffers of the frames visited while scrubbing animated USD.
+    \class  HdVP2VertexBufferCache
+
+    When the MAYAUSD_VP2_VERTEX_BUFFER_CACHE_SIZE environment variable is greater than 0, the
+    positions and normals buffers filled by rprims whose points changed with the time are kept
+    per time code, up to the given size in megabytes. Revisiting a frame rebinds the cached
+    buffers instead of reading the points and filling the buffers again. The least recently
+    used frames are evicted when the budget is reached, and the whole cache is cleared when the
+    stage changes.
+
+    Buffers can still be bound to render items when they are evicted or replaced, they are
+    released on the main thread at the beginning of the next update.
+
+    When only MAYAUSD_VP2_CACHED_PLAYBACK_BUFFER_CACHE_SIZE is greater than 0, the cache is
+    created with its size while Maya cached playback is enabled and released when it gets
+    disabled. Maya caches the evaluated proxy shapes, the frames played from its cache then
+    rebind the buffers instead of syncing the rprims again.
+
+    When MAYAUSD_VP2_SHARE_STAGE_BUFFERS is enabled, one cache is used by all the proxy shapes
+    displaying a stage and rprims are identified by their USD path instead of their rprim id.
+*/
+class HdVP2VertexBufferCache : public TfWeakBase
+{
+public:
+    //! Return the memory budget of the cache in bytes, 0 when the cache is disabled.
+    static size_t GetMemoryBudget();
+
+    //! Return the memory budget of the cache used while Maya cached playback is enabled, in
+    //! bytes. 0 when the cache doesn't follow cached playback.
+    static size_t GetCachedPlaybackMemoryBudget();
+
+    explicit HdVP2VertexBufferCache(size_t memoryBudget);
+    ~HdVP2VertexBufferCache();
+
+    /*! \brief  Return the cache shared by the proxy shapes displaying the stage.
+
+        The cache is created on first use and released with the last proxy shape using it. Call
+        from main thread only.
+    */
+    static std::shared_ptr<HdVP2VertexBufferCache>
+    GetSharedCache(const UsdStageRefPtr& stage, size_t memoryBudget);
+
+    //! Release evicted buffers and discard stale frames. Call from main thread only.
+    void BeginUpdate(const UsdStageRefPtr& stage);
+
+    //! Return the buffers of the rprim cached for the time, null if none. Call is thread safe.
+    HdVP2CachedVertexBuffersSharedPtr Find(const SdfPath& rprimId, UsdTimeCode time);
+
+    //! Cache the buffers of the rprim filled for the time. Call is thread safe.
+    void Insert(const SdfPath& rprimId, UsdTimeCode time, HdVP2CachedVertexBuffersSharedPtr entry);
+
+    //! Defer the release of a buffer which may still be bound to the next update. Thread safe.
+    void Release(HdVP2VertexBufferSharedPtr&& buffer);
+
+private:
+    HdVP2VertexBufferCache(const HdVP2VertexBufferCache&) = delete;
+    HdVP2VertexBufferCache& operator=(const HdVP2VertexBufferCache&) = delete;
+
+    void _Clear();
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender);
+
+    using _Key = std::pair<SdfPath, double>;
+
+    struct _KeyHash
+    {
+        size_t operator()(const _Key& key) const
+        {
+            size_t seed = key.first.GetHash();
+            MayaUsd::hash_combine(seed, key.second);
+            return seed;
+        }
+    };
+
+    //! Keys from the most to the least recently used
+    using _LruList = std::list<_Key>;
+
+    struct _Entry
+    {
+        HdVP2CachedVertexBuffersSharedPtr _buffers;
+        _LruList::iterator                _lruIt;
+    };
+
+    const size_t _memoryBudget; //!< Maximum memory used by the cached frames
+
+    UsdStageWeakPtr   _stage;                  //!< Stage the frames belong to
+    TfNotice::Key     _objectsChangedKey;      //!< Registration of the stage change listener
+    std::atomic<bool> _stageChanged { false }; //!< True when the frames must be discarded
+
+    std::mutex                                     _mutex;            //!< Protects members below
+    std::unordered_map<_Key, _Entry, _KeyHash>     _entries;          //!< Cached frames
+    _LruList                                       _lru;              //!< Usage order of _entries
+    std::vector<HdVP2CachedVertexBuffersSharedPtr> _evicted;          //!< Frames to release
+    std::vector<HdVP2VertexBufferSharedPtr>        _released;         //!< Buffers to release
+    size_t                                         _memoryUsed { 0 }; //!< Memory used by _entries
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_VERTEX_BUFFER_CACHE
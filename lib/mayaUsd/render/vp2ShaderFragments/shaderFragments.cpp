@@ -76,6 +76,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (Float4ToFloat3)
     (Float4ToFloat4)
 
+    (DecodeOctahedralNormal)
     (NwFaceCameraIfNAN)
 
     (lightingContributions)
@@ -139,6 +140,7 @@ static const TfTokenVector _FragmentNames = { _tokens->BasisCurvesCubicColorDoma
                                               _tokens->Float4ToFloat3,
                                               _tokens->Float4ToFloat4,
 
+                                              _tokens->DecodeOctahedralNormal,
                                               _tokens->NwFaceCameraIfNAN,
 
                                               _tokens->PointsGeometry,
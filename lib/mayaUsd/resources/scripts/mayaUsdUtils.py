@@ -77,6 +77,72 @@ def isPulledMayaReference(dagPath):
     return prim and prim.GetTypeName() == 'MayaReference'
 
 
+def getPopulationMaskPaths(proxyShape):
+    """
+    Retrieves the prim paths of the population mask of the proxy shape.
+    An empty list means that the whole stage is populated.
+    """
+    mask = cmds.getAttr(proxyShape + '.populationMask') or ''
+    return [path.strip() for path in mask.split(',') if path.strip()]
+
+
+def setPopulationMaskPaths(proxyShape, primPaths):
+    """
+    Sets the prim paths of the population mask of the proxy shape.
+    The stage is opened again with only these prims and their descendants.
+    """
+    cmds.setAttr(proxyShape + '.populationMask', ','.join(primPaths), type='string')
+
+
+def addPopulationMaskPaths(proxyShape, primPaths):
+    """
+    Adds prim paths to the population mask of the proxy shape.
+    """
+    maskPaths = getPopulationMaskPaths(proxyShape)
+    maskPaths += [path for path in primPaths if path not in maskPaths]
+    setPopulationMaskPaths(proxyShape, maskPaths)
+
+
+def removePopulationMaskPaths(proxyShape, primPaths):
+    """
+    Removes prim paths from the population mask of the proxy shape.
+    Removing all of them populates the whole stage.
+    """
+    maskPaths = getPopulationMaskPaths(proxyShape)
+    setPopulationMaskPaths(proxyShape, [path for path in maskPaths if path not in primPaths])
+
+
+def _splitUsdUfePath(ufePathString):
+    """
+    Splits the UFE path of a USD prim into the proxy shape path and the prim path.
+    Returns None for both if the UFE path is not the one of a USD prim.
+    """
+    segments = ufe.PathString.path(ufePathString).segments
+    if len(segments) != 2:
+        return None, None
+    return ufe.PathString.string(ufe.Path(segments[0])), str(segments[1])
+
+
+def addUfePathsToPopulationMask(ufePathStrings):
+    """
+    Adds the USD prims of the UFE paths to the population masks of their proxy shapes.
+    """
+    for ufePathString in ufePathStrings:
+        proxyShape, primPath = _splitUsdUfePath(ufePathString)
+        if proxyShape:
+            addPopulationMaskPaths(proxyShape, [primPath])
+
+
+def removeUfePathsFromPopulationMask(ufePathStrings):
+    """
+    Removes the USD prims of the UFE paths from the population masks of their proxy shapes.
+    """
+    for ufePathString in ufePathStrings:
+        proxyShape, primPath = _splitUsdUfePath(ufePathString)
+        if proxyShape:
+            removePopulationMaskPaths(proxyShape, [primPath])
+
+
 def getMonoFormatFileFilterLabels(includeCompressed = True):
     """
     Returns a list of file-format labels for individual USD file formats.
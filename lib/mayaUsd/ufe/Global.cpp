@@ -25,6 +25,7 @@
 #include <mayaUsd/ufe/UsdSceneItemOpsHandler.h>
 #include <mayaUsd/ufe/UsdTransform3dHandler.h>
 #ifdef UFE_V2_FEATURES_AVAILABLE
+#include <mayaUsd/ufe/GlobalSelectionIndex.h>
 #include <mayaUsd/ufe/ProxyShapeContextOpsHandler.h>
 #include <mayaUsd/ufe/UsdAttributesHandler.h>
 #include <mayaUsd/ufe/UsdCameraHandler.h>
@@ -261,6 +262,7 @@ MStatus initialize()
 
     g_USDRtid = runTimeMgr.register_(kUSDRunTimeName, handlers);
     MayaUsd::ufe::UsdUIUfeObserver::create();
+    MayaUsd::ufe::GlobalSelectionIndex::create();
 
 #ifndef UFE_V4_FEATURES_AVAILABLE
 #if UFE_LIGHTS_SUPPORT
@@ -329,6 +331,7 @@ MStatus finalize(bool exiting)
     g_MayaContextOpsHandler.reset();
 
     MayaUsd::ufe::UsdUIUfeObserver::destroy();
+    MayaUsd::ufe::GlobalSelectionIndex::destroy();
 #endif
     runTimeMgr.unregister(g_USDRtid);
     g_MayaHierarchyHandler.reset();
@@ -0,0 +1,112 @@
+//
+// Copyright 2022 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "GlobalSelectionIndex.h"
+
+#include <pxr/base/tf/diagnostic.h>
+
+#include <ufe/globalSelection.h>
+#include <ufe/observableSelection.h>
+
+// Needed because of TF_VERIFY
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace MAYAUSD_NS_DEF {
+namespace ufe {
+
+//------------------------------------------------------------------------------
+// Global variables
+//------------------------------------------------------------------------------
+std::shared_ptr<GlobalSelectionIndex> GlobalSelectionIndex::instance;
+
+//------------------------------------------------------------------------------
+// GlobalSelectionIndex
+//------------------------------------------------------------------------------
+
+GlobalSelectionIndex::GlobalSelectionIndex()
+    : Ufe::Observer()
+{
+}
+
+/*static*/
+void GlobalSelectionIndex::create()
+{
+    TF_VERIFY(!instance);
+    if (!instance) {
+        instance = std::make_shared<GlobalSelectionIndex>();
+        Ufe::GlobalSelection::get()->addObserver(instance);
+    }
+}
+
+/*static*/
+void GlobalSelectionIndex::destroy()
+{
+    TF_VERIFY(instance);
+    if (instance) {
+        Ufe::GlobalSelection::get()->removeObserver(instance);
+        instance.reset();
+    }
+}
+
+/*static*/
+Ufe::SceneItemList GlobalSelectionIndex::itemsUnder(const Ufe::Path& proxyShapePath)
+{
+    if (instance) {
+        instance->rebuildIfDirty();
+        auto found = instance->_itemsByProxyShape.find(proxyShapePath);
+        return found == instance->_itemsByProxyShape.end() ? Ufe::SceneItemList()
+                                                           : found->second;
+    }
+
+    // Not observing the global selection, filter it.
+    Ufe::SceneItemList items;
+    for (const auto& item : *Ufe::GlobalSelection::get()) {
+        const auto& path = item->path();
+        if (path.nbSegments() > 1 && path.startsWith(proxyShapePath)) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+void GlobalSelectionIndex::rebuildIfDirty()
+{
+    if (!_dirty)
+        return;
+
+    _itemsByProxyShape.clear();
+    for (const auto& item : *Ufe::GlobalSelection::get()) {
+        // Items directly in the Maya scene are not under a proxy shape.
+        const auto& path = item->path();
+        if (path.nbSegments() > 1) {
+            _itemsByProxyShape[Ufe::Path(path.getSegments()[0])].push_back(item);
+        }
+    }
+    _dirty = false;
+}
+
+//------------------------------------------------------------------------------
+// Ufe::Observer overrides
+//------------------------------------------------------------------------------
+
+void GlobalSelectionIndex::operator()(const Ufe::Notification&)
+{
+    // Any global selection notification, the index will be rebuilt on demand.
+    _dirty = true;
+    _itemsByProxyShape.clear();
+}
+
+} // namespace ufe
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,72 @@
+#ifndef GLOBALSELECTIONINDEX_H
+#define GLOBALSELECTIONINDEX_H
+
+//
+// Copyright 2022 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <mayaUsd/base/api.h>
+
+#include <ufe/observer.h>
+#include <ufe/path.h>
+#include <ufe/sceneItemList.h>
+
+#include <unordered_map>
+
+namespace MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Index of the global selection items by proxy shape.
+/*!
+    Each proxy shape only needs the selected items under it, but filtering the
+    whole global selection for every proxy shape scales with the number of
+    proxy shapes times the number of selected items.  The index groups the
+    items by their first path segment in a single pass over the selection, on
+    first query after the global selection changed.
+ */
+class MAYAUSD_CORE_PUBLIC GlobalSelectionIndex : public Ufe::Observer
+{
+public:
+    GlobalSelectionIndex();
+
+    // Delete the copy/move constructors assignment operators.
+    GlobalSelectionIndex(const GlobalSelectionIndex&) = delete;
+    GlobalSelectionIndex& operator=(const GlobalSelectionIndex&) = delete;
+    GlobalSelectionIndex(GlobalSelectionIndex&&) = delete;
+    GlobalSelectionIndex& operator=(GlobalSelectionIndex&&) = delete;
+
+    //! Create/Destroy the GlobalSelectionIndex observing the global selection.
+    static void create();
+    static void destroy();
+
+    //! Return the items of the global selection below the argument proxy
+    //! shape path, in selection order.
+    static Ufe::SceneItemList itemsUnder(const Ufe::Path& proxyShapePath);
+
+    void operator()(const Ufe::Notification& notification) override;
+
+private:
+    void rebuildIfDirty();
+
+    std::unordered_map<Ufe::Path, Ufe::SceneItemList> _itemsByProxyShape;
+    bool                                              _dirty { true };
+
+    static std::shared_ptr<GlobalSelectionIndex> instance;
+};
+
+} // namespace ufe
+} // namespace MAYAUSD_NS_DEF
+
+#endif // GLOBALSELECTIONINDEX_H
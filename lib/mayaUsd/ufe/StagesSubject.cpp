@@ -23,12 +23,14 @@
 #ifdef UFE_V2_FEATURES_AVAILABLE
 #include <mayaUsd/ufe/UsdCamera.h>
 #endif
+#include <mayaUsd/ufe/UsdHierarchy.h>
 #include <mayaUsd/ufe/UsdStageMap.h>
 #include <mayaUsd/ufe/Utils.h>
 #ifdef UFE_V2_FEATURES_AVAILABLE
 #include <mayaUsd/undo/UsdUndoManager.h>
 #endif
 
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/prim.h>
@@ -37,6 +39,7 @@
 #include <pxr/usd/usdGeom/xformOp.h>
 
 #include <maya/MMessage.h>
+#include <maya/MNodeMessage.h>
 #include <maya/MSceneMessage.h>
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
@@ -44,8 +47,10 @@
 #include <ufe/sceneNotification.h>
 #include <ufe/transform3d.h>
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
+#include <memory>
 #include <vector>
 
 #ifdef UFE_V2_FEATURES_AVAILABLE
@@ -54,10 +59,26 @@
 #include <ufe/object3dNotification.h>
 
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #endif
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_UFE_COALESCE_NOTIFICATIONS,
+    false,
+    "Send the UFE scene notifications of a USD change notice as a single composite "
+    "notification, and collapse its attribute notifications.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_UFE_MAX_NOTIFICATIONS,
+    10000,
+    "When coalescing UFE notifications, number of changed paths in a USD change notice above "
+    "which a single subtree invalidate notification is sent for the whole stage instead.");
+#endif
+
 namespace {
 
 // Prevent re-entrant stage set.
@@ -150,6 +171,26 @@ struct AttributeMetadataNotification : public AttributeNotification
 //    in the size of the vector (which is the same as an unordered_multimap).
 std::vector<AttributeNotification> pendingAttributeChangedNotifications;
 
+// Value changes of the pending notifications, to collapse them without a
+// linear search when many attributes change within a guard.
+struct PendingValueChangeHash
+{
+    size_t operator()(const std::pair<Ufe::Path, TfToken>& key) const
+    {
+        return std::hash<Ufe::Path>()(key.first) ^ key.second.Hash();
+    }
+};
+std::unordered_set<std::pair<Ufe::Path, TfToken>, PendingValueChangeHash> pendingValueChanges;
+
+void addPendingAttributeChangedNotification(const AttributeNotification& notification)
+{
+    // Only value changes are collapsed, see AttributeNotification::operator==.
+    if (notification._type != AttributeChangeType::kValueChanged
+        || pendingValueChanges.emplace(notification._path, notification._token).second) {
+        pendingAttributeChangedNotifications.emplace_back(notification);
+    }
+}
+
 bool inAttributeChangedNotificationGuard()
 {
     return attributeChangedNotificationGuardCount.load() > 0;
@@ -220,15 +261,8 @@ void valueChanged(const Ufe::Path& ufePath, const TfToken& changedToken)
 {
     if (inAttributeChangedNotificationGuard()) {
         // Don't add pending notif if one already exists with same path/token.
-        auto p
-            = AttributeNotification { ufePath, changedToken, AttributeChangeType::kValueChanged };
-        if (std::find(
-                pendingAttributeChangedNotifications.begin(),
-                pendingAttributeChangedNotifications.end(),
-                p)
-            == pendingAttributeChangedNotifications.end()) {
-            pendingAttributeChangedNotifications.emplace_back(p);
-        }
+        addPendingAttributeChangedNotification(
+            AttributeNotification { ufePath, changedToken, AttributeChangeType::kValueChanged });
     } else {
         sendAttributeChanged(ufePath, changedToken, AttributeChangeType::kValueChanged);
     }
@@ -242,14 +276,8 @@ void attributeChanged(
 {
     if (inAttributeChangedNotificationGuard()) {
         // Don't add pending notif if one already exists with same path/token.
-        auto p = AttributeNotification { ufePath, changedToken, changeType };
-        if (std::find(
-                pendingAttributeChangedNotifications.begin(),
-                pendingAttributeChangedNotifications.end(),
-                p)
-            == pendingAttributeChangedNotifications.end()) {
-            pendingAttributeChangedNotifications.emplace_back(p);
-        }
+        addPendingAttributeChangedNotification(
+            AttributeNotification { ufePath, changedToken, changeType });
     } else {
         sendAttributeChanged(ufePath, changedToken, changeType);
     }
@@ -361,8 +389,75 @@ void processAttributeChanges(
 
 #endif
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+// Scene notifications collected while processing a USD change notice, to be
+// sent as a single composite notification when the batch expires.
+class SceneNotificationBatch
+{
+public:
+    enum class OpType
+    {
+        kAdd,
+        kPostDelete,
+        kSubtreeInvalidate
+    };
+
+    // Batches can be nested, when observers edit the stage: the outermost
+    // one sends all the notifications.
+    SceneNotificationBatch()
+        : _outer(current)
+    {
+        if (!_outer)
+            current = this;
+    }
+
+    ~SceneNotificationBatch()
+    {
+        if (!_outer) {
+            flush();
+            current = nullptr;
+        }
+    }
+
+    SceneNotificationBatch(const SceneNotificationBatch&) = delete;
+    SceneNotificationBatch& operator=(const SceneNotificationBatch&) = delete;
+
+    // Append the notification to the current batch. Returns false if there is
+    // no current batch, in which case the notification must be sent.
+    static bool append(OpType type, const Ufe::SceneItem::Ptr& sceneItem)
+    {
+        if (!current)
+            return false;
+        current->_ops.emplace_back(type, sceneItem);
+        return true;
+    }
+
+    // Send the collected notifications, e.g. to preserve the order with a
+    // notification which cannot be batched.
+    static void flushCurrent()
+    {
+        if (current)
+            current->flush();
+    }
+
+private:
+    void flush();
+
+    static SceneNotificationBatch* current;
+
+    SceneNotificationBatch*                                  _outer;
+    std::vector<std::pair<OpType, Ufe::SceneItem::Ptr>> _ops;
+};
+
+SceneNotificationBatch* SceneNotificationBatch::current = nullptr;
+#endif
+
 void sendObjectAdd(const Ufe::SceneItem::Ptr& sceneItem)
 {
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    if (SceneNotificationBatch::append(SceneNotificationBatch::OpType::kAdd, sceneItem))
+        return;
+#endif
     try {
 #ifdef UFE_V2_FEATURES_AVAILABLE
         Ufe::Scene::instance().notify(Ufe::ObjectAdd(sceneItem));
@@ -377,6 +472,10 @@ void sendObjectAdd(const Ufe::SceneItem::Ptr& sceneItem)
 
 void sendObjectPostDelete(const Ufe::SceneItem::Ptr& sceneItem)
 {
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    if (SceneNotificationBatch::append(SceneNotificationBatch::OpType::kPostDelete, sceneItem))
+        return;
+#endif
     try {
 #ifdef UFE_V2_FEATURES_AVAILABLE
         Ufe::Scene::instance().notify(Ufe::ObjectPostDelete(sceneItem));
@@ -393,6 +492,8 @@ void sendObjectDestroyed(const Ufe::Path& ufePath)
 {
     try {
 #ifdef UFE_V2_FEATURES_AVAILABLE
+        // A destroyed object has no scene item for the composite notification.
+        SceneNotificationBatch::flushCurrent();
         Ufe::Scene::instance().notify(Ufe::ObjectDestroyed(ufePath));
 #else
         // Unfortunately in Ufe v1 there was no object destroyed notif
@@ -415,6 +516,11 @@ void sendObjectDestroyed(const Ufe::Path& ufePath)
 
 void sendSubtreeInvalidate(const Ufe::SceneItem::Ptr& sceneItem)
 {
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    if (SceneNotificationBatch::append(
+            SceneNotificationBatch::OpType::kSubtreeInvalidate, sceneItem))
+        return;
+#endif
     try {
 #ifdef UFE_V2_FEATURES_AVAILABLE
         Ufe::Scene::instance().notify(Ufe::SubtreeInvalidate(sceneItem));
@@ -429,6 +535,43 @@ void sendSubtreeInvalidate(const Ufe::SceneItem::Ptr& sceneItem)
     }
 }
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+void SceneNotificationBatch::flush()
+{
+    // Swap the operations out, so that the send functions don't append to
+    // the batch again.
+    std::vector<std::pair<OpType, Ufe::SceneItem::Ptr>> ops;
+    ops.swap(_ops);
+    auto* batch = current;
+    current = nullptr;
+
+    if (ops.size() == 1) {
+        const auto& op = ops.front();
+        switch (op.first) {
+        case OpType::kAdd: sendObjectAdd(op.second); break;
+        case OpType::kPostDelete: sendObjectPostDelete(op.second); break;
+        case OpType::kSubtreeInvalidate: sendSubtreeInvalidate(op.second); break;
+        }
+    } else if (!ops.empty()) {
+        Ufe::SceneCompositeNotification composite;
+        for (const auto& op : ops) {
+            switch (op.first) {
+            case OpType::kAdd: composite.appendObjectAdd(op.second); break;
+            case OpType::kPostDelete: composite.appendObjectDelete(op.second); break;
+            case OpType::kSubtreeInvalidate: composite.appendSubtreeInvalidate(op.second); break;
+            }
+        }
+        try {
+            Ufe::Scene::instance().notify(composite);
+        } catch (const std::exception& ex) {
+            TF_WARN("Caught error during notification: %s", ex.what());
+        }
+    }
+
+    current = batch;
+}
+#endif
+
 } // namespace
 
 namespace MAYAUSD_NS_DEF {
@@ -466,6 +609,11 @@ StagesSubject::StagesSubject()
     fCbIds.append(
         MSceneMessage::addCallback(MSceneMessage::kAfterNew, afterNewCallback, this, &res));
     CHECK_MSTATUS(res);
+    fCbIds.append(MDagMessage::addAllDagChangesCallback(dagChangedCallback, this, &res));
+    CHECK_MSTATUS(res);
+    fCbIds.append(
+        MNodeMessage::addNameChangedCallback(MObject::kNullObj, nameChangedCallback, this, &res));
+    CHECK_MSTATUS(res);
 
     TfWeakPtr<StagesSubject> me(this);
     TfNotice::Register(me, &StagesSubject::onStageSet);
@@ -523,6 +671,29 @@ void StagesSubject::afterOpenCallback(void* clientData)
     ss->afterOpen();
 }
 
+/*static*/
+void StagesSubject::dagChangedCallback(
+    MDagMessage::DagMessage /*msgType*/,
+    MDagPath& /*child*/,
+    MDagPath& /*parent*/,
+    void* /*clientData*/)
+{
+    // Reparenting, adding or deleting a Dag node can change the path of
+    // proxy shapes.
+    g_StageMap.dagChanged();
+}
+
+/*static*/
+void StagesSubject::nameChangedCallback(
+    MObject& node,
+    const MString& /*prevName*/,
+    void* /*clientData*/)
+{
+    // Renaming a proxy shape or one of its ancestors changes its path.
+    if (node.hasFn(MFn::kDagNode))
+        g_StageMap.dagChanged();
+}
+
 void StagesSubject::afterOpen()
 {
     // Observe stage changes, for all stages.  Return listener object can
@@ -543,6 +714,10 @@ void StagesSubject::afterOpen()
         });
     fStageListeners.clear();
 
+    // Stage changes are no longer observed, so the cached children can't be
+    // trusted anymore.
+    UsdHierarchy::clearChildrenCache();
+
     // Set up our stage to proxy shape UFE path (and reverse)
     // mapping.  We do this with the following steps:
     // - get all proxyShape nodes in the scene.
@@ -556,10 +731,50 @@ void StagesSubject::stageChanged(
     UsdNotice::ObjectsChanged const& notice,
     UsdStageWeakPtr const&           sender)
 {
+    // Invalidate the cached children of the changed prims before sending any
+    // notification, since observers will likely query the hierarchy. This is
+    // done even during path changes, which send their own notifications.
+    for (const auto& changedPath : notice.GetResyncedPaths()) {
+        if (!changedPath.IsPropertyPath())
+            UsdHierarchy::invalidateChildrenCache(sender, changedPath, true);
+    }
+    for (const auto& changedPath : notice.GetChangedInfoOnlyPaths()) {
+        // Metadata changes, such as the pull information, can remap a prim
+        // to another scene item in its parent children list.
+        if (changedPath.IsPrimPath())
+            UsdHierarchy::invalidateChildrenCache(sender, changedPath, false);
+    }
+
     // If the stage path has not been initialized yet, do nothing
     if (stagePath(sender).empty())
         return;
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    // When coalescing, the scene notifications of the notice are sent as a
+    // single composite notification, followed by the collapsed attribute
+    // notifications. The batch is declared last so that it expires first.
+    std::unique_ptr<AttributeChangedNotificationGuard> attributeGuard;
+    std::unique_ptr<SceneNotificationBatch>            sceneBatch;
+    static const bool coalesce = TfGetEnvSetting(MAYAUSD_UFE_COALESCE_NOTIFICATIONS);
+    if (coalesce) {
+        static const size_t maxNotifications
+            = std::max(TfGetEnvSetting(MAYAUSD_UFE_MAX_NOTIFICATIONS), 1);
+        if (notice.GetResyncedPaths().size() + notice.GetChangedInfoOnlyPaths().size()
+            > maxNotifications) {
+            // Too many changes to notify individually: invalidate the whole stage.
+            if (!InPathChange::inPathChange()) {
+                if (auto sceneItem = Ufe::Hierarchy::createItem(stagePath(sender)))
+                    sendSubtreeInvalidate(sceneItem);
+            }
+            return;
+        }
+
+        if (!inAttributeChangedNotificationGuard())
+            attributeGuard.reset(new AttributeChangedNotificationGuard);
+        sceneBatch.reset(new SceneNotificationBatch);
+    }
+#endif
+
     auto stage = notice.GetStage();
     auto resyncPaths = notice.GetResyncedPaths();
     for (auto it = resyncPaths.begin(), end = resyncPaths.end(); it != end; ++it) {
@@ -806,7 +1021,7 @@ void StagesSubject::onStageSet(const MayaUsdProxyStageSetNotice& notice)
 #endif
 
     // Handle re-entrant MayaUsdProxyShapeBase::compute; allow update only on first compute call.
-    if (MayaUsdProxyShapeBase::in_compute > 1)
+    if (MayaUsdProxyShapeBase::computeDepth() > 1)
         return;
 
     // Handle re-entrant onStageSet
@@ -827,6 +1042,9 @@ void StagesSubject::onStageSet(const MayaUsdProxyStageSetNotice& notice)
             fStageListeners[stage] = noticeKeys;
         }
 
+        // Drop the children cached while the stages were not observed.
+        UsdHierarchy::clearChildrenCache();
+
         // Now we can send the notifications about stage change.
         for (auto& path : fInvalidStages) {
             Ufe::SceneItem::Ptr sceneItem = Ufe::Hierarchy::createItem(path);
@@ -897,6 +1115,7 @@ AttributeChangedNotificationGuard::~AttributeChangedNotificationGuard()
     }
 
     pendingAttributeChangedNotifications.clear();
+    pendingValueChanges.clear();
 }
 #endif
 
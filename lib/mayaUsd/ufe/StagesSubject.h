@@ -25,6 +25,7 @@
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MCallbackIdArray.h>
+#include <maya/MDagMessage.h>
 #include <ufe/path.h>
 #include <ufe/ufe.h> // For UFE_V2_FEATURES_AVAILABLE
 
@@ -71,6 +72,14 @@ private:
     static void afterNewCallback(void* clientData);
     static void afterOpenCallback(void* clientData);
 
+    // Maya Dag message callbacks, to keep the stage map paths up to date.
+    static void dagChangedCallback(
+        MDagMessage::DagMessage msgType,
+        MDagPath&               child,
+        MDagPath&               parent,
+        void*                   clientData);
+    static void nameChangedCallback(MObject& node, const MString& prevName, void* clientData);
+
     //! Call the stageChanged() methods on stage observers.
     void stageChanged(
         PXR_NS::UsdNotice::ObjectsChanged const& notice,
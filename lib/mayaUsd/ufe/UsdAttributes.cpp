@@ -23,15 +23,18 @@
 #include <pxr/base/tf/token.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/usd/primDefinition.h>
 #include <pxr/usd/usd/schemaRegistry.h>
 #include <pxr/usd/usdShade/utils.h>
 
 #include <ufe/runTimeMgr.h>
 #include <ufe/ufeAssert.h>
 
+#include <unordered_map>
+#include <vector>
+
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
-#include <mayaUsd/ufe/UsdShaderAttributeDef.h>
 #include <mayaUsd/ufe/UsdShaderAttributeHolder.h>
 #include <mayaUsd/ufe/UsdShaderNodeDefHandler.h>
 #endif
@@ -56,24 +59,105 @@ namespace {
 
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
-std::pair<PXR_NS::SdrShaderPropertyConstPtr, PXR_NS::UsdShadeAttributeType>
-_GetSdrPropertyAndType(const Ufe::SceneItem::Ptr& item, const std::string& tokName)
+// The shader properties of a shader node definition, indexed by their full
+// attribute name. Shader node definitions are owned by the Sdr registry and
+// never change during a session, so this is computed once per definition.
+struct ShaderPropertyInfo
+{
+    PXR_NS::SdrShaderPropertyConstPtr property;
+    PXR_NS::UsdShadeAttributeType     attrType;
+    Ufe::Attribute::Type              ufeType;
+};
+
+struct ShaderNodeInfo
+{
+    std::vector<std::string>                            names;
+    std::unordered_map<std::string, ShaderPropertyInfo> properties;
+};
+
+const ShaderNodeInfo& _GetShaderNodeInfo(PXR_NS::SdrShaderNodeConstPtr shaderNode)
 {
-    auto shaderNode = UsdShaderNodeDefHandler::usdDefinition(item);
-    if (shaderNode) {
-        auto baseNameAndType = PXR_NS::UsdShadeUtils::GetBaseNameAndType(PXR_NS::TfToken(tokName));
-        switch (baseNameAndType.second) {
-        case PXR_NS::UsdShadeAttributeType::Invalid: return { nullptr, baseNameAndType.second };
-        case PXR_NS::UsdShadeAttributeType::Input:
-            return { shaderNode->GetShaderInput(baseNameAndType.first), baseNameAndType.second };
-        case PXR_NS::UsdShadeAttributeType::Output:
-            return { shaderNode->GetShaderOutput(baseNameAndType.first), baseNameAndType.second };
+    static std::unordered_map<PXR_NS::SdrShaderNodeConstPtr, ShaderNodeInfo> cache;
+
+    auto found = cache.find(shaderNode);
+    if (found != cache.end())
+        return found->second;
+
+    ShaderNodeInfo& info = cache[shaderNode];
+    auto addProperties = [&info, shaderNode](
+                             auto const& shortNames, PXR_NS::UsdShadeAttributeType attrType) {
+        for (auto const& shortName : shortNames) {
+            PXR_NS::SdrShaderPropertyConstPtr property
+                = (attrType == PXR_NS::UsdShadeAttributeType::Input)
+                ? shaderNode->GetShaderInput(shortName)
+                : shaderNode->GetShaderOutput(shortName);
+            std::string name = PXR_NS::UsdShadeUtils::GetFullName(shortName, attrType);
+            info.names.push_back(name);
+            if (property) {
+                info.properties.emplace(
+                    std::move(name),
+                    ShaderPropertyInfo { property, attrType, usdTypeToUfe(property) });
+            }
         }
-    }
-    return { nullptr, PXR_NS::UsdShadeAttributeType::Invalid };
+    };
+    addProperties(shaderNode->GetInputNames(), PXR_NS::UsdShadeAttributeType::Input);
+    addProperties(shaderNode->GetOutputNames(), PXR_NS::UsdShadeAttributeType::Output);
+    return info;
+}
+
+const ShaderPropertyInfo*
+_GetShaderPropertyInfo(PXR_NS::SdrShaderNodeConstPtr shaderNode, const std::string& name)
+{
+    if (!shaderNode)
+        return nullptr;
+
+    const ShaderNodeInfo& info = _GetShaderNodeInfo(shaderNode);
+    auto                  found = info.properties.find(name);
+    return (found != info.properties.end()) ? &found->second : nullptr;
 }
 #endif
 #endif
+
+// The schema attributes of a prim definition, with their UFE types filled on
+// demand. Prim definitions are owned by the schema registry and shared by all
+// the prims with the same type and applied schemas.
+struct SchemaInfo
+{
+    PXR_NS::TfToken::HashSet attributeNames;
+    std::unordered_map<PXR_NS::TfToken, Ufe::Attribute::Type, PXR_NS::TfToken::HashFunctor>
+        types;
+};
+
+SchemaInfo& _GetSchemaInfo(const PXR_NS::UsdPrimDefinition& primDef)
+{
+    static std::unordered_map<const PXR_NS::UsdPrimDefinition*, SchemaInfo> cache;
+
+    auto found = cache.find(&primDef);
+    if (found != cache.end())
+        return found->second;
+
+    SchemaInfo& info = cache[&primDef];
+    for (const auto& propName : primDef.GetPropertyNames()) {
+        if (primDef.GetSchemaAttributeSpec(propName))
+            info.attributeNames.insert(propName);
+    }
+    return info;
+}
+
+Ufe::Attribute::Type _GetUfeType(const PXR_NS::UsdAttribute& usdAttr)
+{
+    SchemaInfo&            info = _GetSchemaInfo(usdAttr.GetPrim().GetPrimDefinition());
+    const PXR_NS::TfToken& name = usdAttr.GetName();
+
+    auto found = info.types.find(name);
+    if (found != info.types.end())
+        return found->second;
+
+    const Ufe::Attribute::Type type = usdTypeToUfe(usdAttr);
+    if (info.attributeNames.count(name) > 0)
+        info.types[name] = type;
+    return type;
+}
 } // namespace
 
 UsdAttributes::UsdAttributes(const UsdSceneItem::Ptr& item)
@@ -129,18 +213,16 @@ Ufe::Attribute::Type UsdAttributes::attributeType(const std::string& name)
         // Shader definitions always win over created UsdAttributes:
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
-    PXR_NS::SdrShaderPropertyConstPtr shaderProp = _GetSdrPropertyAndType(fItem, name).first;
-    if (shaderProp) {
-        return UsdShaderAttributeDef(shaderProp).type();
+    if (auto shaderProp = _GetShaderPropertyInfo(shaderNode(), name)) {
+        return shaderProp->ufeType;
     }
 #endif
 #endif
 
     // See if a UsdAttribute can be wrapped:
-    PXR_NS::TfToken      tok(name);
     PXR_NS::UsdAttribute usdAttr = _GetAttributeType(fPrim, name);
     if (usdAttr.IsValid()) {
-        return usdTypeToUfe(usdAttr);
+        return _GetUfeType(usdAttr);
     }
     return Ufe::Attribute::kInvalid;
 }
@@ -215,15 +297,14 @@ Ufe::Attribute::Ptr UsdAttributes::attribute(const std::string& name)
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
     // The shader definition always wins over a created attribute:
-    auto shaderPropAndType = _GetSdrPropertyAndType(fItem, name);
-    if (shaderPropAndType.first) {
-        auto ctorIt = ctorMap.find(usdTypeToUfe(shaderPropAndType.first));
+    if (auto shaderProp = _GetShaderPropertyInfo(shaderNode(), name)) {
+        auto ctorIt = ctorMap.find(shaderProp->ufeType);
         UFE_ASSERT_MSG(ctorIt != ctorMap.end(), kErrorMsgUnknown);
         if (ctorIt != ctorMap.end()) {
             newAttr = ctorIt->second(
                 fItem,
                 UsdShaderAttributeHolder::create(
-                    fPrim, shaderPropAndType.first, shaderPropAndType.second));
+                    fPrim, shaderProp->property, shaderProp->attrType));
         }
     }
 #endif
@@ -231,12 +312,11 @@ Ufe::Attribute::Ptr UsdAttributes::attribute(const std::string& name)
 
     if (!newAttr) {
         // No attribute for the input name was found -> create one.
-        PXR_NS::TfToken      tok(name);
         PXR_NS::UsdAttribute usdAttr = _GetAttributeType(fPrim, name);
         if (!usdAttr.IsValid()) {
             return nullptr;
         }
-        Ufe::Attribute::Type newAttrType = usdTypeToUfe(usdAttr);
+        Ufe::Attribute::Type newAttrType = _GetUfeType(usdAttr);
 
         auto ctorIt = ctorMap.find(newAttrType);
         UFE_ASSERT_MSG(ctorIt != ctorMap.end(), kErrorMsgUnknown);
@@ -259,33 +339,34 @@ Ufe::Attribute::Ptr UsdAttributes::attribute(const std::string& name)
 std::vector<std::string> UsdAttributes::attributeNames() const
 {
     std::vector<std::string> names;
-    std::set<std::string>    nameSet;
-    std::string              name;
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
-    PXR_NS::SdrShaderNodeConstPtr shaderNode = UsdShaderNodeDefHandler::usdDefinition(fItem);
-    if (shaderNode) {
-        auto addAttributeNames
-            = [&names, &nameSet, &name](
-                  auto const& shortNames, PXR_NS::UsdShadeAttributeType attrType) {
-                  for (auto const& shortName : shortNames) {
-                      name = PXR_NS::UsdShadeUtils::GetFullName(shortName, attrType);
-                      names.push_back(name);
-                      nameSet.insert(name);
-                  }
-              };
-        addAttributeNames(shaderNode->GetInputNames(), PXR_NS::UsdShadeAttributeType::Input);
-        addAttributeNames(shaderNode->GetOutputNames(), PXR_NS::UsdShadeAttributeType::Output);
+    const ShaderNodeInfo* shaderInfo = nullptr;
+    if (PXR_NS::SdrShaderNodeConstPtr node = shaderNode()) {
+        shaderInfo = &_GetShaderNodeInfo(node);
+        names = shaderInfo->names;
     }
 #endif
 #endif
     if (fPrim) {
-        auto primAttrs = fPrim.GetAttributes();
-        for (const auto& attr : primAttrs) {
-            name = attr.GetName();
-            if (nameSet.find(name) == nameSet.end()) {
-                names.push_back(name);
+        const SchemaInfo& schemaInfo = _GetSchemaInfo(fPrim.GetPrimDefinition());
+        for (const auto& propName : fPrim.GetPropertyNames()) {
+            // Only wrap the property to find out whether it is an attribute
+            // when it is not a schema attribute.
+            if (schemaInfo.attributeNames.count(propName) == 0
+                && !fPrim.GetAttribute(propName).IsValid()) {
+                continue;
             }
+#ifdef UFE_V4_FEATURES_AVAILABLE
+#if (UFE_PREVIEW_VERSION_NUM >= 4010)
+            if (shaderInfo
+                && shaderInfo->properties.find(propName.GetString())
+                    != shaderInfo->properties.end()) {
+                continue;
+            }
+#endif
+#endif
+            names.push_back(propName.GetString());
         }
     }
     return names;
@@ -299,7 +380,7 @@ bool UsdAttributes::hasAttribute(const std::string& name) const
     }
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
-    if (_GetSdrPropertyAndType(fItem, name).first) {
+    if (_GetShaderPropertyInfo(shaderNode(), name)) {
         return true;
     }
 #endif
@@ -307,6 +388,19 @@ bool UsdAttributes::hasAttribute(const std::string& name) const
     return false;
 }
 
+#ifdef UFE_V4_FEATURES_AVAILABLE
+#if (UFE_PREVIEW_VERSION_NUM >= 4010)
+PXR_NS::SdrShaderNodeConstPtr UsdAttributes::shaderNode() const
+{
+    if (!fShaderNodeResolved) {
+        fShaderNode = UsdShaderNodeDefHandler::usdDefinition(fItem);
+        fShaderNodeResolved = true;
+    }
+    return fShaderNode;
+}
+#endif
+#endif
+
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4024)
 #if (UFE_PREVIEW_VERSION_NUM >= 4034)
@@ -24,6 +24,8 @@
 #include <ufe/attributes.h>
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #if (UFE_PREVIEW_VERSION_NUM >= 4010)
+#include <pxr/usd/sdr/shaderNode.h>
+
 #include <ufe/nodeDef.h>
 #endif
 #endif
@@ -102,6 +104,16 @@ public:
 #endif
 
 private:
+#ifdef UFE_V4_FEATURES_AVAILABLE
+#if (UFE_PREVIEW_VERSION_NUM >= 4010)
+    // Shader node definition of the prim, looked up on first use.
+    PXR_NS::SdrShaderNodeConstPtr shaderNode() const;
+
+    mutable PXR_NS::SdrShaderNodeConstPtr fShaderNode = nullptr;
+    mutable bool                          fShaderNodeResolved = false;
+#endif
+#endif
+
     UsdSceneItem::Ptr fItem;
     PXR_NS::UsdPrim   fPrim;
 
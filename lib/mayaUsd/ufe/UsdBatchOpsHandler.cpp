@@ -33,6 +33,27 @@ UsdBatchOpsHandler::Ptr UsdBatchOpsHandler::create()
     return std::make_shared<UsdBatchOpsHandler>();
 }
 
+UsdUndoTransformSelectionCommand::Ptr
+UsdBatchOpsHandler::translateSelectionCmd(const Ufe::Selection& selection)
+{
+    return UsdUndoTransformSelectionCommand::create(
+        selection, UsdUndoTransformSelectionCommand::kTranslate);
+}
+
+UsdUndoTransformSelectionCommand::Ptr
+UsdBatchOpsHandler::rotateSelectionCmd(const Ufe::Selection& selection)
+{
+    return UsdUndoTransformSelectionCommand::create(
+        selection, UsdUndoTransformSelectionCommand::kRotate);
+}
+
+UsdUndoTransformSelectionCommand::Ptr
+UsdBatchOpsHandler::scaleSelectionCmd(const Ufe::Selection& selection)
+{
+    return UsdUndoTransformSelectionCommand::create(
+        selection, UsdUndoTransformSelectionCommand::kScale);
+}
+
 //------------------------------------------------------------------------------
 // Ufe::BatchOpsHandler overrides
 //------------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 //
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/ufe/UsdUndoTransformSelectionCommand.h>
 
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/types.h>
@@ -46,6 +47,18 @@ public:
     //! Create a UsdBatchOpsHandler.
     static UsdBatchOpsHandler::Ptr create();
 
+    //! Create a command translating all the items of the selection in a
+    //! single change block per manipulation step.
+    UsdUndoTransformSelectionCommand::Ptr translateSelectionCmd(const Ufe::Selection& selection);
+
+    //! Create a command rotating all the items of the selection in a
+    //! single change block per manipulation step.
+    UsdUndoTransformSelectionCommand::Ptr rotateSelectionCmd(const Ufe::Selection& selection);
+
+    //! Create a command scaling all the items of the selection in a
+    //! single change block per manipulation step.
+    UsdUndoTransformSelectionCommand::Ptr scaleSelectionCmd(const Ufe::Selection& selection);
+
     // Ufe::BatchOpsHandler overrides.
     Ufe::SelectionUndoableCommand::Ptr duplicateSelectionCmd_(
         const Ufe::Selection&       selection,
@@ -35,10 +35,16 @@
 #include <pxr/base/plug/plugin.h>
 #include <pxr/base/plug/registry.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/work/dispatcher.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/fileFormat.h>
+#include <pxr/usd/sdf/layerUtils.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/reference.h>
+#include <pxr/usd/sdf/variantSetSpec.h>
+#include <pxr/usd/sdf/variantSpec.h>
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/sdr/shaderNode.h>
 #include <pxr/usd/sdr/shaderProperty.h>
@@ -63,11 +69,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_PREFETCH_VARIANT_LAYERS,
+    false,
+    "When set, the layers referenced by the variants of a variant set are opened in the "
+    "background when the context menu lists them, so that switching variants does not "
+    "wait for them to be read.");
+
 namespace {
 
 // Ufe::ContextItem strings
@@ -395,6 +409,104 @@ public:
     }
 };
 
+//! \brief Opens in the background the layers referenced by the variants of a
+//         variant set, and holds them until another variant set is prefetched.
+class VariantLayersPrefetcher
+{
+public:
+    static VariantLayersPrefetcher& instance()
+    {
+        static VariantLayersPrefetcher prefetcher;
+        return prefetcher;
+    }
+
+    void prefetch(const UsdPrim& prim, const std::string& varSetName)
+    {
+        if (!TfGetEnvSetting(MAYAUSD_PREFETCH_VARIANT_LAYERS)) {
+            return;
+        }
+
+        const std::string key = prim.GetPath().GetString() + "{" + varSetName + "}";
+        if (prim.GetStage() == _stage && key == _key) {
+            return;
+        }
+
+        // Release the layers of the previous variant set.
+        _dispatcher.Wait();
+        _layers.clear();
+        _stage = prim.GetStage();
+        _key = key;
+
+        std::vector<std::string> layerPaths;
+        for (const SdfPrimSpecHandle& primSpec : prim.GetPrimStack()) {
+            const SdfVariantSetsProxy varSets = primSpec->GetVariantSets();
+            const auto                varSetIt = varSets.find(varSetName);
+            if (varSetIt == varSets.end()) {
+                continue;
+            }
+            for (const SdfVariantSpecHandle& variant : varSetIt->second->GetVariantList()) {
+                _collectLayerPaths(variant->GetPrimSpec(), layerPaths);
+            }
+        }
+
+        for (const std::string& layerPath : layerPaths) {
+            _dispatcher.Run([this, layerPath]() { _prefetchLayer(layerPath); });
+        }
+    }
+
+private:
+    // Collect the assets referenced by the prim spec and its descendants.
+    static void
+    _collectLayerPaths(const SdfPrimSpecHandle& primSpec, std::vector<std::string>& layerPaths)
+    {
+        if (!primSpec) {
+            return;
+        }
+
+        const SdfLayerHandle layer = primSpec->GetLayer();
+        auto                 addPath = [&layer, &layerPaths](const std::string& assetPath) {
+            if (!assetPath.empty()) {
+                layerPaths.push_back(SdfComputeAssetPathRelativeToLayer(layer, assetPath));
+            }
+        };
+        for (const SdfReference& ref : primSpec->GetReferenceList().GetAddedOrExplicitItems()) {
+            addPath(ref.GetAssetPath());
+        }
+        for (const SdfPayload& payload : primSpec->GetPayloadList().GetAddedOrExplicitItems()) {
+            addPath(payload.GetAssetPath());
+        }
+        for (const SdfPrimSpecHandle& child : primSpec->GetNameChildren()) {
+            _collectLayerPaths(child, layerPaths);
+        }
+    }
+
+    // Open the layer and, on other tasks of the dispatcher, its sublayers.
+    void _prefetchLayer(const std::string& layerPath)
+    {
+        SdfLayerRefPtr layer = SdfLayer::FindOrOpen(layerPath);
+        if (!layer) {
+            return;
+        }
+
+        for (const std::string& sublayerPath : layer->GetSubLayerPaths()) {
+            const std::string path = SdfComputeAssetPathRelativeToLayer(layer, sublayerPath);
+            _dispatcher.Run([this, path]() { _prefetchLayer(path); });
+        }
+
+        std::lock_guard<std::mutex> lock(_layersMutex);
+        _layers.push_back(layer);
+    }
+
+    UsdStageWeakPtr _stage;
+    std::string     _key;
+
+    // The dispatcher is declared last so that its tasks are waited for before
+    // the layers are destroyed.
+    std::vector<SdfLayerRefPtr> _layers;
+    std::mutex                  _layersMutex;
+    WorkDispatcher              _dispatcher;
+};
+
 //! \brief Undoable command for variant selection change
 class SetVariantSelectionUndoableCommand : public Ufe::UndoableCommand
 {
@@ -432,6 +544,10 @@ public:
         // Filter the global selection, removing items below our prim.
         globalSn->replaceWith(MayaUsd::ufe::removeDescendants(_savedSn, _path));
         _varSet.SetVariantSelection(_newSelection);
+
+        // Keep the layers of the other variants, including the one that was
+        // just switched off, ready for toggling back.
+        VariantLayersPrefetcher::instance().prefetch(_varSet.GetPrim(), _varSet.GetName());
     }
 
 private:
@@ -1004,6 +1120,10 @@ Ufe::ContextOps::Items UsdContextOps::getItems(const Ufe::ContextOps::ItemPath&
                 UsdVariantSet varSet = varSets.GetVariantSet(itemPath[1]);
                 auto          selected = varSet.GetVariantSelection();
 
+                // Start reading the layers of the variants while the user
+                // picks one.
+                VariantLayersPrefetcher::instance().prefetch(prim(), itemPath[1]);
+
                 const auto varNames = varSet.GetVariantNames();
                 for (const auto& vn : varNames) {
                     const bool checked(vn == selected);
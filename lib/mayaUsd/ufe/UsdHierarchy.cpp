@@ -21,6 +21,7 @@
 #include <mayaUsd/ufe/Utils.h>
 #include <mayaUsdUtils/util.h>
 
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/layer.h>
@@ -34,9 +35,12 @@
 #include <ufe/scene.h>
 #include <ufe/sceneNotification.h>
 
+#include <algorithm>
 #include <cassert>
+#include <map>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #ifdef UFE_V2_FEATURES_AVAILABLE
 #include <mayaUsd/ufe/UsdUndoCreateGroupCommand.h>
@@ -53,6 +57,12 @@
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_UFE_CACHE_CHILDREN,
+    false,
+    "Cache the children lists returned by the USD UFE hierarchy, so that the Outliner does not "
+    "rebuild the scene items of all the siblings of a prim on every redraw.");
+
 namespace {
 
 // We want to display the unloaded prims, so removed UsdPrimIsLoaded from
@@ -121,6 +131,26 @@ UsdPrimSiblingRange getUSDFilteredChildren(
     //
     return prim.GetFilteredChildren(UsdTraverseInstanceProxies(pred));
 }
+
+// Cached children of a prim: one list with the inactive prims filtered out,
+// and one list with them.
+struct ChildrenCacheEntry
+{
+    Ufe::Path          parentPath;
+    Ufe::SceneItemList children[2];
+    bool               valid[2] { false, false };
+};
+
+// Children lists cached per stage, then per prim path. The prim paths are
+// sorted so that the entries of a whole subtree are contiguous.
+using StageChildrenCache = std::map<SdfPath, ChildrenCacheEntry>;
+std::unordered_map<const UsdStage*, StageChildrenCache> childrenCache;
+
+bool isChildrenCacheEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(MAYAUSD_UFE_CACHE_CHILDREN);
+    return enabled;
+}
 } // namespace
 
 namespace MAYAUSD_NS_DEF {
@@ -189,9 +219,103 @@ bool UsdHierarchy::hasChildren() const
 
 #endif
 
+/*static*/
+void UsdHierarchy::invalidateChildrenCache(
+    const UsdStageWeakPtr& stage,
+    const SdfPath&         path,
+    bool                   subtree)
+{
+    if (childrenCache.empty() || !stage)
+        return;
+
+    auto found = childrenCache.find(get_pointer(stage));
+    if (found == childrenCache.end())
+        return;
+
+    StageChildrenCache& stageCache = found->second;
+    if (!path.IsAbsoluteRootPath())
+        stageCache.erase(path.GetParentPath());
+
+    if (subtree) {
+        auto it = stageCache.lower_bound(path);
+        while (it != stageCache.end() && it->first.HasPrefix(path))
+            it = stageCache.erase(it);
+    } else {
+        stageCache.erase(path);
+    }
+
+    if (stageCache.empty())
+        childrenCache.erase(found);
+}
+
+/*static*/
+void UsdHierarchy::clearChildrenCache() { childrenCache.clear(); }
+
+const Ufe::SceneItemList* UsdHierarchy::cachedChildren(bool filterInactive) const
+{
+    // Point instances are child-less, no need to cache anything for them.
+    const UsdPrim& prim = fItem->prim();
+    if (!isChildrenCacheEnabled() || fItem->isPointInstance() || !prim.IsValid())
+        return nullptr;
+
+    // The cache is invalidated by the StagesSubject from the USD notices. The
+    // UFE path of the parent is checked since the same stage can be reached
+    // from another proxy shape path, e.g. after a rename.
+    ChildrenCacheEntry& entry = childrenCache[get_pointer(prim.GetStage())][prim.GetPath()];
+    if (entry.parentPath != fItem->path()) {
+        entry = ChildrenCacheEntry();
+        entry.parentPath = fItem->path();
+    }
+
+    const int index = filterInactive ? 0 : 1;
+    if (!entry.valid[index]) {
+        entry.children[index] = getChildren(filterInactive, false /*useCache*/);
+        entry.valid[index] = true;
+    }
+    return &entry.children[index];
+}
+
+Ufe::SceneItemList UsdHierarchy::getChildren(bool filterInactive, bool useCache) const
+{
+    if (useCache) {
+        if (auto children = cachedChildren(filterInactive))
+            return *children;
+    }
+
+    // See uniqueChildName() for explanation of USD filter predicate.
+    const Usd_PrimFlagsPredicate flags
+        = filterInactive ? MayaUsdPrimDefaultPredicate : UsdPrimIsDefined && !UsdPrimIsAbstract;
+    return createUFEChildList(getUSDFilteredChildren(fItem, flags), filterInactive);
+}
+
+size_t UsdHierarchy::numChildren() const
+{
+    if (auto children = cachedChildren(true /*filterInactive*/))
+        return children->size();
+
+    return getChildren(true /*filterInactive*/, false /*useCache*/).size();
+}
+
+Ufe::SceneItemList UsdHierarchy::children(size_t first, size_t count) const
+{
+    Ufe::SceneItemList        uncached;
+    const Ufe::SceneItemList* allChildren = cachedChildren(true /*filterInactive*/);
+    if (!allChildren) {
+        uncached = getChildren(true /*filterInactive*/, false /*useCache*/);
+        allChildren = &uncached;
+    }
+
+    if (first >= allChildren->size())
+        return Ufe::SceneItemList();
+
+    auto begin = std::next(allChildren->begin(), first);
+    auto end = std::next(begin, std::min(count, allChildren->size() - first));
+    return Ufe::SceneItemList(begin, end);
+}
+
 Ufe::SceneItemList UsdHierarchy::children() const
 {
-    return createUFEChildList(getUSDFilteredChildren(fItem), true /*filterInactive*/);
+    return getChildren(true /*filterInactive*/, true /*useCache*/);
 }
 
 #ifdef UFE_V2_FEATURES_AVAILABLE
@@ -200,11 +324,8 @@ Ufe::SceneItemList UsdHierarchy::filteredChildren(const ChildFilter& childFilter
     // Note: for now the only child filter flag we support is "Inactive Prims".
     //       See UsdHierarchyHandler::childFilter()
     if ((childFilter.size() == 1) && (childFilter.front().name == "InactivePrims")) {
-        // See uniqueChildName() for explanation of USD filter predicate.
-        const bool             showInactive = childFilter.front().value;
-        Usd_PrimFlagsPredicate flags
-            = showInactive ? UsdPrimIsDefined && !UsdPrimIsAbstract : MayaUsdPrimDefaultPredicate;
-        return createUFEChildList(getUSDFilteredChildren(fItem, flags), !showInactive);
+        const bool showInactive = childFilter.front().value;
+        return getChildren(!showInactive, true /*useCache*/);
     }
 
     UFE_LOG("Unknown child filter");
@@ -19,6 +19,9 @@
 #include <mayaUsd/ufe/UfeVersionCompat.h>
 #include <mayaUsd/ufe/UsdSceneItem.h>
 
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/common.h>
+
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
 #include <ufe/selection.h>
@@ -59,6 +62,23 @@ public:
 
     UsdSceneItem::Ptr usdSceneItem() const;
 
+    //! Return the number of children, as returned by children().
+    size_t numChildren() const;
+
+    //! Return at most \p count children, starting with the child at index \p first
+    //! in the list returned by children().
+    Ufe::SceneItemList children(size_t first, size_t count) const;
+
+    //! Drop the cached children lists invalidated by a change to the prim at \p path:
+    //! the ones of its parent, and the ones of its whole subtree if \p subtree is true.
+    static void invalidateChildrenCache(
+        const PXR_NS::UsdStageWeakPtr& stage,
+        const PXR_NS::SdfPath&         path,
+        bool                           subtree);
+
+    //! Drop all the cached children lists.
+    static void clearChildrenCache();
+
     // Ufe::Hierarchy overrides
     Ufe::SceneItem::Ptr sceneItem() const override;
     bool                hasChildren() const override;
@@ -102,6 +122,14 @@ private:
     Ufe::SceneItemList
     createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
 
+    // Return the children, from the cache if \p useCache is true and MAYAUSD_UFE_CACHE_CHILDREN
+    // is enabled.
+    Ufe::SceneItemList getChildren(bool filterInactive, bool useCache) const;
+
+    // Return the cached children, filling the cache if needed, or nullptr when the
+    // children are not cached.
+    const Ufe::SceneItemList* cachedChildren(bool filterInactive) const;
+
 private:
     UsdSceneItem::Ptr fItem;
 
@@ -118,7 +118,8 @@ Ufe::Path UsdPathMappingHandler::fromHost(const Ufe::Path& hostPath) const
     }
 
     // If nothing has been pulled, then there is no mapping to be done.
-    if (!PXR_NS::PrimUpdaterManager::getInstance().hasPulledPrims()) {
+    auto& primUpdaterManager = PXR_NS::PrimUpdaterManager::getInstance();
+    if (!primUpdaterManager.hasPulledPrims()) {
         return {};
     }
 
@@ -128,6 +129,8 @@ Ufe::Path UsdPathMappingHandler::fromHost(const Ufe::Path& hostPath) const
     auto      dagPath = PXR_NS::UsdMayaUtil::nameToDagPath(hostPath.popHead().string());
 
     // Iterate over the dagpath (and its ancestors) looking for any pulled info.
+    // The pulled paths are tracked by the prim updater manager, so this does
+    // not read the pull information attribute of each ancestor.
     // We keep an array of the Maya node names so we can create a Ufe::PathSegment.
     // We build this array in backwards order (and then reverse it) to maintain a
     // constant time complexity (for addition).
@@ -138,7 +141,7 @@ Ufe::Path UsdPathMappingHandler::fromHost(const Ufe::Path& hostPath) const
         mayaComps.emplace_back(mayaHostPath.back());
         mayaHostPath = mayaHostPath.pop();
         Ufe::Path ufePath;
-        if (MAYAUSD_NS_DEF::readPullInformation(dagPath, ufePath)) {
+        if (primUpdaterManager.findPulledPath(dagPath, ufePath)) {
             // From the pulled info path, we pop only the last component and
             // append the Maya component array.
             std::reverse(mayaComps.begin(), mayaComps.end());
@@ -49,6 +49,14 @@ template <class UsdValueType> struct MAYAUSD_CORE_PUBLIC UsdPointInstanceBatch
     inline bool isWriter() const { return ((count + 1) % nbInstances) == 0; }
 
     PXR_NS::VtArray<UsdValueType> usdValues;
+    // Attribute validated by the reader of an execution of the batch, and
+    // written by its writer.
+    PXR_NS::UsdAttribute usdAttr;
+    // Values read once for all the instances joining the batch, so that each of
+    // them only keeps its own value for undo.  Released when the batch closes.
+    PXR_NS::VtArray<UsdValueType> initialValues;
+    PXR_NS::UsdTimeCode           initialTime;
+    bool                          hasInitialValues { false };
     // Number of instances in the batch.  Incremented by
     // UsdPointInstanceModifierBase::joinBatch().
     unsigned int nbInstances { 0 };
@@ -163,6 +171,36 @@ public:
 #endif
     }
 
+    // Same as getUsdValue(), but once the modifier has joined a batch, the
+    // attribute is read only once for all the modifiers of the batch.
+    UsdValueType getBatchUsdValue(PXR_NS::UsdTimeCode usdTime = PXR_NS::UsdTimeCode::Default())
+    {
+        if (!_batch) {
+            return getUsdValue(usdTime);
+        }
+
+        if (!_batch->hasInitialValues || _batch->initialTime != usdTime) {
+            _batch->initialValues = PXR_NS::VtArray<UsdValueType>();
+            PXR_NS::UsdAttribute usdAttr = _getAttribute();
+            if (!usdAttr || !usdAttr.Get(&_batch->initialValues, usdTime)) {
+                _batch->initialValues.clear();
+            }
+            _batch->initialTime = usdTime;
+            _batch->hasInitialValues = true;
+        }
+
+        if (_instanceIndex < 0
+            || static_cast<size_t>(_instanceIndex) >= _batch->initialValues.size()) {
+            return this->getDefaultUsdValue();
+        }
+
+#if PXR_VERSION >= 2102
+        return _batch->initialValues.AsConst()[static_cast<size_t>(_instanceIndex)];
+#else
+        return _batch->initialValues[static_cast<size_t>(_instanceIndex)];
+#endif
+    }
+
     bool setValue(
         const UfeValueType& ufeValue,
         PXR_NS::UsdTimeCode usdTime = PXR_NS::UsdTimeCode::Default())
@@ -197,17 +235,26 @@ public:
         const bool writer = _batch->isWriter();
         _batch->count++;
 
-        if (reader || writer) {
-            usdAttr = _getOrCreateAttribute();
+        // Validate the attribute once per execution of the batch: the writer
+        // reuses the attribute of the reader.
+        if (reader) {
+            _batch->initialValues = PXR_NS::VtArray<UsdValueType>();
+            _batch->hasInitialValues = false;
+
+            _batch->usdAttr = _getOrCreateAttribute();
+            usdAttr = _batch->usdAttr;
             if (!usdAttr) {
                 return false;
             }
-        }
 
-        if (reader) {
             if (!usdAttr.Get(&_batch->usdValues, usdTime)) {
                 return false;
             }
+        } else if (writer) {
+            usdAttr = _batch->usdAttr;
+            if (!usdAttr) {
+                return false;
+            }
         }
 
         if (instanceIndex >= _batch->usdValues.size()) {
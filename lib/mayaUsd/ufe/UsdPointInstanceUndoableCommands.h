@@ -64,7 +64,7 @@ public:
         // batch the reads and writes, for efficiency.
         _modifier.joinBatch();
 
-        _prevValue = _modifier.getUsdValue(_readTime);
+        _prevValue = _modifier.getBatchUsdValue(_readTime);
         _newValue = _prevValue;
     }
 
@@ -36,6 +36,8 @@
 #include <ufe/runTimeMgr.h>
 
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
@@ -228,7 +230,10 @@ Ufe::AttributeDef::ConstPtr UsdShaderNodeDef::input(const std::string& name) con
 Ufe::ConstAttributeDefs UsdShaderNodeDef::inputs() const
 {
     TF_AXIOM(fShaderNodeDef);
-    return getAttrs<Ufe::AttributeDef::INPUT_ATTR>(fShaderNodeDef);
+    std::call_once(fInputsOnce, [this]() {
+        fInputs = getAttrs<Ufe::AttributeDef::INPUT_ATTR>(fShaderNodeDef);
+    });
+    return fInputs;
 }
 
 std::vector<std::string> UsdShaderNodeDef::outputNames() const
@@ -261,7 +266,10 @@ Ufe::AttributeDef::ConstPtr UsdShaderNodeDef::output(const std::string& name) co
 Ufe::ConstAttributeDefs UsdShaderNodeDef::outputs() const
 {
     TF_AXIOM(fShaderNodeDef);
-    return getAttrs<Ufe::AttributeDef::OUTPUT_ATTR>(fShaderNodeDef);
+    std::call_once(fOutputsOnce, [this]() {
+        fOutputs = getAttrs<Ufe::AttributeDef::OUTPUT_ATTR>(fShaderNodeDef);
+    });
+    return fOutputs;
 }
 
 namespace {
@@ -353,15 +361,52 @@ Ufe::InsertChildCommand::Ptr UsdShaderNodeDef::createNodeCmd(
 }
 #endif
 
+namespace {
+// Sdr shader nodes are owned by the Sdr registry singleton and never change
+// once parsed, so the node definitions wrapping them are kept for the session.
+// Identifiers are not unique across source types, so the cache is keyed by the
+// Sdr node itself.
+std::mutex                                                       _nodeDefsMutex;
+std::unordered_map<SdrShaderNodeConstPtr, UsdShaderNodeDef::Ptr> _nodeDefs;
+} // namespace
+
 UsdShaderNodeDef::Ptr UsdShaderNodeDef::create(const SdrShaderNodeConstPtr& shaderNodeDef)
 {
+    if (!shaderNodeDef) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_nodeDefsMutex);
+
+    auto found = _nodeDefs.find(shaderNodeDef);
+    if (found != _nodeDefs.end()) {
+        return found->second;
+    }
+
     try {
-        return std::make_shared<UsdShaderNodeDef>(shaderNodeDef);
+        auto nodeDef = std::make_shared<UsdShaderNodeDef>(shaderNodeDef);
+        _nodeDefs.emplace(shaderNodeDef, nodeDef);
+        return nodeDef;
     } catch (const std::exception&) {
         return nullptr;
     }
 }
 
+void UsdShaderNodeDef::prefetchDefinitions(const TfToken& sourceType)
+{
+    SdrRegistry&        registry = SdrRegistry::GetInstance();
+    SdrShaderNodePtrVec shaderNodeDefs = registry.GetShaderNodesByFamily();
+    for (const SdrShaderNodeConstPtr& shaderNodeDef : shaderNodeDefs) {
+        if (!shaderNodeDef || shaderNodeDef->GetSourceType() != sourceType) {
+            continue;
+        }
+        if (UsdShaderNodeDef::Ptr nodeDef = create(shaderNodeDef)) {
+            nodeDef->inputs();
+            nodeDef->outputs();
+        }
+    }
+}
+
 Ufe::NodeDefs UsdShaderNodeDef::definitions(const std::string& category)
 {
     Ufe::NodeDefs result;
@@ -21,6 +21,8 @@
 
 #include <ufe/nodeDef.h>
 
+#include <mutex>
+
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
@@ -140,9 +142,14 @@ public:
     createNodeCmd(const Ufe::SceneItem::Ptr& parent, const Ufe::PathComponent& name) const override;
 #endif
 
-    //! Create a UsdShaderNodeDef.
+    //! Create a UsdShaderNodeDef. Node definitions are cached for the lifetime of
+    //! the Sdr registry, so the same object is returned for a given Sdr node.
     static Ptr create(const PXR_NS::SdrShaderNodeConstPtr& shaderNodeDef);
 
+    //! Create and cache the node definitions of the given Sdr source type,
+    //! converting their attribute definitions. Can be called from a worker thread.
+    static void prefetchDefinitions(const PXR_NS::TfToken& sourceType);
+
     //! Returns the node definitions that match the provided category.
     static Ufe::NodeDefs definitions(const std::string& category);
 
@@ -154,6 +161,12 @@ private:
 #if (UFE_PREVIEW_VERSION_NUM < 4010)
     const Ufe::ConstAttributeDefs fInputs;
     const Ufe::ConstAttributeDefs fOutputs;
+#else
+    // Converted on first use, as the node definitions are shared by all queries.
+    mutable std::once_flag          fInputsOnce;
+    mutable std::once_flag          fOutputsOnce;
+    mutable Ufe::ConstAttributeDefs fInputs;
+    mutable Ufe::ConstAttributeDefs fOutputs;
 #endif
 
 }; // UsdShaderNodeDef
@@ -20,15 +20,27 @@
 
 #include <mayaUsd/ufe/UsdSceneItem.h>
 
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/usdShade/shader.h>
 
+PXR_NAMESPACE_USING_DIRECTIVE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_PREFETCH_MATERIALX_NODEDEFS,
+    true,
+    "Parse the MaterialX shader node definitions on a worker thread when the plugin loads.");
+
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
 UsdShaderNodeDefHandler::UsdShaderNodeDefHandler()
     : Ufe::NodeDefHandler()
 {
+    if (TfGetEnvSetting(MAYAUSD_PREFETCH_MATERIALX_NODEDEFS)) {
+        fPrefetchDispatcher.Run([]() { UsdShaderNodeDef::prefetchDefinitions(TfToken("mtlx")); });
+    }
 }
 
 UsdShaderNodeDefHandler::~UsdShaderNodeDefHandler() { }
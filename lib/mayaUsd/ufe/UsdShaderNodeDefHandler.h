@@ -17,6 +17,7 @@
 
 #include <mayaUsd/base/api.h>
 
+#include <pxr/base/work/dispatcher.h>
 #include <pxr/usd/sdr/shaderNode.h>
 
 #include <ufe/nodeDefHandler.h>
@@ -59,6 +60,10 @@ public:
     // nullptr is returned.
     static PXR_NS::SdrShaderNodeConstPtr usdDefinition(const Ufe::SceneItem::Ptr& item);
 
+private:
+    // Populates the MaterialX node definitions in the background at plugin load.
+    PXR_NS::WorkDispatcher fPrefetchDispatcher;
+
 }; // UsdShaderNodeDefHandler
 
 } // namespace ufe
@@ -27,6 +27,7 @@
 #endif
 
 #include <cassert>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -133,7 +134,7 @@ void UsdStageMap::addItem(const Ufe::Path& path)
         return;
     }
 
-    fPathToObject[path] = proxyShape;
+    fPathToObject[path] = { proxyShape, fDagGeneration };
     fStageToObject[stage] = proxyShape;
 }
 
@@ -144,6 +145,18 @@ UsdStageWeakPtr UsdStageMap::stage(const Ufe::Path& path)
     return objToStage(obj);
 }
 
+bool UsdStageMap::validate(const Ufe::Path& path, PathEntry& entry) const
+{
+    if (entry.generation == fDagGeneration)
+        return true;
+
+    if (firstPath(entry.object) != path)
+        return false;
+
+    entry.generation = fDagGeneration;
+    return true;
+}
+
 MObject UsdStageMap::proxyShape(const Ufe::Path& path)
 {
     rebuildIfDirty();
@@ -159,6 +172,8 @@ MObject UsdStageMap::proxyShape(const Ufe::Path& path)
     //    find that MObject. This indicates that the stage has been reparented
     //    and the old path has been used to search for the stage. In this case
     //    there is a cache hit when there should not be.
+    // Both scenarios can only happen after a Dag change, so entries validated
+    // since the last Dag change are returned as is.
 
     const auto& singleSegmentPath
         = nbPathSegments(path) == 1 ? path : Ufe::Path(path.getSegments()[0]);
@@ -171,25 +186,26 @@ MObject UsdStageMap::proxyShape(const Ufe::Path& path)
         // scan through all the entries in the cache and validate that the current
         // DAG path to the MObject matches the key Ufe::Path for the MObject in
         // the cache. When the don't match, update fPathToObject so that the key and
-        // the MObject are in sync again.
-        auto pathToObject = fPathToObject;
-        for (const auto& entry : pathToObject) {
-            const auto& cachedPath = entry.first;
-            const auto& cachedObject = entry.second;
-            // If the cached object itself is invalid then remove it from the map.
-            if (!cachedObject.isValid()) {
-                fPathToObject.erase(cachedPath);
-                continue;
+        // the MObject are in sync again. Entries validated since the last Dag
+        // change are known to be in sync.
+        std::vector<PathToObject::value_type> staleEntries;
+        for (auto it = fPathToObject.begin(); it != fPathToObject.end();) {
+            if (!it->second.object.isValid()) {
+                // If the cached object itself is invalid then remove it from the map.
+                it = fPathToObject.erase(it);
+            } else if (!validate(it->first, it->second)) {
+                // Key is stale.  Remove it from our cache, and add the new entry below.
+                staleEntries.emplace_back(*it);
+                it = fPathToObject.erase(it);
+            } else {
+                ++it;
             }
+        }
+        for (const auto& entry : staleEntries) {
             // Get the UFE path from the map value.
-            auto newPath = firstPath(cachedObject);
-            if (newPath != cachedPath) {
-                // Key is stale.  Remove it from our cache, and add the new entry.
-                auto count = fPathToObject.erase(cachedPath);
-                TF_AXIOM(count);
-                if (!newPath.empty())
-                    fPathToObject[newPath] = cachedObject;
-            }
+            auto newPath = firstPath(entry.second.object);
+            if (!newPath.empty())
+                fPathToObject[newPath] = { entry.second.object, fDagGeneration };
         }
 
         // Now that the cache is in a better state, attempt to find the searched for
@@ -214,20 +230,21 @@ MObject UsdStageMap::proxyShape(const Ufe::Path& path)
             }
         }
     } else {
-        auto object = iter->second;
+        auto& entry = iter->second;
         // If the cached object itself is invalid then remove it from the map.
-        if (!object.isValid()) {
-            fPathToObject.erase(singleSegmentPath);
+        if (!entry.object.isValid()) {
+            fPathToObject.erase(iter);
             return MObject();
         }
-        auto objectPath = firstPath(object);
-        if (objectPath != iter->first) {
+        if (!validate(iter->first, entry)) {
             // When we hit the cache and the key path doesn't match the current object path
             // we are in scenario 2. Update the entry in fPathToObject so that the key path
             // is the current object path.
-            fPathToObject.erase(singleSegmentPath);
+            auto object = entry.object;
+            auto objectPath = firstPath(object);
+            fPathToObject.erase(iter);
             if (!objectPath.empty())
-                fPathToObject[objectPath] = object;
+                fPathToObject[objectPath] = { object, fDagGeneration };
             TF_VERIFY(std::end(fPathToObject) == fPathToObject.find(singleSegmentPath));
             return MObject();
         }
@@ -235,7 +252,7 @@ MObject UsdStageMap::proxyShape(const Ufe::Path& path)
 
     // At this point the cache is rebuilt, so lookup failure means the object
     // doesn't exist.
-    return iter == std::end(fPathToObject) ? MObject() : iter->second.object();
+    return iter == std::end(fPathToObject) ? MObject() : iter->second.object.object();
 }
 
 MayaUsdProxyShapeBase* UsdStageMap::proxyShapeNode(const Ufe::Path& path)
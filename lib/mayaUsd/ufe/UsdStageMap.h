@@ -45,7 +45,9 @@ namespace ufe {
     underlying node, we store an MObjectHandle in the maps.
 
     The cache is refreshed on access to a stage given a path which cannot be
-    found.  In this way, the cache does not need to observe the Maya data
+    found, or whose entry may be stale.  Dag changes (see dagChanged()) only
+    bump a generation count, so that lookups between Dag changes are a single
+    hash map access.  In this way, the cache does not need to observe the Maya data
     model, and we avoid order of notification problems where one observer would
     need to access the cache before it is refreshed, since there is no
     guarantee on the order of notification of Ufe observers.  An earlier
@@ -91,17 +93,37 @@ public:
     //! Returns true if the stage map is dirty (meaning it needs to be filled in).
     bool isDirty() const { return fDirty; }
 
+    //! Notify the stage map that Dag nodes were added, deleted, renamed or
+    //! reparented.  The proxy shape paths are only validated again on their
+    //! next access after such a change.
+    void dagChanged() { ++fDagGeneration; }
+
 private:
     void addItem(const Ufe::Path& path);
     void rebuildIfDirty();
 
+    // Proxy shape object, and the Dag generation at which its path was last
+    // known to match its key in fPathToObject.
+    struct PathEntry
+    {
+        MObjectHandle object;
+        size_t        generation { 0 };
+    };
+
+    // Return true if the path of the entry object matches the argument path,
+    // updating the entry generation if so.
+    bool validate(const Ufe::Path& path, PathEntry& entry) const;
+
 private:
     // We keep two maps for fast lookup when there are many proxy shapes.
-    using PathToObject = std::unordered_map<Ufe::Path, MObjectHandle>;
+    using PathToObject = std::unordered_map<Ufe::Path, PathEntry>;
     using StageToObject = PXR_NS::TfHashMap<PXR_NS::UsdStageWeakPtr, MObjectHandle, PXR_NS::TfHash>;
     PathToObject  fPathToObject;
     StageToObject fStageToObject;
     bool          fDirty { true };
+    // Incremented on every Dag change.  Entries validated at the current
+    // generation are returned without computing their Dag path.
+    size_t fDagGeneration { 1 };
 
 }; // UsdStageMap
 
@@ -40,7 +40,9 @@
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
-UsdUndoDuplicateCommand::UsdUndoDuplicateCommand(const UsdSceneItem::Ptr& srcItem)
+UsdUndoDuplicateCommand::UsdUndoDuplicateCommand(
+    const UsdSceneItem::Ptr& srcItem,
+    TfToken::HashSet*        siblingNames)
 #if (UFE_PREVIEW_VERSION_NUM >= 4041)
     : Ufe::SceneItemResultUndoableCommand()
 #else
@@ -53,7 +55,16 @@ UsdUndoDuplicateCommand::UsdUndoDuplicateCommand(const UsdSceneItem::Ptr& srcIte
 
     ufe::applyCommandRestriction(srcPrim, "duplicate");
 
-    auto newName = uniqueChildName(parentPrim, srcPrim.GetName());
+    std::string newName;
+    if (siblingNames) {
+        newName = srcPrim.GetName().GetString();
+        if (siblingNames->count(srcPrim.GetName()) > 0) {
+            newName = uniqueName(*siblingNames, newName);
+        }
+        siblingNames->insert(TfToken(newName));
+    } else {
+        newName = uniqueChildName(parentPrim, srcPrim.GetName());
+    }
     _usdDstPath = parentPrim.GetPath().AppendChild(TfToken(newName));
 
     _srcLayer = srcPrim.GetStage()->GetEditTarget().GetLayer();
@@ -62,9 +73,10 @@ UsdUndoDuplicateCommand::UsdUndoDuplicateCommand(const UsdSceneItem::Ptr& srcIte
 
 UsdUndoDuplicateCommand::~UsdUndoDuplicateCommand() { }
 
-UsdUndoDuplicateCommand::Ptr UsdUndoDuplicateCommand::create(const UsdSceneItem::Ptr& srcItem)
+UsdUndoDuplicateCommand::Ptr
+UsdUndoDuplicateCommand::create(const UsdSceneItem::Ptr& srcItem, TfToken::HashSet* siblingNames)
 {
-    return std::make_shared<UsdUndoDuplicateCommand>(srcItem);
+    return std::make_shared<UsdUndoDuplicateCommand>(srcItem, siblingNames);
 }
 
 UsdSceneItem::Ptr UsdUndoDuplicateCommand::duplicatedItem() const
@@ -79,27 +91,43 @@ void UsdUndoDuplicateCommand::execute()
 
     UsdUndoBlock undoBlock(&_undoableItem);
 
+    MayaUsd::ufe::ReplicateExtrasToUSD extras;
+    prepareDuplicate(extras);
+    copySpec();
+    finalizeDuplicate(extras);
+}
+
+void UsdUndoDuplicateCommand::prepareDuplicate(const ReplicateExtrasToUSD& extras)
+{
     auto prim = ufePathToPrim(_ufeSrcPath);
-    auto path = prim.GetPath();
     auto stage = prim.GetStage();
 
-    auto                               item = Ufe::Hierarchy::createItem(_ufeSrcPath);
-    MayaUsd::ufe::ReplicateExtrasToUSD extras;
+    auto item = Ufe::Hierarchy::createItem(_ufeSrcPath);
     extras.initRecursive(item);
 
     // The loaded state of a model is controlled by the load rules of the stage.
     // When duplicating a node, we want the new node to be in the same loaded
     // state.
-    duplicateLoadRules(*stage, path, _usdDstPath);
+    duplicateLoadRules(*stage, prim.GetPath(), _usdDstPath);
+}
 
-    bool retVal = PXR_NS::SdfCopySpec(_srcLayer, path, _dstLayer, _usdDstPath);
+void UsdUndoDuplicateCommand::copySpec()
+{
+    auto srcPath = ufePathToPrim(_ufeSrcPath).GetPath();
+    bool retVal = PXR_NS::SdfCopySpec(_srcLayer, srcPath, _dstLayer, _usdDstPath);
     TF_VERIFY(
         retVal,
         "Failed to copy spec data at '%s' to '%s'",
-        prim.GetPath().GetText(),
+        srcPath.GetText(),
         _usdDstPath.GetText());
+}
+
+void UsdUndoDuplicateCommand::finalizeDuplicate(const ReplicateExtrasToUSD& extras)
+{
+    auto prim = ufePathToPrim(_ufeSrcPath);
+    auto path = prim.GetPath();
 
-    extras.finalize(MayaUsd::ufe::stagePath(stage), &path, &_usdDstPath);
+    extras.finalize(MayaUsd::ufe::stagePath(prim.GetStage()), &path, &_usdDstPath);
 }
 
 void UsdUndoDuplicateCommand::undo()
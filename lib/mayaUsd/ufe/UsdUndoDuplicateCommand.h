@@ -23,6 +23,7 @@
 #include <mayaUsd/undo/UsdUndoableItem.h>
 #endif
 
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/path.h>
 
 #include <ufe/path.h>
@@ -31,6 +32,8 @@
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
+class ReplicateExtrasToUSD;
+
 //! \brief UsdUndoDuplicateCommand
 #if (UFE_PREVIEW_VERSION_NUM >= 4041)
 class MAYAUSD_CORE_PUBLIC UsdUndoDuplicateCommand : public Ufe::SceneItemResultUndoableCommand
@@ -41,7 +44,9 @@ class MAYAUSD_CORE_PUBLIC UsdUndoDuplicateCommand : public Ufe::UndoableCommand
 public:
     typedef std::shared_ptr<UsdUndoDuplicateCommand> Ptr;
 
-    UsdUndoDuplicateCommand(const UsdSceneItem::Ptr& srcItem);
+    UsdUndoDuplicateCommand(
+        const UsdSceneItem::Ptr&  srcItem,
+        PXR_NS::TfToken::HashSet* siblingNames = nullptr);
     ~UsdUndoDuplicateCommand() override;
 
     // Delete the copy/move constructors assignment operators.
@@ -51,7 +56,10 @@ public:
     UsdUndoDuplicateCommand& operator=(UsdUndoDuplicateCommand&&) = delete;
 
     //! Create a UsdUndoDuplicateCommand from a USD prim and UFE path.
-    static UsdUndoDuplicateCommand::Ptr create(const UsdSceneItem::Ptr& srcItem);
+    //! If given, the sibling names are the names already used under the parent
+    //! of the source prim. The name of the duplicate is added to them.
+    static UsdUndoDuplicateCommand::Ptr
+    create(const UsdSceneItem::Ptr& srcItem, PXR_NS::TfToken::HashSet* siblingNames = nullptr);
 
     UsdSceneItem::Ptr duplicatedItem() const;
 #if (UFE_PREVIEW_VERSION_NUM >= 4041)
@@ -65,6 +73,16 @@ public:
 private:
     UFE_V2(UsdUndoableItem _undoableItem;)
 
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    // The execution is split in steps so that the duplicate selection command
+    // can copy the specs of all its items in a single change block.
+    friend class UsdUndoDuplicateSelectionCommand;
+
+    void prepareDuplicate(const ReplicateExtrasToUSD& extras);
+    void copySpec();
+    void finalizeDuplicate(const ReplicateExtrasToUSD& extras);
+#endif
+
 #ifndef UFE_V2_FEATURES_AVAILABLE
     bool duplicateUndo();
     bool duplicateRedo();
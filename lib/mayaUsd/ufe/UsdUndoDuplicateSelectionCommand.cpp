@@ -15,6 +15,7 @@
 //
 #include "UsdUndoDuplicateSelectionCommand.h"
 
+#include "private/UfeNotifGuard.h"
 #include "private/Utils.h"
 
 #include <mayaUsd/ufe/Utils.h>
@@ -22,6 +23,7 @@
 #include <mayaUsdUtils/util.h>
 
 #include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
@@ -33,6 +35,8 @@
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
 
+#include <vector>
+
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
@@ -84,14 +88,51 @@ UsdUndoDuplicateSelectionCommand::Ptr UsdUndoDuplicateSelectionCommand::create(
 
 void UsdUndoDuplicateSelectionCommand::execute()
 {
+    MayaUsd::ufe::InAddOrDeleteOperation ad;
+
     UsdUndoBlock undoBlock(&_undoableItem);
 
+    // The names of the children of each parent are gathered once, and each duplicate
+    // name is added to them, so that duplicating bob1 and bob2 creates bob3 and bob4
+    // without having to copy each duplicate before naming the next one.
+    std::unordered_map<PXR_NS::SdfPath, PXR_NS::TfToken::HashSet, PXR_NS::SdfPath::Hash>
+                                              siblingNames;
+    std::vector<UsdUndoDuplicateCommand::Ptr> duplicateCmds;
+    duplicateCmds.reserve(_sourceItems.size());
     for (auto&& usdItem : _sourceItems) {
-        // Need to create and execute. If we create all before executing any, then the collision
-        // resolution on names will merge bob1 and bob2 into a single bob3 instead of creating a
-        // bob3 and a bob4.
-        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem);
-        duplicateCmd->execute();
+        PXR_NS::UsdPrim parentPrim = usdItem->prim().GetParent();
+        auto            namesIt = siblingNames.find(parentPrim.GetPath());
+        if (namesIt == siblingNames.end()) {
+            namesIt = siblingNames.emplace(parentPrim.GetPath(), getChildrenNames(parentPrim)).first;
+        }
+        duplicateCmds.push_back(UsdUndoDuplicateCommand::create(usdItem, &namesIt->second));
+    }
+
+    std::vector<ReplicateExtrasToUSD> extras(duplicateCmds.size());
+    for (size_t i = 0; i < duplicateCmds.size(); ++i) {
+        duplicateCmds[i]->prepareDuplicate(extras[i]);
+    }
+
+    // Copy the specs grouped by destination layer, each layer in a single change block.
+    std::vector<bool> copied(duplicateCmds.size(), false);
+    for (size_t i = 0; i < duplicateCmds.size(); ++i) {
+        if (copied[i]) {
+            continue;
+        }
+        const PXR_NS::SdfLayerHandle& dstLayer = duplicateCmds[i]->_dstLayer;
+        PXR_NS::SdfChangeBlock        changeBlock;
+        for (size_t j = i; j < duplicateCmds.size(); ++j) {
+            if (!copied[j] && duplicateCmds[j]->_dstLayer == dstLayer) {
+                duplicateCmds[j]->copySpec();
+                copied[j] = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < duplicateCmds.size(); ++i) {
+        const UsdSceneItem::Ptr&            usdItem = _sourceItems[i];
+        const UsdUndoDuplicateCommand::Ptr& duplicateCmd = duplicateCmds[i];
+        duplicateCmd->finalizeDuplicate(extras[i]);
 
         // Currently unordered_map since we need to streamline the targetItem override.
         _perItemCommands[usdItem->path()] = duplicateCmd;
@@ -0,0 +1,160 @@
+//
+// Copyright 2022 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdUndoTransformSelectionCommand.h"
+
+#include <mayaUsd/ufe/UsdSceneItem.h>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/usd/sdf/changeBlock.h>
+
+#include <ufe/transform3d.h>
+
+namespace MAYAUSD_NS_DEF {
+namespace ufe {
+
+UsdUndoTransformSelectionCommand::UsdUndoTransformSelectionCommand(
+    const Ufe::Selection& selection,
+    Operation             operation)
+    : Ufe::UndoableCommand()
+{
+    _paths.reserve(selection.size());
+    _perItemCommands.reserve(selection.size());
+    for (auto&& item : selection) {
+        // Skip the descendants, they are transformed with their ancestor.
+        if (selection.containsAncestor(item->path())) {
+            continue;
+        }
+        if (!std::dynamic_pointer_cast<UsdSceneItem>(item)) {
+            continue;
+        }
+        auto t3d = Ufe::Transform3d::transform3d(item);
+        if (!t3d) {
+            continue;
+        }
+
+        // Create the commands with the current values, they are only
+        // modified by set().
+        Ufe::SetVector3dUndoableCommand::Ptr cmd;
+        switch (operation) {
+        case kTranslate: {
+            const auto v = t3d->translation();
+            cmd = t3d->translateCmd(v.x(), v.y(), v.z());
+            break;
+        }
+        case kRotate: {
+            const auto v = t3d->rotation();
+            cmd = t3d->rotateCmd(v.x(), v.y(), v.z());
+            break;
+        }
+        case kScale: {
+            const auto v = t3d->scale();
+            cmd = t3d->scaleCmd(v.x(), v.y(), v.z());
+            break;
+        }
+        }
+        if (!cmd) {
+            continue;
+        }
+        _paths.push_back(item->path());
+        _perItemCommands.push_back(cmd);
+    }
+}
+
+UsdUndoTransformSelectionCommand::~UsdUndoTransformSelectionCommand() { }
+
+UsdUndoTransformSelectionCommand::Ptr
+UsdUndoTransformSelectionCommand::create(const Ufe::Selection& selection, Operation operation)
+{
+    auto retVal = std::make_shared<UsdUndoTransformSelectionCommand>(selection, operation);
+    if (retVal->_perItemCommands.empty()) {
+        return {};
+    }
+    return retVal;
+}
+
+bool UsdUndoTransformSelectionCommand::set(const Ufe::Vector3d& value)
+{
+    return apply(std::vector<Ufe::Vector3d>(_perItemCommands.size(), value));
+}
+
+bool UsdUndoTransformSelectionCommand::set(const std::vector<Ufe::Vector3d>& values)
+{
+    if (values.size() != _perItemCommands.size()) {
+        TF_CODING_ERROR(
+            "Expected %zu transform values, got %zu.", _perItemCommands.size(), values.size());
+        return false;
+    }
+    return apply(values);
+}
+
+bool UsdUndoTransformSelectionCommand::apply(const std::vector<Ufe::Vector3d>& values)
+{
+    auto setAll = [this, &values]() {
+        bool success = true;
+        for (size_t i = 0; i < _perItemCommands.size(); ++i) {
+            const auto& v = values[i];
+            success = _perItemCommands[i]->set(v.x(), v.y(), v.z()) && success;
+        }
+        return success;
+    };
+
+    bool success = false;
+    if (_values.empty()) {
+        // First set: the per-item commands may author new transform ops,
+        // which needs up-to-date composed prims.
+        success = setAll();
+    } else {
+        PXR_NS::SdfChangeBlock changeBlock;
+        success = setAll();
+    }
+
+    _values = values;
+    _undone = false;
+    return success;
+}
+
+void UsdUndoTransformSelectionCommand::execute() { }
+
+void UsdUndoTransformSelectionCommand::undo()
+{
+    if (_values.empty() || _undone) {
+        return;
+    }
+
+    PXR_NS::SdfChangeBlock changeBlock;
+    for (auto it = _perItemCommands.rbegin(); it != _perItemCommands.rend(); ++it) {
+        (*it)->undo();
+    }
+    _undone = true;
+}
+
+void UsdUndoTransformSelectionCommand::redo()
+{
+    if (!_undone) {
+        return;
+    }
+
+    // Maya transform commands are redone by setting their value again.
+    PXR_NS::SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < _perItemCommands.size(); ++i) {
+        const auto& v = _values[i];
+        _perItemCommands[i]->set(v.x(), v.y(), v.z());
+    }
+    _undone = false;
+}
+
+} // namespace ufe
+} // namespace MAYAUSD_NS_DEF
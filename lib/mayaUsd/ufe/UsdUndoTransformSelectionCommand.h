@@ -0,0 +1,91 @@
+//
+// Copyright 2022 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_UFE_USDUNDOTRANSFORMSELECTIONCOMMAND_H
+#define MAYAUSD_UFE_USDUNDOTRANSFORMSELECTIONCOMMAND_H
+
+#include <mayaUsd/base/api.h>
+
+#include <ufe/path.h>
+#include <ufe/selection.h>
+#include <ufe/transform3dUndoableCommands.h>
+#include <ufe/types.h>
+#include <ufe/undoableCommand.h>
+
+#include <vector>
+
+namespace MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Translate, rotate or scale all the items of a selection at once.
+//
+// The values of all the items are set in a single SdfChangeBlock, so that
+// each manipulation step sends a single USD change notice per stage instead
+// of one per item, and the whole manipulation is undone as one command.
+// The first set() is done outside of a change block, since it may add the
+// transform ops to the prims.
+class MAYAUSD_CORE_PUBLIC UsdUndoTransformSelectionCommand : public Ufe::UndoableCommand
+{
+public:
+    typedef std::shared_ptr<UsdUndoTransformSelectionCommand> Ptr;
+
+    enum Operation
+    {
+        kTranslate,
+        kRotate,
+        kScale
+    };
+
+    UsdUndoTransformSelectionCommand(const Ufe::Selection& selection, Operation operation);
+    ~UsdUndoTransformSelectionCommand() override;
+
+    // Delete the copy/move constructors assignment operators.
+    UsdUndoTransformSelectionCommand(const UsdUndoTransformSelectionCommand&) = delete;
+    UsdUndoTransformSelectionCommand& operator=(const UsdUndoTransformSelectionCommand&) = delete;
+    UsdUndoTransformSelectionCommand(UsdUndoTransformSelectionCommand&&) = delete;
+    UsdUndoTransformSelectionCommand& operator=(UsdUndoTransformSelectionCommand&&) = delete;
+
+    //! Create a UsdUndoTransformSelectionCommand for the transformable items
+    //! of the selection. Returns a null pointer if there are none.
+    static Ptr create(const Ufe::Selection& selection, Operation operation);
+
+    //! Paths of the transformed items, in the order of the values given to set().
+    //! Descendants of other selected items are not transformed.
+    const std::vector<Ufe::Path>& paths() const { return _paths; }
+
+    //! Set the same value on all the items.
+    bool set(const Ufe::Vector3d& value);
+
+    //! Set one value per item, in the order of paths().
+    bool set(const std::vector<Ufe::Vector3d>& values);
+
+    // No-op: values are applied by set().
+    void execute() override;
+    void undo() override;
+    void redo() override;
+
+private:
+    bool apply(const std::vector<Ufe::Vector3d>& values);
+
+    std::vector<Ufe::Path>                             _paths;
+    std::vector<Ufe::SetVector3dUndoableCommand::Ptr> _perItemCommands;
+    std::vector<Ufe::Vector3d>                         _values;
+    bool                                               _undone { false };
+}; // UsdUndoTransformSelectionCommand
+
+} // namespace ufe
+} // namespace MAYAUSD_NS_DEF
+
+#endif
@@ -18,6 +18,7 @@
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/undo/UsdUndoBlock.h>
 #include <mayaUsd/undo/UsdUndoableItem.h>
+#include <mayaUsd/utils/profilingScope.h>
 
 #include <ufe/path.h>
 
@@ -45,15 +46,27 @@ public:
     // Declares a UsdUndoBlock and calls executeUndoBlock()
     void execute() override
     {
+        ProfilingScope profilingScope(
+            ProfilingScope::ufeCategory, MProfiler::kColorB_L1, "Execute UFE command");
         UsdUndoBlock undoBlock(&_undoableItem);
         executeUndoBlock();
     }
 
     // Calls undo on the undoable item.
-    void undo() override { _undoableItem.undo(); }
+    void undo() override
+    {
+        ProfilingScope profilingScope(
+            ProfilingScope::ufeCategory, MProfiler::kColorB_L1, "Undo UFE command");
+        _undoableItem.undo();
+    }
 
     // Calls redo on the undoable item.
-    void redo() override { _undoableItem.redo(); }
+    void redo() override
+    {
+        ProfilingScope profilingScope(
+            ProfilingScope::ufeCategory, MProfiler::kColorB_L1, "Redo UFE command");
+        _undoableItem.redo();
+    }
 
 protected:
     // Actual implementation of the execution of the command,
@@ -80,15 +93,27 @@ public:
     // Declares a UsdUndoBlock and calls executeUndoBlock()
     void execute() override
     {
+        ProfilingScope profilingScope(
+            ProfilingScope::ufeCategory, MProfiler::kColorB_L1, "Execute UFE command");
         UsdUndoBlock undoBlock(&_undoableItem);
         executeUndoBlock();
     }
 
     // Calls undo on the undoable item.
-    void undo() override { _undoableItem.undo(); }
+    void undo() override
+    {
+        ProfilingScope profilingScope(
+            ProfilingScope::ufeCategory, MProfiler::kColorB_L1, "Undo UFE command");
+        _undoableItem.undo();
+    }
 
     // Calls redo on the undoable item.
-    void redo() override { _undoableItem.redo(); }
+    void redo() override
+    {
+        ProfilingScope profilingScope(
+            ProfilingScope::ufeCategory, MProfiler::kColorB_L1, "Redo UFE command");
+        _undoableItem.redo();
+    }
 
 protected:
     // Actual implementation of the execution of the command,
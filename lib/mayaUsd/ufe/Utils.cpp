@@ -25,13 +25,19 @@
 #include <mayaUsd/utils/util.h>
 #include <mayaUsdUtils/util.h>
 
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/tf/hashmap.h>
 #include <pxr/base/tf/hashset.h>
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/pcp/layerStack.h>
 #include <pxr/usd/pcp/site.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/pathTable.h>
 #include <pxr/usd/sdf/tokens.h>
 #include <pxr/usd/sdr/shaderProperty.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primCompositionQuery.h>
 #include <pxr/usd/usd/resolver.h>
@@ -53,6 +59,7 @@
 #include <ufe/rtid.h>
 #include <ufe/selection.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <memory>
@@ -87,11 +94,58 @@ bool stringBeginsWithDigit(const std::string& inputString)
     return false;
 }
 
-// This function calculates the position index for a given layer across all
-// the site's local LayerStacks
-uint32_t findLayerIndex(const UsdPrim& prim, const SdfLayerHandle& layer)
+// Strength-ordered layers of the local layer stacks of all the sites of the
+// expanded prim index, cached per stage and prim path. Computing the expanded
+// prim index is expensive and the layers only change on a resync of the prim
+// or one of its ancestors, which the path table erases as a whole subtree.
+using PrimLayersCache = TfHashMap<UsdStageWeakPtr, SdfPathTable<SdfLayerHandleVector>, TfHash>;
+
+struct _PrimLayersInvalidator : public TfWeakBase
+{
+    _PrimLayersInvalidator()
+    {
+        TfWeakPtr<_PrimLayersInvalidator> me(this);
+        TfNotice::Register(me, &_PrimLayersInvalidator::OnObjectsChanged);
+    }
+
+    void OnObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+    {
+        auto found = cache.find(notice.GetStage());
+        if (found == cache.end())
+            return;
+
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            if (path.IsAbsoluteRootPath()) {
+                cache.erase(found);
+                return;
+            }
+            if (!path.IsPrimPath())
+                continue;
+            auto entry = found->second.find(path);
+            if (entry != found->second.end())
+                found->second.erase(entry);
+        }
+    }
+
+    PrimLayersCache cache;
+};
+
+const SdfLayerHandleVector& getPrimLayers(const UsdPrim& prim)
 {
-    uint32_t position { 0 };
+    static _PrimLayersInvalidator invalidator;
+
+    // Drop the caches of the stages that no longer exist.
+    for (auto it = invalidator.cache.begin(); it != invalidator.cache.end();) {
+        if (it->first)
+            ++it;
+        else
+            it = invalidator.cache.erase(it);
+    }
+
+    auto&                 stageCache = invalidator.cache[prim.GetStage()];
+    SdfLayerHandleVector& layers = stageCache[prim.GetPath()];
+    if (!layers.empty())
+        return layers;
 
     const PcpPrimIndex& primIndex = prim.ComputeExpandedPrimIndex();
 
@@ -104,16 +158,23 @@ uint32_t findLayerIndex(const UsdPrim& prim, const SdfLayerHandle& layer)
         const PcpLayerStackRefPtr& layerStack = site.layerStack;
 
         // iterate through the "local" Layer stack for each site
-        // to find the layer
         for (SdfLayerRefPtr const& l : layerStack->GetLayers()) {
-            if (l == layer) {
-                return position;
-            }
-            ++position;
+            layers.push_back(l);
         }
     }
 
-    return position;
+    return layers;
+}
+
+// This function calculates the position index for a given layer across all
+// the site's local LayerStacks
+uint32_t findLayerIndex(const UsdPrim& prim, const SdfLayerHandle& layer)
+{
+    const SdfLayerHandleVector& layers = getPrimLayers(prim);
+
+    // find the layer
+    const auto found = std::find(layers.begin(), layers.end(), layer);
+    return static_cast<uint32_t>(found - layers.begin());
 }
 
 } // anonymous namespace
@@ -272,12 +333,11 @@ std::string uniqueName(const TfToken::HashSet& existingNames, std::string srcNam
     return dstName;
 }
 
-std::string uniqueChildName(const UsdPrim& usdParent, const std::string& name)
+TfToken::HashSet getChildrenNames(const UsdPrim& usdParent)
 {
-    if (!usdParent.IsValid())
-        return std::string();
-
     TfToken::HashSet childrenNames;
+    if (!usdParent.IsValid())
+        return childrenNames;
 
     // The prim GetChildren method used the UsdPrimDefaultPredicate which includes
     // active prims. We also need the inactive ones.
@@ -294,7 +354,16 @@ std::string uniqueChildName(const UsdPrim& usdParent, const std::string& name)
              UsdTraverseInstanceProxies(UsdPrimIsDefined && !UsdPrimIsAbstract))) {
         childrenNames.insert(child.GetName());
     }
-    std::string childName { name };
+    return childrenNames;
+}
+
+std::string uniqueChildName(const UsdPrim& usdParent, const std::string& name)
+{
+    if (!usdParent.IsValid())
+        return std::string();
+
+    TfToken::HashSet childrenNames = getChildrenNames(usdParent);
+    std::string      childName { name };
     if (childrenNames.find(TfToken(childName)) != childrenNames.end()) {
         childName = uniqueName(childrenNames, childName);
     }
@@ -1118,6 +1187,13 @@ VtValue vtValueFromString(const SdfValueTypeName& typeName, const std::string& s
 
 Ufe::Selection removeDescendants(const Ufe::Selection& src, const Ufe::Path& filterPath)
 {
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    // The selection trie finds out in O(depth) that there is nothing to filter.
+    if (!src.containsDescendant(filterPath)) {
+        return src;
+    }
+#endif
+
     // Filter the src selection, removing items below the filterPath
     Ufe::Selection dst;
     for (const auto& item : src) {
@@ -1132,6 +1208,12 @@ Ufe::Selection removeDescendants(const Ufe::Selection& src, const Ufe::Path& fil
 
 Ufe::Selection recreateDescendants(const Ufe::Selection& src, const Ufe::Path& filterPath)
 {
+#ifdef UFE_V2_FEATURES_AVAILABLE
+    if (!src.containsDescendant(filterPath)) {
+        return src;
+    }
+#endif
+
     // If a src selection item starts with the filterPath, re-create it.
     Ufe::Selection dst;
     for (const auto& item : src) {
@@ -111,6 +111,10 @@ createSiblingSceneItem(const Ufe::Path& ufeSrcPath, const std::string& siblingNa
 MAYAUSD_CORE_PUBLIC
 std::string uniqueName(const PXR_NS::TfToken::HashSet& existingNames, std::string srcName);
 
+//! Return the names of the children of the parent, including the inactive ones.
+MAYAUSD_CORE_PUBLIC
+PXR_NS::TfToken::HashSet getChildrenNames(const PXR_NS::UsdPrim& parent);
+
 //! Return a unique child name.
 MAYAUSD_CORE_PUBLIC
 std::string uniqueChildName(const PXR_NS::UsdPrim& parent, const std::string& name);
@@ -23,4 +23,7 @@ TF_WRAP_MODULE
     TF_WRAP(Global);
     TF_WRAP(Utils);
     TF_WRAP(Notice);
+#ifdef UFE_PREVIEW_BATCHOPS_SUPPORT
+    TF_WRAP(BatchOps);
+#endif
 }
@@ -0,0 +1,125 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/ufe/Global.h>
+#include <mayaUsd/ufe/UsdBatchOpsHandler.h>
+#include <mayaUsd/ufe/UsdUndoTransformSelectionCommand.h>
+
+#include <ufe/hierarchy.h>
+#include <ufe/pathString.h>
+#include <ufe/runTimeMgr.h>
+#include <ufe/selection.h>
+#include <ufe/types.h>
+
+#include <boost/python.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/list.hpp>
+#include <boost/python/tuple.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace MayaUsd;
+using namespace boost::python;
+
+namespace {
+
+using TransformSelectionCommand = ufe::UsdUndoTransformSelectionCommand;
+
+// The mayaUsd and UFE Python bindings don't know about each other, so the
+// selection is given as UFE path strings, as in wrapUtils.cpp.
+TransformSelectionCommand::Ptr
+_createCmd(const list& ufePathStrings, TransformSelectionCommand::Operation operation)
+{
+    auto handler = std::dynamic_pointer_cast<ufe::UsdBatchOpsHandler>(
+        Ufe::RunTimeMgr::instance().batchOpsHandler(ufe::getUsdRunTimeId()));
+    if (!handler) {
+        return {};
+    }
+
+    Ufe::Selection selection;
+    for (long i = 0; i < len(ufePathStrings); ++i) {
+        const std::string ufePathString = extract<std::string>(ufePathStrings[i]);
+        if (auto item = Ufe::Hierarchy::createItem(Ufe::PathString::path(ufePathString))) {
+            selection.append(item);
+        }
+    }
+
+    switch (operation) {
+    case TransformSelectionCommand::kTranslate: return handler->translateSelectionCmd(selection);
+    case TransformSelectionCommand::kRotate: return handler->rotateSelectionCmd(selection);
+    case TransformSelectionCommand::kScale: return handler->scaleSelectionCmd(selection);
+    }
+    return {};
+}
+
+TransformSelectionCommand::Ptr translateSelectionCmd(const list& ufePathStrings)
+{
+    return _createCmd(ufePathStrings, TransformSelectionCommand::kTranslate);
+}
+
+TransformSelectionCommand::Ptr rotateSelectionCmd(const list& ufePathStrings)
+{
+    return _createCmd(ufePathStrings, TransformSelectionCommand::kRotate);
+}
+
+TransformSelectionCommand::Ptr scaleSelectionCmd(const list& ufePathStrings)
+{
+    return _createCmd(ufePathStrings, TransformSelectionCommand::kScale);
+}
+
+list _paths(const TransformSelectionCommand& cmd)
+{
+    list paths;
+    for (const Ufe::Path& path : cmd.paths()) {
+        paths.append(Ufe::PathString::string(path));
+    }
+    return paths;
+}
+
+bool _set(TransformSelectionCommand& cmd, double x, double y, double z)
+{
+    return cmd.set(Ufe::Vector3d(x, y, z));
+}
+
+// One (x, y, z) tuple per item, in the order of paths().
+bool _setValues(TransformSelectionCommand& cmd, const list& values)
+{
+    std::vector<Ufe::Vector3d> vectors;
+    for (long i = 0; i < len(values); ++i) {
+        const tuple value = extract<tuple>(values[i]);
+        vectors.emplace_back(
+            extract<double>(value[0]), extract<double>(value[1]), extract<double>(value[2]));
+    }
+    return cmd.set(vectors);
+}
+
+} // namespace
+
+void wrapBatchOps()
+{
+    class_<TransformSelectionCommand, TransformSelectionCommand::Ptr, boost::noncopyable>(
+        "TransformSelectionCommand", no_init)
+        .def("paths", _paths)
+        .def("set", _set)
+        .def("setValues", _setValues)
+        .def("undo", &TransformSelectionCommand::undo)
+        .def("redo", &TransformSelectionCommand::redo);
+
+    def("translateSelectionCmd", translateSelectionCmd);
+    def("rotateSelectionCmd", rotateSelectionCmd);
+    def("scaleSelectionCmd", scaleSelectionCmd);
+}
@@ -59,10 +59,66 @@ struct OnSceneResetListener : public PXR_NS::TfWeakBase
 // OpUndoItemList
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+// OpUndoItemList::Arena
+//------------------------------------------------------------------------------
+
+namespace {
+constexpr size_t kArenaBlockSize = 16 * 1024;
+} // namespace
+
+OpUndoItemList::Arena::Arena(Arena&& other) { *this = std::move(other); }
+
+OpUndoItemList::Arena& OpUndoItemList::Arena::operator=(Arena&& other)
+{
+    _blocks = std::move(other._blocks);
+    other._blocks.clear();
+
+    _current = other._current;
+    other._current = nullptr;
+
+    _remaining = other._remaining;
+    other._remaining = 0;
+
+    return *this;
+}
+
+void* OpUndoItemList::Arena::allocate(size_t size, size_t alignment)
+{
+    void* aligned = _current;
+    if (!aligned || !std::align(alignment, size, aligned, _remaining)) {
+        // Items larger than a block get a block of their own.
+        const size_t blockSize = std::max(kArenaBlockSize, size + alignment);
+        _blocks.emplace_back(new char[blockSize]);
+        aligned = _blocks.back().get();
+        _remaining = blockSize;
+        std::align(alignment, size, aligned, _remaining);
+    }
+
+    _current = static_cast<char*>(aligned) + size;
+    _remaining -= size;
+    return aligned;
+}
+
+void OpUndoItemList::Arena::release()
+{
+    _blocks.clear();
+    _current = nullptr;
+    _remaining = 0;
+}
+
+//------------------------------------------------------------------------------
+// OpUndoItemList
+//------------------------------------------------------------------------------
+
 OpUndoItemList::OpUndoItemList(OpUndoItemList&& other) { *this = std::move(other); }
 
 OpUndoItemList& OpUndoItemList::operator=(OpUndoItemList&& other)
 {
+    clear();
+
+    _arena = std::move(other._arena);
+
     _undoItems = std::move(other._undoItems);
     other._undoItems.clear();
 
@@ -83,7 +139,7 @@ bool OpUndoItemList::undo()
     // Note: iterate in reverse order since operations might depend on each other.
     const auto end = _undoItems.rend();
     for (auto iter = _undoItems.rbegin(); iter != end; ++iter)
-        overallSuccess &= (*iter)->undo();
+        overallSuccess &= iter->item->undo();
 
     _isUndone = true;
 
@@ -96,8 +152,8 @@ bool OpUndoItemList::redo()
         return true;
 
     bool overallSuccess = true;
-    for (auto& item : _undoItems)
-        overallSuccess &= item->redo();
+    for (auto& entry : _undoItems)
+        overallSuccess &= entry.item->redo();
 
     _isUndone = false;
 
@@ -107,7 +163,16 @@ bool OpUndoItemList::redo()
 void OpUndoItemList::addItem(OpUndoItem::Ptr&& item)
 {
     // Note: OpUndoItem::Ptr are unique_ptr, so we need to take ownership of them.
-    _undoItems.emplace_back(std::move(item));
+    _undoItems.push_back({ item.release(), false });
+}
+
+void OpUndoItemList::destroyItem(Entry& entry)
+{
+    if (entry.inArena)
+        entry.item->~OpUndoItem();
+    else
+        delete entry.item;
+    entry.item = nullptr;
 }
 
 void OpUndoItemList::clear()
@@ -117,15 +182,18 @@ void OpUndoItemList::clear()
     if (_isUndone) {
         const auto end = _undoItems.rend();
         for (auto iter = _undoItems.rbegin(); iter != end; ++iter)
-            iter->reset();
+            destroyItem(*iter);
     } else {
         const auto end = _undoItems.end();
         for (auto iter = _undoItems.begin(); iter != end; ++iter)
-            iter->reset();
+            destroyItem(*iter);
     }
 
     _undoItems.clear();
     _isUndone = false;
+
+    // Release the memory of all the items at once.
+    _arena.release();
 }
 
 OpUndoItemList& OpUndoItemList::instance()
@@ -21,9 +21,12 @@
 #include <maya/MObjectHandle.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace MAYAUSD_NS_DEF {
@@ -75,6 +78,9 @@ private:
 
 /// \class OpUndoItemList
 /// \brief Record everything needed to undo or redo a complete operation or command.
+///
+/// The items created with emplaceItem() are allocated from a monotonic arena owned
+/// by the list, which is released in one go when the list is cleared or destroyed.
 
 class OpUndoItemList
 {
@@ -105,6 +111,30 @@ public:
     MAYAUSD_CORE_PUBLIC
     void addItem(OpUndoItem::Ptr&& item);
 
+    /// \brief construct an undo item in the memory of the list and add it.
+    template <class T, class... Args> T& emplaceItem(Args&&... args)
+    {
+        T& item = constructItem<T>(std::forward<Args>(args)...);
+        addConstructedItem(item);
+        return item;
+    }
+
+    /// \brief construct an undo item in the memory of the list, without adding it.
+    ///
+    /// The item must then be given to either addConstructedItem() or discardConstructedItem().
+    /// This lets an item run before being added, so that the items it adds itself come first.
+    template <class T, class... Args> T& constructItem(Args&&... args)
+    {
+        void* memory = _arena.allocate(sizeof(T), alignof(T));
+        return *new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /// \brief add an undo item created with constructItem().
+    void addConstructedItem(OpUndoItem& item) { _undoItems.push_back({ &item, true }); }
+
+    /// \brief destroy an undo item created with constructItem(), without undoing it.
+    void discardConstructedItem(OpUndoItem& item) { item.~OpUndoItem(); }
+
     /// \brief clear all undo/redo information contained here.
     MAYAUSD_CORE_PUBLIC
     void clear();
@@ -120,8 +150,38 @@ private:
     OpUndoItemList(const OpUndoItemList&) = delete;
     OpUndoItemList& operator=(const OpUndoItemList&) = delete;
 
-    std::vector<OpUndoItem::Ptr> _undoItems;
-    bool                         _isUndone = false;
+    // Monotonic memory for the undo items, only released as a whole.
+    class Arena
+    {
+    public:
+        Arena() = default;
+        Arena(Arena&& other);
+        Arena& operator=(Arena&& other);
+
+        MAYAUSD_CORE_PUBLIC
+        void* allocate(size_t size, size_t alignment);
+        void  release();
+
+    private:
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        std::vector<std::unique_ptr<char[]>> _blocks;
+        char*                                _current = nullptr;
+        size_t                               _remaining = 0;
+    };
+
+    struct Entry
+    {
+        OpUndoItem* item;
+        bool        inArena;
+    };
+
+    void destroyItem(Entry& entry);
+
+    Arena              _arena;
+    std::vector<Entry> _undoItems;
+    bool               _isUndone = false;
 };
 
 } // namespace MAYAUSD_NS_DEF
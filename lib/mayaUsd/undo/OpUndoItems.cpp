@@ -58,11 +58,16 @@ MString formatCommand(const MString& commandName, const MObject& commandArg)
     return cmd;
 }
 
-bool redoAndAdd(std::unique_ptr<OpUndoItem>&& item, OpUndoItemList& undoInfo)
+template <class T, class... Args> bool redoAndAdd(OpUndoItemList& undoInfo, Args&&... args)
 {
-    if (!item->redo())
+    // Note: the item is only added after it ran, so that the items it might
+    //       add itself are before it in the list, as they must be undone after it.
+    T& item = undoInfo.constructItem<T>(std::forward<Args>(args)...);
+    if (!item.redo()) {
+        undoInfo.discardConstructedItem(item);
         return false;
-    undoInfo.addItem(std::move(item));
+    }
+    undoInfo.addConstructedItem(item);
     return true;
 }
 
@@ -82,19 +87,20 @@ MStatus NodeDeletionUndoItem::deleteNode(
 
     std::string fullName
         = name + std::string(" \"") + std::string(cmd.asChar()) + std::string("\"");
-    auto item = std::make_unique<NodeDeletionUndoItem>(std::move(fullName));
+    auto& item = undoInfo.constructItem<NodeDeletionUndoItem>(std::move(fullName));
 
-    MStatus status = item->_modifier.commandToExecute(cmd);
-    if (status != MS::kSuccess)
-        return status;
+    MStatus status = item._modifier.commandToExecute(cmd);
+    if (status == MS::kSuccess)
+        status = item._modifier.doIt();
 
-    status = item->_modifier.doIt();
-    if (status != MS::kSuccess)
+    if (status != MS::kSuccess) {
+        undoInfo.discardConstructedItem(item);
         return status;
+    }
 
-    undoInfo.addItem(std::move(item));
+    undoInfo.addConstructedItem(item);
 
-    return MS::kSuccess;
+    return status;
 }
 
 MStatus NodeDeletionUndoItem::deleteNode(
@@ -117,10 +123,8 @@ bool NodeDeletionUndoItem::redo() { return _modifier.doIt() == MS::kSuccess; }
 
 MDagModifier& MDagModifierUndoItem::create(const std::string name, OpUndoItemList& undoInfo)
 {
-    auto          item = std::make_unique<MDagModifierUndoItem>(std::move(name));
-    MDagModifier& mod = item->getModifier();
-    undoInfo.addItem(std::move(item));
-    return mod;
+    auto& item = undoInfo.emplaceItem<MDagModifierUndoItem>(std::move(name));
+    return item.getModifier();
 }
 
 MDagModifier& MDagModifierUndoItem::create(const std::string name)
@@ -140,10 +144,8 @@ bool MDagModifierUndoItem::redo() { return _modifier.doIt() == MS::kSuccess; }
 
 MDGModifier& MDGModifierUndoItem::create(const std::string name, OpUndoItemList& undoInfo)
 {
-    auto         item = std::make_unique<MDGModifierUndoItem>(std::move(name));
-    MDGModifier& mod = item->getModifier();
-    undoInfo.addItem(std::move(item));
-    return mod;
+    auto& item = undoInfo.emplaceItem<MDGModifierUndoItem>(std::move(name));
+    return item.getModifier();
 }
 
 MDGModifier& MDGModifierUndoItem::create(const std::string name)
@@ -164,10 +166,8 @@ bool MDGModifierUndoItem::redo() { return _modifier.doIt() == MS::kSuccess; }
 MAYAUSD_NS::UsdUndoableItem&
 UsdUndoableItemUndoItem::create(const std::string name, OpUndoItemList& undoInfo)
 {
-    auto                         item = std::make_unique<UsdUndoableItemUndoItem>(std::move(name));
-    MAYAUSD_NS::UsdUndoableItem& mod = item->getUndoableItem();
-    undoInfo.addItem(std::move(item));
-    return mod;
+    auto& item = undoInfo.emplaceItem<UsdUndoableItemUndoItem>(std::move(name));
+    return item.getUndoableItem();
 }
 
 MAYAUSD_NS::UsdUndoableItem& UsdUndoableItemUndoItem::create(const std::string name)
@@ -208,9 +208,8 @@ bool PythonUndoItem::execute(
     MString           pythonUndo,
     OpUndoItemList&   undoInfo)
 {
-    auto item = std::make_unique<PythonUndoItem>(
-        std::move(name), std::move(pythonDo), std::move(pythonUndo));
-    return redoAndAdd(std::move(item), undoInfo);
+    return redoAndAdd<PythonUndoItem>(
+        undoInfo, std::move(name), std::move(pythonDo), std::move(pythonUndo));
 }
 
 bool PythonUndoItem::execute(const std::string name, MString pythonDo, MString pythonUndo)
@@ -254,9 +253,7 @@ void FunctionUndoItem::create(
     std::function<bool()> undo,
     OpUndoItemList&       undoInfo)
 {
-    auto item
-        = std::make_unique<FunctionUndoItem>(std::move(name), std::move(redo), std::move(undo));
-    undoInfo.addItem(std::move(item));
+    undoInfo.emplaceItem<FunctionUndoItem>(std::move(name), std::move(redo), std::move(undo));
 }
 
 void FunctionUndoItem::create(
@@ -273,9 +270,8 @@ bool FunctionUndoItem::execute(
     std::function<bool()> undo,
     OpUndoItemList&       undoInfo)
 {
-    auto item
-        = std::make_unique<FunctionUndoItem>(std::move(name), std::move(redo), std::move(undo));
-    return redoAndAdd(std::move(item), undoInfo);
+    return redoAndAdd<FunctionUndoItem>(
+        undoInfo, std::move(name), std::move(redo), std::move(undo));
 }
 
 bool FunctionUndoItem::execute(
@@ -324,8 +320,7 @@ bool SelectionUndoItem::select(
     MGlobal::ListAdjustment selMode,
     OpUndoItemList&         undoInfo)
 {
-    auto item = std::make_unique<SelectionUndoItem>(std::move(name), selection, selMode);
-    return redoAndAdd(std::move(item), undoInfo);
+    return redoAndAdd<SelectionUndoItem>(undoInfo, std::move(name), selection, selMode);
 }
 
 bool SelectionUndoItem::select(
@@ -386,8 +381,7 @@ bool UfeSelectionUndoItem::select(
     const Ufe::Selection& selection,
     OpUndoItemList&       undoInfo)
 {
-    auto item = std::make_unique<UfeSelectionUndoItem>(name, selection);
-    return redoAndAdd(std::move(item), undoInfo);
+    return redoAndAdd<UfeSelectionUndoItem>(undoInfo, name, selection);
 }
 
 bool UfeSelectionUndoItem::select(const std::string& name, const Ufe::Selection& selection)
@@ -479,8 +473,7 @@ bool LockNodesUndoItem::lock(
     bool              dolock,
     OpUndoItemList&   undoInfo)
 {
-    auto item = std::make_unique<LockNodesUndoItem>(std::move(name), root, dolock);
-    return redoAndAdd(std::move(item), undoInfo);
+    return redoAndAdd<LockNodesUndoItem>(undoInfo, std::move(name), root, dolock);
 }
 
 bool LockNodesUndoItem::lock(const std::string name, const MDagPath& root, bool dolock)
@@ -515,11 +508,9 @@ CreateSetUndoItem::~CreateSetUndoItem() { }
 MObject
 CreateSetUndoItem::create(std::string name, const MString& setName, OpUndoItemList& undoInfo)
 {
-    auto item = std::make_unique<CreateSetUndoItem>(std::move(name), setName);
-    item->redo();
-    MObject obj = item->_setObj;
-    undoInfo.addItem(std::move(item));
-    return obj;
+    auto& item = undoInfo.emplaceItem<CreateSetUndoItem>(std::move(name), setName);
+    item.redo();
+    return item._setObj;
 }
 
 MObject CreateSetUndoItem::create(std::string name, const MString& setName)
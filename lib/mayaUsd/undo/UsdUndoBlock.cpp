@@ -42,6 +42,12 @@ UsdUndoBlock::UsdUndoBlock(UsdUndoableItem* undoItem)
 
     TF_DEBUG_MSG(USDMAYA_UNDOSTACK, "--Opening undo block at depth %i\n", _undoBlockDepth);
 
+    // the fields recorded by a coalesced interaction do not apply to an
+    // explicit undoable item.
+    if (_undoBlockDepth == 0 && _undoItem != nullptr) {
+        UsdUndoManager::instance().clearFieldRecords();
+    }
+
     ++_undoBlockDepth;
 }
 
@@ -53,7 +59,10 @@ UsdUndoBlock::~UsdUndoBlock()
     --_undoBlockDepth;
 
     if (_undoBlockDepth == 0) {
-        if (_undoItem == nullptr) {
+        if (_undoItem == nullptr && undoManager.isInteracting()) {
+            // merge the edits until the end of the interaction
+            undoManager.mergeInteractionEdits();
+        } else if (_undoItem == nullptr) {
             // create an undoable item
             UsdUndoableItem undoItem;
             // transfer edits
@@ -19,8 +19,69 @@
 #include "UsdUndoBlock.h"
 #include "UsdUndoStateDelegate.h"
 
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/usd/sdf/abstractData.h>
+#include <pxr/usd/sdf/schema.h>
+
+#include <iterator>
+#include <string>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_UNDO_ITEM_MEMORY_LIMIT,
+    0,
+    "Maximum estimated memory, in megabytes, of the USD edits recorded for a single undo. "
+    "The edits above it are dropped and cannot be undone. Zero means no limit.");
+
+namespace {
+
+// Estimates the memory held by a value: the value itself, plus the elements
+// of arrays and the characters of strings.
+size_t estimateMemoryUsage(const VtValue& value)
+{
+    size_t size = 0;
+    if (value.IsArrayValued()) {
+        const SdfValueTypeName typeName = SdfSchema::GetInstance().FindType(value);
+        if (typeName) {
+            size += value.GetArraySize() * typeName.GetScalarType().GetType().GetSizeof();
+        }
+    } else if (value.IsHolding<std::string>()) {
+        size += value.UncheckedGet<std::string>().capacity();
+    }
+    return size;
+}
+
+// Sums the estimated memory of all the field values of the visited specs.
+class MemoryUsageVisitor : public SdfAbstractDataSpecVisitor
+{
+public:
+    bool VisitSpec(const SdfAbstractData& data, const SdfPath& path) override
+    {
+        for (const TfToken& field : data.List(path)) {
+            _size += sizeof(VtValue) + estimateMemoryUsage(data.Get(path, field));
+        }
+        return true;
+    }
+
+    void Done(const SdfAbstractData&) override { }
+
+    size_t _size { 0 };
+};
+
+size_t estimateMemoryUsage(const MAYAUSD_NS::UsdUndoInverseEdit& edit)
+{
+    size_t size = sizeof(edit) + estimateMemoryUsage(edit.value);
+    if (edit.data) {
+        MemoryUsageVisitor visitor;
+        edit.data->VisitSpecs(&visitor);
+        size += visitor._size;
+    }
+    return size;
+}
+
+} // namespace
+
 namespace MAYAUSD_NS_DEF {
 
 UsdUndoManager& UsdUndoManager::instance()
@@ -40,20 +101,116 @@ void UsdUndoManager::trackLayerStates(const SdfLayerHandle& layer)
     }
 }
 
-void UsdUndoManager::addInverse(InvertFunc func)
+void UsdUndoManager::addInverse(UsdUndoInverseEdit&& edit)
 {
     if (UsdUndoBlock::depth() == 0) {
         TF_CODING_ERROR("Collecting invert functions outside of undoblock is not allowed!");
         return;
     }
 
-    _invertFuncs.emplace_back(func);
+    // once over the memory limit, the edits of the item are dropped.
+    if (_truncated) {
+        return;
+    }
+
+    const bool isFieldEdit = edit.op == UsdUndoInverseEdit::Op::kSetField
+        || edit.op == UsdUndoInverseEdit::Op::kSetFieldDictValueByKey
+        || edit.op == UsdUndoInverseEdit::Op::kSetTimeSample;
+
+    if (isInteracting()) {
+        if (isFieldEdit) {
+            // during an interaction, only the first inverse of a field is needed: it
+            // restores the value from before the interaction, since the inverses are
+            // replayed in reverse order.
+            const FieldKey key(
+                edit.delegate,
+                edit.path,
+                edit.field,
+                edit.token,
+                edit.time,
+                static_cast<uint8_t>(edit.op));
+            if (!_recordedFields.insert(key).second) {
+                return;
+            }
+        } else {
+            // structural edits (spec creation, deletion, moves, children) may make the
+            // later field edits depend on them, so field edits after them are recorded again.
+            _recordedFields.clear();
+        }
+    }
+
+    _memoryUsage += estimateMemoryUsage(edit);
+    _inverseEdits.emplace_back(std::move(edit));
+
+    const size_t limit = TfGetEnvSetting(MAYAUSD_UNDO_ITEM_MEMORY_LIMIT) * size_t(1024 * 1024);
+    if (limit > 0 && _memoryUsage + _interactionMemoryUsage > limit) {
+        TF_WARN(
+            "The USD edits exceed the undo memory limit of %d MB and will not be undoable.",
+            TfGetEnvSetting(MAYAUSD_UNDO_ITEM_MEMORY_LIMIT));
+        _inverseEdits.clear();
+        _interactionEdits.clear();
+        _memoryUsage = 0;
+        _interactionMemoryUsage = 0;
+        _truncated = true;
+    }
 }
 
 void UsdUndoManager::transferEdits(UsdUndoableItem& undoableItem)
 {
     // transfer the edits
-    undoableItem._invertFuncs = std::move(_invertFuncs);
+    undoableItem.setEdits(std::move(_inverseEdits), _memoryUsage, _truncated);
+    _inverseEdits.clear();
+    _memoryUsage = 0;
+    _recordedFields.clear();
+    if (!isInteracting()) {
+        _truncated = false;
+    }
+}
+
+void UsdUndoManager::mergeInteractionEdits()
+{
+    _interactionEdits.insert(
+        _interactionEdits.end(),
+        std::make_move_iterator(_inverseEdits.begin()),
+        std::make_move_iterator(_inverseEdits.end()));
+    _inverseEdits.clear();
+    _interactionMemoryUsage += _memoryUsage;
+    _memoryUsage = 0;
+}
+
+void UsdUndoManager::clearFieldRecords() { _recordedFields.clear(); }
+
+size_t UsdUndoManager::memoryUsage() const
+{
+    return UsdUndoableItem::totalMemoryUsage() + _memoryUsage + _interactionMemoryUsage;
+}
+
+void UsdUndoManager::beginInteraction() { ++_interactionDepth; }
+
+void UsdUndoManager::endInteraction()
+{
+    if (_interactionDepth == 0) {
+        TF_CODING_ERROR("Ending an undo interaction that was not started!");
+        return;
+    }
+
+    if (--_interactionDepth > 0) {
+        return;
+    }
+
+    _recordedFields.clear();
+
+    const bool truncated = _truncated;
+    _truncated = false;
+    if (_interactionEdits.empty() && !truncated) {
+        return;
+    }
+
+    UsdUndoableItem undoItem;
+    undoItem.setEdits(std::move(_interactionEdits), _interactionMemoryUsage, truncated);
+    _interactionEdits.clear();
+    _interactionMemoryUsage = 0;
+    UsdUndoBlockCmd::execute(undoItem);
 }
 
 } // namespace MAYAUSD_NS_DEF
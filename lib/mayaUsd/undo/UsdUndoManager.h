@@ -20,10 +20,14 @@
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/undo/UsdUndoableItem.h>
 
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
-#include <functional>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <tuple>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -33,14 +37,15 @@ namespace MAYAUSD_NS_DEF {
 /*!
     The UndoManager is responsible for :
     1- tracking layer state changes from UsdUndoStateDelegate
-    2- collecting InvertFunc() in every state change
+    2- collecting an inverse edit in every state change
     3- transferring collected edits into an UsdUndoableItem
+    4- coalescing the edits of continuous interactions (manipulator drags,
+       slider scrubs) into a single UsdUndoableItem
 */
 class MAYAUSD_CORE_PUBLIC UsdUndoManager
 {
 public:
-    using InvertFunc = std::function<void()>;
-    using InvertFuncs = std::vector<InvertFunc>;
+    using InverseEdits = UsdUndoableItem::InverseEdits;
 
     // returns an instance of the undo manager.
     static UsdUndoManager& instance();
@@ -54,6 +59,24 @@ public:
     // tracks layer states by spawning a new UsdUndoStateDelegate
     void trackLayerStates(const SdfLayerHandle& layer);
 
+    // starts coalescing the edits of a continuous interaction. Until the matching
+    // endInteraction(), only the first inverse of each spec field is kept, so it
+    // holds the value from before the interaction, and the edits of top-level
+    // undo blocks without an undoable item are merged instead of being added
+    // one by one to the Maya undo stack. Calls can be nested.
+    void beginInteraction();
+
+    // ends coalescing and adds the merged edits to the Maya undo stack as a
+    // single undoable item.
+    void endInteraction();
+
+    // returns true between beginInteraction() and endInteraction().
+    bool isInteracting() const { return _interactionDepth > 0; }
+
+    // returns the estimated memory used by the undoable items and the edits
+    // being collected, in bytes.
+    size_t memoryUsage() const;
+
 private:
     friend class UsdUndoStateDelegate;
     friend class UsdUndoBlock;
@@ -62,11 +85,23 @@ private:
     UsdUndoManager() = default;
     ~UsdUndoManager() = default;
 
-    void addInverse(InvertFunc func);
+    // identifies an edited spec field: state delegate, spec path, field name,
+    // dictionary key path, time sample and inverse op.
+    using FieldKey = std::tuple<const void*, SdfPath, TfToken, TfToken, double, uint8_t>;
+
+    void addInverse(UsdUndoInverseEdit&& edit);
     void transferEdits(UsdUndoableItem& undoableItem);
+    void mergeInteractionEdits();
+    void clearFieldRecords();
 
 private:
-    InvertFuncs _invertFuncs;
+    InverseEdits       _inverseEdits;
+    InverseEdits       _interactionEdits;
+    size_t             _memoryUsage { 0 };
+    size_t             _interactionMemoryUsage { 0 };
+    bool               _truncated { false };
+    std::set<FieldKey> _recordedFields;
+    int                _interactionDepth { 0 };
 };
 
 } // namespace MAYAUSD_NS_DEF
@@ -97,6 +97,34 @@ void UsdUndoStateDelegate::_OnSetLayer(const SdfLayerHandle& layer)
     }
 }
 
+void UsdUndoStateDelegate::addInverse(UsdUndoInverseEdit&& edit)
+{
+    edit.delegate = this;
+    UsdUndoManager::instance().addInverse(std::move(edit));
+}
+
+void UsdUndoStateDelegate::invert(const UsdUndoInverseEdit& edit)
+{
+    using Op = UsdUndoInverseEdit::Op;
+
+    switch (edit.op) {
+    case Op::kSetField: invertSetField(edit.path, edit.field, edit.value); break;
+    case Op::kSetFieldDictValueByKey:
+        invertSetFieldDictValueByKey(edit.path, edit.field, edit.token, edit.value);
+        break;
+    case Op::kSetTimeSample: invertSetTimeSample(edit.path, edit.time, edit.value); break;
+    case Op::kDeleteSpec: invertCreateSpec(edit.path, edit.inert); break;
+    case Op::kCreateSpec:
+        invertDeleteSpec(edit.path, edit.inert, edit.specType, edit.data);
+        break;
+    case Op::kMoveSpec: invertMoveSpec(edit.otherPath, edit.path); break;
+    case Op::kPopTokenChild: invertPushTokenChild(edit.path, edit.field, edit.token); break;
+    case Op::kPopPathChild: invertPushPathChild(edit.path, edit.field, edit.otherPath); break;
+    case Op::kPushTokenChild: invertPopTokenChild(edit.path, edit.field, edit.token); break;
+    case Op::kPushPathChild: invertPopPathChild(edit.path, edit.field, edit.otherPath); break;
+    }
+}
+
 void UsdUndoStateDelegate::invertSetField(
     const SdfPath& path,
     const TfToken& fieldName,
@@ -275,8 +303,12 @@ void UsdUndoStateDelegate::_OnSetField(
 
     const VtValue inverseValue = _layer->GetField(path, fieldName);
 
-    UsdUndoManager::instance().addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kSetField;
+    edit.path = path;
+    edit.field = fieldName;
+    edit.value = inverseValue;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnSetField(
@@ -303,8 +335,12 @@ void UsdUndoStateDelegate::_OnSetField(
     const VtValue inverseValue = _layer->GetField(path, fieldName);
 
     // add invert
-    UsdUndoManager::instance().addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kSetField;
+    edit.path = path;
+    edit.field = fieldName;
+    edit.value = inverseValue;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKey(
@@ -355,8 +391,11 @@ void UsdUndoStateDelegate::_OnCreateSpec(const SdfPath& path, SdfSpecType specTy
         return;
     }
 
-    UsdUndoManager::instance().addInverse(
-        std::bind(&UsdUndoStateDelegate::invertCreateSpec, this, path, inert));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kDeleteSpec;
+    edit.path = path;
+    edit.inert = inert;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnDeleteSpec(const SdfPath& path, bool inert)
@@ -387,8 +426,13 @@ void UsdUndoStateDelegate::_OnDeleteSpec(const SdfPath& path, bool inert)
 
     const SdfSpecType deletedSpecType = _GetLayer()->GetSpecType(path);
 
-    UsdUndoManager::instance().addInverse(std::bind(
-        &UsdUndoStateDelegate::invertDeleteSpec, this, path, inert, deletedSpecType, deletedData));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kCreateSpec;
+    edit.path = path;
+    edit.inert = inert;
+    edit.specType = deletedSpecType;
+    edit.data = deletedData;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnMoveSpec(const SdfPath& oldPath, const SdfPath& newPath)
@@ -409,8 +453,11 @@ void UsdUndoStateDelegate::_OnMoveSpec(const SdfPath& oldPath, const SdfPath& ne
         return;
     }
 
-    UsdUndoManager::instance().addInverse(
-        std::bind(&UsdUndoStateDelegate::invertMoveSpec, this, oldPath, newPath));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kMoveSpec;
+    edit.path = newPath;
+    edit.otherPath = oldPath;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnPushChild(
@@ -434,8 +481,12 @@ void UsdUndoStateDelegate::_OnPushChild(
         return;
     }
 
-    UsdUndoManager::instance().addInverse(
-        std::bind(&UsdUndoStateDelegate::invertPushTokenChild, this, parentPath, fieldName, value));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kPopTokenChild;
+    edit.path = parentPath;
+    edit.field = fieldName;
+    edit.token = value;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnPushChild(
@@ -459,8 +510,12 @@ void UsdUndoStateDelegate::_OnPushChild(
         return;
     }
 
-    UsdUndoManager::instance().addInverse(
-        std::bind(&UsdUndoStateDelegate::invertPushPathChild, this, parentPath, fieldName, value));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kPopPathChild;
+    edit.path = parentPath;
+    edit.field = fieldName;
+    edit.otherPath = value;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnPopChild(
@@ -484,8 +539,12 @@ void UsdUndoStateDelegate::_OnPopChild(
         return;
     }
 
-    UsdUndoManager::instance().addInverse(std::bind(
-        &UsdUndoStateDelegate::invertPopTokenChild, this, parentPath, fieldName, oldValue));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kPushTokenChild;
+    edit.path = parentPath;
+    edit.field = fieldName;
+    edit.token = oldValue;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnPopChild(
@@ -509,8 +568,12 @@ void UsdUndoStateDelegate::_OnPopChild(
         return;
     }
 
-    UsdUndoManager::instance().addInverse(std::bind(
-        &UsdUndoStateDelegate::invertPopPathChild, this, parentPath, fieldName, oldValue));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kPushPathChild;
+    edit.path = parentPath;
+    edit.field = fieldName;
+    edit.otherPath = oldValue;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
@@ -540,13 +603,13 @@ void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
 
     const VtValue inverseValue = _layer->GetFieldDictValueByKey(path, fieldName, keyPath);
 
-    UsdUndoManager::instance().addInverse(std::bind(
-        &UsdUndoStateDelegate::invertSetFieldDictValueByKey,
-        this,
-        path,
-        fieldName,
-        keyPath,
-        inverseValue));
+    UsdUndoInverseEdit edit;
+    edit.op = UsdUndoInverseEdit::Op::kSetFieldDictValueByKey;
+    edit.path = path;
+    edit.field = fieldName;
+    edit.token = keyPath;
+    edit.value = inverseValue;
+    addInverse(std::move(edit));
 }
 
 void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time)
@@ -562,20 +625,24 @@ void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time
         .Msg("Setting time sample '%f' for spec '%s'\n", time, path.GetText());
 
     if (!_GetLayer()->HasField(path, SdfFieldKeys->TimeSamples)) {
-        UsdUndoManager::instance().addInverse(std::bind(
-            &UsdUndoStateDelegate::invertSetField,
-            this,
-            path,
-            SdfFieldKeys->TimeSamples,
-            VtValue()));
+        UsdUndoInverseEdit edit;
+        edit.op = UsdUndoInverseEdit::Op::kSetField;
+        edit.path = path;
+        edit.field = SdfFieldKeys->TimeSamples;
+        addInverse(std::move(edit));
 
     } else {
         VtValue oldValue;
 
         _GetLayer()->QueryTimeSample(path, time, &oldValue);
 
-        UsdUndoManager::instance().addInverse(
-            std::bind(&UsdUndoStateDelegate::invertSetTimeSample, this, path, time, oldValue));
+        UsdUndoInverseEdit edit;
+        edit.op = UsdUndoInverseEdit::Op::kSetTimeSample;
+        edit.path = path;
+        edit.field = SdfFieldKeys->TimeSamples;
+        edit.time = time;
+        edit.value = std::move(oldValue);
+        addInverse(std::move(edit));
     }
 }
 
@@ -18,6 +18,7 @@
 #define MAYAUSD_UNDO_UNDOSTATE_DELEGATE_H
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/undo/UsdUndoableItem.h>
 
 #include <pxr/usd/sdf/data.h>
 #include <pxr/usd/sdf/layerStateDelegate.h>
@@ -35,9 +36,9 @@ TF_DECLARE_WEAK_AND_REF_PTRS(UsdUndoStateDelegate);
 /*!
     The state delegate is invoked on every authoring operation on a layer.
 
-    There exist exactly one invert function for every authoring operation. These invert functions
+    There exist exactly one inverse edit for every authoring operation. These inverse edits
    are collected by UsdUndoManager::addInverse() call which then will be transfered to an
-   UsdUndoableItem object when UsdUndoBlock expires.
+   UsdUndoableItem object when UsdUndoBlock expires, and replayed by invert().
 */
 class MAYAUSD_CORE_PUBLIC UsdUndoStateDelegate : public SdfLayerStateDelegateBase
 {
@@ -48,6 +49,14 @@ public:
     static UsdUndoStateDelegateRefPtr New();
 
 private:
+    friend class UsdUndoableItem;
+
+    // replays a recorded inverse edit on the layer.
+    void invert(const UsdUndoInverseEdit& edit);
+
+    // records the inverse of an edit of the layer.
+    void addInverse(UsdUndoInverseEdit&& edit);
+
     void invertSetField(const SdfPath& path, const TfToken& fieldName, const VtValue& inverse);
     void invertCreateSpec(const SdfPath& path, bool inert);
     void invertDeleteSpec(
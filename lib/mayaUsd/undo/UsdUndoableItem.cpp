@@ -17,11 +17,72 @@
 #include "UsdUndoableItem.h"
 
 #include <mayaUsd/undo/UsdUndoBlock.h>
+#include <mayaUsd/undo/UsdUndoStateDelegate.h>
 
 #include <pxr/usd/sdf/changeBlock.h>
 
+#include <atomic>
+
 namespace MAYAUSD_NS_DEF {
 
+namespace {
+std::atomic<size_t> _totalMemoryUsage { 0 };
+} // namespace
+
+UsdUndoableItem::~UsdUndoableItem() { _totalMemoryUsage -= _memoryUsage; }
+
+UsdUndoableItem::UsdUndoableItem(const UsdUndoableItem& other)
+    : _inverseEdits(other._inverseEdits)
+    , _memoryUsage(other._memoryUsage)
+    , _truncated(other._truncated)
+{
+    _totalMemoryUsage += _memoryUsage;
+}
+
+UsdUndoableItem& UsdUndoableItem::operator=(const UsdUndoableItem& other)
+{
+    if (this != &other) {
+        InverseEdits edits(other._inverseEdits);
+        setEdits(std::move(edits), other._memoryUsage, other._truncated);
+    }
+    return *this;
+}
+
+UsdUndoableItem::UsdUndoableItem(UsdUndoableItem&& other)
+    : _inverseEdits(std::move(other._inverseEdits))
+    , _memoryUsage(other._memoryUsage)
+    , _truncated(other._truncated)
+{
+    other._inverseEdits.clear();
+    other._memoryUsage = 0;
+    other._truncated = false;
+}
+
+UsdUndoableItem& UsdUndoableItem::operator=(UsdUndoableItem&& other)
+{
+    if (this != &other) {
+        _totalMemoryUsage -= _memoryUsage;
+        _inverseEdits = std::move(other._inverseEdits);
+        _memoryUsage = other._memoryUsage;
+        _truncated = other._truncated;
+        other._inverseEdits.clear();
+        other._memoryUsage = 0;
+        other._truncated = false;
+    }
+    return *this;
+}
+
+size_t UsdUndoableItem::totalMemoryUsage() { return _totalMemoryUsage; }
+
+void UsdUndoableItem::setEdits(InverseEdits&& edits, size_t memoryUsage, bool truncated)
+{
+    _totalMemoryUsage -= _memoryUsage;
+    _inverseEdits = std::move(edits);
+    _memoryUsage = memoryUsage;
+    _truncated = truncated;
+    _totalMemoryUsage += _memoryUsage;
+}
+
 void UsdUndoableItem::undo() { doInvert(); }
 
 void UsdUndoableItem::redo() { doInvert(); }
@@ -33,13 +94,23 @@ void UsdUndoableItem::doInvert()
                         "stack.");
     }
 
+    if (_truncated) {
+        TF_WARN("The USD edits exceeded the undo memory limit and cannot be undone.");
+        return;
+    }
+
+    // move the edits out, the undo block collects the inverse of the inversion
+    // into this item.
+    const InverseEdits inverseEdits = std::move(_inverseEdits);
+    setEdits({}, 0, false);
+
     UsdUndoBlock undoBlock(this);
 
-    // call invert functions in reverse order
+    // replay the inverse edits in reverse order
     {
         SdfChangeBlock changeBlock;
-        for (auto it = _invertFuncs.rbegin(); it != _invertFuncs.rend(); ++it) {
-            (*it)();
+        for (auto it = inverseEdits.rbegin(); it != inverseEdits.rend(); ++it) {
+            it->delegate->invert(*it);
         }
     }
 }
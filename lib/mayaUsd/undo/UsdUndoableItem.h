@@ -19,43 +19,98 @@
 
 #include <mayaUsd/base/api.h>
 
-#include <functional>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/sdf/data.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/types.h>
+
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace MAYAUSD_NS_DEF {
 
+class UsdUndoStateDelegate;
+
+//! \brief Inverse of a single layer edit.
+/*!
+    Compact record of the edit that restores the layer state, replayed by
+    UsdUndoStateDelegate::invert(). Paths and tokens are interned handles, and the
+    value to restore is only set by the ops that need one.
+*/
+struct UsdUndoInverseEdit
+{
+    enum class Op : uint8_t
+    {
+        kSetField,               //!< Set field to value.
+        kSetFieldDictValueByKey, //!< Set the key path of field to value.
+        kSetTimeSample,          //!< Set the time sample at time to value.
+        kDeleteSpec,             //!< Delete the spec at path.
+        kCreateSpec,             //!< Recreate the spec at path from data.
+        kMoveSpec,               //!< Move the spec at path back to otherPath.
+        kPopTokenChild,          //!< Pop token from the children field.
+        kPopPathChild,           //!< Pop otherPath from the children field.
+        kPushTokenChild,         //!< Push token to the children field.
+        kPushPathChild           //!< Push otherPath to the children field.
+    };
+
+    UsdUndoStateDelegate* delegate { nullptr };
+    Op                    op { Op::kSetField };
+    bool                  inert { false };
+    PXR_NS::SdfSpecType   specType { PXR_NS::SdfSpecTypeUnknown };
+    double                time { 0.0 };
+    PXR_NS::SdfPath       path;
+    PXR_NS::SdfPath       otherPath;
+    PXR_NS::TfToken       field;
+    PXR_NS::TfToken       token;
+    PXR_NS::VtValue       value;
+    PXR_NS::SdfDataRefPtr data;
+};
+
 //! \brief UsdUndoableItem
 /*!
-    This class stores the list of inverse edit functions that are invoked
+    This class stores the list of inverse edits that are replayed
     on undo() / redo() call. This is the object that must be placed in Maya's undo stack.
 */
 class MAYAUSD_CORE_PUBLIC UsdUndoableItem
 {
 public:
-    using InvertFunc = std::function<void()>;
-    using InvertFuncs = std::vector<InvertFunc>;
+    using InverseEdits = std::vector<UsdUndoInverseEdit>;
 
     // default constructor/destructor
     UsdUndoableItem() = default;
-    ~UsdUndoableItem() = default;
+    ~UsdUndoableItem();
 
-    // default copy constructor/assignment operator
-    UsdUndoableItem(const UsdUndoableItem&) = default;
-    UsdUndoableItem& operator=(const UsdUndoableItem&) = default;
+    // copy constructor/assignment operator
+    UsdUndoableItem(const UsdUndoableItem&);
+    UsdUndoableItem& operator=(const UsdUndoableItem&);
 
     // move constructor/assignment operator
-    UsdUndoableItem(UsdUndoableItem&&) = default;
-    UsdUndoableItem& operator=(UsdUndoableItem&&) = default;
+    UsdUndoableItem(UsdUndoableItem&&);
+    UsdUndoableItem& operator=(UsdUndoableItem&&);
 
     void undo();
     void redo();
 
+    // returns the estimated memory used by the inverse edits, in bytes.
+    size_t memoryUsage() const { return _memoryUsage; }
+
+    // returns the estimated memory used by all the undoable items, in bytes.
+    static size_t totalMemoryUsage();
+
+    // returns true if the edits exceeded the undo memory limit and were dropped.
+    bool isTruncated() const { return _truncated; }
+
 private:
     friend class UsdUndoManager;
 
     void doInvert();
+    void setEdits(InverseEdits&& edits, size_t memoryUsage, bool truncated);
 
-    InvertFuncs _invertFuncs;
+    InverseEdits _inverseEdits;
+    size_t       _memoryUsage { 0 };
+    bool         _truncated { false };
 };
 
 } // namespace MAYAUSD_NS_DEF
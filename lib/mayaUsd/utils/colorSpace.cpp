@@ -17,6 +17,10 @@
 
 #include <pxr/base/tf/envSetting.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MAYAUSD_NS_DEF {
@@ -36,5 +40,108 @@ bool IsColorManaged()
     return TfGetEnvSetting(PIXMAYA_LINEAR_COLORS);
 }
 
+namespace {
+
+// Piecewise linear table of x^gamma over [0, 1]. It is sampled finely enough
+// for the interpolation error to stay below 1e-5 over [minValue, 1], the
+// colors with a channel outside of that range are converted exactly.
+class GammaTable
+{
+public:
+    static constexpr int size = 4096;
+
+    GammaTable(double gamma, float minValue)
+        : _minValue(minValue)
+    {
+        for (int i = 0; i <= size; ++i) {
+            _values[i] = static_cast<float>(std::pow(static_cast<double>(i) / size, gamma));
+        }
+    }
+
+    template <typename Vec> bool InRange(const Vec& color) const
+    {
+        return color[0] >= _minValue && color[0] <= 1.0f && color[1] >= _minValue
+            && color[1] <= 1.0f && color[2] >= _minValue && color[2] <= 1.0f;
+    }
+
+    float Apply(float value) const
+    {
+        const float x = value * size;
+        const int   i = std::min(static_cast<int>(x), size - 1);
+        return _values[i] + (x - i) * (_values[i + 1] - _values[i]);
+    }
+
+private:
+    float                       _minValue;
+    std::array<float, size + 1> _values;
+};
+
+// Gf converts with a display gamma of 2.2. The slope of x^(1/2.2) is too
+// steep near 0 for the table, so the darkest colors are converted exactly.
+const GammaTable& linearToDisplayTable()
+{
+    static const GammaTable table(1.0 / 2.2, 1.0f / 128.0f);
+    return table;
+}
+
+const GammaTable& displayToLinearTable()
+{
+    static const GammaTable table(2.2, 0.0f);
+    return table;
+}
+
+template <typename Vec, typename ExactFn>
+void convertColors(const GammaTable& table, Vec* colors, size_t count, ExactFn exactFn)
+{
+    for (size_t i = 0; i < count; ++i) {
+        Vec& color = colors[i];
+        if (table.InRange(color)) {
+            color[0] = table.Apply(color[0]);
+            color[1] = table.Apply(color[1]);
+            color[2] = table.Apply(color[2]);
+        } else {
+            color = exactFn(color);
+        }
+    }
+}
+
+} // namespace
+
+void ConvertLinearToMaya(GfVec3f* colors, size_t count)
+{
+    if (!IsColorManaged()) {
+        convertColors(linearToDisplayTable(), colors, count, [](const GfVec3f& color) {
+            return GfConvertLinearToDisplay(color);
+        });
+    }
+}
+
+void ConvertLinearToMaya(GfVec4f* colors, size_t count)
+{
+    if (!IsColorManaged()) {
+        convertColors(linearToDisplayTable(), colors, count, [](const GfVec4f& color) {
+            return GfConvertLinearToDisplay(color);
+        });
+    }
+}
+
+void ConvertMayaToLinear(GfVec3f* colors, size_t count)
+{
+    if (!IsColorManaged()) {
+        convertColors(displayToLinearTable(), colors, count, [](const GfVec3f& color) {
+            return GfConvertDisplayToLinear(color);
+        });
+    }
+}
+
+void ConvertMayaToLinear(GfVec4f* colors, size_t count)
+{
+    if (!IsColorManaged()) {
+        convertColors(displayToLinearTable(), colors, count, [](const GfVec4f& color) {
+            return GfConvertDisplayToLinear(color);
+        });
+    }
+}
+
 } // namespace utils
 } // namespace MAYAUSD_NS_DEF
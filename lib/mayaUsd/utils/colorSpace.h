@@ -19,6 +19,10 @@
 #include <mayaUsd/base/api.h>
 
 #include <pxr/base/gf/gamma.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
+
+#include <cstddef>
 
 /// Helper functions for dealing with colors stored in Maya.
 ///
@@ -60,6 +64,23 @@ template <typename T> T ConvertMayaToLinear(const T& mayaColor)
     return IsColorManaged() ? mayaColor : GfConvertDisplayToLinear(mayaColor);
 }
 
+/// Converts \p count linear colors in place into the Maya color space.
+///
+/// The result matches ConvertLinearToMaya() on each color within 1e-5, but
+/// the colors in the [0, 1] range are converted with a lookup table instead
+/// of a pow() per channel. The alpha of GfVec4f colors is left unchanged.
+MAYAUSD_CORE_PUBLIC
+void ConvertLinearToMaya(PXR_NS::GfVec3f* colors, size_t count);
+MAYAUSD_CORE_PUBLIC
+void ConvertLinearToMaya(PXR_NS::GfVec4f* colors, size_t count);
+
+/// Converts \p count colors in place from the Maya color space into linear
+/// colors. See the bulk ConvertLinearToMaya().
+MAYAUSD_CORE_PUBLIC
+void ConvertMayaToLinear(PXR_NS::GfVec3f* colors, size_t count);
+MAYAUSD_CORE_PUBLIC
+void ConvertMayaToLinear(PXR_NS::GfVec4f* colors, size_t count);
+
 } // namespace utils
 } // namespace MAYAUSD_NS_DEF
 
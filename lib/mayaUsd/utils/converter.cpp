@@ -22,11 +22,14 @@
 #include <maya/MDGModifier.h>
 #include <maya/MDataBlock.h>
 #include <maya/MFnData.h>
+#include <maya/MFnDoubleArrayData.h>
+#include <maya/MFnFloatArrayData.h>
 #include <maya/MFnIntArrayData.h>
 #include <maya/MFnMatrixArrayData.h>
 #include <maya/MFnPointArrayData.h>
 #include <maya/MFnStringData.h>
 #include <maya/MFnUnitAttribute.h>
+#include <maya/MFnVectorArrayData.h>
 
 #include <unordered_map>
 
@@ -53,7 +56,12 @@
 | Matrix4d         | GfMatrix4d            | MFnData::kMatrix,  MFn::kMatrixData                            | MMatrix, MFnMatrixData  | MakeMayaFnData     |
 ||
 | IntArray         | VtArray< int >        | MFnData::kIntArray, MFn::kIntArrayData                | MIntArray, MFnIntArrayData       | MakeMayaFnData     |
+| FloatArray       | VtArray< float >      | MFnData::kFloatArray, MFn::kFloatArrayData            | MFloatArray, MFnFloatArrayData   | MakeMayaFnData     |
+| DoubleArray      | VtArray< double >     | MFnData::kDoubleArray, MFn::kDoubleArrayData          | MDoubleArray, MFnDoubleArrayData | MakeMayaFnData     |
 | Point3fArray     | VtArray< GfVec3f >    | MFnData::kPointArray, MFn::kPointArrayData            | MPointArray, MFnPointArrayData   | MakeMayaFnData     |
+| Point3dArray     | VtArray< GfVec3d >    | MFnData::kPointArray, MFn::kPointArrayData            | MPointArray, MFnPointArrayData   | MakeMayaFnData     |
+| Vector3fArray    | VtArray< GfVec3f >    | MFnData::kVectorArray, MFn::kVectorArrayData          | MVectorArray, MFnVectorArrayData | MakeMayaFnData     |
+| Vector3dArray    | VtArray< GfVec3d >    | MFnData::kVectorArray, MFn::kVectorArrayData          | MVectorArray, MFnVectorArrayData | MakeMayaFnData     |
 | Matrix4dArray    | VtArray< GfMatrix4d > | MFnData::kMatrixArray, MFn::kMatrixArrayData          | MMatrixArray, MFnMatrixArrayData | MakeMayaFnData     |
 
 This table lists currently supported types for array attributes
@@ -319,6 +327,120 @@ template <> struct MakeMayaFnData<MIntArray> : public std::true_type
     }
 };
 
+//! \brief  Type trait for Maya's MFloatArray type providing get and set methods for data handle
+//! and plugs.
+template <> struct MakeMayaFnData<MFloatArray> : public std::true_type
+{
+    using Type = MFloatArray;
+    using FnType = MFnFloatArrayData;
+    enum
+    {
+        kDataType = MFnData::kFloatArray
+    };
+    enum
+    {
+        kApiType = MFn::kFloatArrayData
+    };
+
+    static MObject create(FnType& data) { return data.create(); }
+
+    static void get(const FnType& data, Type& value) { data.copyTo(value); }
+
+    static void set(FnType& data, const Type& value) { data.set(value); }
+
+    static void get(const MDataHandle& handle, Type& value)
+    {
+        MObject dataObj = const_cast<MDataHandle&>(handle).data();
+        FnType  dataFn(dataObj);
+        get(dataFn, value);
+    }
+
+    static void set(MDataHandle& handle, const Type& value)
+    {
+        FnType  dataFn;
+        MObject dataObj = create(dataFn);
+        set(dataFn, value);
+
+        handle.setMObject(dataObj);
+    }
+};
+
+//! \brief  Type trait for Maya's MDoubleArray type providing get and set methods for data handle
+//! and plugs.
+template <> struct MakeMayaFnData<MDoubleArray> : public std::true_type
+{
+    using Type = MDoubleArray;
+    using FnType = MFnDoubleArrayData;
+    enum
+    {
+        kDataType = MFnData::kDoubleArray
+    };
+    enum
+    {
+        kApiType = MFn::kDoubleArrayData
+    };
+
+    static MObject create(FnType& data) { return data.create(); }
+
+    static void get(const FnType& data, Type& value) { data.copyTo(value); }
+
+    static void set(FnType& data, const Type& value) { data.set(value); }
+
+    static void get(const MDataHandle& handle, Type& value)
+    {
+        MObject dataObj = const_cast<MDataHandle&>(handle).data();
+        FnType  dataFn(dataObj);
+        get(dataFn, value);
+    }
+
+    static void set(MDataHandle& handle, const Type& value)
+    {
+        FnType  dataFn;
+        MObject dataObj = create(dataFn);
+        set(dataFn, value);
+
+        handle.setMObject(dataObj);
+    }
+};
+
+//! \brief  Type trait for Maya's MVectorArray type providing get and set methods for data handle
+//! and plugs.
+template <> struct MakeMayaFnData<MVectorArray> : public std::true_type
+{
+    using Type = MVectorArray;
+    using FnType = MFnVectorArrayData;
+    enum
+    {
+        kDataType = MFnData::kVectorArray
+    };
+    enum
+    {
+        kApiType = MFn::kVectorArrayData
+    };
+
+    static MObject create(FnType& data) { return data.create(); }
+
+    static void get(const FnType& data, Type& value) { data.copyTo(value); }
+
+    static void set(FnType& data, const Type& value) { data.set(value); }
+
+    static void get(const MDataHandle& handle, Type& value)
+    {
+        MObject dataObj = const_cast<MDataHandle&>(handle).data();
+        FnType  dataFn(dataObj);
+        get(dataFn, value);
+    }
+
+    static void set(MDataHandle& handle, const Type& value)
+    {
+        FnType  dataFn;
+        MObject dataObj = create(dataFn);
+        set(dataFn, value);
+
+        handle.setMObject(dataObj);
+    }
+};
+
 //! \brief  Type trait for Maya's MPointArray type providing get and set methods for data handle
 //! and plugs.
 template <> struct MakeMayaFnData<MPointArray> : public std::true_type
@@ -840,11 +962,12 @@ struct MArrayDataHandleConvert
 
         USD_TypeArray tmpDst;
         tmpDst.resize(srcSize);
+        USD_Type* dstData = tmpDst.data();
 
         srcArray.jumpToElement(0);
         for (unsigned int i = 0; i < srcSize; i++) {
             MDataHandle srcHandle = srcArray.inputValue();
-            ElementConverter::convert(srcHandle, tmpDst[i], args);
+            ElementConverter::convert(srcHandle, dstData[i], args);
 
             srcArray.next();
         }
@@ -879,11 +1002,12 @@ struct MArrayDataHandleConvert
 
         USD_TypeArray tmpDst;
         tmpDst.resize(srcSize);
+        USD_Type* dstData = tmpDst.data();
 
         srcArray.jumpToElement(0);
         for (unsigned int i = 0; i < srcSize; i++) {
             MDataHandle srcHandle = srcArray.inputValue();
-            ElementConverter::convert(srcHandle, tmpDst[i], args);
+            ElementConverter::convert(srcHandle, dstData[i], args);
 
             srcArray.next();
         }
@@ -925,10 +1049,11 @@ struct MArrayPlugConvert
 
         USD_TypeArray tmpDst;
         tmpDst.resize(srcSize);
+        USD_Type* dstData = tmpDst.data();
 
         for (unsigned int i = 0; i < srcSize; i++) {
             MPlug srcElement = src.elementByPhysicalIndex(i);
-            ElementConverter::convert(srcElement, tmpDst[i], args);
+            ElementConverter::convert(srcElement, dstData[i], args);
         }
 
         dst.Set<USD_TypeArray>(tmpDst, args._timeCode);
@@ -966,10 +1091,11 @@ struct MArrayPlugConvert
 
         USD_TypeArray tmpDst;
         tmpDst.resize(srcSize);
+        USD_Type* dstData = tmpDst.data();
 
         for (unsigned int i = 0; i < srcSize; i++) {
             MPlug srcElement = src.elementByPhysicalIndex(i);
-            ElementConverter::convert(srcElement, tmpDst[i], args);
+            ElementConverter::convert(srcElement, dstData[i], args);
         }
 
         dst = tmpDst;
@@ -1070,7 +1196,14 @@ struct Converter::GenerateConverters
             converters, SdfValueTypeNames->Color3d);
 
         createConverter<MIntArray, VtArray<int>>(converters, SdfValueTypeNames->IntArray);
+        createConverter<MFloatArray, VtArray<float>>(converters, SdfValueTypeNames->FloatArray);
+        createConverter<MDoubleArray, VtArray<double>>(converters, SdfValueTypeNames->DoubleArray);
         createConverter<MPointArray, VtArray<GfVec3f>>(converters, SdfValueTypeNames->Point3fArray);
+        createConverter<MPointArray, VtArray<GfVec3d>>(converters, SdfValueTypeNames->Point3dArray);
+        createConverter<MVectorArray, VtArray<GfVec3f>>(
+            converters, SdfValueTypeNames->Vector3fArray);
+        createConverter<MVectorArray, VtArray<GfVec3d>>(
+            converters, SdfValueTypeNames->Vector3dArray);
         createConverter<MMatrixArray, VtArray<GfMatrix4d>>(
             converters, SdfValueTypeNames->Matrix4dArray);
 
@@ -26,6 +26,8 @@
 #include <pxr/usd/usd/timeCode.h>
 
 #include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
 #include <maya/MFnMatrixData.h>
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnTypedAttribute.h>
@@ -36,6 +38,7 @@
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
 #include <maya/MString.h>
+#include <maya/MVectorArray.h>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -419,24 +422,54 @@ template <> struct TypedConverter<MMatrix, GfMatrix4d>
     }
 };
 
+//! \brief  Bulk conversion between Maya arrays of scalars and VtArray, copying contiguous
+//! storage in one call instead of element by element.
+template <class MAYA_ArrayType, class USD_ElementType> struct TypedScalarArrayConverter
+{
+    static void convert(const VtArray<USD_ElementType>& src, MAYA_ArrayType& dst)
+    {
+        dst = MAYA_ArrayType(src.cdata(), static_cast<unsigned int>(src.size()));
+    }
+    static void convert(const MAYA_ArrayType& src, VtArray<USD_ElementType>& dst)
+    {
+        dst.resize(src.length());
+        if (!dst.empty())
+            src.get(dst.data());
+    }
+};
+
 //! \brief  Specialization of TypedConverter for MIntArray <--> VtArray<int>
-template <> struct TypedConverter<MIntArray, VtArray<int>>
+template <>
+struct TypedConverter<MIntArray, VtArray<int>> : TypedScalarArrayConverter<MIntArray, int>
+{
+};
+
+//! \brief  Specialization of TypedConverter for MFloatArray <--> VtArray<float>
+template <>
+struct TypedConverter<MFloatArray, VtArray<float>> : TypedScalarArrayConverter<MFloatArray, float>
+{
+};
+
+//! \brief  Specialization of TypedConverter for MDoubleArray <--> VtArray<double>
+template <>
+struct TypedConverter<MDoubleArray, VtArray<double>>
+    : TypedScalarArrayConverter<MDoubleArray, double>
+{
+};
+
+//! \brief  Specialization of TypedConverter for MDoubleArray <--> VtArray<float>. Maya converts
+//! the contiguous storage in one call.
+template <> struct TypedConverter<MDoubleArray, VtArray<float>>
 {
-    static void convert(const VtArray<int>& src, MIntArray& dst)
+    static void convert(const VtArray<float>& src, MDoubleArray& dst)
     {
-        const size_t srcSize = src.size();
-        dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            dst[i] = src[i];
-        }
+        dst = MDoubleArray(src.cdata(), static_cast<unsigned int>(src.size()));
     }
-    static void convert(const MIntArray& src, VtArray<int>& dst)
+    static void convert(const MDoubleArray& src, VtArray<float>& dst)
     {
-        const size_t srcSize = src.length();
-        dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            dst[i] = src[i];
-        }
+        dst.resize(src.length());
+        if (!dst.empty())
+            src.get(dst.data());
     }
 };
 
@@ -445,39 +478,110 @@ template <> struct TypedConverter<MPointArray, VtArray<GfVec3f>>
 {
     static void convert(const VtArray<GfVec3f>& src, MPointArray& dst)
     {
-        const size_t srcSize = src.size();
+        const unsigned int srcSize = static_cast<unsigned int>(src.size());
+        const GfVec3f*     srcData = src.cdata();
         dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
+        for (unsigned int i = 0; i < srcSize; i++) {
+            TypedConverter<MPoint, GfVec3f>::convert(srcData[i], dst[i]);
         }
     }
     static void convert(const MPointArray& src, VtArray<GfVec3f>& dst)
     {
-        const size_t srcSize = src.length();
+        const unsigned int srcSize = src.length();
         dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
+        GfVec3f* dstData = dst.data();
+        for (unsigned int i = 0; i < srcSize; i++) {
+            TypedConverter<MPoint, GfVec3f>::convert(src[i], dstData[i]);
         }
     }
 };
 
+//! \brief  Specialization of TypedConverter for MPointArray <--> VtArray<GfVec3d>
+template <> struct TypedConverter<MPointArray, VtArray<GfVec3d>>
+{
+    static void convert(const VtArray<GfVec3d>& src, MPointArray& dst)
+    {
+        const unsigned int srcSize = static_cast<unsigned int>(src.size());
+        const GfVec3d*     srcData = src.cdata();
+        dst.setLength(srcSize);
+        for (unsigned int i = 0; i < srcSize; i++) {
+            MPoint& dstPoint = dst[i];
+            dstPoint.x = srcData[i][0];
+            dstPoint.y = srcData[i][1];
+            dstPoint.z = srcData[i][2];
+        }
+    }
+    static void convert(const MPointArray& src, VtArray<GfVec3d>& dst)
+    {
+        const unsigned int srcSize = src.length();
+        dst.resize(srcSize);
+        GfVec3d* dstData = dst.data();
+        for (unsigned int i = 0; i < srcSize; i++) {
+            const MPoint& srcPoint = src[i];
+            dstData[i].Set(srcPoint.x, srcPoint.y, srcPoint.z);
+        }
+    }
+};
+
+//! \brief  Specialization of TypedConverter for MVectorArray <--> VtArray<GfVec3d>. Both store
+//! three contiguous doubles per element, so the storage is copied in one call.
+template <> struct TypedConverter<MVectorArray, VtArray<GfVec3d>>
+{
+    static_assert(sizeof(GfVec3d) == sizeof(double[3]), "GfVec3d must be three packed doubles");
+
+    static void convert(const VtArray<GfVec3d>& src, MVectorArray& dst)
+    {
+        dst = MVectorArray(
+            reinterpret_cast<const double(*)[3]>(src.cdata()),
+            static_cast<unsigned int>(src.size()));
+    }
+    static void convert(const MVectorArray& src, VtArray<GfVec3d>& dst)
+    {
+        dst.resize(src.length());
+        if (!dst.empty())
+            src.get(reinterpret_cast<double(*)[3]>(dst.data()));
+    }
+};
+
+//! \brief  Specialization of TypedConverter for MVectorArray <--> VtArray<GfVec3f>. Maya converts
+//! the three contiguous floats per element in one call.
+template <> struct TypedConverter<MVectorArray, VtArray<GfVec3f>>
+{
+    static_assert(sizeof(GfVec3f) == sizeof(float[3]), "GfVec3f must be three packed floats");
+
+    static void convert(const VtArray<GfVec3f>& src, MVectorArray& dst)
+    {
+        dst = MVectorArray(
+            reinterpret_cast<const float(*)[3]>(src.cdata()),
+            static_cast<unsigned int>(src.size()));
+    }
+    static void convert(const MVectorArray& src, VtArray<GfVec3f>& dst)
+    {
+        dst.resize(src.length());
+        if (!dst.empty())
+            src.get(reinterpret_cast<float(*)[3]>(dst.data()));
+    }
+};
+
 //! \brief  Specialization of TypedConverter for MMatrixArray <--> VtArray<GfMatrix4d>
 template <> struct TypedConverter<MMatrixArray, VtArray<GfMatrix4d>>
 {
     static void convert(const VtArray<GfMatrix4d>& src, MMatrixArray& dst)
     {
-        const size_t srcSize = src.size();
+        const unsigned int srcSize = static_cast<unsigned int>(src.size());
+        const GfMatrix4d*  srcData = src.cdata();
         dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dst[i]);
+        for (unsigned int i = 0; i < srcSize; i++) {
+            TypedConverter<MMatrix, GfMatrix4d>::convert(srcData[i], dst[i]);
         }
     }
     static void convert(const MMatrixArray& src, VtArray<GfMatrix4d>& dst)
     {
-        const size_t srcSize = src.length();
+        const unsigned int srcSize = src.length();
         dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dst[i]);
+        GfMatrix4d* dstData = dst.data();
+        for (unsigned int i = 0; i < srcSize; i++) {
+            TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dstData[i]);
         }
     }
 };
@@ -25,6 +25,10 @@
 
 #include <ghc/filesystem.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_ENV_SETTING(
@@ -40,6 +44,12 @@ TF_DEFINE_ENV_SETTING(
     "This env flag controls the granularity of TF error/warning/status messages "
     "being displayed in Maya.");
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_DIAGNOSTICS_MAX_PER_IDLE,
+    100,
+    "Maximum number of distinct statuses and warnings from secondary threads "
+    "displayed in Maya on each idle. The remaining ones are only counted.");
+
 // Globally-shared delegate. Uses shared_ptr so we can have weak ptrs.
 static std::shared_ptr<UsdMayaDiagnosticDelegate> _sharedDelegate;
 
@@ -96,6 +106,7 @@ static bool _IsDiagnosticBatchingEnabled() { return TfGetEnvSetting(PIXMAYA_DIAG
 
 UsdMayaDiagnosticDelegate::UsdMayaDiagnosticDelegate()
     : _batchCount(0)
+    , _idleFlushPending(false)
 {
     TfDiagnosticMgr::GetInstance().AddDelegate(this);
 }
@@ -108,6 +119,7 @@ UsdMayaDiagnosticDelegate::~UsdMayaDiagnosticDelegate()
     // is gone.
     _FlushBatch();
     TfDiagnosticMgr::GetInstance().RemoveDelegate(this);
+    _FlushQueuedDiagnostics();
 }
 
 void UsdMayaDiagnosticDelegate::IssueError(const TfError& err)
@@ -135,7 +147,7 @@ void UsdMayaDiagnosticDelegate::IssueStatus(const TfStatus& status)
     if (ArchIsMainThread()) {
         MGlobal::displayInfo(diagnosticMessage);
     } else {
-        std::cerr << diagnosticMessage << std::endl;
+        _QueueDiagnostic(false, diagnosticMessage);
     }
 }
 
@@ -150,7 +162,7 @@ void UsdMayaDiagnosticDelegate::IssueWarning(const TfWarning& warning)
     if (ArchIsMainThread()) {
         MGlobal::displayWarning(diagnosticMessage);
     } else {
-        std::cerr << diagnosticMessage << std::endl;
+        _QueueDiagnostic(true, diagnosticMessage);
     }
 }
 
@@ -254,6 +266,83 @@ void UsdMayaDiagnosticDelegate::_FlushBatch()
     }
 }
 
+void UsdMayaDiagnosticDelegate::_QueueDiagnostic(bool isWarning, const MString& message)
+{
+    _queuedDiagnostics.push({ isWarning, message.asChar() });
+
+    // Only one idle task is needed for all the diagnostics queued before it runs.
+    if (!_idleFlushPending.exchange(true)) {
+        MGlobal::executeTaskOnIdle(_FlushQueuedDiagnosticsOnIdle);
+    }
+}
+
+/* static */
+void UsdMayaDiagnosticDelegate::_FlushQueuedDiagnosticsOnIdle(void*)
+{
+    // The delegate may have been removed, and its queue flushed, since the
+    // task was posted.
+    if (std::shared_ptr<UsdMayaDiagnosticDelegate> ptr = _sharedDelegate) {
+        ptr->_FlushQueuedDiagnostics();
+    }
+}
+
+void UsdMayaDiagnosticDelegate::_FlushQueuedDiagnostics()
+{
+    TF_AXIOM(ArchIsMainThread());
+
+    // Clear the flag first, so that diagnostics queued while flushing post
+    // another idle task.
+    _idleFlushPending = false;
+
+    // Merge identical messages, keeping the order in which they were first
+    // issued.
+    struct MergedDiagnostic
+    {
+        _QueuedDiagnostic diagnostic;
+        size_t            count;
+    };
+    std::vector<MergedDiagnostic>           merged;
+    std::unordered_map<std::string, size_t> mergedIndices;
+
+    _QueuedDiagnostic diagnostic;
+    while (_queuedDiagnostics.try_pop(diagnostic)) {
+        std::string key = (diagnostic.isWarning ? "W" : "S") + diagnostic.message;
+        const auto  inserted = mergedIndices.emplace(std::move(key), merged.size());
+        if (inserted.second) {
+            merged.push_back({ std::move(diagnostic), 1 });
+        } else {
+            ++merged[inserted.first->second].count;
+        }
+    }
+
+    const size_t maxDisplayed = static_cast<size_t>(
+        std::max(0, TfGetEnvSetting(MAYAUSD_DIAGNOSTICS_MAX_PER_IDLE)));
+    const size_t numDisplayed = std::min(merged.size(), maxDisplayed);
+    for (size_t i = 0; i < numDisplayed; ++i) {
+        const MergedDiagnostic& item = merged[i];
+        const std::string       suffix = item.count == 1
+                  ? std::string()
+                  : TfStringPrintf(" -- repeated %zu times", item.count);
+        const MString message = (item.diagnostic.message + suffix).c_str();
+        if (item.diagnostic.isWarning) {
+            MGlobal::displayWarning(message);
+        } else {
+            MGlobal::displayInfo(message);
+        }
+    }
+
+    if (numDisplayed < merged.size()) {
+        size_t numSkipped = 0;
+        for (size_t i = numDisplayed; i < merged.size(); ++i) {
+            numSkipped += merged[i].count;
+        }
+        const std::string message = TfStringPrintf(
+            "%zu more diagnostic messages from secondary threads were not displayed.",
+            numSkipped);
+        MGlobal::displayWarning(message.c_str());
+    }
+}
+
 UsdMayaDiagnosticBatchContext::UsdMayaDiagnosticBatchContext()
     : _delegate(_IsDiagnosticBatchingEnabled() ? _sharedDelegate : nullptr)
 {
@@ -24,8 +24,11 @@
 
 #include <maya/MGlobal.h>
 
+#include <tbb/concurrent_queue.h>
+
 #include <atomic>
 #include <memory>
+#include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -39,10 +42,12 @@ class UsdMayaDiagnosticBatchContext;
 ///
 /// The IssueError(), IssueStatus(), etc. functions are thread-safe, since Tf
 /// may issue diagnostics from secondary threads. Note that, when not batching,
-/// secondary threads' diagnostic messages are posted to stderr instead of to
-/// the Maya script window. When batching, secondary threads' diagnostic
-/// messages will be posted by the main thread to the Maya script window when
-/// batching ends.
+/// secondary threads' statuses and warnings are queued without locking and
+/// posted to the Maya script window by the main thread on idle, with identical
+/// messages merged and a limited number of messages per idle; their errors are
+/// posted to stderr. When batching, secondary threads' diagnostic messages
+/// will be posted by the main thread to the Maya script window when batching
+/// ends.
 ///
 /// Installing and removing this diagnostic delegate is not thread-safe, and
 /// must be done only on the main thread.
@@ -82,11 +87,25 @@ private:
     std::unique_ptr<UsdUtilsCoalescingDiagnosticDelegate> _batchedStatuses;
     std::unique_ptr<UsdUtilsCoalescingDiagnosticDelegate> _batchedWarnings;
 
+    /// Statuses and warnings issued on secondary threads when not batching,
+    /// waiting to be posted on idle by the main thread.
+    struct _QueuedDiagnostic
+    {
+        bool        isWarning;
+        std::string message;
+    };
+    tbb::concurrent_queue<_QueuedDiagnostic> _queuedDiagnostics;
+    std::atomic_bool                         _idleFlushPending;
+
     UsdMayaDiagnosticDelegate();
 
     void _StartBatch();
     void _EndBatch();
     void _FlushBatch();
+
+    void        _QueueDiagnostic(bool isWarning, const MString& message);
+    void        _FlushQueuedDiagnostics();
+    static void _FlushQueuedDiagnosticsOnIdle(void*);
 };
 
 /// As long as a batch context remains alive (process-wide), the
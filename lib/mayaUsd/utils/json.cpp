@@ -68,7 +68,7 @@ MDagPath convertToDagPath(const PXR_NS::JsValue& value)
     return PXR_NS::UsdMayaUtil::nameToDagPath(convertToString(value));
 }
 
-PXR_NS::JsArray convertToArray(const PXR_NS::JsValue& value)
+const PXR_NS::JsArray& convertToArray(const PXR_NS::JsValue& value)
 {
     if (!value.IsArray())
         throw std::runtime_error(invalidJson);
@@ -76,7 +76,7 @@ PXR_NS::JsArray convertToArray(const PXR_NS::JsValue& value)
     return value.GetJsArray();
 }
 
-PXR_NS::JsObject convertToObject(const PXR_NS::JsValue& value)
+const PXR_NS::JsObject& convertToObject(const PXR_NS::JsValue& value)
 {
     if (!value.IsObject())
         throw std::runtime_error(invalidJson);
@@ -84,7 +84,8 @@ PXR_NS::JsObject convertToObject(const PXR_NS::JsValue& value)
     return value.GetJsObject();
 }
 
-PXR_NS::JsValue convertJsonKeyToValue(const PXR_NS::JsObject& object, const std::string& key)
+const PXR_NS::JsValue&
+convertJsonKeyToValue(const PXR_NS::JsObject& object, const std::string& key)
 {
     const auto pos = object.find(key);
     if (pos == object.end())
@@ -47,11 +47,15 @@ MAYAUSD_CORE_PUBLIC
 Ufe::Path convertToUfePath(const PXR_NS::JsValue& value);
 MAYAUSD_CORE_PUBLIC
 MDagPath convertToDagPath(const PXR_NS::JsValue& value);
+
+// The following functions return references into their argument, to avoid
+// copying whole JSON sub-trees while reading them.
 MAYAUSD_CORE_PUBLIC
-PXR_NS::JsArray convertToArray(const PXR_NS::JsValue& value);
+const PXR_NS::JsArray& convertToArray(const PXR_NS::JsValue& value);
 MAYAUSD_CORE_PUBLIC
-PXR_NS::JsObject convertToObject(const PXR_NS::JsValue& value);
+const PXR_NS::JsObject& convertToObject(const PXR_NS::JsValue& value);
 MAYAUSD_CORE_PUBLIC
-PXR_NS::JsValue convertJsonKeyToValue(const PXR_NS::JsObject& object, const std::string& key);
+const PXR_NS::JsValue&
+convertJsonKeyToValue(const PXR_NS::JsObject& object, const std::string& key);
 
 } // namespace MAYAUSD_NS_DEF
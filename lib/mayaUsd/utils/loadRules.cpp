@@ -16,15 +16,41 @@
 
 #include "loadRules.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace MAYAUSD_NS_DEF {
 
+namespace {
+
+using PathRule = std::pair<PXR_NS::SdfPath, PXR_NS::UsdStageLoadRules::Rule>;
+using PathRules = std::vector<PathRule>;
+using PathRulesRange = std::pair<PathRules::const_iterator, PathRules::const_iterator>;
+
+// The load rules are kept sorted by path, so the rules of a path and of all its descendants
+// form a contiguous range starting at the path. Finding it costs a binary search plus the
+// number of rules in the range, instead of a scan of all the rules of the stage.
+PathRulesRange findRulesUnderPath(const PathRules& rules, const PXR_NS::SdfPath& path)
+{
+    auto first = std::lower_bound(
+        rules.begin(), rules.end(), path, [](const PathRule& rule, const PXR_NS::SdfPath& p) {
+            return rule.first < p;
+        });
+    auto last = first;
+    while (last != rules.end() && last->first.HasPrefix(path))
+        ++last;
+    return { first, last };
+}
+
+} // namespace
+
 void duplicateLoadRules(
     PXR_NS::UsdStage&      stage,
     const PXR_NS::SdfPath& fromPath,
     const PXR_NS::SdfPath& destPath)
 {
-    // Note: get a *copy* of the rules since we are going to insert new rules as we iterate.
-    auto loadRules = stage.GetLoadRules();
+    const PXR_NS::UsdStageLoadRules& stageRules = stage.GetLoadRules();
 
     // Retrieve the effective rule for the source path.
     //
@@ -38,7 +64,7 @@ void duplicateLoadRules(
     //
     // In that case, we will have to reproduce that rule at the
     // destination as a path-specific rule.
-    const auto desiredRule = loadRules.GetEffectiveRuleForPath(fromPath);
+    const auto desiredRule = stageRules.GetEffectiveRuleForPath(fromPath);
 
     // Analyze the reasons the source path was loaded or unloaded and
     // replicate them to the destination.
@@ -47,16 +73,20 @@ void duplicateLoadRules(
     // by a rule on itself or a descendent and not from an ancestor. Then we
     // need to duplicate the load or unload rule.
     //
-    // We do this by iterating over all rules and duplicating all rules that
-    // contain the source path to create rules with the destination path.
-
-    auto oldRules = loadRules.GetRules();
-    for (const auto& rule : oldRules) {
-        const PXR_NS::SdfPath& rulePath = rule.first;
-        if (rulePath.HasPrefix(fromPath)) {
-            const auto newPath = rulePath.ReplacePrefix(fromPath, destPath);
-            loadRules.AddRule(newPath, rule.second);
-        }
+    // We do this by duplicating all rules that contain the source path to
+    // create rules with the destination path. Only those rules are visited.
+    const PathRulesRange fromRules = findRulesUnderPath(stageRules.GetRules(), fromPath);
+    if (fromRules.first == fromRules.second
+        && desiredRule == stageRules.GetEffectiveRuleForPath(destPath)) {
+        // Nothing to duplicate: leave the stage untouched.
+        return;
+    }
+
+    // Note: get a *copy* of the rules since we are going to insert new rules.
+    auto loadRules = stageRules;
+    for (auto iter = fromRules.first; iter != fromRules.second; ++iter) {
+        const auto newPath = iter->first.ReplacePrefix(fromPath, destPath);
+        loadRules.AddRule(newPath, iter->second);
     }
 
     // Verify if the effective rule at the destination was covered by the
@@ -86,20 +116,25 @@ void duplicateLoadRules(
 
 void removeRulesForPath(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path)
 {
-    // Note: get a *copy* of the rules since we are going to remove rules.
-    auto loadRules = stage.GetLoadRules();
-    auto rules = loadRules.GetRules();
+    const PXR_NS::UsdStageLoadRules& stageRules = stage.GetLoadRules();
+    const PathRules&                 rules = stageRules.GetRules();
+
+    // Find all rules that match the given path. When there are none,
+    // leave the stage untouched.
+    const PathRulesRange removed = findRulesUnderPath(rules, path);
+    if (removed.first == removed.second)
+        return;
 
-    // Remove all rules that match the given path.
-    auto newEnd = std::remove_if(rules.begin(), rules.end(), [&path](const auto& rule) {
-        const PXR_NS::SdfPath& rulePath = rule.first;
-        return rulePath.HasPrefix(path);
-    });
-    rules.erase(newEnd, rules.end());
+    // Note: build a *copy* of the rules without the removed ones.
+    PathRules newRules;
+    newRules.reserve(rules.size() - std::distance(removed.first, removed.second));
+    newRules.insert(newRules.end(), rules.begin(), removed.first);
+    newRules.insert(newRules.end(), removed.second, rules.end());
 
     // Update the rules in the load rules object and then in the stage
     // since we were operating on a copy.
-    loadRules.SetRules(rules);
+    auto loadRules = stageRules;
+    loadRules.SetRules(newRules);
     stage.SetLoadRules(loadRules);
 }
 
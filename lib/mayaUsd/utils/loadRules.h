@@ -65,6 +65,17 @@ PXR_NS::UsdStageLoadRules createLoadRulesFromText(const MString& text);
 MAYAUSD_CORE_PUBLIC
 bool hasLoadRulesAttribute(const PXR_NS::MayaUsdProxyShapeBase& proxyShape);
 
+/*! \brief verify if the plug is the dynamic attribute for load rules.
+ */
+MAYAUSD_CORE_PUBLIC
+bool isLoadRulesAttribute(const MPlug& plug);
+
+/*! \brief create the dynamic attribute for load rules on the object if it does not exist.
+ *         The attribute is internal, so that reading it goes through the proxy shape.
+ */
+MAYAUSD_CORE_PUBLIC
+MStatus createLoadRulesAttribute(PXR_NS::MayaUsdProxyShapeBase& proxyShape);
+
 /*! \brief copy the stage load rules in a dynamic attribute on the object.
  */
 MAYAUSD_CORE_PUBLIC
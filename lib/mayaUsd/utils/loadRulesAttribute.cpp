@@ -19,10 +19,12 @@
 
 #include <maya/MCommandResult.h>
 #include <maya/MDGModifier.h>
+#include <maya/MFnAttribute.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MGlobal.h>
 #include <maya/MObject.h>
+#include <maya/MPlug.h>
 #include <maya/MString.h>
 
 namespace MAYAUSD_NS_DEF {
@@ -42,19 +44,41 @@ bool hasLoadRulesAttribute(const PXR_NS::MayaUsdProxyShapeBase& proxyShape)
     return hasDynamicAttribute(MFnDependencyNode(proxyObj), loadRulesAttrName);
 }
 
-MStatus copyLoadRulesToAttribute(const PXR_NS::UsdStage& stage, MayaUsdProxyShapeBase& proxyShape)
+bool isLoadRulesAttribute(const MPlug& plug)
+{
+    return plug.partialName(false, false, false, false, false, true) == loadRulesAttrName;
+}
+
+MStatus createLoadRulesAttribute(MayaUsdProxyShapeBase& proxyShape)
 {
     MObject proxyObj = proxyShape.thisMObject();
     if (proxyObj.isNull())
         return MS::kFailure;
 
+    MStatus           status = MS::kSuccess;
     MFnDependencyNode depNode(proxyObj);
-    if (!hasDynamicAttribute(depNode, loadRulesAttrName))
-        createDynamicAttribute(depNode, loadRulesAttrName);
+    if (!hasDynamicAttribute(depNode, loadRulesAttrName)) {
+        status = createDynamicAttribute(depNode, loadRulesAttrName);
+        CHECK_MSTATUS_AND_RETURN_IT(status);
+    }
+
+    // Scenes saved by older versions have a non-internal attribute.
+    MFnAttribute attrFn(depNode.attribute(loadRulesAttrName));
+    if (!attrFn.isInternal())
+        status = attrFn.setInternal(true);
+
+    return status;
+}
+
+MStatus copyLoadRulesToAttribute(const PXR_NS::UsdStage& stage, MayaUsdProxyShapeBase& proxyShape)
+{
+    MStatus status = createLoadRulesAttribute(proxyShape);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    MString loadRulesText = convertLoadRulesToText(stage);
+    MFnDependencyNode depNode(proxyShape.thisMObject());
+    MString           loadRulesText = convertLoadRulesToText(stage);
 
-    MStatus status = setDynamicAttribute(depNode, loadRulesAttrName, loadRulesText);
+    status = setDynamicAttribute(depNode, loadRulesAttrName, loadRulesText);
 
     return status;
 }
@@ -0,0 +1,130 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "memoryReport.h"
+
+#include <mayaUsd/nodes/proxyShapeBase.h>
+#include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
+#include <mayaUsd/utils/stageCache.h>
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/primRange.h>
+
+#include <maya/MFnDependencyNode.h>
+#include <maya/MObject.h>
+#include <maya/MStatus.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Layers unchanged since they were read take about the size of their file,
+// the others are measured by their text serialization.
+size_t _GetLayerBytes(const SdfLayerHandle& layer)
+{
+    if (!layer->IsAnonymous() && !layer->IsDirty()) {
+        const std::string& realPath = layer->GetRealPath();
+        if (TfIsFile(realPath)) {
+            const int64_t fileLength = ArchGetFileLength(realPath.c_str());
+            if (fileLength >= 0) {
+                return static_cast<size_t>(fileLength);
+            }
+        }
+    }
+
+    std::string text;
+    return layer->ExportToString(&text) ? text.size() : 0;
+}
+
+bool _IsInSharedCache(const UsdStageRefPtr& stage)
+{
+    for (UsdStage::InitialLoadSet loadSet :
+         { UsdStage::InitialLoadSet::LoadAll, UsdStage::InitialLoadSet::LoadNone }) {
+        if (UsdMayaStageCache::Get(loadSet, UsdMayaStageCache::ShareMode::Shared).Contains(stage)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+UsdMayaMemoryReport::Totals UsdMayaMemoryReport::GetTotals() const
+{
+    return { { "stagePrims", static_cast<double>(numPrims) },
+             { "layers", static_cast<double>(numLayers) },
+             { "layerBytes", static_cast<double>(layerBytes) },
+             { "sharedStage", sharedStage ? 1.0 : 0.0 },
+             { "cpuCacheBytes", static_cast<double>(renderUsage._cpuBytes) },
+             { "vertexBufferBytes", static_cast<double>(renderUsage._vertexBufferBytes) },
+             { "indexBufferBytes", static_cast<double>(renderUsage._indexBufferBytes) },
+             { "textureBytes", static_cast<double>(renderUsage._textureBytes) },
+             { "shaderInstances", static_cast<double>(renderUsage._numShaders) } };
+}
+
+/* static */
+bool UsdMayaMemoryReport::Compute(
+    const std::string&   shapeName,
+    size_t               maxPrims,
+    UsdMayaMemoryReport* report)
+{
+    MObject shapeObj;
+    MStatus status = UsdMayaUtil::GetMObjectByName(shapeName, shapeObj);
+    if (!status || !report) {
+        return false;
+    }
+
+    const MFnDependencyNode fnNode(shapeObj, &status);
+    const auto* proxyShape = dynamic_cast<const MayaUsdProxyShapeBase*>(fnNode.userNode());
+    if (!status || !proxyShape) {
+        return false;
+    }
+
+    const UsdStageRefPtr stage = proxyShape->getUsdStage();
+    if (!stage) {
+        return false;
+    }
+
+    *report = UsdMayaMemoryReport();
+
+    for (const UsdPrim& prim : stage->TraverseAll()) {
+        TF_UNUSED(prim);
+        ++report->numPrims;
+    }
+    for (const UsdPrim& prototype : stage->GetPrototypes()) {
+        for (const UsdPrim& prim : UsdPrimRange(prototype, UsdPrimAllPrimsPredicate)) {
+            TF_UNUSED(prim);
+            ++report->numPrims;
+        }
+    }
+
+    for (const SdfLayerHandle& layer : stage->GetUsedLayers()) {
+        ++report->numLayers;
+        report->layerBytes += _GetLayerBytes(layer);
+    }
+
+    report->sharedStage = _IsInSharedCache(stage);
+
+    if (const ProxyRenderDelegate* renderDelegate = ProxyRenderDelegate::Find(proxyShape)) {
+        report->renderUsage = renderDelegate->GetMemoryUsage(maxPrims);
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
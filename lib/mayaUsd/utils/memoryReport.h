@@ -0,0 +1,68 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_MEMORY_REPORT_H
+#define PXRUSDMAYA_MEMORY_REPORT_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/render/vp2RenderDelegate/memoryUsage.h>
+
+#include <pxr/pxr.h>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Memory used by a proxy shape, its stage and the VP2 resources drawing it.
+///
+/// USD doesn't expose the memory of composed stages or of the layer data, so
+/// the stage is described by its number of prims and the layers by the size
+/// of their serialized data. The VP2 resources are the ones of the render
+/// delegate of the proxy shape, they are empty when it isn't drawn in VP2.
+struct UsdMayaMemoryReport
+{
+    /// Composed prims, including the prims of the instance prototypes.
+    size_t numPrims = 0;
+
+    /// Layers used by the stage, and the size of their serialized data.
+    size_t numLayers = 0;
+    size_t layerBytes = 0;
+
+    /// Whether the stage is in the shared stage caches.
+    bool sharedStage = false;
+
+    /// Caches, buffers, textures and shaders of the VP2 render delegate.
+    HdVP2MemoryUsage renderUsage;
+
+    using Totals = std::vector<std::pair<std::string, double>>;
+
+    /// Return the name and the value of the totals of the report, excluding
+    /// the prims.
+    MAYAUSD_CORE_PUBLIC
+    Totals GetTotals() const;
+
+    /// Fill \p report for the proxy shape named \p shapeName, keeping the
+    /// \p maxPrims largest prims. Returns false if it isn't a proxy shape with
+    /// a stage.
+    MAYAUSD_CORE_PUBLIC
+    static bool Compute(const std::string& shapeName, size_t maxPrims, UsdMayaMemoryReport* report);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -0,0 +1,47 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "profilingScope.h"
+
+namespace MAYAUSD_NS_DEF {
+
+const int ProfilingScope::fileIOCategory = MProfiler::addCategory(
+#if MAYA_API_VERSION >= 20190000
+    "MayaUsdFileIO",
+    "MayaUsd import and export"
+#else
+    "MayaUsdFileIO"
+#endif
+);
+
+const int ProfilingScope::ufeCategory = MProfiler::addCategory(
+#if MAYA_API_VERSION >= 20190000
+    "MayaUsdUfe",
+    "MayaUsd UFE commands"
+#else
+    "MayaUsdUfe"
+#endif
+);
+
+const int ProfilingScope::primUpdaterCategory = MProfiler::addCategory(
+#if MAYA_API_VERSION >= 20190000
+    "MayaUsdPrimUpdater",
+    "MayaUsd edit as Maya and merge to USD"
+#else
+    "MayaUsdPrimUpdater"
+#endif
+);
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,76 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PROFILINGSCOPE_H
+#define MAYAUSD_PROFILINGSCOPE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/arch/hints.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/trace/collector.h>
+
+#include <maya/MProfiler.h>
+
+namespace MAYAUSD_NS_DEF {
+
+//! \brief Profiling scope reported both to the Maya profiler and to the USD trace collector.
+/*!
+    Drop-in replacement for MProfilingScope. When the USD TraceCollector is
+    enabled, for example with the mayaUsdTrace command, the scope is also
+    recorded as a trace event named after the Maya event, so that the costs of
+    mayaUsd and of USD can be seen on the same timeline. When the collector is
+    disabled, the only overhead over MProfilingScope is an atomic load.
+*/
+class ProfilingScope
+{
+public:
+    ProfilingScope(
+        int                       categoryId,
+        MProfiler::ProfilingColor colorIndex,
+        const char*               eventName,
+        const char*               description = nullptr)
+        : _mayaScope(categoryId, colorIndex, eventName, description)
+    {
+        if (ARCH_UNLIKELY(PXR_NS::TraceCollector::IsEnabled())) {
+            _traceName = PXR_NS::TfToken(eventName);
+            PXR_NS::TraceCollector::GetInstance().BeginEvent(
+                PXR_NS::TraceDynamicKey(_traceName));
+        }
+    }
+
+    ~ProfilingScope()
+    {
+        if (ARCH_UNLIKELY(!_traceName.IsEmpty())) {
+            PXR_NS::TraceCollector::GetInstance().EndEvent(PXR_NS::TraceDynamicKey(_traceName));
+        }
+    }
+
+    ProfilingScope(const ProfilingScope&) = delete;
+    ProfilingScope& operator=(const ProfilingScope&) = delete;
+
+    //! Profiler categories of the scopes that do not belong to a node or a renderer.
+    MAYAUSD_CORE_PUBLIC static const int fileIOCategory;
+    MAYAUSD_CORE_PUBLIC static const int ufeCategory;
+    MAYAUSD_CORE_PUBLIC static const int primUpdaterCategory;
+
+private:
+    MProfilingScope _mayaScope;
+    PXR_NS::TfToken _traceName;
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
@@ -16,6 +16,7 @@
 
 #include "progressBarScope.h"
 
+#include <pxr/base/arch/threads.h>
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/getenv.h>
 
@@ -24,8 +25,15 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MAYAUSD_NS_DEF {
 
-std::unique_ptr<MComputation> ProgressBarScope::progBar;
-int                           ProgressBarScope::totalStepsAdded = 0;
+std::unique_ptr<MComputation>         ProgressBarScope::progBar;
+int                                   ProgressBarScope::totalStepsAdded = 0;
+std::atomic<int>                      ProgressBarScope::pendingSteps { 0 };
+std::chrono::steady_clock::time_point ProgressBarScope::lastUpdateTime;
+
+namespace {
+// Minimum time between two updates of the progress bar.
+constexpr std::chrono::milliseconds minUpdateInterval(50);
+} // namespace
 
 // Create a scope with default values for showProgress and interruptible.
 ProgressBarScope::ProgressBarScope(const int nbSteps, const MString& progressStr)
@@ -56,6 +64,8 @@ ProgressBarScope::ProgressBarScope(
         // and can add extra steps along the way.
         progBar->setProgressRange(0, 100);
         totalStepsAdded = 0;
+        pendingSteps = 0;
+        lastUpdateTime = std::chrono::steady_clock::now();
     }
     addSteps(nbSteps);
 }
@@ -75,6 +85,8 @@ ProgressBarScope::~ProgressBarScope()
 
     // If we created the MComputation we end and delete it.
     if (_created) {
+        updateProgress(true);
+
         // Verify that we advances the number of steps added.
         if (progBar->progress() != totalStepsAdded) {
             TF_WARN("ProgressBarScope: did not advance progress bar correct number of steps.");
@@ -111,8 +123,28 @@ void ProgressBarScope::setProgressString(const MString& progressStr)
 void ProgressBarScope::advance(const int steps /*= 1*/)
 {
     if ((steps != 0) && (progBar != nullptr)) {
-        progBar->setProgress(progBar->progress() + steps);
         _nbSteps -= steps;
+        pendingSteps += steps;
+        updateProgress(false);
+    }
+}
+
+void ProgressBarScope::updateProgress(bool force)
+{
+    // MComputation can only be used from the main thread.
+    if (!ArchIsMainThread()) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && (now - lastUpdateTime) < minUpdateInterval) {
+        return;
+    }
+    lastUpdateTime = now;
+
+    const int steps = pendingSteps.exchange(0);
+    if (steps != 0) {
+        progBar->setProgress(progBar->progress() + steps);
     }
 }
 
@@ -152,9 +184,8 @@ void ProgressBarLoopScope::loopAdvance()
 {
     // If we have run thru the loop the required number of steps we
     // will advance the progress bar.
-    if (++_currLoopCounter == _minProgressStep) {
+    if ((++_currLoopCounter % _minProgressStep) == 0) {
         advance(1);
-        _currLoopCounter = 0;
     }
 }
 
@@ -21,6 +21,8 @@
 #include <maya/MComputation.h>
 #include <maya/MString.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 namespace MAYAUSD_NS_DEF {
@@ -33,6 +35,11 @@ namespace MAYAUSD_NS_DEF {
     which will create the internal MComputation (for displaying progress bar).
     Then in any methods called from this top-level you use the third constructor
     to add steps to the existing scope.
+
+    Scopes must be created on the main thread, but advance() can be called from
+    any thread, for example from a parallel loop: the steps are counted
+    atomically and the Maya progress bar is only updated from the main thread,
+    at most every few milliseconds.
 */
 class MAYAUSD_CORE_PUBLIC ProgressBarScope
 {
@@ -65,14 +72,18 @@ public:
 
     void setProgressString(const MString&);
 
-    // Advance the current progress by n step(s).
+    // Advance the current progress by n step(s). Thread-safe.
     void advance(const int steps = 1);
 
     bool isInterruptRequested() const;
 
 private:
-    bool _created { false };
-    int  _nbSteps { 0 };
+    // Show the pending steps in the progress bar if on the main thread and
+    // enough time passed since the last update, or if forced.
+    static void updateProgress(bool force);
+
+    bool             _created { false };
+    std::atomic<int> _nbSteps { 0 };
 
     // There can be only one progress bar during a given operation.
     static std::unique_ptr<MComputation> progBar;
@@ -80,6 +91,12 @@ private:
     // Keep track of the total number of steps added so at the end we can
     // verify that the progress bar was advanced that many steps.
     static int totalStepsAdded;
+
+    // Steps advanced but not yet shown in the progress bar.
+    static std::atomic<int> pendingSteps;
+
+    // Time of the last progress bar update, to limit the update rate.
+    static std::chrono::steady_clock::time_point lastUpdateTime;
 };
 
 //! \brief Helper class to add steps for a loop to a progress bar.
@@ -104,7 +121,7 @@ public:
     ProgressBarLoopScope& operator=(ProgressBarLoopScope&&) = delete;
 
     // Advance the current progress of the loop by 1 step if we have
-    // run thru the required number of loop iterations.
+    // run thru the required number of loop iterations. Thread-safe.
     void loopAdvance();
 
 private:
@@ -114,7 +131,7 @@ private:
     void addLoopSteps(int loopSize);
 
     // The current loop iteration counter.
-    int _currLoopCounter { 0 };
+    std::atomic<int> _currLoopCounter { 0 };
 
     // Number of loop iterations to perform before advancing progress bar.
     int _minProgressStep { 0 };
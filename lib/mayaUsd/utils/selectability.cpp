@@ -16,8 +16,17 @@
 #include "selectability.h"
 
 #include <mayaUsd/base/tokens.h>
+#include <mayaUsd/listeners/notice.h>
 
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/pathTable.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <algorithm>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -25,19 +34,83 @@ PXR_NAMESPACE_OPEN_SCOPE
  */
 
 namespace {
-// Very simple selectability cache for prims to avoid rechecking the metadata.
-using Data = bool;
-using SelectabilityCache = TfHashMap<UsdPrim, Data, boost::hash<UsdPrim>>;
+// Selectability cache of the prims, per stage, to avoid rechecking the metadata
+// of the prims and their ancestors. The path table keeps the paths in a trie,
+// so that the inherited state of a whole subtree can be invalidated at once.
+enum class CachedState : char
+{
+    kUnknown,
+    kSelectable,
+    kUnselectable
+};
+using StageCache = SdfPathTable<CachedState>;
+using SelectabilityCache = TfHashMap<UsdStageWeakPtr, StageCache, TfHash>;
+
+// Invalidates the cached selectability from the stage notices.
+struct _CacheInvalidator : public TfWeakBase
+{
+    _CacheInvalidator()
+    {
+        TfWeakPtr<_CacheInvalidator> me(this);
+        TfNotice::Register(me, &_CacheInvalidator::OnObjectsChanged);
+        TfNotice::Register(me, &_CacheInvalidator::OnSceneReset);
+    }
+
+    void OnObjectsChanged(const UsdNotice::ObjectsChanged& notice);
+    void OnSceneReset(const UsdMayaSceneResetNotice& notice);
+
+    SelectabilityCache cache;
+};
 
 // Use a function to retrieve the cache, as this exploits the C++ guaranteed
 // initialization of static in funtions.
 SelectabilityCache& getCache()
 {
-    static SelectabilityCache cache;
-    return cache;
+    static _CacheInvalidator invalidator;
+    return invalidator.cache;
+}
+
+void invalidateSubtree(StageCache& stageCache, const SdfPath& path)
+{
+    auto found = stageCache.find(path);
+    if (found != stageCache.end())
+        stageCache.erase(found);
 }
 
-void clearCache() { getCache().clear(); }
+void _CacheInvalidator::OnObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+{
+    auto found = cache.find(notice.GetStage());
+    if (found == cache.end())
+        return;
+
+    StageCache& stageCache = found->second;
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        if (path.IsAbsoluteRootPath() || UsdPrim::IsPrototypePath(path.GetPrimPath())) {
+            // Instance proxies inherit from their prototype, which is not
+            // under the proxy paths.
+            cache.erase(found);
+            return;
+        }
+        if (path.IsPrimPath())
+            invalidateSubtree(stageCache, path);
+    }
+
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        if (!path.IsPrimPath())
+            continue;
+        const TfTokenVector fields = notice.GetChangedFields(path);
+        if (std::find(fields.begin(), fields.end(), MayaUsdMetadata->Selectability)
+            == fields.end())
+            continue;
+        if (UsdPrim::IsPrototypePath(path)) {
+            cache.erase(found);
+            return;
+        }
+        invalidateSubtree(stageCache, path);
+    }
+}
+
+void _CacheInvalidator::OnSceneReset(const UsdMayaSceneResetNotice&) { cache.clear(); }
 
 // Check selectability for a prim and recurse to parent if inheriting.
 bool isSelectableUncached(UsdPrim prim)
@@ -56,7 +129,18 @@ bool isSelectableUncached(UsdPrim prim)
 
 /*! \brief  Do any internal preparation for selection needed.
  */
-void Selectability::prepareForSelection() { clearCache(); }
+void Selectability::prepareForSelection()
+{
+    // The cached selectability is kept across selections, only drop the
+    // caches of the stages that no longer exist.
+    auto& cache = getCache();
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->first)
+            ++it;
+        else
+            it = cache.erase(it);
+    }
+}
 
 /*! \brief  Compute the selectability of a prim, considering inheritance.
  */
@@ -71,13 +155,14 @@ bool Selectability::isSelectable(UsdPrim prim)
     if (!prim.IsValid())
         return true;
 
-    auto&      cache = getCache();
-    const auto pos = cache.find(prim);
-    if (pos != cache.end())
-        return pos->second;
+    StageCache& stageCache = getCache()[prim.GetStage()];
+    const auto  pos = stageCache.find(prim.GetPath());
+    if (pos != stageCache.end() && pos->second != CachedState::kUnknown)
+        return pos->second == CachedState::kSelectable;
 
     const bool selectable = isSelectableUncached(prim);
-    cache[prim] = selectable;
+    stageCache[prim.GetPath()]
+        = selectable ? CachedState::kSelectable : CachedState::kUnselectable;
     return selectable;
 }
 
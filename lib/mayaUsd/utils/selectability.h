@@ -37,6 +37,8 @@ public:
     };
 
     /*! \brief  Prepare any internal data needed for selection prior to selection queries.
+     *
+     *  The selectability is cached per stage until the stage notices invalidate it.
      */
     static void prepareForSelection();
 
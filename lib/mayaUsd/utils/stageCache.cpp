@@ -17,10 +17,14 @@
 
 #include <mayaUsd/listeners/notice.h>
 
+#include <pxr/base/work/dispatcher.h>
 #include <pxr/usd/sdf/attributeSpec.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/layerUtils.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/relationshipSpec.h>
+#include <pxr/usd/sdf/variantSetSpec.h>
+#include <pxr/usd/sdf/variantSpec.h>
 #include <pxr/usd/usd/stageCache.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
@@ -33,6 +37,8 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -41,6 +47,105 @@ namespace {
 static std::map<std::string, SdfLayerRefPtr> _sharedSessionLayers;
 static std::mutex                            _sharedSessionLayersMutex;
 
+// Opens layers on worker threads and holds them until they are released.
+class _LayerPrefetcher
+{
+public:
+    void Prefetch(const std::string& layerPath, bool withPayloads)
+    {
+        if (layerPath.empty()) {
+            return;
+        }
+        {
+            // A layer is opened again only to follow the payloads it skipped.
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto                        found = _requestedPaths.find(layerPath);
+            if (found != _requestedPaths.end() && (found->second || !withPayloads)) {
+                return;
+            }
+            _requestedPaths[layerPath] = withPayloads;
+        }
+        _dispatcher.Run([this, layerPath, withPayloads]() { _Open(layerPath, withPayloads); });
+    }
+
+    void Wait() { _dispatcher.Wait(); }
+
+    void Release()
+    {
+        _dispatcher.Wait();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _requestedPaths.clear();
+        _layers.clear();
+    }
+
+private:
+    // Open the layer and, on other tasks of the dispatcher, the layers it uses.
+    void _Open(const std::string& layerPath, bool withPayloads)
+    {
+        SdfLayerRefPtr layer = SdfLayer::FindOrOpen(layerPath);
+        if (!layer) {
+            return;
+        }
+
+        for (const std::string& sublayerPath : layer->GetSubLayerPaths()) {
+            Prefetch(SdfComputeAssetPathRelativeToLayer(layer, sublayerPath), withPayloads);
+        }
+        for (const SdfPrimSpecHandle& primSpec : layer->GetRootPrims()) {
+            _PrefetchAssets(layer, primSpec, withPayloads);
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _layers.push_back(layer);
+    }
+
+    // Prefetch the assets referenced by the prim spec, its variants and its
+    // descendants.
+    void _PrefetchAssets(
+        const SdfLayerHandle&    layer,
+        const SdfPrimSpecHandle& primSpec,
+        bool                     withPayloads)
+    {
+        for (const SdfReference& ref : primSpec->GetReferenceList().GetAddedOrExplicitItems()) {
+            if (!ref.GetAssetPath().empty()) {
+                Prefetch(
+                    SdfComputeAssetPathRelativeToLayer(layer, ref.GetAssetPath()), withPayloads);
+            }
+        }
+        if (withPayloads) {
+            for (const SdfPayload& payload : primSpec->GetPayloadList().GetAddedOrExplicitItems()) {
+                if (!payload.GetAssetPath().empty()) {
+                    Prefetch(
+                        SdfComputeAssetPathRelativeToLayer(layer, payload.GetAssetPath()),
+                        withPayloads);
+                }
+            }
+        }
+        for (const auto& varSet : primSpec->GetVariantSets()) {
+            for (const SdfVariantSpecHandle& variant : varSet.second->GetVariantList()) {
+                _PrefetchAssets(layer, variant->GetPrimSpec(), withPayloads);
+            }
+        }
+        for (const SdfPrimSpecHandle& child : primSpec->GetNameChildren()) {
+            _PrefetchAssets(layer, child, withPayloads);
+        }
+    }
+
+    // Requested layer paths, with whether their payloads were followed. The
+    // dispatcher is declared last so that its tasks are waited for before the
+    // layers are destroyed.
+    std::unordered_map<std::string, bool> _requestedPaths;
+    std::vector<SdfLayerRefPtr>           _layers;
+    std::mutex                            _mutex;
+    WorkDispatcher                        _dispatcher;
+};
+
+_LayerPrefetcher& getLayerPrefetcher()
+{
+    static _LayerPrefetcher prefetcher;
+    return prefetcher;
+}
+
 struct _OnSceneResetListener : public TfWeakBase
 {
     _OnSceneResetListener()
@@ -52,6 +157,7 @@ struct _OnSceneResetListener : public TfWeakBase
     void OnSceneReset(const UsdMayaSceneResetNotice& notice)
     {
         UsdMayaStageCache::Clear();
+        UsdMayaStageCache::ReleasePrefetchedLayers();
 
         std::lock_guard<std::mutex> lock(_sharedSessionLayersMutex);
         _sharedSessionLayers.clear();
@@ -180,4 +286,24 @@ SdfLayerRefPtr UsdMayaStageCache::GetSharedSessionLayer(
     }
 }
 
+/* static */
+void UsdMayaStageCache::PrefetchLayers(
+    const std::vector<std::string>& rootLayerPaths,
+    UsdStage::InitialLoadSet        loadSet)
+{
+    // Make sure the scene reset listener releasing the layers is registered.
+    GetAllCaches();
+
+    _LayerPrefetcher& prefetcher = getLayerPrefetcher();
+    for (const std::string& layerPath : rootLayerPaths) {
+        prefetcher.Prefetch(layerPath, loadSet == UsdStage::InitialLoadSet::LoadAll);
+    }
+}
+
+/* static */
+void UsdMayaStageCache::WaitForPrefetchedLayers() { getLayerPrefetcher().Wait(); }
+
+/* static */
+void UsdMayaStageCache::ReleasePrefetchedLayers() { getLayerPrefetcher().Release(); }
+
 PXR_NAMESPACE_CLOSE_SCOPE
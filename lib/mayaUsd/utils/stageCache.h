@@ -25,6 +25,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -82,6 +83,28 @@ public:
         const SdfPath&                            rootPath,
         const std::map<std::string, std::string>& variantSelections,
         const TfToken&                            drawMode);
+
+    /// Start opening, on worker threads, the layers at \p rootLayerPaths and
+    /// all the layers they use through sublayers and references. Payloads are
+    /// followed only when \p loadSet is UsdStage::InitialLoadSet::LoadAll.
+    ///
+    /// Layers already requested, for example by another proxy shape of the
+    /// same scene, are not opened again. The opened layers are held in the
+    /// SdfLayer registry until the scene is reset, so that composing the
+    /// stages later finds them with SdfLayer::FindOrOpen().
+    MAYAUSD_CORE_PUBLIC
+    static void PrefetchLayers(
+        const std::vector<std::string>& rootLayerPaths,
+        UsdStage::InitialLoadSet        loadSet = UsdStage::InitialLoadSet::LoadAll);
+
+    /// Wait for the layers requested by PrefetchLayers() to be opened.
+    MAYAUSD_CORE_PUBLIC
+    static void WaitForPrefetchedLayers();
+
+    /// Release the layers held by PrefetchLayers(). Layers used by a stage
+    /// stay alive.
+    MAYAUSD_CORE_PUBLIC
+    static void ReleasePrefetchedLayers();
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
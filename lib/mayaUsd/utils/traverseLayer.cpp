@@ -43,8 +43,11 @@
 
 #include "traverseLayer.h"
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/primSpec.h>
 
+#include <atomic>
+#include <mutex>
 #include <sstream>
 
 namespace {
@@ -112,6 +115,11 @@ void _traverseLayer(
     }
 }
 
+void warnTraversalFailure(const MayaUsd::TraversalFailure& e)
+{
+    TF_WARN("Layer traversal failed for path %s: %s", e.path().GetText(), e.reason().c_str());
+}
+
 } // namespace
 
 namespace MAYAUSD_NS_DEF {
@@ -124,7 +132,77 @@ bool traverseLayer(
     try {
         _traverseLayer(layer, path, fn);
     } catch (const TraversalFailure& e) {
-        TF_WARN("Layer traversal failed for path %s: %s", e.path().GetText(), e.reason().c_str());
+        warnTraversalFailure(e);
+        return false;
+    }
+    return true;
+}
+
+bool traverseLayerInParallel(
+    const PXR_NS::SdfLayerHandle& layer,
+    const PXR_NS::SdfPath&        path,
+    const TraverseLayerFn&        fn,
+    const TraverseLayerFilterFn&  filter)
+{
+    // Once a subtree failed, the others stop calling the traversal function.
+    std::atomic<bool>              failed(false);
+    const MayaUsd::TraverseLayerFn filteredFn
+        = [&fn, &filter, &failed](const PXR_NS::SdfPath& p) {
+              if (failed || (filter && !filter(p))) {
+                  return false;
+              }
+              return fn(p);
+          };
+
+    // Traverse the root serially, collecting its prim children instead of
+    // traversing them.
+    PXR_NS::SdfPathVector primChildren;
+    try {
+        if (!filteredFn(path)) {
+            return true;
+        }
+        const MayaUsd::TraverseLayerFn rootFn
+            = [&path, &filteredFn, &primChildren](const PXR_NS::SdfPath& p) {
+                  if (p == path) {
+                      // Already traversed above.
+                      return true;
+                  }
+                  if (p.IsPrimPath() && p.GetParentPath() == path) {
+                      primChildren.push_back(p);
+                      return false;
+                  }
+                  return filteredFn(p);
+              };
+        _traverseLayer(layer, path, rootFn);
+    } catch (const TraversalFailure& e) {
+        warnTraversalFailure(e);
+        return false;
+    }
+
+    std::mutex      failureMutex;
+    std::string     failureReason;
+    PXR_NS::SdfPath failurePath;
+    PXR_NS::WorkParallelForN(
+        primChildren.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                try {
+                    _traverseLayer(layer, primChildren[i], filteredFn);
+                } catch (const TraversalFailure& e) {
+                    std::lock_guard<std::mutex> lock(failureMutex);
+                    if (!failed) {
+                        failureReason = e.reason();
+                        failurePath = e.path();
+                        failed = true;
+                    }
+                    return;
+                }
+            }
+        },
+        /* grainSize = */ 1);
+
+    if (failed) {
+        warnTraversalFailure(TraversalFailure(failureReason, failurePath));
         return false;
     }
     return true;
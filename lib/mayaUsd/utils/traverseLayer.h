@@ -20,6 +20,7 @@
 
 #include <pxr/usd/sdf/layer.h>
 
+#include <functional>
 #include <stdexcept>
 
 namespace MAYAUSD_NS_DEF {
@@ -72,6 +73,31 @@ bool traverseLayer(
     const PXR_NS::SdfPath&        path,
     const TraverseLayerFn&        fn);
 
+//! \brief Type definition for layer traversal filter.
+//
+// A layer traversal filter returns false to skip the argument path and all
+// its descendants, without calling the traversal function on them.
+typedef std::function<bool(const PXR_NS::SdfPath&)> TraverseLayerFilterFn;
+
+/*! \brief Parallel layer traversal utility.
+
+  Traverses the layer like traverseLayer(), but the subtrees of the prim
+  children of path are traversed in parallel.  The traversal function is
+  called on path first, and parents are still traversed before their children,
+  but there is no ordering between sibling prim subtrees, so \p fn must be
+  thread-safe.  The optional \p filter is called before \p fn on each path to
+  skip subtrees early, and must be thread-safe too.
+
+  Catches the TraversalFailure exception, and returns false on traversal
+  failure.  After a failure, the remaining subtrees are not traversed.
+ */
+MAYAUSD_CORE_PUBLIC
+bool traverseLayerInParallel(
+    const PXR_NS::SdfLayerHandle& layer,
+    const PXR_NS::SdfPath&        path,
+    const TraverseLayerFn&        fn,
+    const TraverseLayerFilterFn&  filter = TraverseLayerFilterFn());
+
 } // namespace MAYAUSD_NS_DEF
 
 #endif
@@ -24,6 +24,7 @@
 #include <maya/MArgList.h>
 #include <maya/MBoundingBox.h>
 #include <maya/MColor.h>
+#include <maya/MDGContext.h>
 #include <maya/MDGModifier.h>
 #include <maya/MDagPath.h>
 #include <maya/MFileIO.h>
@@ -39,10 +40,10 @@
 #include <maya/MFnSingleIndexedComponent.h>
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MGlobal.h>
+#include <maya/MIntArray.h>
 #include <maya/MItDag.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MItDependencyNodes.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MMatrix.h>
 #include <maya/MObject.h>
@@ -79,6 +80,8 @@
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/types.h>
 #include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/sort.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/tokens.h>
 #include <pxr/usd/usdGeom/camera.h>
@@ -86,7 +89,9 @@
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/xformCache.h>
 
+#include <atomic>
 #include <cctype>
+#include <cstring>
 
 using namespace MAYAUSD_NS_DEF;
 
@@ -1060,6 +1065,111 @@ template <typename T> struct _ValuesEqual
     bool operator()(const T& a, const T& b) const { return GfIsClose(a, b, 1e-9); }
 };
 
+// Number of assignments above which the values are merged in parallel.
+constexpr size_t _kParallelMergeThreshold = 1u << 16;
+
+template <typename T> struct _ValueComponents
+{
+    static constexpr size_t count = T::dimension;
+    static const float*     data(const T& value) { return value.data(); }
+};
+
+template <> struct _ValueComponents<float>
+{
+    static constexpr size_t count = 1;
+    static const float*     data(const float& value) { return &value; }
+};
+
+// Orders float components by their bits, which is a strict weak ordering even
+// for NaNs. Negative zero is ordered with positive zero since they compare equal.
+inline uint32_t _ComponentSortKey(float value)
+{
+    if (value == 0.0f) {
+        value = 0.0f;
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+template <typename T> bool _ValueSortsBefore(const T& a, const T& b)
+{
+    const float* aData = _ValueComponents<T>::data(a);
+    const float* bData = _ValueComponents<T>::data(b);
+    for (size_t i = 0; i < _ValueComponents<T>::count; ++i) {
+        const uint32_t aKey = _ComponentSortKey(aData[i]);
+        const uint32_t bKey = _ComponentSortKey(bData[i]);
+        if (aKey != bKey) {
+            return aKey < bKey;
+        }
+    }
+    return false;
+}
+
+// Parallel version of the merge of equivalent values: the value indices are
+// sorted in parallel to find the groups of equal values, then a linear pass
+// over the assignments numbers the groups in order of first use, exactly like
+// the hash map does in the serial version. Values are merged when they compare
+// equal, so values within the GfIsClose tolerance that differ in their bits
+// (and thus would almost never share a bucket in the serial hash map) are kept.
+template <typename T>
+static void _MergeEquivalentIndexedValuesInParallel(
+    const VtArray<T>& values,
+    const VtIntArray& assignments,
+    VtArray<T>*       uniqueValues,
+    VtIntArray*       uniqueIndices)
+{
+    const size_t numValues = values.size();
+    const T*     valueData = values.cdata();
+
+    std::vector<int> sortedIndices(numValues);
+    WorkParallelForN(numValues, [&sortedIndices](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            sortedIndices[i] = static_cast<int>(i);
+        }
+    });
+    WorkParallelSort(&sortedIndices, [valueData](int a, int b) {
+        if (_ValueSortsBefore(valueData[a], valueData[b])) {
+            return true;
+        }
+        if (_ValueSortsBefore(valueData[b], valueData[a])) {
+            return false;
+        }
+        return a < b;
+    });
+
+    // Map each value index to the first index of its group of equal values.
+    std::vector<int> groupOf(numValues);
+    int              groupStart = -1;
+    for (int index : sortedIndices) {
+        if (groupStart < 0 || !(valueData[index] == valueData[groupStart])) {
+            groupStart = index;
+        }
+        groupOf[index] = groupStart;
+    }
+
+    // Number the groups in the order the assignments first use them.
+    std::vector<int> uniqueIndexOfGroup(numValues, -1);
+    uniqueIndices->resize(assignments.size());
+    int* uniqueIndexData = uniqueIndices->data();
+    for (size_t i = 0; i < assignments.size(); ++i) {
+        const int index = assignments[i];
+        if (index < 0 || static_cast<size_t>(index) >= numValues) {
+            // This is an unassigned or otherwise unknown index, so just keep it.
+            uniqueIndexData[i] = index;
+            continue;
+        }
+
+        int& uniqueIndex = uniqueIndexOfGroup[groupOf[index]];
+        if (uniqueIndex < 0) {
+            // This is a new value, so add it to the array.
+            uniqueIndex = static_cast<int>(uniqueValues->size());
+            uniqueValues->push_back(valueData[index]);
+        }
+        uniqueIndexData[i] = uniqueIndex;
+    }
+}
+
 } // anonymous namespace
 
 template <typename T>
@@ -1074,11 +1184,24 @@ static void _MergeEquivalentIndexedValues(VtArray<T>* valueData, VtIntArray* ass
         return;
     }
 
+    VtArray<T> uniqueValues;
+    VtIntArray uniqueIndices;
+
+    if (assignmentIndices->size() >= _kParallelMergeThreshold) {
+        _MergeEquivalentIndexedValuesInParallel(
+            *valueData, *assignmentIndices, &uniqueValues, &uniqueIndices);
+
+        // If we reduced the number of values by merging, copy the results back.
+        if (uniqueValues.size() < numValues) {
+            (*valueData) = uniqueValues;
+            (*assignmentIndices) = uniqueIndices;
+        }
+        return;
+    }
+
     // We maintain a map of values to that value's index in our uniqueValues
     // array.
     std::unordered_map<T, size_t, _ValuesHash<T>, _ValuesEqual<T>> valuesMap;
-    VtArray<T>                                                     uniqueValues;
-    VtIntArray                                                     uniqueIndices;
 
     for (int index : *assignmentIndices) {
         if (index < 0 || static_cast<size_t>(index) >= numValues) {
@@ -1160,46 +1283,76 @@ void UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
 
     // We assume that the data is constant/uniform/vertex until we can
     // prove otherwise that two components have differing values.
-    bool isConstant = true;
-    bool isUniform = true;
-    bool isVertex = true;
+    // The face-vertices are listed polygon by polygon, in the same order as
+    // the assignments.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    mesh.getVertices(faceVertexCounts, faceVertexIndices);
+    if (assignmentIndices->size() < faceVertexIndices.length()) {
+        *interpolation = UsdGeomTokens->faceVarying;
+        return;
+    }
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int faceIndex = itFV.faceId();
-        int vertexIndex = itFV.vertId();
+    std::vector<unsigned int> faceOffsets(faceVertexCounts.length() + 1u, 0u);
+    for (unsigned int i = 0u; i < faceVertexCounts.length(); ++i) {
+        faceOffsets[i + 1u] = faceOffsets[i] + faceVertexCounts[i];
+    }
 
-        int assignedIndex = (*assignmentIndices)[fvi];
+    const int* assignments = assignmentIndices->cdata();
 
-        if (isConstant) {
-            if (assignedIndex != (*assignmentIndices)[0]) {
-                isConstant = false;
-            }
-        }
+    // We assume that the data is constant/uniform/vertex until we can
+    // prove otherwise that two components have differing values. The
+    // constant and uniform checks are independent per face, so they run in
+    // parallel; the vertex check follows the face-vertices in order.
+    std::atomic<bool> isConstant(true);
+    std::atomic<bool> isUniform(true);
+    int*              uniformData = uniformAssignments.data();
+    WorkParallelForN(
+        faceVertexCounts.length(),
+        [&faceOffsets, assignments, uniformData, &isConstant, &isUniform](
+            size_t begin, size_t end) {
+            for (size_t faceIndex = begin; faceIndex < end; ++faceIndex) {
+                const unsigned int faceBegin = faceOffsets[faceIndex];
+                const unsigned int faceEnd = faceOffsets[faceIndex + 1u];
+                if (faceBegin == faceEnd) {
+                    continue;
+                }
 
-        if (isUniform) {
-            if (uniformAssignments[faceIndex] < -1) {
-                // No value for this face yet, so store one.
-                uniformAssignments[faceIndex] = assignedIndex;
-            } else if (assignedIndex != uniformAssignments[faceIndex]) {
-                isUniform = false;
+                const int faceAssignment = assignments[faceBegin];
+                uniformData[faceIndex] = faceAssignment;
+                if (faceAssignment != assignments[0]) {
+                    isConstant = false;
+                }
+                for (unsigned int fvi = faceBegin + 1u; fvi < faceEnd; ++fvi) {
+                    if (assignments[fvi] != faceAssignment) {
+                        isConstant = false;
+                        isUniform = false;
+                        break;
+                    }
+                }
+
+                if (!isConstant && !isUniform) {
+                    // No constant or uniform compression will be possible.
+                    return;
+                }
             }
-        }
+        });
 
-        if (isVertex) {
-            if (vertexAssignments[vertexIndex] < -1) {
+    bool isVertex = true;
+    if (!isConstant && !isUniform) {
+        int* vertexData = vertexAssignments.data();
+        for (unsigned int fvi = 0u; fvi < faceVertexIndices.length(); ++fvi) {
+            const int vertexIndex = faceVertexIndices[fvi];
+            const int assignedIndex = assignments[fvi];
+            if (vertexData[vertexIndex] < -1) {
                 // No value for this vertex yet, so store one.
-                vertexAssignments[vertexIndex] = assignedIndex;
-            } else if (assignedIndex != vertexAssignments[vertexIndex]) {
+                vertexData[vertexIndex] = assignedIndex;
+            } else if (assignedIndex != vertexData[vertexIndex]) {
+                // No compression will be possible, so stop trying.
                 isVertex = false;
+                break;
             }
         }
-
-        if (!isConstant && !isUniform && !isVertex) {
-            // No compression will be possible, so stop trying.
-            break;
-        }
     }
 
     if (isConstant) {
@@ -1448,6 +1601,31 @@ bool UsdMayaUtil::getPlugMatrix(
     return true;
 }
 
+MObject UsdMayaUtil::getContextEvaluatedData(const MObject& node, const MString& attr)
+{
+    if (MDGContext::current().isNormal()) {
+        return MObject();
+    }
+
+    MStatus           status;
+    MFnDependencyNode depNode(node, &status);
+    if (!status) {
+        return MObject();
+    }
+
+    MPlug plug = depNode.findPlug(attr, true, &status);
+    if (!status) {
+        return MObject();
+    }
+
+    MObject plugObj = plug.asMObject(&status);
+    if (!status) {
+        return MObject();
+    }
+
+    return plugObj;
+}
+
 bool UsdMayaUtil::setPlugMatrix(
     const MFnDependencyNode& depNode,
     const MString&           attr,
@@ -463,6 +463,14 @@ MMatrix GfMatrixToMMatrix(const GfMatrix4d& mx);
 MAYAUSD_CORE_PUBLIC
 bool getPlugMatrix(const MFnDependencyNode& depNode, const MString& attr, MMatrix* outVal);
 
+/// Returns the data of the plug \p attr of \p node evaluated in the current DG
+/// context, for example the geometry of a shape at a time sample evaluated in
+/// an MDGContextGuard. The function sets of a node or DAG path always read the
+/// data of the normal context, so a null object is returned in the normal
+/// context, or if the plug can't be read.
+MAYAUSD_CORE_PUBLIC
+MObject getContextEvaluatedData(const MObject& node, const MString& attr);
+
 /// Set a matrix value on plug name \p attr, of \p depNode.
 /// Returns true if the value was set on the plug successfully, false otherwise.
 MAYAUSD_CORE_PUBLIC
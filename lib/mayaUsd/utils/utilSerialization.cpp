@@ -20,7 +20,9 @@
 #include <mayaUsd/utils/util.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/layerUtils.h>
 #include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usd/usdFileFormat.h>
@@ -31,6 +33,7 @@
 #include <maya/MString.h>
 
 #include <string>
+#include <unordered_set>
 
 namespace {
 
@@ -231,6 +234,19 @@ static bool isCompatibleWithSave(
     }
 }
 
+static bool saveLayerToFile(
+    const SdfLayerRefPtr& layer,
+    const std::string&    filePath,
+    const std::string&    formatArg)
+{
+    if (isCompatibleWithSave(layer, filePath, formatArg))
+        return layer->Save();
+
+    PXR_NS::SdfFileFormat::FileFormatArguments args;
+    args["format"] = formatArg;
+    return layer->Export(filePath, "", args);
+}
+
 bool saveLayerWithFormat(
     SdfLayerRefPtr     layer,
     const std::string& requestedFilePath,
@@ -242,16 +258,8 @@ bool saveLayerWithFormat(
     const std::string& formatArg
         = requestedFormatArg.empty() ? usdFormatArgOption() : requestedFormatArg;
 
-    if (isCompatibleWithSave(layer, filePath, formatArg)) {
-        if (!layer->Save()) {
-            return false;
-        }
-    } else {
-        PXR_NS::SdfFileFormat::FileFormatArguments args;
-        args["format"] = formatArg;
-        if (!layer->Export(filePath, "", args)) {
-            return false;
-        }
+    if (!saveLayerToFile(layer, filePath, formatArg)) {
+        return false;
     }
 
     updateAllCachedStageWithLayer(layer, filePath);
@@ -259,6 +267,40 @@ bool saveLayerWithFormat(
     return true;
 }
 
+bool saveLayersWithFormat(const std::vector<SdfLayerRefPtr>& layers)
+{
+    // The format option and the stage caches are Maya and UI state, so only the writing of the
+    // layers, which all go to different files, is done in parallel.
+    const std::string formatArg = usdFormatArgOption();
+
+    std::vector<SdfLayerRefPtr>                 uniqueLayers;
+    std::vector<std::string>                    filePaths;
+    std::unordered_set<const SdfLayer*, TfHash> seenLayers;
+    for (const SdfLayerRefPtr& layer : layers) {
+        if (layer && seenLayers.insert(get_pointer(layer)).second) {
+            uniqueLayers.push_back(layer);
+            filePaths.push_back(layer->GetRealPath());
+        }
+    }
+
+    std::vector<char> saved(uniqueLayers.size(), 0);
+    WorkParallelForN(uniqueLayers.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            saved[i] = saveLayerToFile(uniqueLayers[i], filePaths[i], formatArg);
+        }
+    });
+
+    bool allSaved = true;
+    for (size_t i = 0; i < uniqueLayers.size(); ++i) {
+        if (saved[i]) {
+            updateAllCachedStageWithLayer(uniqueLayers[i], filePaths[i]);
+        } else {
+            allSaved = false;
+        }
+    }
+    return allSaved;
+}
+
 SdfLayerRefPtr saveAnonymousLayer(
     SdfLayerRefPtr     anonLayer,
     LayerParent        parent,
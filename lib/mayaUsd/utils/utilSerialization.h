@@ -93,6 +93,14 @@ bool saveLayerWithFormat(
     const std::string& requestedFilePath = "",
     const std::string& requestedFormatArg = "");
 
+/*! \brief Save the given layers to their current file path using the current
+    user-selected USD format option. The layers are written concurrently and a
+    layer listed more than once is only saved once.
+    Returns false if any of the layers failed to save.
+ */
+MAYAUSD_CORE_PUBLIC
+bool saveLayersWithFormat(const std::vector<SdfLayerRefPtr>& layers);
+
 /*! \brief Save an anonymous layer to disk and update the sublayer path array
     in the parent layer.
  */
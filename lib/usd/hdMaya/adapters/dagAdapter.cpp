@@ -159,10 +159,10 @@ size_t HdMayaDagAdapter::SampleTransform(size_t maxSampleCount, float* times, Gf
     });
 }
 
+HdMayaDagAdapter::~HdMayaDagAdapter() { GetDelegate()->RemoveDagAdapterCallbacks(this); }
+
 void HdMayaDagAdapter::CreateCallbacks()
 {
-    MStatus status;
-
     TF_DEBUG(HDMAYA_ADAPTER_CALLBACKS)
         .Msg("Creating dag adapter callbacks for prim (%s).\n", GetID().GetText());
 
@@ -175,11 +175,7 @@ void HdMayaDagAdapter::CreateCallbacks()
             for (; dag.length() > 0; dag.pop()) {
                 MObject obj = dag.node();
                 if (obj != MObject::kNullObj) {
-                    auto id = MNodeMessage::addNodeDirtyPlugCallback(
-                        obj, dagNodeDirtyCallback, this, &status);
-                    if (status) {
-                        AddCallback(id);
-                    }
+                    GetDelegate()->AddDagNodeDirtyCallback(obj, dagNodeDirtyCallback, this);
                     TF_DEBUG(HDMAYA_ADAPTER_CALLBACKS)
                         .Msg(
                             "- Added _InstancerNodeDirty callback for "
@@ -193,6 +189,12 @@ void HdMayaDagAdapter::CreateCallbacks()
     HdMayaAdapter::CreateCallbacks();
 }
 
+void HdMayaDagAdapter::RemoveCallbacks()
+{
+    GetDelegate()->RemoveDagAdapterCallbacks(this);
+    HdMayaAdapter::RemoveCallbacks();
+}
+
 void HdMayaDagAdapter::MarkDirty(HdDirtyBits dirtyBits)
 {
     if (dirtyBits != 0) {
@@ -262,26 +264,17 @@ VtIntArray HdMayaDagAdapter::GetInstanceIndices(const SdfPath& prototypeId)
 
 void HdMayaDagAdapter::_AddHierarchyChangedCallbacks(MDagPath& dag)
 {
-    MStatus status;
-    auto    id = MDagMessage::addParentAddedDagPathCallback(dag, _HierarchyChanged, this, &status);
-    if (status) {
-        AddCallback(id);
-    }
-    TF_DEBUG(HDMAYA_ADAPTER_CALLBACKS)
-        .Msg("- Added parent added callback for dagPath (%s).\n", dag.partialPathName().asChar());
-
     // We need a parent removed callback, even for non-instances,
     // because when an object is removed from the scene due to an
     // undo, no pre-removal (or about-to-delete, or destroyed)
     // callbacks are triggered. The parent-removed callback IS
     // triggered, though, so it's a way to catch deletion due to
     // undo...
-    id = MDagMessage::addParentRemovedDagPathCallback(dag, _HierarchyChanged, this, &status);
-    if (status) {
-        AddCallback(id);
-    }
+    GetDelegate()->AddDagHierarchyChangedCallback(dag.node(), _HierarchyChanged, this);
     TF_DEBUG(HDMAYA_ADAPTER_CALLBACKS)
-        .Msg("- Added parent removed callback for dagPath (%s).\n", dag.partialPathName().asChar());
+        .Msg(
+            "- Added parent added and removed callbacks for dagPath (%s).\n",
+            dag.partialPathName().asChar());
 }
 
 SdfPath HdMayaDagAdapter::GetInstancerID() const
@@ -47,12 +47,14 @@ protected:
 
 public:
     HDMAYA_API
-    virtual ~HdMayaDagAdapter() = default;
+    virtual ~HdMayaDagAdapter();
     HDMAYA_API
     virtual bool GetVisible() { return IsVisible(); }
     HDMAYA_API
     virtual void CreateCallbacks() override;
     HDMAYA_API
+    virtual void RemoveCallbacks() override;
+    HDMAYA_API
     virtual void MarkDirty(HdDirtyBits dirtyBits) override;
     HDMAYA_API
     virtual void RemovePrim() override;
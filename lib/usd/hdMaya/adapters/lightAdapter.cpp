@@ -25,6 +25,7 @@
 #include <pxr/imaging/hdx/simpleLightTask.h>
 
 #include <maya/MColor.h>
+#include <maya/MFnAttribute.h>
 #include <maya/MFnLight.h>
 #include <maya/MNodeMessage.h>
 #include <maya/MPlug.h>
@@ -76,12 +77,32 @@ void _dirtyTransform(MObject& node, void* clientData)
     }
 }
 
-void _dirtyParams(MObject& node, void* clientData)
+// Attributes of the light shapes read by the shadow params.
+const MString _shadowAttributes[] = { "useDepthMapShadows", "useRayTraceShadows", "dmapResolution",
+                                      "dmapBias",           "dmapFilterSize",     "lightRadius",
+                                      "lightAngle" };
+
+bool _affectsShadows(const MPlug& plug)
+{
+    const auto name = MFnAttribute(plug.attribute()).name();
+    for (const auto& shadowAttribute : _shadowAttributes) {
+        if (name == shadowAttribute) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void _dirtyParams(MObject& node, MPlug& plug, void* clientData)
 {
     TF_UNUSED(node);
     auto* adapter = reinterpret_cast<HdMayaDagAdapter*>(clientData);
     if (adapter->IsVisible()) {
-        adapter->MarkDirty(HdLight::DirtyParams | HdLight::DirtyShadowParams);
+        // Color, intensity or cone edits don't invalidate the shadows, the
+        // shadow projection of the light is set by the delegate every frame.
+        adapter->MarkDirty(
+            _affectsShadows(plug) ? HdLight::DirtyParams | HdLight::DirtyShadowParams
+                                  : HdLight::DirtyParams);
         adapter->InvalidateTransform();
     }
 }
@@ -228,7 +249,7 @@ void HdMayaLightAdapter::CreateCallbacks()
     MStatus status;
     auto    dag = GetDagPath();
     auto    obj = dag.node();
-    auto    id = MNodeMessage::addNodeDirtyCallback(obj, _dirtyParams, this, &status);
+    auto    id = MNodeMessage::addNodeDirtyPlugCallback(obj, _dirtyParams, this, &status);
     if (status) {
         AddCallback(id);
     }
@@ -279,14 +300,20 @@ void HdMayaLightAdapter::_CalculateShadowParams(MFnLight& light, HdxShadowParams
         : std::min(
             GetDelegate()->GetParams().maximumShadowMapResolution, dmapResolutionPlug.asInt());
 
-    params.shadowMatrix =
+    // The same computation is returned until the matrix changes, so the shadow
+    // params compare equal when only the light params were edited.
+    const GfMatrix4d shadowMatrix = GetTransform() * _shadowProjectionMatrix;
+    if (!_shadowMatrix || shadowMatrix != _shadowMatrixValue) {
+        _shadowMatrix =
 #if HDX_API_VERSION >= 7
-        std::make_shared<HdMayaConstantShadowMatrix>(GetTransform() * _shadowProjectionMatrix);
+            std::make_shared<HdMayaConstantShadowMatrix>(shadowMatrix);
 #else
-        boost::static_pointer_cast<HdxShadowMatrixComputation>(
-            boost::make_shared<HdMayaConstantShadowMatrix>(
-                GetTransform() * _shadowProjectionMatrix));
+            boost::static_pointer_cast<HdxShadowMatrixComputation>(
+                boost::make_shared<HdMayaConstantShadowMatrix>(shadowMatrix));
 #endif
+        _shadowMatrixValue = shadowMatrix;
+    }
+    params.shadowMatrix = _shadowMatrix;
     params.bias = dmapBiasPlug.isNull() ? -0.001 : -dmapBiasPlug.asFloat();
     params.blur = dmapFilterSizePlug.isNull() ? 0.0
                                               : (static_cast<double>(dmapFilterSizePlug.asInt()))
@@ -71,6 +71,10 @@ protected:
     bool _GetVisibility() const override;
 
     GfMatrix4d _shadowProjectionMatrix;
+
+private:
+    HdxShadowMatrixComputationSharedPtr _shadowMatrix;
+    GfMatrix4d                          _shadowMatrixValue;
 };
 
 using HdMayaLightAdapterPtr = std::shared_ptr<HdMayaLightAdapter>;
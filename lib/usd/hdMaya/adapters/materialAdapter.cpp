@@ -169,6 +169,12 @@ public:
 #endif
     }
 
+    void MarkDirty(HdDirtyBits dirtyBits) override
+    {
+        HdMayaMaterialAdapter::MarkDirty(dirtyBits);
+        _hasMaterialNetwork = false;
+    }
+
 private:
     static void _DirtyMaterialParams(MObject& /*node*/, void* clientData)
     {
@@ -177,10 +183,17 @@ private:
         adapter->MarkDirty(HdMaterial::AllDirty);
     }
 
-    static void _DirtyShaderParams(MObject& /*node*/, void* clientData)
+    static void _DirtyShaderParams(MObject& /*node*/, MPlug& plug, void* clientData)
     {
         auto* adapter = reinterpret_cast<HdMayaShadingEngineAdapter*>(clientData);
-        adapter->MarkDirty(HdMaterial::AllDirty);
+        if (plug.isDestination()) {
+            adapter->MarkDirty(HdMaterial::AllDirty);
+        } else {
+            // Edits of unconnected values only patch the parameters of the
+            // surface shader in the converted network.
+            adapter->HdMayaMaterialAdapter::MarkDirty(HdMaterial::AllDirty);
+            adapter->_surfaceShaderParamsDirty = true;
+        }
         if (adapter->GetDelegate()->IsHdSt()) {
             adapter->GetDelegate()->MaterialTagChanged(adapter->GetID());
         }
@@ -247,8 +260,8 @@ private:
         }
 
         if (_surfaceShader != MObject::kNullObj) {
-            _surfaceShaderCallback
-                = MNodeMessage::addNodeDirtyCallback(_surfaceShader, _DirtyShaderParams, this);
+            _surfaceShaderCallback = MNodeMessage::addNodeDirtyPlugCallback(
+                _surfaceShader, _DirtyShaderParams, this);
         }
     }
 
@@ -271,6 +284,12 @@ private:
     {
         TF_DEBUG(HDMAYA_ADAPTER_MATERIALS)
             .Msg("HdMayaShadingEngineAdapter::GetMaterialResource(): %s\n", GetID().GetText());
+        if (_hasMaterialNetwork && _UpdateSurfaceShaderParams()) {
+            return VtValue(_materialNetworkMap);
+        }
+        _hasMaterialNetwork = false;
+        _surfaceShaderParamsDirty = false;
+
         HdMaterialNetwork              materialNetwork;
         HdMayaMaterialNetworkConverter converter(materialNetwork, GetID(), &_materialPathToMobj);
         if (!converter.GetMaterial(_surfaceShader)) {
@@ -287,9 +306,35 @@ private:
         // materialNetworkMap.map[HdMaterialTerminalTokens->displacement] =
         // displacementNetwork;
 
+        _materialNetworkMap = materialNetworkMap;
+        _hasMaterialNetwork = true;
         return VtValue(materialNetworkMap);
     };
 
+    // Patches the parameters of the surface shader in the cached network,
+    // returns false if the network has to be converted again.
+    bool _UpdateSurfaceShaderParams()
+    {
+        if (!_surfaceShaderParamsDirty) {
+            return true;
+        }
+        _surfaceShaderParamsDirty = false;
+
+        auto it = _materialNetworkMap.map.find(HdMaterialTerminalTokens->surface);
+        if (it == _materialNetworkMap.map.end() || it->second.nodes.empty()) {
+            return false;
+        }
+        // The surface shader is the last node added by the converter.
+        HdMaterialNetwork& network = it->second;
+        HdMaterialNode&    surfaceNode = network.nodes.back();
+        const auto*        mayaNode = TfMapLookupPtr(_materialPathToMobj, surfaceNode.path);
+        if (!mayaNode || *mayaNode != _surfaceShader) {
+            return false;
+        }
+        HdMayaMaterialNetworkConverter converter(network, GetID(), &_materialPathToMobj);
+        return converter.UpdateParameters(_surfaceShader, surfaceNode);
+    }
+
 #ifdef HDMAYA_OIT_ENABLED
     bool UpdateMaterialTag() override
     {
@@ -316,6 +361,11 @@ private:
 #endif // HDMAYA_OIT_ENABLED
 
     PathToMobjMap _materialPathToMobj;
+    // Last converted network, patched by the parameter edits of the surface
+    // shader until a connection or the shading engine changes.
+    HdMaterialNetworkMap _materialNetworkMap;
+    bool                 _hasMaterialNetwork = false;
+    bool                 _surfaceShaderParamsDirty = false;
 
     MObject _surfaceShader;
     TfToken _surfaceShaderType;
@@ -31,6 +31,7 @@
 #include <maya/MPlugArray.h>
 #include <maya/MStatus.h>
 
+#include <algorithm>
 #include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -484,6 +485,29 @@ typedef std::unordered_map<TfToken, HdMayaMaterialNodeConverter, TfToken::HashFu
 
 NameToNodeConverterMap _nodeConverters;
 
+VtValue _GetParameterValue(
+    MFnDependencyNode&           node,
+    HdMayaMaterialNodeConverter& nodeConverter,
+    const TfToken&               paramName,
+    const SdfValueTypeName&      type,
+    const VtValue*               fallback,
+    MPlug*                       plug)
+{
+    auto attrConverter = nodeConverter.GetAttrConverter(paramName);
+    if (attrConverter) {
+        return attrConverter->GetValue(node, paramName, type, fallback, plug);
+    } else if (fallback) {
+        return *fallback;
+    }
+    TF_DEBUG(HDMAYA_ADAPTER_GET)
+        .Msg(
+            "HdMayaMaterialNetworkConverter::ConvertParameter(): "
+            "No attrConverter found with name: %s and no fallback "
+            "given",
+            paramName.GetText());
+    return {};
+}
+
 } // namespace
 
 /*static*/
@@ -708,6 +732,64 @@ HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(const MObject& mayaN
     return &_network.nodes.back();
 }
 
+bool HdMayaMaterialNetworkConverter::UpdateParameters(
+    const MObject&  mayaNode,
+    HdMaterialNode& material)
+{
+    MStatus           status;
+    MFnDependencyNode node(mayaNode, &status);
+    if (ARCH_UNLIKELY(!status)) {
+        return false;
+    }
+    auto* nodeConverter
+        = HdMayaMaterialNodeConverter::GetNodeConverter(TfToken(node.typeName().asChar()));
+    if (!nodeConverter || nodeConverter->GetIdentifier() != material.identifier) {
+        return false;
+    }
+
+    const auto updateParameter = [&](const TfToken&          paramName,
+                                     const SdfValueTypeName& type,
+                                     const VtValue*          fallback) -> bool {
+        MPlug   plug;
+        VtValue val = _GetParameterValue(node, *nodeConverter, paramName, type, fallback, &plug);
+        const bool isConnected = !plug.isNull() && !plug.source().isNull();
+        const bool wasConnected = std::any_of(
+            _network.relationships.begin(),
+            _network.relationships.end(),
+            [&](const HdMaterialRelationship& rel) {
+                return rel.outputId == material.path && rel.outputName == paramName;
+            });
+        if (isConnected != wasConnected) {
+            return false;
+        }
+        VtValue& param = material.parameters[paramName];
+        // The primvars of the network are read from the varname parameters.
+        if (paramName == HdMayaAdapterTokens->varname && param != val) {
+            return false;
+        }
+        param = std::move(val);
+        return true;
+    };
+
+    if (material.identifier == UsdImagingTokens->UsdPreviewSurface) {
+        for (const auto& param : HdMayaMaterialNetworkConverter::GetPreviewShaderParams()) {
+            if (!updateParameter(param.name, param.type, &param.fallbackValue)) {
+                return false;
+            }
+        }
+    } else {
+        for (auto& nameAttrConverterPair : nodeConverter->GetAttrConverters()) {
+            if (!updateParameter(
+                    nameAttrConverterPair.first,
+                    nameAttrConverterPair.second->GetType(),
+                    nullptr)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void HdMayaMaterialNetworkConverter::AddPrimvar(const TfToken& primvar)
 {
     if (std::find(_network.primvars.begin(), _network.primvars.end(), primvar)
@@ -724,26 +806,11 @@ void HdMayaMaterialNetworkConverter::ConvertParameter(
     const SdfValueTypeName&      type,
     const VtValue*               fallback)
 {
-    MPlug   plug;
-    VtValue val;
+    MPlug plug;
     TF_DEBUG(HDMAYA_ADAPTER_MATERIALS).Msg("ConvertParameter(%s)\n", paramName.GetText());
 
-    auto attrConverter = nodeConverter.GetAttrConverter(paramName);
-    if (attrConverter) {
-        val = attrConverter->GetValue(node, paramName, type, fallback, &plug);
-    } else if (fallback) {
-        val = *fallback;
-    } else {
-        TF_DEBUG(HDMAYA_ADAPTER_GET)
-            .Msg(
-                "HdMayaMaterialNetworkConverter::ConvertParameter(): "
-                "No attrConverter found with name: %s and no fallback "
-                "given",
-                paramName.GetText());
-        val = VtValue();
-    }
-
-    material.parameters[paramName] = val;
+    material.parameters[paramName]
+        = _GetParameterValue(node, nodeConverter, paramName, type, fallback, &plug);
     if (plug.isNull()) {
         return;
     }
@@ -131,6 +131,12 @@ public:
     HDMAYA_API
     HdMaterialNode* GetMaterial(const MObject& mayaNode);
 
+    /// Reads again the parameter values of \p material, converted from
+    /// \p mayaNode by GetMaterial. Returns false if the connections of the
+    /// node changed, the network then has to be converted again.
+    HDMAYA_API
+    bool UpdateParameters(const MObject& mayaNode, HdMaterialNode& material);
+
     HDMAYA_API
     void AddPrimvar(const TfToken& primvar);
 
@@ -18,6 +18,7 @@
 #include <hdMaya/adapters/mayaAttrs.h>
 #include <hdMaya/adapters/shapeAdapter.h>
 #include <hdMaya/adapters/tokens.h>
+#include <mayaUsd/utils/hash.h>
 
 #include <pxr/base/gf/interval.h>
 #include <pxr/base/tf/type.h>
@@ -36,6 +37,10 @@
 #include <maya/MPlug.h>
 #include <maya/MPolyMessage.h>
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -59,6 +64,44 @@ const std::pair<MObject&, HdDirtyBits> _dirtyBits[] {
     { MayaAttrs::mesh::smoothLevel, HdChangeTracker::DirtyDisplayStyle }
 };
 
+struct _MeshTopologyData
+{
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+};
+
+using _MeshTopologyDataPtr = std::shared_ptr<const _MeshTopologyData>;
+
+// Returns the topology data of another mesh if it is identical, so copies of
+// the same mesh share their arrays.
+_MeshTopologyDataPtr _InternMeshTopology(_MeshTopologyData&& data)
+{
+    static std::mutex mutex;
+    static std::unordered_multimap<size_t, std::weak_ptr<const _MeshTopologyData>> registry;
+
+    size_t hash = hash_value(data.faceVertexCounts);
+    MayaUsd::hash_combine(hash, hash_value(data.faceVertexIndices));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto                  range = registry.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+        if (auto interned = it->second.lock()) {
+            if (interned->faceVertexCounts == data.faceVertexCounts
+                && interned->faceVertexIndices == data.faceVertexIndices) {
+                return interned;
+            }
+            ++it;
+        } else {
+            it = registry.erase(it);
+        }
+    }
+    // Not using make_shared, the arrays are released with the last mesh
+    // rather than with the registry entry.
+    _MeshTopologyDataPtr interned(new _MeshTopologyData(std::move(data)));
+    registry.emplace(hash, interned);
+    return interned;
+}
+
 } // namespace
 
 class HdMayaMeshAdapter : public HdMayaShapeAdapter
@@ -130,7 +173,7 @@ public:
             }
             _buggyCallbacks.clear();
         }
-        HdMayaAdapter::RemoveCallbacks();
+        HdMayaDagAdapter::RemoveCallbacks();
     }
 
     bool IsSupported() const override
@@ -215,21 +258,52 @@ public:
         return 0;
     }
 
-    HdMeshTopology GetMeshTopology() override
+    void MarkDirty(HdDirtyBits dirtyBits) override
     {
-        MFnMesh    mesh(GetDagPath());
-        const auto numPolygons = mesh.numPolygons();
-        VtIntArray faceVertexCounts;
-        faceVertexCounts.reserve(static_cast<size_t>(numPolygons));
-        VtIntArray faceVertexIndices;
-        faceVertexIndices.reserve(static_cast<size_t>(mesh.numFaceVertices()));
-        for (MItMeshPolygon pit(GetDagPath()); !pit.isDone(); pit.next()) {
-            const auto vc = pit.polygonVertexCount();
-            faceVertexCounts.push_back(vc);
-            for (auto i = decltype(vc) { 0 }; i < vc; ++i) {
-                faceVertexIndices.push_back(pit.vertexIndex(i));
-            }
+        HdMayaShapeAdapter::MarkDirty(dirtyBits);
+        // The topology callbacks are the only ones marking the topology dirty.
+        if (dirtyBits & HdChangeTracker::DirtyTopology) {
+            _topology.reset();
+        }
+    }
+
+    void EvaluateForPrefetch() override
+    {
+        // Copies the topology out of the evaluated output mesh, the worker
+        // threads then build the topology without calling into Maya.
+        if (_topology) {
+            return;
+        }
+        MStatus           status;
+        MFnDependencyNode node(GetNode(), &status);
+        if (ARCH_UNLIKELY(!status)) {
+            return;
         }
+        auto plug = node.findPlug("outMesh", true, &status);
+        if (ARCH_UNLIKELY(!status)) {
+            return;
+        }
+        MFnMesh mesh(plug.asMObject(), &status);
+        if (ARCH_UNLIKELY(!status)) {
+            return;
+        }
+        _prefetchedTopology.reset(new _MeshTopologyData(_ReadTopology(mesh)));
+    }
+
+    void PrefetchTopology() override
+    {
+        if (!_prefetchedTopology) {
+            return;
+        }
+        if (!_topology) {
+            _topology = _InternMeshTopology(std::move(*_prefetchedTopology));
+        }
+        _prefetchedTopology.reset();
+    }
+
+    HdMeshTopology GetMeshTopology() override
+    {
+        _UpdateTopology();
 
         // TODO: Maybe we could use the flat shading of the display style?
         return HdMeshTopology(
@@ -243,8 +317,8 @@ public:
 #endif
 
             UsdGeomTokens->rightHanded,
-            faceVertexCounts,
-            faceVertexIndices);
+            _topology->faceVertexCounts,
+            _topology->faceVertexIndices);
     }
 
     HdDisplayStyle GetDisplayStyle() override
@@ -454,6 +528,35 @@ private:
     // To work around this, we register these callbacks specially, and only
     // remove them if the underlying node is currently valid.
     MCallbackIdArray _buggyCallbacks;
+
+    static _MeshTopologyData _ReadTopology(const MFnMesh& mesh)
+    {
+        MIntArray vertexCounts;
+        MIntArray vertexIndices;
+        mesh.getVertices(vertexCounts, vertexIndices);
+        _MeshTopologyData topology;
+        topology.faceVertexCounts.resize(vertexCounts.length());
+        vertexCounts.get(topology.faceVertexCounts.data());
+        topology.faceVertexIndices.resize(vertexIndices.length());
+        vertexIndices.get(topology.faceVertexIndices.data());
+        return topology;
+    }
+
+    void _UpdateTopology()
+    {
+        if (_topology) {
+            return;
+        }
+        _prefetchedTopology.reset();
+        _topology = _InternMeshTopology(_ReadTopology(MFnMesh(GetDagPath())));
+    }
+
+    // Topology of the mesh, shared with the topologies returned to Hydra and
+    // with the identical meshes until the topology callbacks invalidate it.
+    _MeshTopologyDataPtr _topology;
+    // Topology copied on the main thread by EvaluateForPrefetch, consumed by
+    // PrefetchTopology on a worker thread.
+    std::unique_ptr<_MeshTopologyData> _prefetchedTopology;
 };
 
 TF_REGISTRY_FUNCTION(TfType)
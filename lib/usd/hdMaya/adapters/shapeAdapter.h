@@ -51,6 +51,23 @@ public:
     HDMAYA_API
     virtual void MarkDirty(HdDirtyBits dirtyBits) override;
 
+    /// \brief Copies out the shape data used by PrefetchTopology.
+    ///
+    /// Called on the main thread by HdMayaSceneDelegate::Populate, before
+    /// PrefetchTopology is called from the worker threads. This is the only
+    /// place the prefetch may call into the Maya API.
+    HDMAYA_API
+    virtual void EvaluateForPrefetch() { }
+
+    /// \brief Reads ahead the topology returned by the first topology query.
+    ///
+    /// Called from worker threads by HdMayaSceneDelegate::Populate, before the
+    /// adapter is populated. Implementations must only use the data copied by
+    /// EvaluateForPrefetch and must not call into the Maya API, which is not
+    /// safe from other threads.
+    HDMAYA_API
+    virtual void PrefetchTopology() { }
+
     HDMAYA_API
     virtual MObject GetMaterial();
     HDMAYA_API
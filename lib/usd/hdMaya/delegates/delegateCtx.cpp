@@ -25,7 +25,9 @@
 #include <pxr/imaging/hio/glslfx.h>
 
 #include <maya/MFnLight.h>
+#include <maya/MMessage.h>
 
+#include <algorithm>
 #include <array>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -78,6 +80,18 @@ HdMayaDelegateCtx::HdMayaDelegateCtx(const InitData& initData)
     GetChangeTracker().AddCollection(TfToken("visible"));
 }
 
+HdMayaDelegateCtx::~HdMayaDelegateCtx()
+{
+    for (auto& it : _dagNodeCallbacks) {
+        if (it.second.hasDirtyCallbackId) {
+            MMessage::removeCallback(it.second.dirtyCallbackId);
+        }
+    }
+    if (_dagHierarchyCallbackIds.length() > 0) {
+        MMessage::removeCallbacks(_dagHierarchyCallbackIds);
+    }
+}
+
 void HdMayaDelegateCtx::InsertRprim(
     const TfToken& typeId,
     const SdfPath& id,
@@ -125,4 +139,123 @@ SdfPath HdMayaDelegateCtx::GetMaterialPath(const MObject& obj)
     return _GetMaterialPath(_materialPath, obj);
 }
 
+void HdMayaDelegateCtx::AddDagNodeDirtyCallback(
+    const MObject&                  node,
+    MNodeMessage::MNodePlugFunction func,
+    HdMayaDagAdapter*               adapter)
+{
+    const MObjectHandle handle(node);
+    auto&               callbacks = _dagNodeCallbacks[handle];
+    // Instances of the same shape share their ancestors.
+    const auto callback = std::make_pair(adapter, func);
+    if (std::find(callbacks.dirtyCallbacks.begin(), callbacks.dirtyCallbacks.end(), callback)
+        != callbacks.dirtyCallbacks.end()) {
+        return;
+    }
+    if (!callbacks.hasDirtyCallbackId) {
+        MStatus    status;
+        MObject    obj = node;
+        const auto id = MNodeMessage::addNodeDirtyPlugCallback(obj, _DagNodeDirty, this, &status);
+        if (!status) {
+            if (callbacks.hierarchyCallbacks.empty()) {
+                _dagNodeCallbacks.erase(handle);
+            }
+            return;
+        }
+        callbacks.dirtyCallbackId = id;
+        callbacks.hasDirtyCallbackId = true;
+    }
+    callbacks.dirtyCallbacks.push_back(callback);
+    _dagAdapterNodes[adapter].push_back(handle);
+}
+
+void HdMayaDelegateCtx::AddDagHierarchyChangedCallback(
+    const MObject&                           node,
+    MDagMessage::MMessageParentChildFunction func,
+    HdMayaDagAdapter*                        adapter)
+{
+    if (_dagHierarchyCallbackIds.length() == 0) {
+        MStatus status;
+        auto    id = MDagMessage::addParentAddedCallback(_DagHierarchyChanged, this, &status);
+        if (status) {
+            _dagHierarchyCallbackIds.append(id);
+        }
+        id = MDagMessage::addParentRemovedCallback(_DagHierarchyChanged, this, &status);
+        if (status) {
+            _dagHierarchyCallbackIds.append(id);
+        }
+    }
+
+    const MObjectHandle handle(node);
+    auto&               callbacks = _dagNodeCallbacks[handle];
+    const auto          callback = std::make_pair(adapter, func);
+    if (std::find(
+            callbacks.hierarchyCallbacks.begin(), callbacks.hierarchyCallbacks.end(), callback)
+        != callbacks.hierarchyCallbacks.end()) {
+        return;
+    }
+    callbacks.hierarchyCallbacks.push_back(callback);
+    _dagAdapterNodes[adapter].push_back(handle);
+}
+
+void HdMayaDelegateCtx::RemoveDagAdapterCallbacks(HdMayaDagAdapter* adapter)
+{
+    auto nodesIt = _dagAdapterNodes.find(adapter);
+    if (nodesIt == _dagAdapterNodes.end()) {
+        return;
+    }
+    const auto isAdapter = [adapter](const auto& callback) { return callback.first == adapter; };
+    for (const auto& handle : nodesIt->second) {
+        auto it = _dagNodeCallbacks.find(handle);
+        if (it == _dagNodeCallbacks.end()) {
+            continue;
+        }
+        auto& callbacks = it->second;
+        callbacks.dirtyCallbacks.erase(
+            std::remove_if(
+                callbacks.dirtyCallbacks.begin(), callbacks.dirtyCallbacks.end(), isAdapter),
+            callbacks.dirtyCallbacks.end());
+        callbacks.hierarchyCallbacks.erase(
+            std::remove_if(
+                callbacks.hierarchyCallbacks.begin(),
+                callbacks.hierarchyCallbacks.end(),
+                isAdapter),
+            callbacks.hierarchyCallbacks.end());
+        if (callbacks.dirtyCallbacks.empty() && callbacks.hasDirtyCallbackId) {
+            MMessage::removeCallback(callbacks.dirtyCallbackId);
+            callbacks.hasDirtyCallbackId = false;
+        }
+        if (callbacks.dirtyCallbacks.empty() && callbacks.hierarchyCallbacks.empty()) {
+            _dagNodeCallbacks.erase(it);
+        }
+    }
+    _dagAdapterNodes.erase(nodesIt);
+}
+
+void HdMayaDelegateCtx::_DagNodeDirty(MObject& node, MPlug& plug, void* clientData)
+{
+    auto* delegate = reinterpret_cast<HdMayaDelegateCtx*>(clientData);
+    auto  it = delegate->_dagNodeCallbacks.find(MObjectHandle(node));
+    if (it == delegate->_dagNodeCallbacks.end()) {
+        return;
+    }
+    for (const auto& callback : it->second.dirtyCallbacks) {
+        callback.second(node, plug, callback.first);
+    }
+}
+
+void HdMayaDelegateCtx::_DagHierarchyChanged(MDagPath& child, MDagPath& parent, void* clientData)
+{
+    auto* delegate = reinterpret_cast<HdMayaDelegateCtx*>(clientData);
+    auto  it = delegate->_dagNodeCallbacks.find(MObjectHandle(child.node()));
+    if (it == delegate->_dagNodeCallbacks.end()) {
+        return;
+    }
+    // The adapters usually remove their callbacks when their hierarchy changes.
+    const auto callbacks = it->second.hierarchyCallbacks;
+    for (const auto& callback : callbacks) {
+        callback.second(child, parent, callback.first);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -18,15 +18,26 @@
 
 #include <hdMaya/delegates/delegate.h>
 
+#include <mayaUsd/utils/util.h>
+
 #include <pxr/imaging/hd/renderIndex.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 
+#include <maya/MCallbackIdArray.h>
+#include <maya/MDagMessage.h>
 #include <maya/MDagPath.h>
+#include <maya/MNodeMessage.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdMayaDagAdapter;
+
 class HdMayaDelegateCtx
     : public HdSceneDelegate
     , public HdMayaDelegate
@@ -36,6 +47,9 @@ protected:
     HdMayaDelegateCtx(const InitData& initData);
 
 public:
+    HDMAYA_API
+    virtual ~HdMayaDelegateCtx();
+
     enum RebuildFlags : uint32_t
     {
         RebuildFlagPrim = 1 << 1,
@@ -68,10 +82,51 @@ public:
     HDMAYA_API
     SdfPath GetMaterialPath(const MObject& obj);
 
+    /// \brief Calls \p func with \p adapter as client data when a plug of
+    /// \p node is dirtied.
+    ///
+    /// A single dirty plug callback is registered per node, whatever the
+    /// number of adapters depending on it.
+    HDMAYA_API
+    void AddDagNodeDirtyCallback(
+        const MObject&                  node,
+        MNodeMessage::MNodePlugFunction func,
+        HdMayaDagAdapter*               adapter);
+    /// \brief Calls \p func with \p adapter as client data when a parent is
+    /// added to or removed from \p node.
+    ///
+    /// Dispatched from a single pair of parent added and removed callbacks.
+    HDMAYA_API
+    void AddDagHierarchyChangedCallback(
+        const MObject&                           node,
+        MDagMessage::MMessageParentChildFunction func,
+        HdMayaDagAdapter*                        adapter);
+    /// \brief Removes the callbacks registered for \p adapter.
+    HDMAYA_API
+    void RemoveDagAdapterCallbacks(HdMayaDagAdapter* adapter);
+
 private:
+    static void _DagNodeDirty(MObject& node, MPlug& plug, void* clientData);
+    static void _DagHierarchyChanged(MDagPath& child, MDagPath& parent, void* clientData);
+
+    template <typename Func>
+    using _AdapterCallbacks = std::vector<std::pair<HdMayaDagAdapter*, Func>>;
+
+    struct _DagNodeCallbacks
+    {
+        _AdapterCallbacks<MNodeMessage::MNodePlugFunction>          dirtyCallbacks;
+        _AdapterCallbacks<MDagMessage::MMessageParentChildFunction> hierarchyCallbacks;
+        MCallbackId                                                 dirtyCallbackId = 0;
+        bool                                                        hasDirtyCallbackId = false;
+    };
+
     SdfPath _rprimPath;
     SdfPath _sprimPath;
     SdfPath _materialPath;
+
+    UsdMayaUtil::MObjectHandleUnorderedMap<_DagNodeCallbacks>         _dagNodeCallbacks;
+    std::unordered_map<HdMayaDagAdapter*, std::vector<MObjectHandle>> _dagAdapterNodes;
+    MCallbackIdArray                                                  _dagHierarchyCallbackIds;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
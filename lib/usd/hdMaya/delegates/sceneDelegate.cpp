@@ -23,7 +23,9 @@
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/type.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hd/camera.h>
 #include <pxr/imaging/hd/light.h>
 #include <pxr/imaging/hd/material.h>
@@ -44,9 +46,16 @@
 #include <maya/MString.h>
 
 #include <algorithm>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    HDMAYA_PARALLEL_POPULATE,
+    true,
+    "Build the topology of the Maya shapes from worker threads when populating the scene "
+    "delegate. The shape data is copied out on the main thread first.");
+
 namespace {
 
 void _nodeAdded(MObject& obj, void* clientData)
@@ -226,10 +235,30 @@ void HdMayaSceneDelegate::Populate()
     auto&  renderIndex = GetRenderIndex();
     MItDag dagIt(MItDag::kDepthFirst, MFn::kInvalid);
     dagIt.traverseUnderWorld(true);
+    std::vector<HdMayaShapeAdapterPtr> shapeAdapters;
     for (; !dagIt.isDone(); dagIt.next()) {
         MDagPath path;
         dagIt.getPath(path);
-        InsertDag(path);
+        if (auto adapter = _CreateDagAdapter(path)) {
+            shapeAdapters.push_back(adapter);
+        }
+    }
+    // The DAG walk, the adapter creation and every Maya API call stay on
+    // the main thread, only the topologies are built from the copied shape
+    // data in parallel. Insertion in the render index and the
+    // callbacks are serial again.
+    if (TfGetEnvSetting(HDMAYA_PARALLEL_POPULATE)) {
+        for (const auto& adapter : shapeAdapters) {
+            adapter->EvaluateForPrefetch();
+        }
+        WorkParallelForN(shapeAdapters.size(), [&shapeAdapters](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                shapeAdapters[i]->PrefetchTopology();
+            }
+        });
+    }
+    for (const auto& adapter : shapeAdapters) {
+        _InsertShapeAdapter(adapter);
     }
     MStatus status;
     auto    id = MDGMessage::addNodeAddedCallback(_nodeAdded, "dagNode", this, &status);
@@ -521,6 +550,23 @@ AdapterPtr HdMayaSceneDelegate::Create(
     const std::function<AdapterPtr(HdMayaDelegateCtx*, const MDagPath&)>& adapterCreator,
     Map&                                                                  adapterMap,
     bool                                                                  isSprim)
+{
+    auto adapter = _ConstructAdapter(dag, adapterCreator, adapterMap, isSprim);
+    if (adapter == nullptr) {
+        return {};
+    }
+    adapter->Populate();
+    adapter->CreateCallbacks();
+    adapterMap.insert({ GetPrimPath(dag, isSprim), adapter });
+    return adapter;
+}
+
+template <typename AdapterPtr, typename Map>
+AdapterPtr HdMayaSceneDelegate::_ConstructAdapter(
+    const MDagPath&                                                       dag,
+    const std::function<AdapterPtr(HdMayaDelegateCtx*, const MDagPath&)>& adapterCreator,
+    const Map&                                                            adapterMap,
+    bool                                                                  isSprim)
 {
     if (!adapterCreator) {
         return {};
@@ -541,13 +587,17 @@ AdapterPtr HdMayaSceneDelegate::Create(
     if (adapter == nullptr || !adapter->IsSupported()) {
         return {};
     }
-    adapter->Populate();
-    adapter->CreateCallbacks();
-    adapterMap.insert({ id, adapter });
     return adapter;
 }
 
 void HdMayaSceneDelegate::InsertDag(const MDagPath& dag)
+{
+    if (auto adapter = _CreateDagAdapter(dag)) {
+        _InsertShapeAdapter(adapter);
+    }
+}
+
+HdMayaShapeAdapterPtr HdMayaSceneDelegate::_CreateDagAdapter(const MDagPath& dag)
 {
     TF_DEBUG(HDMAYA_DELEGATE_INSERTDAG)
         .Msg(
@@ -556,12 +606,12 @@ void HdMayaSceneDelegate::InsertDag(const MDagPath& dag)
             GetLightsEnabled());
     // We don't care about transforms.
     if (dag.hasFn(MFn::kTransform)) {
-        return;
+        return {};
     }
 
     MFnDagNode dagNode(dag);
     if (dagNode.isIntermediateObject()) {
-        return;
+        return {};
     }
 
     // Skip UFE nodes coming from USD runtime
@@ -570,37 +620,45 @@ void HdMayaSceneDelegate::InsertDag(const MDagPath& dag)
     static const MString ufeRuntimeStr = "ufeRuntime";
     MPlug                ufeRuntimePlug = dagNode.findPlug(ufeRuntimeStr, false, &status);
     if ((status == MS::kSuccess) && ufeRuntimePlug.asString() == "USD") {
-        return;
+        return {};
     }
 
     // Custom lights don't have MFn::kLight.
     if (GetLightsEnabled()) {
         if (Create(dag, HdMayaAdapterRegistry::GetLightAdapterCreator(dag), _lightAdapters, true))
-            return;
+            return {};
     }
     if (Create(dag, HdMayaAdapterRegistry::GetCameraAdapterCreator(dag), _cameraAdapters, true)) {
-        return;
+        return {};
     }
     // We are inserting a single prim and
     // instancer for every instanced mesh.
     if (dag.isInstanced() && dag.instanceNumber() > 0) {
-        return;
+        return {};
     }
 
-    auto adapter = Create(dag, HdMayaAdapterRegistry::GetShapeAdapterCreator(dag), _shapeAdapters);
+    auto adapter = _ConstructAdapter(
+        dag, HdMayaAdapterRegistry::GetShapeAdapterCreator(dag), _shapeAdapters, false);
     if (!adapter) {
         // Proxy shape is registered as base class type but plugins can derive from it
         // Check the object type and if matches proxy base class find an adapter for it.
-        adapter
-            = Create(dag, HdMayaAdapterRegistry::GetProxyShapeAdapterCreator(dag), _shapeAdapters);
-    }
-    if (adapter) {
-        auto material = adapter->GetMaterial();
-        if (material != MObject::kNullObj) {
-            const auto materialId = GetMaterialPath(material);
-            if (TfMapLookupPtr(_materialAdapters, materialId) == nullptr) {
-                _CreateMaterial(materialId, material);
-            }
+        adapter = _ConstructAdapter(
+            dag, HdMayaAdapterRegistry::GetProxyShapeAdapterCreator(dag), _shapeAdapters, false);
+    }
+    return adapter;
+}
+
+void HdMayaSceneDelegate::_InsertShapeAdapter(const HdMayaShapeAdapterPtr& adapter)
+{
+    adapter->Populate();
+    adapter->CreateCallbacks();
+    _shapeAdapters.insert({ GetPrimPath(adapter->GetDagPath(), false), adapter });
+
+    auto material = adapter->GetMaterial();
+    if (material != MObject::kNullObj) {
+        const auto materialId = GetMaterialPath(material);
+        if (TfMapLookupPtr(_materialAdapters, materialId) == nullptr) {
+            _CreateMaterial(materialId, material);
         }
     }
 }
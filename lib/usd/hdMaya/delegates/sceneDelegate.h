@@ -249,6 +249,22 @@ private:
         Map&                                                                  adapterMap,
         bool                                                                  isSprim = false);
 
+    template <typename AdapterPtr, typename Map>
+    AdapterPtr _ConstructAdapter(
+        const MDagPath&                                                       dag,
+        const std::function<AdapterPtr(HdMayaDelegateCtx*, const MDagPath&)>& adapterCreator,
+        const Map&                                                            adapterMap,
+        bool                                                                  isSprim);
+
+    /// \brief Creates the adapters of a dag node.
+    ///
+    /// Lights and cameras are inserted in the render index, the shape adapter
+    /// is returned without being populated.
+    HdMayaShapeAdapterPtr _CreateDagAdapter(const MDagPath& dag);
+
+    /// \brief Inserts a shape adapter and its material in the render index.
+    void _InsertShapeAdapter(const HdMayaShapeAdapterPtr& adapter);
+
     bool _CreateMaterial(const SdfPath& id, const MObject& obj);
 
     template <typename T> using AdapterMap = std::unordered_map<SdfPath, T, SdfPath::Hash>;
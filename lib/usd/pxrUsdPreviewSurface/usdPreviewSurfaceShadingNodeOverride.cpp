@@ -79,6 +79,9 @@ MHWRender::DrawAPI PxrMayaUsdPreviewSurfaceShadingNodeOverride::supportedDrawAPI
 /* virtual */
 MString PxrMayaUsdPreviewSurfaceShadingNodeOverride::fragmentName() const
 {
+    // All the nodes share the fragment graph registered by HdVP2ShaderFragments, VP2 only
+    // builds the shader once and the node attributes are pushed through the automatic
+    // attribute to parameter mappings, which only update the parameters of dirty plugs.
     return HdVP2ShaderFragmentsTokens->SurfaceFragmentGraphName.GetText();
 }
 
@@ -96,7 +99,8 @@ void PxrMayaUsdPreviewSurfaceShadingNodeOverride::getCustomMappings(
     // (a positive value means to enable transparency whilst a non-positive value
     // means to disable transparency). Note the "opacity" parameter of the shader
     // fragment carries the alpha value that is actually used in shading.
-    MHWRender::MAttributeParameterMapping transparencyMapping(
+    // The mapping is the same for every node, so it is only built once.
+    static const MHWRender::MAttributeParameterMapping transparencyMapping(
         _transparencyParameter, "outTransparencyOn", true, true);
     mappings.append(transparencyMapping);
 }
@@ -63,6 +63,9 @@ PxrUsdTranslators_CameraWriter::PxrUsdTranslators_CameraWriter(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_CameraWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_CameraWriter::Write(const UsdTimeCode& usdTime)
 {
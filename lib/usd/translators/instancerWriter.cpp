@@ -27,6 +27,7 @@
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/kind/registry.h>
 #include <pxr/usd/usd/modelAPI.h>
+#include <pxr/usd/usd/references.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
@@ -188,6 +189,13 @@ PxrUsdTranslators_InstancerWriter::PxrUsdTranslators_InstancerWriter(
     _modelPaths.push_back(_usdPrim.GetPath());
 }
 
+/* virtual */
+bool PxrUsdTranslators_InstancerWriter::IsAnimated() const
+{
+    // The instances are written at every time sample.
+    return true;
+}
+
 /* virtual */
 void PxrUsdTranslators_InstancerWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -284,6 +292,18 @@ bool PxrUsdTranslators_InstancerWriter::writeInstancerAttrs(
                 = prototypesGroupPrim.GetPath().AppendChild(prototypeName);
             UsdPrim prototypePrim = GetUsdStage()->DefinePrim(prototypeUsdPath);
             _modelPaths.push_back(prototypeUsdPath);
+            prototypesRel.AddTarget(prototypeUsdPath);
+
+            // A prototype already exported by another instancer is referenced
+            // rather than written again. It brings its instancerTranslate op
+            // along, since it comes from the same Maya node.
+            const SdfPath sharedPrototypePath
+                = _writeJobCtx.GetInstancerPrototypePath(prototypeDagPath);
+            if (!sharedPrototypePath.IsEmpty()) {
+                prototypePrim.GetReferences().AddInternalReference(sharedPrototypePath);
+                continue;
+            }
+            _writeJobCtx.SetInstancerPrototypePath(prototypeDagPath, prototypeUsdPath);
 
             // Try to be conservative and only create an intermediary xformOp
             // with the instancerTranslate if we can ensure that we don't need
@@ -317,7 +337,6 @@ bool PxrUsdTranslators_InstancerWriter::writeInstancerAttrs(
                 /*forceUninstance*/ false,
                 /*exportRootVisibility*/ false,
                 &_prototypeWriters);
-            prototypesRel.AddTarget(prototypeUsdPath);
         }
 
         _numPrototypes = numElements;
@@ -47,6 +47,9 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// Prototypes may thus be exported twice if they are included in the
 /// selection of nodes to export -- once at their original location in the
 /// hierarchy, and another time as a prototype of the UsdGeomPointInstancer.
+///
+/// Instancers sharing a prototype only write it once: the prototype prims of
+/// the following instancers reference the prototype of the first one.
 class PxrUsdTranslators_InstancerWriter : public UsdMayaTransformWriter
 {
 public:
@@ -56,6 +59,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void                 Write(const UsdTimeCode& usdTime) override;
+    bool                 IsAnimated() const override;
     void                 PostExport() override;
     bool                 ShouldPruneChildren() const override;
     const SdfPathVector& GetModelPaths() const override;
@@ -51,6 +51,9 @@ PxrUsdTranslators_DirectionalLightWriter::PxrUsdTranslators_DirectionalLightWrit
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_DirectionalLightWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_DirectionalLightWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -104,6 +107,9 @@ PxrUsdTranslators_PointLightWriter::PxrUsdTranslators_PointLightWriter(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_PointLightWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_PointLightWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -157,6 +163,9 @@ PxrUsdTranslators_SpotLightWriter::PxrUsdTranslators_SpotLightWriter(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_SpotLightWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_SpotLightWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -209,6 +218,9 @@ PxrUsdTranslators_AreaLightWriter::PxrUsdTranslators_AreaLightWriter(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_AreaLightWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_AreaLightWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -50,6 +50,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 };
 
 /// Exports Maya point lights to UsdLux sphere lights
@@ -62,6 +63,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 };
 
 /// Exports Maya spot lights to UsdLux sphere lights
@@ -74,6 +76,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 };
 
 /// Exports Maya area lights to UsdLux rect lights
@@ -86,6 +89,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
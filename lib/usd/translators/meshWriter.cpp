@@ -308,7 +308,7 @@ bool PxrUsdTranslators_MeshWriter::writeAnimatedMeshExtents(
     // NOTE: (yliangsiew) We also cache the animated extents out here; this
     // will be written at the SkelRoot level later on.
     TF_VERIFY(!deformedMesh.isNull());
-    TF_VERIFY(deformedMesh.hasFn(MFn::kMesh));
+    TF_VERIFY(deformedMesh.hasFn(MFn::kMesh) || deformedMesh.hasFn(MFn::kMeshData));
     MStatus stat;
     MFnMesh fnMesh(deformedMesh, &stat);
     CHECK_MSTATUS_AND_RETURN(stat, false);
@@ -330,6 +330,55 @@ bool PxrUsdTranslators_MeshWriter::writeAnimatedMeshExtents(
     return bStat;
 }
 
+bool PxrUsdTranslators_MeshWriter::IsAnimated() const
+{
+    // The skinned meshes write their extents and blendshape weights at every time sample.
+    return _HasAnimCurves() || !_skelInputMesh.isNull() || _GetExportArgs().exportBlendShapes;
+}
+
+bool PxrUsdTranslators_MeshWriter::canPrefetchPoints(const UsdTimeCode& usdTime) const
+{
+    // Only the points of the final mesh are read ahead, the skinned and
+    // blendshape meshes need to walk the graph.
+    return !usdTime.IsDefault() && isMeshAnimated() && !_GetExportArgs().exportBlendShapes;
+}
+
+void PxrUsdTranslators_MeshWriter::EvaluateFrame(const UsdTimeCode& usdTime)
+{
+    if (!canPrefetchPoints(usdTime)) {
+        return;
+    }
+
+    // Pulling the output mesh computes it, PrefetchFrame() then only reads
+    // the data cached on the plug.
+    MStatus           status { MS::kSuccess };
+    MFnDependencyNode meshNode(GetMayaObject(), &status);
+    if (!status) {
+        return;
+    }
+    MPlug outMeshPlug = meshNode.findPlug("outMesh", true, &status);
+    if (status) {
+        outMeshPlug.asMObject();
+    }
+}
+
+void PxrUsdTranslators_MeshWriter::PrefetchFrame(const UsdTimeCode& usdTime)
+{
+    _prefetchedTime = UsdTimeCode::Default();
+
+    if (!canPrefetchPoints(usdTime)) {
+        return;
+    }
+
+    MStatus status { MS::kSuccess };
+    MFnMesh finalMesh(GetDagPath(), &status);
+    if (status
+        && UsdMayaMeshWriteUtils::readPointsData(
+            finalMesh, &_prefetchedPoints, &_prefetchedExtent)) {
+        _prefetchedTime = usdTime;
+    }
+}
+
 void PxrUsdTranslators_MeshWriter::Write(const UsdTimeCode& usdTime)
 {
     UsdMayaPrimWriter::Write(usdTime);
@@ -451,6 +500,14 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
             }
         }
     }
+
+    // When the time sample is evaluated in a DG context, the function sets read
+    // the mesh of the current time instead, so the deformed mesh is read from
+    // the output plug evaluated in that context.
+    const MObject contextMesh = UsdMayaUtil::getContextEvaluatedData(GetMayaObject(), "outMesh");
+    if (!contextMesh.isNull() && geomMeshObj == finalMesh.object()) {
+        geomMeshObj = contextMesh;
+    }
     MFnMesh geomMesh(geomMeshObj, &status);
     if (!status) {
         TF_RUNTIME_ERROR(
@@ -501,7 +558,8 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
     // NOTE: (yliangsiew) Write out the final deformed mesh extents for each frame here.
     MDagPath deformedMeshDagPath = this->GetDagPath();
     MObject  deformedMesh = deformedMeshDagPath.node();
-    bStat = this->writeAnimatedMeshExtents(deformedMesh, usdTime);
+    bStat = this->writeAnimatedMeshExtents(
+        contextMesh.isNull() ? deformedMesh : contextMesh, usdTime);
     if (!bStat) {
         return false;
     }
@@ -587,8 +645,18 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
         // TODO: (yliangsiew) Any other deformers that get implemented in the future will have to
         // make sure that they don't just enter this scope; otherwise, their deformed point
         // positions will get "baked" into the pref pose as well.
-        UsdMayaMeshWriteUtils::writePointsData(
-            geomMesh, primSchema, usdTime, _GetSparseValueWriter());
+        if (!usdTime.IsDefault() && _prefetchedTime == usdTime) {
+            UsdMayaMeshWriteUtils::writePointsData(
+                _prefetchedPoints,
+                _prefetchedExtent,
+                primSchema,
+                usdTime,
+                _GetSparseValueWriter(),
+                &_prevMeshPointsSample);
+        } else {
+            UsdMayaMeshWriteUtils::writePointsData(
+                geomMesh, primSchema, usdTime, _GetSparseValueWriter(), &_prevMeshPointsSample);
+        }
     }
 
     // Write faceVertexIndices
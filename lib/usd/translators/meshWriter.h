@@ -54,6 +54,9 @@ public:
         const SdfPath&           usdPath,
         UsdMayaWriteJobContext&  jobCtx);
 
+    bool IsAnimated() const override;
+    void EvaluateFrame(const UsdTimeCode& usdTime) override;
+    void PrefetchFrame(const UsdTimeCode& usdTime) override;
     void Write(const UsdTimeCode& usdTime) override;
     bool ExportsGprims() const override;
     void PostExport() override;
@@ -70,6 +73,9 @@ private:
     /// skinCluster is applied but we don't support that right now.
     bool isMeshAnimated() const;
 
+    /// Whether the points at \p usdTime are read ahead by PrefetchFrame().
+    bool canPrefetchPoints(const UsdTimeCode& usdTime) const;
+
     MObject writeBlendShapeData(UsdGeomMesh& primSchema);
     bool    writeBlendShapeAnimation(const UsdTimeCode& usdTime);
     bool    writeAnimatedMeshExtents(const MObject& deformedMesh, const UsdTimeCode& usdTime);
@@ -89,6 +95,15 @@ private:
     /// The previous sample for the mesh extents. Cached between iterations.
     VtVec3fArray _prevMeshExtentsSample;
 
+    /// The previous sample for the mesh points. Cached between iterations.
+    VtVec3fArray _prevMeshPointsSample;
+
+    /// Points and extent read by PrefetchFrame(), written by the next Write()
+    /// call at the same time.
+    VtVec3fArray _prefetchedPoints;
+    VtVec3fArray _prefetchedExtent;
+    UsdTimeCode  _prefetchedTime = UsdTimeCode::Default();
+
     UsdSkelAnimation _skelAnim;
 
     /// Set of color sets that should be excluded.
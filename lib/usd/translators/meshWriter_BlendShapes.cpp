@@ -23,8 +23,10 @@
 #include <mayaUsd/fileio/utils/writeUtil.h>
 
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usdGeom/pointBased.h>
 #include <pxr/usd/usdSkel/bindingAPI.h>
@@ -121,67 +123,167 @@ float mayaGetBlendShapeTargetWeightFromIndex(const unsigned int index)
     return targetWeight;
 }
 
-MStatus mayaFindPtAndNormalOffsetsBetweenMeshes(
-    const MObject&    a,
-    const MObject&    b,
-    VtVec3fArray&     ptOffsets,
-    VtVec3fArray&     nrmOffsets,
-    const VtIntArray& indices)
+// Offsets at or below the threshold are not exported.
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_EXPORT_BLENDSHAPE_ZERO_THRESHOLD,
+    "",
+    "The components of a blendshape target whose point and normal offsets are both at or below "
+    "this length are not exported. All the components are exported when empty.");
+
+float mayaGetBlendShapeZeroThreshold()
 {
-    MStatus status;
-    TF_VERIFY(MObjectHandle(a).isAlive() && MObjectHandle(b).isAlive());
-    if (!a.hasFn(MFn::kMesh) || !b.hasFn(MFn::kMesh)) {
-        return MStatus::kInvalidParameter;
-    }
+    const std::string& threshold = TfGetEnvSetting(MAYAUSD_EXPORT_BLENDSHAPE_ZERO_THRESHOLD);
+    return threshold.empty() ? -1.0f : static_cast<float>(TfStringToDouble(threshold));
+}
+
+/// The raw points and normals of a mesh, valid as long as the mesh is not evaluated again.
+struct MayaRawMeshData
+{
+    const GfVec3f* points = nullptr;
+    const GfVec3f* normals = nullptr;
+};
 
-    size_t numIndices = indices.size();
-    if (numIndices == 0) {
+MStatus mayaGetRawMeshData(const MObject& mesh, MayaRawMeshData& data)
+{
+    MStatus status;
+    TF_VERIFY(MObjectHandle(mesh).isAlive());
+    if (!mesh.hasFn(MFn::kMesh)) {
         return MStatus::kInvalidParameter;
     }
 
-    ptOffsets.resize(numIndices);
-    nrmOffsets.resize(numIndices);
-
-    MFnMesh fnMesh(a, &status);
+    MFnMesh fnMesh(mesh, &status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    const float* nrmsA = fnMesh.getRawNormals(&status);
+    const float* nrms = fnMesh.getRawNormals(&status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    const GfVec3f* pVtNrmsA = reinterpret_cast<const GfVec3f*>(nrmsA);
-
     // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsA = fnMesh.getRawPoints(&status);
+    const float* pts = fnMesh.getRawPoints(&status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    const GfVec3f* pVtPtsA = reinterpret_cast<const GfVec3f*>(ptsA);
+    data.points = reinterpret_cast<const GfVec3f*>(pts);
+    data.normals = reinterpret_cast<const GfVec3f*>(nrms);
+    return status;
+}
 
-    status = fnMesh.setObject(b);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+void mayaFindPtAndNormalOffsetsBetweenMeshes(
+    const MayaRawMeshData& a,
+    const MayaRawMeshData& b,
+    VtVec3fArray&          ptOffsets,
+    VtVec3fArray&          nrmOffsets,
+    const VtIntArray&      indices)
+{
+    const size_t numIndices = indices.size();
+    ptOffsets.resize(numIndices);
+    nrmOffsets.resize(numIndices);
 
-    const float* nrmsB = fnMesh.getRawNormals(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    // Take the raw pointers once, the non-const element accessors of VtArray check for a
+    // copy-on-write detach on every call.
+    const int* pIndices = indices.cdata();
+    GfVec3f*   pPtOffsets = ptOffsets.data();
+    GfVec3f*   pNrmOffsets = nrmOffsets.data();
+    for (size_t i = 0; i < numIndices; ++i) {
+        const int componentIdx = pIndices[i];
+        pPtOffsets[i] = b.points[componentIdx] - a.points[componentIdx];
+        pNrmOffsets[i] = b.normals[componentIdx] - a.normals[componentIdx];
+    }
+}
 
-    const GfVec3f* pVtNrmsB = reinterpret_cast<const GfVec3f*>(nrmsB);
+// Removes the components whose point and normal offsets are both at or below the threshold. At
+// least one component is kept, since a blendshape without point indices applies to all the points.
+void mayaRemoveZeroOffsets(MayaBlendShapeTargetDatum& target, const float threshold)
+{
+    const size_t numIndices = target.indices.size();
+    if (threshold < 0.0f || numIndices == 0 || target.ptOffsets.size() != numIndices
+        || target.normalOffsets.size() != numIndices) {
+        return;
+    }
 
-    // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsB = fnMesh.getRawPoints(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    const float    thresholdSq = threshold * threshold;
+    const int*     pIndices = target.indices.cdata();
+    const GfVec3f* pPtOffsets = target.ptOffsets.cdata();
+    const GfVec3f* pNrmOffsets = target.normalOffsets.cdata();
+
+    std::vector<size_t> kept;
+    kept.reserve(numIndices);
+    for (size_t i = 0; i < numIndices; ++i) {
+        if (pPtOffsets[i].GetLengthSq() > thresholdSq
+            || pNrmOffsets[i].GetLengthSq() > thresholdSq) {
+            kept.push_back(i);
+        }
+    }
+    if (kept.size() == numIndices) {
+        return;
+    }
+    if (kept.empty()) {
+        kept.push_back(0);
+    }
 
-    const GfVec3f* pVtPtsB = reinterpret_cast<const GfVec3f*>(ptsB);
+    VtIntArray   indices(kept.size());
+    VtVec3fArray ptOffsets(kept.size());
+    VtVec3fArray nrmOffsets(kept.size());
+    for (size_t i = 0; i < kept.size(); ++i) {
+        indices[i] = pIndices[kept[i]];
+        ptOffsets[i] = pPtOffsets[kept[i]];
+        nrmOffsets[i] = pNrmOffsets[kept[i]];
+    }
+    target.indices.swap(indices);
+    target.ptOffsets.swap(ptOffsets);
+    target.normalOffsets.swap(nrmOffsets);
+}
 
-    for (unsigned int i = 0; i < numIndices; ++i) {
-        const int     componentIdx = indices[i];
-        const GfVec3f ptA = pVtPtsA[componentIdx];
-        const GfVec3f ptB = pVtPtsB[componentIdx];
-        ptOffsets[i] = ptB - ptA;
+/// A target of a blendshape node whose offsets are completed once all the targets are gathered.
+struct MayaBlendShapeTargetJob
+{
+    size_t          weightDataIndex;
+    size_t          targetIndex;
+    MayaRawMeshData targetMeshData; // Only when the target has a geometry target mesh.
+};
 
-        const GfVec3f nrmA = pVtNrmsA[componentIdx];
-        const GfVec3f nrmB = pVtNrmsB[componentIdx];
-        nrmOffsets[i] = nrmB - nrmA;
+// Computes the offsets of the targets of a blendshape node from their geometry target meshes and
+// removes the zero offsets. The raw mesh data is read first, since the Maya API is not thread
+// safe, then the targets are processed in parallel.
+void mayaCompleteBlendShapeTargets(
+    MayaBlendShapeDatum&                  info,
+    std::vector<MayaBlendShapeTargetJob>& jobs)
+{
+    MayaRawMeshData baseMeshData;
+    bool            needsBaseMesh = false;
+    for (MayaBlendShapeTargetJob& job : jobs) {
+        const MayaBlendShapeTargetDatum& target
+            = info.weightDatas[job.weightDataIndex].targets[job.targetIndex];
+        if (!target.targetMesh.isNull()) {
+            mayaGetRawMeshData(target.targetMesh, job.targetMeshData);
+            needsBaseMesh = true;
+        }
+    }
+    if (needsBaseMesh) {
+        mayaGetRawMeshData(info.baseMesh, baseMeshData);
     }
 
-    return status;
+    const float threshold = mayaGetBlendShapeZeroThreshold();
+    WorkParallelForN(jobs.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const MayaBlendShapeTargetJob& job = jobs[i];
+            MayaBlendShapeTargetDatum&     target
+                = info.weightDatas[job.weightDataIndex].targets[job.targetIndex];
+            if (!target.targetMesh.isNull()) {
+                if (baseMeshData.points && baseMeshData.normals && job.targetMeshData.points
+                    && job.targetMeshData.normals) {
+                    mayaFindPtAndNormalOffsetsBetweenMeshes(
+                        baseMeshData,
+                        job.targetMeshData,
+                        target.ptOffsets,
+                        target.normalOffsets,
+                        target.indices);
+                } else {
+                    target.ptOffsets.assign(target.indices.size(), GfVec3f(0.0f));
+                    target.normalOffsets.assign(target.indices.size(), GfVec3f(0.0f));
+                }
+            }
+            mayaRemoveZeroOffsets(target, threshold);
+        }
+    });
 }
 
 #if MAYA_BLENDSHAPE_EVAL_HOTFIX
@@ -374,6 +476,8 @@ MStatus mayaGetBlendShapeInfosForMesh(
         mayaBlendShapeTriggerAllTargets(curBlendShape);
 #endif
 
+        std::vector<MayaBlendShapeTargetJob> targetJobs;
+
         for (unsigned int i = 0; i < weightIndices.length(); ++i) {
             MayaBlendShapeWeightDatum weightInfo = {};
             weightInfo.weightIndex = weightIndices[i];
@@ -457,13 +561,8 @@ MStatus mayaGetBlendShapeInfosForMesh(
                     MObject meshInGeomTgt = plgInGeomTgtSrc.node();
                     TF_VERIFY(meshInGeomTgt.hasFn(MFn::kMesh));
 
+                    // NOTE: The offsets are computed by mayaCompleteBlendShapeTargets().
                     meshTargetDatum.targetMesh = meshInGeomTgt;
-                    mayaFindPtAndNormalOffsetsBetweenMeshes(
-                        inputGeo,
-                        meshInGeomTgt,
-                        meshTargetDatum.ptOffsets,
-                        meshTargetDatum.normalOffsets,
-                        meshTargetDatum.indices);
                 } else {
                     // NOTE: (yliangsiew) If there is no geometry target, then we have to assume
                     // the target has already been "baked" into the blendshape deformer. In this
@@ -484,6 +583,8 @@ MStatus mayaGetBlendShapeInfosForMesh(
                         meshTargetDatum.ptOffsets.push_back(GfVec3f(pt.x, pt.y, pt.z));
                     }
                 }
+                targetJobs.push_back(
+                    { info.weightDatas.size(), weightInfo.targets.size(), MayaRawMeshData() });
                 weightInfo.targets.push_back(meshTargetDatum);
             }
 
@@ -499,6 +600,8 @@ MStatus mayaGetBlendShapeInfosForMesh(
 
             info.weightDatas.push_back(weightInfo);
         }
+
+        mayaCompleteBlendShapeTargets(info, targetJobs);
         outInfos.push_back(info);
     }
     return stat;
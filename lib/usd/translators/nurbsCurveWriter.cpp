@@ -20,6 +20,7 @@
 #include <mayaUsd/fileio/utils/adaptor.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
+#include <mayaUsd/utils/util.h>
 
 #include <pxr/base/gf/vec2d.h>
 #include <pxr/base/gf/vec3f.h>
@@ -93,6 +94,9 @@ PxrUsdTranslators_NurbsCurveWriter::PxrUsdTranslators_NurbsCurveWriter(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_NurbsCurveWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_NurbsCurveWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -123,6 +127,14 @@ bool PxrUsdTranslators_NurbsCurveWriter::writeNurbsCurveAttrs(
         return false;
     }
 
+    // When the time sample is evaluated in a DG context, the function set reads
+    // the curve of the current time instead, so the curve is read from the output
+    // plug evaluated in that context.
+    const MObject contextCurve = UsdMayaUtil::getContextEvaluatedData(GetMayaObject(), "local");
+    if (!contextCurve.isNull()) {
+        curveFn.setObject(contextCurve);
+    }
+
     // How to repeat the end knots.
     bool                wrap = false;
     MFnNurbsCurve::Form form(curveFn.form());
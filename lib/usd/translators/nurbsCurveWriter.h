@@ -40,6 +40,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 
     bool ExportsGprims() const override;
 
@@ -20,6 +20,7 @@
 #include <mayaUsd/fileio/utils/adaptor.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
+#include <mayaUsd/utils/util.h>
 
 #include <pxr/base/gf/vec2d.h>
 #include <pxr/base/gf/vec2f.h>
@@ -105,6 +106,9 @@ static void _FixNormalizedKnotRange(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_NurbsSurfaceWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_NurbsSurfaceWriter::Write(const UsdTimeCode& usdTimeCode)
 {
@@ -134,11 +138,26 @@ bool PxrUsdTranslators_NurbsSurfaceWriter::writeNurbsSurfaceAttrs(
         return false;
     }
 
+    // When the time sample is evaluated in a DG context, the function set reads
+    // the surface of the current time instead, so the surface is read from the output
+    // plug evaluated in that context.
+    const MObject contextSurface = UsdMayaUtil::getContextEvaluatedData(GetMayaObject(), "local");
+    if (!contextSurface.isNull()) {
+        nurbs.setObject(contextSurface);
+    }
+
+    // Animated surfaces write the points and extent on every frame, but the
+    // attributes authored at the default time only need to be gathered once.
+    // Getting the trim boundaries in particular is expensive.
+    // They are flagged as written only once all of them were, so a frame that
+    // fails to be written does not skip them for the rest of the export.
+    const bool writeDefaultTimeAttrs = !_wroteDefaultTimeAttrs;
+
     // Gather GPrim DisplayColor/DisplayOpacity
     // We use the same code used for gathering shader data on a mesh
     // but we pass 0 for the numfaces argument since there is no per face
     // shader assignment possible.
-    if (_GetExportArgs().exportDisplayColor) {
+    if (writeDefaultTimeAttrs && _GetExportArgs().exportDisplayColor) {
         VtArray<GfVec3f> RGBData;
         VtArray<float>   AlphaData;
         TfToken          interpolation;
@@ -251,7 +270,7 @@ bool PxrUsdTranslators_NurbsSurfaceWriter::writeNurbsSurfaceAttrs(
 
     // Create st vec2f vertex primvar
     VtArray<GfVec2f> stValues;
-    if (_GetExportArgs().exportNurbsExplicitUV) {
+    if (writeDefaultTimeAttrs && _GetExportArgs().exportNurbsExplicitUV) {
         stValues.resize(numCVsInU * numCVsInV);
     }
 
@@ -289,6 +308,12 @@ bool PxrUsdTranslators_NurbsSurfaceWriter::writeNurbsSurfaceAttrs(
     UsdGeomPointBased::ComputeExtent(sampPos, &extent);
     UsdMayaWriteUtil::SetAttribute(
         primSchema.CreateExtentAttr(), extent, usdTimeCode, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        primSchema.GetPointsAttr(), sampPos, usdTimeCode, _GetSparseValueWriter());
+
+    if (!writeDefaultTimeAttrs) {
+        return true;
+    }
 
     // Set NurbsPatch attributes
     UsdMayaWriteUtil::SetAttribute(
@@ -319,8 +344,6 @@ bool PxrUsdTranslators_NurbsSurfaceWriter::writeNurbsSurfaceAttrs(
         primSchema.GetURangeAttr(), uRange, UsdTimeCode::Default(), _GetSparseValueWriter());
     UsdMayaWriteUtil::SetAttribute(
         primSchema.GetVRangeAttr(), vRange, UsdTimeCode::Default(), _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        primSchema.GetPointsAttr(), sampPos, usdTimeCode, _GetSparseValueWriter());
     if (setWeights) {
         UsdMayaWriteUtil::SetAttribute(
             primSchema.GetPointWeightsAttr(),
@@ -390,6 +413,7 @@ bool PxrUsdTranslators_NurbsSurfaceWriter::writeNurbsSurfaceAttrs(
     // If not trimmed surface, you are done
     // ONLY TRIM CURVE CODE BEYOND THIS POINT
     if (!nurbs.isTrimmedSurface()) {
+        _wroteDefaultTimeAttrs = true;
         return true;
     }
 
@@ -526,6 +550,7 @@ bool PxrUsdTranslators_NurbsSurfaceWriter::writeNurbsSurfaceAttrs(
         _GetSparseValueWriter());
 
     // NO NON TRIM CODE HERE SINCE WE RETURN EARLIER IF NOT TRIMMED
+    _wroteDefaultTimeAttrs = true;
     return true;
 }
 
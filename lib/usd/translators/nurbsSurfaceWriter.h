@@ -40,11 +40,18 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 
     bool ExportsGprims() const override;
 
 protected:
     bool writeNurbsSurfaceAttrs(const UsdTimeCode& usdTime, UsdGeomNurbsPatch& primSchema);
+
+private:
+    /// Whether the attributes authored at the default time (knots, forms,
+    /// weights, st, display color and trim curves) have been written. They
+    /// are only gathered on the first written frame of animated surfaces.
+    bool _wroteDefaultTimeAttrs = false;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -20,8 +20,10 @@
 #include <mayaUsd/fileio/utils/adaptor.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
+#include <mayaUsd/utils/converter.h>
 
 #include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
@@ -29,6 +31,7 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/points.h>
+#include <pxr/usd/usdUtils/sparseValueWriter.h>
 
 #include <maya/MAnimControl.h>
 #include <maya/MDoubleArray.h>
@@ -49,6 +52,12 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_EXPORT_PARTICLE_SPARSE_SAMPLES,
+    true,
+    "When false, the per-particle arrays are written at every time sample without being compared "
+    "with the previous sample.");
+
 PXRUSDMAYA_REGISTER_WRITER(particle, PxrUsdTranslators_ParticleWriter);
 PXRUSDMAYA_REGISTER_ADAPTOR_SCHEMA(particle, UsdGeomPoints);
 
@@ -56,46 +65,39 @@ PXRUSDMAYA_REGISTER_WRITER(nParticle, PxrUsdTranslators_ParticleWriter);
 PXRUSDMAYA_REGISTER_ADAPTOR_SCHEMA(nParticle, UsdGeomPoints);
 
 namespace {
-template <typename T> inline void _convertVector(T& t, const MVector& v)
+template <typename T> using _sharedVtArray = std::shared_ptr<VtArray<T>>;
+
+// The Maya arrays are converted in bulk by the converters of mayaUsd.
+_sharedVtArray<GfVec3f> _convertVectorArray(const MVectorArray& a)
 {
-    // I wish we had concepts
-    // We are guaranteed to have arithmetic types
-    using _t = decltype(+t[0]);
-    t[0] = static_cast<_t>(v.x);
-    t[1] = static_cast<_t>(v.y);
-    t[2] = static_cast<_t>(v.z);
+    auto ret = std::make_shared<VtVec3fArray>();
+    MayaUsd::TypedConverter<MVectorArray, VtVec3fArray>::convert(a, *ret);
+    return ret;
 }
 
-template <typename T> using _sharedVtArray = std::shared_ptr<VtArray<T>>;
-
-template <typename T> _sharedVtArray<T> _convertVectorArray(const MVectorArray& a)
+_sharedVtArray<float> _convertArray(const MDoubleArray& a)
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        _convertVector<T>(ret->operator[](i), a[i]);
-    }
-    return _sharedVtArray<T>(ret);
+    auto ret = std::make_shared<VtFloatArray>();
+    MayaUsd::TypedConverter<MDoubleArray, VtFloatArray>::convert(a, *ret);
+    return ret;
 }
 
-template <typename T> _sharedVtArray<T> _convertArray(const MDoubleArray& a)
+_sharedVtArray<int> _convertArray(const MIntArray& a)
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
-    }
-    return _sharedVtArray<T>(ret);
+    auto ret = std::make_shared<VtIntArray>();
+    MayaUsd::TypedConverter<MIntArray, VtIntArray>::convert(a, *ret);
+    return ret;
 }
 
-template <typename T> _sharedVtArray<T> _convertArray(const MIntArray& a)
+_sharedVtArray<int64_t> _convertIds(const MIntArray& a)
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
+    const unsigned int count = a.length();
+    auto               ret = std::make_shared<VtInt64Array>(count);
+    int64_t*           dst = ret->data();
+    for (unsigned int i = 0; i < count; ++i) {
+        dst[i] = a[i];
     }
-    return _sharedVtArray<T>(ret);
+    return ret;
 }
 
 template <typename T> using _strVecPair = std::pair<TfToken, _sharedVtArray<T>>;
@@ -119,18 +121,70 @@ template <typename T> void _resizeVectors(_strVecPairVec<T>& a, size_t size)
     }
 }
 
+template <typename T> using _previousArrays = PxrUsdTranslators_ParticleWriter::PreviousArrays<T>;
+
+// Writes the array at the time sample. The overloads of the element types supported by
+// UsdMayaWriteUtil::SetArrayAttribute() first compare it with the array previously written to
+// the attribute, so the sparse value writer does not compare the elements again.
+template <typename T>
+inline void _setArray(
+    const UsdAttribute&        attr,
+    VtArray<T>*                a,
+    _previousArrays<T>*        previous,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter)
+{
+    UsdMayaWriteUtil::SetAttribute(attr, a, usdTime, valueWriter);
+}
+
+template <typename T>
+inline void _setComparedArray(
+    const UsdAttribute&        attr,
+    VtArray<T>*                a,
+    _previousArrays<T>*        previous,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter)
+{
+    if (!valueWriter) {
+        UsdMayaWriteUtil::SetAttribute(attr, a, usdTime);
+        return;
+    }
+    UsdMayaWriteUtil::SetArrayAttribute(
+        attr, a, &(*previous)[attr.GetName()], usdTime, valueWriter);
+}
+
+inline void _setArray(
+    const UsdAttribute&        attr,
+    VtVec3fArray*              a,
+    _previousArrays<GfVec3f>*  previous,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter)
+{
+    _setComparedArray(attr, a, previous, usdTime, valueWriter);
+}
+
+inline void _setArray(
+    const UsdAttribute&        attr,
+    VtFloatArray*              a,
+    _previousArrays<float>*    previous,
+    const UsdTimeCode&         usdTime,
+    UsdUtilsSparseValueWriter* valueWriter)
+{
+    _setComparedArray(attr, a, previous, usdTime, valueWriter);
+}
+
 template <typename T>
 inline void _addAttr(
     UsdGeomPoints&             points,
     const TfToken&             name,
     const SdfValueTypeName&    typeName,
-    const VtArray<T>&          a,
+    VtArray<T>*                a,
+    _previousArrays<T>*        previous,
     const UsdTimeCode&         usdTime,
     UsdUtilsSparseValueWriter* valueWriter)
 {
-    auto    attr = points.GetPrim().CreateAttribute(name, typeName, false, SdfVariabilityVarying);
-    VtValue val(a);
-    valueWriter->SetAttribute(attr, &val, usdTime);
+    auto attr = points.GetPrim().CreateAttribute(name, typeName, false, SdfVariabilityVarying);
+    _setArray(attr, a, previous, usdTime, valueWriter);
 }
 
 const TfToken _rgbName("rgb");
@@ -144,11 +198,12 @@ void _addAttrVec(
     UsdGeomPoints&             points,
     const SdfValueTypeName&    typeName,
     const _strVecPairVec<T>&   a,
+    _previousArrays<T>*        previous,
     const UsdTimeCode&         usdTime,
     UsdUtilsSparseValueWriter* valueWriter)
 {
     for (const auto& v : a) {
-        _addAttr(points, v.first, typeName, *v.second, usdTime, valueWriter);
+        _addAttr(points, v.first, typeName, v.second.get(), previous, usdTime, valueWriter);
     }
 }
 
@@ -238,6 +293,13 @@ PxrUsdTranslators_ParticleWriter::PxrUsdTranslators_ParticleWriter(
     initializeUserAttributes();
 }
 
+/* virtual */
+bool PxrUsdTranslators_ParticleWriter::IsAnimated() const
+{
+    // The particles are written at every time sample.
+    return true;
+}
+
 /* virtual */
 void PxrUsdTranslators_ParticleWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -301,34 +363,34 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
     MIntArray    mayaInts;
 
     deformedParticleSys.position(mayaVectors);
-    auto positions = _convertVectorArray<GfVec3f>(mayaVectors);
+    auto positions = _convertVectorArray(mayaVectors);
     particleSys.velocity(mayaVectors);
-    auto velocities = _convertVectorArray<GfVec3f>(mayaVectors);
+    auto velocities = _convertVectorArray(mayaVectors);
     particleSys.particleIds(mayaInts);
-    auto ids = _convertArray<int64_t>(mayaInts);
+    auto ids = _convertIds(mayaInts);
     particleSys.radius(mayaDoubles);
-    auto radii = _convertArray<float>(mayaDoubles);
+    auto radii = _convertArray(mayaDoubles);
     particleSys.mass(mayaDoubles);
-    auto masses = _convertArray<float>(mayaDoubles);
+    auto masses = _convertArray(mayaDoubles);
 
     if (particleSys.hasRgb()) {
         particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_rgbName, _convertVectorArray<GfVec3f>(mayaVectors));
+        vectors.emplace_back(_rgbName, _convertVectorArray(mayaVectors));
     }
 
     if (particleSys.hasEmission()) {
         particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_emissionName, _convertVectorArray<GfVec3f>(mayaVectors));
+        vectors.emplace_back(_emissionName, _convertVectorArray(mayaVectors));
     }
 
     if (particleSys.hasOpacity()) {
         particleSys.opacity(mayaDoubles);
-        floats.emplace_back(_opacityName, _convertArray<float>(mayaDoubles));
+        floats.emplace_back(_opacityName, _convertArray(mayaDoubles));
     }
 
     if (particleSys.hasLifespan()) {
         particleSys.lifespan(mayaDoubles);
-        floats.emplace_back(_lifespanName, _convertArray<float>(mayaDoubles));
+        floats.emplace_back(_lifespanName, _convertArray(mayaDoubles));
     }
 
     for (const auto& attr : mUserAttributes) {
@@ -337,19 +399,19 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
         case PER_PARTICLE_INT:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaInts, &status);
             if (status) {
-                ints.emplace_back(std::get<0>(attr), _convertArray<int>(mayaInts));
+                ints.emplace_back(std::get<0>(attr), _convertArray(mayaInts));
             }
             break;
         case PER_PARTICLE_DOUBLE:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaDoubles, &status);
             if (status) {
-                floats.emplace_back(std::get<0>(attr), _convertArray<float>(mayaDoubles));
+                floats.emplace_back(std::get<0>(attr), _convertArray(mayaDoubles));
             }
             break;
         case PER_PARTICLE_VECTOR:
             particleSys.getPerParticleAttribute(std::get<1>(attr), mayaVectors, &status);
             if (status) {
-                vectors.emplace_back(std::get<0>(attr), _convertVectorArray<GfVec3f>(mayaVectors));
+                vectors.emplace_back(std::get<0>(attr), _convertVectorArray(mayaVectors));
             }
             break;
         }
@@ -377,33 +439,49 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
     radii->resize(minSize);
     masses->resize(minSize);
 
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetPointsAttr(), positions.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetVelocitiesAttr(), velocities.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetIdsAttr(), ids.get(), usdTime, _GetSparseValueWriter());
+    // Comparing the samples with the previous ones is wasted work when all the particles move at
+    // every frame, the env setting allows to write them directly.
+    UsdUtilsSparseValueWriter* valueWriter
+        = TfGetEnvSetting(MAYAUSD_EXPORT_PARTICLE_SPARSE_SAMPLES) ? _GetSparseValueWriter()
+                                                                  : nullptr;
+
+    _setArray(points.GetPointsAttr(), positions.get(), &mPreviousVectors, usdTime, valueWriter);
+    _setArray(
+        points.GetVelocitiesAttr(), velocities.get(), &mPreviousVectors, usdTime, valueWriter);
+    _setArray(
+        points.GetIdsAttr(),
+        ids.get(),
+        static_cast<PreviousArrays<int64_t>*>(nullptr),
+        usdTime,
+        valueWriter);
 
     // radius -> width conversion
     for (auto& r : *radii) {
         r = r * 2.0f;
     }
 
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetWidthsAttr(), radii.get(), usdTime, _GetSparseValueWriter());
+    _setArray(points.GetWidthsAttr(), radii.get(), &mPreviousFloats, usdTime, valueWriter);
 
     _addAttr(
         points,
         _massName,
         SdfValueTypeNames->FloatArray,
-        *masses,
+        masses.get(),
+        &mPreviousFloats,
         usdTime,
-        _GetSparseValueWriter());
+        valueWriter);
     // TODO: check if we need the array suffix!!
     _addAttrVec(
-        points, SdfValueTypeNames->Vector3fArray, vectors, usdTime, _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->FloatArray, floats, usdTime, _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->IntArray, ints, usdTime, _GetSparseValueWriter());
+        points, SdfValueTypeNames->Vector3fArray, vectors, &mPreviousVectors, usdTime, valueWriter);
+    _addAttrVec(
+        points, SdfValueTypeNames->FloatArray, floats, &mPreviousFloats, usdTime, valueWriter);
+    _addAttrVec(
+        points,
+        SdfValueTypeNames->IntArray,
+        ints,
+        static_cast<PreviousArrays<int>*>(nullptr),
+        usdTime,
+        valueWriter);
 }
 
 void PxrUsdTranslators_ParticleWriter::initializeUserAttributes()
@@ -21,7 +21,9 @@
 #include <mayaUsd/fileio/transformWriter.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 
+#include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -30,6 +32,8 @@
 #include <maya/MFnDependencyNode.h>
 #include <maya/MString.h>
 
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -44,6 +48,11 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
+
+    /// The arrays last written to the attributes, by attribute name.
+    template <typename T>
+    using PreviousArrays = std::unordered_map<TfToken, VtArray<T>, TfToken::HashFunctor>;
 
 private:
     void writeParams(const UsdTimeCode& usdTime, UsdGeomPoints& points);
@@ -57,6 +66,8 @@ private:
 
     std::vector<std::tuple<TfToken, MString, ParticleType>> mUserAttributes;
     bool                                                    mInitialFrameDone;
+    PreviousArrays<GfVec3f>                                 mPreviousVectors;
+    PreviousArrays<float>                                   mPreviousFloats;
 
     void initializeUserAttributes();
 };
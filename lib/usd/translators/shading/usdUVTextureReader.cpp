@@ -34,11 +34,9 @@
 #include <pxr/usd/ar/asset.h>
 #include <pxr/usd/ar/packageUtils.h>
 #include <pxr/usd/ar/resolver.h>
-#include <pxr/usd/sdf/layerUtils.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/sdf/types.h>
 #include <pxr/usd/sdf/valueTypeName.h>
-#include <pxr/usd/usd/resolver.h>
 #include <pxr/usd/usdShade/input.h>
 #include <pxr/usd/usdShade/output.h>
 #include <pxr/usd/usdShade/shader.h>
@@ -50,8 +48,6 @@
 #include <maya/MPlug.h>
 #include <maya/MStatus.h>
 
-#include <ghc/filesystem.hpp>
-
 PXR_NAMESPACE_OPEN_SCOPE
 
 class PxrMayaUsdUVTexture_Reader : public UsdMayaShaderReader
@@ -139,22 +135,8 @@ bool PxrMayaUsdUVTexture_Reader::Read(UsdMayaPrimReaderContext& context)
                 // USD did not resolve the path to absolute because the file name was not an
                 // actual file on disk. We need to find the first tile to help Maya find the
                 // other ones.
-                std::string udimPath(unresolvedFilePath.substr(0, udimPos));
-                udimPath += "1001";
-                udimPath += unresolvedFilePath.substr(
-                    udimPos + TrMayaTokens->UDIMTag.GetString().size());
-
-                Usd_Resolver res(&prim.GetPrimIndex());
-                for (; res.IsValid(); res.NextLayer()) {
-                    std::string resolvedName
-                        = SdfComputeAssetPathRelativeToLayer(res.GetLayer(), udimPath);
-
-                    if (!resolvedName.empty() && !ArIsPackageRelativePath(resolvedName)
-                        && resolvedName != udimPath) {
-                        udimPath = resolvedName;
-                        break;
-                    }
-                }
+                const std::string udimPath
+                    = UsdMayaShadingUtil::ResolveUdimFirstTile(prim, unresolvedFilePath);
                 val = SdfAssetPath(udimPath);
             }
         }
@@ -217,7 +199,7 @@ bool PxrMayaUsdUVTexture_Reader::Read(UsdMayaPrimReaderContext& context)
             if (needsUniqueFilename) {
                 int         counter = 0;
                 std::string checkPath(extractedFilePath);
-                while (ghc::filesystem::is_regular_file(checkPath)) {
+                while (UsdMayaShadingUtil::FileExists(checkPath)) {
                     checkPath.assign(extractedFilePath);
                     std::string filenameNoExt(checkPath);
                     std::string ext = UsdMayaUtilFileSystem::pathFindExtension(checkPath);
@@ -238,7 +220,7 @@ bool PxrMayaUsdUVTexture_Reader::Read(UsdMayaPrimReaderContext& context)
             // If the texture exists on disk already and it is has the same contents, however, we
             // skip overwriting it.
             bool needsWrite = true;
-            if (ghc::filesystem::is_regular_file(extractedFilePath)) {
+            if (UsdMayaShadingUtil::FileExists(extractedFilePath)) {
                 FILE* pFile = fopen(extractedFilePath.c_str(), "rb");
                 fseek(pFile, 0, SEEK_END);
                 long fileSize = ftell(pFile);
@@ -256,7 +238,7 @@ bool PxrMayaUsdUVTexture_Reader::Read(UsdMayaPrimReaderContext& context)
                 } else {
                     int         counter = 0;
                     std::string checkPath(extractedFilePath);
-                    while (ghc::filesystem::is_regular_file(checkPath)) {
+                    while (UsdMayaShadingUtil::FileExists(checkPath)) {
                         checkPath.assign(extractedFilePath);
                         std::string filenameNoExt(checkPath);
                         std::string ext = UsdMayaUtilFileSystem::pathFindExtension(checkPath);
@@ -285,6 +267,7 @@ bool PxrMayaUsdUVTexture_Reader::Read(UsdMayaPrimReaderContext& context)
                         extractedFilePath.c_str());
                     return false;
                 }
+                UsdMayaShadingUtil::AddExistingFile(extractedFilePath);
             }
 
             // NOTE: (yliangsiew) Continue setting the texture file node attribute to point to the
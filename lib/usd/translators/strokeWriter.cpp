@@ -150,6 +150,9 @@ static void _CollectCurveVertexData(
     }
 }
 
+/* virtual */
+bool PxrUsdTranslators_StrokeWriter::IsAnimated() const { return _HasAnimCurves(); }
+
 /* virtual */
 void PxrUsdTranslators_StrokeWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -39,6 +39,7 @@ public:
         UsdMayaWriteJobContext&  jobCtx);
 
     void Write(const UsdTimeCode& usdTime) override;
+    bool IsAnimated() const override;
 
     bool ExportsGprims() const override { return true; }
 };
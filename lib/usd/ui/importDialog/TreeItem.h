@@ -101,6 +101,14 @@ public:
     //! Only valid for kVariants type.
     void resetVariantSelectionModified() { fVariantSelectionModified = false; }
 
+    //! Returns true if the rows of the prim children were added under this item.
+    //! Only valid for kLoad type.
+    bool childrenFetched() const { return fChildrenFetched; }
+
+    //! Flags the rows of the prim children as added under this item.
+    //! Only valid for kLoad type.
+    void setChildrenFetched() { fChildrenFetched = true; }
+
 private:
     void initializeItem();
 
@@ -117,6 +125,9 @@ protected:
     // Special flag set when the variant selection was modified.
     bool fVariantSelectionModified;
 
+    // For the LOAD column, set once the children rows were added (the tree is built lazily).
+    bool fChildrenFetched;
+
     static QPixmap* fsCheckBoxOn;
     static QPixmap* fsCheckBoxOnDisabled;
     static QPixmap* fsCheckBoxOff;
@@ -18,6 +18,7 @@
 #include <mayaUsdUI/ui/IMayaMQtUtil.h>
 #include <mayaUsdUI/ui/ItemDelegate.h>
 #include <mayaUsdUI/ui/TreeItem.h>
+#include <mayaUsdUI/ui/TreeModelFactory.h>
 
 #include <pxr/usd/usd/variantSets.h>
 
@@ -73,6 +74,33 @@ void resetVariantToPrimSelection(TreeItem* variantItem)
     variantItem->resetVariantSelectionModified();
 }
 
+TreeItem::CheckState childCheckState(TreeItem::CheckState parentState)
+{
+    // Children of a checked item are in scope but can't be toggled, the others simply follow
+    // their parent.
+    switch (parentState) {
+    case TreeItem::CheckState::kChecked:
+    case TreeItem::CheckState::kChecked_Disabled: return TreeItem::CheckState::kChecked_Disabled;
+    default: return parentState;
+    }
+}
+
+int countDescendants(
+    const UsdPrim&                                   prim,
+    std::unordered_map<SdfPath, int, SdfPath::Hash>& counts,
+    const std::atomic<bool>&                         cancelled)
+{
+    int cnt = 0;
+    for (const auto& childPrim : prim.GetAllChildren()) {
+        if (cancelled)
+            break;
+        cnt += 1 + countDescendants(childPrim, counts, cancelled);
+    }
+    if (cnt > 0)
+        counts[prim.GetPath()] = cnt;
+    return cnt;
+}
+
 void resetAllVariants(TreeModel* treeModel, const QModelIndex& parent)
 {
     for (int r = 0; r < treeModel->rowCount(parent); ++r) {
@@ -100,6 +128,19 @@ TreeModel::TreeModel(
     , fImportData { importData }
     , fMayaQtUtil { mayaQtUtil }
 {
+    QObject::connect(
+        this,
+        SIGNAL(primCountFinished()),
+        this,
+        SLOT(onPrimCountFinished()),
+        Qt::QueuedConnection);
+}
+
+TreeModel::~TreeModel()
+{
+    fPrimCountCancelled = true;
+    if (fPrimCountThread.joinable())
+        fPrimCountThread.join();
 }
 
 QVariant TreeModel::data(const QModelIndex& index, int role /*= Qt::DisplayRole*/) const
@@ -129,6 +170,126 @@ Qt::ItemFlags TreeModel::flags(const QModelIndex& index) const
     return flags;
 }
 
+bool TreeModel::hasChildren(const QModelIndex& parent /*= QModelIndex()*/) const
+{
+    // Avoid building the children rows only to know if the expand arrow should be drawn.
+    TreeItem* item = unfetchedLoadItem(parent);
+    if (item != nullptr)
+        return !item->prim().GetAllChildren().empty();
+
+    return ParentClass::hasChildren(parent);
+}
+
+bool TreeModel::canFetchMore(const QModelIndex& parent) const
+{
+    return unfetchedLoadItem(parent) != nullptr;
+}
+
+void TreeModel::fetchMore(const QModelIndex& parent)
+{
+    TreeItem* item = unfetchedLoadItem(parent);
+    if (item != nullptr)
+        fetchChildren(item);
+}
+
+TreeItem* TreeModel::unfetchedLoadItem(const QModelIndex& index) const
+{
+    // Note: only the load column (0) has children.
+    if (!index.isValid() || index.column() != kTreeColumn_Load)
+        return nullptr;
+
+    TreeItem* item = static_cast<TreeItem*>(itemFromIndex(index));
+    if (item == nullptr || item->childrenFetched())
+        return nullptr;
+
+    return item;
+}
+
+void TreeModel::fetchChildren(TreeItem* item)
+{
+    item->setChildrenFetched();
+
+    // The new rows inherit the scope of their parent, which is what setChildCheckState() would
+    // have given them had they existed.
+    const TreeItem::CheckState state = childCheckState(item->checkState());
+    for (const auto& childPrim : item->prim().GetAllChildren()) {
+        QList<QStandardItem*> primDataCells = TreeModelFactory::createPrimRow(childPrim);
+        static_cast<TreeItem*>(primDataCells.front())->setCheckState(state);
+        item->appendRow(primDataCells);
+    }
+}
+
+TreeItem* TreeModel::fetchItem(const SdfPath& path)
+{
+    QStandardItem* rootItem = invisibleRootItem();
+    if (!path.IsAbsoluteRootOrPrimPath() || rootItem->rowCount() == 0)
+        return nullptr;
+
+    // Fetch the children of every ancestor so the row of the prim exists.
+    TreeItem* item = static_cast<TreeItem*>(rootItem->child(0, kTreeColumn_Load));
+    for (const SdfPath& prefix : path.GetPrefixes()) {
+        if (prefix == SdfPath::AbsoluteRootPath())
+            continue;
+
+        if (!item->childrenFetched())
+            fetchChildren(item);
+
+        TreeItem* childItem = nullptr;
+        for (int r = 0; r < item->rowCount() && childItem == nullptr; ++r) {
+            TreeItem* candidate = static_cast<TreeItem*>(item->child(r, kTreeColumn_Load));
+            if (candidate->prim().GetPath() == prefix)
+                childItem = candidate;
+        }
+        if (childItem == nullptr)
+            return nullptr;
+        item = childItem;
+    }
+    return item;
+}
+
+int TreeModel::descendantCount(const TreeItem* item) const
+{
+    // Once fetched, the children rows are counted one by one.
+    if (item->childrenFetched() || !fPrimCountReady)
+        return 0;
+
+    auto found = fDescendantCounts.find(item->prim().GetPath());
+    return found != fDescendantCounts.end() ? found->second : 0;
+}
+
+void TreeModel::unfetchedImportVariants(
+    const TreeItem*                    item,
+    ImportData::PrimVariantSelections& primVariantSelections) const
+{
+    // The import data variant selections are applied when the variant editors are created, so
+    // the ones of prims without a row yet are carried over as is.
+    if (fImportData == nullptr || item->childrenFetched())
+        return;
+
+    const SdfPath& itemPath = item->prim().GetPath();
+    for (const auto& primVarSel : fImportData->primVariantSelections()) {
+        if (primVarSel.first != itemPath && primVarSel.first.HasPrefix(itemPath))
+            primVariantSelections.emplace(primVarSel.first, primVarSel.second);
+    }
+}
+
+void TreeModel::startPrimCount(const UsdStageRefPtr& stage)
+{
+    if (fPrimCountThread.joinable() || !stage)
+        return;
+
+    // The stage is only read on the thread, and is kept alive until it ends.
+    fPrimCountThread = std::thread([this, stage]() {
+        countDescendants(stage->GetPseudoRoot(), fDescendantCounts, fPrimCountCancelled);
+        if (!fPrimCountCancelled) {
+            fPrimCountReady = true;
+            Q_EMIT primCountFinished();
+        }
+    });
+}
+
+void TreeModel::onPrimCountFinished() const { updateCheckedItemCount(); }
+
 void TreeModel::setParentsCheckState(const QModelIndex& child, TreeItem::CheckState state)
 {
     QModelIndex parentIndex = this->parent(child);
@@ -237,7 +398,10 @@ void TreeModel::fillPrimVariantSelections(
 
         // Note: only the load column (0) has children, so we use it when looking for children.
         QModelIndex childIndex = this->index(r, kTreeColumn_Load, parent);
-        if (hasChildren(childIndex)) {
+        TreeItem*   loadItem = static_cast<TreeItem*>(itemFromIndex(childIndex));
+        if (!loadItem->childrenFetched()) {
+            unfetchedImportVariants(loadItem, primVariantSelections);
+        } else if (hasChildren(childIndex)) {
             fillPrimVariantSelections(primVariantSelections, childIndex);
         }
     }
@@ -265,13 +429,7 @@ void TreeModel::setRootPrimPath(const std::string& path)
 {
     // Find the prim matching the root prim path from the import data and
     // check-enable it.
-    SdfPath rootPrimPath(path);
-    auto    fnFindRoot = [rootPrimPath](TreeItem* item) -> bool {
-        if (item->prim().GetPath() == rootPrimPath)
-            return true;
-        return false;
-    };
-    TreeItem* item = findTreeItem(this, QModelIndex(), fnFindRoot);
+    TreeItem* item = fetchItem(SdfPath(path));
     if (item != nullptr) {
         checkEnableItem(item);
     }
@@ -333,7 +491,11 @@ void TreeModel::countCheckedItems(
         const TreeItem::CheckState state = item->checkState();
         if (TreeItem::CheckState::kChecked == state
             || TreeItem::CheckState::kChecked_Disabled == state) {
-            nbChecked++;
+            nbChecked += 1 + descendantCount(item);
+
+            ImportData::PrimVariantSelections unfetchedVarSels;
+            unfetchedImportVariants(item, unfetchedVarSels);
+            nbVariantsModified += static_cast<int>(unfetchedVarSels.size());
 
             // We are only counting modified variants of in-scope prims
             QModelIndex variantChildIndex = this->index(r, kTreeColumn_Variants, parent);
@@ -370,6 +532,12 @@ void TreeModel::onItemClicked(TreeItem* item)
     }
 }
 
-void TreeModel::resetVariants() { resetAllVariants(this, QModelIndex()); }
+void TreeModel::resetVariants()
+{
+    resetAllVariants(this, QModelIndex());
+
+    // The import data variant selections no longer apply, not even to rows fetched later on.
+    fImportData = nullptr;
+}
 
 } // namespace MAYAUSD_NS_DEF
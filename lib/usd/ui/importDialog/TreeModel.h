@@ -22,10 +22,16 @@
 #include <mayaUsdUI/ui/TreeItem.h>
 #include <mayaUsdUI/ui/api.h>
 
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/stagePopulationMask.h>
 
 #include <QtGui/QStandardItemModel>
 
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
 class QTreeView;
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -37,7 +43,8 @@ class IMayaMQtUtil;
 /**
  * \brief Qt Model to explore the hierarchy of a USD file.
  * \remarks Populating the Model with the content of a USD file is done through
- * the APIs exposed by the TreeModelFactory.
+ * the APIs exposed by the TreeModelFactory. The rows of the children of a prim are only added
+ * when the tree view expands it (see canFetchMore() and fetchMore()).
  */
 class MAYAUSD_UI_PUBLIC TreeModel : public QStandardItemModel
 {
@@ -55,9 +62,15 @@ public:
         const ImportData*   importData = nullptr,
         QObject*            parent = nullptr) noexcept;
 
+    //! Destructor, stops the background prim count.
+    ~TreeModel() override;
+
     // QStandardItemModel overrides
     QVariant      data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
     Qt::ItemFlags flags(const QModelIndex& index) const override;
+    bool          hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+    bool          canFetchMore(const QModelIndex& parent) const override;
+    void          fetchMore(const QModelIndex& parent) override;
 
     /**
      * \brief Order of the columns as they appear in the Tree.
@@ -87,7 +100,19 @@ public:
 
     void resetVariants();
 
+    //! Counts the descendants of every prim of the stage on a background thread.
+    void startPrimCount(const UsdStageRefPtr& stage);
+
 private:
+    TreeItem* unfetchedLoadItem(const QModelIndex& index) const;
+    void      fetchChildren(TreeItem* item);
+    TreeItem* fetchItem(const SdfPath& path);
+
+    int  descendantCount(const TreeItem* item) const;
+    void unfetchedImportVariants(
+        const TreeItem*                    item,
+        ImportData::PrimVariantSelections& primVariantSelections) const;
+
     void uncheckEnableTree();
     void checkEnableItem(TreeItem* item);
 
@@ -101,16 +126,27 @@ private:
 Q_SIGNALS:
     void checkedStateChanged(int nbChecked) const;
     void modifiedVariantCountChanged(int nbModified) const;
+    void primCountFinished() const;
 
 public Q_SLOTS:
     void updateModifiedVariantCount() const;
 
+private Q_SLOTS:
+    void onPrimCountFinished() const;
+
 private:
     // Extra import data, if any to set the initial state of dialog from.
     const ImportData* fImportData;
 
     // Special interface we can use to perform Maya Qt utilities (such as Pixmap loading).
     const IMayaMQtUtil& fMayaQtUtil;
+
+    // Number of descendants of each prim having children, filled by the background count thread
+    // and only read once fPrimCountReady is set.
+    std::unordered_map<SdfPath, int, SdfPath::Hash> fDescendantCounts;
+    std::atomic<bool>                               fPrimCountReady { false };
+    std::atomic<bool>                               fPrimCountCancelled { false };
+    std::thread                                     fPrimCountThread;
 };
 
 } // namespace MAYAUSD_NS_DEF
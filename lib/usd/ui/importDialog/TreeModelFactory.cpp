@@ -62,9 +62,11 @@ std::unique_ptr<TreeModel> TreeModelFactory::createFromStage(
 )
 {
     std::unique_ptr<TreeModel> treeModel = createEmptyTreeModel(mayaQtUtil, importData, parent);
-    int cnt = buildTreeHierarchy(stage->GetPseudoRoot(), treeModel->invisibleRootItem());
+    // The children of the pseudo-root are fetched by the model when the tree view expands it.
+    treeModel->invisibleRootItem()->appendRow(createPrimRow(stage->GetPseudoRoot()));
+    treeModel->startPrimCount(stage);
     if (nbItems != nullptr)
-        *nbItems = cnt;
+        *nbItems = 1;
     return treeModel;
 }
 
@@ -64,6 +64,8 @@ public:
 
     /**
      * \brief Create a TreeModel from the given USD Stage.
+     * \remarks Only the pseudo-root row is created, the rest of the hierarchy is added as the tree
+     * is expanded. The prims of the stage are counted on a background thread.
      * \param stage A reference to the USD Stage from which to create a TreeModel.
      * \param parent A reference to the parent of the TreeModel.
      * \param nbItems Number of items added to the TreeModel.
@@ -76,10 +78,6 @@ public:
         QObject*              parent = nullptr,
         int*                  nbItems = nullptr);
 
-protected:
-    // Type definition for an STL unordered set of SDF Paths:
-    using unordered_sdfpath_set = std::unordered_set<SdfPath, SdfPath::Hash>;
-
     /**
      * \brief Create the list of data cells used to represent the given USD Prim's data in the tree.
      * \param prim The USD Prim for which to create the list of data cells.
@@ -87,6 +85,10 @@ protected:
      */
     static QList<QStandardItem*> createPrimRow(const UsdPrim& prim);
 
+protected:
+    // Type definition for an STL unordered set of SDF Paths:
+    using unordered_sdfpath_set = std::unordered_set<SdfPath, SdfPath::Hash>;
+
     /**
      * \brief Build the tree hierarchy starting at the given USD Prim.
      * \param prim The USD Prim from which to start building the tree hierarchy.
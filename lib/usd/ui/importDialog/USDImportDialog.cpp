@@ -37,7 +37,7 @@ USDImportDialog::USDImportDialog(
     QWidget*            parent /*= nullptr*/)
     : QDialog { parent }
     , fUI { new Ui::ImportDialog() }
-    , fStage { UsdStage::Open(filename, UsdStage::InitialLoadSet::LoadAll) }
+    , fStage { UsdStage::Open(filename, UsdStage::InitialLoadSet::LoadNone) }
     , fFilename { filename }
     , fRootPrimPath("/")
 {
@@ -55,6 +55,16 @@ USDImportDialog::USDImportDialog(
         matchingImportData = importData;
     }
 
+    // The stage is only browsed, so payloads are left unloaded except for the one holding the
+    // previous root prim, if any.
+    const SdfPath rootPrimPath(fRootPrimPath);
+    SdfPath       ancestorPath = rootPrimPath;
+    UsdPrim       ancestor;
+    while (ancestorPath.IsPrimPath() && !(ancestor = fStage->GetPrimAtPath(ancestorPath)))
+        ancestorPath = ancestorPath.GetParentPath();
+    if (ancestor && ancestorPath != rootPrimPath && !ancestor.IsLoaded())
+        fStage->Load(ancestorPath);
+
     int minW = fUI->nbPrimsInScopeLabel->fontMetrics().width("12345");
     fUI->nbPrimsInScopeLabel->setMinimumWidth(minW);
     fUI->nbVariantsChangedLabel->setMinimumWidth(minW);
@@ -117,6 +127,11 @@ USDImportDialog::USDImportDialog(
 
     // Must be done AFTER we set our item delegate
     fTreeModel->openPersistentEditors(fUI->treeView, QModelIndex());
+    QObject::connect(
+        fTreeModel.get(),
+        SIGNAL(rowsInserted(const QModelIndex&, int, int)),
+        this,
+        SLOT(onTreeRowsInserted(const QModelIndex&, int, int)));
 
     // This request to expand the tree to a default depth of 3 should come after the creation
     // of the editors since it can trigger calls to things like sizeHint before we've put any of
@@ -203,6 +218,17 @@ void USDImportDialog::onItemClicked(const QModelIndex& index)
     }
 }
 
+void USDImportDialog::onTreeRowsInserted(const QModelIndex& parent, int first, int last)
+{
+    // The rows are fetched as the tree is expanded, so their variant editors are opened here.
+    for (int r = first; r <= last; ++r) {
+        QModelIndex varSelIndex = fTreeModel->index(r, TreeModel::kTreeColumn_Variants, parent);
+        int         type = varSelIndex.data(ItemDelegate::kTypeRole).toInt();
+        if (type == ItemDelegate::kVariants)
+            fUI->treeView->openPersistentEditor(fProxyModel->mapFromSource(varSelIndex));
+    }
+}
+
 void USDImportDialog::onResetFileTriggered()
 {
     if (nullptr != fTreeModel) {
@@ -77,6 +77,7 @@ public:
 
 private Q_SLOTS:
     void onItemClicked(const QModelIndex&);
+    void onTreeRowsInserted(const QModelIndex&, int, int);
     void onResetFileTriggered();
     void onHierarchyViewHelpTriggered();
     void onCheckedStateChanged(int);
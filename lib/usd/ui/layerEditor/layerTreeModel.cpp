@@ -28,6 +28,7 @@
 #include <mayaUsd/utils/utilSerialization.h>
 
 #include <pxr/base/tf/notice.h>
+#include <pxr/usd/sdf/schema.h>
 
 #include <maya/MGlobal.h>
 #include <maya/MQtUtil.h>
@@ -354,9 +355,95 @@ void LayerTreeModel::updateTargetLayer(InRebuildModel inRebuild)
 // notification from USD
 void LayerTreeModel::usd_layerChanged(SdfNotice::LayersDidChangeSentPerLayer const& notice)
 {
-    // experienced crashes in python prototype  For now, rebuild everything
-    if (!_blockUsdNotices)
-        rebuildModelOnIdle();
+    if (_blockUsdNotices || _rebuildOnIdlePending)
+        return;
+
+    // Most notices are content edits, which the tree does not display (the dirty state has its own
+    // notice), so only the items of layers whose sublayers or identity changed get refreshed.
+    // The items are updated on idle, as they were when the whole model was rebuilt, since we
+    // experienced crashes when changing the model from within the notice.
+    auto sessionLayer
+        = _sessionState->isValid() ? _sessionState->stage()->GetSessionLayer() : SdfLayerRefPtr();
+    for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+        const SdfLayerHandle& layer = layerAndChanges.first;
+
+        // an auto-hidden session layer must be shown as soon as it is edited
+        if (sessionLayer && get_pointer(layer) == get_pointer(sessionLayer)
+            && _sessionState->autoHideSessionLayer()) {
+            auto firstItem = dynamic_cast<LayerTreeItem*>(invisibleRootItem()->child(0));
+            if (!firstItem || !firstItem->isSessionLayer()) {
+                rebuildModelOnIdle();
+                return;
+            }
+        }
+
+        for (const auto& pathAndEntry : layerAndChanges.second.GetEntryList()) {
+            if (pathAndEntry.first != SdfPath::AbsoluteRootPath()) {
+                continue;
+            }
+            const auto& entry = pathAndEntry.second;
+            bool        sublayersChanged = entry.flags.didReplaceContent
+                || entry.flags.didReloadContent || !entry.subLayerChanges.empty();
+            for (const auto& info : entry.infoChanged) {
+                // the shared and incoming layers are computed from the root layer custom data
+                if (info.first == SdfFieldKeys->CustomLayerData) {
+                    rebuildModelOnIdle();
+                    return;
+                }
+                if (info.first == SdfFieldKeys->SubLayers
+                    || info.first == SdfFieldKeys->SubLayerOffsets) {
+                    sublayersChanged = true;
+                }
+            }
+            if (sublayersChanged) {
+                _pendingLayerRefresh[layer] = true;
+            } else if (entry.flags.didChangeIdentifier || entry.flags.didChangeResolvedPath) {
+                _pendingLayerRefresh.emplace(layer, false);
+            }
+        }
+    }
+
+    if (!_pendingLayerRefresh.empty() && !_refreshOnIdlePending) {
+        _refreshOnIdlePending = true;
+        QTimer::singleShot(0, this, &LayerTreeModel::refreshPendingLayers);
+    }
+}
+
+void LayerTreeModel::refreshPendingLayers()
+{
+    _refreshOnIdlePending = false;
+    std::map<SdfLayerHandle, bool> pending;
+    pending.swap(_pendingLayerRefresh);
+
+    // a full rebuild is already on its way
+    if (_rebuildOnIdlePending || !_sessionState->isValid()) {
+        return;
+    }
+
+    bool childrenRebuilt = false;
+    for (const auto& layerAndRebuild : pending) {
+        if (!layerAndRebuild.first) {
+            continue;
+        }
+        // gather the items again for each layer, since rebuilding children replaces items. The
+        // items of one layer are never nested, as the recursion detector prevents cycles.
+        const SdfLayerRefPtr layer(layerAndRebuild.first);
+        LayerItemVector      layerItems;
+        for (auto item : getAllItems()) {
+            if (item->layer() == layer) {
+                layerItems.push_back(item);
+            }
+        }
+        for (auto item : layerItems) {
+            item->fetchData(layerAndRebuild.second ? RebuildChildren::Yes : RebuildChildren::No);
+            childrenRebuilt |= layerAndRebuild.second;
+        }
+    }
+
+    // new child items still need to know which of them is the edit target
+    if (childrenRebuilt) {
+        updateTargetLayer(InRebuildModel::Yes);
+    }
 }
 
 // notification from USD
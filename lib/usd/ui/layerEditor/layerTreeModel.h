@@ -26,6 +26,7 @@
 
 #include <QtGui/QStandardItemModel>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -132,6 +133,11 @@ protected:
     bool _rebuildOnIdlePending = false;
     void rebuildModel();
 
+    // layers whose items need refreshing, mapped to whether their children need rebuilding
+    std::map<PXR_NS::SdfLayerHandle, bool> _pendingLayerRefresh;
+    bool                                   _refreshOnIdlePending = false;
+    void                                   refreshPendingLayers();
+
     void updateTargetLayer(InRebuildModel inRebuild);
 
     LayerTreeItem* findUSDLayerItem(const PXR_NS::SdfLayerRefPtr& usdLayer) const;
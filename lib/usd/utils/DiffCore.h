@@ -496,5 +496,34 @@ bool compareRGBAArray(
     const size_t       count,
     const float        eps = 1e-5f);
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  the instruction sets the functions above can run with
+/// \note   only AVX2 is selected at runtime, on x86-64 GCC and Clang builds. MSVC and ARM builds
+///         only have the kernels of the instruction set they are compiled for. NEON and AVX-512
+///         versions of the kernels are not written yet.
+//----------------------------------------------------------------------------------------------------------------------
+enum class DiffCoreInstructionSet
+{
+    kBaseline, ///< the instruction set the library is built for
+    kAVX2      ///< AVX2, FMA and F16C, selected at runtime on the CPUs supporting them
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns whether the functions can run with an instruction set on this build and CPU
+/// \param  instructionSet the instruction set to test
+/// \return true if the instruction set can be selected with setDiffCoreInstructionSet
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool isDiffCoreInstructionSetSupported(DiffCoreInstructionSet instructionSet);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  selects the instruction set the functions run with. The best supported one is used by
+///         default, selecting another one is meant for the tests comparing their results.
+/// \param  instructionSet the instruction set to run the functions with
+/// \return false if the instruction set is not supported, the selection is then unchanged
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool setDiffCoreInstructionSet(DiffCoreInstructionSet instructionSet);
+
 //----------------------------------------------------------------------------------------------------------------------
 } // namespace MayaUsdUtils
@@ -15,6 +15,10 @@
 //
 #include "DiffPrims.h"
 
+#include <pxr/base/work/loops.h>
+
+#include <algorithm>
+#include <atomic>
 #include <map>
 
 namespace MayaUsdUtils {
@@ -33,6 +37,50 @@ using UsdRelationship = PXR_NS::UsdRelationship;
         }                                              \
     } while (false)
 
+namespace {
+
+std::atomic<bool> parallelDiff { false };
+
+// The result of comparing an item, with the quick result it returned.
+struct ItemDiff
+{
+    DiffResult result { DiffResult::Same };
+    DiffResult quickResult { DiffResult::Same };
+};
+
+// Compares the items concurrently. When a quick result is requested, the items
+// after the first one that differs are not compared: the caller goes through the
+// results in order, exactly like the serial comparison, and stops at that item.
+template <class COMPARE>
+std::vector<ItemDiff> compareInParallel(size_t count, bool quick, const COMPARE& compare)
+{
+    std::vector<ItemDiff> diffs(count);
+    std::atomic<size_t>   firstDiffer { count };
+
+    PXR_NS::WorkParallelForN(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (quick && i > firstDiffer.load())
+                return;
+
+            ItemDiff& diff = diffs[i];
+            diff.result = compare(i, quick ? &diff.quickResult : nullptr);
+
+            if (quick && diff.quickResult != DiffResult::Same) {
+                size_t current = firstDiffer.load();
+                while (i < current && !firstDiffer.compare_exchange_weak(current, i)) { }
+            }
+        }
+    });
+
+    return diffs;
+}
+
+} // namespace
+
+bool setParallelDiff(bool parallel) { return parallelDiff.exchange(parallel); }
+
+bool isParallelDiff() { return parallelDiff.load(); }
+
 DiffResultPerToken
 comparePrimsAttributes(const UsdPrim& modified, const UsdPrim& baseline, DiffResult* quickDiff)
 {
@@ -52,7 +100,28 @@ comparePrimsAttributes(const UsdPrim& modified, const UsdPrim& baseline, DiffRes
 
     // Compare the attributes from the modified prim.
     // Baseline attributes map won't change from now on, so cache the end.
-    {
+    if (isParallelDiff()) {
+        const std::vector<UsdAttribute> attrs = modified.GetAuthoredAttributes();
+        const auto                      baselineEnd = baselineAttrs.end();
+        const std::vector<ItemDiff>     diffs = compareInParallel(
+            attrs.size(), quickDiff != nullptr, [&](size_t i, DiffResult* itemQuickDiff) {
+                const auto iter = baselineAttrs.find(attrs[i].GetName());
+                if (iter == baselineEnd) {
+                    if (itemQuickDiff)
+                        *itemQuickDiff = DiffResult::Created;
+                    return DiffResult::Created;
+                }
+                const DiffResult result = compareAttributes(attrs[i], iter->second, itemQuickDiff);
+                if (itemQuickDiff)
+                    *itemQuickDiff = result;
+                return result;
+            });
+
+        for (size_t i = 0; i < attrs.size(); ++i) {
+            USD_MAYA_RETURN_QUICK_RESULT(diffs[i].result, results);
+            results[attrs[i].GetName()] = diffs[i].result;
+        }
+    } else {
         const auto baselineEnd = baselineAttrs.end();
         for (const UsdAttribute& attr : modified.GetAuthoredAttributes()) {
             const TfToken& name = attr.GetName();
@@ -145,7 +214,37 @@ comparePrimsChildren(const UsdPrim& modified, const UsdPrim& baseline, DiffResul
 
     // Compare the children from the modified prim.
     // Baseline children map won't change from now on, so cache the end.
-    {
+    if (isParallelDiff()) {
+        std::vector<UsdPrim> children;
+        for (const UsdPrim& child : modified.GetAllChildren()) {
+            children.push_back(child);
+        }
+
+        const auto                  baselineEnd = baselineChildren.end();
+        const std::vector<ItemDiff> diffs = compareInParallel(
+            children.size(), quickDiff != nullptr, [&](size_t i, DiffResult* itemQuickDiff) {
+                const auto iter = baselineChildren.find(children[i].GetPath());
+                if (iter == baselineEnd) {
+                    if (itemQuickDiff)
+                        *itemQuickDiff = DiffResult::Created;
+                    return DiffResult::Created;
+                }
+                return comparePrims(children[i], iter->second, itemQuickDiff);
+            });
+
+        for (size_t i = 0; i < children.size(); ++i) {
+            const SdfPath& path = children[i].GetPath();
+            if (baselineChildren.find(path) == baselineEnd) {
+                USD_MAYA_RETURN_QUICK_RESULT(DiffResult::Created, results);
+                results[path] = DiffResult::Created;
+            } else {
+                if (quickDiff)
+                    *quickDiff = diffs[i].quickResult;
+                results[path] = diffs[i].result;
+                USD_MAYA_RETURN_QUICK_RESULT(*quickDiff, results);
+            }
+        }
+    } else {
         const auto baselineEnd = baselineChildren.end();
         for (const UsdPrim& child : modified.GetAllChildren()) {
             const SdfPath& path = child.GetPath();
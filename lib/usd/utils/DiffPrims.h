@@ -80,6 +80,22 @@ using DiffResultPerPathPerToken = std::map<PXR_NS::TfToken, DiffResultPerPath>;
 //----------------------------------------------------------------------------------------------------------------------
 template <class MAP> MAYA_USD_UTILS_PUBLIC DiffResult computeOverallResult(const MAP& subResults);
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  sets if the comparisons run in parallel: the children and attributes of prims are
+///         compared concurrently and very large arrays are compared in chunks on multiple
+///         threads. The results are the same as when comparing serially.
+/// \param  parallel true to compare in parallel.
+/// \return the previous parallel mode.
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool setParallelDiff(bool parallel);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  verifies if the comparisons run in parallel.
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+bool isParallelDiff();
+
 //----------------------------------------------------------------------------------------------------------------------
 // Comparison of prims.
 //----------------------------------------------------------------------------------------------------------------------
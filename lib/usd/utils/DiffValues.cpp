@@ -31,8 +31,12 @@
 #include <pxr/base/tf/type.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/valueTypeName.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace MayaUsdUtils {
 
 using VtValue = PXR_NS::VtValue;
@@ -52,6 +56,30 @@ using DiffFunc = std::function<DiffResult(const VtValue& modified, const VtValue
 using DiffKey = std::pair<std::type_index, std::type_index>;
 using DiffFuncMap = std::map<DiffKey, DiffFunc>;
 
+//----------------------------------------------------------------------------------------------------------------------
+// In parallel mode, arrays with more scalars than this are compared in chunks of this size on
+// multiple threads.
+constexpr size_t kParallelArrayChunkSize = 64 * 1024;
+
+template <class T1, class T2>
+bool compareArrayInChunks(const T1* input0, const T2* input1, size_t count0, size_t count1)
+{
+    if (count0 != count1 || count0 <= kParallelArrayChunkSize || !isParallelDiff())
+        return compareArray(input0, input1, count0, count1);
+
+    const size_t      chunkCount = (count0 + kParallelArrayChunkSize - 1) / kParallelArrayChunkSize;
+    std::atomic<bool> same { true };
+    PXR_NS::WorkParallelForN(chunkCount, [&](size_t begin, size_t end) {
+        for (size_t chunk = begin; chunk < end && same.load(); ++chunk) {
+            const size_t first = chunk * kParallelArrayChunkSize;
+            const size_t count = std::min(kParallelArrayChunkSize, count0 - first);
+            if (!compareArray(input0 + first, input1 + first, count, count))
+                same = false;
+        }
+    });
+    return same.load();
+}
+
 template <class T1, class T2>
 DiffResult diffTwoTypesWithEps(const VtValue& modified, const VtValue& baseline)
 {
@@ -65,7 +93,8 @@ DiffResult diffTwoArrayTypesWithEps(const VtValue& modified, const VtValue& base
 {
     const VtArray<T1>& v1 = modified.Get<VtArray<T1>>();
     const VtArray<T2>& v2 = baseline.Get<VtArray<T2>>();
-    return compareArray(v1.cdata(), v2.cdata(), modified.GetArraySize(), baseline.GetArraySize())
+    return compareArrayInChunks(
+               v1.cdata(), v2.cdata(), modified.GetArraySize(), baseline.GetArraySize())
         ? DiffResult::Same
         : DiffResult::Differ;
 }
@@ -96,7 +125,7 @@ DiffResult diffTwoVecArrays(const VtValue& modified, const VtValue& baseline)
     const VtArray<V2>& v2 = baseline.Get<VtArray<V2>>();
     using V1ValueType = typename V1::ScalarType;
     using V2ValueType = typename V2::ScalarType;
-    return compareArray(
+    return compareArrayInChunks(
                reinterpret_cast<const V1ValueType*>(v1.cdata()),
                reinterpret_cast<const V2ValueType*>(v2.cdata()),
                modified.GetArraySize() * SIZE,
@@ -128,7 +157,7 @@ DiffResult diffTwoQuatArrays(const VtValue& modified, const VtValue& baseline)
     const VtArray<V2>& v2 = baseline.Get<VtArray<V2>>();
     using V1ValueType = typename V1::ScalarType;
     using V2ValueType = typename V2::ScalarType;
-    return compareArray(
+    return compareArrayInChunks(
                reinterpret_cast<const V1ValueType*>(v1.cdata()),
                reinterpret_cast<const V2ValueType*>(v2.cdata()),
                modified.GetArraySize() * SIZE,
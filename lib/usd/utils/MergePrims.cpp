@@ -19,9 +19,12 @@
 
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <algorithm>
 #include <utility>
 
@@ -44,6 +47,7 @@ struct MergeContext
     const SdfPath&           srcRootPath;
     const UsdStageRefPtr&    dstStage;
     const SdfPath&           dstRootPath;
+    MergePrimsHashes*        hashes;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -450,6 +454,25 @@ bool isDataAtPathsModified(
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// Hashes the default value or the time samples at a location, each time sample separately.
+size_t hashValueField(const MergeLocation& loc)
+{
+    if (!loc.fieldExists)
+        return 0;
+
+    const VtValue value = loc.layer->GetField(loc.path, loc.field);
+    if (!value.IsHolding<SdfTimeSampleMap>())
+        return value.GetHash();
+
+    size_t hash = 0;
+    for (const auto& sample : value.UncheckedGet<SdfTimeSampleMap>()) {
+        boost::hash_combine(hash, sample.first);
+        boost::hash_combine(hash, sample.second.GetHash());
+    }
+    return hash;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Decides if we should merge a value.
 bool shouldMergeValue(
@@ -484,7 +507,24 @@ bool shouldMergeValue(
     }
 
     const MergeLocation dst = { dstLayer, dstPath, field, fieldInDst };
-    return isDataAtPathsModified(ctx, src, dst);
+
+    // Reuse the decision of a previous merge when the values did not change since.
+    const bool isValueField
+        = (field == SdfFieldKeys->Default || field == SdfFieldKeys->TimeSamples);
+    if (!ctx.hashes || !isValueField)
+        return isDataAtPathsModified(ctx, src, dst);
+
+    const size_t srcHash = hashValueField(src);
+    const size_t dstHash = hashValueField(dst);
+
+    MergePrimsHashes::FieldHashes& hashes = ctx.hashes->fields[{ srcPath, field }];
+    if (hashes.srcHash == srcHash && hashes.dstHash == dstHash && (srcHash || dstHash))
+        return hashes.modified;
+
+    hashes.srcHash = srcHash;
+    hashes.dstHash = dstHash;
+    hashes.modified = isDataAtPathsModified(ctx, src, dst);
+    return hashes.modified;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -922,9 +962,10 @@ bool mergeDiffPrims(
     const SdfPath&           srcPath,
     const UsdStageRefPtr&    dstStage,
     const SdfLayerRefPtr&    dstLayer,
-    const SdfPath&           dstPath)
+    const SdfPath&           dstPath,
+    MergePrimsHashes*        hashes)
 {
-    const MergeContext ctx = { options, srcStage, srcPath, dstStage, dstPath };
+    const MergeContext ctx = { options, srcStage, srcPath, dstStage, dstPath, hashes };
 
     auto copyValue = makeFuncWithContext(ctx, shouldMergeValue);
     auto copyChildren = makeFuncWithContext(ctx, shouldMergeChildren);
@@ -955,10 +996,22 @@ bool mergePrims(
     const UsdStageRefPtr&    dstStage,
     const SdfLayerRefPtr&    dstLayer,
     const SdfPath&           dstPath,
-    const MergePrimsOptions& options)
+    const MergePrimsOptions& options,
+    MergePrimsHashes*        hashes)
 {
     createMissingParents(dstLayer, dstPath);
 
+    // Restore the parallel mode of the comparisons when done.
+    struct ParallelDiffScope
+    {
+        ParallelDiffScope(bool parallel)
+            : _previous(setParallelDiff(parallel || isParallelDiff()))
+        {
+        }
+        ~ParallelDiffScope() { setParallelDiff(_previous); }
+        const bool _previous;
+    } parallelDiffScope(options.parallelDiff);
+
     if (options.ignoreUpperLayerOpinions) {
         auto           tempStage = UsdStage::CreateInMemory();
         SdfLayerHandle tempLayer = tempStage->GetSessionLayer();
@@ -966,14 +1019,16 @@ bool mergePrims(
         tempLayer->TransferContent(dstLayer);
 
         const bool success
-            = mergeDiffPrims(options, srcStage, srcLayer, srcPath, tempStage, tempLayer, dstPath);
+            = mergeDiffPrims(
+                options, srcStage, srcLayer, srcPath, tempStage, tempLayer, dstPath, hashes);
 
         if (success)
             dstLayer->TransferContent(tempLayer);
 
         return success;
     } else {
-        return mergeDiffPrims(options, srcStage, srcLayer, srcPath, dstStage, dstLayer, dstPath);
+        return mergeDiffPrims(
+            options, srcStage, srcLayer, srcPath, dstStage, dstLayer, dstPath, hashes);
     }
 }
 
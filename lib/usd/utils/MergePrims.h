@@ -18,12 +18,40 @@
 #include <mayaUsdUtils/Api.h>
 #include <mayaUsdUtils/MergePrimsOptions.h>
 
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/common.h>
 
+#include <map>
+#include <utility>
+
 namespace MayaUsdUtils {
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  hashes of the attribute values examined by previous merges.
+///
+/// When given to mergePrims(), the default values and time samples whose source and destination
+/// hashes did not change since a previous merge are not compared again: the previous decision
+/// to copy them or not is reused. The hashes are only valid for repeated merges between the
+/// same stages and layers with the same options, so clear them otherwise.
+//----------------------------------------------------------------------------------------------------------------------
+struct MergePrimsHashes
+{
+    struct FieldHashes
+    {
+        size_t srcHash { 0 };
+        size_t dstHash { 0 };
+        bool   modified { false };
+    };
+
+    using FieldKey = std::pair<PXR_NS::SdfPath, PXR_NS::TfToken>;
+
+    std::map<FieldKey, FieldHashes> fields;
+
+    void clear() { fields.clear(); }
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  merges prims starting at a source path from a source layer and stage to a destination.
 /// \param  srcStage the stage containing the modified prims.
@@ -33,6 +61,8 @@ namespace MayaUsdUtils {
 /// \param  dstLayer the layer containing the baseline prims that receive the modifications.
 /// \param  dstPath the path to the baseline prims that receive the modifications.
 /// \param  options merging options.
+/// \param  hashes if not null, the hashes of the values examined by the previous merges, updated
+///         by this merge.
 /// \return true if the merge was successful.
 //----------------------------------------------------------------------------------------------------------------------
 MAYA_USD_UTILS_PUBLIC
@@ -43,6 +73,7 @@ bool mergePrims(
     const PXR_NS::UsdStageRefPtr& dstStage,
     const PXR_NS::SdfLayerRefPtr& dstLayer,
     const PXR_NS::SdfPath&        dstPath,
-    const MergePrimsOptions&      options);
+    const MergePrimsOptions&      options,
+    MergePrimsHashes*             hashes = nullptr);
 
 } // namespace MayaUsdUtils
@@ -121,6 +121,7 @@ const VtDictionary& MergePrimsOptions::getDefaultDictionary()
 
         d[UsdMayaMergeOptionsTokens->mergeChildren] = false;
         d[UsdMayaMergeOptionsTokens->ignoreUpperLayerOpinions] = false;
+        d[UsdMayaMergeOptionsTokens->parallelDiff] = false;
 
         static const TfToken handlingTokens[] = { UsdMayaMergeOptionsTokens->propertiesHandling,
                                                   UsdMayaMergeOptionsTokens->primsHandling,
@@ -154,6 +155,8 @@ MergePrimsOptions::MergePrimsOptions(const VtDictionary& options)
     ignoreUpperLayerOpinions
         = parseBoolean(optionsWithDef, UsdMayaMergeOptionsTokens->ignoreUpperLayerOpinions);
 
+    parallelDiff = parseBoolean(optionsWithDef, UsdMayaMergeOptionsTokens->parallelDiff);
+
     const struct
     {
         TfToken       handlingToken;
@@ -107,6 +107,9 @@ struct MergePrimsOptions
     // from upper layers (and children of upper layers).
     bool ignoreUpperLayerOpinions { false };
 
+    // If true, the prims, attributes and large arrays are compared in parallel.
+    bool parallelDiff { false };
+
     // How missing attributes are handled.
     MergeMissing propertiesHandling { MergeMissing::All };
 
@@ -172,6 +175,7 @@ struct MergePrimsOptions
                                         \
     (mergeChildren)                     \
     (ignoreUpperLayerOpinions)          \
+    (parallelDiff)                      \
                                         \
     (propertiesHandling)                \
     (primsHandling)                     \
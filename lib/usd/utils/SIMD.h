@@ -61,6 +61,13 @@
 
 namespace MayaUsdUtils {
 
+// Translation units compiled for another instruction set than the rest of the
+// library define MAYAUSD_UTILS_SIMD_NAMESPACE, so that the linker does not merge
+// their helpers with the ones of the other translation units.
+#ifdef MAYAUSD_UTILS_SIMD_NAMESPACE
+inline namespace MAYAUSD_UTILS_SIMD_NAMESPACE {
+#endif
+
 #if defined(__SSE__)
 typedef __m128  f128;
 typedef __m128i i128;
@@ -557,4 +564,8 @@ inline f128 loadmask3f(const void* const ptr, size_t count)
 }
 #endif
 
+#ifdef MAYAUSD_UTILS_SIMD_NAMESPACE
+} // namespace MAYAUSD_UTILS_SIMD_NAMESPACE
+#endif
+
 } // namespace MayaUsdUtils
@@ -15,18 +15,51 @@
 //
 #include "adskStageLoadUnloadCommands.h"
 
+#include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/utils/query.h>
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <maya/M3dView.h>
 #include <maya/MArgParser.h>
+#include <maya/MDagPath.h>
+#include <maya/MGlobal.h>
+#include <maya/MPoint.h>
+#include <maya/MSelectionList.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 #include <maya/MStringArray.h>
 #include <maya/MSyntax.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace MAYAUSD_NS_DEF {
 
 const MString ADSKMayaUsdStageLoadAllCommand::commandName("mayaUsdStageLoadAll");
 const MString ADSKMayaUsdStageUnloadAllCommand::commandName("mayaUsdStageUnloadAll");
+const MString ADSKMayaUsdStageLoadNearestCommand::commandName("mayaUsdStageLoadNearest");
+
+namespace {
+
+const char kCameraFlag[] = "c";
+const char kCameraFlagLong[] = "camera";
+const char kMaxPayloadsFlag[] = "mp";
+const char kMaxPayloadsFlagLong[] = "maxPayloads";
+
+const unsigned int kDefaultMaxPayloads = 100;
+
+bool getDagPath(const MString& name, MDagPath& dagPath)
+{
+    MSelectionList selection;
+    return selection.add(name) && selection.getDagPath(0, dagPath);
+}
+
+} // namespace
 
 //-----------------------------------------------------------------------------
 // ADSKMayaUsdStageLoadUnloadBase
@@ -110,4 +143,120 @@ MStatus ADSKMayaUsdStageUnloadAllCommand::undoIt()
     return MS::kSuccess;
 }
 
+//-----------------------------------------------------------------------------
+// ADSKMayaUsdStageLoadNearestCommand
+//-----------------------------------------------------------------------------
+
+/*static*/
+void* ADSKMayaUsdStageLoadNearestCommand::creator()
+{
+    return new ADSKMayaUsdStageLoadNearestCommand();
+}
+
+/*static*/
+MSyntax ADSKMayaUsdStageLoadNearestCommand::createSyntax()
+{
+    MSyntax syntax = ADSKMayaUsdStageLoadUnloadBase::createSyntax();
+    syntax.addFlag(kCameraFlag, kCameraFlagLong, MSyntax::kString);
+    syntax.addFlag(kMaxPayloadsFlag, kMaxPayloadsFlagLong, MSyntax::kUnsigned);
+    return syntax;
+}
+
+MStatus ADSKMayaUsdStageLoadNearestCommand::doIt(const MArgList& args)
+{
+    MStatus    st;
+    MArgParser argData(syntax(), args, &st);
+    if (!st)
+        return st;
+
+    MStringArray proxyArray;
+    st = argData.getObjects(proxyArray);
+    if (!st || proxyArray.length() != 1)
+        return MS::kInvalidParameter;
+
+    MDagPath proxyPath;
+    if (!getDagPath(proxyArray[0], proxyPath))
+        return MS::kInvalidParameter;
+
+    PXR_NS::MayaUsdProxyShapeBase* proxyShape
+        = PXR_NS::MayaUsdProxyShapeBase::GetShapeAtDagPath(proxyPath);
+    if (!proxyShape)
+        return MS::kInvalidParameter;
+
+    PXR_NS::UsdStageRefPtr stage = proxyShape->getUsdStage();
+    if (!stage)
+        return MS::kInvalidParameter;
+
+    // Without a camera, the payloads nearest to the camera of the active view are loaded.
+    MDagPath cameraPath;
+    if (argData.isFlagSet(kCameraFlag)) {
+        MString cameraName;
+        argData.getFlagArgument(kCameraFlag, 0, cameraName);
+        if (!getDagPath(cameraName, cameraPath)) {
+            MGlobal::displayError(MString("Invalid camera: ") + cameraName);
+            return MS::kInvalidParameter;
+        }
+    } else {
+        st = M3dView::active3dView().getCamera(cameraPath);
+        if (!st)
+            return st;
+    }
+
+    unsigned int maxPayloads = kDefaultMaxPayloads;
+    if (argData.isFlagSet(kMaxPayloadsFlag)) {
+        argData.getFlagArgument(kMaxPayloadsFlag, 0, maxPayloads);
+    }
+
+    const MPoint              cameraPoint = MPoint::origin * cameraPath.inclusiveMatrix();
+    const PXR_NS::GfVec3d     cameraPosition(cameraPoint.x, cameraPoint.y, cameraPoint.z);
+    const PXR_NS::GfMatrix4d  stageToWorld(proxyPath.inclusiveMatrix().matrix);
+    PXR_NS::UsdGeomXformCache xformCache(proxyShape->getTime());
+    PXR_NS::UsdPrimRange      range(stage->GetPseudoRoot(), PXR_NS::UsdPrimAllPrimsPredicate);
+
+    std::vector<std::pair<double, PXR_NS::SdfPath>> payloads;
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        if (!it->HasAuthoredPayloads())
+            continue;
+
+        // Nested payloads are loaded and unloaded with their ancestor.
+        it.PruneChildren();
+
+        const PXR_NS::GfVec3d position
+            = (xformCache.GetLocalToWorldTransform(*it) * stageToWorld).ExtractTranslation();
+        payloads.emplace_back((position - cameraPosition).GetLengthSq(), it->GetPath());
+    }
+
+    std::sort(payloads.begin(), payloads.end());
+
+    _loadSet.clear();
+    _unloadSet.clear();
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        if (i < maxPayloads) {
+            _loadSet.insert(payloads[i].second);
+        } else {
+            _unloadSet.insert(payloads[i].second);
+        }
+    }
+
+    _stage = stage;
+    _oldLoadSet = _stage->GetLoadSet();
+    return redoIt();
+}
+
+MStatus ADSKMayaUsdStageLoadNearestCommand::redoIt()
+{
+    if (!_stage)
+        return MS::kFailure;
+    _stage->LoadAndUnload(_loadSet, _unloadSet);
+    return MS::kSuccess;
+}
+
+MStatus ADSKMayaUsdStageLoadNearestCommand::undoIt()
+{
+    if (!_stage)
+        return MS::kFailure;
+    _stage->LoadAndUnload(_oldLoadSet, PXR_NS::SdfPathSet({ PXR_NS::SdfPath::AbsoluteRootPath() }));
+    return MS::kSuccess;
+}
+
 } // namespace MAYAUSD_NS_DEF
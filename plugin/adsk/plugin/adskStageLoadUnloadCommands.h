@@ -64,6 +64,27 @@ public:
     MStatus undoIt() override;
 };
 
+/// Loads the payloads of the stage nearest to a camera and unloads the
+/// others. Running it again as the camera moves streams the payloads in and
+/// out, and the load rules are saved with the proxy shape like any others.
+class MAYAUSD_PLUGIN_PUBLIC ADSKMayaUsdStageLoadNearestCommand
+    : public ADSKMayaUsdStageLoadUnloadBase
+{
+public:
+    static const MString commandName;
+
+    static void*   creator();
+    static MSyntax createSyntax();
+
+    MStatus doIt(const MArgList& args) override;
+    MStatus redoIt() override;
+    MStatus undoIt() override;
+
+private:
+    PXR_NS::SdfPathSet _loadSet;
+    PXR_NS::SdfPathSet _unloadSet;
+};
+
 } // namespace MAYAUSD_NS_DEF
 
 #endif
@@ -28,6 +28,10 @@
 #include <mayaUsd/commands/editTargetCommand.h>
 #include <mayaUsd/commands/layerEditorCommand.h>
 #include <mayaUsd/commands/layerEditorWindowCommand.h>
+#include <mayaUsd/commands/memoryReportCommand.h>
+#include <mayaUsd/commands/renderStatsCommand.h>
+#include <mayaUsd/commands/traceCommand.h>
+#include <mayaUsd/fileio/jobs/exportDirtyTracker.h>
 #include <mayaUsd/fileio/shaderReaderRegistry.h>
 #include <mayaUsd/fileio/shaderWriterRegistry.h>
 #include <mayaUsd/listeners/notice.h>
@@ -75,6 +79,7 @@
 #ifdef UFE_V3_FEATURES_AVAILABLE
 #include <mayaUsd/commands/PullPushCommands.h>
 #include <mayaUsd/fileio/primUpdaterManager.h>
+#include <mayaUsd/fileio/pullDirtyTracker.h>
 #endif
 
 #if defined(WANT_QT_BUILD)
@@ -216,10 +221,14 @@ MStatus initializePlugin(MObject obj)
 
     registerCommandCheck<MayaUsd::ADSKMayaUsdStageLoadAllCommand>(plugin);
     registerCommandCheck<MayaUsd::ADSKMayaUsdStageUnloadAllCommand>(plugin);
+    registerCommandCheck<MayaUsd::ADSKMayaUsdStageLoadNearestCommand>(plugin);
     registerCommandCheck<MayaUsd::ADSKMayaUSDExportCommand>(plugin);
     registerCommandCheck<MayaUsd::ADSKMayaUSDImportCommand>(plugin);
     registerCommandCheck<MayaUsd::EditTargetCommand>(plugin);
     registerCommandCheck<MayaUsd::LayerEditorCommand>(plugin);
+    registerCommandCheck<MayaUsd::RenderStatsCommand>(plugin);
+    registerCommandCheck<MayaUsd::MemoryReportCommand>(plugin);
+    registerCommandCheck<MayaUsd::TraceCommand>(plugin);
 #if defined(WANT_QT_BUILD)
     registerCommandCheck<MayaUsd::LayerEditorWindowCommand>(plugin);
 #endif
@@ -394,12 +403,20 @@ MStatus uninitializePlugin(MObject obj)
     if (!status) {
         status.perror("mayaUsdPlugin: unable to deregister export translator.");
     }
+    UsdMaya_ExportDirtyTracker::ForgetAll();
+#ifdef UFE_V3_FEATURES_AVAILABLE
+    UsdMaya_PullDirtyTracker::ForgetAll();
+#endif
     deregisterCommandCheck<MayaUsd::ADSKMayaUsdStageLoadAllCommand>(plugin);
     deregisterCommandCheck<MayaUsd::ADSKMayaUsdStageUnloadAllCommand>(plugin);
+    deregisterCommandCheck<MayaUsd::ADSKMayaUsdStageLoadNearestCommand>(plugin);
     deregisterCommandCheck<MayaUsd::ADSKMayaUSDExportCommand>(plugin);
     deregisterCommandCheck<MayaUsd::ADSKMayaUSDImportCommand>(plugin);
     deregisterCommandCheck<MayaUsd::EditTargetCommand>(plugin);
     deregisterCommandCheck<MayaUsd::LayerEditorCommand>(plugin);
+    deregisterCommandCheck<MayaUsd::RenderStatsCommand>(plugin);
+    deregisterCommandCheck<MayaUsd::MemoryReportCommand>(plugin);
+    deregisterCommandCheck<MayaUsd::TraceCommand>(plugin);
 #if defined(WANT_QT_BUILD)
     deregisterCommandCheck<MayaUsd::LayerEditorWindowCommand>(plugin);
     MayaUsd::LayerEditorWindowCommand::cleanupOnPluginUnload();
@@ -211,6 +211,10 @@ template <typename AFnPlugin> MStatus registerPlugin(AFnPlugin& plugin)
         MGlobal::setOptionVarValue("AL_usdmaya_pushToPrim", true);
     }
 
+    if (!MGlobal::optionVarExists("AL_usdmaya_batchChangedObjects")) {
+        MGlobal::setOptionVarValue("AL_usdmaya_batchChangedObjects", false);
+    }
+
     MStatus status;
 
     // gpuCachePluginMain used as an example.
@@ -22,6 +22,8 @@
 #include "AL/usdmaya/nodes/ProxyShape.h"
 #include "AL/usdmaya/nodes/Transform.h"
 
+#include <pxr/base/work/loops.h>
+
 #include <maya/MFnDagNode.h>
 
 namespace AL {
@@ -220,10 +222,28 @@ void ProxyShapePostLoadProcess::createSchemaPrims(
                      " will read default values\n");
         }
 
-        auto       it = objsToCreate.begin();
-        const auto end = objsToCreate.end();
-        for (; it != end; ++it) {
-            UsdPrim prim = *it;
+        // Let the translators read the USD data they need in parallel, before the Maya nodes
+        // are created serially.
+        std::vector<fileio::translators::TranslatorRefPtr> translators;
+        translators.reserve(objsToCreate.size());
+        std::vector<size_t> preImportIndices;
+        for (size_t i = 0, n = objsToCreate.size(); i < n; ++i) {
+            translators.push_back(translatorManufacture.get(objsToCreate[i]));
+            if (translators.back() && translators.back()->supportsPreImport()) {
+                preImportIndices.push_back(i);
+            }
+        }
+        WorkParallelForN(
+            preImportIndices.size(),
+            [&objsToCreate, &translators, &preImportIndices](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const size_t index = preImportIndices[i];
+                    translators[index]->preImport(objsToCreate[index]);
+                }
+            });
+
+        for (size_t i = 0, n = objsToCreate.size(); i < n; ++i) {
+            UsdPrim prim = objsToCreate[i];
             bool    parentUnmerged = parentNodeIsUnmerged(prim);
             MObject object;
             if (parentUnmerged) {
@@ -232,7 +252,7 @@ void ProxyShapePostLoadProcess::createSchemaPrims(
                 object = proxy->findRequiredPath(prim.GetPath());
             }
 
-            fileio::translators::TranslatorRefPtr translator = translatorManufacture.get(prim);
+            const fileio::translators::TranslatorRefPtr& translator = translators[i];
 
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
@@ -20,10 +20,14 @@
 #include "AL/usdmaya/fileio/translators/TransformTranslator.h"
 #include "AL/usdmaya/utils/MeshUtils.h"
 
+#include <mayaUsdUtils/DiffCore.h>
+
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMesh.h>
+#include <maya/MGlobal.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
@@ -33,6 +37,69 @@ namespace AL {
 namespace usdmaya {
 namespace fileio {
 
+namespace {
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Writes the animated points of a mesh, skipping frames that match the last written
+///         sample. When a run of matching frames ends, the run is closed with one more sample so
+///         that the interpolation between samples is unchanged.
+//----------------------------------------------------------------------------------------------------------------------
+struct AnimatedMeshPoints
+{
+    void sample(const MDagPath& path, const UsdAttribute& pointsAttr, double time)
+    {
+        MFnMesh      fnMesh(path);
+        MStatus      status;
+        const float* pointsData = fnMesh.getRawPoints(&status);
+        if (!status) {
+            MGlobal::displayError(
+                MString("Unable to access mesh vertices on mesh: ") + fnMesh.fullPathName());
+            return;
+        }
+
+        const uint32_t numVertices = fnMesh.numVertices();
+        if (m_numSamples
+            && MayaUsdUtils::compareArray(
+                reinterpret_cast<const float*>(m_points.cdata()),
+                pointsData,
+                m_points.size() * 3,
+                numVertices * 3)) {
+            m_heldTime = time;
+            m_held = true;
+            return;
+        }
+
+        if (m_held) {
+            pointsAttr.Set(m_points, UsdTimeCode(m_heldTime));
+            ++m_numSamples;
+            m_held = false;
+        }
+
+        const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(pointsData);
+        m_points.assign(vecData, vecData + numVertices);
+        pointsAttr.Set(m_points, UsdTimeCode(time));
+        if (!m_numSamples++) {
+            m_firstTime = time;
+        }
+    }
+
+    /// \brief  if the points never changed, replace the single time sample with a default value.
+    void finish(const UsdAttribute& pointsAttr)
+    {
+        if (m_numSamples == 1) {
+            pointsAttr.ClearAtTime(UsdTimeCode(m_firstTime));
+            pointsAttr.Set(m_points);
+        }
+    }
+
+private:
+    VtArray<GfVec3f> m_points;
+    double           m_firstTime = 0;
+    double           m_heldTime = 0;
+    size_t           m_numSamples = 0;
+    bool             m_held = false;
+};
+} // namespace
+
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
 {
@@ -52,6 +119,7 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
     if ((startAttrib != endAttrib) || (startAttribScaled != endAttribScaled)
         || (startTransformAttrib != endTransformAttrib) || (startMultiAttrib != endMultiAttrib)
         || (startMesh != endMesh) || (startWSM != endWSM) || (!m_animatedNodes.empty())) {
+        std::vector<AnimatedMeshPoints> meshPoints(m_animatedMeshes.size());
         double increment = 1.0 / std::max(1U, params.m_subSamples);
         for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
             MAnimControl::setCurrentTime(t);
@@ -107,10 +175,9 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
                     }
                 }
             }
-            for (auto it = startMesh; it != endMesh; ++it) {
-                UsdGeomMesh                           mesh(it->second.GetPrim());
-                AL::usdmaya::utils::MeshExportContext context(it->first, mesh, timeCode);
-                context.copyVertexData(timeCode);
+            auto meshPointsIt = meshPoints.begin();
+            for (auto it = startMesh; it != endMesh; ++it, ++meshPointsIt) {
+                meshPointsIt->sample(it->first, it->second, t);
             }
             for (auto nodeAnim : m_animatedNodes) {
                 nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
@@ -127,6 +194,11 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
 #endif
             }
         }
+
+        auto meshPointsIt = meshPoints.begin();
+        for (auto it = startMesh; it != endMesh; ++it, ++meshPointsIt) {
+            meshPointsIt->finish(it->second);
+        }
     }
 }
 
@@ -125,6 +125,20 @@ public:
     /// \return MS::kSuccess if all ok
     virtual MStatus initialize() { return MS::kSuccess; }
 
+    /// \brief  override this method and return true if the translator implements preImport()
+    /// \return true if your plugin supports preImport, false otherwise.
+    virtual bool supportsPreImport() const { return false; }
+
+    /// \brief  Override this method to read from USD the data needed to import a prim, before any
+    ///         Maya node is created. It is called on worker threads, in parallel for all the prims
+    ///         to import, before the serial calls to import(). It must be thread-safe, and must
+    ///         not call the Maya API, which is not allowed on the worker threads. The gathered
+    ///         data should be kept by the translator, keyed by prim path, until import()
+    ///         consumes it. Only called if supportsPreImport() returns true.
+    /// \param  prim the usd prim that will be imported into maya
+    /// \return MS::kSuccess if all ok
+    virtual MStatus preImport(const UsdPrim& prim) { return MS::kSuccess; }
+
     /// \brief  Override this method to import a prim into your scene.
     /// \param  prim the usd prim to be imported into maya
     /// \param  parent a handle to an MObject that represents an AL_usd_Transform node. You should
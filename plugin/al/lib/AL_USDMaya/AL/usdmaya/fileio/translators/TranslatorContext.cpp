@@ -22,7 +22,9 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionList.h>
 
+#include <algorithm>
 #include <string>
+#include <unordered_set>
 
 namespace {
 const int _translatorContextProfilerCategory = MProfiler::addCategory(
@@ -75,7 +77,7 @@ void TranslatorContext::validatePrims()
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Validate prims");
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::validatePrims ** VALIDATE PRIMS **\n");
-    for (auto it : m_primMapping) {
+    for (const auto& it : m_primMapping) {
         if (it.objectHandle().isValid() && it.objectHandle().isAlive()) {
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
@@ -456,7 +458,7 @@ MString TranslatorContext::serialise() const
     oss.str("");
     oss.clear();
 
-    for (auto it : m_primMapping) {
+    for (const auto& it : m_primMapping) {
         oss << it.path() << "=" << it.translatorId() << ",";
         oss << getNodeName(it.object());
         for (uint32_t i = 0; i < it.createdNodes().size(); ++i) {
@@ -480,6 +482,9 @@ void TranslatorContext::deserialise(const MString& string)
     MStringArray strings;
     string.split(';', strings);
 
+    const std::size_t numExisting = m_primMapping.size();
+    m_primMapping.reserve(numExisting + strings.length());
+
     for (uint32_t i = 0; i < strings.length(); ++i) {
         MStringArray strings2;
         strings[i].split('=', strings2);
@@ -523,15 +528,22 @@ void TranslatorContext::deserialise(const MString& string)
             lookup.createdNodes().push_back(obj);
         }
 
-        // Check for any prim lookup duplicates.
-        // This assumes lookups have 1:1 mapping of prim to translator, and that
-        // multiple translators can not be registered against the same prim type.
-        auto iter
-            = std::find_if(m_primMapping.begin(), m_primMapping.end(), [&](const PrimLookup& p) {
-                  return p.path() == lookup.path();
-              });
-        if (iter == m_primMapping.end())
-            m_primMapping.push_back(lookup);
+        m_primMapping.push_back(std::move(lookup));
+    }
+
+    // Restore the sort order (and drop any prim lookup duplicates) in one pass rather than
+    // searching the whole mapping for every entry read. The stable sort keeps the existing and
+    // earlier entries ahead of later ones sharing the same path, so those are the ones kept.
+    // This assumes lookups have 1:1 mapping of prim to translator, and that
+    // multiple translators can not be registered against the same prim type.
+    if (m_primMapping.size() != numExisting) {
+        std::stable_sort(m_primMapping.begin(), m_primMapping.end(), value_compare());
+        m_primMapping.erase(
+            std::unique(
+                m_primMapping.begin(),
+                m_primMapping.end(),
+                [](const PrimLookup& a, const PrimLookup& b) { return a.path() == b.path(); }),
+            m_primMapping.end());
     }
 
     SdfPathVector vec = m_proxyShape->getPrimPathsFromCommaJoinedString(
@@ -570,6 +582,10 @@ void TranslatorContext::preRemoveEntry(
 
     auto stage = m_proxyShape->usdStage();
 
+    // paths already recorded by earlier calls (e.g. several variant switches in one change list)
+    const std::unordered_set<SdfPath, SdfPath::Hash> existingItems(
+        itemsToRemove.begin(), itemsToRemove.end());
+
     // run the preTearDown stage on each prim. We will walk over the prims in the reverse order here
     // (which will guarentee the the itemsToRemove will be ordered such that the child prims will be
     // destroyed before their parents).
@@ -579,8 +595,7 @@ void TranslatorContext::preRemoveEntry(
         --iter;
         PrimLookup& node = *iter;
 
-        if (std::find(itemsToRemove.begin(), itemsToRemove.end(), node.path())
-            != itemsToRemove.end()) {
+        if (existingItems.count(node.path())) {
             // Same exact path has already been processed and added to the list of itemsToRemove.
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
@@ -655,9 +670,9 @@ void TranslatorContext::updateUniqueKeys()
     for (auto& lookup : m_primMapping) {
         const auto& prim = stage->GetPrimAtPath(lookup.path());
         if (prim) {
-            std::string translatorId = getTranslatorIdForPath(lookup.path());
-            auto        translator
-                = m_proxyShape->translatorManufacture().getTranslatorFromId(translatorId);
+            // The lookup already knows its translator, no need to search the mapping for it.
+            auto translator
+                = m_proxyShape->translatorManufacture().getTranslatorFromId(lookup.translatorId());
             if (translator) {
                 auto key(translator->generateUniqueKey(prim));
                 TF_DEBUG(ALUSDMAYA_TRANSLATORS)
@@ -28,9 +28,22 @@ AL_USDMAYA_DEFINE_TRANSLATOR(TranslatorTestPlugin, TranslatorTestType);
 //----------------------------------------------------------------------------------------------------------------------
 MStatus TranslatorTestPlugin::initialize() { return MStatus::kSuccess; }
 
+//----------------------------------------------------------------------------------------------------------------------
+MStatus TranslatorTestPlugin::preImport(const UsdPrim& prim)
+{
+    // called in parallel, only remember which prims went through the parallel phase
+    std::lock_guard<std::mutex> lock(m_preImportMutex);
+    m_preImportedPaths.insert(prim.GetPath());
+    return MStatus::kSuccess;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus TranslatorTestPlugin::import(const UsdPrim& prim, MObject& parent, MObject& createdObj)
 {
+    if (m_preImportedPaths.erase(prim.GetPath())) {
+        ++preImportedCount;
+    }
+
     MObject distanceShape = MFnDagNode().create("distanceDimShape", parent);
     createdObj = distanceShape;
     context()->insertItem(prim, createdObj);
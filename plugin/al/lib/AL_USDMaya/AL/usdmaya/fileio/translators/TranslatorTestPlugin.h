@@ -21,9 +21,12 @@
 
 #include <pxr/base/tf/type.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 
 #include <maya/MStatus.h>
 
+#include <mutex>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -38,6 +41,9 @@ class TranslatorTestPlugin : public TranslatorBase
 public:
     AL_USDMAYA_DECLARE_TRANSLATOR(TranslatorTestPlugin);
 
+    /// the number of prims imported with the data gathered by preImport(), checked by the tests
+    size_t preImportedCount = 0;
+
 private:
     UsdPrim exportObject(
         UsdStageRefPtr        stage,
@@ -45,6 +51,8 @@ private:
         const SdfPath&        usdPath,
         const ExporterParams& params) override;
     MStatus    initialize() override;
+    bool       supportsPreImport() const override { return true; }
+    MStatus    preImport(const UsdPrim& prim) override;
     MStatus    import(const UsdPrim& prim, MObject& parent, MObject& createdObj) override;
     MStatus    postImport(const UsdPrim& prim) override;
     MStatus    preTearDown(UsdPrim& path) override;
@@ -54,6 +62,9 @@ private:
         return (
             obj.hasFn(MFn::kDistance) ? ExportFlag::kFallbackSupport : ExportFlag::kNotSupported);
     }
+
+    std::mutex m_preImportMutex;
+    SdfPathSet m_preImportedPaths;
 };
 #endif
 
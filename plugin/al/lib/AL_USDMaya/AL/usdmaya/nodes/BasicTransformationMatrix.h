@@ -71,6 +71,10 @@ public:
 
     virtual void initialiseToPrim(bool readFromPrim = true, Scope* node = 0) { }
 
+    /// \brief  called when the xform op attributes of the prim have been edited, so that any cached
+    ///         attribute queries can be rebuilt.
+    virtual void invalidateAttributeQueries() { }
+
     /// \brief  the type ID of the transformation matrix
     AL_USDMAYA_PUBLIC
     static const MTypeId kTypeId;
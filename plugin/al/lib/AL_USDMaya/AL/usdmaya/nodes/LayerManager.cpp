@@ -23,6 +23,7 @@
 #include <mayaUsd/listeners/notice.h>
 
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/textFileFormat.h>
 #include <pxr/usd/usd/usdFileFormat.h>
 #include <pxr/usd/usd/usdaFileFormat.h>
@@ -38,6 +39,8 @@
 #include <maya/MProfiler.h>
 
 #include <mutex>
+#include <string>
+#include <vector>
 
 namespace {
 const int _layerManagerProfilerCategory = MProfiler::addCategory(
@@ -464,9 +467,23 @@ MStatus LayerManager::populateSerialisationAttributes()
         std::shared_lock<std::shared_timed_mutex> lock(m_layersMutex);
         MArrayDataBuilder builder(&dataBlock, layers(), m_layerDatabase.max_size(), &status);
         AL_MAYA_CHECK_ERROR(status, errorString);
-        std::string temp;
+
+        // Exporting is by far the most expensive part of a save, and each layer is exported
+        // independently of the others, so they are serialised in parallel. Only the writes into
+        // the datablock below need to happen on the main thread.
+        std::vector<SdfLayerRefPtr> layersToExport;
         for (const auto& layerAndIds : m_layerDatabase) {
-            auto&       layer = layerAndIds.first;
+            layersToExport.push_back(layerAndIds.first);
+        }
+        std::vector<std::string> exported(layersToExport.size());
+        WorkParallelForN(layersToExport.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                layersToExport[i]->ExportToString(&exported[i]);
+            }
+        });
+
+        for (size_t i = 0, n = layersToExport.size(); i < n; ++i) {
+            auto&       layer = layersToExport[i];
             MDataHandle layersElemHandle = builder.addLast(&status);
             AL_MAYA_CHECK_ERROR(status, errorString);
             MDataHandle idHandle = layersElemHandle.child(m_identifier);
@@ -475,8 +492,8 @@ MStatus LayerManager::populateSerialisationAttributes()
             auto        fileFormatIdToken = layer->GetFileFormat()->GetFormatId();
             fileFormatIdHandle.setString(AL::maya::utils::convert(fileFormatIdToken.GetString()));
             MDataHandle serializedHandle = layersElemHandle.child(m_serialized);
-            layer->ExportToString(&temp);
-            serializedHandle.setString(AL::maya::utils::convert(temp));
+            serializedHandle.setString(AL::maya::utils::convert(exported[i]));
+            exported[i] = std::string();
             MDataHandle anonHandle = layersElemHandle.child(m_anonymous);
             anonHandle.setBool(layer->IsAnonymous());
         }
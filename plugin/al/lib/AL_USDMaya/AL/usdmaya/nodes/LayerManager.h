@@ -19,6 +19,7 @@
 #include "AL/maya/utils/NodeHelper.h"
 #include "AL/usdmaya/Api.h"
 
+#include <pxr/base/tf/hash.h>
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MPxNode.h>
@@ -26,6 +27,9 @@
 #include <map>
 #include <set>
 #include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -129,8 +133,10 @@ private:
 class LayerDatabase
 {
 public:
-    typedef std::map<SdfLayerRefPtr, std::vector<std::string>> LayerToIdsMap;
-    typedef std::map<std::string, SdfLayerRefPtr>              IdToLayerMap;
+    // Both directions are hashed, since layer commands look layers up by identifier (and by layer)
+    // far more often than they iterate over the database.
+    typedef std::unordered_map<SdfLayerRefPtr, std::vector<std::string>, TfHash> LayerToIdsMap;
+    typedef std::unordered_map<std::string, SdfLayerRefPtr>                      IdToLayerMap;
 
     /// \brief  Add the given layer to the set of layers in this LayerDatabase, if not already
     /// present,
@@ -28,6 +28,9 @@
 #include <maya/MFnMesh.h>
 #include <maya/MTime.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace AL {
 namespace usdmaya {
 namespace nodes {
@@ -91,31 +94,37 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
 
     MObject obj = inputHandle.asMesh();
 
-    UsdStageRefPtr stage = getStage();
+    // Read the stage from the input data rather than from the proxy shape node, so that this node
+    // only touches data routed to it by the DG and can be evaluated in parallel.
+    UsdStageRefPtr stage;
+    auto*          stageData = inputDataValue<MayaUsdStageData>(data, m_inStageData);
+    if (stageData && stageData->stage) {
+        stage = stageData->stage;
+    } else {
+        stage = getStage();
+    }
+
     if (stage) {
-        UsdPrim     prim = stage->GetPrimAtPath(m_cachePath);
-        UsdGeomMesh mesh(prim);
-
-        MFnMesh      fnMesh(obj);
-        float* const ptr = (float*)fnMesh.getRawPoints(&status);
-        if (ptr) {
-            UsdAttribute points = mesh.GetPointsAttr();
-            if (points.GetNumTimeSamples() > 1) {
+        updateAttributeQueries(stage);
+
+        MFnMesh fnMesh(obj);
+        if (m_pointsQuery.ValueMightBeTimeVarying()) {
+            float* const ptr = (float*)fnMesh.getRawPoints(&status);
+            if (ptr) {
                 VtArray<GfVec3f> pointData;
-                points.Get(&pointData, usdTime);
-                const size_t numPoints = pointData.size();
-                std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
+                m_pointsQuery.Get(&pointData, usdTime);
+                const size_t numPoints = std::min(pointData.size(), size_t(fnMesh.numVertices()));
+                std::memcpy(ptr, pointData.cdata(), sizeof(GfVec3f) * numPoints);
             }
         }
 
-        float* const nptr = (float*)fnMesh.getRawNormals(&status);
-        if (nptr) {
-            UsdAttribute normals = mesh.GetNormalsAttr();
-            if (normals.GetNumTimeSamples() > 1) {
+        if (m_normalsQuery.ValueMightBeTimeVarying()) {
+            float* const nptr = (float*)fnMesh.getRawNormals(&status);
+            if (nptr) {
                 VtArray<GfVec3f> normalData;
-                normals.Get(&normalData, usdTime);
-                const size_t numNormals = normalData.size();
-                std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
+                m_normalsQuery.Get(&normalData, usdTime);
+                const size_t numNormals = std::min(normalData.size(), size_t(fnMesh.numNormals()));
+                std::memcpy(nptr, normalData.cdata(), sizeof(GfVec3f) * numNormals);
             }
         }
         outputHandle.set(obj);
@@ -123,6 +132,41 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
     return status;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimDeformer::updateAttributeQueries(const UsdStageRefPtr& stage)
+{
+    if (m_queryStage && get_pointer(m_queryStage) == get_pointer(stage)
+        && m_queryPath == m_cachePath) {
+        return;
+    }
+    TfNotice::Revoke(m_objectsChangedKey);
+    m_queryStage = stage;
+    m_queryPath = m_cachePath;
+    m_objectsChangedKey = TfNotice::Register(
+        TfCreateWeakPtr(this), &MeshAnimDeformer::onObjectsChanged, m_queryStage);
+
+    UsdGeomMesh mesh(stage->GetPrimAtPath(m_cachePath));
+    if (mesh) {
+        m_pointsQuery = UsdAttributeQuery(mesh.GetPointsAttr());
+        m_normalsQuery = UsdAttributeQuery(mesh.GetNormalsAttr());
+    } else {
+        m_pointsQuery = UsdAttributeQuery();
+        m_normalsQuery = UsdAttributeQuery();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimDeformer::onObjectsChanged(
+    const UsdNotice::ObjectsChanged& notice,
+    const UsdStageWeakPtr&           sender)
+{
+    // the cached queries may no longer resolve to the right values, rebuild them on next compute
+    if (!notice.GetResyncedPaths().empty() || notice.AffectedObject(m_pointsQuery.GetAttribute())
+        || notice.AffectedObject(m_normalsQuery.GetAttribute())) {
+        m_queryStage = UsdStageWeakPtr();
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus MeshAnimDeformer::connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc)
 {
@@ -17,6 +17,9 @@
 #include "AL/maya/utils/MayaHelperMacros.h"
 #include "AL/maya/utils/NodeHelper.h"
 
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MNodeMessage.h>
@@ -36,6 +39,7 @@ namespace nodes {
 class MeshAnimDeformer
     : public MPxNode
     , public AL::maya::utils::NodeHelper
+    , public TfWeakBase
 {
 public:
     /// \brief  ctor
@@ -45,7 +49,11 @@ public:
     {
     }
 
-    inline ~MeshAnimDeformer() { MNodeMessage::removeCallback(m_attributeChanged); }
+    inline ~MeshAnimDeformer()
+    {
+        MNodeMessage::removeCallback(m_attributeChanged);
+        TfNotice::Revoke(m_objectsChangedKey);
+    }
 
     //--------------------------------------------------------------------------------------------------------------------
     /// Type Info & Registration
@@ -62,6 +70,9 @@ public:
     AL_DECL_ATTRIBUTE(inMesh);
     AL_DECL_ATTRIBUTE(outMesh);
 
+    /// \brief  the node only reads from its own inputs, so can be evaluated in parallel
+    MPxNode::SchedulingType schedulingType() const override { return kParallel; }
+
 private:
     void           postConstructor() override;
     MStatus        connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc) override;
@@ -69,11 +80,18 @@ private:
     static void    onAttributeChanged(MNodeMessage::AttributeMessage, MPlug&, MPlug&, void*);
     MStatus        compute(const MPlug& plug, MDataBlock& data) override;
     UsdStageRefPtr getStage();
+    void           updateAttributeQueries(const UsdStageRefPtr& stage);
+    void onObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender);
 
 private:
-    SdfPath       m_cachePath;
-    MObjectHandle proxyShapeHandle;
-    MCallbackId   m_attributeChanged = 0;
+    SdfPath           m_cachePath;
+    SdfPath           m_queryPath;
+    UsdStageWeakPtr   m_queryStage;
+    UsdAttributeQuery m_pointsQuery;
+    UsdAttributeQuery m_normalsQuery;
+    TfNotice::Key     m_objectsChangedKey;
+    MObjectHandle     proxyShapeHandle;
+    MCallbackId       m_attributeChanged = 0;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
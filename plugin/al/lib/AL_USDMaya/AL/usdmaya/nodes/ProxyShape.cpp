@@ -65,6 +65,11 @@
 
 #include <ghc/filesystem.hpp>
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <tuple>
+
 namespace AL {
 namespace usdmaya {
 namespace nodes {
@@ -103,6 +108,64 @@ bool hasNode(const MFnDependencyNode& fn)
     return result.length();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief Processes the changed objects a proxy shape has deferred, once Maya is idle.
+void processPendingChangedObjectsOnIdle(void* data)
+{
+    std::unique_ptr<MObjectHandle> proxyShapeHandle(static_cast<MObjectHandle*>(data));
+    if (!proxyShapeHandle->isAlive() || !proxyShapeHandle->isValid())
+        return;
+
+    MFnDependencyNode proxyShapeFn(proxyShapeHandle->object());
+    if (auto proxyShape = dynamic_cast<ProxyShape*>(proxyShapeFn.userNode()))
+        proxyShape->processPendingChangedObjects();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief Imaging engines are shared between proxy shapes that image the same stage from the same
+///        root path with the same excluded prims, so repeated layout elements populate a single
+///        render index. Each proxy supplies its own transform when it draws or picks.
+struct SharedEngine
+{
+    UsdStageWeakPtr       stage;
+    std::weak_ptr<Engine> engine;
+};
+using SharedEngineKey = std::tuple<const UsdStage*, SdfPath, SdfPathVector>;
+std::map<SharedEngineKey, SharedEngine> _sharedEngines;
+
+//----------------------------------------------------------------------------------------------------------------------
+std::shared_ptr<Engine> acquireSharedEngine(
+    const UsdStageRefPtr& stage,
+    const SdfPath&        rootPath,
+    SdfPathVector         excludedPaths,
+    bool&                 created)
+{
+    std::sort(excludedPaths.begin(), excludedPaths.end());
+    SharedEngineKey key(get_pointer(stage), rootPath, excludedPaths);
+
+    // the stage weak pointer guards against a new stage being allocated at a freed address
+    auto it = _sharedEngines.find(key);
+    if (it != _sharedEngines.end() && it->second.stage) {
+        if (std::shared_ptr<Engine> engine = it->second.engine.lock()) {
+            created = false;
+            return engine;
+        }
+    }
+
+    for (auto iter = _sharedEngines.begin(); iter != _sharedEngines.end();) {
+        if (!iter->second.stage || iter->second.engine.expired()) {
+            iter = _sharedEngines.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    auto engine = std::make_shared<Engine>(rootPath, excludedPaths);
+    _sharedEngines[key] = SharedEngine { UsdStageWeakPtr(stage), engine };
+    created = true;
+    return engine;
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -195,6 +258,38 @@ UsdStagePopulationMask ProxyShape::constructStagePopulationMask(const MString& p
     return mask;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void ProxyShape::updateStagePopulationMask(const UsdStagePopulationMask& mask)
+{
+    MProfilingScope profilerScope(
+        _proxyShapeProfilerCategory, MProfiler::kColorE_L3, "Update stage population mask");
+
+    // The stage may come from the stage cache and be shared with other proxy shapes, in which case
+    // changing its mask in place would change what they see as well. Load a stage of our own.
+    MFnDependencyNode  fn;
+    MItDependencyNodes iter(MFn::kPluginShape);
+    for (; !iter.isDone(); iter.next()) {
+        fn.setObject(iter.item());
+        if (fn.typeId() != ProxyShape::kTypeId || fn.object() == thisMObject())
+            continue;
+        auto proxyShape = static_cast<ProxyShape*>(fn.userNode());
+        if (proxyShape && proxyShape->m_stage == m_stage) {
+            TF_DEBUG(ALUSDMAYA_EVALUATION)
+                .Msg("ProxyShape::updateStagePopulationMask stage is shared, reloading\n");
+            loadStage();
+            return;
+        }
+    }
+
+    TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::updateStagePopulationMask in place\n");
+
+    // USD only recomposes the subtrees whose population changed, and the resulting
+    // ObjectsChanged notice imports or tears down the matching translated prims.
+    m_stage->SetPopulationMask(mask);
+    // Expand the mask, since we do not really want to mask the possible relation targets.
+    m_stage->ExpandPopulationMask();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::translatePrimPathsIntoMaya(
     const SdfPathVector&                             importPaths,
@@ -338,7 +433,7 @@ Engine* ProxyShape::engine(bool construct)
     if (!m_engine && construct) {
         constructGLImagingEngine();
     }
-    return m_engine;
+    return m_engine.get();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -349,8 +444,8 @@ void ProxyShape::destroyGLImagingEngine()
 
     if (m_engine) {
         triggerEvent("DestroyGLEngine");
-        delete m_engine;
-        m_engine = nullptr;
+        // the engine itself is only deleted once the last proxy shape sharing it lets go of it
+        m_engine.reset();
     }
 }
 
@@ -372,10 +467,12 @@ void ProxyShape::constructGLImagingEngine()
             destroyGLImagingEngine();
             SdfPathVector excludedGeometryPaths = getExcludePrimPaths();
 
-            m_engine = new Engine(m_path, excludedGeometryPaths);
-            // set renderer plugin based on RendererManager setting
+            bool created = false;
+            m_engine = acquireSharedEngine(m_stage, m_path, excludedGeometryPaths, created);
+            // set renderer plugin based on RendererManager setting. A shared engine has already
+            // been set up by the proxy shape that created it.
             RendererManager* manager = RendererManager::findManager();
-            if (manager && m_engine) {
+            if (manager && created) {
                 manager->changeRendererPlugin(this, true);
             }
 
@@ -575,7 +672,7 @@ MStatus ProxyShape::initialise()
         m_populationMaskIncludePaths = addStringAttr(
             "populationMaskIncludePaths",
             "pmi",
-            kCached | kReadable | kWritable | kStorable | kAffectsAppearance);
+            kCached | kReadable | kWritable | kStorable | kAffectsAppearance | kInternal);
         m_excludedTranslatedGeometry = addStringAttr(
             "excludedTranslatedGeometry",
             "etg",
@@ -949,7 +1046,22 @@ void ProxyShape::onObjectsChanged(
         const UsdNotice::ObjectsChanged::PathRange resyncedPaths = notice.GetResyncedPaths();
         const UsdNotice::ObjectsChanged::PathRange changedOnlyPaths
             = notice.GetChangedInfoOnlyPaths();
-        processChangedObjects(SdfPathVector(resyncedPaths), SdfPathVector(changedOnlyPaths));
+
+        // When batching, the paths are merged and processed once Maya is idle, which happens
+        // before the viewport refresh requested below.
+        if (MGlobal::optionVarIntValue("AL_usdmaya_batchChangedObjects")) {
+            m_pendingResyncedPaths.insert(
+                m_pendingResyncedPaths.end(), resyncedPaths.begin(), resyncedPaths.end());
+            m_pendingChangedOnlyPaths.insert(
+                m_pendingChangedOnlyPaths.end(), changedOnlyPaths.begin(), changedOnlyPaths.end());
+            if (!m_pendingChangesQueued) {
+                m_pendingChangesQueued = true;
+                MGlobal::executeTaskOnIdle(
+                    processPendingChangedObjectsOnIdle, new MObjectHandle(thisMObject()));
+            }
+        } else {
+            processChangedObjects(SdfPathVector(resyncedPaths), SdfPathVector(changedOnlyPaths));
+        }
 
         // If redraw wasn't requested from Maya i.e. external stage modification
         // We need to request redraw on idle, so viewport is updated
@@ -1000,6 +1112,7 @@ void ProxyShape::onTransactionNotice(
     TF_DEBUG(ALUSDMAYA_EVENTS)
         .Msg("ProxyShape::onTransactionNotice - transaction closed - processing changes\n");
 
+    processPendingChangedObjects();
     processChangedObjects(notice.GetResyncedPaths(), notice.GetChangedInfoOnlyPaths());
     if (!m_requestedRedraw) {
         m_requestedRedraw = true;
@@ -1007,6 +1120,33 @@ void ProxyShape::onTransactionNotice(
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void ProxyShape::processPendingChangedObjects()
+{
+    m_pendingChangesQueued = false;
+    if (m_pendingResyncedPaths.empty() && m_pendingChangedOnlyPaths.empty()) {
+        return;
+    }
+
+    SdfPathVector resyncedPaths, changedOnlyPaths;
+    resyncedPaths.swap(m_pendingResyncedPaths);
+    changedOnlyPaths.swap(m_pendingChangedOnlyPaths);
+
+    // a resync of a prim covers its whole subtree, as it does within a single notice
+    SdfPath::RemoveDescendentPaths(&resyncedPaths);
+    std::sort(changedOnlyPaths.begin(), changedOnlyPaths.end());
+    changedOnlyPaths.erase(
+        std::unique(changedOnlyPaths.begin(), changedOnlyPaths.end()), changedOnlyPaths.end());
+
+    TF_DEBUG(ALUSDMAYA_EVENTS)
+        .Msg(
+            "ProxyShape::processPendingChangedObjects - %zu resynced, %zu changed paths\n",
+            resyncedPaths.size(),
+            changedOnlyPaths.size());
+
+    processChangedObjects(resyncedPaths, changedOnlyPaths);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::processChangedObjects(
     const SdfPathVector& resyncedPaths,
@@ -1060,6 +1200,21 @@ void ProxyShape::processChangedObjects(
         }
     }
 
+    // any transforms whose xform ops have been edited need to rebuild their cached attribute
+    // queries, since their resolve info may no longer be valid.
+    for (const SdfPath& path : changedOnlyPaths) {
+        if (path.IsPrimPropertyPath()
+            && std::strncmp(path.GetElementString().c_str(), ".xformOp", 8) == 0) {
+            auto it = m_requiredPaths.find(path.GetPrimPath());
+            if (it != m_requiredPaths.end()) {
+                Scope* tm = it->second.getTransformNode();
+                if (tm && tm->transform()) {
+                    tm->transform()->invalidateAttributeQueries();
+                }
+            }
+        }
+    }
+
     // check to see if any transform ops have been modified (update the bounds accordingly)
     if (!shouldCleanBBoxCache) {
         for (const SdfPath& path : changedOnlyPaths) {
@@ -1740,6 +1895,19 @@ bool ProxyShape::setInternalValue(const MPlug& plug, const MDataHandle& dataHand
             constructExcludedPrims();
         }
         return true;
+    } else if (plug == m_populationMaskIncludePaths) {
+        // can't use dataHandle.datablock(), as this is a temporary datahandle
+        MDataBlock datablock = forceCache();
+        AL_MAYA_CHECK_ERROR_RETURN_VAL(
+            outputStringValue(datablock, plug, dataHandle.asString()),
+            false,
+            "ProxyShape::setInternalValue - error setting populationMaskIncludePaths");
+
+        // the mask of a newly loaded stage is read from the datablock in loadStage
+        if (m_stage && !MFileIO::isReadingFile()) {
+            updateStagePopulationMask(constructStagePopulationMask(dataHandle.asString()));
+        }
+        return true;
     } else if (plug == m_pauseUpdates) {
         bool oldIgnoring = m_ignoringUpdates;
         m_ignoringUpdates = dataHandle.asBool();
@@ -1749,7 +1917,7 @@ bool ProxyShape::setInternalValue(const MPlug& plug, const MDataHandle& dataHand
         }
         return true;
     }
-    return false;
+    return MayaUsdProxyShapeBase::setInternalValue(plug, dataHandle);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1759,7 +1927,7 @@ bool ProxyShape::getInternalValue(const MPlug& plug, MDataHandle& dataHandle)
         dataHandle.set(m_ignoringUpdates);
         return true;
     }
-    return false;
+    return MayaUsdProxyShapeBase::getInternalValue(plug, dataHandle);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
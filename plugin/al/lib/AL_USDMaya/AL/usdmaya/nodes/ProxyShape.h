@@ -38,11 +38,14 @@
 #include <maya/MDagPath.h>
 #include <maya/MGlobal.h>
 #include <maya/MNodeMessage.h>
+#include <maya/MObjectArray.h>
 #include <maya/MPxSurfaceShape.h>
 #include <maya/MSelectionList.h>
 
 #include <boost/functional/hash.hpp>
 
+#include <memory>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -458,6 +461,29 @@ public:
         bool            pushToPrim = MGlobal::optionVarIntValue("AL_usdmaya_pushToPrim"),
         bool readAnimatedValues = MGlobal::optionVarIntValue("AL_usdmaya_readAnimatedValues"));
 
+    /// \brief  constructs the chains of transform nodes for all of the given prims into the one
+    ///         modifier. This gives the same result as calling makeUsdTransformChain for each prim,
+    ///         but the proxy shape plugs, the parent transform and the option vars are only looked
+    ///         up once, which matters when thousands of prims are selected at once.
+    /// \param  usdPrims the leaf prims of the chains we wish to create
+    /// \param  modifier will store the changes as the paths are constructed.
+    /// \param  reason  the reason why the paths are being generated.
+    /// \param  modifier2 see makeUsdTransformChain
+    /// \param  createCount the returned number of transforms that were created.
+    /// \param  pushToPrim the initial value for the pushToPrim attributes on the generate transform
+    /// nodes \param  readAnimatedValues the initial value for the readAnimatedValues attributes on
+    /// the generate transform nodes \return the MObjects of the transform nodes for each of the
+    /// usdPrims (a null object for any invalid prim)
+    AL_USDMAYA_PUBLIC
+    MObjectArray makeUsdTransformChains(
+        const std::vector<UsdPrim>& usdPrims,
+        MDagModifier&               modifier,
+        TransformReason             reason,
+        MDGModifier*                modifier2 = 0,
+        uint32_t*                   createCount = 0,
+        bool pushToPrim = MGlobal::optionVarIntValue("AL_usdmaya_pushToPrim"),
+        bool readAnimatedValues = MGlobal::optionVarIntValue("AL_usdmaya_readAnimatedValues"));
+
     /// \brief  Will construct AL_usdmaya_Transform nodes for all of the prims from the specified
     /// usdPrim and down. \param  usdPrim the root for the transforms to be created \param  modifier
     /// the modifier that will store the creation steps for the transforms \param  reason the reason
@@ -610,7 +636,9 @@ public:
 
     /// \brief  returns and optionally constructs the usd imaging engine for this proxy shape
     /// \return the imagine engine instance for this shape (shared between draw override and shape
-    /// ui)
+    /// ui). Proxy shapes that image the same stage from the same root path, with the same excluded
+    /// prims, share a single engine, so callers must set any per-shape state (such as the root
+    /// transform) before each use.
     AL_USDMAYA_PUBLIC
     Engine* engine(bool construct = true);
 
@@ -667,6 +695,12 @@ public:
     AL_USDMAYA_PUBLIC
     void onPrimResync(SdfPath primPath, SdfPathVector& changedPaths);
 
+    /// \brief process the USD object changes that were deferred while the
+    ///        "AL_usdmaya_batchChangedObjects" optionVar is enabled. This runs automatically once
+    ///        Maya is idle, and before a closing transaction is processed.
+    AL_USDMAYA_PUBLIC
+    void processPendingChangedObjects();
+
     /// \brief Preps translators for change, and then re-ceates and updates the maya prim hierarchy
     /// below the
     ///        specified primPath as if a variant change occurred.
@@ -945,6 +979,12 @@ private:
     SdfPathVector          getExcludePrimPaths() const override;
     UsdStagePopulationMask constructStagePopulationMask(const MString& paths) const;
 
+    /// \brief  Applies a new population mask to the current stage without reloading it, so only the
+    ///         subtrees that become (un)masked are recomposed. Falls back on a full reload when the
+    ///         stage is shared with another proxy shape.
+    /// \param  mask the new population mask
+    void updateStagePopulationMask(const UsdStagePopulationMask& mask);
+
     /// \brief  Convert variant fallbacks from string (attribute value)
     /// \param  fallbacksStr attribute value
     /// \return PcpVariantFallbackMap type of variant fallbacks
@@ -1073,7 +1113,9 @@ private:
     SdfPath                                    m_changedPath;
     SdfPathVector                              m_variantSwitchedPrims;
     SdfLayerHandle                             m_prevEditTarget;
-    Engine*                                    m_engine = 0;
+    SdfPathVector                              m_pendingResyncedPaths;
+    SdfPathVector                              m_pendingChangedOnlyPaths;
+    std::shared_ptr<Engine>                    m_engine;
 
     uint32_t m_engineRefCount = 0;
     bool     m_compositionHasChanged = false;
@@ -1082,6 +1124,7 @@ private:
     bool     m_hasChangedSelection = false;
     bool     m_filePathDirty = false;
     bool     m_requestedRedraw = false;
+    bool     m_pendingChangesQueued = false;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -194,7 +194,7 @@ void ProxyShape::makeTransformReference(
     if (handle.isAlive() && handle.isValid()) {
         MFnDagNode fn(node, &status);
         status = fn.getPath(dagPath);
-        while (tempPath != SdfPath("/")) {
+        while (tempPath != SdfPath::AbsoluteRootPath()) {
             MObject tempNode = dagPath.node(&status);
             auto    existing = m_requiredPaths.find(tempPath);
             if (existing != m_requiredPaths.end()) {
@@ -213,7 +213,7 @@ void ProxyShape::makeTransformReference(
             tempPath = tempPath.GetParentPath();
         }
     } else {
-        while (tempPath != SdfPath("/")) {
+        while (tempPath != SdfPath::AbsoluteRootPath()) {
             auto existing = m_requiredPaths.find(tempPath);
             if (existing != m_requiredPaths.end()) {
                 existing->second.incRef(reason);
@@ -302,6 +302,67 @@ MObject ProxyShape::makeUsdTransformChain(
     return newNode;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+MObjectArray ProxyShape::makeUsdTransformChains(
+    const std::vector<UsdPrim>& usdPrims,
+    MDagModifier&               modifier,
+    TransformReason             reason,
+    MDGModifier*                modifier2,
+    uint32_t*                   createCount,
+    bool                        pushToPrim,
+    bool                        readAnimatedValues)
+{
+    MProfilingScope profilerScope(
+        _proxyShapeSelectionProfilerCategory, MProfiler::kColorE_L3, "Make Usd transform chains");
+
+    MObjectArray nodes;
+    nodes.setLength(usdPrims.size());
+
+    const MPlug outTimeAttr = outTimePlug();
+    const MPlug outStageAttr = outStageDataPlug();
+
+    // makes the assumption that instancing isn't supported.
+    MFnDagNode    fn(thisMObject());
+    const MObject parent = fn.parent(0);
+
+    std::vector<std::pair<SdfPath, MObject>> newRefs;
+    newRefs.reserve(usdPrims.size());
+
+    for (size_t i = 0, n = usdPrims.size(); i < n; ++i) {
+        const UsdPrim& usdPrim = usdPrims[i];
+        if (!usdPrim) {
+            continue;
+        }
+
+        // special case for selection. Do not allow duplicate paths to be selected.
+        if (reason == kSelection) {
+            auto insertResult = m_selectedPaths.insert(usdPrim.GetPath());
+            if (!insertResult.second) {
+                nodes[i] = m_requiredPaths.find(usdPrim.GetPath())->second.node();
+                continue;
+            }
+        }
+
+        nodes[i] = makeUsdTransformChain(
+            usdPrim,
+            outStageAttr,
+            outTimeAttr,
+            parent,
+            modifier,
+            reason,
+            modifier2,
+            createCount,
+            nullptr,
+            pushToPrim,
+            readAnimatedValues);
+        newRefs.emplace_back(usdPrim.GetPath(), nodes[i]);
+    }
+
+    insertTransformRefs(newRefs, reason);
+    return nodes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
 static void createMayaNode(
     const UsdPrim& usdPrim,
     MObject&       node,
@@ -838,7 +899,7 @@ void ProxyShape::insertTransformRefs(
     const std::vector<std::pair<SdfPath, MObject>>& removedRefs,
     TransformReason                                 reason)
 {
-    for (auto iter : removedRefs) {
+    for (const auto& iter : removedRefs) {
         makeTransformReference(iter.first, iter.second, reason);
     }
 }
@@ -912,7 +973,7 @@ void ProxyShape::removeTransformRefs(
 
     TF_DEBUG(ALUSDMAYA_SELECTION)
         .Msg("ProxyShapeSelection::removeTransformRefs %lu\n", removedRefs.size());
-    for (auto iter : removedRefs) {
+    for (const auto& iter : removedRefs) {
         UsdPrim parentPrim = m_stage->GetPrimAtPath(iter.first);
         while (parentPrim) {
             auto it = m_requiredPaths.find(parentPrim.GetPath());
@@ -928,7 +989,7 @@ void ProxyShape::removeTransformRefs(
             }
 
             parentPrim = parentPrim.GetParent();
-            if (parentPrim.GetPath() == SdfPath("/")) {
+            if (parentPrim.GetPath() == SdfPath::AbsoluteRootPath()) {
                 break;
             }
         }
@@ -966,7 +1027,7 @@ bool ProxyShape::removeAllSelectedNodes(SelectionUndoHelper& helper)
                 const TransformReferenceMap::iterator a,
                 const TransformReferenceMap::iterator b) const
             {
-                return a->first.GetString().size() > b->first.GetString().size();
+                return a->first.GetPathElementCount() > b->first.GetPathElementCount();
             }
         };
         std::sort(toRemove.begin(), toRemove.end(), compare_length());
@@ -985,12 +1046,10 @@ bool ProxyShape::removeAllSelectedNodes(SelectionUndoHelper& helper)
             helper.m_modifier1.deleteNode(temp);
 
             auto& paths = selectedPaths();
-            for (auto iter = paths.begin(), end = paths.end(); iter != end; ++iter) {
-                if (*iter == (*value)->first) {
-                    helper.m_removedRefs.emplace_back((*value)->first, temp);
-                    paths.erase(iter);
-                    break;
-                }
+            auto  selected = paths.find((*value)->first);
+            if (selected != paths.end()) {
+                helper.m_removedRefs.emplace_back((*value)->first, temp);
+                paths.erase(selected);
             }
         }
         m_selectedPaths.clear();
@@ -22,6 +22,7 @@
 
 #include <mayaUsd/nodes/stageData.h>
 
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/usdGeom/scope.h>
 
 #include <maya/MBoundingBox.h>
@@ -464,6 +465,9 @@ MStatus Transform::validateAndSetValue(
         return MS::kSuccess;
     }
 
+    // Setting a transform attribute may push several xform op values back to the prim, author them
+    // as one batch so that only a single round of change notices is sent.
+    SdfChangeBlock changeBlock;
     return MPxTransform::validateAndSetValue(plug, handle, context);
 }
 
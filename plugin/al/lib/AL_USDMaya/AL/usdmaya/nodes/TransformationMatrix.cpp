@@ -23,6 +23,8 @@
 #include "AL/usdmaya/utils/AttributeType.h"
 #include "AL/usdmaya/utils/Utils.h"
 
+#include <pxr/usd/sdf/changeBlock.h>
+
 #include <maya/MFileIO.h>
 #include <maya/MFnTransform.h>
 #include <maya/MProfiler.h>
@@ -60,6 +62,19 @@ UsdTimeCode getTimeCodeForOp(const UsdGeomXformOp& op, const UsdTimeCode& time)
     return UsdTimeCode::Default();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+bool hasTimeSamples(const UsdAttributeQuery& query)
+{
+    // Same answer as GetNumTimeSamples() >= 1, but read from the resolve info cached in the query
+    // rather than gathering the samples.
+    switch (query.GetResolveInfo().GetSource()) {
+    case UsdResolveInfoSourceTimeSamples:
+    case UsdResolveInfoSourceValueClips: return true;
+    default: break;
+    }
+    return false;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool hasEmptyDefaultValue(const UsdGeomXformOp& op, UsdTimeCode time)
 {
@@ -590,6 +605,9 @@ void TransformationMatrix::setFromMatrix(MObject thisNode, const MMatrix& m)
     m_translationFromUsd.x = T[0];
     m_translationFromUsd.y = T[1];
     m_translationFromUsd.z = T[2];
+
+    // each plug set below may push its component back to the prim, so batch those edits
+    SdfChangeBlock changeBlock;
     MPlug(thisNode, MPxTransform::scaleX).setValue(m_scaleFromUsd.x);
     MPlug(thisNode, MPxTransform::scaleY).setValue(m_scaleFromUsd.y);
     MPlug(thisNode, MPxTransform::scaleZ).setValue(m_scaleFromUsd.z);
@@ -926,6 +944,7 @@ void TransformationMatrix::initialiseToPrim(bool readFromPrim, Scope* transformN
     bool resetsXformStack = false;
     m_xformops = m_xform.GetOrderedXformOps(&resetsXformStack);
     m_orderedOps.resize(m_xformops.size());
+    m_xformopQueries.clear();
 
     if (!resetsXformStack) {
         m_flags |= kInheritsTransform;
@@ -1191,15 +1210,27 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
     if (m_time != time) {
         m_time = time;
         {
+            // The queries are dropped whenever the op stack is rebuilt or edited; inserting an op
+            // changes the stack size, so a size mismatch also means they are out of date.
+            if (m_xformopQueries.size() != m_xformops.size()) {
+                m_xformopQueries.clear();
+                m_xformopQueries.reserve(m_xformops.size());
+                for (const auto& op : m_xformops) {
+                    m_xformopQueries.emplace_back(op.GetAttr());
+                }
+            }
+
             auto opIt = m_orderedOps.begin();
+            auto queryIt = m_xformopQueries.cbegin();
             for (std::vector<UsdGeomXformOp>::const_iterator it = m_xformops.begin(),
                                                              e = m_xformops.end();
                  it != e;
-                 ++it, ++opIt) {
-                const UsdGeomXformOp& op = *it;
+                 ++it, ++opIt, ++queryIt) {
+                const UsdGeomXformOp&    op = *it;
+                const UsdAttributeQuery& query = *queryIt;
                 switch (*opIt) {
                 case kTranslate: {
-                    if (op.GetNumTimeSamples() >= 1) {
+                    if (hasTimeSamples(query)) {
                         m_flags |= kAnimatedTranslation;
                         internal_readVector(m_translationFromUsd, op);
                         MPxTransformationMatrix::translationValue
@@ -1208,7 +1239,7 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
                 } break;
 
                 case kRotate: {
-                    if (op.GetNumTimeSamples() >= 1) {
+                    if (hasTimeSamples(query)) {
                         m_flags |= kAnimatedRotation;
                         internal_readRotation(m_rotationFromUsd, op);
                         MPxTransformationMatrix::rotationValue = m_rotationFromUsd;
@@ -1219,7 +1250,7 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
                 } break;
 
                 case kScale: {
-                    if (op.GetNumTimeSamples() >= 1) {
+                    if (hasTimeSamples(query)) {
                         m_flags |= kAnimatedScale;
                         internal_readVector(m_scaleFromUsd, op);
                         MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
@@ -1227,7 +1258,7 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
                 } break;
 
                 case kShear: {
-                    if (op.GetNumTimeSamples() >= 1) {
+                    if (hasTimeSamples(query)) {
                         m_flags |= kAnimatedShear;
                         internal_readShear(m_shearFromUsd, op);
                         MPxTransformationMatrix::shearValue = m_shearFromUsd + m_shearTweak;
@@ -1235,7 +1266,7 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
                 } break;
 
                 case kTransform: {
-                    if (op.GetNumTimeSamples() >= 1) {
+                    if (hasTimeSamples(query)) {
                         m_flags |= kAnimatedMatrix;
                         GfMatrix4d matrix;
                         matrix.SetIdentity();
@@ -2136,93 +2167,99 @@ void TransformationMatrix::pushToPrim()
     bool       oldResetsStack;
     m_xform.GetLocalTransformation(&oldMatrix, &oldResetsStack, getTimeCode());
 
-    auto opIt = m_orderedOps.begin();
-    for (std::vector<UsdGeomXformOp>::iterator it = m_xformops.begin(), e = m_xformops.end();
-         it != e;
-         ++it, ++opIt) {
-        UsdGeomXformOp& op = *it;
-        switch (*opIt) {
-        case kTranslate: {
-            internal_pushVector(MPxTransformationMatrix::translationValue, op);
-            m_translationFromUsd = MPxTransformationMatrix::translationValue;
-            m_translationTweak = MVector(0, 0, 0);
-        } break;
-
-        case kPivot: {
-            // is this a bug?
-            internal_pushPoint(MPxTransformationMatrix::rotatePivotValue, op);
-            m_rotatePivotFromUsd = MPxTransformationMatrix::rotatePivotValue;
-            m_rotatePivotTweak = MPoint(0, 0, 0);
-            m_scalePivotFromUsd = MPxTransformationMatrix::scalePivotValue;
-            m_scalePivotTweak = MVector(0, 0, 0);
-        } break;
-
-        case kRotatePivotTranslate: {
-            internal_pushPoint(MPxTransformationMatrix::rotatePivotTranslationValue, op);
-            m_rotatePivotTranslationFromUsd = MPxTransformationMatrix::rotatePivotTranslationValue;
-            m_rotatePivotTranslationTweak = MVector(0, 0, 0);
-        } break;
-
-        case kRotatePivot: {
-            internal_pushPoint(MPxTransformationMatrix::rotatePivotValue, op);
-            m_rotatePivotFromUsd = MPxTransformationMatrix::rotatePivotValue;
-            m_rotatePivotTweak = MPoint(0, 0, 0);
-        } break;
-
-        case kRotate: {
-            internal_pushRotation(MPxTransformationMatrix::rotationValue, op);
-            m_rotationFromUsd = MPxTransformationMatrix::rotationValue;
-            m_rotationTweak = MEulerRotation(0, 0, 0);
-        } break;
-
-        case kRotateAxis: {
-            const double   radToDeg = 180.0 / M_PI;
-            MEulerRotation e = m_rotateOrientationFromUsd.asEulerRotation();
-            MVector        vec(e.x * radToDeg, e.y * radToDeg, e.z * radToDeg);
-            internal_pushVector(vec, op);
-        } break;
-
-        case kRotatePivotInv: {
-        } break;
-
-        case kScalePivotTranslate: {
-            internal_pushVector(MPxTransformationMatrix::scalePivotTranslationValue, op);
-            m_scalePivotTranslationFromUsd = MPxTransformationMatrix::scalePivotTranslationValue;
-            m_scalePivotTranslationTweak = MVector(0, 0, 0);
-        } break;
-
-        case kScalePivot: {
-            internal_pushPoint(MPxTransformationMatrix::scalePivotValue, op);
-            m_scalePivotFromUsd = MPxTransformationMatrix::scalePivotValue;
-            m_scalePivotTweak = MPoint(0, 0, 0);
-        } break;
-
-        case kShear: {
-            internal_pushShear(MPxTransformationMatrix::shearValue, op);
-            m_shearFromUsd = MPxTransformationMatrix::shearValue;
-            m_shearTweak = MVector(0, 0, 0);
-        } break;
+    {
+        // author all of the op values as a single batch of changes
+        SdfChangeBlock changeBlock;
+        auto opIt = m_orderedOps.begin();
+        for (std::vector<UsdGeomXformOp>::iterator it = m_xformops.begin(), e = m_xformops.end();
+             it != e;
+             ++it, ++opIt) {
+            UsdGeomXformOp& op = *it;
+            switch (*opIt) {
+            case kTranslate: {
+                internal_pushVector(MPxTransformationMatrix::translationValue, op);
+                m_translationFromUsd = MPxTransformationMatrix::translationValue;
+                m_translationTweak = MVector(0, 0, 0);
+            } break;
 
-        case kScale: {
-            internal_pushVector(MPxTransformationMatrix::scaleValue, op);
-            m_scaleFromUsd = MPxTransformationMatrix::scaleValue;
-            m_scaleTweak = MVector(0, 0, 0);
-        } break;
+            case kPivot: {
+                // is this a bug?
+                internal_pushPoint(MPxTransformationMatrix::rotatePivotValue, op);
+                m_rotatePivotFromUsd = MPxTransformationMatrix::rotatePivotValue;
+                m_rotatePivotTweak = MPoint(0, 0, 0);
+                m_scalePivotFromUsd = MPxTransformationMatrix::scalePivotValue;
+                m_scalePivotTweak = MVector(0, 0, 0);
+            } break;
 
-        case kScalePivotInv: {
-        } break;
+            case kRotatePivotTranslate: {
+                internal_pushPoint(MPxTransformationMatrix::rotatePivotTranslationValue, op);
+                m_rotatePivotTranslationFromUsd
+                    = MPxTransformationMatrix::rotatePivotTranslationValue;
+                m_rotatePivotTranslationTweak = MVector(0, 0, 0);
+            } break;
 
-        case kPivotInv: {
-        } break;
+            case kRotatePivot: {
+                internal_pushPoint(MPxTransformationMatrix::rotatePivotValue, op);
+                m_rotatePivotFromUsd = MPxTransformationMatrix::rotatePivotValue;
+                m_rotatePivotTweak = MPoint(0, 0, 0);
+            } break;
 
-        case kTransform: {
-            if (pushPrimToMatrix()) {
-                internal_pushMatrix(asMatrix(), op);
-            }
-        } break;
+            case kRotate: {
+                internal_pushRotation(MPxTransformationMatrix::rotationValue, op);
+                m_rotationFromUsd = MPxTransformationMatrix::rotationValue;
+                m_rotationTweak = MEulerRotation(0, 0, 0);
+            } break;
+
+            case kRotateAxis: {
+                const double   radToDeg = 180.0 / M_PI;
+                MEulerRotation e = m_rotateOrientationFromUsd.asEulerRotation();
+                MVector        vec(e.x * radToDeg, e.y * radToDeg, e.z * radToDeg);
+                internal_pushVector(vec, op);
+            } break;
+
+            case kRotatePivotInv: {
+            } break;
+
+            case kScalePivotTranslate: {
+                internal_pushVector(MPxTransformationMatrix::scalePivotTranslationValue, op);
+                m_scalePivotTranslationFromUsd
+                    = MPxTransformationMatrix::scalePivotTranslationValue;
+                m_scalePivotTranslationTweak = MVector(0, 0, 0);
+            } break;
+
+            case kScalePivot: {
+                internal_pushPoint(MPxTransformationMatrix::scalePivotValue, op);
+                m_scalePivotFromUsd = MPxTransformationMatrix::scalePivotValue;
+                m_scalePivotTweak = MPoint(0, 0, 0);
+            } break;
 
-        case kUnknownOp: {
-        } break;
+            case kShear: {
+                internal_pushShear(MPxTransformationMatrix::shearValue, op);
+                m_shearFromUsd = MPxTransformationMatrix::shearValue;
+                m_shearTweak = MVector(0, 0, 0);
+            } break;
+
+            case kScale: {
+                internal_pushVector(MPxTransformationMatrix::scaleValue, op);
+                m_scaleFromUsd = MPxTransformationMatrix::scaleValue;
+                m_scaleTweak = MVector(0, 0, 0);
+            } break;
+
+            case kScalePivotInv: {
+            } break;
+
+            case kPivotInv: {
+            } break;
+
+            case kTransform: {
+                if (pushPrimToMatrix()) {
+                    internal_pushMatrix(asMatrix(), op);
+                }
+            } break;
+
+            case kUnknownOp: {
+            } break;
+            }
         }
     }
     notifyProxyShapeOfRedraw(oldMatrix, oldResetsStack);
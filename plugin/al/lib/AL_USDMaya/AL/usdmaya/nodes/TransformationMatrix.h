@@ -19,6 +19,7 @@
 #include "AL/usdmaya/TransformOperation.h"
 #include "AL/usdmaya/nodes/BasicTransformationMatrix.h"
 
+#include <pxr/usd/usd/attributeQuery.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdGeom/xformable.h>
 
@@ -50,6 +51,10 @@ class TransformationMatrix : public BasicTransformationMatrix
     std::vector<UsdGeomXformOp>     m_xformops;
     std::vector<TransformOperation> m_orderedOps;
 
+    // attribute queries for m_xformops, (re)built lazily by updateToTime so that the value
+    // resolution of each op isn't repeated every frame.
+    std::vector<UsdAttributeQuery> m_xformopQueries;
+
     // tweak values. These are applied on top of the USD transform values to produce the final
     // result.
     MVector        m_scaleTweak;
@@ -364,6 +369,10 @@ class TransformationMatrix : public BasicTransformationMatrix
     /// \param  time the new timecode
     void updateToTime(const UsdTimeCode& time);
 
+    /// \brief  drops the cached attribute queries used by updateToTime, they are rebuilt on the
+    ///         next time change.
+    void invalidateAttributeQueries() override { m_xformopQueries.clear(); }
+
     /// \brief  pushes any modifications on the matrix back onto the UsdPrim
     void pushToPrim();
 
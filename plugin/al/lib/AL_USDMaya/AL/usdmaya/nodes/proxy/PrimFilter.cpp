@@ -56,11 +56,13 @@ PrimFilter::PrimFilter(
             return b < a;
         });
 
-    for (auto it = m_newPrimSet.begin(); it != m_newPrimSet.end();) {
-        UsdPrim prim = *it;
-        auto    lastIt = it;
-        ++it;
+    // Prims that survive the variant switch are flagged here, and the new and removed sets are
+    // compacted once at the end, rather than erasing from the middle of the vectors per prim.
+    std::vector<bool>    keptPrims(m_removedPrimSet.size(), false);
+    std::vector<UsdPrim> newPrims;
+    newPrims.reserve(m_newPrimSet.size());
 
+    for (const UsdPrim& prim : m_newPrimSet) {
         SdfPath path = prim.GetPath();
 
         // check previous prim type (if it exists at all?)
@@ -70,7 +72,6 @@ PrimFilter::PrimFilter(
 
         // inactive prims should be removed
         if (!prim.IsActive()) {
-            it = m_newPrimSet.erase(lastIt);
             continue;
         }
 
@@ -81,18 +82,20 @@ PrimFilter::PrimFilter(
             newTranslatorId, supportsUpdate, requiresParent, importableByDefault);
 
         if (importableByDefault || forceImport) {
+            bool isNew = true;
             // if the type remains the same, and the type supports update
             if (existingTranslatorId == newTranslatorId) {
-                // locate the path and delete from the removed set (we do not want to delete this
-                // prim! Note that m_removedPrimSet is reverse sorted
+                // locate the path in the removed set (we do not want to delete this prim! Note
+                // that m_removedPrimSet is reverse sorted
                 auto iter = std::lower_bound(
                     m_removedPrimSet.begin(),
                     m_removedPrimSet.end(),
                     path,
                     [](const SdfPath& a, const SdfPath& b) { return b < a; });
-                if (iter != removedPrimSet().end() && *iter == path) {
+                if (iter != m_removedPrimSet.end() && *iter == path) {
+                    const size_t index = iter - m_removedPrimSet.begin();
                     if (supportsUpdate) {
-                        m_removedPrimSet.erase(iter);
+                        keptPrims[index] = true;
                         if (proxy->isPrimDirty(prim)) {
                             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                                 .Msg(
@@ -107,7 +110,7 @@ PrimFilter::PrimFilter(
                         }
                         // supporting update means it's not a new prim,
                         // otherwise we still want the prim to be re-created.
-                        it = m_newPrimSet.erase(lastIt);
+                        isNew = false;
 
                         // skip creating transforms in this case.
                         requiresParent = false;
@@ -126,22 +129,32 @@ PrimFilter::PrimFilter(
                                     "PrimFilter::PrimFilter %s prim remains unchanged.\n",
                                     path.GetText());
 
-                            m_removedPrimSet.erase(iter);
-                            it = m_newPrimSet.erase(lastIt);
+                            keptPrims[index] = true;
+                            isNew = false;
                             // skip creating transforms in this case.
                             requiresParent = false;
                         }
                     }
                 }
             }
+            if (isNew) {
+                newPrims.push_back(prim);
+            }
             // if we need a transform, make a note of it now
             if (requiresParent) {
                 m_transformsToCreate.push_back(prim);
             }
-        } else {
-            it = m_newPrimSet.erase(lastIt);
         }
     }
+    m_newPrimSet.swap(newPrims);
+
+    size_t numRemoved = 0;
+    for (size_t i = 0, n = m_removedPrimSet.size(); i < n; ++i) {
+        if (!keptPrims[i]) {
+            m_removedPrimSet[numRemoved++] = m_removedPrimSet[i];
+        }
+    }
+    m_removedPrimSet.resize(numRemoved);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
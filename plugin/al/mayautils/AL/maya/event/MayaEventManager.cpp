@@ -84,7 +84,7 @@ static void bindNodeFunction(MObject& node, void* ptr)
 //----------------------------------------------------------------------------------------------------------------------
 static void bindStringFunction(const MString& str, void* ptr)
 {
-    auto binder = [str](void* ud, const void* cb) {
+    auto binder = [&str](void* ud, const void* cb) {
         MMessage::MStringFunction cf = (MMessage::MStringFunction)cb;
         cf(str, ud);
     };
@@ -102,7 +102,7 @@ static void bindStringIntBoolIntFunction(
     uint32_t       type,
     void*          ptr)
 {
-    auto binder = [str, index, flag, type](void* ud, const void* cb) {
+    auto binder = [&str, index, flag, type](void* ud, const void* cb) {
         MMessage::MStringIntBoolIntFunction cf = (MMessage::MStringIntBoolIntFunction)cb;
         cf(str, index, flag, type, ud);
     };
@@ -115,7 +115,7 @@ static void bindStringIntBoolIntFunction(
 //----------------------------------------------------------------------------------------------------------------------
 static void bindNodeStringBoolFunction(MObject& node, const MString& str, bool flag, void* ptr)
 {
-    auto binder = [&node, str, flag](void* ud, const void* cb) {
+    auto binder = [&node, &str, flag](void* ud, const void* cb) {
         MMessage::MNodeStringBoolFunction cf = (MMessage::MNodeStringBoolFunction)cb;
         cf(node, str, flag, ud);
     };
@@ -167,7 +167,7 @@ static void bindParentChildFunction(MDagPath& child, MDagPath& parent, void* ptr
 //----------------------------------------------------------------------------------------------------------------------
 static void bindStringArrayFunction(const MStringArray& strs, void* ptr)
 {
-    auto binder = [strs](void* ud, const void* cb) {
+    auto binder = [&strs](void* ud, const void* cb) {
         MMessage::MStringArrayFunction cf = (MMessage::MStringArrayFunction)cb;
         cf(strs, ud);
     };
@@ -238,7 +238,7 @@ static void bindPlugsDGModFunction(MPlugArray& plugs, MDGModifier& modifier, voi
 static void
 bindMessageFunction(const MString& message, MCommandMessage::MessageType messageType, void* ptr)
 {
-    auto binder = [message, messageType](void* ud, const void* cb) {
+    auto binder = [&message, messageType](void* ud, const void* cb) {
         MCommandMessage::MMessageFunction cf = (MCommandMessage::MMessageFunction)cb;
         cf(message, messageType, ud);
     };
@@ -256,7 +256,7 @@ static void bindMessageFilterFunction(
     void*                        ptr)
 {
     filterOutput = false;
-    auto binder = [&filterOutput, message, messageType](void* ud, const void* cb) {
+    auto binder = [&filterOutput, &message, messageType](void* ud, const void* cb) {
         bool                                    temp = false;
         MCommandMessage::MMessageFilterFunction cf = (MCommandMessage::MMessageFilterFunction)cb;
         cf(message, messageType, temp, ud);
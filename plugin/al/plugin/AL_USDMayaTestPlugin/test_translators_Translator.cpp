@@ -15,6 +15,7 @@
 //
 #include "AL/usdmaya/fileio/translators/TranslatorBase.h"
 #include "AL/usdmaya/fileio/translators/TranslatorContext.h"
+#include "AL/usdmaya/fileio/translators/TranslatorTestPlugin.h"
 #include "AL/usdmaya/fileio/translators/TranslatorTestType.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
 #include "test_usdmaya.h"
@@ -27,8 +28,13 @@
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MDagModifier.h>
+#include <maya/MFileIO.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MGlobal.h>
+#include <maya/MSelectionList.h>
 
 using namespace AL::usdmaya::fileio::translators;
+using AL::maya::test::buildTempPath;
 
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  Test some of the functionality of the AL::usdmaya::TranslatorBase.
@@ -74,3 +80,38 @@ TEST(translators_Translator, translatorContext)
     EXPECT_TRUE(context->getTransform(m_prim, handle));
     EXPECT_TRUE(handle.object() == tm);
 }
+
+// the prims of a translator supporting preImport() go through it before being imported
+TEST(translators_Translator, preImport)
+{
+    const std::string filePath = buildTempPath("AL_USDMayaTests_preImport.usda");
+    {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        for (const char* path : { "/testPrim1", "/testPrim2", "/testPrim3" }) {
+            TranslatorTestType::Define(stage, SdfPath(path));
+        }
+        stage->GetRootLayer()->Export(filePath);
+    }
+
+    MFileIO::newFile(true);
+    MStatus status = MGlobal::executeCommand(
+        MString("AL_usdmaya_ProxyShapeImport -file \"") + filePath.c_str() + MString("\""));
+    EXPECT_EQ(MS::kSuccess, status);
+
+    MSelectionList sl;
+    EXPECT_TRUE(sl.add("AL_usdmaya_ProxyShape"));
+    MObject node;
+    sl.getDependNode(0, node);
+    MFnDependencyNode fn(node, &status);
+    ASSERT_TRUE(status);
+    auto shape = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+    ASSERT_TRUE(shape);
+
+    UsdPrim          prim = shape->usdStage()->GetPrimAtPath(SdfPath("/testPrim1"));
+    TranslatorRefPtr translator = shape->translatorManufacture().get(prim);
+    ASSERT_TRUE(translator);
+    EXPECT_TRUE(translator->supportsPreImport());
+
+    auto testTranslator = TfStatic_cast<TfRefPtr<TranslatorTestPlugin>>(translator);
+    EXPECT_EQ(3u, testTranslator->preImportedCount);
+}
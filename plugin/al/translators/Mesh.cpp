@@ -27,9 +27,12 @@
 #include "AL/usdmaya/utils/Utils.h"
 #include "CommonTranslatorOptions.h"
 
+#include <mayaUsd/utils/hash.h>
+
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
 
 #include <maya/MFileIO.h>
 #include <maya/MFloatPointArray.h>
@@ -211,6 +214,48 @@ UsdPrim Mesh::exportObject(
     return mesh.GetPrim();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+std::size_t Mesh::generateUniqueKey(const UsdPrim& prim) const
+{
+    // The key covers every component that import() reads, so a mesh whose data did not change
+    // keeps its Maya node when the prim filter runs, instead of being torn down and re-imported.
+    const UsdGeomMesh    mesh(prim);
+    TranslatorContextPtr ctx = context();
+    UsdTimeCode          timeCode = (ctx && ctx->getForceDefaultRead()) ? UsdTimeCode::Default()
+                                                               : UsdTimeCode::EarliestTime();
+
+    std::size_t key = 0;
+    VtValue     value;
+    auto        hashAttribute = [&](const UsdAttribute& attr) {
+        MayaUsd::hash_combine(key, attr.Get(&value, timeCode) ? value.GetHash() : std::size_t(0));
+    };
+    hashAttribute(mesh.GetPointsAttr());
+    hashAttribute(mesh.GetNormalsAttr());
+    hashAttribute(mesh.GetFaceVertexCountsAttr());
+    hashAttribute(mesh.GetFaceVertexIndicesAttr());
+    hashAttribute(mesh.GetHoleIndicesAttr());
+    hashAttribute(mesh.GetCornerIndicesAttr());
+    hashAttribute(mesh.GetCornerSharpnessesAttr());
+    hashAttribute(mesh.GetCreaseIndicesAttr());
+    hashAttribute(mesh.GetCreaseLengthsAttr());
+    hashAttribute(mesh.GetCreaseSharpnessesAttr());
+    hashAttribute(mesh.GetSubdivisionSchemeAttr());
+    hashAttribute(mesh.GetOrientationAttr());
+
+    // uv sets, colour sets and normals primvars
+    for (const UsdGeomPrimvar& primvar : UsdGeomPrimvarsAPI(prim).GetPrimvars()) {
+        MayaUsd::hash_combine(key, primvar.GetPrimvarName().Hash());
+        MayaUsd::hash_combine(key, primvar.GetInterpolation().Hash());
+        hashAttribute(primvar.GetAttr());
+        hashAttribute(primvar.GetIndicesAttr());
+    }
+
+    MayaUsd::hash_combine(key, mesh.ComputeVisibility(timeCode).Hash());
+
+    // a key of zero means no key, which always marks the prim as dirty
+    return key ? key : 1;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus Mesh::tearDown(const SdfPath& path)
 {
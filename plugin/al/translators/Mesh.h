@@ -54,6 +54,7 @@ private:
         return false;
     } // Turned off supportsUpdate to get tearDown working correctly
     bool importableByDefault() const override { return false; }
+    std::size_t generateUniqueKey(const UsdPrim& prim) const override;
 
     ExportFlag canExport(const MObject& obj) override
     {
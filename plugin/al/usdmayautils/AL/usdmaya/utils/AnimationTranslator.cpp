@@ -137,15 +137,111 @@ bool AnimationTranslator::isAnimated(MPlug attr, const bool assumeExpressionIsAn
     }
 
     for (; !iter.isDone(); iter.next()) {
-        MObject currNode = iter.thisPlug().node();
-        if (currNode.hasFn(MFn::kTime)) {
+        if (isAnimatedNode(iter.thisPlug().node(), assumeExpressionIsAnimated)) {
             return true;
         }
-        if (assumeExpressionIsAnimated && currNode.hasFn(MFn::kExpression)) {
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool AnimationTranslator::isAnimatedNode(const MObject& node, const bool assumeExpressionIsAnimated)
+{
+    if (node.hasFn(MFn::kTime)) {
+        return true;
+    }
+    if (assumeExpressionIsAnimated && node.hasFn(MFn::kExpression)) {
+        return true;
+    }
+    return (node.hasFn(MFn::kTransform) || node.hasFn(MFn::kPluginTransformNode))
+        && MAnimUtil::isAnimated(node, true);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool AnimationTranslator::isUpstreamAnimated(
+    const MObject& node,
+    const bool     assumeExpressionIsAnimated)
+{
+    auto&               cache = m_upstreamAnimated[assumeExpressionIsAnimated ? 1 : 0];
+    const MObjectHandle handle(node);
+    const unsigned int  hashCode = handle.hashCode();
+    auto                range = cache.equal_range(hashCode);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.first == handle) {
+            return it->second.second;
+        }
+    }
+
+    bool               result = false;
+    MStatus            status;
+    MObject            root = node;
+    MItDependencyGraph iter(
+        root,
+        MFn::kInvalid,
+        MItDependencyGraph::kUpstream,
+        MItDependencyGraph::kDepthFirst,
+        MItDependencyGraph::kNodeLevel,
+        &status);
+    if (!status) {
+        MGlobal::displayError("Unable to create DG iterator");
+    } else {
+        for (; !iter.isDone(); iter.next()) {
+            if (isAnimatedNode(iter.currentItem(), assumeExpressionIsAnimated)) {
+                result = true;
+                break;
+            }
+        }
+    }
+    cache.emplace(hashCode, std::make_pair(handle, result));
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool AnimationTranslator::isAnimatedCached(MPlug attr, const bool assumeExpressionIsAnimated)
+{
+    if (attr.isArray()) {
+        const uint32_t numElements = attr.numElements();
+        for (uint32_t i = 0; i < numElements; ++i) {
+            if (isAnimatedCached(attr.elementByLogicalIndex(i), assumeExpressionIsAnimated)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (attr.isCompound()) {
+        const uint32_t numChildren = attr.numChildren();
+        for (uint32_t i = 0; i < numChildren; ++i) {
+            if (isAnimatedCached(attr.child(i), assumeExpressionIsAnimated)) {
+                return true;
+            }
+        }
+    }
+
+    MPlugArray plugs;
+    if (!attr.isConnected() || !attr.connectedTo(plugs, true, false)) {
+        return false;
+    }
+
+    // the same anim curve test as isAnimated, which needs no traversal at all
+    bool allAnimCurves = true;
+    for (uint32_t i = 0, n = plugs.length(); i < n && allAnimCurves; ++i) {
+        MObject connectedNode = plugs[i].node();
+        if (!considerToBeAnimation(connectedNode.apiType())) {
+            allAnimCurves = false;
+        } else if (MFnAnimCurve(connectedNode).numKeys() > 1) {
             return true;
         }
-        if ((currNode.hasFn(MFn::kTransform) || currNode.hasFn(MFn::kPluginTransformNode))
-            && MAnimUtil::isAnimated(currNode, true)) {
+    }
+    if (allAnimCurves) {
+        return false;
+    }
+
+    if (isAnimatedNode(attr.node(), assumeExpressionIsAnimated)) {
+        return true;
+    }
+    for (uint32_t i = 0, n = plugs.length(); i < n; ++i) {
+        if (isUpstreamAnimated(plugs[i].node(), assumeExpressionIsAnimated)) {
             return true;
         }
     }
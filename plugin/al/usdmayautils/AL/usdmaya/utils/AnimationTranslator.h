@@ -23,8 +23,11 @@
 
 #include <maya/MDagPath.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 #include <maya/MString.h>
+
+#include <unordered_map>
 PXR_NAMESPACE_USING_DIRECTIVE
 
 /// \brief  operator to compare MPlugs with < operator
@@ -160,7 +163,7 @@ public:
     {
         if (m_animatedPlugs.find(plug) != m_animatedPlugs.end())
             return;
-        if (isAnimated(plug, assumeExpressionIsAnimated))
+        if (isAnimatedCached(plug, assumeExpressionIsAnimated))
             m_animatedPlugs.emplace(plug, attribute);
     }
 
@@ -179,7 +182,7 @@ public:
     {
         if (m_scaledAnimatedPlugs.find(plug) != m_scaledAnimatedPlugs.end())
             return;
-        if (isAnimated(plug, assumeExpressionIsAnimated))
+        if (isAnimatedCached(plug, assumeExpressionIsAnimated))
             m_scaledAnimatedPlugs.emplace(plug, ScaledPair { attribute, scale });
     }
 
@@ -198,7 +201,7 @@ public:
     {
         if (m_animatedTransformPlugs.find(plug) != m_animatedTransformPlugs.end())
             return;
-        if (isAnimated(plug, assumeExpressionIsAnimated))
+        if (isAnimatedCached(plug, assumeExpressionIsAnimated))
             m_animatedTransformPlugs.emplace(plug, attribute);
     }
 
@@ -230,7 +233,7 @@ public:
         }
         bool hasAnimation = false;
         for (const auto& plug : plugs) {
-            if (isAnimated(plug, assumeExpressionIsAnimated)) {
+            if (isAnimatedCached(plug, assumeExpressionIsAnimated)) {
                 hasAnimation = true;
                 break;
             }
@@ -290,6 +293,15 @@ public:
     void exportAnimation(double minFrame, double maxFrame, uint32_t numSamples = 1);
 
 protected:
+    /// \brief  as isAnimated, but the upstream DG traversal is done once per source node and the
+    ///         result is remembered, since the plugs added during an export mostly share the same
+    ///         few upstream networks (rigs, constraints, time nodes).
+    /// \param  attr the attribute to test
+    /// \param  assumeExpressionIsAnimated as isAnimated
+    /// \return true if the attribute was found to be animated
+    AL_USDMAYA_UTILS_PUBLIC
+    bool isAnimatedCached(MPlug attr, bool assumeExpressionIsAnimated);
+
     static bool considerToBeAnimation(const MFn::Type nodeType);
     static bool inheritTransform(const MDagPath& path);
     static bool areTransformAttributesConnected(const MDagPath& path);
@@ -301,6 +313,14 @@ protected:
     MeshAttrVector       m_animatedMeshes;
     WorldSpaceAttrVector m_worldSpaceOutputs;
     AttrMultiPlugsVector m_animatedMultiPlugs;
+
+private:
+    static bool isAnimatedNode(const MObject& node, bool assumeExpressionIsAnimated);
+    bool        isUpstreamAnimated(const MObject& node, bool assumeExpressionIsAnimated);
+
+    // results of isUpstreamAnimated, keyed by the node's hash code, and indexed by
+    // assumeExpressionIsAnimated.
+    std::unordered_multimap<unsigned int, std::pair<MObjectHandle, bool>> m_upstreamAnimated[2];
 };
 
 //----------------------------------------------------------------------------------------------------------------------
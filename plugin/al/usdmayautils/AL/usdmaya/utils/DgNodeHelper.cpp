@@ -21,6 +21,7 @@
 #include <mayaUsdUtils/SIMD.h>
 
 #include <maya/MDGModifier.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MFloatArray.h>
 #include <maya/MFloatMatrix.h>
 #include <maya/MFnCompoundAttribute.h>
@@ -34,6 +35,7 @@
 #include <maya/MMatrix.h>
 #include <maya/MMatrixArray.h>
 #include <maya/MObjectArray.h>
+#include <maya/MTimeArray.h>
 
 #include <iostream>
 
@@ -1129,6 +1131,18 @@ MStatus DgNodeHelper::prepareAnimCurve(
     return status;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  adds all of the keys gathered from the usd time samples to the curve in a single call,
+///         rather than calling addKey (which updates the curve) for every sample.
+static MStatus addKeys(MFnAnimCurve& fnCurve, MTimeArray& times, MDoubleArray& values)
+{
+    if (!times.length()) {
+        return MS::kSuccess;
+    }
+    return fnCurve.addKeys(
+        &times, &values, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus DgNodeHelper::setAngleAnim(
     MObject              node,
@@ -1147,27 +1161,29 @@ MStatus DgNodeHelper::setAngleAnim(
 
     std::vector<double> times;
     op.GetTimeSamples(&times);
+    if (times.empty())
+        return MS::kSuccess;
 
     const float conversionFactor = 0.0174533f;
 
+    MTimeArray   keyTimes;
+    MDoubleArray keyValues;
+    keyTimes.setSizeIncrement(times.size());
+    keyValues.setSizeIncrement(times.size());
+
     float value = 0;
     for (auto const& timeValue : times) {
         const bool retValue = op.GetAs<float>(&value, timeValue);
         if (!retValue)
             continue;
 
-        MTime tm(timeValue, MTime::kFilm);
-
-        fnCurve.addKey(
-            tm,
-            value * conversionFactor,
-            MFnAnimCurve::kTangentGlobal,
-            MFnAnimCurve::kTangentGlobal,
-            NULL,
-            &status);
-        AL_MAYA_CHECK_ERROR(status, errorString);
+        keyTimes.append(MTime(timeValue, MTime::kFilm));
+        keyValues.append(value * conversionFactor);
     }
 
+    status = addKeys(fnCurve, keyTimes, keyValues);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
     return MS::kSuccess;
 }
 
@@ -1197,17 +1213,23 @@ MStatus setAttrAnim(
 
     const auto errorString = MString("DgNodeTranslator::setAttrAnim ") + plug.name();
 
+    MTimeArray   keyTimes;
+    MDoubleArray keyValues;
+    keyTimes.setSizeIncrement(times.size());
+    keyValues.setSizeIncrement(times.size());
+
     T value;
     for (auto const& timeValue : times) {
         if (!usdAttr.Get(&value, timeValue))
             continue;
 
-        MTime tm(timeValue, MTime::kFilm);
-        fnCurve.addKey(
-            tm, value, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-        AL_MAYA_CHECK_ERROR(status, errorString);
+        keyTimes.append(MTime(timeValue, MTime::kFilm));
+        keyValues.append(double(value));
     }
 
+    status = addKeys(fnCurve, keyTimes, keyValues);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
     return MS::kSuccess;
 }
 
@@ -1255,23 +1277,24 @@ MStatus DgNodeHelper::setFloatAttrAnim(
     std::vector<double> times;
     usdAttr.GetTimeSamples(&times);
 
+    MTimeArray   keyTimes;
+    MDoubleArray keyValues;
+    keyTimes.setSizeIncrement(times.size());
+    keyValues.setSizeIncrement(times.size());
+
     float value;
     for (auto const& timeValue : times) {
         const bool retValue = usdAttr.Get(&value, timeValue);
         if (!retValue)
             continue;
 
-        MTime tm(timeValue, MTime::kFilm);
-        fnCurve.addKey(
-            tm,
-            value * conversionFactor,
-            MFnAnimCurve::kTangentGlobal,
-            MFnAnimCurve::kTangentGlobal,
-            NULL,
-            &status);
-        AL_MAYA_CHECK_ERROR(status, errorString);
+        keyTimes.append(MTime(timeValue, MTime::kFilm));
+        keyValues.append(value * conversionFactor);
     }
 
+    status = addKeys(fnCurve, keyTimes, keyValues);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
     return MS::kSuccess;
 }
 
@@ -1298,24 +1321,24 @@ MStatus DgNodeHelper::setVisAttrAnim(
     std::vector<double> times;
     usdAttr.GetTimeSamples(&times);
 
+    MTimeArray   keyTimes;
+    MDoubleArray keyValues;
+    keyTimes.setSizeIncrement(times.size());
+    keyValues.setSizeIncrement(times.size());
+
     TfToken value;
     for (auto const& timeValue : times) {
         const bool retValue = usdAttr.Get<TfToken>(&value, timeValue);
         if (!retValue)
             continue;
 
-        MTime tm(timeValue, MTime::kFilm);
-
-        fnCurve.addKey(
-            tm,
-            (value == UsdGeomTokens->invisible) ? 0 : 1,
-            MFnAnimCurve::kTangentGlobal,
-            MFnAnimCurve::kTangentGlobal,
-            NULL,
-            &status);
-        AL_MAYA_CHECK_ERROR(status, errorString);
+        keyTimes.append(MTime(timeValue, MTime::kFilm));
+        keyValues.append((value == UsdGeomTokens->invisible) ? 0 : 1);
     }
 
+    status = addKeys(fnCurve, keyTimes, keyValues);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
     return MS::kSuccess;
 }
 
@@ -1350,31 +1373,28 @@ MStatus DgNodeHelper::setClippingRangeAttrAnim(
     std::vector<double> times;
     usdAttr.GetTimeSamples(&times);
 
+    MTimeArray   keyTimes;
+    MDoubleArray nearValues;
+    MDoubleArray farValues;
+    keyTimes.setSizeIncrement(times.size());
+    nearValues.setSizeIncrement(times.size());
+    farValues.setSizeIncrement(times.size());
+
     GfVec2f clippingRange;
     for (auto const& timeValue : times) {
         if (!usdAttr.Get(&clippingRange, timeValue)) {
             continue;
         }
-        MTime tm(timeValue, MTime::kFilm);
-
-        fnCurveNear.addKey(
-            tm,
-            clippingRange[0],
-            MFnAnimCurve::kTangentGlobal,
-            MFnAnimCurve::kTangentGlobal,
-            NULL,
-            &status);
-        AL_MAYA_CHECK_ERROR(status, errorString);
-        fnCurveFar.addKey(
-            tm,
-            clippingRange[1],
-            MFnAnimCurve::kTangentGlobal,
-            MFnAnimCurve::kTangentGlobal,
-            NULL,
-            &status);
-        AL_MAYA_CHECK_ERROR(status, errorString);
+        keyTimes.append(MTime(timeValue, MTime::kFilm));
+        nearValues.append(clippingRange[0]);
+        farValues.append(clippingRange[1]);
     }
 
+    status = addKeys(fnCurveNear, keyTimes, nearValues);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+    status = addKeys(fnCurveFar, keyTimes, farValues);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
     return MS::kSuccess;
 }
 
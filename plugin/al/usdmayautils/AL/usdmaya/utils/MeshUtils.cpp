@@ -23,12 +23,14 @@
 #include <mayaUsdUtils/DebugCodes.h>
 #include <mayaUsdUtils/DiffCore.h>
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
 #include <maya/MGlobal.h>
 #include <maya/MItMeshPolygon.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace AL {
@@ -40,8 +42,32 @@ const TfToken displayColorToken("displayColor");
 const TfToken displayOpacityToken("displayOpacity");
 const TfToken primvarDisplayOpacityToken("primvars:displayOpacity");
 
+namespace {
+// Arrays with at least this many elements are converted in chunks across multiple threads. The
+// chunk size is a multiple of 8 so that every chunk except the last one stays on the SIMD path.
+constexpr size_t kParallelConversionThreshold = 64 * 1024;
+constexpr size_t kParallelConversionChunkSize = 16 * 1024;
+
 //----------------------------------------------------------------------------------------------------------------------
-void floatToDouble(double* output, const float* const input, size_t count)
+template <typename Fn> void forEachChunk(size_t count, Fn&& fn)
+{
+    if (count < kParallelConversionThreshold) {
+        fn(size_t(0), count);
+        return;
+    }
+    const size_t numChunks
+        = (count + kParallelConversionChunkSize - 1) / kParallelConversionChunkSize;
+    WorkParallelForN(numChunks, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk != last; ++chunk) {
+            const size_t begin = chunk * kParallelConversionChunkSize;
+            fn(begin, std::min(begin + kParallelConversionChunkSize, count));
+        }
+    });
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+static void floatToDoubleChunk(double* output, const float* const input, size_t count)
 {
     for (size_t i = 0; i < count; ++i) {
         output[i] = double(input[i]);
@@ -49,13 +75,29 @@ void floatToDouble(double* output, const float* const input, size_t count)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void doubleToFloat(float* output, const double* const input, size_t count)
+void floatToDouble(double* output, const float* const input, size_t count)
+{
+    forEachChunk(count, [&](size_t begin, size_t end) {
+        floatToDoubleChunk(output + begin, input + begin, end - begin);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void doubleToFloatChunk(float* output, const double* const input, size_t count)
 {
     for (size_t i = 0; i < count; ++i) {
         output[i] = float(input[i]);
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void doubleToFloat(float* output, const double* const input, size_t count)
+{
+    forEachChunk(count, [&](size_t begin, size_t end) {
+        doubleToFloatChunk(output + begin, input + begin, end - begin);
+    });
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 #if AL_UTILS_ENABLE_SIMD
 #if defined(__AVX2__)
@@ -135,7 +177,8 @@ static void convert3Dto4d(const float* const c, float* const output, uint32_t co
 #endif
 
 //----------------------------------------------------------------------------------------------------------------------
-void convert3DArrayTo4DArray(const float* const input, float* const output, size_t count)
+static void
+convert3DArrayTo4DArrayChunk(const float* const input, float* const output, size_t count)
 {
 #if AL_UTILS_ENABLE_SIMD
 #if defined(__AVX2__) && ENABLE_SOME_AVX_ROUTINES
@@ -183,6 +226,14 @@ void convert3DArrayTo4DArray(const float* const input, float* const output, size
 #endif
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void convert3DArrayTo4DArray(const float* const input, float* const output, size_t count)
+{
+    forEachChunk(count, [&](size_t begin, size_t end) {
+        convert3DArrayTo4DArrayChunk(input + 3 * begin, output + 4 * begin, end - begin);
+    });
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void MeshImportContext::gatherFaceConnectsAndVertices()
 {
@@ -434,7 +485,8 @@ void MeshImportContext::applyHoleFaces()
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void unzipUVs(const float* const uv, float* const u, float* const v, const size_t count)
+static void
+unzipUVsChunk(const float* const uv, float* const u, float* const v, const size_t count)
 {
 #if AL_UTILS_ENABLE_SIMD
 
@@ -492,6 +544,14 @@ void unzipUVs(const float* const uv, float* const u, float* const v, const size_
 #endif
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void unzipUVs(const float* const uv, float* const u, float* const v, const size_t count)
+{
+    forEachChunk(count, [&](size_t begin, size_t end) {
+        unzipUVsChunk(uv + 2 * begin, u + begin, v + begin, end - begin);
+    });
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool MeshImportContext::applyVertexNormals()
 {
@@ -1105,7 +1165,7 @@ bool isUvSetDataSparse(const int32_t* uvCounts, const uint32_t count)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void zipUVs(const float* u, const float* v, float* uv, const size_t count)
+static void zipUVsChunk(const float* u, const float* v, float* uv, const size_t count)
 {
 #if AL_UTILS_ENABLE_SIMD
 #ifdef __AVX2__
@@ -1164,6 +1224,14 @@ void zipUVs(const float* u, const float* v, float* uv, const size_t count)
 #endif
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void zipUVs(const float* u, const float* v, float* uv, const size_t count)
+{
+    forEachChunk(count, [&](size_t begin, size_t end) {
+        zipUVsChunk(u + begin, v + begin, uv + 2 * begin, end - begin);
+    });
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void MeshExportContext::copyUvSetData()
 {
@@ -1365,7 +1433,7 @@ void MeshExportContext::copyUvSetData()
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void interleaveIndexedUvData(
+static void interleaveIndexedUvDataChunk(
     float*         output,
     const float*   u,
     const float*   v,
@@ -1478,6 +1546,20 @@ void interleaveIndexedUvData(
 #endif
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void interleaveIndexedUvData(
+    float*         output,
+    const float*   u,
+    const float*   v,
+    const int32_t* indices,
+    const uint32_t numIndices)
+{
+    forEachChunk(numIndices, [&](size_t begin, size_t end) {
+        interleaveIndexedUvDataChunk(
+            output + 2 * begin, u, v, indices + begin, uint32_t(end - begin));
+    });
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Loops through each Colour Set in the mesh writing out a set of non-indexed Colour Values in RGBA
 // format, Writes out faceVarying values only Default RGB is 0.18 and alpha is 1.0 if there is no
@@ -36,6 +36,10 @@ namespace AL {
 namespace usdmaya {
 namespace utils {
 
+// The array conversion utilities below (floatToDouble, doubleToFloat, convert3DArrayTo4DArray,
+// unzipUVs, zipUVs and interleaveIndexedUvData) split large arrays into chunks that are converted
+// in parallel, so their input and output arrays must not overlap.
+
 /// \brief  a conversion utility that takes an array of floating point data, and converts it into
 /// double precision data \param  output the double precision output \param  input the input
 /// floating point data \param  count the number of elements in the array \note   the sizes of the
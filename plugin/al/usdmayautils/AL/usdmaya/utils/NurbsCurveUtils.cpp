@@ -18,6 +18,7 @@
 
 #include "AL/maya/utils/NodeHelper.h"
 #include "AL/usdmaya/utils/DgNodeHelper.h"
+#include "AL/usdmaya/utils/MeshUtils.h"
 #include "AL/usdmaya/utils/Utils.h"
 
 #include <mayaUsdUtils/DiffCore.h>
@@ -40,20 +41,6 @@ namespace AL {
 namespace usdmaya {
 namespace utils {
 
-//----------------------------------------------------------------------------------------------------------------------
-void convert3DFloatArrayTo4DDoubleArray(
-    const float* const input,
-    double* const      output,
-    size_t             count)
-{
-    for (size_t i = 0, j = 0, n = count * 4; i != n; i += 4, j += 3) {
-        output[i] = input[j];
-        output[i + 1] = input[j + 1];
-        output[i + 2] = input[j + 2];
-        output[i + 3] = 1.0;
-    }
-}
-
 //----------------------------------------------------------------------------------------------------------------------
 void copyPoints(const MFnNurbsCurve& fnCurve, const UsdAttribute& pointsAttr, UsdTimeCode time)
 {
@@ -141,10 +128,11 @@ void copyWidths(
 {
     VtArray<float> dataWidths;
     if (widthObj.apiType() == MFn::kDoubleArrayData) {
-        const uint32_t numElements = widthArray.length();
+        const MDoubleArray widths = widthArray.array();
+        const uint32_t     numElements = widths.length();
         dataWidths.resize(numElements);
-        for (uint32_t i = 0; i < numElements; ++i) {
-            dataWidths[i] = widthArray[i];
+        if (numElements) {
+            doubleToFloat(dataWidths.data(), &widths[0], numElements);
         }
         widthsAttr.Set(dataWidths);
     }
@@ -159,10 +147,11 @@ void copyWidths(
 {
     VtArray<float> dataWidths;
     if (widthObj.apiType() == MFn::kFloatArrayData) {
-        const uint32_t numElements = widthArray.length();
+        const MFloatArray widths = widthArray.array();
+        const uint32_t    numElements = widths.length();
         dataWidths.resize(numElements);
-        for (uint32_t i = 0; i < numElements; ++i) {
-            dataWidths[i] = widthArray[i];
+        if (numElements) {
+            memcpy(dataWidths.data(), &widths[0], sizeof(float) * numElements);
         }
         widthsAttr.Set(dataWidths);
     }
@@ -241,13 +230,32 @@ bool createMayaCurves(
         return false;
     }
 
+    // validate the counts of every curve up front, so the loop below can convert each curve's
+    // points and knots straight out of the USD arrays without any per-element bounds checks.
+    const size_t ncurves = dataCurveVertexCounts.size();
+    if (dataOrder.size() < ncurves) {
+        return false;
+    }
+    size_t totalPoints = 0;
+    size_t totalKnots = 0;
+    for (size_t i = 0; i < ncurves; ++i) {
+        if (dataCurveVertexCounts[i] < 1 || dataOrder[i] < 2) {
+            return false;
+        }
+        totalPoints += dataCurveVertexCounts[i];
+        totalKnots += dataCurveVertexCounts[i] + dataOrder[i] - 2;
+    }
+    if (totalPoints > dataPoints.size() || totalKnots > dataKnots.size()) {
+        return false;
+    }
+
     MPointArray  controlVertices;
     MDoubleArray knotSequences;
     MDoubleArray curveWidths;
 
     size_t currentPointIndex = 0;
     size_t currentKnotIndex = 0;
-    for (size_t i = 0, ncurves = dataCurveVertexCounts.size(); i < ncurves; ++i) {
+    for (size_t i = 0; i < ncurves; ++i) {
         const int32_t numPoints = dataCurveVertexCounts[i];
         controlVertices.setLength(numPoints);
 
@@ -261,8 +269,7 @@ bool createMayaCurves(
         currentPointIndex += numPoints;
         currentKnotIndex += numKnots;
 
-        AL::usdmaya::utils::convert3DFloatArrayTo4DDoubleArray(
-            pstart, (double*)&controlVertices[0], numPoints);
+        convert3DFloatArrayTo4DDoubleArray(pstart, (double*)&controlVertices[0], numPoints);
         fnCurve.create(
             controlVertices,
             knotSequences,
@@ -325,15 +332,14 @@ void copyNurbsCurveBindPoseData(
 
     if (pRefPrimVarAttr) {
         MStatus          status;
-        const uint32_t   numVertices = fnCurve.numCVs();
-        VtArray<GfVec3f> pref(numVertices);
-        MPointArray      points;
+        MPointArray points;
         status = fnCurve.getCVs(points, MSpace::kObject);
         if (status) {
-            for (uint32_t i = 0; i < numVertices; ++i) {
-                pref[i][0] = float(points[i].x);
-                pref[i][1] = float(points[i].y);
-                pref[i][2] = float(points[i].z);
+            const uint32_t   numVertices = points.length();
+            VtArray<GfVec3f> pref(numVertices);
+            if (numVertices) {
+                convertDoubleVec4ArrayToFloatVec3Array(
+                    (const double*)&points[0], (float*)pref.data(), numVertices);
             }
             pRefPrimVarAttr.Set(pref, time);
         } else {
@@ -357,6 +363,7 @@ uint32_t diffNurbsCurve(
         fnCurve.getCVs(controlVertices);
 
         VtArray<GfVec3f> dataPoints;
+        usdCurves.GetPointsAttr().Get(&dataPoints, timeCode);
 
         const size_t        numControlVertices = controlVertices.length();
         const size_t        numPoints = dataPoints.size();
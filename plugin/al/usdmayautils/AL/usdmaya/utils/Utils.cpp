@@ -18,6 +18,7 @@
 #include "AL/maya/utils/Utils.h"
 
 #include <mayaUsdUtils/DebugCodes.h>
+#include <mayaUsdUtils/SIMD.h>
 
 #include <maya/MDagPath.h>
 #include <maya/MEulerRotation.h>
@@ -128,13 +129,58 @@ void convertDoubleVec4ArrayToFloatVec3Array(
     float* const        output,
     size_t              count)
 {
-    for (size_t i = 0; i < count; ++i) {
+    size_t i = 0;
+#if AL_UTILS_ENABLE_SIMD
+    // each store writes 4 floats, the 4th of which is overwritten by the next point. The last point
+    // is handled by the scalar loop below so that nothing is written past the end of the output.
+    for (; i + 1 < count; ++i) {
+        const double* const dptr = input + i * 4;
+#if __AVX__
+        storeu4f(output + i * 3, cvt4d_to_4f(loadu4d(dptr)));
+#else
+        storeu4f(
+            output + i * 3, movelh4f(cvt2d_to_2f(loadu2d(dptr)), cvt2d_to_2f(loadu2d(dptr + 2))));
+#endif
+    }
+#endif
+    for (; i < count; ++i) {
         output[i * 3] = float(input[i * 4]);
         output[i * 3 + 1] = float(input[i * 4 + 1]);
         output[i * 3 + 2] = float(input[i * 4 + 2]);
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void convert3DFloatArrayTo4DDoubleArray(
+    const float* const input,
+    double* const      output,
+    size_t             count)
+{
+    size_t i = 0;
+#if AL_UTILS_ENABLE_SIMD
+    // each load reads 4 floats, the 4th of which belongs to the next point. The last point is
+    // handled by the scalar loop below so that nothing is read past the end of the input.
+    const f128 ones = splat4f(1.0f);
+    const f128 wmask = cast4f(set4i(0, 0, 0, -1));
+    for (; i + 1 < count; ++i) {
+        double* const dptr = output + i * 4;
+        const f128    point = select4f(loadu4f(input + i * 3), ones, wmask);
+#if __AVX__
+        storeu4d(dptr, cvt4f_to_4d(point));
+#else
+        storeu2d(dptr, cvt2f_to_2d(point));
+        storeu2d(dptr + 2, cvt2f_to_2d(movehl4f(point, point)));
+#endif
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i * 4] = input[i * 3];
+        output[i * 4 + 1] = input[i * 3 + 1];
+        output[i * 4 + 2] = input[i * 3 + 2];
+        output[i * 4 + 3] = 1.0;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 } // namespace utils
 } // namespace usdmaya
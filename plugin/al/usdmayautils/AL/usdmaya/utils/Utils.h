@@ -86,6 +86,18 @@ void convertDoubleVec4ArrayToFloatVec3Array(
     float* const        output,
     size_t              count);
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  a simple method to convert float vec3 array to double vec4 array, setting w to 1.0
+/// \param  the input float vec3 array
+/// \param  the output double vec4 array
+/// \param  count number of elements
+//----------------------------------------------------------------------------------------------------------------------
+AL_USDMAYA_UTILS_PUBLIC
+void convert3DFloatArrayTo4DDoubleArray(
+    const float* const input,
+    double* const      output,
+    size_t             count);
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  convert string types
 /// \param  token the USD TfToken to convert to an MString
@@ -15,6 +15,11 @@
 //
 #include "AL/usd/transaction/TransactionManager.h"
 
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/notice.h>
+
+#include <algorithm>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -61,6 +66,28 @@ void compareSpecViews(
     }
 }
 
+void compareProperties(
+    const SdfPropertySpecHandle& a,
+    const SdfPropertySpecHandle& b,
+    SdfPathVector&               output,
+    SdfPathVector&)
+{
+    const auto aFields = a->ListFields();
+    const auto bFields = b->ListFields();
+
+    if (aFields != bFields)
+        output.push_back(a->GetPath());
+    else {
+        /// Check field values
+        for (const auto& name : aFields) {
+            if (a->GetField(name) != b->GetField(name)) {
+                output.push_back(a->GetPath());
+                return;
+            }
+        }
+    }
+}
+
 void comparePrims(
     const SdfPrimSpecHandle& a,
     const SdfPrimSpecHandle& b,
@@ -71,29 +98,96 @@ void comparePrims(
     /// Compare children
     compareSpecViews(a->GetNameChildren(), b->GetNameChildren(), resynced, changed, comparePrims);
     // Compare properties
-    auto compareProps = [](const SdfPropertySpecHandle& a,
-                           const SdfPropertySpecHandle& b,
-                           SdfPathVector&               output,
-                           SdfPathVector&               extra) {
-        const auto aFields = a->ListFields();
-        const auto bFields = b->ListFields();
-
-        if (aFields != bFields)
-            output.push_back(a->GetPath());
-        else {
-            /// Check field values
-            for (const auto& name : aFields) {
-                if (a->GetField(name) != b->GetField(name)) {
-                    output.push_back(a->GetPath());
-                    return;
-                }
-            }
+    compareSpecViews(a->GetProperties(), b->GetProperties(), changed, resynced, compareProperties);
+}
+
+/// Compares the specs found at a path that was edited during the transaction. This gives the same
+/// results as comparing the whole layers, limited to the part of the hierarchy below that path.
+void compareAtPath(
+    const SdfLayerHandle& a,
+    const SdfLayerHandle& b,
+    SdfPath               path,
+    SdfPathVector&        resynced,
+    SdfPathVector&        changed)
+{
+    path = path.StripAllVariantSelections();
+    while (!path.IsAbsoluteRootOrPrimPath() && !path.IsPrimPropertyPath()) {
+        path = path.GetParentPath();
+    }
+
+    /// The topmost prim that exists on one side only is reported as resynced
+    const SdfPath primPath = path.GetPrimPath();
+    for (const SdfPath& prefix : primPath.GetPrefixes()) {
+        if (bool(a->GetPrimAtPath(prefix)) != bool(b->GetPrimAtPath(prefix))) {
+            resynced.push_back(prefix);
+            return;
+        }
+    }
+
+    if (path.IsPrimPropertyPath()) {
+        const SdfPropertySpecHandle aProp = a->GetPropertyAtPath(path);
+        const SdfPropertySpecHandle bProp = b->GetPropertyAtPath(path);
+        if (aProp && bProp) {
+            compareProperties(aProp, bProp, changed, resynced);
+        } else if (aProp || bProp) {
+            changed.push_back(path);
+        }
+    } else {
+        const SdfPrimSpecHandle aPrim = a->GetPrimAtPath(path);
+        const SdfPrimSpecHandle bPrim = b->GetPrimAtPath(path);
+        if (aPrim && bPrim) {
+            comparePrims(aPrim, bPrim, resynced, changed);
         }
-    };
-    compareSpecViews(a->GetProperties(), b->GetProperties(), changed, resynced, compareProps);
+    }
+}
+
+void sortAndRemoveDuplicates(SdfPathVector& paths)
+{
+    std::sort(paths.begin(), paths.end());
+    paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
 }
 } // anonymous namespace
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Records the paths edited in a layer while a transaction on it is open.
+//----------------------------------------------------------------------------------------------------------------------
+class TransactionManager::ChangeTracker : public TfWeakBase
+{
+public:
+    explicit ChangeTracker(const SdfLayerHandle& layer)
+        : m_layer(layer)
+    {
+        m_key = TfNotice::Register(TfCreateWeakPtr(this), &ChangeTracker::onLayersChanged, layer);
+    }
+
+    ~ChangeTracker() { TfNotice::Revoke(m_key); }
+
+    const SdfPathSet& paths() const { return m_paths; }
+
+private:
+    void onLayersChanged(const SdfNotice::LayersDidChangeSentPerLayer& notice)
+    {
+        for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+            if (layerAndChanges.first != m_layer) {
+                continue;
+            }
+            for (const auto& entry : layerAndChanges.second.GetEntryList()) {
+                if (entry.second.flags.didReplaceContent || entry.second.flags.didReloadContent) {
+                    m_paths.insert(SdfPath::AbsoluteRootPath());
+                }
+                m_paths.insert(entry.first);
+                if (!entry.second.oldPath.IsEmpty()) {
+                    m_paths.insert(entry.second.oldPath);
+                }
+            }
+        }
+    }
+
+    SdfLayerHandle m_layer;
+    SdfPathSet     m_paths;
+    TfNotice::Key  m_key;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 TransactionManager::StageManagerMap& TransactionManager::GetManagers()
 {
@@ -119,6 +213,7 @@ bool TransactionManager::Open(const SdfLayerHandle& layer)
             auto& base = pair.first->second.base;
             base = SdfLayer::CreateAnonymous("transaction_base");
             base->TransferContent(layer);
+            pair.first->second.tracker = std::make_shared<ChangeTracker>(layer);
             OpenNotice(layer).Send(m_stage);
         } else {
             ++pair.first->second.count;
@@ -136,12 +231,20 @@ bool TransactionManager::Close(const SdfLayerHandle& layer)
         auto it = m_transactions.find(get_pointer(layer));
         if (it != m_transactions.end()) {
             if (--it->second.count == 0) {
-                SdfPathVector changedInfo, resynched;
-                comparePrims(
-                    it->second.base->GetPseudoRoot(),
-                    layer->GetPseudoRoot(),
-                    resynched,
-                    changedInfo);
+                /// Only the edited paths are compared against the snapshot. A path below one
+                /// that was already compared is covered by that comparison.
+                SdfPathVector        changedInfo, resynched;
+                const SdfLayerHandle base = it->second.base;
+                SdfPath              lastCompared;
+                for (const SdfPath& path : it->second.tracker->paths()) {
+                    if (!lastCompared.IsEmpty() && path.HasPrefix(lastCompared)) {
+                        continue;
+                    }
+                    compareAtPath(base, layer, path, resynched, changedInfo);
+                    lastCompared = path;
+                }
+                sortAndRemoveDuplicates(changedInfo);
+                sortAndRemoveDuplicates(resynched);
                 CloseNotice(layer, std::move(changedInfo), std::move(resynched)).Send(m_stage);
                 m_transactions.erase(it);
             }
@@ -20,6 +20,8 @@
 #include <pxr/base/tf/weakPtr.h>
 #include <pxr/pxr.h>
 
+#include <memory>
+
 namespace AL {
 namespace usd {
 namespace transaction {
@@ -34,7 +36,9 @@ namespace transaction {
 ///         Whenever a new transaction (first one targeting given layer) is opened an OpenNotice is
 ///         being emitted and snapshot of given layer is taken. Whenever last transaction targeting
 ///         given layer for given stage is closed, targetted layer content is being compared against
-///         previously taken snapshot and CloseNotice is emitted with delta information.
+///         previously taken snapshot and CloseNotice is emitted with delta information. Only the
+///         paths edited in the layer while the transaction was open are compared, and the paths
+///         reported by the CloseNotice are sorted and free of duplicates.
 ///
 /// \note   It's user responsibilty to pair Open with Close calls, otherwise clients might not
 /// respond to any
@@ -130,10 +134,12 @@ private:
         : m_stage(stage)
     {
     }
+    class ChangeTracker;
     struct TransactionData
     {
-        PXR_NS::SdfLayerRefPtr base;
-        int                    count;
+        PXR_NS::SdfLayerRefPtr         base;
+        int                            count;
+        std::shared_ptr<ChangeTracker> tracker;
     };
     const PXR_NS::UsdStageWeakPtr                          m_stage;
     std::unordered_map<PXR_NS::SdfLayer*, TransactionData> m_transactions;
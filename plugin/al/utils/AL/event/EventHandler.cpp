@@ -279,6 +279,12 @@ bool EventScheduler::unregisterEvent(const char* const eventName)
 //----------------------------------------------------------------------------------------------------------------------
 EventDispatcher* EventScheduler::event(EventId eventId)
 {
+    // Ids are handed out as the lowest unused value, and the events are sorted by id, so unless
+    // events have been unregistered the event will be found directly at index (eventId - 1).
+    if (eventId && eventId <= m_registeredEvents.size()
+        && m_registeredEvents[eventId - 1].eventId() == eventId) {
+        return m_registeredEvents.data() + (eventId - 1);
+    }
     auto it = std::lower_bound(m_registeredEvents.begin(), m_registeredEvents.end(), eventId);
     if (it != m_registeredEvents.end()) {
         if (it->eventId() == eventId) {
@@ -291,6 +297,11 @@ EventDispatcher* EventScheduler::event(EventId eventId)
 //----------------------------------------------------------------------------------------------------------------------
 const EventDispatcher* EventScheduler::event(EventId eventId) const
 {
+    // same fast path as the non-const version above
+    if (eventId && eventId <= m_registeredEvents.size()
+        && m_registeredEvents[eventId - 1].eventId() == eventId) {
+        return m_registeredEvents.data() + (eventId - 1);
+    }
     auto it = std::lower_bound(m_registeredEvents.begin(), m_registeredEvents.end(), eventId);
     if (it != m_registeredEvents.end()) {
         if (it->eventId() == eventId) {
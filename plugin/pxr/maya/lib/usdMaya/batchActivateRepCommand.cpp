@@ -0,0 +1,105 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "usdMaya/batchActivateRepCommand.h"
+
+#include "usdMaya/referenceAssembly.h"
+
+#include <maya/MArgDatabase.h>
+#include <maya/MFnAssembly.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MGlobal.h>
+#include <maya/MSelectionList.h>
+#include <maya/MStringArray.h>
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/* static */
+MSyntax PxrMayaUSDBatchActivateRepCommand::createSyntax()
+{
+    MSyntax syntax;
+    syntax.addFlag(kRepresentationFlag, "-representation", MSyntax::kString);
+
+    syntax.useSelectionAsDefault(true);
+    syntax.setObjectType(MSyntax::kSelectionList, 0);
+
+    syntax.enableQuery(false);
+    syntax.enableEdit(false);
+
+    return syntax;
+}
+
+/* static */
+void* PxrMayaUSDBatchActivateRepCommand::creator()
+{
+    return new PxrMayaUSDBatchActivateRepCommand();
+}
+
+/* virtual */
+MStatus PxrMayaUSDBatchActivateRepCommand::doIt(const MArgList& args)
+{
+    MStatus      status;
+    MArgDatabase argData(syntax(), args, &status);
+    if (!status) {
+        return status;
+    }
+
+    if (!argData.isFlagSet(kRepresentationFlag)) {
+        displayError("The -representation flag is required.");
+        return MS::kFailure;
+    }
+    const MString rep = argData.flagArgumentString(kRepresentationFlag, 0);
+
+    MSelectionList objects;
+    status = argData.getObjects(objects);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
+    std::vector<MObject> assemblies;
+    for (unsigned int i = 0u; i < objects.length(); ++i) {
+        MObject obj;
+        if (!objects.getDependNode(i, obj)) {
+            continue;
+        }
+        MFnDependencyNode depNodeFn(obj);
+        if (depNodeFn.typeId() == UsdMayaReferenceAssembly::typeId) {
+            assemblies.push_back(obj);
+        }
+    }
+
+    UsdMayaReferenceAssembly::PrepareStages(assemblies);
+
+    // Creating the Maya nodes of the representations has to happen on the main thread.
+    MStringArray activated;
+    for (const MObject& assemObj : assemblies) {
+        MFnAssembly assemblyFn(assemObj);
+        if (!assemblyFn.canActivate() || assemblyFn.getActive() == rep) {
+            continue;
+        }
+        if (assemblyFn.activate(rep)) {
+            activated.append(assemblyFn.name());
+        } else {
+            displayWarning(
+                MString("Could not activate representation ") + rep + " on " + assemblyFn.name());
+        }
+    }
+
+    setResult(activated);
+
+    return MS::kSuccess;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,55 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_BATCH_ACTIVATE_REP_COMMAND_H
+#define PXRUSDMAYA_BATCH_ACTIVATE_REP_COMMAND_H
+
+/// \file usdMaya/batchActivateRepCommand.h
+
+#include "usdMaya/api.h"
+
+#include <pxr/pxr.h>
+
+#include <maya/MArgList.h>
+#include <maya/MPxCommand.h>
+#include <maya/MStatus.h>
+#include <maya/MSyntax.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Activates the same representation on many USD reference assemblies.
+///
+/// The USD stages of all the assemblies (given as arguments, or the active
+/// selection) are first opened in parallel, then the representations are
+/// activated one assembly after the other.
+class PxrMayaUSDBatchActivateRepCommand : public MPxCommand
+{
+public:
+    static constexpr auto kRepresentationFlag = "r";
+
+    PXRUSDMAYA_API
+    MStatus doIt(const MArgList& args) override;
+    bool    isUndoable() const override { return false; };
+
+    PXRUSDMAYA_API
+    static MSyntax createSyntax();
+
+    PXRUSDMAYA_API
+    static void* creator();
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -20,11 +20,119 @@
 #include <mayaUsd/render/pxrUsdMayaGL/debugCodes.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/layer.h>
+
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnMatrixData.h>
+#include <maya/MItEdits.h>
+
+#include <map>
+#include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+namespace {
+
+// What a prototype needs to reference the prim of an assembly. Instancers of the same library
+// asset, drawn with the same representation and variant selections, share one entry instead of
+// each pulling the stage of every assembly they instance.
+struct _PrototypeRefData
+{
+    SdfLayerHandle rootLayer;
+    SdfPath        primPath;
+    // Only used when the session layer has opinions on the prim.
+    bool                     useSessionLayer = false;
+    SdfLayerHandle           sessionLayer;
+    std::vector<std::string> sessionSubLayerIds;
+};
+
+std::map<std::string, _PrototypeRefData>& _GetPrototypeRefDataCache()
+{
+    static std::map<std::string, _PrototypeRefData> cache;
+    return cache;
+}
+
+// Builds the key of the assembly in the prototype cache, from the plugs which select the stage and
+// the session layer of the assembly. Returns an empty key for assemblies with assembly edits, as
+// their session layer is their own.
+std::string _GetPrototypeKey(MFnDependencyNode& assemblyFn, const MString& representation)
+{
+    MObject assemObj = assemblyFn.object();
+    if (!MItEdits(assemObj, assemObj).isDone()) {
+        return std::string();
+    }
+
+    std::string key = TfStringPrintf(
+        "%s\n%s\n%s\n%s",
+        assemblyFn.findPlug(UsdMayaReferenceAssembly::filePathAttr, true).asString().asChar(),
+        assemblyFn.findPlug(UsdMayaReferenceAssembly::primPathAttr, true).asString().asChar(),
+        assemblyFn.findPlug(UsdMayaReferenceAssembly::drawModeAttr, true).asString().asChar(),
+        representation.asChar());
+
+    for (unsigned int i = 0u; i < assemblyFn.attributeCount(); ++i) {
+        const MPlug attrPlug = assemblyFn.findPlug(assemblyFn.attribute(i), true);
+        if (attrPlug.isNull()) {
+            continue;
+        }
+        const std::string attrName(attrPlug.partialName().asChar());
+        if (TfStringStartsWith(attrName, UsdMayaVariantSetTokens->PlugNamePrefix)) {
+            key += TfStringPrintf("\n%s=%s", attrName.c_str(), attrPlug.asString().asChar());
+        }
+    }
+    return key;
+}
+
+bool _GetPrototypeRefData(
+    MFnDependencyNode&        assemblyFn,
+    UsdMayaReferenceAssembly* usdRefAssem,
+    const MString&            representation,
+    _PrototypeRefData*        refData)
+{
+    auto&             cache = _GetPrototypeRefDataCache();
+    const std::string key = _GetPrototypeKey(assemblyFn, representation);
+    if (!key.empty()) {
+        auto found = cache.find(key);
+        if (found != cache.end()) {
+            // The layers are kept alive by the stage cache, entries whose layers were released
+            // are rebuilt.
+            const _PrototypeRefData& cached = found->second;
+            if (cached.rootLayer && (!cached.useSessionLayer || cached.sessionLayer)) {
+                *refData = cached;
+                return true;
+            }
+            cache.erase(found);
+        }
+    }
+
+    UsdPrim prim = usdRefAssem->usdPrim();
+    if (!prim) {
+        return false;
+    }
+
+    refData->rootLayer = prim.GetStage()->GetRootLayer();
+    refData->primPath = prim.GetPath();
+    refData->useSessionLayer = false;
+    refData->sessionLayer = SdfLayerHandle();
+    refData->sessionSubLayerIds.clear();
+    if (SdfLayerHandle sessionLayer = prim.GetStage()->GetSessionLayer()) {
+        if (sessionLayer->GetPrimAtPath(refData->primPath)) {
+            refData->useSessionLayer = true;
+            refData->sessionLayer = sessionLayer;
+            const SdfSubLayerProxy subLayers = sessionLayer->GetSubLayerPaths();
+            refData->sessionSubLayerIds.assign(subLayers.begin(), subLayers.end());
+        }
+    }
+
+    if (!key.empty()) {
+        cache[key] = *refData;
+    }
+    return true;
+}
+
+} // namespace
+
 UsdMayaGL_InstancerShapeAdapterWithSceneAssembly::UsdMayaGL_InstancerShapeAdapterWithSceneAssembly(
     bool isViewport2)
     : UsdMayaGL_InstancerShapeAdapter(isViewport2)
@@ -74,19 +182,19 @@ void UsdMayaGL_InstancerShapeAdapterWithSceneAssembly::SyncInstancerPerPrototype
         return;
     }
 
-    if (usdRefAssem->getActive() == UsdMayaRepresentationFull::_assemblyType) {
+    const MString representation = usdRefAssem->getActive();
+    if (representation == UsdMayaRepresentationFull::_assemblyType) {
         return;
     }
 
-    UsdPrim prim = usdRefAssem->usdPrim();
-    if (!prim) {
+    _PrototypeRefData refData;
+    if (!_GetPrototypeRefData(sourceNode, usdRefAssem, representation, &refData)) {
         return;
     }
 
     // Add main reference data.
-    const std::string& layerId = prim.GetStage()->GetRootLayer()->GetIdentifier();
-    const SdfPath      primPath = prim.GetPath();
-    prototypeRefs.AddReference(SdfReference(layerId, primPath));
+    prototypeRefs.AddReference(
+        SdfReference(refData.rootLayer->GetIdentifier(), refData.primPath));
 
     // Reference session data.
     // We also mute any sublayers of the session layer, because those
@@ -96,14 +204,14 @@ void UsdMayaGL_InstancerShapeAdapterWithSceneAssembly::SyncInstancerPerPrototype
     // (Most session layers won't have sublayers; they only show up when
     // there's assembly edits in Collapsed/Expanded representations.)
     // XXX Handle assembly edits on instancer prototypes?
-    if (SdfLayerHandle sessionLayer = prim.GetStage()->GetSessionLayer()) {
-        if (sessionLayer->GetPrimAtPath(primPath)) {
-            prototypeRefs.AddReference(
-                SdfReference(sessionLayer->GetIdentifier(), primPath),
-                UsdListPositionFrontOfPrependList);
-            const SdfSubLayerProxy subLayers = sessionLayer->GetSubLayerPaths();
-            layerIdsToMute.insert(layerIdsToMute.end(), subLayers.begin(), subLayers.end());
-        }
+    if (refData.useSessionLayer) {
+        prototypeRefs.AddReference(
+            SdfReference(refData.sessionLayer->GetIdentifier(), refData.primPath),
+            UsdListPositionFrontOfPrependList);
+        layerIdsToMute.insert(
+            layerIdsToMute.end(),
+            refData.sessionSubLayerIds.begin(),
+            refData.sessionSubLayerIds.end());
     }
 
     // Also handles instancerTranslate.
@@ -35,10 +35,14 @@
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usd/timeCode.h>
@@ -73,7 +77,9 @@
 #include <maya/MViewport2Renderer.h>
 
 #include <map>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -90,6 +96,86 @@ TF_DEFINE_ENV_SETTING(
     false,
     "Enable bounding box rendering (slows refresh rate)");
 
+namespace {
+
+// Bounds of a prim whose subtree has no time-varying attribute, shared by all the proxies drawing
+// that prim of the same (cached) stage with the same purposes. An entry that is not static only
+// records that the prim has to go through the per-shape, per-time bounds of the base class.
+struct _SharedBounds
+{
+    UsdStageWeakPtr stage;
+    MBoundingBox    bbox;
+    bool            isStatic = false;
+};
+
+using _SharedBoundsKey = std::tuple<const UsdStage*, SdfPath, int>;
+
+class _SharedBoundsCache : public TfWeakBase
+{
+public:
+    static _SharedBoundsCache& Get()
+    {
+        static _SharedBoundsCache cache;
+        return cache;
+    }
+
+    bool Find(const _SharedBoundsKey& key, _SharedBounds* bounds) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        found = _bounds.find(key);
+        // A stage created at the address of a destroyed one must not reuse its bounds.
+        if (found == _bounds.end() || !found->second.stage) {
+            return false;
+        }
+        *bounds = found->second;
+        return true;
+    }
+
+    void Insert(const _SharedBoundsKey& key, const _SharedBounds& bounds)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _bounds[key] = bounds;
+    }
+
+private:
+    _SharedBoundsCache()
+    {
+        TfNotice::Register(TfCreateWeakPtr(this), &_SharedBoundsCache::_OnObjectsChanged);
+    }
+
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+    {
+        // Any edit drops the entries of the stage, the next bounds query rebuilds them.
+        const UsdStage*             stage = get_pointer(notice.GetStage());
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto it = _bounds.begin(); it != _bounds.end();) {
+            if (std::get<0>(it->first) == stage) {
+                it = _bounds.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    mutable std::mutex                        _mutex;
+    std::map<_SharedBoundsKey, _SharedBounds> _bounds;
+};
+
+bool _SubtreeMightBeTimeVarying(const UsdPrim& root)
+{
+    for (const UsdPrim& prim :
+         UsdPrimRange(root, UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate))) {
+        for (const UsdAttribute& attr : prim.GetAttributes()) {
+            if (attr.ValueMightBeTimeVarying()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 UsdMayaProxyShape::ObjectSoftSelectEnabledDelegate
     UsdMayaProxyShape::_sharedObjectSoftSelectEnabledDelegate
     = nullptr;
@@ -215,7 +301,33 @@ MBoundingBox UsdMayaProxyShape::boundingBox() const
         return UsdMayaUtil::GetInfiniteBoundingBox();
     }
 
-    return ParentClass::boundingBox();
+    // Proxies of the same asset share a stage through the stage cache, so the bounds of assets
+    // which don't animate are only computed once, for all of those proxies and all times.
+    const UsdPrim prim = usdPrim();
+    if (!prim) {
+        return ParentClass::boundingBox();
+    }
+
+    bool drawRenderPurpose = false;
+    bool drawProxyPurpose = true;
+    bool drawGuidePurpose = false;
+    getDrawPurposeToggles(&drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
+    const int purposes = (drawRenderPurpose ? 1 : 0) | (drawProxyPurpose ? 2 : 0)
+        | (drawGuidePurpose ? 4 : 0);
+
+    const _SharedBoundsKey key(get_pointer(prim.GetStage()), prim.GetPath(), purposes);
+    _SharedBoundsCache&    cache = _SharedBoundsCache::Get();
+    _SharedBounds          bounds;
+    if (cache.Find(key, &bounds)) {
+        return bounds.isStatic ? bounds.bbox : ParentClass::boundingBox();
+    }
+
+    bounds.stage = prim.GetStage();
+    bounds.bbox = ParentClass::boundingBox();
+    bounds.isStatic = !_SubtreeMightBeTimeVarying(prim);
+    cache.Insert(key, bounds);
+
+    return bounds.bbox;
 }
 
 /* virtual */
@@ -30,6 +30,7 @@
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/registryManager.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/editTarget.h>
@@ -65,6 +66,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -583,6 +585,37 @@ static std::set<std::string> _GetVariantSetNamesForStageCache(const MFnDependenc
     return varSetNames;
 }
 
+// Returns the session layer shared by the assemblies of the same model with the same variant
+// selections and draw mode.
+static SdfLayerRefPtr
+_GetSharedSessionLayer(const MFnDependencyNode& depNodeFn, const SdfLayerRefPtr& rootLayer)
+{
+    std::map<std::string, std::string> varSels;
+    TfToken                            modelName = UsdUtilsGetModelNameFromRootLayer(rootLayer);
+    const std::set<std::string> varSetNamesForCache = _GetVariantSetNamesForStageCache(depNodeFn);
+    TF_FOR_ALL(variantSet, varSetNamesForCache)
+    {
+        MString variantSetPlugName(UsdMayaVariantSetTokens->PlugNamePrefix.GetText());
+        variantSetPlugName += variantSet->c_str();
+        MPlug varSetPlg = depNodeFn.findPlug(variantSetPlugName, true);
+        if (!varSetPlg.isNull()) {
+            MString varSetVal = varSetPlg.asString();
+            if (varSetVal.length() > 0) {
+                varSels[*variantSet] = varSetVal.asChar();
+            }
+        }
+    }
+
+    TfToken drawMode;
+    MPlug   drawModePlug = depNodeFn.findPlug(UsdMayaReferenceAssembly::drawModeAttr, true);
+    if (!drawModePlug.isNull()) {
+        drawMode = TfToken(drawModePlug.asString().asChar());
+    }
+
+    return UsdMayaStageCache::GetSharedSessionLayer(
+        SdfPath::AbsoluteRootPath().AppendChild(modelName), varSels, drawMode);
+}
+
 MStatus UsdMayaReferenceAssembly::computeInStageDataCached(MDataBlock& dataBlock)
 {
     MStatus retValue = MS::kSuccess;
@@ -622,31 +655,7 @@ MStatus UsdMayaReferenceAssembly::computeInStageDataCached(MDataBlock& dataBlock
         MFnDagNode dagNodeFn(thisMObject());
 
         if (SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(fileString)) {
-            std::map<std::string, std::string> varSels;
-            TfToken                     modelName = UsdUtilsGetModelNameFromRootLayer(rootLayer);
-            const std::set<std::string> varSetNamesForCache
-                = _GetVariantSetNamesForStageCache(dagNodeFn);
-            TF_FOR_ALL(variantSet, varSetNamesForCache)
-            {
-                MString variantSetPlugName(UsdMayaVariantSetTokens->PlugNamePrefix.GetText());
-                variantSetPlugName += variantSet->c_str();
-                MPlug varSetPlg = dagNodeFn.findPlug(variantSetPlugName, true);
-                if (!varSetPlg.isNull()) {
-                    MString varSetVal = varSetPlg.asString();
-                    if (varSetVal.length() > 0) {
-                        varSels[*variantSet] = varSetVal.asChar();
-                    }
-                }
-            }
-
-            TfToken drawMode;
-            MPlug   drawModePlug = dagNodeFn.findPlug(drawModeAttr, true);
-            if (!drawModePlug.isNull()) {
-                drawMode = TfToken(drawModePlug.asString().asChar());
-            }
-
-            SdfLayerRefPtr sessionLayer = UsdMayaStageCache::GetSharedSessionLayer(
-                SdfPath::AbsoluteRootPath().AppendChild(modelName), varSels, drawMode);
+            SdfLayerRefPtr sessionLayer = _GetSharedSessionLayer(dagNodeFn, rootLayer);
 
             // If we have assembly edits, do not share session layers with
             // other models that have our same set of variant selections,
@@ -714,6 +723,78 @@ MStatus UsdMayaReferenceAssembly::computeInStageDataCached(MDataBlock& dataBlock
     return MS::kSuccess;
 }
 
+/* static */
+void UsdMayaReferenceAssembly::PrepareStages(const std::vector<MObject>& assemblies)
+{
+    // Gather the root layer files of the assemblies that will open a shared stage from their
+    // file path. Assemblies fed by a stage connection or that carry edits are left alone.
+    std::vector<MObject>     candidates;
+    std::vector<std::string> fileStrings;
+    for (const MObject& assemObj : assemblies) {
+        MFnDependencyNode depNodeFn(assemObj);
+        if (depNodeFn.typeId() != typeId) {
+            continue;
+        }
+
+        MPlug inStageDataPlug = depNodeFn.findPlug(inStageDataAttr, true);
+        if (inStageDataPlug.isConnected() || !_GetEdits(assemObj).isDone()) {
+            continue;
+        }
+
+        std::string fileString
+            = TfStringTrimRight(depNodeFn.findPlug(filePathAttr, true).asString().asChar());
+        if (!fileString.empty()) {
+            candidates.push_back(assemObj);
+            fileStrings.push_back(fileString);
+        }
+    }
+
+    // Opening the root layers is where most of the time goes, and it is independent per file.
+    std::vector<SdfLayerRefPtr> rootLayers(fileStrings.size());
+    WorkParallelForN(fileStrings.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            rootLayers[i] = SdfLayer::FindOrOpen(fileStrings[i]);
+        }
+    });
+
+    // The shared session layers are looked up from Maya plugs, so this part stays serial.
+    UsdStageCache& stageCache = UsdMayaStageCache::Get(
+        UsdStage::InitialLoadSet::LoadAll, UsdMayaStageCache::ShareMode::Shared);
+    const ArResolverContext resolverContext = ArGetResolver().GetCurrentContext();
+
+    std::vector<std::pair<SdfLayerRefPtr, SdfLayerRefPtr>> layersToOpen;
+    std::set<std::pair<const SdfLayer*, const SdfLayer*>>  seenLayers;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (!rootLayers[i]) {
+            continue;
+        }
+
+        MFnDependencyNode depNodeFn(candidates[i]);
+        SdfLayerRefPtr    sessionLayer = _GetSharedSessionLayer(depNodeFn, rootLayers[i]);
+        if (!seenLayers.emplace(get_pointer(rootLayers[i]), get_pointer(sessionLayer)).second
+            || stageCache.FindOneMatching(rootLayers[i], sessionLayer, resolverContext)) {
+            continue;
+        }
+        layersToOpen.emplace_back(rootLayers[i], sessionLayer);
+    }
+
+    // Open the missing stages concurrently and hand them to the shared cache, so that computing
+    // the assemblies finds them there instead of opening them one by one.
+    std::vector<UsdStageRefPtr> stages(layersToOpen.size());
+    WorkParallelForN(layersToOpen.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            stages[i] = UsdStage::Open(
+                layersToOpen[i].first, layersToOpen[i].second, resolverContext);
+        }
+    });
+
+    for (const UsdStageRefPtr& stage : stages) {
+        if (stage) {
+            stageCache.Insert(stage);
+        }
+    }
+}
+
 MStatus UsdMayaReferenceAssembly::computeOutStageData(MDataBlock& dataBlock)
 {
     MStatus retValue = MS::kSuccess;
@@ -211,6 +211,15 @@ public:
     PXRUSDMAYA_API
     void DisconnectAssemblyTimeFromMayaTime();
 
+    /// Opens, in parallel, the shared USD stages that the given assemblies
+    /// will use and adds them to the UsdMayaStageCache.
+    ///
+    /// Activating the representations of many assemblies afterwards then
+    /// finds their stages (and layers) already loaded instead of opening them
+    /// one by one.
+    PXRUSDMAYA_API
+    static void PrepareStages(const std::vector<MObject>& assemblies);
+
 private:
     friend class UsdMayaRepresentationBase;
 
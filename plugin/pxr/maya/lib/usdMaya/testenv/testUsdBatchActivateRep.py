@@ -0,0 +1,142 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import mayaUsd.lib as mayaUsdLib
+
+from maya import cmds
+from maya import standalone
+
+import os
+import unittest
+
+
+class testUsdBatchActivateRep(unittest.TestCase):
+    """
+    Activate the representations of several USD reference assembly nodes with
+    the usdBatchActivateRep command.
+    """
+
+    ASSEMBLY_TYPE_NAME = 'pxrUsdReferenceAssembly'
+    PROXY_TYPE_NAME = 'pxrUsdProxyShape'
+    TRANSFORM_TYPE_NAME = 'transform'
+
+    @classmethod
+    def setUpClass(cls):
+        standalone.initialize('usd')
+        cmds.loadPlugin('pxrUsd', quiet=True)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        usdFile = os.path.abspath('CubeModel.usda')
+        self.assemblies = []
+        for name in ('AssemblyA', 'AssemblyB', 'AssemblyC'):
+            assemblyNode = cmds.assembly(name=name, type=self.ASSEMBLY_TYPE_NAME)
+            cmds.setAttr('%s.filePath' % assemblyNode, usdFile, type='string')
+            cmds.setAttr('%s.primPath' % assemblyNode, '/CubeModel', type='string')
+            self.assemblies.append(assemblyNode)
+
+    def _GetChildren(self, nodeName):
+        return cmds.ls('%s|*' % nodeName, recursive=True)
+
+    def _ValidateUnloaded(self, nodeName):
+        self.assertEqual(cmds.assembly(nodeName, query=True, active=True), '')
+        self.assertEqual(self._GetChildren(nodeName), [])
+
+    def _ValidateCollapsed(self, nodeName):
+        self.assertEqual(cmds.assembly(nodeName, query=True, active=True), 'Collapsed')
+        childNodes = self._GetChildren(nodeName)
+        self.assertEqual(len(childNodes), 1)
+        self.assertTrue(childNodes[0].endswith('CollapsedProxy'))
+        self.assertEqual(cmds.nodeType(childNodes[0]), self.PROXY_TYPE_NAME)
+
+    def _ValidateExpanded(self, nodeName):
+        self.assertEqual(cmds.assembly(nodeName, query=True, active=True), 'Expanded')
+        childNodes = self._GetChildren(nodeName)
+        self.assertEqual(len(childNodes), 1)
+        self.assertTrue(childNodes[0].endswith('Geom'))
+        self.assertEqual(cmds.nodeType(childNodes[0]), self.TRANSFORM_TYPE_NAME)
+
+        proxyNodes = self._GetChildren(childNodes[0])
+        self.assertEqual(len(proxyNodes), 1)
+        self.assertTrue(proxyNodes[0].endswith('GeomProxy'))
+        self.assertEqual(cmds.nodeType(proxyNodes[0]), self.PROXY_TYPE_NAME)
+
+    def _ValidateSharedStage(self, nodeNames):
+        """
+        The assemblies reference the same file without edits, so they all use
+        the stage that was opened once for the batch.
+        """
+        prims = [mayaUsdLib.GetPrim(nodeName) for nodeName in nodeNames]
+        for prim in prims:
+            self.assertTrue(prim)
+            self.assertEqual(prim.GetPath(), '/CubeModel')
+            self.assertTrue(prim.GetStage().GetPrimAtPath('/CubeModel/Geom/Cube'))
+        for prim in prims[1:]:
+            self.assertEqual(prim.GetStage(), prims[0].GetStage())
+
+    def testExplicitAssemblies(self):
+        assemblyA, assemblyB, assemblyC = self.assemblies
+
+        activated = cmds.usdBatchActivateRep(assemblyA, assemblyB,
+            representation='Collapsed')
+        self.assertEqual(activated, [assemblyA, assemblyB])
+        self._ValidateCollapsed(assemblyA)
+        self._ValidateCollapsed(assemblyB)
+        self._ValidateUnloaded(assemblyC)
+        self._ValidateSharedStage([assemblyA, assemblyB])
+
+        # The assemblies already in the representation are not activated again.
+        activated = cmds.usdBatchActivateRep(assemblyA, assemblyB, assemblyC,
+            representation='Collapsed')
+        self.assertEqual(activated, [assemblyC])
+        self._ValidateSharedStage(self.assemblies)
+
+        activated = cmds.usdBatchActivateRep(assemblyA, assemblyB, assemblyC,
+            representation='Expanded')
+        self.assertEqual(activated, self.assemblies)
+        for assemblyNode in self.assemblies:
+            self._ValidateExpanded(assemblyNode)
+
+    def testSelection(self):
+        assemblyA, assemblyB, assemblyC = self.assemblies
+
+        # Nodes other than the USD reference assemblies are ignored.
+        otherNode = cmds.createNode('transform', name='NotAnAssembly')
+        cmds.select(assemblyB, otherNode, assemblyC)
+
+        activated = cmds.usdBatchActivateRep(representation='Collapsed')
+        self.assertEqual(activated, [assemblyB, assemblyC])
+        self._ValidateUnloaded(assemblyA)
+        self._ValidateCollapsed(assemblyB)
+        self._ValidateCollapsed(assemblyC)
+        self._ValidateSharedStage([assemblyB, assemblyC])
+        self.assertEqual(self._GetChildren(otherNode), [])
+
+    def testMissingRepresentation(self):
+        with self.assertRaises(RuntimeError):
+            cmds.usdBatchActivateRep(*self.assemblies)
+        for assemblyNode in self.assemblies:
+            self._ValidateUnloaded(assemblyNode)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include "usdMaya/batchActivateRepCommand.h"
 #include "usdMaya/exportCommand.h"
 #include "usdMaya/exportTranslator.h"
 #include "usdMaya/importCommand.h"
@@ -132,6 +133,14 @@ MStatus initializePlugin(MObject obj)
         status.perror("registerCommand usdListShadingModes");
     }
 
+    status = plugin.registerCommand(
+        "usdBatchActivateRep",
+        PxrMayaUSDBatchActivateRepCommand::creator,
+        PxrMayaUSDBatchActivateRepCommand::createSyntax);
+    if (!status) {
+        status.perror("registerCommand usdBatchActivateRep");
+    }
+
     status = UsdMayaUndoHelperCommand::initialize(plugin);
     if (!status) {
         status.perror(
@@ -217,6 +226,11 @@ MStatus uninitializePlugin(MObject obj)
         status.perror("deregisterCommand usdListShadingModes");
     }
 
+    status = plugin.deregisterCommand("usdBatchActivateRep");
+    if (!status) {
+        status.perror("deregisterCommand usdBatchActivateRep");
+    }
+
     status = UsdMayaUndoHelperCommand::finalize(plugin);
     if (!status) {
         status.perror(
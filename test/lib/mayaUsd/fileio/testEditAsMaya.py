@@ -362,6 +362,65 @@ class EditAsMayaTestCase(unittest.TestCase):
         self.assertEqual('', icon.baseIcon)
         self.assertEqual(ufe.UIInfoHandler.Disabled, icon.mode)
 
+    def testEditAsMayaMultiplePrims(self):
+        '''Edit several USD transforms as Maya objects with one command, and undo and redo.'''
+
+        (ps, aXlateOp, aXlation, aUsdUfePathStr, aUsdUfePath, aUsdItem,
+         _, _, _, _, _) = createSimpleXformScene()
+
+        stage = aXlateOp.GetAttr().GetStage()
+        cXlation = Gf.Vec3d(4, 5, 6)
+        UsdGeom.Xformable(stage.DefinePrim('/C', 'Xform')).AddTranslateOp().Set(cXlation)
+        cUsdUfePathStr = aUsdUfePathStr[:-len('/A')] + '/C'
+
+        usdPathStrs = [aUsdUfePathStr, cUsdUfePathStr]
+        prims = [mayaUsd.ufe.ufePathToPrim(p) for p in usdPathStrs]
+
+        cmds.mayaUsdEditAsMaya(*usdPathStrs)
+
+        # Both edited Maya objects are selected.
+        mayaPathStrs = cmds.ls(sl=True, ufe=True, long=True)
+        self.assertEqual(len(mayaPathStrs), 2)
+
+        def verifyEditedScene():
+            for prim, mayaPathStr, xlation in zip(prims, mayaPathStrs, [aXlation, cXlation]):
+                # The pull information of each prim is its own Maya object, with
+                # its translation.
+                self.assertEqual(
+                    mayaUsd.lib.PrimUpdaterManager.readPullInformation(prim), mayaPathStr)
+                dagPath = om.MSelectionList().add(mayaPathStr).getDagPath(0)
+                self.assertEqual(
+                    om.MFnTransform(dagPath).translation(om.MSpace.kObject), om.MVector(*xlation))
+
+        def verifyNoLongerEdited():
+            for prim, mayaPathStr in zip(prims, mayaPathStrs):
+                with self.assertRaises(RuntimeError):
+                    om.MSelectionList().add(mayaPathStr)
+                self.assertEqual(len(mayaUsd.lib.PrimUpdaterManager.readPullInformation(prim)), 0)
+
+        verifyEditedScene()
+
+        # All the prims edited by the command are undone and redone together.
+        cmds.undo()
+        verifyNoLongerEdited()
+
+        cmds.redo()
+        verifyEditedScene()
+
+    def testCannotEditAsMayaMultipleAncestor(self):
+        '''Test that editing a prim and its ancestor with one command is not allowed.'''
+
+        (ps, _, _, aUsdUfePathStr, _, _,
+         _, _, bUsdUfePathStr, _, _) = createSimpleXformScene()
+
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUsdEditAsMaya(aUsdUfePathStr, bUsdUfePathStr)
+
+        # Neither prim is edited.
+        for usdUfePathStr in [aUsdUfePathStr, bUsdUfePathStr]:
+            prim = mayaUsd.ufe.ufePathToPrim(usdUfePathStr)
+            self.assertEqual(len(mayaUsd.lib.PrimUpdaterManager.readPullInformation(prim)), 0)
+
     def testIllegalEditAsMaya(self):
         '''Trying to edit as Maya on object that doesn't support it.'''
         
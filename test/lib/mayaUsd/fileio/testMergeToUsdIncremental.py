@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+
+from mayaUtils import setMayaTranslation
+from usdUtils import createSimpleXformScene
+from ufeUtils import ufeFeatureSetVersion
+
+import mayaUsd.lib
+import mayaUtils
+
+from pxr import Gf
+
+from maya import cmds
+from maya import standalone
+from maya.api import OpenMaya as om
+
+import ufe
+
+import unittest
+
+class MergeToUsdIncrementalTestCase(unittest.TestCase):
+    '''Test the incremental merge to USD, enabled by MAYAUSD_INCREMENTAL_MERGE_TO_USD: only the
+    prims of the Maya nodes changed since the edit as Maya are merged back to USD.
+
+    The USD translations are changed in the layer while the prims are edited as Maya. The merge
+    overwrites them with the Maya values for the merged prims only.
+    '''
+
+    pluginsLoaded = False
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+    def _editAsMaya(self):
+        '''Edit /A as Maya and change the USD translations of /A and /A/B in the layer.'''
+        (ps, aXlateOp, _, aUsdUfePathStr, _, _, _, _, _, _, _) = createSimpleXformScene()
+        with mayaUsd.lib.OpUndoItemList():
+            self.assertTrue(mayaUsd.lib.PrimUpdaterManager.editAsMaya(aUsdUfePathStr))
+
+        layer = aXlateOp.GetAttr().GetStage().GetEditTarget().GetLayer()
+        for path in ('/A.xformOp:translate', '/A/B.xformOp:translate'):
+            layer.GetAttributeAtPath(path).default = Gf.Vec3d(-1, -1, -1)
+
+        aMayaPathStr = ufe.PathString.string(ufe.GlobalSelection.get().front().path())
+        return (layer, aMayaPathStr)
+
+    def _getTranslation(self, layer, path):
+        return layer.GetAttributeAtPath(path + '.xformOp:translate').default
+
+    @unittest.skipUnless(ufeFeatureSetVersion() >= 3, 'Test only available in UFE v3 or greater.')
+    def testMergeChangedPrims(self):
+        '''Only the prim of the moved node is merged.'''
+        (layer, aMayaPathStr) = self._editAsMaya()
+
+        bMayaItem = ufe.Hierarchy.createItem(ufe.PathString.path(aMayaPathStr + '|B'))
+        setMayaTranslation(bMayaItem, om.MVector(10, 11, 12))
+
+        with mayaUsd.lib.OpUndoItemList():
+            self.assertTrue(mayaUsd.lib.PrimUpdaterManager.mergeToUsd(aMayaPathStr))
+
+        self.assertEqual(self._getTranslation(layer, '/A/B'), Gf.Vec3d(10, 11, 12))
+        self.assertEqual(self._getTranslation(layer, '/A'), Gf.Vec3d(-1, -1, -1))
+
+    @unittest.skipUnless(ufeFeatureSetVersion() >= 3, 'Test only available in UFE v3 or greater.')
+    def testMergeUnchangedPrims(self):
+        '''Nothing is merged when nothing changed.'''
+        (layer, aMayaPathStr) = self._editAsMaya()
+
+        with mayaUsd.lib.OpUndoItemList():
+            self.assertTrue(mayaUsd.lib.PrimUpdaterManager.mergeToUsd(aMayaPathStr))
+
+        self.assertEqual(self._getTranslation(layer, '/A'), Gf.Vec3d(-1, -1, -1))
+        self.assertEqual(self._getTranslation(layer, '/A/B'), Gf.Vec3d(-1, -1, -1))
+
+    @unittest.skipUnless(ufeFeatureSetVersion() >= 3, 'Test only available in UFE v3 or greater.')
+    def testMergeStructuralChange(self):
+        '''A node added to the edited hierarchy makes the merge a full one.'''
+        (layer, aMayaPathStr) = self._editAsMaya()
+
+        cmds.createNode('transform', name='C', parent=aMayaPathStr)
+
+        with mayaUsd.lib.OpUndoItemList():
+            self.assertTrue(mayaUsd.lib.PrimUpdaterManager.mergeToUsd(aMayaPathStr))
+
+        self.assertEqual(self._getTranslation(layer, '/A'), Gf.Vec3d(1, 2, 3))
+        self.assertEqual(self._getTranslation(layer, '/A/B'), Gf.Vec3d(7, 8, 9))
+        self.assertTrue(layer.GetPrimAtPath('/A/C'))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
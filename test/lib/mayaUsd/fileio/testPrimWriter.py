@@ -64,6 +64,38 @@ class primWriterTest(mayaUsdLib.PrimWriter):
     def PostExport(self):
         primWriterTest.PostExportCalled = True
 
+class batchPrimWriterTest(mayaUsdLib.PrimWriter):
+    WriteTimes = []
+    BatchSizes = []
+
+    def __init__(self, *args, **kwargs):
+        super(batchPrimWriterTest, self).__init__(*args, **kwargs)
+        primSchema = UsdGeom.Sphere.Define(self.GetUsdStage(), self.GetUsdPath())
+        self._SetUsdPrim(primSchema.GetPrim())
+
+    def Write(self, usdTime):
+        batchPrimWriterTest.WriteTimes.append(usdTime)
+
+    @classmethod
+    def WriteBatch(cls, writers, usdTime):
+        cls.BatchSizes.append(len(writers))
+        for writer in writers:
+            writer.GetUsdPrim().GetAttribute('radius').Set(usdTime.GetValue(), usdTime)
+
+class staticPrimWriterTest(mayaUsdLib.PrimWriter):
+    WriteTimes = []
+
+    def __init__(self, *args, **kwargs):
+        super(staticPrimWriterTest, self).__init__(*args, **kwargs)
+        primSchema = UsdGeom.Cube.Define(self.GetUsdStage(), self.GetUsdPath())
+        self._SetUsdPrim(primSchema.GetPrim())
+
+    def IsAnimated(self):
+        return False
+
+    def Write(self, usdTime):
+        staticPrimWriterTest.WriteTimes.append(usdTime)
+
 class testReadWriteUtils(unittest.TestCase):
     @classmethod
     def setUpClass(cls):
@@ -91,5 +123,29 @@ class testReadWriteUtils(unittest.TestCase):
         self.assertTrue(primWriterTest.WriteCalled)
         self.assertTrue(primWriterTest.PostExportCalled)
 
+    def testBatchAndStaticPrimWriters(self):
+        mayaUsdLib.PrimWriter.Register(batchPrimWriterTest, "locator")
+        mayaUsdLib.PrimWriter.Register(staticPrimWriterTest, "camera")
+
+        for i in range(3):
+            cmds.spaceLocator(name='loc%d' % i)
+        cmds.camera(name='cam')
+
+        usdFilePath = os.path.join(self.temp_dir,'testPrimWriterBatchExport.usda')
+        cmds.usdExport(mergeTransformAndShape=True,
+            file=usdFilePath,
+            frameRange=(1, 4),
+            shadingMode='none')
+
+        # Write() is only called at the default time, WriteBatch() once per frame for all the
+        # locators.
+        self.assertEqual(len(batchPrimWriterTest.WriteTimes), 3)
+        self.assertTrue(all(t.IsDefault() for t in batchPrimWriterTest.WriteTimes))
+        self.assertEqual(batchPrimWriterTest.BatchSizes, [3, 3, 3, 3])
+
+        # The writers which are not animated are not called at the time samples.
+        self.assertEqual(len(staticPrimWriterTest.WriteTimes), 1)
+        self.assertTrue(staticPrimWriterTest.WriteTimes[0].IsDefault())
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -618,6 +618,83 @@ class testProxyShapeBase(unittest.TestCase):
         # check that the expected load rules are still on the stage.
         check_load_rules(stage)
 
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testLoadRulesSavedWithScene only available in UFE v2 or greater.')
+    def testLoadRulesSavedWithScene(self):
+        '''
+        Verify that the load rules recorded in memory are read from the proxy shape attribute and
+        written with the scene.
+        '''
+        # open a scene with payload
+        cmds.file(new=True, force=True)
+        mayaUtils.openTopLayerScene()
+        tempMayaFile = os.path.join(
+            tempfile.mkdtemp(prefix='ProxyShapeBaseTest'), 'LoadRulesScene.ma')
+        cmds.file(rename=tempMayaFile)
+        cmds.file(save=True, force=True, type='mayaAscii')
+        self.assertFalse(cmds.file(query=True, modified=True))
+
+        proxyShapePath = cmds.ls(type="mayaUsdProxyShapeBase", long=True)[0]
+        roomPath = ufe.Path([
+            mayaUtils.createUfePathSegment("|transform1|proxyShape1"),
+            usdUtils.createUfePathSegment("/Room_set")])
+        contextOps = ufe.ContextOps.contextOps(ufe.Hierarchy.createItem(roomPath))
+
+        # unloading the room marks the scene as modified and the attribute reads the rules.
+        cmd = contextOps.doOpCmd(['Unload'])
+        cmd.execute()
+        self.assertTrue(cmds.file(query=True, modified=True))
+        self.assertEqual(
+            cmds.getAttr('{}.usdStageLoadRules'.format(proxyShapePath)), '/Room_set=none')
+
+        # saving the scene writes the rules.
+        cmds.file(save=True, force=True, type='mayaAscii')
+        self.assertEqual(
+            cmds.getAttr('{}.usdStageLoadRules'.format(proxyShapePath)), '/Room_set=none')
+
+        # reload the scene and verify the rules are still there.
+        cmds.file(new=True, force=True)
+        cmds.file(tempMayaFile, open=True)
+        proxyShapePath = cmds.ls(type="mayaUsdProxyShapeBase", long=True)[0]
+        stage = mayaUsd.lib.GetPrim(proxyShapePath).GetStage()
+        loadRules = stage.GetLoadRules()
+        self.assertEqual(loadRules.NoneRule, loadRules.GetEffectiveRuleForPath('/Room_set'))
+
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testLoadRulesExportedAndDuplicated only available in UFE v2 or greater.')
+    def testLoadRulesExportedAndDuplicated(self):
+        '''
+        Verify that the load rules recorded in memory are written when the proxy shape is exported
+        or duplicated.
+        '''
+        # open a scene with payload
+        cmds.file(new=True, force=True)
+        mayaUtils.openTopLayerScene()
+
+        roomPath = ufe.Path([
+            mayaUtils.createUfePathSegment("|transform1|proxyShape1"),
+            usdUtils.createUfePathSegment("/Room_set")])
+        contextOps = ufe.ContextOps.contextOps(ufe.Hierarchy.createItem(roomPath))
+        cmd = contextOps.doOpCmd(['Unload'])
+        cmd.execute()
+
+        # exporting the scene writes the rules.
+        tempMayaFile = os.path.join(
+            tempfile.mkdtemp(prefix='ProxyShapeBaseTest'), 'LoadRulesExport.ma')
+        cmds.file(tempMayaFile, exportAll=True, force=True, type='mayaAscii')
+
+        # duplicating the proxy shape copies the rules.
+        duplicate = cmds.duplicate('|transform1')[0]
+        duplicateShape = cmds.listRelatives(duplicate, shapes=True, fullPath=True)[0]
+        self.assertEqual(
+            cmds.getAttr('{}.usdStageLoadRules'.format(duplicateShape)), '/Room_set=none')
+
+        # open the exported scene and verify the rules are there.
+        cmds.file(new=True, force=True)
+        cmds.file(tempMayaFile, open=True)
+        proxyShapePath = cmds.ls(type="mayaUsdProxyShapeBase", long=True)[0]
+        stage = mayaUsd.lib.GetPrim(proxyShapePath).GetStage()
+        loadRules = stage.GetLoadRules()
+        self.assertEqual(loadRules.NoneRule, loadRules.GetEffectiveRuleForPath('/Room_set'))
+
     @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testStageMutedLayers only available in UFE v2 or greater.')
     def testStageMutedLayers(self):
         '''
@@ -872,5 +949,68 @@ class testProxyShapeBase(unittest.TestCase):
         self.assertEqual(unshareableLayerFromA.subLayerPaths[0], originalRootIdentifierB)
 
 
+    def testPopulationMask(self):
+        '''
+        Verify that the population mask of a proxy shape only composes the masked prims.
+        '''
+        import mayaUsdUtils
+
+        self.setupEmptyScene()
+
+        usdFilePath = os.path.join(self._currentTestDir, 'PopulationMask.usda')
+        usdStage = Usd.Stage.CreateNew(usdFilePath)
+        for primPath in ['/A', '/A/Sphere', '/B', '/B/Sphere', '/C']:
+            usdStage.DefinePrim(primPath, 'Xform')
+        usdStage.Save()
+
+        def createProxyShape(name):
+            shape = cmds.createNode('mayaUsdProxyShape', name=name)
+            cmds.setAttr(shape + '.filePath', usdFilePath, type='string')
+            return cmds.ls(shape, long=True)[0]
+
+        def getStage(proxyShape):
+            return mayaUsd.lib.GetPrim(proxyShape).GetStage()
+
+        def assertPopulated(proxyShape, populated, notPopulated):
+            stage = getStage(proxyShape)
+            for primPath in populated:
+                self.assertTrue(stage.GetPrimAtPath(primPath), primPath)
+            for primPath in notPopulated:
+                self.assertFalse(stage.GetPrimAtPath(primPath), primPath)
+
+        maskedShape = createProxyShape('maskedShape')
+        wholeShape = createProxyShape('wholeShape')
+
+        # Only the masked prims and their descendants are composed.
+        mayaUsdUtils.setPopulationMaskPaths(maskedShape, ['/A'])
+        self.assertEqual(getStage(maskedShape).GetPopulationMask().GetPaths(), [Sdf.Path('/A')])
+        assertPopulated(maskedShape, ['/A', '/A/Sphere'], ['/B', '/C'])
+
+        # The proxy shape opening the whole file doesn't get the masked stage.
+        self.assertNotEqual(getStage(maskedShape), getStage(wholeShape))
+        assertPopulated(wholeShape, ['/A', '/B', '/C'], [])
+
+        # The session layer edits are kept when the mask changes.
+        maskedSessionLayer = getStage(maskedShape).GetSessionLayer()
+        Sdf.CreatePrimInLayer(maskedSessionLayer, '/A/Session')
+
+        mayaUsdUtils.addPopulationMaskPaths(maskedShape, ['/B/Sphere'])
+        self.assertEqual(mayaUsdUtils.getPopulationMaskPaths(maskedShape), ['/A', '/B/Sphere'])
+        assertPopulated(maskedShape, ['/A', '/B/Sphere'], ['/C'])
+        self.assertEqual(getStage(maskedShape).GetSessionLayer(), maskedSessionLayer)
+        self.assertTrue(maskedSessionLayer.GetPrimAtPath('/A/Session'))
+
+        # The USD prims of UFE paths can be added and removed.
+        mayaUsdUtils.addUfePathsToPopulationMask([maskedShape + ',/C'])
+        assertPopulated(maskedShape, ['/A', '/B/Sphere', '/C'], [])
+        mayaUsdUtils.removeUfePathsFromPopulationMask([maskedShape + ',/A'])
+        assertPopulated(maskedShape, ['/B/Sphere', '/C'], ['/A'])
+
+        # Removing all the mask paths populates the whole stage.
+        mayaUsdUtils.removePopulationMaskPaths(maskedShape, ['/B/Sphere', '/C'])
+        self.assertEqual(mayaUsdUtils.getPopulationMaskPaths(maskedShape), [])
+        self.assertTrue(getStage(maskedShape).GetPopulationMask().IncludesSubtree('/'))
+        assertPopulated(maskedShape, ['/A', '/B', '/C'], [])
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
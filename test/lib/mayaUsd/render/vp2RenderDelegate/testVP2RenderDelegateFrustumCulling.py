@@ -0,0 +1,99 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from mayaUsd import lib as mayaUsdLib
+
+from maya import cmds
+
+from pxr import Gf, Tf, Usd, UsdGeom
+
+import os
+import unittest
+
+
+class testVP2RenderDelegateFrustumCulling(unittest.TestCase):
+    """
+    Tests the rprims skipped by the sync while they are outside of the view frustum, which is
+    enabled by MAYAUSD_VP2_FRUSTUM_CULLING.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False, loadPlugin=False)
+
+        cls._testDir = os.path.abspath('.')
+
+    def setUp(self):
+        self.assertTrue(Tf.GetEnvSetting('MAYAUSD_VP2_FRUSTUM_CULLING'))
+
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+
+    def _CreateStage(self):
+        """Write a cube at the origin and a cube far away from it on the X axis."""
+        usdFilePath = os.path.join(self._testDir, 'FrustumCulling.usda')
+        stage = Usd.Stage.CreateNew(usdFilePath)
+        for name, x in [('Near', 0.0), ('Far', 1000.0)]:
+            cube = UsdGeom.Mesh.Define(stage, '/' + name)
+            cube.CreatePointsAttr([Gf.Vec3f(x + px, py, pz)
+                for pz in (-1, 1) for py in (-1, 1) for px in (-1, 1)])
+            cube.CreateFaceVertexCountsAttr([4] * 6)
+            cube.CreateFaceVertexIndicesAttr([
+                0, 1, 3, 2,  4, 6, 7, 5,  0, 4, 5, 1,
+                2, 3, 7, 6,  0, 2, 6, 4,  1, 5, 7, 3])
+            cube.CreateExtentAttr([Gf.Vec3f(x - 1, -1, -1), Gf.Vec3f(x + 1, 1, 1)])
+        stage.GetRootLayer().Save()
+        return usdFilePath
+
+    def _LookAt(self, x):
+        """Look down the Z axis at the given position on the X axis."""
+        cmds.setAttr('persp.translate', x, 0, 20, type='double3')
+        cmds.setAttr('persp.rotate', 0, 0, 0, type='double3')
+
+    def _RefreshAndCountSyncedRprims(self):
+        mayaUsdLib.RenderStats.Enable()
+        try:
+            cmds.refresh(force=True)
+            return mayaUsdLib.RenderStats.GetCounters()['vp2RprimsSynced']
+        finally:
+            mayaUsdLib.RenderStats.Disable()
+
+    def testOffscreenPrimSyncedWhenInView(self):
+        """
+        A prim outside of the frustum when the stage is first drawn is synchronized as soon as
+        the camera looks at it, even if nothing else changes in the scene.
+        """
+        self._LookAt(0)
+        mayaUtils.createProxyFromFile(self._CreateStage())
+        cmds.refresh(force=True)
+
+        # Nothing changed, the culled prim is still skipped.
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Moving the camera alone brings the far prim into view.
+        self._LookAt(1000)
+        self.assertGreater(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Nothing left to sync once it has been drawn.
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
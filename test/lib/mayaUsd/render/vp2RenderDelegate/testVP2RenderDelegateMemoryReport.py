@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from mayaUsd import lib as mayaUsdLib
+
+from maya import cmds
+
+from pxr import Gf, Usd, UsdGeom
+
+import os
+import unittest
+
+
+class testVP2RenderDelegateMemoryReport(unittest.TestCase):
+    """
+    Tests the memory report of a proxy shape, from mayaUsdLib.MemoryReport and from the
+    mayaUsdMemoryReport command.
+    """
+
+    GRID_SIZE = 20
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False, loadPlugin=False)
+
+        cls._testDir = os.path.abspath('.')
+
+    def setUp(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+
+    def _CreateStage(self):
+        """Write a grid with many points and a single quad."""
+        usdFilePath = os.path.join(self._testDir, 'MemoryReport.usda')
+        stage = Usd.Stage.CreateNew(usdFilePath)
+
+        n = self.GRID_SIZE
+        grid = UsdGeom.Mesh.Define(stage, '/Grid')
+        grid.CreatePointsAttr([Gf.Vec3f(x, y, 0) for y in range(n + 1) for x in range(n + 1)])
+        grid.CreateFaceVertexCountsAttr([4] * (n * n))
+        grid.CreateFaceVertexIndicesAttr([i
+            for y in range(n) for x in range(n)
+            for i in (y * (n + 1) + x, y * (n + 1) + x + 1,
+                      (y + 1) * (n + 1) + x + 1, (y + 1) * (n + 1) + x)])
+
+        quad = UsdGeom.Mesh.Define(stage, '/Quad')
+        quad.CreatePointsAttr([Gf.Vec3f(0, 0, 1), Gf.Vec3f(1, 0, 1),
+                               Gf.Vec3f(1, 1, 1), Gf.Vec3f(0, 1, 1)])
+        quad.CreateFaceVertexCountsAttr([4])
+        quad.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+
+        stage.GetRootLayer().Save()
+        return usdFilePath
+
+    def testMemoryReport(self):
+        usdFilePath = self._CreateStage()
+        shapeNode, _ = mayaUtils.createProxyFromFile(usdFilePath)
+        cmds.refresh(force=True)
+
+        report = mayaUsdLib.MemoryReport.Compute(shapeNode)
+        self.assertEqual(report['stagePrims'], 2)
+        self.assertGreaterEqual(report['layers'], 1)
+        self.assertGreaterEqual(report['layerBytes'], os.path.getsize(usdFilePath))
+        self.assertEqual(report['sharedStage'], 1)
+        self.assertGreater(report['cpuCacheBytes'], 0)
+        self.assertGreater(report['vertexBufferBytes'], 0)
+        self.assertGreater(report['indexBufferBytes'], 0)
+        self.assertGreater(report['shaderInstances'], 0)
+
+        # The prims are sorted from the largest, and add up to the totals.
+        prims = report['prims']
+        self.assertEqual([p['path'] for p in prims], ['/Grid', '/Quad'])
+        self.assertGreater(prims[0]['totalBytes'], prims[1]['totalBytes'])
+        for key in ['cpuCacheBytes', 'vertexBufferBytes', 'indexBufferBytes']:
+            self.assertEqual(sum(p[key] for p in prims), report[key], key)
+        for p in prims:
+            self.assertEqual(p['totalBytes'],
+                p['cpuCacheBytes'] + p['vertexBufferBytes'] + p['indexBufferBytes'])
+
+        self.assertEqual([p['path'] for p in
+            mayaUsdLib.MemoryReport.Compute(shapeNode, maxPrims=1)['prims']], ['/Grid'])
+
+        # The command returns the same report.
+        names = cmds.mayaUsdMemoryReport(list=True)
+        values = cmds.mayaUsdMemoryReport(shapeNode)
+        self.assertEqual(len(names), len(values))
+        for name, value in zip(names, values):
+            self.assertEqual(value, report[name], name)
+
+        self.assertEqual(cmds.mayaUsdMemoryReport(shapeNode, topPrims=1), ['/Grid'])
+        self.assertEqual(cmds.mayaUsdMemoryReport(shapeNode, topPrimBytes=2),
+            [p['totalBytes'] for p in prims])
+
+    def testNotProxyShape(self):
+        self.assertIsNone(mayaUsdLib.MemoryReport.Compute('persp'))
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUsdMemoryReport('persp')
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
@@ -0,0 +1,193 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from mayaUsd import lib as mayaUsdLib
+from mayaUsd.analyticMayaUsdPerformance import analyticMayaUsdPerformance
+from mayaUsd import benchmarkMayaUsdPerformance as benchmark
+
+from pxr import Gf, UsdGeom, Vt
+
+from maya import cmds
+from maya.api import OpenMaya
+
+import json
+import math
+import os
+import unittest
+
+# Render statistics recorded with the analytic timings of each viewport test.
+RENDER_COUNTERS = [
+    'vp2PopulateTimeMs',
+    'vp2ExecuteTimeMs',
+    'vp2SyncTimeMs',
+    'vp2FillTimeMs',
+    'vp2CommitTimeMs',
+    'vp2RprimsSynced',
+    'vp2ShaderInstances',
+]
+
+# Frames of the playback and tumble tests
+NUM_FRAMES = 50
+
+# Control points of each basis curve
+CURVE_VERTICES = 16
+
+
+class _RenderStatsAnalytic(analyticMayaUsdPerformance):
+    """
+    Analytic that also records the render statistics of each viewport test and
+    creates the display layers of the scenario once the proxy shape exists.
+    """
+
+    def __init__(self, numDisplayLayers, numMeshes):
+        analyticMayaUsdPerformance.__init__(self)
+        self._numDisplayLayers = numDisplayLayers
+        self._numMeshes = numMeshes
+        self.renderStats = {}
+
+    @staticmethod
+    def _GetMayaNode(mayaNodeName):
+        selectionList = OpenMaya.MSelectionList()
+        selectionList.add(mayaNodeName)
+        return selectionList.getDependNode(0)
+
+    def createProxyShapeAndLoadUSD(self, usdFileName):
+        analyticMayaUsdPerformance.createProxyShapeAndLoadUSD(self, usdFileName)
+        if self._numDisplayLayers <= 0:
+            return
+
+        shapePath = cmds.ls('UsdStageShape', long=True)[0]
+        for layerIndex in range(self._numDisplayLayers):
+            layerName = cmds.createDisplayLayer(
+                name='perfLayer%d' % layerIndex, empty=True, noRecurse=True)
+            displayLayer = OpenMaya.MFnDisplayLayer(self._GetMayaNode(layerName))
+            for meshIndex in range(layerIndex, self._numMeshes, self._numDisplayLayers):
+                displayLayer.add(shapePath + ',/World/Meshes/mesh%d' % meshIndex)
+            cmds.setAttr(layerName + '.color', 1 + layerIndex % 30)
+
+    def testViewport(self, json_data, play_mgr, selected):
+        # The counters of the frame drawn just before the test: the first frame or the
+        # frame drawn after the selection.
+        counters = mayaUsdLib.RenderStats.GetCounters()
+        self.renderStats[selected] = {key: counters[key] for key in RENDER_COUNTERS}
+        analyticMayaUsdPerformance.testViewport(self, json_data, play_mgr, selected)
+
+
+class testVP2RenderDelegatePerformance(unittest.TestCase):
+    """
+    Performance scenarios of the Viewport 2.0 render delegate.
+
+    Each scenario scales up one kind of content, runs the analyticMayaUsdPerformance
+    tests (first_frame, consolidate, tumble, playback, select_all, new_scene) on it and
+    records their timings and memory together with the VP2 render statistics. The
+    results of all the scenarios are written to testVP2RenderDelegatePerformance.json,
+    to compare mayaUsd builds against each other.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False, loadPlugin=False)
+        cls._testDir = os.path.abspath('.')
+        cls._results = {}
+
+    @classmethod
+    def tearDownClass(cls):
+        outputPath = os.path.join(cls._testDir, 'testVP2RenderDelegatePerformance.json')
+        with open(outputPath, 'w') as f:
+            json.dump(cls._results, f, indent=4, sort_keys=True)
+
+    def setUp(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin('mayaUsdPlugin')
+        mayaUsdLib.RenderStats.Enable()
+
+    def tearDown(self):
+        mayaUsdLib.RenderStats.Disable()
+        cmds.file(force=True, new=True)
+
+    def _WriteStage(self, name, numMeshes, numInstances, numMaterials, numCurves):
+        stage = benchmark.build_stage(numMeshes, numInstances, numMaterials, NUM_FRAMES)
+
+        if numCurves > 0:
+            curves = UsdGeom.BasisCurves.Define(stage, '/World/Curves')
+            curves.CreateTypeAttr(UsdGeom.Tokens.cubic)
+            curves.CreateBasisAttr(UsdGeom.Tokens.bspline)
+            curves.CreateCurveVertexCountsAttr(Vt.IntArray([CURVE_VERTICES] * numCurves))
+            points = []
+            for i in range(numCurves):
+                root = benchmark.grid_position(i, numCurves)
+                for j in range(CURVE_VERTICES):
+                    points.append(root + Gf.Vec3f(
+                        0.2 * math.sin(j * 0.7), j * 0.25, 0.2 * math.cos(j * 0.7)))
+            curves.CreatePointsAttr(Vt.Vec3fArray(points))
+            curves.CreateWidthsAttr(Vt.FloatArray([0.05]))
+            curves.SetWidthsInterpolation(UsdGeom.Tokens.constant)
+
+        usdFile = os.path.join(self._testDir, 'perf_%s.usdc' % name)
+        stage.GetRootLayer().Export(usdFile)
+        return usdFile
+
+    def _RunScenario(self, name, numMeshes=0, numInstances=0, numMaterials=1,
+                     numDisplayLayers=0, numCurves=0):
+        usdFile = self._WriteStage(name, numMeshes, numInstances, numMaterials, numCurves)
+
+        # Look at the whole grid from above, far enough for the near clipping plane
+        # set by the analytic.
+        extent = max(1, int(math.ceil(math.sqrt(
+            max(numMeshes, numInstances, numCurves))))) * benchmark.GRID_SPACING
+        cameraTranslate = [extent * 0.5, 150 + extent, 150 + extent * 1.5]
+        cameraRotate = [-40, 0, 0]
+
+        analytic = _RenderStatsAnalytic(numDisplayLayers, numMeshes)
+        results = analytic.run(usdFile, cameraTranslate, cameraRotate, 1, NUM_FRAMES)
+        for selected, counters in analytic.renderStats.items():
+            results[selected]['render_stats'] = counters
+
+        results['scenario'] = {
+            'meshes'        : numMeshes,
+            'instances'     : numInstances,
+            'materials'     : numMaterials,
+            'displayLayers' : numDisplayLayers,
+            'curves'        : numCurves,
+        }
+        self._results[name] = results
+
+        # The scene must have been drawn for the timings to mean anything.
+        self.assertGreater(results['not_selected']['render_stats']['vp2RprimsSynced'], 0)
+
+    def testBaseline(self):
+        self._RunScenario('baseline', numMeshes=1000)
+
+    def testInstancing(self):
+        self._RunScenario('instancing', numMeshes=1, numInstances=50000)
+
+    def testMaterials(self):
+        self._RunScenario('materials', numMeshes=2000, numMaterials=2000)
+
+    @unittest.skipUnless(hasattr(OpenMaya, 'MFnDisplayLayer'), 'Requires the display layer API.')
+    def testDisplayLayers(self):
+        self._RunScenario('displayLayers', numMeshes=2000, numDisplayLayers=50)
+
+    def testBasisCurves(self):
+        self._RunScenario('basisCurves', numCurves=10000)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
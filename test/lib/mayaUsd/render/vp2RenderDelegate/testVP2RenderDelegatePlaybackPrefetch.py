@@ -0,0 +1,103 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from mayaUsd import lib as mayaUsdLib
+
+from maya import cmds
+
+from pxr import Gf, Tf, Usd, UsdGeom
+
+import os
+import unittest
+
+
+class testVP2RenderDelegatePlaybackPrefetch(unittest.TestCase):
+    """
+    Tests the primvars read ahead of the current frame during playback, which is enabled by
+    MAYAUSD_VP2_PLAYBACK_PREFETCH_FRAMES.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False, loadPlugin=False)
+
+        cls._testDir = os.path.abspath('.')
+
+    def setUp(self):
+        self.assertGreater(Tf.GetEnvSetting('MAYAUSD_VP2_PLAYBACK_PREFETCH_FRAMES'), 0)
+
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+        cmds.playbackOptions(minTime=1, maxTime=20, loop='once', playbackSpeed=0, by=1)
+
+    def _CreateAnimatedMesh(self, firstTime, lastTime):
+        """Write a quad whose points move at every frame between the two times."""
+        usdFilePath = os.path.join(self._testDir, 'PlaybackPrefetch.usda')
+        stage = Usd.Stage.CreateNew(usdFilePath)
+        mesh = UsdGeom.Mesh.Define(stage, '/Quad')
+        mesh.CreateFaceVertexCountsAttr([4])
+        mesh.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+        points = mesh.CreatePointsAttr()
+        for time in range(firstTime, lastTime + 1):
+            offset = float(time - firstTime)
+            points.Set([Gf.Vec3f(offset, 0, 0), Gf.Vec3f(offset + 1, 0, 0),
+                        Gf.Vec3f(offset + 1, 1, 0), Gf.Vec3f(offset, 1, 0)], time)
+        stage.GetRootLayer().Save()
+        return usdFilePath
+
+    def _PlayAndCountPrefetchedPrimvars(self):
+        cmds.currentTime(1)
+        cmds.refresh()
+
+        mayaUsdLib.RenderStats.Enable()
+        try:
+            before = mayaUsdLib.RenderStats.GetCounters()['vp2PrefetchedPrimvars']
+            cmds.play(wait=True)
+            after = mayaUsdLib.RenderStats.GetCounters()['vp2PrefetchedPrimvars']
+        finally:
+            mayaUsdLib.RenderStats.Disable()
+
+        return after - before
+
+    def testPrefetch(self):
+        """The primvars of the next frames are read ahead and used during playback."""
+        mayaUtils.createProxyFromFile(self._CreateAnimatedMesh(1, 20))
+
+        self.assertGreater(self._PlayAndCountPrefetchedPrimvars(), 0)
+
+    def testPrefetchWithTimeOffset(self):
+        """
+        The frames of the playback range are Maya times, they are mapped to the USD times
+        through the time of the proxy shape.
+        """
+        shapeNode, _ = mayaUtils.createProxyFromFile(self._CreateAnimatedMesh(11, 30))
+
+        # The USD time is the Maya time offset by 10 frames.
+        cmds.disconnectAttr('time1.outTime', '{}.time'.format(shapeNode))
+        cmds.setKeyframe(shapeNode, attribute='time', time=1, value=11)
+        cmds.setKeyframe(shapeNode, attribute='time', time=20, value=30)
+        cmds.keyTangent(shapeNode, attribute='time', inTangentType='linear',
+            outTangentType='linear')
+
+        self.assertGreater(self._PlayAndCountPrefetchedPrimvars(), 0)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
@@ -0,0 +1,120 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from mayaUsd import lib as mayaUsdLib
+
+from maya import cmds
+
+from pxr import Gf, Usd, UsdGeom
+
+import os
+import unittest
+
+
+class testVP2RenderDelegateScreenSizeLod(unittest.TestCase):
+    """
+    Tests the boundsLodScreenSize attribute of the proxy shape, which draws the prims smaller
+    than the given size in pixels as their bounds.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False, loadPlugin=False)
+
+        cls._testDir = os.path.abspath('.')
+
+    def setUp(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+
+    def _CreateStage(self):
+        """Write a cube at the origin."""
+        usdFilePath = os.path.join(self._testDir, 'ScreenSizeLod.usda')
+        stage = Usd.Stage.CreateNew(usdFilePath)
+        cube = UsdGeom.Mesh.Define(stage, '/Cube')
+        cube.CreatePointsAttr([Gf.Vec3f(px, py, pz)
+            for pz in (-1, 1) for py in (-1, 1) for px in (-1, 1)])
+        cube.CreateFaceVertexCountsAttr([4] * 6)
+        cube.CreateFaceVertexIndicesAttr([
+            0, 1, 3, 2,  4, 6, 7, 5,  0, 4, 5, 1,
+            2, 3, 7, 6,  0, 2, 6, 4,  1, 5, 7, 3])
+        cube.CreateExtentAttr([Gf.Vec3f(-1, -1, -1), Gf.Vec3f(1, 1, 1)])
+        stage.GetRootLayer().Save()
+        return usdFilePath
+
+    def _LookFrom(self, z):
+        """Look down the Z axis at the origin from the given distance."""
+        cmds.setAttr('persp.translate', 0, 0, z, type='double3')
+        cmds.setAttr('persp.rotate', 0, 0, 0, type='double3')
+
+    def _RefreshAndCountSyncedRprims(self):
+        mayaUsdLib.RenderStats.Enable()
+        try:
+            cmds.refresh(force=True)
+            return mayaUsdLib.RenderStats.GetCounters()['vp2RprimsSynced']
+        finally:
+            mayaUsdLib.RenderStats.Disable()
+
+    def testCameraMoves(self):
+        """
+        Without a threshold, moving the camera doesn't synchronize anything. With a threshold,
+        the cube is synchronized again when it crosses it, and only then.
+        """
+        self._LookFrom(10)
+        shapeNode, _ = mayaUtils.createProxyFromFile(self._CreateStage())
+        cmds.refresh(force=True)
+
+        self.assertEqual(cmds.getAttr('{}.boundsLodScreenSize'.format(shapeNode)), 0)
+        self._LookFrom(1000)
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Setting the threshold synchronizes the prims again, the cube is still large enough.
+        self._LookFrom(10)
+        cmds.refresh(force=True)
+        cmds.setAttr('{}.boundsLodScreenSize'.format(shapeNode), 20)
+        self.assertGreater(self._RefreshAndCountSyncedRprims(), 0)
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Moving away makes the cube smaller than the threshold.
+        self._LookFrom(1000)
+        self.assertGreater(self._RefreshAndCountSyncedRprims(), 0)
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Moving without crossing the threshold doesn't change anything.
+        self._LookFrom(1200)
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Coming back draws the full cube again.
+        self._LookFrom(10)
+        self.assertGreater(self._RefreshAndCountSyncedRprims(), 0)
+
+        # Clearing the threshold restores the prims, then the camera is ignored again.
+        self._LookFrom(1000)
+        self.assertGreater(self._RefreshAndCountSyncedRprims(), 0)
+        cmds.setAttr('{}.boundsLodScreenSize'.format(shapeNode), 0)
+        self.assertGreater(self._RefreshAndCountSyncedRprims(), 0)
+        self._LookFrom(10)
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+        self._LookFrom(1000)
+        self.assertEqual(self._RefreshAndCountSyncedRprims(), 0)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
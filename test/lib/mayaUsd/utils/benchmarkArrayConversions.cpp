@@ -0,0 +1,202 @@
+#include <mayaUsd/utils/converter.h>
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
+#include <maya/MIntArray.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
+
+#ifdef MAYAUSD_BENCHMARK_AL_MESHUTILS
+#include <AL/usdmaya/utils/MeshUtils.h>
+#endif
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace MAYAUSD_NS_DEF;
+
+namespace {
+
+struct BenchmarkResult
+{
+    std::string name;
+    size_t      count;
+    size_t      iterations;
+    double      nsPerIteration;
+};
+
+std::vector<BenchmarkResult> results;
+
+// Runs the function for at least 200ms, after one warm-up call, and records the mean time per
+// call. Functions that mutate their input must restore it themselves.
+void runBenchmark(const std::string& name, size_t count, const std::function<void()>& fn)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto minDuration = std::chrono::milliseconds(200);
+
+    fn();
+
+    size_t     iterations = 0;
+    const auto start = Clock::now();
+    auto       end = start;
+    do {
+        fn();
+        ++iterations;
+        end = Clock::now();
+    } while (end - start < minDuration);
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    results.push_back({ name, count, iterations, ns / iterations });
+    std::cout << name << "/" << count << ": " << ns / iterations << " ns" << std::endl;
+}
+
+// Same layout as the Google Benchmark JSON reporter, so existing tooling can compare runs.
+bool writeResults(const char* path)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& r = results[i];
+        out << "    {\"name\": \"" << r.name << "/" << r.count << "\", \"iterations\": "
+            << r.iterations << ", \"real_time\": " << r.nsPerIteration
+            << ", \"time_unit\": \"ns\"}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return bool(out);
+}
+
+void benchmarkConverter(size_t count)
+{
+    VtIntArray    ints(count, 3);
+    VtFloatArray  floats(count, 0.5f);
+    VtDoubleArray doubles(count, 0.5);
+    VtVec3fArray  points3f(count, GfVec3f(1.0f, 2.0f, 3.0f));
+    VtVec3dArray  points3d(count, GfVec3d(1.0, 2.0, 3.0));
+
+    MIntArray    mInts;
+    MFloatArray  mFloats;
+    MDoubleArray mDoubles;
+    MPointArray  mPoints;
+    MVectorArray mVectors;
+
+    runBenchmark("Converter_VtIntArray_to_MIntArray", count, [&]() {
+        TypedConverter<MIntArray, VtIntArray>::convert(ints, mInts);
+    });
+    runBenchmark("Converter_MIntArray_to_VtIntArray", count, [&]() {
+        TypedConverter<MIntArray, VtIntArray>::convert(mInts, ints);
+    });
+    runBenchmark("Converter_VtFloatArray_to_MFloatArray", count, [&]() {
+        TypedConverter<MFloatArray, VtFloatArray>::convert(floats, mFloats);
+    });
+    runBenchmark("Converter_MFloatArray_to_VtFloatArray", count, [&]() {
+        TypedConverter<MFloatArray, VtFloatArray>::convert(mFloats, floats);
+    });
+    runBenchmark("Converter_VtDoubleArray_to_MDoubleArray", count, [&]() {
+        TypedConverter<MDoubleArray, VtDoubleArray>::convert(doubles, mDoubles);
+    });
+    runBenchmark("Converter_MDoubleArray_to_VtDoubleArray", count, [&]() {
+        TypedConverter<MDoubleArray, VtDoubleArray>::convert(mDoubles, doubles);
+    });
+    runBenchmark("Converter_VtVec3fArray_to_MPointArray", count, [&]() {
+        TypedConverter<MPointArray, VtVec3fArray>::convert(points3f, mPoints);
+    });
+    runBenchmark("Converter_MPointArray_to_VtVec3fArray", count, [&]() {
+        TypedConverter<MPointArray, VtVec3fArray>::convert(mPoints, points3f);
+    });
+    runBenchmark("Converter_VtVec3dArray_to_MVectorArray", count, [&]() {
+        TypedConverter<MVectorArray, VtVec3dArray>::convert(points3d, mVectors);
+    });
+    runBenchmark("Converter_MVectorArray_to_VtVec3dArray", count, [&]() {
+        TypedConverter<MVectorArray, VtVec3dArray>::convert(mVectors, points3d);
+    });
+}
+
+void benchmarkMergeEquivalentIndexedValues(size_t count)
+{
+    // Face-varying UVs of a quad grid: every value is shared by up to four face-vertices but
+    // stored once per face-vertex, which is what the merge is meant to collapse.
+    VtVec2fArray uvs(count);
+    VtIntArray   indices(count);
+    for (size_t i = 0; i < count; ++i) {
+        uvs[i] = GfVec2f(float(i / 4 % 256), float(i / 1024));
+        indices[i] = int(i);
+    }
+
+    runBenchmark("MergeEquivalentIndexedValues_Vec2f", count, [&]() {
+        VtVec2fArray values = uvs;
+        VtIntArray   assignments = indices;
+        UsdMayaUtil::MergeEquivalentIndexedValues(&values, &assignments);
+    });
+}
+
+#ifdef MAYAUSD_BENCHMARK_AL_MESHUTILS
+void benchmarkMeshUtils(size_t count)
+{
+    namespace utils = AL::usdmaya::utils;
+
+    std::vector<float>   f(count, 0.5f);
+    std::vector<double>  d(count);
+    std::vector<float>   u(count, 0.25f);
+    std::vector<float>   v(count, 0.75f);
+    std::vector<float>   uv(count * 2);
+    std::vector<int32_t> indices(count);
+    for (size_t i = 0; i < count; ++i)
+        indices[i] = int32_t((i * 7) % count);
+
+    runBenchmark(
+        "floatToDouble", count, [&]() { utils::floatToDouble(d.data(), f.data(), count); });
+    runBenchmark(
+        "doubleToFloat", count, [&]() { utils::doubleToFloat(f.data(), d.data(), count); });
+    runBenchmark("zipUVs", count, [&]() { utils::zipUVs(u.data(), v.data(), uv.data(), count); });
+    runBenchmark(
+        "unzipUVs", count, [&]() { utils::unzipUVs(uv.data(), u.data(), v.data(), count); });
+    runBenchmark("interleaveIndexedUvData", count, [&]() {
+        utils::interleaveIndexedUvData(
+            uv.data(), u.data(), v.data(), indices.data(), uint32_t(count));
+    });
+}
+#endif
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+    }
+
+    // From a single face up to a dense production mesh.
+    const size_t sizes[] = { 64, 4096, 65536, 1048576 };
+
+    for (size_t count : sizes) {
+        benchmarkConverter(count);
+        benchmarkMergeEquivalentIndexedValues(count);
+#ifdef MAYAUSD_BENCHMARK_AL_MESHUTILS
+        benchmarkMeshUtils(count);
+#endif
+    }
+
+    if (outputPath && !writeResults(outputPath)) {
+        std::cerr << "Failed to write " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+#include <mayaUsd/utils/colorSpace.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace PXR_NS;
+
+namespace {
+
+// Colors over the whole [0, 1] range, with some channels out of it.
+std::vector<GfVec4f> makeColors()
+{
+    std::vector<GfVec4f> colors;
+    for (int i = 0; i <= 1000; ++i) {
+        const float value = i / 1000.0f;
+        colors.emplace_back(value, 1.0f - value, value * value, 0.5f);
+    }
+    colors.emplace_back(1.5f, 0.5f, 0.25f, 1.0f);
+    colors.emplace_back(0.0001f, 0.0f, 2.0f, 0.0f);
+    return colors;
+}
+
+} // namespace
+
+TEST(ColorSpace, bulkConversionMatchesPerValueConversion)
+{
+    const std::vector<GfVec4f> colors = makeColors();
+
+    std::vector<GfVec4f> toMaya = colors;
+    std::vector<GfVec4f> toLinear = colors;
+    MayaUsd::utils::ConvertLinearToMaya(toMaya.data(), toMaya.size());
+    MayaUsd::utils::ConvertMayaToLinear(toLinear.data(), toLinear.size());
+
+    std::vector<GfVec3f> toMaya3;
+    for (const GfVec4f& color : colors) {
+        toMaya3.emplace_back(color[0], color[1], color[2]);
+    }
+    MayaUsd::utils::ConvertLinearToMaya(toMaya3.data(), toMaya3.size());
+
+    for (size_t i = 0; i < colors.size(); ++i) {
+        const GfVec4f expectedMaya = MayaUsd::utils::ConvertLinearToMaya(colors[i]);
+        const GfVec4f expectedLinear = MayaUsd::utils::ConvertMayaToLinear(colors[i]);
+        for (int c = 0; c < 4; ++c) {
+            EXPECT_NEAR(toMaya[i][c], expectedMaya[c], 1e-5f);
+            EXPECT_NEAR(toLinear[i][c], expectedLinear[c], 1e-5f);
+        }
+        for (int c = 0; c < 3; ++c) {
+            EXPECT_NEAR(toMaya3[i][c], expectedMaya[c], 1e-5f);
+        }
+    }
+}
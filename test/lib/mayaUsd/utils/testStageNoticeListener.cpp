@@ -0,0 +1,87 @@
+#include <mayaUsd/listeners/stageNoticeListener.h>
+
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+using namespace PXR_NS;
+
+TEST(StageNoticeListener, subscriptionsFilterChangedPaths)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/A"));
+    stage->DefinePrim(SdfPath("/B"));
+
+    UsdMayaStageNoticeListener listener;
+    listener.SetStage(stage);
+
+    int           calls = 0;
+    SdfPathVector resyncedPaths;
+    SdfPathVector changedInfoOnlyPaths;
+    listener.AddObjectsChangedSubscription(
+        SdfPath("/A"),
+        UsdMayaChangedPathIndex::AnyChange,
+        [&](const UsdNotice::ObjectsChanged&,
+            const SdfPathVector& resynced,
+            const SdfPathVector& changedInfoOnly) {
+            ++calls;
+            resyncedPaths = resynced;
+            changedInfoOnlyPaths = changedInfoOnly;
+        });
+
+    // Changes outside of the prefix are not delivered.
+    stage->DefinePrim(SdfPath("/B/C"));
+    EXPECT_EQ(calls, 0);
+
+    // Only the slice of the prefix is delivered.
+    {
+        SdfChangeBlock block;
+        stage->DefinePrim(SdfPath("/A/C"));
+        stage->DefinePrim(SdfPath("/B/D"));
+    }
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(resyncedPaths, SdfPathVector({ SdfPath("/A/C") }));
+    EXPECT_TRUE(changedInfoOnlyPaths.empty());
+
+    UsdPrim      prim = stage->GetPrimAtPath(SdfPath("/A/C"));
+    UsdAttribute attr = prim.CreateAttribute(TfToken("value"), SdfValueTypeNames->Float);
+    calls = 0;
+    attr.Set(1.0f);
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(resyncedPaths.empty());
+    EXPECT_EQ(changedInfoOnlyPaths, SdfPathVector({ attr.GetPath() }));
+}
+
+TEST(StageNoticeListener, subscriptionsFilterChangeKinds)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim        prim = stage->DefinePrim(SdfPath("/A"));
+    UsdAttribute   attr = prim.CreateAttribute(TfToken("value"), SdfValueTypeNames->Float);
+
+    UsdMayaStageNoticeListener listener;
+    listener.SetStage(stage);
+
+    int                                        calls = 0;
+    UsdMayaStageNoticeListener::SubscriptionId id = listener.AddObjectsChangedSubscription(
+        SdfPath("/A/B"),
+        UsdMayaChangedPathIndex::Resynced,
+        [&](const UsdNotice::ObjectsChanged&, const SdfPathVector&, const SdfPathVector&) {
+            ++calls;
+        });
+
+    // Changed info only is filtered out.
+    attr.Set(1.0f);
+    EXPECT_EQ(calls, 0);
+
+    // The resync of an ancestor affects the prefix.
+    prim.SetActive(false);
+    EXPECT_EQ(calls, 1);
+
+    listener.RemoveObjectsChangedSubscription(id);
+    prim.SetActive(true);
+    EXPECT_EQ(calls, 1);
+}
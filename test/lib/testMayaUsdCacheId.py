@@ -21,7 +21,7 @@ import os
 import tempfile
 
 import pxr
-from pxr import Usd, UsdGeom, UsdUtils
+from pxr import Sdf, Usd, UsdGeom, UsdUtils
 
 from maya import cmds
 from maya import standalone
@@ -211,3 +211,37 @@ class MayaUsdPythonCacheIdTestCase(unittest.TestCase):
         # Check that the stageCacheId reset to -1
         self.assertEqual(cmds.getAttr('{}.stageCacheId'.format(shapeNodeB)),
                          -1)
+
+    def testPrefetchLayers(self):
+        # Write a root layer using a sublayer, a reference and a payload
+        testDir = tempfile.mkdtemp(prefix='MayaUsdPythonPrefetchLayers')
+        layerPaths = {}
+        for name in ['root', 'sub', 'ref', 'payload']:
+            layerPaths[name] = os.path.join(testDir, name + '.usda')
+            Sdf.Layer.CreateNew(layerPaths[name]).Save()
+
+        rootStage = Usd.Stage.Open(layerPaths['root'])
+        rootStage.GetRootLayer().subLayerPaths.append('sub.usda')
+        prim = rootStage.DefinePrim('/prim')
+        prim.GetReferences().AddReference('ref.usda')
+        prim.GetPayloads().AddPayload('payload.usda')
+        rootStage.GetRootLayer().Save()
+        rootStage = None
+        prim = None
+
+        # Only the layers held by the prefetch remain opened
+        mayaUsdLib.StageCache.ReleasePrefetchedLayers()
+        mayaUsdLib.StageCache.PrefetchLayers([layerPaths['root']], loadAll=False)
+        mayaUsdLib.StageCache.WaitForPrefetchedLayers()
+        for name in ['root', 'sub', 'ref']:
+            self.assertIsNotNone(Sdf.Layer.Find(layerPaths[name]))
+        self.assertIsNone(Sdf.Layer.Find(layerPaths['payload']))
+
+        # Prefetching again with the payloads follows the skipped payloads
+        mayaUsdLib.StageCache.PrefetchLayers([layerPaths['root']])
+        mayaUsdLib.StageCache.WaitForPrefetchedLayers()
+        self.assertIsNotNone(Sdf.Layer.Find(layerPaths['payload']))
+
+        mayaUsdLib.StageCache.ReleasePrefetchedLayers()
+        for name in layerPaths:
+            self.assertIsNone(Sdf.Layer.Find(layerPaths[name]))
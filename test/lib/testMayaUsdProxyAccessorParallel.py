@@ -0,0 +1,201 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+import maya.cmds as cmds
+import maya.OpenMaya as OpenMaya
+import maya.OpenMayaMPx as OpenMayaMPx
+
+import mayaUtils, ufeUtils
+
+from cachingUtils import NonCachingScope, CachingScope
+from ufeUtils import createUfeSceneItem
+from mayaUtils import createProxyFromFile
+from usdUtils import createAnimatedHierarchy
+
+from mayaUsd import lib as mayaUsdLib
+from mayaUsd.lib import proxyAccessor as pa
+
+from pxr import Usd, UsdGeom, Sdf, Tf
+
+import ufe
+
+class TestObserver(ufe.Observer):
+    def __init__(self):
+        super(TestObserver, self).__init__()
+        self._notifications = 0
+
+    def __call__(self, notification):
+        if (ufeUtils.ufeFeatureSetVersion() >= 2):
+            if isinstance(notification, ufe.AttributeValueChanged):
+                self._notifications += 1
+        else:
+            if isinstance(notification, ufe.AttributeChanged):
+                self._notifications += 1
+
+    @property
+    def notifications(self):
+        return self._notifications
+
+class MayaUsdProxyAccessorParallelTestCase(unittest.TestCase):
+    """
+    Verify the proxy accessors of several proxy shapes, chained to each other, when the proxy
+    shapes are scheduled in parallel by the evaluation manager.
+
+    The test is run with MAYAUSD_PROXY_SHAPE_PARALLEL_EVALUATION set.
+    """
+
+    pluginsLoaded = False
+    testDir = None
+    testFiles = []
+    cache_allFrames = [[1,120]]
+    cache_empty = []
+
+    @classmethod
+    def setUpClass(cls):
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+        cls.testDir = os.path.join(os.path.abspath('.'),'TestMayaUsdProxyAccessorParallel')
+
+        # Each proxy shape needs its own file, proxy shapes opening the same file share the stage.
+        layer = Sdf.Layer.CreateAnonymous('TmpLayer')
+        stage = Usd.Stage.Open(layer.identifier)
+        createAnimatedHierarchy(stage)
+        cls.testFiles = []
+        for i in range(5):
+            tmpUsdFile = os.path.join(cls.testDir,'AnimatedHierarchy{}.usda'.format(i))
+            layer.Export(tmpUsdFile)
+            cls.testFiles.append(tmpUsdFile)
+
+    @classmethod
+    def tearDownClass(cls):
+        cmds.file(new=True, force=True)
+
+    def setUp(self):
+        self.assertTrue(self.pluginsLoaded)
+        self.assertTrue(Tf.GetEnvSetting('MAYAUSD_PROXY_SHAPE_PARALLEL_EVALUATION'))
+
+    def assertVectorAlmostEqual(self, a, b, places=7):
+        for va, vb in zip(a, b):
+            self.assertAlmostEqual(va, vb, places)
+
+    def chainProxies(self, sourceNode, destinationNode):
+        """
+        Drive the translation of /ParentB in the destination proxy with the translation of
+        /ParentA/Sphere in the source proxy. Returns the accessor plug of the world matrix of
+        /ParentB in the destination proxy.
+        """
+        ufeSourceItem = createUfeSceneItem(sourceNode,'/ParentA/Sphere')
+        ufeDestinationItem = createUfeSceneItem(destinationNode,'/ParentB')
+
+        sourcePlug = pa.getOrCreateAccessPlug(ufeSourceItem, usdAttrName='xformOp:translate')
+        destinationPlug = pa.getOrCreateAccessPlug(ufeDestinationItem, usdAttrName='xformOp:translate')
+        cmds.connectAttr('{}.{}'.format(sourceNode,sourcePlug), '{}.{}'.format(destinationNode,destinationPlug))
+
+        return pa.getOrCreateAccessPlug(ufeDestinationItem, '', Sdf.ValueTypeNames.Matrix4d)
+
+    def validateChains(self, cachingScope):
+        """
+        Validate two independent chains of accessors, one going through three proxy shapes,
+        and one through two proxy shapes, each with its own stage.
+        """
+        nodes = [createProxyFromFile(f)[0] for f in self.testFiles]
+
+        worldMatrixPlugs = [
+            (nodes[1], self.chainProxies(nodes[0], nodes[1])),
+            (nodes[2], self.chainProxies(nodes[1], nodes[2])),
+            (nodes[4], self.chainProxies(nodes[3], nodes[4])),
+        ]
+
+        cachingScope.checkValidFrames(self.cache_empty)
+        cachingScope.waitForCache()
+        cachingScope.checkValidFrames(self.cache_allFrames)
+
+        # /ParentB is only translated, by the translation of the source /ParentA/Sphere.
+        for time, translation in [(1, [5.0, 0.0, 0.0]), (100, [-5.0, 0.0, 0.0])]:
+            cmds.currentTime(time)
+            for node, plug in worldMatrixPlugs:
+                v = cmds.getAttr('{}.{}'.format(node,plug))
+                self.assertVectorAlmostEqual(v,
+                    [1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0] + translation + [1.0])
+
+    def testSchedulingType(self):
+        """
+        Validate that the proxy shapes are scheduled as parallel.
+        """
+        cmds.file(new=True, force=True)
+        nodeDagPath, stage = createProxyFromFile(self.testFiles[0])
+
+        selection = OpenMaya.MSelectionList()
+        selection.add(nodeDagPath)
+        node = OpenMaya.MObject()
+        selection.getDependNode(0, node)
+        proxyShape = OpenMaya.MFnDependencyNode(node).userNode()
+        self.assertEqual(proxyShape.schedulingType(), OpenMayaMPx.MPxNode.kParallel)
+
+    def testStageSetNoticeOnIdle(self):
+        """
+        Validate that the stages set by the computes of the evaluation manager, which can run on
+        worker threads, are known to UFE once idle: their edits are observed.
+        """
+        cmds.file(new=True, force=True)
+        with NonCachingScope(self) as thisScope:
+            thisScope.verifyScopeSetup()
+            nodes = [createProxyFromFile(f)[0] for f in self.testFiles[:2]]
+
+            # Let the evaluation manager build its graph, then change the stages and let it
+            # compute them.
+            cmds.currentTime(2)
+            for node, f in zip(nodes, self.testFiles[2:4]):
+                cmds.setAttr('{}.filePath'.format(node), f, type='string')
+            cmds.currentTime(3)
+            cmds.flushIdleQueue()
+
+            for node, f in zip(nodes, self.testFiles[2:4]):
+                stage = mayaUsdLib.GetPrim(node).GetStage()
+                self.assertEqual(os.path.basename(stage.GetRootLayer().realPath), os.path.basename(f))
+
+                ufeItem = createUfeSceneItem(node,'/ParentB')
+                obs = TestObserver()
+                ufe.Attributes.addObserver(ufeItem, obs)
+                UsdGeom.XformCommonAPI(stage.GetPrimAtPath('/ParentB')).SetTranslate((2,20,0))
+                self.assertGreater(obs.notifications, 0)
+                ufe.Attributes.removeObserver(ufeItem, obs)
+
+    def testChains_NoCaching(self):
+        """
+        Validate accessor chains through several proxy shapes evaluated in parallel.
+        Cached playback is disabled in this test.
+        """
+        cmds.file(new=True, force=True)
+        with NonCachingScope(self) as thisScope:
+            thisScope.verifyScopeSetup()
+            self.validateChains(thisScope)
+
+    def testChains_Caching(self):
+        """
+        Validate accessor chains through several proxy shapes evaluated in parallel.
+        Cached playback is ENABLED in this test.
+        """
+        cmds.file(new=True, force=True)
+        with CachingScope(self) as thisScope:
+            thisScope.verifyScopeSetup()
+            self.validateChains(thisScope)
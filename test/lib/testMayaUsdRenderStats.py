@@ -0,0 +1,59 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import unittest
+
+from maya import cmds
+
+from mayaUsd import lib as mayaUsdLib
+
+class MayaUsdRenderStatsTestCase(unittest.TestCase):
+    """Test the command and the Python binding querying the VP2 render delegate statistics."""
+
+    @classmethod
+    def setUpClass(cls):
+        cmds.loadPlugin('mayaUsdPlugin')
+
+    def tearDown(self):
+        cmds.mayaUsdRenderStats(enable=False)
+
+    def testEnable(self):
+        cmds.mayaUsdRenderStats(enable=True)
+        self.assertTrue(cmds.mayaUsdRenderStats(query=True, enable=True))
+        self.assertTrue(mayaUsdLib.RenderStats.IsEnabled())
+
+        mayaUsdLib.RenderStats.Disable()
+        self.assertFalse(cmds.mayaUsdRenderStats(query=True, enable=True))
+
+    def testCounters(self):
+        names = cmds.mayaUsdRenderStats(list=True)
+        self.assertIn('vp2RprimsSynced', names)
+        self.assertIn('vp2ExecuteTimeMs', names)
+
+        values = cmds.mayaUsdRenderStats()
+        self.assertEqual(len(names), len(values))
+
+        counters = mayaUsdLib.RenderStats.GetCounters()
+        self.assertEqual(sorted(names), sorted(counters.keys()))
+        for name, value in zip(names, values):
+            self.assertEqual(cmds.mayaUsdRenderStats(counter=name), value)
+            self.assertEqual(counters[name], value)
+
+    def testInvalidCounter(self):
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUsdRenderStats(counter='notACounter')
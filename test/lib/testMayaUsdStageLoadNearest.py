@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import unittest
+
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+
+import mayaUsd.lib
+import mayaUsd_createStageWithNewLayer
+
+import fixturesUtils
+
+
+class MayaUsdStageLoadNearestTestCase(unittest.TestCase):
+    """Test the mayaUsdStageLoadNearest command, which loads the payloads nearest to a camera
+    and unloads the others."""
+
+    PAYLOAD_PATHS = ['/P0', '/P1', '/P2', '/P3']
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        # Payloads 10 units apart along X, all loaded.
+        self.proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        self.stage = mayaUsd.lib.GetPrim(self.proxyShape).GetStage()
+        self.stage.CreateClassPrim('/_Source')
+        self.stage.DefinePrim('/_Source/Geom', 'Sphere')
+        for i, path in enumerate(self.PAYLOAD_PATHS):
+            prim = self.stage.DefinePrim(path, 'Xform')
+            prim.GetPayloads().AddInternalPayload('/_Source')
+            UsdGeom.XformCommonAPI(prim).SetTranslate((i * 10, 0, 0))
+        self.stage.Load()
+
+        self.camera = cmds.camera()[0]
+
+    def _loadNearest(self, cameraX, maxPayloads):
+        cmds.move(cameraX, 0, 0, self.camera)
+        cmds.mayaUsdStageLoadNearest(self.proxyShape, camera=self.camera, maxPayloads=maxPayloads)
+
+    def _getLoaded(self):
+        return [p for p in self.PAYLOAD_PATHS if self.stage.GetPrimAtPath(p).IsLoaded()]
+
+    def testLoadNearest(self):
+        self._loadNearest(-5, 2)
+        self.assertEqual(self._getLoaded(), ['/P0', '/P1'])
+
+        # Only the loaded prims have the content of their payload.
+        self.assertTrue(self.stage.GetPrimAtPath('/P0/Geom'))
+        self.assertFalse(self.stage.GetPrimAtPath('/P3/Geom'))
+
+        # Moving the camera streams the payloads in and out.
+        self._loadNearest(35, 2)
+        self.assertEqual(self._getLoaded(), ['/P2', '/P3'])
+
+        self._loadNearest(12, 3)
+        self.assertEqual(self._getLoaded(), ['/P0', '/P1', '/P2'])
+
+    def testUndoRedo(self):
+        self._loadNearest(-5, 1)
+        self.assertEqual(self._getLoaded(), ['/P0'])
+
+        cmds.undo()
+        self.assertEqual(self._getLoaded(), self.PAYLOAD_PATHS)
+
+        cmds.redo()
+        self.assertEqual(self._getLoaded(), ['/P0'])
+
+    def testProxyShapeTransform(self):
+        # The distances are measured in world space.
+        cmds.move(100, 0, 0, cmds.listRelatives(self.proxyShape, parent=True)[0])
+        self._loadNearest(112, 2)
+        self.assertEqual(self._getLoaded(), ['/P1', '/P2'])
+
+    def testInvalidCamera(self):
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUsdStageLoadNearest(self.proxyShape, camera='noSuchCamera')
+        self.assertEqual(self._getLoaded(), self.PAYLOAD_PATHS)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -23,7 +23,10 @@ import testUtils
 
 from maya import cmds
 
-from pxr import UsdShade, Sdf
+from pxr import UsdShade, Sdf, Tf, Usd
+
+import mayaUsd.ufe
+import mayaUsd_createStageWithNewLayer
 
 import os
 import ufe
@@ -364,5 +367,68 @@ class BatchOpsHandlerTestCase(unittest.TestCase):
         checkStatus(self, cmd, geomItem)
 
 
+    def testTransformSelection(self):
+        """Transform several prims at once, with one USD change notice per step."""
+        proxyShapePathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.ufe.getStage(proxyShapePathStr)
+        for primPath in ['/A', '/A/Child', '/B']:
+            stage.DefinePrim(primPath, 'Xform')
+
+        ufePathStrs = [proxyShapePathStr + ',' + p for p in ['/A', '/A/Child', '/B']]
+
+        def t3d(ufePathStr):
+            return ufe.Transform3d.transform3d(
+                ufe.Hierarchy.createItem(ufe.PathString.path(ufePathStr)))
+
+        # The child is transformed with its parent, it is not part of the command.
+        cmd = mayaUsd.ufe.translateSelectionCmd(ufePathStrs)
+        self.assertIsNotNone(cmd)
+        self.assertEqual(cmd.paths(), [ufePathStrs[0], ufePathStrs[2]])
+
+        notices = []
+        listener = Tf.Notice.Register(
+            Usd.Notice.ObjectsChanged, lambda notice, sender: notices.append(notice), stage)
+
+        # The first step may add the transform ops, the next ones set all the
+        # values in a single change block.
+        self.assertTrue(cmd.set(1, 2, 3))
+        del notices[:]
+        self.assertTrue(cmd.set(4, 5, 6))
+        self.assertEqual(len(notices), 1)
+        for ufePathStr in cmd.paths():
+            self.assertEqual(t3d(ufePathStr).translation().vector, [4, 5, 6])
+        self.assertEqual(t3d(ufePathStrs[1]).translation().vector, [0, 0, 0])
+
+        # Undo and redo the whole selection in a single change block too.
+        del notices[:]
+        cmd.undo()
+        self.assertEqual(len(notices), 1)
+        for ufePathStr in cmd.paths():
+            self.assertEqual(t3d(ufePathStr).translation().vector, [0, 0, 0])
+
+        del notices[:]
+        cmd.redo()
+        self.assertEqual(len(notices), 1)
+        for ufePathStr in cmd.paths():
+            self.assertEqual(t3d(ufePathStr).translation().vector, [4, 5, 6])
+
+        listener.Revoke()
+
+        # Rotate and scale take one value per item.
+        cmd = mayaUsd.ufe.rotateSelectionCmd(ufePathStrs)
+        self.assertTrue(cmd.setValues([(10, 0, 0), (0, 20, 0)]))
+        testUtils.assertVectorAlmostEqual(self, t3d(ufePathStrs[0]).rotation().vector, [10, 0, 0])
+        testUtils.assertVectorAlmostEqual(self, t3d(ufePathStrs[2]).rotation().vector, [0, 20, 0])
+
+        cmd = mayaUsd.ufe.scaleSelectionCmd(ufePathStrs)
+        self.assertTrue(cmd.setValues([(2, 2, 2), (3, 3, 3)]))
+        testUtils.assertVectorAlmostEqual(self, t3d(ufePathStrs[0]).scale().vector, [2, 2, 2])
+        testUtils.assertVectorAlmostEqual(self, t3d(ufePathStrs[2]).scale().vector, [3, 3, 3])
+        cmd.undo()
+        testUtils.assertVectorAlmostEqual(self, t3d(ufePathStrs[0]).scale().vector, [1, 1, 1])
+
+        # Nothing can be transformed without USD items.
+        self.assertIsNone(mayaUsd.ufe.translateSelectionCmd([]))
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -0,0 +1,114 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+/**
+ * @brief  Export chasers which run concurrently with each other. They only read the exported
+ *         stage, which is safe from several threads, and neither author USD nor call the Maya
+ *         API. Each of them keeps the largest X coordinate of the mesh points at each exported
+ *         time, and writes them to the text file given by its "file" chaser argument after the
+ *         export, one "<time> <maxX>" line per time.
+ *
+ *         Sample export command:
+ *         cmds.mayaUSDExport(
+ *             file='/tmp/test.usda',
+ *             frameRange=(1, 3),
+ *             chaser=['concurrentA', 'concurrentB'],
+ *             chaserArgs=[
+ *                 ('concurrentA', 'file', '/tmp/concurrentA.txt'),
+ *                 ('concurrentB', 'file', '/tmp/concurrentB.txt')])
+ */
+#include <mayaUsd/fileio/chaser/exportChaser.h>
+#include <mayaUsd/fileio/chaser/exportChaserRegistry.h>
+#include <mayaUsd/fileio/jobs/jobArgs.h>
+
+#include <pxr/base/tf/stl.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class ConcurrentExportChaser : public UsdMayaExportChaser
+{
+public:
+    ConcurrentExportChaser(const UsdStagePtr& stage, const std::string& fileName)
+        : _stage(stage)
+        , _fileName(fileName)
+    {
+    }
+
+    bool ExportDefault() override { return ExportFrame(UsdTimeCode::Default()); }
+
+    bool ExportFrame(const UsdTimeCode& time) override
+    {
+        float maxX = std::numeric_limits<float>::lowest();
+        for (const UsdPrim& prim : _stage->Traverse()) {
+            VtVec3fArray points;
+            if (prim.IsA<UsdGeomMesh>() && UsdGeomMesh(prim).GetPointsAttr().Get(&points, time)) {
+                for (const GfVec3f& point : points) {
+                    maxX = std::max(maxX, point[0]);
+                }
+            }
+        }
+        _maxX.emplace_back(time, maxX);
+        return true;
+    }
+
+    bool PostExport() override
+    {
+        std::ofstream file(_fileName);
+        for (const auto& sample : _maxX) {
+            file << sample.first << " " << sample.second << "\n";
+        }
+        return file.good();
+    }
+
+    bool CanRunConcurrently() const override { return true; }
+
+private:
+    UsdStagePtr                                 _stage;
+    std::string                                 _fileName;
+    std::vector<std::pair<UsdTimeCode, float>> _maxX;
+};
+
+static UsdMayaExportChaser*
+_CreateChaser(const UsdMayaExportChaserRegistry::FactoryContext& ctx, const std::string& name)
+{
+    std::map<std::string, std::string> myArgs;
+    TfMapLookup(ctx.GetJobArgs().allChaserArgs, name, &myArgs);
+
+    return new ConcurrentExportChaser(ctx.GetStage(), myArgs["file"]);
+}
+
+PXRUSDMAYA_DEFINE_EXPORT_CHASER_FACTORY(concurrentA, ctx)
+{
+    return _CreateChaser(ctx, "concurrentA");
+}
+
+PXRUSDMAYA_DEFINE_EXPORT_CHASER_FACTORY(concurrentB, ctx)
+{
+    return _CreateChaser(ctx, "concurrentB");
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,100 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+class testUsdExportAnimatedVisibility(unittest.TestCase):
+    """
+    Static shapes are only written at the time samples when something they write is animated.
+    This includes their visibility, which is combined with the visibility of the parent
+    transform when the transform and the shape are merged.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        # Static mesh under a transform with animated visibility.
+        cmds.polyCube(name='TransformVisCube')
+        cmds.setKeyframe('TransformVisCube.visibility', time=1, value=1)
+        cmds.setKeyframe('TransformVisCube.visibility', time=3, value=0)
+
+        # Static mesh with animated visibility under a static transform.
+        cmds.polyCube(name='ShapeVisCube')
+        cmds.setKeyframe('ShapeVisCubeShape.visibility', time=1, value=1)
+        cmds.setKeyframe('ShapeVisCubeShape.visibility', time=3, value=0)
+
+        # Fully static mesh.
+        cmds.polyCube(name='StaticCube')
+
+    def _export(self, name, mergeTransformAndShape):
+        usdFile = os.path.abspath(name)
+        cmds.usdExport(file=usdFile, frameRange=(1, 3), exportVisibility=True,
+            mergeTransformAndShape=mergeTransformAndShape)
+        return Usd.Stage.Open(usdFile)
+
+    def _assertVisibilitySamples(self, stage, primPath):
+        visibility = UsdGeom.Imageable.Get(stage, primPath).GetVisibilityAttr()
+        # The sparse value writer may drop the redundant samples.
+        self.assertTrue(visibility.ValueMightBeTimeVarying())
+        self.assertEqual(visibility.Get(1), UsdGeom.Tokens.inherited)
+        self.assertEqual(visibility.Get(2), UsdGeom.Tokens.inherited)
+        self.assertEqual(visibility.Get(3), UsdGeom.Tokens.invisible)
+
+    def testMergedShapeVisibility(self):
+        stage = self._export('AnimatedVisibilityMerged.usda', True)
+
+        self._assertVisibilitySamples(stage, '/TransformVisCube')
+        self._assertVisibilitySamples(stage, '/ShapeVisCube')
+
+        # The mesh data itself is static.
+        for primPath in ('/TransformVisCube', '/ShapeVisCube', '/StaticCube'):
+            mesh = UsdGeom.Mesh.Get(stage, primPath)
+            self.assertEqual(mesh.GetPointsAttr().GetNumTimeSamples(), 0)
+
+        visibility = UsdGeom.Imageable.Get(stage, '/StaticCube').GetVisibilityAttr()
+        self.assertEqual(visibility.GetNumTimeSamples(), 0)
+
+    def testUnmergedShapeVisibility(self):
+        stage = self._export('AnimatedVisibilityUnmerged.usda', False)
+
+        self._assertVisibilitySamples(stage, '/TransformVisCube')
+        self._assertVisibilitySamples(stage, '/ShapeVisCube/ShapeVisCubeShape')
+
+        visibility = UsdGeom.Imageable.Get(
+            stage, '/TransformVisCube/TransformVisCubeShape').GetVisibilityAttr()
+        self.assertEqual(visibility.GetNumTimeSamples(), 0)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
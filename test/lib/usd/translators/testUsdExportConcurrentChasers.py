@@ -0,0 +1,108 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUsd.lib as mayaUsdLib
+import maya.cmds as cmds
+import maya.standalone as mayastandalone
+import os
+import unittest
+from pxr import Usd, UsdGeom
+
+
+class serialExportChaser(mayaUsdLib.ExportChaser):
+    Concurrent = None
+    Frames = []
+
+    def __init__(self, factoryContext, *args, **kwargs):
+        super(serialExportChaser, self).__init__(factoryContext, *args, **kwargs)
+        serialExportChaser.Concurrent = self.CanRunConcurrently()
+        serialExportChaser.Frames = []
+
+    def ExportFrame(self, frame):
+        serialExportChaser.Frames.append(frame)
+        return True
+
+
+class TestUsdExportConcurrentChasers(unittest.TestCase):
+    """
+    Export with the chasers of test/lib/usd/plugin/concurrentExportChaser.cpp, which opt in to
+    run concurrently, followed by a Python chaser, which always runs on the main thread.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 3
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+        cls.temp_dir = os.path.abspath('.')
+
+    @classmethod
+    def tearDownClass(cls):
+        mayastandalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        _, creator = cmds.polyCube(name='Cube')
+        cmds.setKeyframe(creator, attribute='width', time=self.START_FRAME, value=1)
+        cmds.setKeyframe(creator, attribute='width', time=self.END_FRAME, value=3)
+
+    def _ReadMaxX(self, fileName):
+        """Return the times and the values written by a concurrent chaser."""
+        samples = []
+        with open(fileName) as f:
+            for line in f:
+                time, maxX = line.split()
+                samples.append((time, float(maxX)))
+        return samples
+
+    def testConcurrentChasers(self):
+        cmds.loadPlugin('usdTestConcurrentExportChaser')
+        mayaUsdLib.ExportChaser.Register(serialExportChaser, 'serial')
+
+        usdFile = os.path.join(self.temp_dir, 'ConcurrentChasers.usda')
+        chaserFiles = {name: os.path.join(self.temp_dir, name + '.txt')
+            for name in ('concurrentA', 'concurrentB')}
+        cmds.mayaUSDExport(file=usdFile,
+            frameRange=(self.START_FRAME, self.END_FRAME),
+            chaser=['concurrentA', 'concurrentB', 'serial'],
+            chaserArgs=[(name, 'file', f) for name, f in chaserFiles.items()])
+
+        # The Python chaser is not concurrent, and still sees every frame after the others.
+        self.assertFalse(serialExportChaser.Concurrent)
+        self.assertEqual(len(serialExportChaser.Frames), self.END_FRAME - self.START_FRAME + 1)
+
+        stage = Usd.Stage.Open(usdFile)
+        points = UsdGeom.Mesh.Get(stage, '/Cube').GetPointsAttr()
+
+        for name, f in chaserFiles.items():
+            samples = self._ReadMaxX(f)
+            self.assertEqual(len(samples), self.END_FRAME - self.START_FRAME + 2, name)
+
+            # The default time comes first, then each frame read from the exported stage.
+            self.assertEqual(samples[0][0], 'DEFAULT', name)
+            for frame, (time, maxX) in zip(
+                    range(self.START_FRAME, self.END_FRAME + 1), samples[1:]):
+                self.assertAlmostEqual(float(time), frame, msg=name)
+                self.assertAlmostEqual(
+                    maxX, max(p[0] for p in points.Get(frame)), places=4, msg=name)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,133 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+from maya.api import OpenMaya
+
+import fixturesUtils
+
+class testUsdExportDeformedMeshes(unittest.TestCase):
+    """
+    Export meshes and a curve deformed by their history at every frame, and compare their points
+    to the points evaluated by Maya at each frame.
+
+    The test is run with the default export, with MAYAUSD_EXPORT_PARALLEL_FRAME_READS, which
+    reads the meshes from worker threads, and with MAYAUSD_EXPORT_CONTEXT_SAMPLING, which
+    evaluates the frames in a DG context without changing the current time. All must give the
+    same points.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 10
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        self.meshNames = []
+
+        # Meshes animated by their creation node.
+        for i in range(4):
+            name, creator = cmds.polyCube(name='HistoryCube%d' % i)
+            cmds.setKeyframe(creator, attribute='width', time=self.START_FRAME, value=1)
+            cmds.setKeyframe(creator, attribute='width', time=self.END_FRAME, value=2 + i)
+            self.meshNames.append(name)
+
+        # Meshes animated by a deformer.
+        for i in range(4):
+            name = cmds.polySphere(name='BentSphere%d' % i)[0]
+            bend, bendHandle = cmds.nonLinear(name, type='bend')
+            cmds.setKeyframe(bend, attribute='curvature', time=self.START_FRAME, value=0)
+            cmds.setKeyframe(bend, attribute='curvature', time=self.END_FRAME, value=90 + 10 * i)
+            self.meshNames.append(name)
+
+        name = cmds.polyPlane(name='ClusterPlane')[0]
+        cluster, clusterHandle = cmds.cluster('%s.vtx[0:10]' % name)
+        cmds.setKeyframe(clusterHandle, attribute='translateY', time=self.START_FRAME, value=0)
+        cmds.setKeyframe(clusterHandle, attribute='translateY', time=self.END_FRAME, value=3)
+        self.meshNames.append(name)
+
+        self.curveName = cmds.curve(name='ClusterCurve', degree=3,
+            point=[(0, 0, 0), (1, 0, 0), (2, 0, 0), (3, 0, 0)])
+        cluster, clusterHandle = cmds.cluster('%s.cv[0:1]' % self.curveName)
+        cmds.setKeyframe(clusterHandle, attribute='translateY', time=self.START_FRAME, value=0)
+        cmds.setKeyframe(clusterHandle, attribute='translateY', time=self.END_FRAME, value=2)
+
+    def _GetDagPath(self, name):
+        selectionList = OpenMaya.MSelectionList()
+        selectionList.add(name)
+        return selectionList.getDagPath(0)
+
+    def _GetMayaPoints(self, meshName):
+        meshFn = OpenMaya.MFnMesh(self._GetDagPath(meshName))
+        return meshFn.getPoints(OpenMaya.MSpace.kObject)
+
+    def _GetMayaCVs(self, curveName):
+        curveFn = OpenMaya.MFnNurbsCurve(self._GetDagPath(curveName))
+        return curveFn.cvPositions(OpenMaya.MSpace.kObject)
+
+    def _AssertPointsEqual(self, usdPoints, mayaPoints, msg):
+        self.assertEqual(len(usdPoints), len(mayaPoints), msg)
+        for usdPoint, mayaPoint in zip(usdPoints, mayaPoints):
+            for c in range(3):
+                self.assertAlmostEqual(usdPoint[c], mayaPoint[c], places=4, msg=msg)
+
+    def testDeformedPoints(self):
+        usdFile = os.path.abspath('DeformedMeshes.usda')
+        cmds.usdExport(file=usdFile, frameRange=(self.START_FRAME, self.END_FRAME))
+
+        stage = Usd.Stage.Open(usdFile)
+        curve = UsdGeom.NurbsCurves.Get(stage, '/' + self.curveName)
+        self.assertTrue(curve, self.curveName)
+
+        for frame in range(self.START_FRAME, self.END_FRAME + 1):
+            cmds.currentTime(frame)
+            for meshName in self.meshNames:
+                mesh = UsdGeom.Mesh.Get(stage, '/' + meshName)
+                self.assertTrue(mesh, meshName)
+
+                self._AssertPointsEqual(mesh.GetPointsAttr().Get(frame),
+                    self._GetMayaPoints(meshName), '%s at frame %d' % (meshName, frame))
+
+            self._AssertPointsEqual(curve.GetPointsAttr().Get(frame),
+                self._GetMayaCVs(self.curveName), '%s at frame %d' % (self.curveName, frame))
+
+        # The samples must follow the deformation, and not repeat the points of one frame.
+        for meshName in self.meshNames:
+            points = UsdGeom.Mesh.Get(stage, '/' + meshName).GetPointsAttr()
+            self.assertNotEqual(points.Get(self.START_FRAME), points.Get(self.END_FRAME),
+                meshName)
+        points = curve.GetPointsAttr()
+        self.assertNotEqual(points.Get(self.START_FRAME), points.Get(self.END_FRAME))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
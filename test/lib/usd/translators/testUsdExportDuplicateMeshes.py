@@ -0,0 +1,104 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+class testUsdExportDuplicateMeshes(unittest.TestCase):
+    """
+    Export with the instanceDuplicateMeshes option, which writes the identical static meshes as
+    instances of a single mesh.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        # Two identical cubes at different places, and a different one.
+        cmds.polyCube(name='CubeA')
+        cmds.polyCube(name='CubeB')
+        cmds.move(5, 0, 0, 'CubeB')
+        cmds.polyCube(name='CubeC', width=2)
+        cmds.move(-5, 0, 0, 'CubeC')
+
+        # An animated copy of the first cube.
+        cmds.polyCube(name='CubeD')
+        cmds.setKeyframe('CubeDShape.pnts[0].pntx', time=1, value=0)
+        cmds.setKeyframe('CubeDShape.pnts[0].pntx', time=2, value=1)
+
+    def _export(self, fileName, instanceDuplicateMeshes):
+        usdFile = os.path.abspath(fileName)
+        cmds.usdExport(file=usdFile, shadingMode='none',
+            instanceDuplicateMeshes=instanceDuplicateMeshes)
+        return Usd.Stage.Open(usdFile)
+
+    def _getInstances(self, stage, rootPath):
+        return [p for p in Usd.PrimRange(stage.GetPrimAtPath(rootPath)) if p.IsInstance()]
+
+    def _getPrototype(self, prim):
+        return prim.GetPrototype() if hasattr(prim, 'GetPrototype') else prim.GetMaster()
+
+    def testDuplicateMeshes(self):
+        stage = self._export('DuplicateMeshes.usda', True)
+
+        # The identical cubes reference the same mesh, at their own place.
+        instancesA = self._getInstances(stage, '/CubeA')
+        instancesB = self._getInstances(stage, '/CubeB')
+        self.assertEqual(len(instancesA), 1)
+        self.assertEqual(len(instancesB), 1)
+        self.assertEqual(self._getPrototype(instancesA[0]), self._getPrototype(instancesB[0]))
+
+        xformCache = UsdGeom.XformCache()
+        self.assertEqual(
+            xformCache.GetLocalToWorldTransform(instancesB[0]).ExtractTranslation()[0], 5)
+
+        sources = stage.GetPrimAtPath('/MayaExportedInstanceSources')
+        masterMeshes = [p for p in Usd.PrimRange(sources) if p.IsA(UsdGeom.Mesh)]
+        self.assertEqual(len(masterMeshes), 1)
+        self.assertEqual(len(UsdGeom.Mesh(masterMeshes[0]).GetPointsAttr().Get()), 8)
+
+        # The different and the animated cubes are exported as usual.
+        for rootPath in ('/CubeC', '/CubeD'):
+            self.assertEqual(self._getInstances(stage, rootPath), [], rootPath)
+            self.assertTrue(UsdGeom.Mesh.Get(stage, rootPath), rootPath)
+
+    def testNoDuplicateMeshes(self):
+        stage = self._export('NoDuplicateMeshes.usda', False)
+
+        self.assertFalse(stage.GetPrimAtPath('/MayaExportedInstanceSources'))
+        for rootPath in ('/CubeA', '/CubeB', '/CubeC', '/CubeD'):
+            self.assertEqual(self._getInstances(stage, rootPath), [], rootPath)
+            self.assertTrue(UsdGeom.Mesh.Get(stage, rootPath), rootPath)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,120 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Sdf
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+class testUsdExportIncremental(unittest.TestCase):
+    """
+    Export several times with the incrementalExport option, which only writes again the prims
+    of the Maya nodes changed since the previous export of the file.
+
+    A marker attribute is added to the exported layer between the exports. It is kept on the
+    prims that are not written again, and removed from the others.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        cmds.polyCube(name='CubeA')
+        cmds.polyCube(name='CubeB')
+
+    def _export(self, usdFile, incrementalExport=True):
+        cmds.usdExport(file=usdFile, shadingMode='none', incrementalExport=incrementalExport)
+
+    def _addMarkers(self, usdFile):
+        layer = Sdf.Layer.FindOrOpen(usdFile)
+        for primPath in ('/CubeA', '/CubeB'):
+            Sdf.AttributeSpec(layer.GetPrimAtPath(primPath), 'marker', Sdf.ValueTypeNames.Int)
+        layer.Save()
+
+    def _hasMarker(self, usdFile, primPath):
+        stage = Usd.Stage.Open(usdFile)
+        stage.Reload()
+        return stage.GetPrimAtPath(primPath).HasAttribute('marker')
+
+    def _getTranslateX(self, usdFile, primPath):
+        stage = Usd.Stage.Open(usdFile)
+        stage.Reload()
+        prim = stage.GetPrimAtPath(primPath)
+        return UsdGeom.XformCommonAPI(prim).GetXformVectors(Usd.TimeCode.Default())[0][0]
+
+    def testChangedNodes(self):
+        usdFile = os.path.abspath('IncrementalChangedNodes.usda')
+        self._export(usdFile)
+        self._addMarkers(usdFile)
+
+        # Only the prim of the moved cube is written again.
+        cmds.move(3, 0, 0, 'CubeA')
+        self._export(usdFile)
+        self.assertAlmostEqual(self._getTranslateX(usdFile, '/CubeA'), 3)
+        self.assertFalse(self._hasMarker(usdFile, '/CubeA'))
+        self.assertTrue(self._hasMarker(usdFile, '/CubeB'))
+
+        # Nothing changed, nothing is written.
+        self._addMarkers(usdFile)
+        self._export(usdFile)
+        self.assertTrue(self._hasMarker(usdFile, '/CubeA'))
+        self.assertTrue(self._hasMarker(usdFile, '/CubeB'))
+
+    def testStructuralChange(self):
+        usdFile = os.path.abspath('IncrementalStructuralChange.usda')
+        self._export(usdFile)
+        self._addMarkers(usdFile)
+
+        # A new node can change the paths of the others, the whole file is written again.
+        cmds.polyCube(name='CubeC')
+        self._export(usdFile)
+        self.assertFalse(self._hasMarker(usdFile, '/CubeA'))
+        self.assertFalse(self._hasMarker(usdFile, '/CubeB'))
+        self.assertTrue(Usd.Stage.Open(usdFile).GetPrimAtPath('/CubeC'))
+
+    def testDifferentArguments(self):
+        usdFile = os.path.abspath('IncrementalDifferentArguments.usda')
+        self._export(usdFile)
+        self._addMarkers(usdFile)
+
+        # Exporting without the option, or with other arguments, writes the whole file.
+        self._export(usdFile, incrementalExport=False)
+        self.assertFalse(self._hasMarker(usdFile, '/CubeB'))
+
+        self._export(usdFile)
+        self._addMarkers(usdFile)
+        cmds.usdExport(file=usdFile, shadingMode='none', incrementalExport=True,
+            exportVisibility=False)
+        self.assertFalse(self._hasMarker(usdFile, '/CubeB'))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
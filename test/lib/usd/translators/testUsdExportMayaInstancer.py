@@ -113,6 +113,40 @@ class testUsdExportMayaInstancer(unittest.TestCase):
         self.assertEqual(prototypes, [protoPrim.GetPath()])
         
 
+    def testExportSharedPrototypes(self):
+        """
+        Tests that instancers sharing a prototype only export it once, the
+        following instancers referencing the prototype of the first one.
+        """
+        cmds.file(self.mayaFile, open=True, force=True)
+        otherInstancer = cmds.duplicate('instancer1', inputConnections=True)[0]
+
+        stage = self.doExport()
+        self.assertTrue(stage)
+
+        protoPrimPath = '/group1/instancer1/Prototypes/pCube1_0'
+        protoPrim = stage.GetPrimAtPath(protoPrimPath)
+        self.assertTrue(UsdGeom.Mesh(protoPrim))
+        self.assertFalse(protoPrim.HasAuthoredReferences())
+
+        otherInstancerPrim = stage.GetPrimAtPath('/group1/%s' % otherInstancer)
+        otherInstancer = UsdGeom.PointInstancer(otherInstancerPrim)
+        self.assertTrue(otherInstancer)
+
+        otherProtoPrimPath = otherInstancerPrim.GetPath().AppendPath('Prototypes/pCube1_0')
+        self.assertEqual(
+            otherInstancer.GetPrototypesRel().GetTargets(), [otherProtoPrimPath])
+
+        otherProtoPrim = stage.GetPrimAtPath(otherProtoPrimPath)
+        self.assertTrue(UsdGeom.Mesh(otherProtoPrim))
+        self.assertTrue(otherProtoPrim.HasAuthoredReferences())
+
+        # The mesh data is only authored on the first prototype.
+        pointsAttr = UsdGeom.Mesh(otherProtoPrim).GetPointsAttr()
+        self.assertEqual(
+            pointsAttr.GetResolveInfo().GetNode().GetPath(), protoPrim.GetPath())
+
+
 def addExportInstancerTest(namespacedInstancer, namespacedPrototype,
                            stripNamespaces):
     def testMethod(self):
@@ -0,0 +1,102 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+class testUsdExportNurbsSurface(unittest.TestCase):
+    """
+    Export an animated NURBS surface. The points and extent are written on every frame, and the
+    attributes authored at the default time are gathered on the first written frame only.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 3
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        # The number of patches changes the topology, which is authored at the default time.
+        _, self.creator = cmds.nurbsPlane(name='Plane', degree=3)
+        cmds.setKeyframe(self.creator, attribute='patchesU', time=self.START_FRAME, value=1)
+        cmds.setKeyframe(self.creator, attribute='patchesU', time=self.END_FRAME, value=3)
+        cmds.setKeyframe(self.creator, attribute='width', time=self.START_FRAME, value=1)
+        cmds.setKeyframe(self.creator, attribute='width', time=self.END_FRAME, value=3)
+
+    def _export(self, fileName):
+        usdFile = os.path.abspath(fileName)
+        cmds.usdExport(file=usdFile, shadingMode='none', exportDisplayColor=True,
+            frameRange=(self.START_FRAME, self.END_FRAME))
+        return UsdGeom.NurbsPatch.Get(Usd.Stage.Open(usdFile), '/Plane')
+
+    def testAnimatedSurface(self):
+        patch = self._export('AnimatedNurbsSurface.usda')
+        self.assertTrue(patch)
+
+        # The points and the extent are sampled on every frame.
+        frameCount = self.END_FRAME - self.START_FRAME + 1
+        self.assertEqual(patch.GetPointsAttr().GetNumTimeSamples(), frameCount)
+        self.assertEqual(patch.GetExtentAttr().GetNumTimeSamples(), frameCount)
+        for frame in range(self.START_FRAME, self.END_FRAME + 1):
+            patchesU = cmds.getAttr(self.creator + '.patchesU', time=frame)
+            self.assertEqual(len(patch.GetPointsAttr().Get(frame)), (patchesU + 3) * 4,
+                'frame %d' % frame)
+
+        # The other attributes are only authored at the default time.
+        attrs = [
+            patch.GetUVertexCountAttr(),
+            patch.GetVVertexCountAttr(),
+            patch.GetUOrderAttr(),
+            patch.GetVOrderAttr(),
+            patch.GetUKnotsAttr(),
+            patch.GetVKnotsAttr(),
+            patch.GetURangeAttr(),
+            patch.GetVRangeAttr(),
+            patch.GetUFormAttr(),
+            patch.GetVFormAttr(),
+            patch.GetDisplayColorAttr(),
+        ]
+        for attr in attrs:
+            self.assertTrue(attr.HasAuthoredValue(), attr.GetName())
+            self.assertEqual(attr.GetNumTimeSamples(), 0, attr.GetName())
+
+        # Their values are the ones of the first frame.
+        self.assertEqual(patch.GetUVertexCountAttr().Get(), 4)
+        self.assertEqual(patch.GetVVertexCountAttr().Get(), 4)
+        # Maya has numCVs + degree - 1 knots, the writer pads them with one knot on each side.
+        self.assertEqual(len(patch.GetUKnotsAttr().Get()), 4 + 3 - 1 + 2)
+        self.assertEqual(patch.GetUOrderAttr().Get(), 4)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,100 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Usd
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+class testUsdExportTargets(unittest.TestCase):
+    """
+    Export two groups with the exportTarget flag, which writes each of them to its own file in a
+    single export.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 5
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        # Two groups, each with a cube animated differently.
+        for name, endValue in (('A', 4), ('B', -8)):
+            cmds.polyCube(name='Cube' + name)
+            cmds.group('Cube' + name, name='Group' + name)
+            cmds.setKeyframe('Cube' + name + '.translateX', time=self.START_FRAME, value=0)
+            cmds.setKeyframe('Cube' + name + '.translateX', time=self.END_FRAME, value=endValue)
+
+    def _assertSameLayers(self, fileName, expectedFileName):
+        self.assertEqual(
+            Usd.Stage.Open(fileName).ExportToString(addSourceFileComment=False),
+            Usd.Stage.Open(expectedFileName).ExportToString(addSourceFileComment=False))
+
+    def testExportTargets(self):
+        fileA = os.path.abspath('ExportTargetA.usda')
+        fileB = os.path.abspath('ExportTargetB.usda')
+        cmds.mayaUSDExport(exportTarget=[('|GroupA', fileA), ('|GroupB', fileB)],
+            frameRange=(self.START_FRAME, self.END_FRAME), shadingMode='none')
+
+        # Each file only holds its own group.
+        stageA = Usd.Stage.Open(fileA)
+        self.assertTrue(stageA.GetPrimAtPath('/GroupA/CubeA'))
+        self.assertFalse(stageA.GetPrimAtPath('/GroupB'))
+
+        stageB = Usd.Stage.Open(fileB)
+        self.assertTrue(stageB.GetPrimAtPath('/GroupB/CubeB'))
+        self.assertFalse(stageB.GetPrimAtPath('/GroupA'))
+
+        # Each group has its own animation at every frame.
+        for stage, cube in ((stageA, '/GroupA/CubeA'), (stageB, '/GroupB/CubeB')):
+            translate = stage.GetPrimAtPath(cube).GetAttribute('xformOp:translate')
+            self.assertEqual(translate.GetTimeSamples(),
+                list(range(self.START_FRAME, self.END_FRAME + 1)))
+            for frame in range(self.START_FRAME, self.END_FRAME + 1):
+                self.assertAlmostEqual(translate.Get(frame)[0],
+                    cmds.getAttr(cube.split('/')[-1] + '.translateX', time=frame), places=5)
+
+        # The files are the ones the group would be exported to on its own.
+        for root, targetFile in (('|GroupA', fileA), ('|GroupB', fileB)):
+            expectedFile = os.path.abspath('ExportRoot%s.usda' % root[-1])
+            cmds.mayaUSDExport(file=expectedFile, exportRoots=[root],
+                frameRange=(self.START_FRAME, self.END_FRAME), shadingMode='none')
+            self._assertSameLayers(targetFile, expectedFile)
+
+    def testInvalidTarget(self):
+        fileA = os.path.abspath('InvalidExportTargetA.usda')
+        with self.assertRaises(RuntimeError):
+            cmds.mayaUSDExport(exportTarget=[('|GroupA', fileA), ('|Missing', 'Missing.usda')],
+                shadingMode='none')
+        self.assertFalse(os.path.isfile(fileA))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
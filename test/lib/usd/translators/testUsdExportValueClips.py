@@ -0,0 +1,121 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from pxr import Gf
+from pxr import Sdf
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+class testUsdExportValueClips(unittest.TestCase):
+    """
+    Export an animated cube with the valueClipFrames option, which writes the time samples to
+    value clip layers next to the exported file.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 10
+    CLIP_FRAMES = 4
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        cmds.polyCube(name='Cube')
+        cmds.setKeyframe('Cube.translateX', time=self.START_FRAME, value=0)
+        cmds.setKeyframe('Cube.translateX', time=self.END_FRAME, value=9)
+
+    def _export(self, fileName, valueClipFrames):
+        usdFile = os.path.abspath(fileName)
+        cmds.usdExport(file=usdFile, frameRange=(self.START_FRAME, self.END_FRAME),
+            valueClipFrames=valueClipFrames)
+        return usdFile
+
+    def _clipFile(self, usdFile, index):
+        base, ext = os.path.splitext(usdFile)
+        return '%s.clip%04d%s' % (base, index, ext)
+
+    def _assertTranslations(self, stage):
+        translate = stage.GetPrimAtPath('/Cube').GetAttribute('xformOp:translate')
+        for frame in range(self.START_FRAME, self.END_FRAME + 1):
+            self.assertAlmostEqual(translate.Get(frame)[0],
+                cmds.getAttr('Cube.translateX', time=frame), places=5, msg='frame %d' % frame)
+
+    def testValueClips(self):
+        usdFile = self._export('ValueClips.usda', self.CLIP_FRAMES)
+
+        # Frames 1 to 4, 5 to 8, and 9 to 10.
+        clipStarts = [1, 5, 9]
+        for index in range(len(clipStarts)):
+            clipFile = self._clipFile(usdFile, index)
+            self.assertTrue(os.path.isfile(clipFile), clipFile)
+
+            # Each clip holds the samples of its frames, even the ones equal to the last sample
+            # of the previous clip.
+            clipLayer = Sdf.Layer.FindOrOpen(clipFile)
+            times = clipLayer.ListTimeSamplesForPath('/Cube.xformOp:translate')
+            lastFrame = min(clipStarts[index] + self.CLIP_FRAMES - 1, self.END_FRAME)
+            self.assertEqual(list(times), list(range(clipStarts[index], lastFrame + 1)))
+        self.assertFalse(os.path.isfile(self._clipFile(usdFile, len(clipStarts))))
+
+        # The exported layer holds the static data and the clip metadata, not the samples.
+        layer = Sdf.Layer.FindOrOpen(usdFile)
+        self.assertEqual(layer.GetNumTimeSamplesForPath('/Cube.xformOp:translate'), 0)
+        self.assertTrue(layer.GetPrimAtPath('/Cube').HasInfo('clips'))
+
+        stage = Usd.Stage.Open(usdFile)
+        clips = Usd.ClipsAPI(stage.GetPrimAtPath('/Cube'))
+        self.assertEqual([p.path for p in clips.GetClipAssetPaths()],
+            ['./' + os.path.basename(self._clipFile(usdFile, i)) for i in range(len(clipStarts))])
+        self.assertEqual(list(clips.GetClipActive()),
+            [Gf.Vec2d(start, i) for i, start in enumerate(clipStarts)])
+        self.assertEqual(clips.GetClipPrimPath(), '/Cube')
+
+        # The mesh is static, it is only in the exported layer.
+        self.assertTrue(UsdGeom.Mesh.Get(stage, '/Cube').GetPointsAttr().HasAuthoredValue())
+
+        # The composed animation is the exported one.
+        self._assertTranslations(stage)
+
+    def testNoValueClips(self):
+        usdFile = self._export('NoValueClips.usda', 0)
+        self.assertFalse(os.path.isfile(self._clipFile(usdFile, 0)))
+
+        layer = Sdf.Layer.FindOrOpen(usdFile)
+        self.assertEqual(layer.GetNumTimeSamplesForPath('/Cube.xformOp:translate'),
+            self.END_FRAME - self.START_FRAME + 1)
+        self.assertFalse(layer.GetPrimAtPath('/Cube').HasInfo('clips'))
+
+        self._assertTranslations(Usd.Stage.Open(usdFile))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
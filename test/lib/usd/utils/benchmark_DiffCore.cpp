@@ -0,0 +1,154 @@
+#include <mayaUsdUtils/DiffCore.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  the timing of one kernel at one array size
+//----------------------------------------------------------------------------------------------------------------------
+struct BenchmarkResult
+{
+    std::string name;
+    size_t      count;
+    size_t      iterations;
+    double      nsPerIteration;
+};
+
+std::vector<BenchmarkResult> results;
+
+// Defeats dead code elimination of kernels whose result would otherwise be unused.
+volatile bool sink = false;
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  runs the kernel repeatedly for at least 200ms and records the mean time per call
+//----------------------------------------------------------------------------------------------------------------------
+void runBenchmark(const std::string& name, size_t count, const std::function<bool()>& kernel)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto minDuration = std::chrono::milliseconds(200);
+
+    // warm up the caches
+    sink = kernel();
+
+    size_t     iterations = 0;
+    const auto start = Clock::now();
+    auto       end = start;
+    do {
+        for (int i = 0; i < 16; ++i)
+            sink = kernel();
+        iterations += 16;
+        end = Clock::now();
+    } while (end - start < minDuration);
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    results.push_back({ name, count, iterations, ns / iterations });
+    std::cout << name << "/" << count << ": " << ns / iterations << " ns" << std::endl;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  writes the results in the same layout as Google Benchmark's JSON reporter
+//----------------------------------------------------------------------------------------------------------------------
+bool writeResults(const char* path)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& r = results[i];
+        out << "    {\"name\": \"" << r.name << "/" << r.count << "\", \"iterations\": "
+            << r.iterations << ", \"real_time\": " << r.nsPerIteration
+            << ", \"time_unit\": \"ns\"}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return bool(out);
+}
+
+template <typename T> std::vector<T> makeArray(size_t count, size_t stride, T first, T step)
+{
+    // Fill with repeating tuples so that the "all the same" kernels have to visit every element.
+    std::vector<T> a(count * stride);
+    for (size_t i = 0; i < a.size(); ++i)
+        a[i] = first + T(i % stride) * step;
+    return a;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+    }
+
+    // From a single face up to a dense production mesh.
+    const size_t sizes[] = { 64, 4096, 65536, 1048576 };
+
+    for (size_t count : sizes) {
+        const std::vector<float>   f2 = makeArray<float>(count, 2, 1.0f, 0.5f);
+        const std::vector<float>   f3 = makeArray<float>(count, 3, 1.0f, 0.5f);
+        const std::vector<float>   f4 = makeArray<float>(count, 4, 1.0f, 0.5f);
+        const std::vector<double>  d3 = makeArray<double>(count, 3, 1.0, 0.5);
+        const std::vector<double>  d3b = d3;
+        const std::vector<float>   f3b = f3;
+        const std::vector<int32_t> i1 = makeArray<int32_t>(count, 1, 7, 0);
+        const std::vector<int32_t> i1b = i1;
+        const std::vector<float>   u(count, 0.25f);
+        const std::vector<float>   v(count, 0.75f);
+        std::vector<float>         uv(count * 2);
+        for (size_t i = 0; i < count; ++i) {
+            uv[2 * i] = u[i];
+            uv[2 * i + 1] = v[i];
+        }
+
+        runBenchmark("vec2AreAllTheSame_float", count, [&]() {
+            return MayaUsdUtils::vec2AreAllTheSame(f2.data(), count);
+        });
+        runBenchmark("vec2AreAllTheSame_uv", count, [&]() {
+            return MayaUsdUtils::vec2AreAllTheSame(u.data(), v.data(), count);
+        });
+        runBenchmark("vec3AreAllTheSame_float", count, [&]() {
+            return MayaUsdUtils::vec3AreAllTheSame(f3.data(), count);
+        });
+        runBenchmark("vec4AreAllTheSame_float", count, [&]() {
+            return MayaUsdUtils::vec4AreAllTheSame(f4.data(), count);
+        });
+        runBenchmark("vec3AreAllTheSame_double", count, [&]() {
+            return MayaUsdUtils::vec3AreAllTheSame(d3.data(), count);
+        });
+        runBenchmark("compareArray_float", count, [&]() {
+            return MayaUsdUtils::compareArray(f3.data(), f3b.data(), count * 3, count * 3);
+        });
+        runBenchmark("compareArray_double", count, [&]() {
+            return MayaUsdUtils::compareArray(d3.data(), d3b.data(), count * 3, count * 3);
+        });
+        runBenchmark("compareArray_double_float", count, [&]() {
+            return MayaUsdUtils::compareArray(d3.data(), f3.data(), count * 3, count * 3);
+        });
+        runBenchmark("compareArray_int32", count, [&]() {
+            return MayaUsdUtils::compareArray(i1.data(), i1b.data(), count, count);
+        });
+        runBenchmark("compareUvArray_interleaved", count, [&]() {
+            return MayaUsdUtils::compareUvArray(u.data(), v.data(), uv.data(), count, count);
+        });
+        runBenchmark("compareUvArray_constant", count, [&]() {
+            return MayaUsdUtils::compareUvArray(0.25f, 0.75f, u.data(), v.data(), count);
+        });
+    }
+
+    if (outputPath && !writeResults(outputPath)) {
+        std::cerr << "Failed to write " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,295 @@
+#include <mayaUsdUtils/ALHalf.h>
+#include <mayaUsdUtils/DiffCore.h>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+using MayaUsdUtils::DiffCoreInstructionSet;
+
+namespace {
+
+// The array sizes go over several blocks of the widest kernels, with every remainder.
+const size_t kMaxCount = 37;
+
+// The kernels may load a whole SIMD block past the last compared element.
+const size_t kPadding = 8;
+
+const float  kFloatEps = 1e-3f;
+const double kDoubleEps = 1e-5;
+
+float randFloat() { return float(rand()) / RAND_MAX; }
+
+bool avx2Supported()
+{
+    if (MayaUsdUtils::isDiffCoreInstructionSetSupported(DiffCoreInstructionSet::kAVX2)) {
+        return true;
+    }
+    std::cout << "The AVX2 kernels cannot run on this build or CPU, skipping." << std::endl;
+    return false;
+}
+
+// Runs the comparison with the baseline and the AVX2 kernels, and checks that both agree.
+void expectSameResults(const std::function<bool()>& compare, const char* what, size_t count)
+{
+    ASSERT_TRUE(MayaUsdUtils::setDiffCoreInstructionSet(DiffCoreInstructionSet::kBaseline));
+    const bool baseline = compare();
+    ASSERT_TRUE(MayaUsdUtils::setDiffCoreInstructionSet(DiffCoreInstructionSet::kAVX2));
+    const bool avx2 = compare();
+    EXPECT_EQ(baseline, avx2) << what << " of " << count << " elements";
+}
+
+// Calls the test with, for each element, an offset of the element either within or beyond the
+// comparison epsilon. The offset is 0 for the last call, to compare identical arrays.
+template <typename T>
+void forEachOffset(size_t count, T eps, const std::function<void(size_t, T)>& test)
+{
+    for (size_t i = 0; i < count; ++i) {
+        test(i, eps * T(0.5));
+        test(i, eps * T(4));
+    }
+    test(0, T(0));
+}
+
+// Restores the default selection of the kernels after each test.
+class DiffCoreDispatch : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        if (!MayaUsdUtils::setDiffCoreInstructionSet(DiffCoreInstructionSet::kAVX2)) {
+            MayaUsdUtils::setDiffCoreInstructionSet(DiffCoreInstructionSet::kBaseline);
+        }
+    }
+};
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST_F(DiffCoreDispatch, baselineIsAlwaysSupported)
+{
+    EXPECT_TRUE(MayaUsdUtils::isDiffCoreInstructionSetSupported(DiffCoreInstructionSet::kBaseline));
+    EXPECT_TRUE(MayaUsdUtils::setDiffCoreInstructionSet(DiffCoreInstructionSet::kBaseline));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST_F(DiffCoreDispatch, vecAreAllTheSame)
+{
+    if (!avx2Supported())
+        return;
+
+    for (size_t count = 0; count <= kMaxCount; ++count) {
+        // One element differs from the others, none when changed is count.
+        for (size_t changed = 0; changed <= count; ++changed) {
+            std::vector<float> u(count + kPadding, 2.0f), v(count + kPadding, 3.0f);
+            if (changed < count)
+                v[changed] = 4.0f;
+            expectSameResults(
+                [&]() { return MayaUsdUtils::vec2AreAllTheSame(u.data(), v.data(), count); },
+                "vec2AreAllTheSame(u, v)",
+                count);
+
+            for (size_t dim = 2; dim <= 4; ++dim) {
+                std::vector<float>  f(dim * count + kPadding);
+                std::vector<double> d(dim * count + kPadding);
+                for (size_t i = 0; i < dim * count; ++i) {
+                    f[i] = float(i % dim + 1);
+                    d[i] = double(i % dim + 1);
+                }
+                if (changed < count) {
+                    f[changed * dim + changed % dim] += 1.0f;
+                    d[changed * dim + changed % dim] += 1.0;
+                }
+                expectSameResults(
+                    [&]() {
+                        return dim == 2 ? MayaUsdUtils::vec2AreAllTheSame(f.data(), count)
+                            : dim == 3  ? MayaUsdUtils::vec3AreAllTheSame(f.data(), count)
+                                        : MayaUsdUtils::vec4AreAllTheSame(f.data(), count);
+                    },
+                    "vecAreAllTheSame(float)",
+                    count);
+                expectSameResults(
+                    [&]() {
+                        return dim == 2 ? MayaUsdUtils::vec2AreAllTheSame(d.data(), count)
+                            : dim == 3  ? MayaUsdUtils::vec3AreAllTheSame(d.data(), count)
+                                        : MayaUsdUtils::vec4AreAllTheSame(d.data(), count);
+                    },
+                    "vecAreAllTheSame(double)",
+                    count);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST_F(DiffCoreDispatch, compareFloatingPointArrays)
+{
+    if (!avx2Supported())
+        return;
+
+    for (size_t count = 0; count <= kMaxCount; ++count) {
+        std::vector<float>  f(count + kPadding);
+        std::vector<double> d(count + kPadding);
+        std::vector<GfHalf> h(count + kPadding);
+        for (size_t i = 0; i < count; ++i) {
+            // Values exactly representable as halfs, so that only the offsets differ.
+            h[i] = GfHalf(randFloat());
+            f[i] = float(h[i]);
+            d[i] = double(f[i]);
+        }
+
+        forEachOffset<float>(count, kFloatEps, [&](size_t i, float offset) {
+            std::vector<float> f1(f);
+            if (count)
+                f1[i] += offset;
+            expectSameResults(
+                [&]() { return MayaUsdUtils::compareArray(f.data(), f1.data(), count, count); },
+                "compareArray(float, float)",
+                count);
+            expectSameResults(
+                [&]() { return MayaUsdUtils::compareArray(d.data(), f1.data(), count, count); },
+                "compareArray(double, float)",
+                count);
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareArray(h.data(), f1.data(), count, count, kFloatEps);
+                },
+                "compareArray(half, float)",
+                count);
+
+            std::vector<GfHalf> h1(h);
+            if (count)
+                h1[i] = GfHalf(float(h1[i]) + offset * 8);
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareArray(h.data(), h1.data(), count, count, kFloatEps);
+                },
+                "compareArray(half, half)",
+                count);
+        });
+
+        forEachOffset<double>(count, kDoubleEps, [&](size_t i, double offset) {
+            std::vector<double> d1(d);
+            if (count)
+                d1[i] += offset;
+            expectSameResults(
+                [&]() { return MayaUsdUtils::compareArray(d.data(), d1.data(), count, count); },
+                "compareArray(double, double)",
+                count);
+            expectSameResults(
+                [&]() { return MayaUsdUtils::compareArray(h.data(), d1.data(), count, count); },
+                "compareArray(half, double)",
+                count);
+        });
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST_F(DiffCoreDispatch, compareIntegerArrays)
+{
+    if (!avx2Supported())
+        return;
+
+    for (size_t count = 0; count <= kMaxCount * 2; ++count) {
+        std::vector<int8_t>  a8(count + 32), b8(count + 32);
+        std::vector<int32_t> a32(count + kPadding), b32(count + kPadding);
+        for (size_t i = 0; i < count; ++i) {
+            a8[i] = b8[i] = int8_t(rand());
+            a32[i] = b32[i] = rand();
+        }
+        for (size_t changed = 0; changed <= count; ++changed) {
+            if (changed < count) {
+                ++b8[changed];
+                ++b32[changed];
+            }
+            expectSameResults(
+                [&]() { return MayaUsdUtils::compareArray(a8.data(), b8.data(), count, count); },
+                "compareArray(int8)",
+                count);
+            expectSameResults(
+                [&]() { return MayaUsdUtils::compareArray(a32.data(), b32.data(), count, count); },
+                "compareArray(int32)",
+                count);
+            if (changed < count) {
+                --b8[changed];
+                --b32[changed];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST_F(DiffCoreDispatch, compareVectorArrays)
+{
+    if (!avx2Supported())
+        return;
+
+    for (size_t count = 0; count <= kMaxCount; ++count) {
+        std::vector<float>  u(count + kPadding), v(count + kPadding), uv(2 * count + kPadding);
+        std::vector<float>  p3(3 * count + kPadding), p4(4 * count + kPadding);
+        std::vector<double> p4d(4 * count + kPadding);
+        std::vector<float>  uniformU(count + kPadding, 0.25f), uniformV(count + kPadding, 0.75f);
+        std::vector<float>  rgba(4 * count + kPadding);
+        for (size_t i = 0; i < count; ++i) {
+            u[i] = uv[2 * i] = randFloat();
+            v[i] = uv[2 * i + 1] = randFloat();
+            for (size_t c = 0; c < 3; ++c) {
+                p3[3 * i + c] = p4[4 * i + c] = randFloat();
+                p4d[4 * i + c] = double(p3[3 * i + c]);
+            }
+            p4[4 * i + 3] = 1.0f;
+            p4d[4 * i + 3] = 1.0;
+            rgba[4 * i] = 0.1f;
+            rgba[4 * i + 1] = 0.2f;
+            rgba[4 * i + 2] = 0.3f;
+            rgba[4 * i + 3] = 0.4f;
+        }
+
+        forEachOffset<float>(count, 1e-5f, [&](size_t i, float offset) {
+            std::vector<float>  uv1(uv), u1(uniformU), p41(p4), rgba1(rgba);
+            std::vector<double> p4d1(p4d);
+            if (count) {
+                uv1[2 * i + 1] += offset;
+                u1[i] += offset;
+                p41[4 * i + 2] += offset;
+                p4d1[4 * i + 2] += offset;
+                rgba1[4 * i + 3] += offset;
+            }
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareUvArray(
+                        u.data(), v.data(), uv1.data(), count, count);
+                },
+                "compareUvArray(u, v, uv)",
+                count);
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareUvArray(
+                        0.25f, 0.75f, u1.data(), uniformV.data(), count);
+                },
+                "compareUvArray(u0, v0, u, v)",
+                count);
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareArray3Dto4D(p3.data(), p41.data(), count, count);
+                },
+                "compareArray3Dto4D(float, float)",
+                count);
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareArray3Dto4D(p3.data(), p4d1.data(), count, count);
+                },
+                "compareArray3Dto4D(float, double)",
+                count);
+            expectSameResults(
+                [&]() {
+                    return MayaUsdUtils::compareRGBAArray(
+                        0.1f, 0.2f, 0.3f, 0.4f, rgba1.data(), count);
+                },
+                "compareRGBAArray",
+                count);
+        });
+    }
+}